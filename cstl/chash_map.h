@@ -37,6 +37,9 @@ extern "C" {
 #include <cstl/cstl_hashtable_iterator.h>
 #include <cstl/cstl_hashtable_private.h>
 #include <cstl/cstl_hashtable.h>
+#include <cstl/cstl_flat_hashtable_iterator.h>
+#include <cstl/cstl_flat_hashtable_private.h>
+#include <cstl/cstl_flat_hashtable.h>
 #include <cstl/cutility.h>
 
 #include <cstl/cstl_hash_map_iterator.h>
@@ -32,39 +32,151 @@ extern "C" {
 /** constant declaration and macro section **/
 #ifdef CSTL_MEMORY_MANAGEMENT
 
-#define _MEM_ALIGNMENT              8     /* boundary for small memory block */
-#define _MEM_SMALL_MEM_SIZE_MAX     128   /* the maxinum size of small memory */
-#define _MEM_LINK_COUNT             _MEM_SMALL_MEM_SIZE_MAX/_MEM_ALIGNMENT
+#ifdef CSTL_MEMORY_ALIGNMENT
+#   define _MEM_ALIGNMENT           CSTL_MEMORY_ALIGNMENT
+#else
+#   define _MEM_ALIGNMENT           8     /* boundary for small memory block */
+#endif
+#ifdef CSTL_MEMORY_SMALL_SIZE
+#   define _MEM_SMALL_MEM_SIZE_MAX  CSTL_MEMORY_SMALL_SIZE
+#else
+#   define _MEM_SMALL_MEM_SIZE_MAX  4096  /* the maxinum size of small memory */
+#endif
+
+#if _MEM_ALIGNMENT < 8 || (_MEM_ALIGNMENT & (_MEM_ALIGNMENT - 1)) != 0
+#   error the memory alignment must be a power of 2 and not less than 8.
+#endif
+#if _MEM_SMALL_MEM_SIZE_MAX < _MEM_ALIGNMENT || (_MEM_SMALL_MEM_SIZE_MAX & (_MEM_SMALL_MEM_SIZE_MAX - 1)) != 0
+#   error the maxinum size of small memory must be a power of 2 and not less than memory alignment.
+#endif
+
+/*
+ * the size classes that are not greater than _MEM_TIER_SIZE are spaced by _MEM_ALIGNMENT, each power of 2 above
+ * _MEM_TIER_SIZE is split into _MEM_TIER_CLASS_COUNT size classes.
+ */
+#define _MEM_TIER_SIZE              (_MEM_SMALL_MEM_SIZE_MAX < 16 * _MEM_ALIGNMENT ? _MEM_SMALL_MEM_SIZE_MAX : 16 * _MEM_ALIGNMENT)
+#define _MEM_TIER_CLASS_COUNT       4
+#define _MEM_TIER_COUNT\
+    ((_MEM_SMALL_MEM_SIZE_MAX > _MEM_TIER_SIZE) + (_MEM_SMALL_MEM_SIZE_MAX > (_MEM_TIER_SIZE << 1)) +\
+     (_MEM_SMALL_MEM_SIZE_MAX > (_MEM_TIER_SIZE << 2)) + (_MEM_SMALL_MEM_SIZE_MAX > (_MEM_TIER_SIZE << 3)) +\
+     (_MEM_SMALL_MEM_SIZE_MAX > (_MEM_TIER_SIZE << 4)) + (_MEM_SMALL_MEM_SIZE_MAX > (_MEM_TIER_SIZE << 5)) +\
+     (_MEM_SMALL_MEM_SIZE_MAX > (_MEM_TIER_SIZE << 6)) + (_MEM_SMALL_MEM_SIZE_MAX > (_MEM_TIER_SIZE << 7)))
+#if _MEM_SMALL_MEM_SIZE_MAX > (_MEM_TIER_SIZE << 8)
+#   error the maxinum size of small memory is too large.
+#endif
+
+#define _MEM_LINK_COUNT             (_MEM_TIER_SIZE / _MEM_ALIGNMENT + _MEM_TIER_COUNT * _MEM_TIER_CLASS_COUNT)
 #define _MEM_CHUNK_COUNT            16    /* default chunk count getted from pool */
+#define _MEM_CHUNK_SIZE_MAX         2048  /* the maxinum size of chunks getted from pool at once */
 #define _MEM_POOL_DEFAULT_COUNT     16    /* memory pool count */
+#define _MEM_MAGAZINE_SIZE          64    /* memory block count kept by thread cache for each size */
 
-/* round up the size of memory to the multiple of 8 */
+/* round up the size of memory to the multiple of alignment */
 #define _MEM_ROUND_UP(memsize)      (((memsize) + _MEM_ALIGNMENT - 1) & ~(_MEM_ALIGNMENT - 1))
 /* get the memory link index with memsize */
-#define _MEM_LINK_INDEX(memsize)    (((memsize) + _MEM_ALIGNMENT - 1) / _MEM_ALIGNMENT - 1)
+#define _MEM_LINK_INDEX(memsize)    _alloc_get_memlink_index(memsize)
+/* get the size of memory block in memory link */
+#define _MEM_LINK_SIZE(index)       _alloc_get_memlink_size(index)
+
+#endif /* CSTL_MEMORY_MANAGEMENT */
+
+#if defined(CSTL_MEMORY_MANAGEMENT) && _MEM_ALIGNMENT > 16
+#   define _MEM_REGION_ALIGNMENT    _MEM_ALIGNMENT
+#else
+#   define _MEM_REGION_ALIGNMENT    16    /* boundary for memory block in region */
+#endif
+#define _MEM_REGION_BLOCK_SIZE      8192  /* the size of region block */
+/* the memory that is larger than _MEM_REGION_LARGE_SIZE is allocated in standalone region block */
+#define _MEM_REGION_LARGE_SIZE      (_MEM_REGION_BLOCK_SIZE / 4)
+
+/* round up the size of memory to the multiple of region alignment */
+#define _MEM_REGION_ROUND_UP(memsize) (((memsize) + _MEM_REGION_ALIGNMENT - 1) & ~((size_t)_MEM_REGION_ALIGNMENT - 1))
 
 /** data type declaration and struct, union, enum section **/
+/*
+ * the user defined allocator that is used by container instead of the libcstl memory management,
+ * pv_context is passed to allocate and deallocate function unchanged.
+ */
+typedef struct _tagallocator
+{
+    void* (*_pfun_allocate)(void* pv_context, size_t t_size);                 /* allocate t_size bytes memory */
+    void  (*_pfun_deallocate)(void* pv_context, void* pv_mem, size_t t_size); /* release memory of t_size bytes */
+    void*   _pv_context;                                                     /* user context */
+}allocator_t;
+
+/* the memory statistics of allocator */
+typedef struct _tagallocstat
+{
+    size_t _t_livesize;     /* bytes in use */
+    size_t _t_highsize;     /* the maximum bytes in use, the high watermark */
+    size_t _t_cachedsize;   /* bytes kept by allocator for reuse */
+    size_t _t_poolcount;    /* memory pools and region blocks applied from system heap */
+}_allocstat_t;
+
+#ifdef CSTL_MEMORY_MANAGEMENT
+
 typedef union _tagmemlink
 {
     union _tagmemlink* _pui_nextmem;  /* point to next memory block */
     _byte_t            _pby_mem[1];    /* represent memory block */
 }_memlink_t;
 
+/* the occupancy of one size class */
+typedef struct _tagmemclass
+{
+    size_t _t_livecount;    /* memory blocks in use */
+    size_t _t_highcount;    /* the maximum memory blocks in use */
+}_memclass_t;
+
+/* the memory statistics of one size class */
+typedef struct _tagmemclassstat
+{
+    size_t _t_blocksize;    /* the size of memory block */
+    size_t _t_livecount;    /* memory blocks in use */
+    size_t _t_highcount;    /* the maximum memory blocks in use */
+    size_t _t_cachedcount;  /* memory blocks in memory list */
+}_memclassstat_t;
+
+#endif /* CSTL_MEMORY_MANAGEMENT */
+
+/*
+ * the state of allocator that most containers never use, it is created by _alloc_set_allocator or _alloc_set_region
+ * so that it does not enlarge every container.
+ */
+typedef struct _tagallocext
+{
+    allocator_t _t_custom;                       /* user defined allocator */
+    bool_t      _b_region;                       /* allocate memory from region */
+    _byte_t*    _pby_regionblock;                /* region block list */
+    _byte_t*    _pby_regionpos;                  /* free memory start of current region block */
+    _byte_t*    _pby_regionend;                  /* free memory end of current region block */
+}_allocext_t;
+
+#ifdef CSTL_MEMORY_MANAGEMENT
+
 typedef struct _tagalloc
 {
-    _memlink_t* _apt_memlink[_MEM_LINK_COUNT];   /* memory list */
-    _byte_t**   _ppby_mempoolcontainer;          /* memory pool container */
-    _byte_t*    _pby_mempool;                    /* memory pool start */
-    size_t      _t_mempoolsize;                  /* memory pool size */
-    size_t      _t_mempoolindex;                 /* memory pool index */
-    size_t      _t_mempoolcount;                 /* memory pool count */
+    _memlink_t*  _apt_memlink[_MEM_LINK_COUNT];  /* memory list */
+    _byte_t**    _ppby_mempoolcontainer;         /* memory pool container */
+    _byte_t*     _pby_mempool;                   /* memory pool start */
+    size_t       _t_mempoolsize;                 /* memory pool size */
+    size_t       _t_mempoolindex;                /* memory pool index */
+    size_t       _t_mempoolcount;                /* memory pool count */
+    size_t       _t_livesize;                    /* bytes in use */
+    size_t       _t_highsize;                    /* the maximum bytes in use */
+#ifdef CSTL_MEMORY_CLASS_STAT
+    _memclass_t  _at_memclass[_MEM_LINK_COUNT];  /* occupancy of each size class */
+#endif
+    _allocext_t* _pt_ext;                        /* user defined allocator or region */
 }_alloc_t;
 
 #else
 
 typedef struct _tagalloc
 {
-    int n_avoid_vc_error_c2016;
+    size_t       _t_livesize;                    /* bytes in use */
+    size_t       _t_highsize;                    /* the maximum bytes in use */
+    _allocext_t* _pt_ext;                        /* user defined allocator or region */
 }_alloc_t;
 
 #endif /* CSTL_MEMORY_MANAGEMENT */
@@ -113,6 +225,72 @@ extern void* _alloc_allocate(_alloc_t* pt_allocator, size_t t_size, size_t t_cou
  */
 extern void _alloc_deallocate(_alloc_t* pt_allocator, void* pv_allocmem, size_t t_size, size_t t_count);
 
+/**
+ * Use user defined allocator instead of the libcstl memory management.
+ * @param pt_allocator  pointer that points to allocator.
+ * @param cpt_custom    user defined allocator.
+ * @return void.
+ * @remarks if pt_allocator == NULL or cpt_custom == NULL, or the allocate or deallocate function of cpt_custom is
+ *          NULL, then function of the behavior is undefined. pt_allocator must be initialized by _alloc_init and
+ *          no memory is allocated from it, otherwise the behavior is undefined.
+ */
+extern void _alloc_set_allocator(_alloc_t* pt_allocator, const allocator_t* cpt_custom);
+
+/**
+ * Allocate memory from region, the memory is released all at once.
+ * @param pt_allocator  pointer that points to allocator.
+ * @return void.
+ * @remarks if pt_allocator == NULL, then function of the behavior is undefined. pt_allocator must be initialized by
+ *          _alloc_init, no memory is allocated from it and it has no user defined allocator, otherwise the behavior is
+ *          undefined. _alloc_deallocate does nothing for the allocator in region mode, all memory is released by
+ *          _alloc_release_region or _alloc_destroy.
+ */
+extern void _alloc_set_region(_alloc_t* pt_allocator);
+
+/**
+ * Test the allocator allocates memory from region.
+ * @param cpt_allocator  pointer that points to allocator.
+ * @return if allocator is in region mode then return true, else return false.
+ * @remarks if cpt_allocator == NULL, then function of the behavior is undefined.
+ */
+extern bool_t _alloc_is_region(const _alloc_t* cpt_allocator);
+
+/**
+ * Release all memory that is allocated from region.
+ * @param pt_allocator  pointer that points to allocator.
+ * @return void.
+ * @remarks if pt_allocator == NULL, then function of the behavior is undefined. if the allocator is not in region mode,
+ *          then the function does nothing. the allocator is still in region mode after released.
+ */
+extern void _alloc_release_region(_alloc_t* pt_allocator);
+
+/**
+ * Get the memory statistics of allocator.
+ * @param cpt_allocator  pointer that points to allocator.
+ * @param pt_stat        memory statistics.
+ * @return void.
+ * @remarks if cpt_allocator == NULL or pt_stat == NULL, then function of the behavior is undefined. the live size is
+ *          counted by the size of memory block in small size class and by the requested size otherwise, the memory
+ *          released in region mode is still in use until the region is released. the cached size counts the memory
+ *          lists, the rest of memory pool and the rest of region block that are kept by this allocator, the memory
+ *          kept by shared memory pool or thread cache is not counted.
+ */
+extern void _alloc_get_stat(const _alloc_t* cpt_allocator, _allocstat_t* pt_stat);
+
+#ifdef CSTL_MEMORY_MANAGEMENT
+/**
+ * Get the memory statistics of one size class.
+ * @param cpt_allocator  pointer that points to allocator.
+ * @param t_index        size class index.
+ * @param pt_stat        memory statistics of size class.
+ * @return void.
+ * @remarks if cpt_allocator == NULL or pt_stat == NULL, or t_index >= _MEM_LINK_COUNT, then function of the behavior
+ *          is undefined. the live and maximum block counts are kept only when CSTL_MEMORY_CLASS_STAT is defined,
+ *          otherwise they are 0.
+ */
+extern void _alloc_get_class_stat(const _alloc_t* cpt_allocator, size_t t_index, _memclassstat_t* pt_stat);
+#endif /* CSTL_MEMORY_MANAGEMENT */
+
 #ifndef NDEBUG
 /**
  * Test alloc_t is initialized.
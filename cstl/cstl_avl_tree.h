@@ -210,6 +210,15 @@ extern bool_t _avl_tree_empty(const _avl_tree_t* cpt_avl_tree);
  */
 extern size_t _avl_tree_max_size(const _avl_tree_t* cpt_avl_tree);
 
+/**
+ * Get the memory that is allocated by the avl tree.
+ * @param cpt_avl_tree      avl tree container.
+ * @return the bytes of nodes and the memory cached by the allocator of avl tree.
+ * @remarks if cpt_avl_tree == NULL, then the behavior is undefined, the cpt_avl_tree must be initialized, otherwise
+ *          the behavior is undefined. the avl tree structure itself is not counted.
+ */
+extern size_t _avl_tree_memory_usage(const _avl_tree_t* cpt_avl_tree);
+
 /**
  * Return an iterator that addresses the first element in the avl tree.
  * @param cpt_avl_tree      avl tree container.
@@ -251,6 +260,21 @@ extern bfun_t _avl_tree_key_comp(const _avl_tree_t* cpt_avl_tree);
  */
 extern _avl_tree_iterator_t _avl_tree_find(const _avl_tree_t* cpt_avl_tree, const void* cpv_value);
 
+/**
+ * Find a batch of specific elements.
+ * @param cpt_avl_tree      avl tree container.
+ * @param cppv_values       array of pointers to specific elements.
+ * @param t_count           element count of array.
+ * @param pit_result        array of iterators that receives the result.
+ * @return void.
+ * @remarks if cpt_avl_tree == NULL, cppv_values == NULL or pit_result == NULL then the behavior is undefined.
+ *          cpt_avl_tree must be initialized, otherwise the behavior is undefined. the type of specific elements and
+ *          cpt_avl_tree must be same, otherwise the behavior is undefined. the iterator of each element is same as
+ *          _avl_tree_find(). the lookups descend the tree together, so the cache misses of them are overlapped.
+ */
+extern void _avl_tree_find_batch(
+    const _avl_tree_t* cpt_avl_tree, const void* const* cppv_values, size_t t_count, _avl_tree_iterator_t* pit_result);
+
 /**
  * Erases all the elements of an avl tree.
  * @param pt_avl_tree       avl tree container.
@@ -381,6 +405,17 @@ extern bool_t _avl_tree_greater_equal(const _avl_tree_t* cpt_first, const _avl_t
  */
 extern void _avl_tree_swap(_avl_tree_t* pt_first, _avl_tree_t* pt_second);
 
+/**
+ * Move the datas of avl tree into uninitialized memory.
+ * @param pt_target         uninitialized avl tree memory.
+ * @param pt_source         source avl tree container.
+ * @return void.
+ * @remarks if pt_target == NULL or pt_source == NULL, then the behavior is undefined. the source avl tree must be
+ *          initialized, otherwise the behavior is undefined. after moving, the memory of source avl tree is
+ *          uninitialized and must not be destroyed.
+ */
+extern void _avl_tree_relocate(_avl_tree_t* pt_target, _avl_tree_t* pt_source);
+
 /**
  * Inserts an unique element into a avl tree.
  * @param pt_avl_tree       avl tree container.
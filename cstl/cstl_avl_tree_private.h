@@ -67,6 +67,7 @@ typedef struct _tagavltree
     /* avl tree node */
     _avlnode_t        _t_avlroot;
     size_t            _t_nodecount;
+    size_t            _t_nodesize;  /* node size, including the inline storage of pair element */
 
     /* compare function for the inserting order */
     bfun_t            _t_compare;
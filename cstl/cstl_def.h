@@ -68,6 +68,13 @@ extern "C" {
 #   define va_copy(dest, src) ((dest) = (src))
 #endif
 
+/* hint that the memory will be read soon, so that the cache miss overlaps with other work */
+#ifdef __GNUC__
+#   define _CSTL_PREFETCH(cpv_addr) __builtin_prefetch((cpv_addr))
+#else
+#   define _CSTL_PREFETCH(cpv_addr) ((void)(cpv_addr))
+#endif
+
 /**
  * libcstl version macro.
  */
@@ -39,6 +39,17 @@ extern "C" {
  */
 #define create_deque(...) _create_deque(#__VA_ARGS__)
 
+/**
+ * Create deque container that allocates memory by user defined allocator.
+ * @param cpt_allocator  user defined allocator.
+ * @param ...            element type name.
+ * @return if create deque successfully return deque pointer, otherwise return NULL.
+ * @remarks if cpt_allocator == NULL, then the behavior is undefined. the allocator is used by all the memory of elements
+ *          and must be valid until the deque is destroyed. element type name should be C builtin type name, libcstl
+ *          builtin typename or registed user defined type name, otherwise the function will return NULL.
+ */
+#define create_deque_with_allocator(cpt_allocator, ...) _create_deque_with_allocator((cpt_allocator), #__VA_ARGS__)
+
 /**
  * Initialize deque with specified element.
  * @param pdeq_deque   uninitialized deque container.
@@ -215,6 +226,16 @@ extern size_t deque_size(const deque_t* cpdeq_deque);
  */
 extern size_t deque_max_size(const deque_t* cpdeq_deque);
 
+/**
+ * Get the memory that is held by the deque.
+ * @param cpdeq_deque   deque container.
+ * @return the bytes of deque structure, map and element chunks and the memory cached by the allocator of deque.
+ * @remarks if cpdeq_deque == NULL, then the behavior is undefined. cpdeq_deque must be initialized, otherwise the
+ *          behavior is undefined. the memory that is owned by the elements themselves, such as the string of char* or
+ *          the nodes of nested container, is not counted.
+ */
+extern size_t deque_memory_usage(const deque_t* cpdeq_deque);
+
 /**
  * Return a iterator to the first element in the deque container.
  * @param cpdeq_deque    deque container.
@@ -468,6 +489,28 @@ extern void deque_clear(deque_t* pdeq_deque);
  */
 extern void deque_resize(deque_t* pdeq_deque, size_t t_resize);
 
+/**
+ * Adds an element that is pointed by pointer to the end of deque.
+ * @param pdeq_deque    deque container.
+ * @param cpv_value    pointer to specific element.
+ * @return void.
+ * @remarks if pdeq_deque == NULL or cpv_value == NULL, then the behavior is undefined. the deque must be initialized,
+ *          otherwise the behavior is undefined. cpv_value points to the element, but it is char* for c string element.
+ *          the element is copied without the variable argument list.
+ */
+extern void deque_push_back_ptr(deque_t* pdeq_deque, const void* cpv_value);
+
+/**
+ * Adds an element that is pointed by pointer to the begin of deque.
+ * @param pdeq_deque    deque container.
+ * @param cpv_value    pointer to specific element.
+ * @return void.
+ * @remarks if pdeq_deque == NULL or cpv_value == NULL, then the behavior is undefined. the deque must be initialized,
+ *          otherwise the behavior is undefined. cpv_value points to the element, but it is char* for c string element.
+ *          the element is copied without the variable argument list.
+ */
+extern void deque_push_front_ptr(deque_t* pdeq_deque, const void* cpv_value);
+
 #ifdef __cplusplus
 }
 #endif
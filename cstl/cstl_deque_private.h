@@ -63,6 +63,17 @@ typedef struct _tagdeque
  */
 extern deque_t* _create_deque(const char* s_typename);
 
+/**
+ * Create deque container that uses user defined allocator.
+ * @param cpt_allocator     user defined allocator.
+ * @param s_typename        element type name.
+ * @return if create deque successfully return deque pointer, otherwise return NULL.
+ * @remarks if cpt_allocator == NULL or s_typename == NULL, then the behavior is undefined. s_typename should be C
+ *          builtin type name, libcstl builtin typename or registed user defined type name, otherwise the function will
+ *          return NULL.
+ */
+extern deque_t* _create_deque_with_allocator(const allocator_t* cpt_allocator, const char* s_typename);
+
 /**
  * Create deque container auxiliary function.
  * @param pdeq_deque  uncreated container.
@@ -240,6 +251,17 @@ extern deque_iterator_t _deque_insert_n_varg(deque_t* pdeq_deque, deque_iterator
  */
 extern void _deque_init_elem_auxiliary(deque_t* pdeq_deque, void* pv_value);
 
+/**
+ * Move the datas of deque into uninitialized memory.
+ * @param pdeq_target   uninitialized deque memory.
+ * @param pdeq_source   source deque container.
+ * @return void.
+ * @remarks if pdeq_target == NULL or pdeq_source == NULL, then the behavior is undefined. the source deque must be
+ *          initialized, otherwise the behavior is undefined. after moving, the memory of source deque is uninitialized
+ *          and must not be destroyed.
+ */
+extern void _deque_relocate(deque_t* pdeq_target, deque_t* pdeq_source);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,480 @@
+/*
+ *  The interface of flat hashtable.
+ *  Copyright (C)  2008 - 2014  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+#ifndef _CSTL_FLAT_HASHTABLE_H_
+#define _CSTL_FLAT_HASHTABLE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** include section **/
+
+/** constant declaration and macro section **/
+
+/** data type declaration and struct, union, enum section **/
+
+/* for the result of equal_range and insert_unique function */
+
+/** exported global variable declaration section **/
+
+/** exported function prototype section **/
+/**
+ * Create flat hashtable container.
+ * @param s_typename        element type name.
+ * @return if create flat hashtable successfully return flat hashtable pointer, otherwise return NULL.
+ * @remarks s_typename == NULL, then the behavior is undefined. s_typename should be C builtin type name, libcstl builtin
+ *          typename or registed user defined type name, otherwise the function will return NULL.
+ */
+extern _flat_hashtable_t* _create_flat_hashtable(const char* s_typename);
+
+/**
+ * Initialize flat hashtable container.
+ * @param pt_hashtable      flat hashtable container.
+ * @param t_bucketcount     slot count, it is rounded up to power of 2.
+ * @param ufun_hash         hash function.
+ * @param bfun_compare      compare function.
+ * @return void.
+ * @remarks if pt_hashtable == NULL, then the behavior is undefined, pt_hashtable must be created by _create_flat_hashtable(),
+ *          otherwise the behavior is undefined. if ufun_hash == NULL or bfun_compare == NULL, then the default hash function is used,
+ *          and the default compare function is used.
+ */
+extern void _flat_hashtable_init(_flat_hashtable_t* pt_hashtable, size_t t_bucketcount, ufun_t ufun_hash, bfun_t bfun_compare);
+
+/**
+ * Initialize flat hashtable container with flat hashtable.
+ * @param pt_dest           destination flat hashtable.
+ * @param cpt_src           source flat hashtable.
+ * @return void.
+ * @remarks if pt_dest == NULL or cpt_src == NULL, then the behavior is undefined, pt_dest must be created by
+ *          _create_flat_hashtable(), cpt_src must be initialized, otherwise the behavior is undefined. the element type of
+ *          pt_dest and cpt_src must be same, otherwise the behavior is undefine.
+ */
+extern void _flat_hashtable_init_copy(_flat_hashtable_t* pt_dest, const _flat_hashtable_t* cpt_src);
+
+/**
+ * Initialize flat hashtable container with specific range.
+ * @param pt_dest           destination flat hashtable.
+ * @param it_begin          begin of range.
+ * @param it_end            end of range.
+ * @param t_bucketcount     slot count, it is rounded up to power of 2.
+ * @param ufun_hash         hash function.
+ * @param bfun_compare      compare function.
+ * @return void.
+ * @remarks if pt_dest == NULL, then the behavior is undefined, pt_dest must be created by _create_flat_hashtable(), otherwise
+ *          the behavior is undefined. the type of [it_begin, it_end) and pt_dest must be same, otherwise the behavior
+ *          is undefined. if ufun_hash == NULL or bfun_compare == NULL, then the default hash function is used and the 
+ *          default compare function is used.
+ */
+extern void _flat_hashtable_init_copy_unique_range(
+    _flat_hashtable_t* pt_dest, iterator_t it_begin, iterator_t it_end, size_t t_bucketcount,
+    ufun_t ufun_hash, bfun_t bfun_compare);
+
+/**
+ * Initialize flat hashtable container with specific array.
+ * @param pt_dest           destination flat hashtable.
+ * @param cpv_array         array.
+ * @param t_count           element count of array.
+ * @param t_bucketcount     slot count, it is rounded up to power of 2.
+ * @param ufun_hash         hash function.
+ * @param bfun_compare      compare function.
+ * @return void.
+ * @remarks if pt_dest == NULL, then the behavior is undefined, pt_dest must be created by _create_flat_hashtable(), otherwise
+ *          the behavior is undefined. the type of array and pt_dest must be same, otherwise the behavior is undefined. 
+ *          if ufun_hash == NULL or bfun_compare == NULL, then the default hash function is used and the default compare 
+ *          function is used.
+ */
+extern void _flat_hashtable_init_copy_unique_array(
+    _flat_hashtable_t* pt_dest, const void* cpv_array, size_t t_count, size_t t_bucketcount,
+    ufun_t ufun_hash, bfun_t bfun_compare);
+
+/**
+ * Destroy flat hashtable.
+ * @param pt_hashtable       flat hashtable container.
+ * @return void.
+ * @remarks if pt_hashtable == NULL, then the behavior is undefined, the flat hashtable must be initialized or created by
+ *          _create_flat_hashtable(), otherwise the behavior is undefined.
+ */
+extern void _flat_hashtable_destroy(_flat_hashtable_t* pt_hashtable);
+
+/**
+ * Assign flat hashtable container.
+ * @param pt_dest           destination flat hashtable container.
+ * @param cpt_src           source flat hashtable container.
+ * @return void.
+ * @remarks if pt_dest == NULL or cpt_src == NULL, the the behavior is undefined. two flat hashtable must be initialized, otherwise
+ *          the behavior is undefined. if _flat_hashtable_equal(pt_dest, cpt_src), the function dest nothing.
+ */
+extern void _flat_hashtable_assign(_flat_hashtable_t* pt_dest, const _flat_hashtable_t* cpt_src);
+
+/**
+ * Get the number of elements int the flat hashtable.
+ * @param cpt_hashtable      flat hashtable container.
+ * @return the number of elements in the flat hashtable.
+ * @remarks if cpt_hashtable == NULL, then the behavior is undefined, the cpt_hashtable must be initialized, otherwise the
+ *          behavior is undefined.
+ */
+extern size_t _flat_hashtable_size(const _flat_hashtable_t* cpt_hashtable);
+
+/**
+ * Test if an flat hashtable is empty.
+ * @param cpt_hashtable      flat hashtable container.
+ * @return true if the flat hashtable is empty, otherwise return false.
+ * @remarks if cpt_hashtable == NULL, then the behavior is undefined, the cpt_hashtable must be initialized, otherwise the
+ *          behavior is undefined.
+ */
+extern bool_t _flat_hashtable_empty(const _flat_hashtable_t* cpt_hashtable);
+
+/**
+ * Get the maximum number of elements int the flat hashtable.
+ * @param cpt_hashtable      flat hashtable container.
+ * @return the maximum number of elements in the flat hashtable.
+ * @remarks if cpt_hashtable == NULL, then the behavior is undefined, the cpt_hashtable must be initialized, otherwise the
+ *          behavior is undefined.
+ */
+extern size_t _flat_hashtable_max_size(const _flat_hashtable_t* cpt_hashtable);
+
+/**
+ * Get the memory that is allocated by the flat hashtable.
+ * @param cpt_hashtable      flat hashtable container.
+ * @return the bytes of control array, slot array and the memory cached by the allocator of flat hashtable.
+ * @remarks if cpt_hashtable == NULL, then the behavior is undefined, the cpt_hashtable must be initialized, otherwise
+ *          the behavior is undefined. the flat hashtable structure itself is not counted.
+ */
+extern size_t _flat_hashtable_memory_usage(const _flat_hashtable_t* cpt_hashtable);
+
+/**
+ * Get the slot count of the flat hashtable.
+ * @param cpt_hashtable      flat hashtable container.
+ * @return the slot count of the flat hashtable.
+ * @remarks if cpt_hashtable == NULL, then the behavior is undefined, the cpt_hashtable must be initialized, otherwise the
+ *          behavior is undefined.
+ */
+extern size_t _flat_hashtable_bucket_count(const _flat_hashtable_t* cpt_hashtable);
+
+/**
+ * Get the average number of elements per slot.
+ * @param cpt_hashtable      flat hashtable container.
+ * @return the load factor of the flat hashtable.
+ * @remarks if cpt_hashtable == NULL, then the behavior is undefined, the cpt_hashtable must be initialized, otherwise the
+ *          behavior is undefined.
+ */
+extern float _flat_hashtable_load_factor(const _flat_hashtable_t* cpt_hashtable);
+
+/**
+ * Get the max load factor of the flat hashtable.
+ * @param cpt_hashtable      flat hashtable container.
+ * @return the max load factor of the flat hashtable.
+ * @remarks if cpt_hashtable == NULL, then the behavior is undefined, the cpt_hashtable must be initialized, otherwise the
+ *          behavior is undefined.
+ */
+extern float _flat_hashtable_max_load_factor(const _flat_hashtable_t* cpt_hashtable);
+
+/**
+ * Set the max load factor of the flat hashtable.
+ * @param pt_hashtable       flat hashtable container.
+ * @param f_maxloadfactor    new max load factor.
+ * @return void.
+ * @remarks if pt_hashtable == NULL, then the behavior is undefined, the pt_hashtable must be initialized, otherwise the
+ *          behavior is undefined. f_maxloadfactor must be greater than 0, otherwise the behavior is undefined. the max
+ *          load factor that is more than 7/8 works as 7/8, because the lookup needs empty slots.
+ */
+extern void _flat_hashtable_set_max_load_factor(_flat_hashtable_t* pt_hashtable, float f_maxloadfactor);
+
+/**
+ * Return an iterator that addresses the first element in the flat hashtable.
+ * @param cpt_hashtable      flat hashtable container.
+ * @return an iterator that addresses the first element in the flat hashtable.
+ * @remarks if cpt_hashtable == NULL, the behavior is undefined. cpt_hashtable must be initialized, otherwise the behavior
+ *          is undefined. return _flat_hashtable_end(), if the flat hashtable is empty.
+ */
+extern _flat_hashtable_iterator_t _flat_hashtable_begin(const _flat_hashtable_t* cpt_hashtable);
+
+/**
+ * Return an iterator that addresses the location succeeding the last element in the flat hashtable.
+ * @param cpt_hashtable      flat hashtable container.
+ * @return an iterator that addresses location succeeding the last element in the flat hashtable.
+ * @remarks if cpt_hashtable == NULL, the behavior is undefined. cpt_hashtable must be initialized, otherwise the behavior
+ *          is undefined.
+ */
+extern _flat_hashtable_iterator_t _flat_hashtable_end(const _flat_hashtable_t* cpt_hashtable);
+
+/**
+ * Return the hash function.
+ * @param cpt_hashtable      flat hashtable container.
+ * @return hash function.
+ * @remarks if cpt_hashtable == NULL, the behavior is undefined. cpt_hashtable must be initialized, otherwise the behavior
+ *          is undefined.
+ */
+extern ufun_t _flat_hashtable_hash(const _flat_hashtable_t* cpt_hashtable);
+
+/**
+ * Return the compare function of key.
+ * @param cpt_hashtable      flat hashtable container.
+ * @return compare function.
+ * @remarks if cpt_hashtable == NULL, the behavior is undefined. cpt_hashtable must be initialized, otherwise the behavior
+ *          is undefined.
+ */
+extern bfun_t _flat_hashtable_key_comp(const _flat_hashtable_t* cpt_hashtable);
+
+/**
+ * Find specific element.
+ * @param cpt_hashtable      flat hashtable container.
+ * @param cpv_value         specific element.
+ * @return iterator addresses the sprcific element in the flat hashtable, otherwise return _flat_hashtable_end().
+ * @remarks if cpt_hashtable == NULL or cpv_value == NULL then the behavior is undefined. cpt_hashtable must be initialized,
+ *          otherwise the behavior is undefined. the type of specific element and cpt_hashtable must be same, otherwise the
+ *          behavior is undefined.
+ */
+extern _flat_hashtable_iterator_t _flat_hashtable_find(const _flat_hashtable_t* cpt_hashtable, const void* cpv_value);
+
+/**
+ * Find a batch of specific elements.
+ * @param cpt_hashtable     flat hashtable container.
+ * @param cppv_values       array of pointers to specific elements.
+ * @param t_count           element count of array.
+ * @param pit_result        array of iterators that receives the result.
+ * @return void.
+ * @remarks if cpt_hashtable == NULL, cppv_values == NULL or pit_result == NULL then the behavior is undefined.
+ *          cpt_hashtable must be initialized, otherwise the behavior is undefined. the type of specific elements and
+ *          cpt_hashtable must be same, otherwise the behavior is undefined. the iterator of each element is same as
+ *          _flat_hashtable_find(). the first probed group of each element is prefetched before the groups are
+ *          matched.
+ */
+extern void _flat_hashtable_find_batch(
+    const _flat_hashtable_t* cpt_hashtable, const void* const* cppv_values, size_t t_count,
+    _flat_hashtable_iterator_t* pit_result);
+
+/**
+ * Erases all the elements of an flat hashtable.
+ * @param pt_hashtable       flat hashtable container.
+ * @return void.
+ * @remarks if pt_hashtable == NULL, the behavior is undefined. pt_hashtable must be initialized, otherwise the behavior
+ *          is undefined.
+ */
+extern void _flat_hashtable_clear(_flat_hashtable_t* pt_hashtable);
+
+/**
+ * Return the number of specific elements in an flat hashtable
+ * @param cpt_hashtable       flat hashtable container.
+ * @param cpv_value         specific element.
+ * @return the number of specific elements.
+ * @remarks if cpt_hashtable == NULL or cpv_value == NULL then the behavior is undefined. cpt_hashtable must be initialized,
+ *          otherwise the behavior is undefined. the type of specific element and cpt_hashtable must be same, otherwise the
+ *          behavior is undefined.
+ */
+extern size_t _flat_hashtable_count(const _flat_hashtable_t* cpt_hashtable, const void* cpv_value);
+
+/**
+ * Return an iterator range that is equal to a specific element.
+ * @param cpt_hashtable      flat hashtable container.
+ * @param cpv_value         specific element.
+ * @return an iterator range that is equal to a specific element.
+ * @remarks if cpt_hashtable == NULL or cpv_value == NULL then the behavior is undefined. cpt_hashtable must be initialized,
+ *          otherwise the behavior is undefined. the type of specific element and cpt_hashtable must be same, otherwise the
+ *          behavior is undefined.
+ */
+extern range_t _flat_hashtable_equal_range(const _flat_hashtable_t* cpt_hashtable, const void* cpv_value);
+
+/**
+ * Tests if the two flat hashtable are equal.
+ * @param cpt_first         first flat hashtable container.
+ * @param cpt_second        second flat hashtable container.
+ * @return if first flat hashtable equal to second flat hashtable, then return true, else return false.
+ * @remarks if cpt_first == NULL or cpt_second == NULL, then the behavior is undefined. the two flat hashtable must be
+ *          initialized, otherwise the behavior is undefined. if the two flat hashtable are not same type, then return false.
+ *          if cpt_first == cpt_second, then return true. the order of elements is not compared, the two flat hashtable
+ *          are equal if they have the same elements.
+ */
+extern bool_t _flat_hashtable_equal(const _flat_hashtable_t* cpt_first, const _flat_hashtable_t* cpt_second);
+
+/**
+ * Tests if the two flat hashtable are not equal.
+ * @param cpt_first         first flat hashtable container.
+ * @param cpt_second        second flat hashtable container.
+ * @return if first flat hashtable not equal to second flat hashtable, then return true, else return false.
+ * @remarks if cpt_first == NULL or cpt_second == NULL, then the behavior is undefined. the two flat hashtable must be
+ *          initialized, otherwise the behavior is undefined. if the two flat hashtable are not same type, then return false.
+ *          if cpt_first == cpt_second, then return false.
+ */
+extern bool_t _flat_hashtable_not_equal(const _flat_hashtable_t* cpt_first, const _flat_hashtable_t* cpt_second);
+
+/**
+ * Tests if the first flat hashtable is less than the second flat hashtable.
+ * @param cpt_first         first flat hashtable container.
+ * @param cpt_second        second flat hashtable container.
+ * @return if first flat hashtable is less than the second flat hashtable, then return true, else return false.
+ * @remarks if cpt_first == NULL or cpt_second == NULL, then the behavior is undefined. the two flat hashtable must be
+ *          initialized, otherwise the behavior is undefined. if the two flat hashtable are not same type, the behavior is
+ *          undefined. if cpt_first == cpt_second, then return false.
+ */
+extern bool_t _flat_hashtable_less(const _flat_hashtable_t* cpt_first, const _flat_hashtable_t* cpt_second);
+
+/**
+ * Tests if the first flat hashtable is less than or equal to the second flat hashtable.
+ * @param cpt_first         first flat hashtable container.
+ * @param cpt_second        second flat hashtable container.
+ * @return if first flat hashtable is less than or equal to the second flat hashtable, then return true, else return false.
+ * @remarks if cpt_first == NULL or cpt_second == NULL, then the behavior is undefined. the two flat hashtable must be
+ *          initialized, otherwise the behavior is undefined. if the two flat hashtable are not same type, the behavior is
+ *          undefined. if cpt_first == cpt_second, then return true.
+ */
+extern bool_t _flat_hashtable_less_equal(const _flat_hashtable_t* cpt_first, const _flat_hashtable_t* cpt_second);
+
+/**
+ * Tests if the first flat hashtable is greater than the second flat hashtable.
+ * @param cpt_first         first flat hashtable container.
+ * @param cpt_second        second flat hashtable container.
+ * @return if first flat hashtable is greater than the second flat hashtable, then return true, else return false.
+ * @remarks if cpt_first == NULL or cpt_second == NULL, then the behavior is undefined. the two flat hashtable must be
+ *          initialized, otherwise the behavior is undefined. if the two flat hashtable are not same type, the behavior is
+ *          undefined. if cpt_first == cpt_second, then return false.
+ */
+extern bool_t _flat_hashtable_greater(const _flat_hashtable_t* cpt_first, const _flat_hashtable_t* cpt_second);
+
+/**
+ * Tests if the first flat hashtable is greater than or equal to the second flat hashtable.
+ * @param cpt_first         first flat hashtable container.
+ * @param cpt_second        second flat hashtable container.
+ * @return if first flat hashtable is greater than or equal to the second flat hashtable, then return true, else return false.
+ * @remarks if cpt_first == NULL or cpt_second == NULL, then the behavior is undefined. the two flat hashtable must be
+ *          initialized, otherwise the behavior is undefined. if the two flat hashtable are not same type, the behavior is
+ *          undefined. if cpt_first == cpt_second, then return true.
+ */
+extern bool_t _flat_hashtable_greater_equal(const _flat_hashtable_t* cpt_first, const _flat_hashtable_t* cpt_second);
+
+/**
+ * Resize.
+ * @param pt_hashtable      flat hashtable container.
+ * @param t_resize          resize flat hashtable slot count.
+ * @return void.
+ * @remarks if pt_hashtable == NULL, the behavior is undefined, pt_hashtable must be initialized,otherwise the behavior
+ *          is undefined. all iterators are invalid after the flat hashtable is rehashed.
+ */
+extern void _flat_hashtable_resize(_flat_hashtable_t* pt_hashtable, size_t t_resize);
+
+/**
+ * Reserve slots for specific number of elements.
+ * @param pt_hashtable      flat hashtable container.
+ * @param t_elemcount       element count.
+ * @return void.
+ * @remarks if pt_hashtable == NULL, the behavior is undefined, pt_hashtable must be initialized, otherwise the behavior
+ *          is undefined. the slots are expanded so that t_elemcount elements are inserted without rehash.
+ */
+extern void _flat_hashtable_reserve(_flat_hashtable_t* pt_hashtable, size_t t_elemcount);
+
+/**
+ * Shrink the slots to fit the elements.
+ * @param pt_hashtable      flat hashtable container.
+ * @return void.
+ * @remarks if pt_hashtable == NULL, the behavior is undefined, pt_hashtable must be initialized, otherwise the behavior
+ *          is undefined. the elements are moved into the least slots that do not exceed the max load factor, and the
+ *          memory of old slots is released. all iterators are invalid after shrinking.
+ */
+extern void _flat_hashtable_shrink_to_fit(_flat_hashtable_t* pt_hashtable);
+
+/**
+ * Inserts an unique element into a flat hashtable.
+ * @param pt_hashtable       flat hashtable container.
+ * @param cpv_value         specific element.
+ * @return an iterator addresses the inserted element, or flat hashtable end if insert failed.
+ * @remarks if pt_hashtable == NULL or cpv_value == NULL then the behavior is undefined. cpt_hashtable must be initialized,
+ *          otherwise the behavior is undefined. the type of specific element and cpt_hashtable must be same, otherwise the
+ *          behavior is undefined. the elements are moved when the flat hashtable is rehashed, so all iterators are
+ *          invalid after insertion except the returned one.
+ */
+extern _flat_hashtable_iterator_t _flat_hashtable_insert_unique(_flat_hashtable_t* pt_hashtable, const void* cpv_value);
+
+/**
+ * Inserts an range of unique element into a flat hashtable.
+ * @param pt_hashtable      flat hashtable container.
+ * @param it_begin          begin of specific range.
+ * @param it_end            end of specific range.
+ * @return void.
+ * @remarks if pt_hashtable == NULL then the behavior is undefined. pt_hashtable must be initialized, otherwise the behavior
+ *          is undefined. the type of [it_begin, it_end) and cpt_hashtable must be same, otherwise the behavior is undefined.
+ *          [it_begin, it_end) must be valid range, otherwise the behavior is undefine.
+ */
+extern void _flat_hashtable_insert_unique_range(_flat_hashtable_t* pt_hashtable, iterator_t it_begin, iterator_t it_end);
+
+/**
+ * Inserts an array of unique element into a flat hashtable.
+ * @param pt_hashtable      flat hashtable container.
+ * @param cpv_array         array.
+ * @param t_count           element count of array.
+ * @return void.
+ * @remarks if pt_hashtable == NULL then the behavior is undefined. pt_hashtable must be initialized, otherwise the behavior
+ *          is undefined. the type of array and cpt_hashtable must be same, otherwise the behavior is undefined. array must 
+ *          be valid array, otherwise the behavior is undefine.
+ */
+extern void _flat_hashtable_insert_unique_array(_flat_hashtable_t* pt_hashtable, const void* cpv_array, size_t t_count);
+
+/*
+ * Erase an element in an flat hashtable from specificed position.
+ * @param pt_hashtable       flat hashtable container.
+ * @param it_pos            specificed position.
+ * @return void.
+ * @remarks if pt_hashtable == NULL then the behavior is undefined. pt_hashtable must be initialized, otherwise the behavior
+ *          is undefined. it_pos must be valid iterator, otherwise the behavior is undefined.
+ */
+extern void _flat_hashtable_erase_pos(_flat_hashtable_t* pt_hashtable, _flat_hashtable_iterator_t it_pos);
+
+/*
+ * Erase a range of element in an flat hashtable.
+ * @param pt_hashtable       flat hashtable container.
+ * @param it_begin          begin of specific range.
+ * @param it_end            end of specific range.
+ * @return void.
+ * @remarks if pt_hashtable == NULL then the behavior is undefined. pt_hashtable must be initialized, otherwise the behavior
+ *          is undefined. [it_begin, it_end) must be valid range for pt_hashtable, otherwise the behavior is undefine.
+ */
+extern void _flat_hashtable_erase_range(
+    _flat_hashtable_t* pt_hashtable, _flat_hashtable_iterator_t it_begin, _flat_hashtable_iterator_t it_end);
+
+/**
+ * Erase an element from a flat hashtable that match a specified element.
+ * @param pt_hashtable       flat hashtable container.
+ * @param cpv_value         specific element.
+ * @return the number of erased elements.
+ * @remarks if pt_hashtable == NULL or cpv_value == NULL then the behavior is undefined. cpt_hashtable must be initialized,
+ *          otherwise the behavior is undefined. 
+ */
+extern size_t _flat_hashtable_erase(_flat_hashtable_t* pt_hashtable, const void* cpv_value);
+
+/**
+ * Swap the datas of first flat hashtable and second flat hashtable.
+ * @param pt_first          first flat hashtable container.
+ * @param pt_second         second flat hashtable container.
+ * @return void.
+ * @remarks if pt_first == NULL or pt_second == NULL, then the behavior is undefined. the two flat hashtable must be
+ *          initialized, otherwise the behavior is undefined. if the two flat hashtable are not same type, the behavior is
+ *          undefined.
+ */
+extern void _flat_hashtable_swap(_flat_hashtable_t* pt_first, _flat_hashtable_t* pt_second);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CSTL_FLAT_HASHTABLE_H_ */
+/** eof **/
+
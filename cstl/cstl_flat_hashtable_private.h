@@ -0,0 +1,92 @@
+/*
+ *  The private interface of flat hashtable.
+ *  Copyright (C)  2008 - 2014  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+#ifndef _CSTL_FLAT_HASHTABLE_PRIVATE_H_
+#define _CSTL_FLAT_HASHTABLE_PRIVATE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** include section **/
+
+/** constant declaration and macro section **/
+
+/** data type declaration and struct, union, enum section **/
+/*
+ * The flat hashtable is an open addressing hashtable, the elements are saved in the slot array directly.
+ * Each slot has a control byte, the control byte is empty, deleted or the 7 bits fragment of element hash
+ * value. The slots are grouped by 16, lookup matches the control bytes of a whole group at once.
+ */
+typedef struct _tagflathashtable
+{
+    /* element type information */
+    _typeinfo_t       _t_typeinfo;
+
+    /* memory allocate */
+    _alloc_t          _t_allocator;
+
+    /* control bytes and element slots */
+    _byte_t*          _pby_ctrl;
+    _byte_t*          _pby_slot;
+    size_t            _t_slotcount;
+    size_t            _t_nodecount;
+    /* the number of elements that can be inserted before rehash */
+    size_t            _t_growthleft;
+    /* the max ratio of element count to slot count, it is limited to 7/8 */
+    float             _f_maxloadfactor;
+
+    /* hash function */
+    ufun_t            _ufun_hash;
+    /* key compare function */
+    bfun_t            _bfun_compare;
+}_flat_hashtable_t;
+
+/** exported global variable declaration section **/
+
+/** exported function prototype section **/
+/**
+ * Create flat hashtable container auxiliary function.
+ * @param pt_hashtable      uncreated container.
+ * @param s_typename        element type name.
+ * @return if create flat hashtable successfully return true, otherwise return false.
+ * @remarks if pt_hashtable == NULL or s_typename == NULL, then the behavior is undefined. s_typename should be C builtin
+ *          type name, libcstl builtin typename or registed user defined type name, otherwise the function will return false.
+ */
+extern bool_t _create_flat_hashtable_auxiliary(_flat_hashtable_t* pt_hashtable, const char* s_typename);
+
+/**
+ * Destroy flat hashtable container auxiliary function.
+ * @param pt_hashtable      flat hashtable container.
+ * @return void.
+ * @remarks if pt_hashtable == NULL, then the behavior is undefined. flat hashtable must be initialized or created by
+ *          _create_flat_hashtable(), otherwise the behavior is undefine.
+ */
+extern void _flat_hashtable_destroy_auxiliary(_flat_hashtable_t* pt_hashtable);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CSTL_FLAT_HASHTABLE_PRIVATE_H_ */
+/** eof **/
+
@@ -85,6 +85,17 @@ extern ufun_t _fun_get_unary(iterator_t it_iter, fun_type_t ftype_type);
  */
 extern bfun_t _fun_get_binary(iterator_t it_iter, fun_type_t ftype_type);
 
+/**
+ * Select the three-way compare function of element type that agrees with a less predicate.
+ * @param it_iter       A iterator addressing the element.
+ * @param bfun_op       Less predicate.
+ * @return  The three-way compare function of element type, or NULL if bfun_op is not the less function of element
+ *          type or element type has no three-way compare function.
+ * @remarks The iterator must be valid, otherwise the behavior is undefine. The compare function takes the element
+ *          pointers that are not converted to char* for c-string, and saves a negative, zero or positive int.
+ */
+extern bfun_t _fun_get_three_way_compare(iterator_t it_iter, bfun_t bfun_op);
+
 /**
  * Increase.
  * @param cpv_input     Input.
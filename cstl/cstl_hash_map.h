@@ -39,6 +39,17 @@ extern "C" {
  */
 #define create_hash_map(...) _create_hash_map(#__VA_ARGS__)
 
+/**
+ * Create hash_map container that allocates memory by user defined allocator.
+ * @param cpt_allocator  user defined allocator.
+ * @param ...            element type name.
+ * @return if create hash_map successfully return hash_map pointer, otherwise return NULL.
+ * @remarks if cpt_allocator == NULL, then the behavior is undefined. the allocator is used by all the memory of elements
+ *          and must be valid until the hash_map is destroyed. element type name should be C builtin type name, libcstl
+ *          builtin typename or registed user defined type name, otherwise the function will return NULL.
+ */
+#define create_hash_map_with_allocator(cpt_allocator, ...) _create_hash_map_with_allocator((cpt_allocator), #__VA_ARGS__)
+
 /**
  * Find specific element.
  * @param cphmap_map    hash_map container.
@@ -231,6 +242,17 @@ extern bool_t hash_map_empty(const hash_map_t* cphmap_map);
  */
 extern size_t hash_map_max_size(const hash_map_t* cphmap_map);
 
+/**
+ * Get the memory that is held by the hash_map.
+ * @param cphmap_map   hash_map container.
+ * @return the bytes of hash_map structure, nodes, buckets, pair elements and the memory cached by the allocator of
+ *         hash_map.
+ * @remarks if cphmap_map == NULL, then the behavior is undefined. cphmap_map must be initialized, otherwise the
+ *          behavior is undefined. the memory that is owned by the elements themselves, such as the string of char* or
+ *          the nodes of nested container, is not counted.
+ */
+extern size_t hash_map_memory_usage(const hash_map_t* cphmap_map);
+
 /**
  * Get the bucket count of elements int the hash_map.
  * @param cphmap_map      hash_map container.
@@ -272,6 +294,56 @@ extern bfun_t hash_map_value_comp(const hash_map_t* cphmap_map);
  */
 extern void hash_map_resize(hash_map_t* phmap_map, size_t t_resize);
 
+/**
+ * Get the average number of elements per bucket.
+ * @param cphmap_map       hash_map container.
+ * @return the load factor of hash_map.
+ * @remarks if cphmap_map == NULL, then the behavior is undefined. cphmap_map must be initialized, otherwise the
+ *          behavior is undefined.
+ */
+extern float hash_map_load_factor(const hash_map_t* cphmap_map);
+
+/**
+ * Get the max load factor of hash_map.
+ * @param cphmap_map       hash_map container.
+ * @return the max load factor of hash_map.
+ * @remarks if cphmap_map == NULL, then the behavior is undefined. cphmap_map must be initialized, otherwise the
+ *          behavior is undefined.
+ */
+extern float hash_map_max_load_factor(const hash_map_t* cphmap_map);
+
+/**
+ * Set the max load factor of hash_map.
+ * @param phmap_map        hash_map container.
+ * @param f_maxloadfactor  new max load factor.
+ * @return void.
+ * @remarks if phmap_map == NULL, then the behavior is undefined. phmap_map must be initialized, otherwise the behavior
+ *          is undefined. f_maxloadfactor must be greater than 0, otherwise the behavior is undefined. the buckets are
+ *          expanded if the current load factor exceeds the new max load factor. when CSTL_HASH_FLAT_TABLE is defined,
+ *          the max load factor that is more than 7/8 works as 7/8.
+ */
+extern void hash_map_set_max_load_factor(hash_map_t* phmap_map, float f_maxloadfactor);
+
+/**
+ * Reserve buckets for specific number of elements.
+ * @param phmap_map        hash_map container.
+ * @param t_count          element count.
+ * @return void.
+ * @remarks if phmap_map == NULL, then the behavior is undefined. phmap_map must be initialized, otherwise the behavior
+ *          is undefined. t_count elements are inserted without rehash after reserving.
+ */
+extern void hash_map_reserve(hash_map_t* phmap_map, size_t t_count);
+
+/**
+ * Shrink the buckets to fit the elements.
+ * @param phmap_map        hash_map container.
+ * @return void.
+ * @remarks if phmap_map == NULL, then the behavior is undefined. phmap_map must be initialized, otherwise the behavior
+ *          is undefined. the elements are rehashed into the least buckets that do not exceed the max load factor, and
+ *          the memory of unused buckets is released. all iterators are invalid after shrinking.
+ */
+extern void hash_map_shrink_to_fit(hash_map_t* phmap_map);
+
 /**
  * Return an iterator that addresses the first element in the hash_map.
  * @param cphmap_map      hash_map container.
@@ -418,6 +490,63 @@ extern void hash_map_erase_range(hash_map_t* phmap_map, hash_map_iterator_t it_b
  */
 extern void hash_map_clear(hash_map_t* phmap_map);
 
+/**
+ * Find specific element by the key that is pointed by pointer.
+ * @param cphmap_map    hash_map container.
+ * @param cpv_key    pointer to specific key.
+ * @return iterator addresses the specific element in the hash_map, otherwise return hash_map_end().
+ * @remarks if cphmap_map == NULL or cpv_key == NULL then the behavior is undefined. cphmap_map must be initialized, otherwise
+ *          the behavior is undefined. cpv_key points to the key, but it is char* for c string key. the key is not
+ *          passed through the variable argument list.
+ */
+extern hash_map_iterator_t hash_map_find_ptr(const hash_map_t* cphmap_map, const void* cpv_key);
+
+/**
+ * Return the number of elements whose key is pointed by pointer.
+ * @param cphmap_map    hash_map container.
+ * @param cpv_key    pointer to specific key.
+ * @return the number of specific elements.
+ * @remarks if cphmap_map == NULL or cpv_key == NULL then the behavior is undefined. cphmap_map must be initialized, otherwise
+ *          the behavior is undefined. cpv_key points to the key, but it is char* for c string key.
+ */
+extern size_t hash_map_count_ptr(const hash_map_t* cphmap_map, const void* cpv_key);
+
+/**
+ * Find a batch of elements by the keys in array.
+ * @param cphmap_map    hash_map container.
+ * @param cpv_keys      array of keys.
+ * @param t_count       key count of array.
+ * @param pit_result    array of iterators that receives the result.
+ * @return void.
+ * @remarks if cphmap_map == NULL, cpv_keys == NULL or pit_result == NULL then the behavior is undefined. cphmap_map
+ *          must be initialized, otherwise the behavior is undefined. the array of c builtin keys holds the keys, the
+ *          array of c string keys holds char*, and the array of other keys holds the pointers to keys. each iterator in
+ *          pit_result is same as hash_map_find_ptr() of the key. the keys are passed to the lookup in groups, so the
+ *          cache misses of lookups are overlapped.
+ */
+extern void hash_map_find_batch(
+    const hash_map_t* cphmap_map, const void* cpv_keys, size_t t_count, hash_map_iterator_t* pit_result);
+
+/**
+ * Erase the elements whose key is pointed by pointer.
+ * @param phmap_map    hash_map container.
+ * @param cpv_key    pointer to specific key.
+ * @return the number of erased elements.
+ * @remarks if phmap_map == NULL or cpv_key == NULL then the behavior is undefined. phmap_map must be initialized, otherwise
+ *          the behavior is undefined. cpv_key points to the key, but it is char* for c string key.
+ */
+extern size_t hash_map_erase_ptr(hash_map_t* phmap_map, const void* cpv_key);
+
+/**
+ * Access an element by the key that is pointed by pointer.
+ * @param phmap_map    hash_map container.
+ * @param cpv_key    pointer to specific key.
+ * @return pointer to the value of element, the element is inserted if the key is not existed.
+ * @remarks if phmap_map == NULL or cpv_key == NULL then the behavior is undefined. phmap_map must be initialized, otherwise
+ *          the behavior is undefined. cpv_key points to the key, but it is char* for c string key.
+ */
+extern void* hash_map_at_ptr(hash_map_t* phmap_map, const void* cpv_key);
+
 #ifdef __cplusplus
 }
 #endif
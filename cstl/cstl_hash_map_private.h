@@ -32,12 +32,17 @@ extern "C" {
 /** constant declaration and macro section **/
 
 /** data type declaration and struct, union, enum section **/
+/* the hash_map use chained hashtable default */
 typedef struct _taghashmap
 {
     pair_t            _pair_temp;
     bfun_t            _bfun_keycompare;    /* for external key compare */
     bfun_t            _bfun_valuecompare;
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_t _t_hashtable;
+#else
     _hashtable_t      _t_hashtable;
+#endif
 }hash_map_t;
 
 /** exported global variable declaration section **/
@@ -52,6 +57,17 @@ typedef struct _taghashmap
  */
 extern hash_map_t* _create_hash_map(const char* s_typename);
 
+/**
+ * Create hash_map container that uses user defined allocator.
+ * @param cpt_allocator     user defined allocator.
+ * @param s_typename        element type name.
+ * @return if create hash_map successfully return hash_map pointer, otherwise return NULL.
+ * @remarks if cpt_allocator == NULL or s_typename == NULL, then the behavior is undefined. s_typename should be C
+ *          builtin type name, libcstl builtin typename or registed user defined type name, otherwise the function will
+ *          return NULL.
+ */
+extern hash_map_t* _create_hash_map_with_allocator(const allocator_t* cpt_allocator, const char* s_typename);
+
 /**
  * Create hash_map container auxiliary function.
  * @param phmap_map          uncreated container.
@@ -39,6 +39,17 @@ extern "C" {
  */
 #define create_hash_multimap(...) _create_hash_multimap(#__VA_ARGS__)
 
+/**
+ * Create hash_multimap container that allocates memory by user defined allocator.
+ * @param cpt_allocator  user defined allocator.
+ * @param ...            element type name.
+ * @return if create hash_multimap successfully return hash_multimap pointer, otherwise return NULL.
+ * @remarks if cpt_allocator == NULL, then the behavior is undefined. the allocator is used by all the memory of elements
+ *          and must be valid until the hash_multimap is destroyed. element type name should be C builtin type name, libcstl
+ *          builtin typename or registed user defined type name, otherwise the function will return NULL.
+ */
+#define create_hash_multimap_with_allocator(cpt_allocator, ...) _create_hash_multimap_with_allocator((cpt_allocator), #__VA_ARGS__)
+
 /**
  * Find specific element.
  * @param cphmmap_map    hash_multimap container.
@@ -221,6 +232,17 @@ extern bool_t hash_multimap_empty(const hash_multimap_t* cphmmap_map);
  */
 extern size_t hash_multimap_max_size(const hash_multimap_t* cphmmap_map);
 
+/**
+ * Get the memory that is held by the hash_multimap.
+ * @param cphmmap_map   hash_multimap container.
+ * @return the bytes of hash_multimap structure, nodes, buckets, pair elements and the memory cached by the allocator of
+ *         hash_multimap.
+ * @remarks if cphmmap_map == NULL, then the behavior is undefined. cphmmap_map must be initialized, otherwise the
+ *          behavior is undefined. the memory that is owned by the elements themselves, such as the string of char* or
+ *          the nodes of nested container, is not counted.
+ */
+extern size_t hash_multimap_memory_usage(const hash_multimap_t* cphmmap_map);
+
 /**
  * Get the bucket count of elements int the hash_multimap.
  * @param cphmmap_map      hash_multimap container.
@@ -262,6 +284,55 @@ extern bfun_t hash_multimap_value_comp(const hash_multimap_t* cphmmap_map);
  */
 extern void hash_multimap_resize(hash_multimap_t* phmmap_map, size_t t_resize);
 
+/**
+ * Get the average number of elements per bucket.
+ * @param cphmmap_map      hash_multimap container.
+ * @return the load factor of hash_multimap.
+ * @remarks if cphmmap_map == NULL, then the behavior is undefined. cphmmap_map must be initialized, otherwise the
+ *          behavior is undefined.
+ */
+extern float hash_multimap_load_factor(const hash_multimap_t* cphmmap_map);
+
+/**
+ * Get the max load factor of hash_multimap.
+ * @param cphmmap_map      hash_multimap container.
+ * @return the max load factor of hash_multimap.
+ * @remarks if cphmmap_map == NULL, then the behavior is undefined. cphmmap_map must be initialized, otherwise the
+ *          behavior is undefined.
+ */
+extern float hash_multimap_max_load_factor(const hash_multimap_t* cphmmap_map);
+
+/**
+ * Set the max load factor of hash_multimap.
+ * @param phmmap_map       hash_multimap container.
+ * @param f_maxloadfactor  new max load factor.
+ * @return void.
+ * @remarks if phmmap_map == NULL, then the behavior is undefined. phmmap_map must be initialized, otherwise the
+ *          behavior is undefined. f_maxloadfactor must be greater than 0, otherwise the behavior is undefined. the
+ *          buckets are expanded if the current load factor exceeds the new max load factor.
+ */
+extern void hash_multimap_set_max_load_factor(hash_multimap_t* phmmap_map, float f_maxloadfactor);
+
+/**
+ * Reserve buckets for specific number of elements.
+ * @param phmmap_map       hash_multimap container.
+ * @param t_count          element count.
+ * @return void.
+ * @remarks if phmmap_map == NULL, then the behavior is undefined. phmmap_map must be initialized, otherwise the
+ *          behavior is undefined. t_count elements are inserted without rehash after reserving.
+ */
+extern void hash_multimap_reserve(hash_multimap_t* phmmap_map, size_t t_count);
+
+/**
+ * Shrink the buckets to fit the elements.
+ * @param phmmap_map       hash_multimap container.
+ * @return void.
+ * @remarks if phmmap_map == NULL, then the behavior is undefined. phmmap_map must be initialized, otherwise the
+ *          behavior is undefined. the elements are rehashed into the least buckets that do not exceed the max load
+ *          factor, and the memory of unused buckets is released. all iterators are invalid after shrinking.
+ */
+extern void hash_multimap_shrink_to_fit(hash_multimap_t* phmmap_map);
+
 /**
  * Return an iterator that addresses the first element in the hash_multimap.
  * @param cphmmap_map      hash_multimap container.
@@ -408,6 +479,37 @@ extern void hash_multimap_erase_range(hash_multimap_t* phmmap_map, hash_multimap
  */
 extern void hash_multimap_clear(hash_multimap_t* phmmap_map);
 
+/**
+ * Find specific element by the key that is pointed by pointer.
+ * @param cphmmap_map    hash_multimap container.
+ * @param cpv_key    pointer to specific key.
+ * @return iterator addresses the specific element in the hash_multimap, otherwise return hash_multimap_end().
+ * @remarks if cphmmap_map == NULL or cpv_key == NULL then the behavior is undefined. cphmmap_map must be initialized, otherwise
+ *          the behavior is undefined. cpv_key points to the key, but it is char* for c string key. the key is not
+ *          passed through the variable argument list.
+ */
+extern hash_multimap_iterator_t hash_multimap_find_ptr(const hash_multimap_t* cphmmap_map, const void* cpv_key);
+
+/**
+ * Return the number of elements whose key is pointed by pointer.
+ * @param cphmmap_map    hash_multimap container.
+ * @param cpv_key    pointer to specific key.
+ * @return the number of specific elements.
+ * @remarks if cphmmap_map == NULL or cpv_key == NULL then the behavior is undefined. cphmmap_map must be initialized, otherwise
+ *          the behavior is undefined. cpv_key points to the key, but it is char* for c string key.
+ */
+extern size_t hash_multimap_count_ptr(const hash_multimap_t* cphmmap_map, const void* cpv_key);
+
+/**
+ * Erase the elements whose key is pointed by pointer.
+ * @param phmmap_map    hash_multimap container.
+ * @param cpv_key    pointer to specific key.
+ * @return the number of erased elements.
+ * @remarks if phmmap_map == NULL or cpv_key == NULL then the behavior is undefined. phmmap_map must be initialized, otherwise
+ *          the behavior is undefined. cpv_key points to the key, but it is char* for c string key.
+ */
+extern size_t hash_multimap_erase_ptr(hash_multimap_t* phmmap_map, const void* cpv_key);
+
 #ifdef __cplusplus
 }
 #endif
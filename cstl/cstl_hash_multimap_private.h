@@ -52,6 +52,17 @@ typedef struct _taghashmultimap
  */
 extern hash_multimap_t* _create_hash_multimap(const char* s_typename);
 
+/**
+ * Create hash_multimap container that uses user defined allocator.
+ * @param cpt_allocator     user defined allocator.
+ * @param s_typename        element type name.
+ * @return if create hash_multimap successfully return hash_multimap pointer, otherwise return NULL.
+ * @remarks if cpt_allocator == NULL or s_typename == NULL, then the behavior is undefined. s_typename should be C
+ *          builtin type name, libcstl builtin typename or registed user defined type name, otherwise the function will
+ *          return NULL.
+ */
+extern hash_multimap_t* _create_hash_multimap_with_allocator(const allocator_t* cpt_allocator, const char* s_typename);
+
 /**
  * Create hash_multimap container auxiliary function.
  * @param phmmap_map          uncreated container.
@@ -39,6 +39,17 @@ extern "C" {
  */
 #define create_hash_multiset(...) _create_hash_multiset(#__VA_ARGS__)
 
+/**
+ * Create hash_multiset container that allocates memory by user defined allocator.
+ * @param cpt_allocator  user defined allocator.
+ * @param ...            element type name.
+ * @return if create hash_multiset successfully return hash_multiset pointer, otherwise return NULL.
+ * @remarks if cpt_allocator == NULL, then the behavior is undefined. the allocator is used by all the memory of elements
+ *          and must be valid until the hash_multiset is destroyed. element type name should be C builtin type name, libcstl
+ *          builtin typename or registed user defined type name, otherwise the function will return NULL.
+ */
+#define create_hash_multiset_with_allocator(cpt_allocator, ...) _create_hash_multiset_with_allocator((cpt_allocator), #__VA_ARGS__)
+
 /**
  * Find specific element.
  * @param cphmset_set      hash_multiset container.
@@ -231,6 +242,16 @@ extern bool_t hash_multiset_empty(const hash_multiset_t* cphmset_set);
  */
 extern size_t hash_multiset_max_size(const hash_multiset_t* cphmset_set);
 
+/**
+ * Get the memory that is held by the hash_multiset.
+ * @param cphmset_set   hash_multiset container.
+ * @return the bytes of hash_multiset structure, nodes, buckets and the memory cached by the allocator of hash_multiset.
+ * @remarks if cphmset_set == NULL, then the behavior is undefined. cphmset_set must be initialized, otherwise the
+ *          behavior is undefined. the memory that is owned by the elements themselves, such as the string of char* or
+ *          the nodes of nested container, is not counted.
+ */
+extern size_t hash_multiset_memory_usage(const hash_multiset_t* cphmset_set);
+
 /**
  * Get the bucket number of elements int the hash_multiset.
  * @param cphmset_set      hash_multiset container.
@@ -274,6 +295,55 @@ extern bfun_t hash_multiset_value_comp(const hash_multiset_t* cphmset_set);
  */
 extern void hash_multiset_resize(hash_multiset_t* phmset_set, size_t t_resize);
 
+/**
+ * Get the average number of elements per bucket.
+ * @param cphmset_set      hash_multiset container.
+ * @return the load factor of hash_multiset.
+ * @remarks if cphmset_set == NULL, then the behavior is undefined. cphmset_set must be initialized, otherwise the
+ *          behavior is undefined.
+ */
+extern float hash_multiset_load_factor(const hash_multiset_t* cphmset_set);
+
+/**
+ * Get the max load factor of hash_multiset.
+ * @param cphmset_set      hash_multiset container.
+ * @return the max load factor of hash_multiset.
+ * @remarks if cphmset_set == NULL, then the behavior is undefined. cphmset_set must be initialized, otherwise the
+ *          behavior is undefined.
+ */
+extern float hash_multiset_max_load_factor(const hash_multiset_t* cphmset_set);
+
+/**
+ * Set the max load factor of hash_multiset.
+ * @param phmset_set       hash_multiset container.
+ * @param f_maxloadfactor  new max load factor.
+ * @return void.
+ * @remarks if phmset_set == NULL, then the behavior is undefined. phmset_set must be initialized, otherwise the
+ *          behavior is undefined. f_maxloadfactor must be greater than 0, otherwise the behavior is undefined. the
+ *          buckets are expanded if the current load factor exceeds the new max load factor.
+ */
+extern void hash_multiset_set_max_load_factor(hash_multiset_t* phmset_set, float f_maxloadfactor);
+
+/**
+ * Reserve buckets for specific number of elements.
+ * @param phmset_set       hash_multiset container.
+ * @param t_count          element count.
+ * @return void.
+ * @remarks if phmset_set == NULL, then the behavior is undefined. phmset_set must be initialized, otherwise the
+ *          behavior is undefined. t_count elements are inserted without rehash after reserving.
+ */
+extern void hash_multiset_reserve(hash_multiset_t* phmset_set, size_t t_count);
+
+/**
+ * Shrink the buckets to fit the elements.
+ * @param phmset_set       hash_multiset container.
+ * @return void.
+ * @remarks if phmset_set == NULL, then the behavior is undefined. phmset_set must be initialized, otherwise the
+ *          behavior is undefined. the elements are rehashed into the least buckets that do not exceed the max load
+ *          factor, and the memory of unused buckets is released. all iterators are invalid after shrinking.
+ */
+extern void hash_multiset_shrink_to_fit(hash_multiset_t* phmset_set);
+
 /**
  * Tests if the two hash_multiset are equal.
  * @param cphmset_first         first hash_multiset container.
@@ -411,6 +481,47 @@ extern void hash_multiset_erase_range(
  */
 extern void hash_multiset_clear(hash_multiset_t* phmset_set);
 
+/**
+ * Find specific element that is pointed by pointer.
+ * @param cphmset_set    hash_multiset container.
+ * @param cpv_value    pointer to specific element.
+ * @return iterator addresses the specific element in the hash_multiset, otherwise return hash_multiset_end().
+ * @remarks if cphmset_set == NULL or cpv_value == NULL then the behavior is undefined. cphmset_set must be initialized, otherwise
+ *          the behavior is undefined. cpv_value points to the element, but it is char* for c string element. the
+ *          value is not copied into a temporary element, so the variable argument list is not used.
+ */
+extern hash_multiset_iterator_t hash_multiset_find_ptr(const hash_multiset_t* cphmset_set, const void* cpv_value);
+
+/**
+ * Return the number of specific elements that is pointed by pointer.
+ * @param cphmset_set    hash_multiset container.
+ * @param cpv_value    pointer to specific element.
+ * @return the number of specific elements.
+ * @remarks if cphmset_set == NULL or cpv_value == NULL then the behavior is undefined. cphmset_set must be initialized, otherwise
+ *          the behavior is undefined. cpv_value points to the element, but it is char* for c string element.
+ */
+extern size_t hash_multiset_count_ptr(const hash_multiset_t* cphmset_set, const void* cpv_value);
+
+/**
+ * Inserts an element that is pointed by pointer into a hash_multiset.
+ * @param phmset_set    hash_multiset container.
+ * @param cpv_value    pointer to specific element.
+ * @return iterator addresses the inserted element.
+ * @remarks if phmset_set == NULL or cpv_value == NULL then the behavior is undefined. phmset_set must be initialized, otherwise
+ *          the behavior is undefined. cpv_value points to the element, but it is char* for c string element.
+ */
+extern hash_multiset_iterator_t hash_multiset_insert_ptr(hash_multiset_t* phmset_set, const void* cpv_value);
+
+/**
+ * Erase elements from a hash_multiset that match a element that is pointed by pointer.
+ * @param phmset_set    hash_multiset container.
+ * @param cpv_value    pointer to specific element.
+ * @return the number of erased elements.
+ * @remarks if phmset_set == NULL or cpv_value == NULL then the behavior is undefined. phmset_set must be initialized, otherwise
+ *          the behavior is undefined. cpv_value points to the element, but it is char* for c string element.
+ */
+extern size_t hash_multiset_erase_ptr(hash_multiset_t* phmset_set, const void* cpv_value);
+
 #ifdef __cplusplus
 }
 #endif
@@ -49,6 +49,17 @@ typedef struct _taghashmultiset
  */
 extern hash_multiset_t* _create_hash_multiset(const char* s_typename);
 
+/**
+ * Create hash_multiset container that uses user defined allocator.
+ * @param cpt_allocator     user defined allocator.
+ * @param s_typename        element type name.
+ * @return if create hash_multiset successfully return hash_multiset pointer, otherwise return NULL.
+ * @remarks if cpt_allocator == NULL or s_typename == NULL, then the behavior is undefined. s_typename should be C
+ *          builtin type name, libcstl builtin typename or registed user defined type name, otherwise the function will
+ *          return NULL.
+ */
+extern hash_multiset_t* _create_hash_multiset_with_allocator(const allocator_t* cpt_allocator, const char* s_typename);
+
 /**
  * Create hash_multiset container auxiliary function.
  * @param pset_set          uncreated container.
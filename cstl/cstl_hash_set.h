@@ -39,6 +39,17 @@ extern "C" {
  */
 #define create_hash_set(...) _create_hash_set(#__VA_ARGS__)
 
+/**
+ * Create hash_set container that allocates memory by user defined allocator.
+ * @param cpt_allocator  user defined allocator.
+ * @param ...            element type name.
+ * @return if create hash_set successfully return hash_set pointer, otherwise return NULL.
+ * @remarks if cpt_allocator == NULL, then the behavior is undefined. the allocator is used by all the memory of elements
+ *          and must be valid until the hash_set is destroyed. element type name should be C builtin type name, libcstl
+ *          builtin typename or registed user defined type name, otherwise the function will return NULL.
+ */
+#define create_hash_set_with_allocator(cpt_allocator, ...) _create_hash_set_with_allocator((cpt_allocator), #__VA_ARGS__)
+
 /**
  * Find specific element.
  * @param cphset_set      hash_set container.
@@ -231,6 +242,16 @@ extern bool_t hash_set_empty(const hash_set_t* cphset_set);
  */
 extern size_t hash_set_max_size(const hash_set_t* cphset_set);
 
+/**
+ * Get the memory that is held by the hash_set.
+ * @param cphset_set   hash_set container.
+ * @return the bytes of hash_set structure, nodes, buckets and the memory cached by the allocator of hash_set.
+ * @remarks if cphset_set == NULL, then the behavior is undefined. cphset_set must be initialized, otherwise the
+ *          behavior is undefined. the memory that is owned by the elements themselves, such as the string of char* or
+ *          the nodes of nested container, is not counted.
+ */
+extern size_t hash_set_memory_usage(const hash_set_t* cphset_set);
+
 /**
  * Get the bucket number of elements int the hash_set.
  * @param cphset_set      hash_set container.
@@ -274,6 +295,56 @@ extern bfun_t hash_set_value_comp(const hash_set_t* cphset_set);
  */
 extern void hash_set_resize(hash_set_t* phset_set, size_t t_resize);
 
+/**
+ * Get the average number of elements per bucket.
+ * @param cphset_set       hash_set container.
+ * @return the load factor of hash_set.
+ * @remarks if cphset_set == NULL, then the behavior is undefined. cphset_set must be initialized, otherwise the
+ *          behavior is undefined.
+ */
+extern float hash_set_load_factor(const hash_set_t* cphset_set);
+
+/**
+ * Get the max load factor of hash_set.
+ * @param cphset_set       hash_set container.
+ * @return the max load factor of hash_set.
+ * @remarks if cphset_set == NULL, then the behavior is undefined. cphset_set must be initialized, otherwise the
+ *          behavior is undefined.
+ */
+extern float hash_set_max_load_factor(const hash_set_t* cphset_set);
+
+/**
+ * Set the max load factor of hash_set.
+ * @param phset_set        hash_set container.
+ * @param f_maxloadfactor  new max load factor.
+ * @return void.
+ * @remarks if phset_set == NULL, then the behavior is undefined. phset_set must be initialized, otherwise the behavior
+ *          is undefined. f_maxloadfactor must be greater than 0, otherwise the behavior is undefined. the buckets are
+ *          expanded if the current load factor exceeds the new max load factor. when CSTL_HASH_FLAT_TABLE is defined,
+ *          the max load factor that is more than 7/8 works as 7/8.
+ */
+extern void hash_set_set_max_load_factor(hash_set_t* phset_set, float f_maxloadfactor);
+
+/**
+ * Reserve buckets for specific number of elements.
+ * @param phset_set        hash_set container.
+ * @param t_count          element count.
+ * @return void.
+ * @remarks if phset_set == NULL, then the behavior is undefined. phset_set must be initialized, otherwise the behavior
+ *          is undefined. t_count elements are inserted without rehash after reserving.
+ */
+extern void hash_set_reserve(hash_set_t* phset_set, size_t t_count);
+
+/**
+ * Shrink the buckets to fit the elements.
+ * @param phset_set        hash_set container.
+ * @return void.
+ * @remarks if phset_set == NULL, then the behavior is undefined. phset_set must be initialized, otherwise the behavior
+ *          is undefined. the elements are rehashed into the least buckets that do not exceed the max load factor, and
+ *          the memory of unused buckets is released. all iterators are invalid after shrinking.
+ */
+extern void hash_set_shrink_to_fit(hash_set_t* phset_set);
+
 /**
  * Tests if the two hash_set are equal.
  * @param cphset_first         first hash_set container.
@@ -410,6 +481,63 @@ extern void hash_set_erase_range(hash_set_t* phset_set, hash_set_iterator_t it_b
  */
 extern void hash_set_clear(hash_set_t* phset_set);
 
+/**
+ * Find specific element that is pointed by pointer.
+ * @param cphset_set    hash_set container.
+ * @param cpv_value    pointer to specific element.
+ * @return iterator addresses the specific element in the hash_set, otherwise return hash_set_end().
+ * @remarks if cphset_set == NULL or cpv_value == NULL then the behavior is undefined. cphset_set must be initialized, otherwise
+ *          the behavior is undefined. cpv_value points to the element, but it is char* for c string element. the
+ *          value is not copied into a temporary element, so the variable argument list is not used.
+ */
+extern hash_set_iterator_t hash_set_find_ptr(const hash_set_t* cphset_set, const void* cpv_value);
+
+/**
+ * Return the number of specific elements that is pointed by pointer.
+ * @param cphset_set    hash_set container.
+ * @param cpv_value    pointer to specific element.
+ * @return the number of specific elements.
+ * @remarks if cphset_set == NULL or cpv_value == NULL then the behavior is undefined. cphset_set must be initialized, otherwise
+ *          the behavior is undefined. cpv_value points to the element, but it is char* for c string element.
+ */
+extern size_t hash_set_count_ptr(const hash_set_t* cphset_set, const void* cpv_value);
+
+/**
+ * Find a batch of elements in array.
+ * @param cphset_set    hash_set container.
+ * @param cpv_values    array of elements.
+ * @param t_count       element count of array.
+ * @param pit_result    array of iterators that receives the result.
+ * @return void.
+ * @remarks if cphset_set == NULL, cpv_values == NULL or pit_result == NULL then the behavior is undefined. cphset_set
+ *          must be initialized, otherwise the behavior is undefined. the array is same as hash_set_insert_array(), but
+ *          it holds char* for c string element. each iterator in pit_result is same as hash_set_find_ptr() of the
+ *          element. the elements are passed to the lookup in groups, so the cache misses of lookups are overlapped, but
+ *          the c string elements are found one by one.
+ */
+extern void hash_set_find_batch(
+    const hash_set_t* cphset_set, const void* cpv_values, size_t t_count, hash_set_iterator_t* pit_result);
+
+/**
+ * Inserts an unique element that is pointed by pointer into a hash_set.
+ * @param phset_set    hash_set container.
+ * @param cpv_value    pointer to specific element.
+ * @return iterator addresses the inserted element, or hash_set_end() if the element is existed.
+ * @remarks if phset_set == NULL or cpv_value == NULL then the behavior is undefined. phset_set must be initialized, otherwise
+ *          the behavior is undefined. cpv_value points to the element, but it is char* for c string element.
+ */
+extern hash_set_iterator_t hash_set_insert_ptr(hash_set_t* phset_set, const void* cpv_value);
+
+/**
+ * Erase elements from a hash_set that match a element that is pointed by pointer.
+ * @param phset_set    hash_set container.
+ * @param cpv_value    pointer to specific element.
+ * @return the number of erased elements.
+ * @remarks if phset_set == NULL or cpv_value == NULL then the behavior is undefined. phset_set must be initialized, otherwise
+ *          the behavior is undefined. cpv_value points to the element, but it is char* for c string element.
+ */
+extern size_t hash_set_erase_ptr(hash_set_t* phset_set, const void* cpv_value);
+
 #ifdef __cplusplus
 }
 #endif
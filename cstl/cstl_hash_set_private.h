@@ -32,9 +32,14 @@ extern "C" {
 /** constant declaration and macro section **/
 
 /** data type declaration and struct, union, enum section **/
+/* the hash_set use chained hashtable default */
 typedef struct _taghashset
 {
-    _hashtable_t _t_hashtable;
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_t _t_hashtable;
+#else
+    _hashtable_t      _t_hashtable;
+#endif
 }hash_set_t;
 
 /** exported global variable declaration section **/
@@ -49,6 +54,17 @@ typedef struct _taghashset
  */
 extern hash_set_t* _create_hash_set(const char* s_typename);
 
+/**
+ * Create hash_set container that uses user defined allocator.
+ * @param cpt_allocator     user defined allocator.
+ * @param s_typename        element type name.
+ * @return if create hash_set successfully return hash_set pointer, otherwise return NULL.
+ * @remarks if cpt_allocator == NULL or s_typename == NULL, then the behavior is undefined. s_typename should be C
+ *          builtin type name, libcstl builtin typename or registed user defined type name, otherwise the function will
+ *          return NULL.
+ */
+extern hash_set_t* _create_hash_set_with_allocator(const allocator_t* cpt_allocator, const char* s_typename);
+
 /**
  * Create hash_set container auxiliary function.
  * @param pset_set          uncreated container.
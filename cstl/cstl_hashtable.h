@@ -189,6 +189,15 @@ extern bool_t _hashtable_empty(const _hashtable_t* cpt_hashtable);
  */
 extern size_t _hashtable_max_size(const _hashtable_t* cpt_hashtable);
 
+/**
+ * Get the memory that is allocated by the hashtable.
+ * @param cpt_hashtable      hashtable container.
+ * @return the bytes of nodes, buckets and the memory cached by the allocator of hashtable.
+ * @remarks if cpt_hashtable == NULL, then the behavior is undefined, the cpt_hashtable must be initialized, otherwise
+ *          the behavior is undefined. the hashtable structure itself is not counted.
+ */
+extern size_t _hashtable_memory_usage(const _hashtable_t* cpt_hashtable);
+
 /**
  * Get the bucket count of elements int the hashtable.
  * @param cpt_hashtable      hashtable container.
@@ -198,6 +207,35 @@ extern size_t _hashtable_max_size(const _hashtable_t* cpt_hashtable);
  */
 extern size_t _hashtable_bucket_count(const _hashtable_t* cpt_hashtable);
 
+/**
+ * Get the average number of elements per bucket.
+ * @param cpt_hashtable      hashtable container.
+ * @return the load factor of hashtable.
+ * @remarks if cpt_hashtable == NULL, then the behavior is undefined, the cpt_hashtable must be initialized, otherwise the
+ *          behavior is undefined.
+ */
+extern float _hashtable_load_factor(const _hashtable_t* cpt_hashtable);
+
+/**
+ * Get the max load factor of hashtable.
+ * @param cpt_hashtable      hashtable container.
+ * @return the max load factor of hashtable.
+ * @remarks if cpt_hashtable == NULL, then the behavior is undefined, the cpt_hashtable must be initialized, otherwise the
+ *          behavior is undefined.
+ */
+extern float _hashtable_max_load_factor(const _hashtable_t* cpt_hashtable);
+
+/**
+ * Set the max load factor of hashtable.
+ * @param pt_hashtable       hashtable container.
+ * @param f_maxloadfactor    new max load factor.
+ * @return void.
+ * @remarks if pt_hashtable == NULL, then the behavior is undefined, the pt_hashtable must be initialized, otherwise the
+ *          behavior is undefined. f_maxloadfactor must be greater than 0, otherwise the behavior is undefined. the buckets
+ *          are expanded if the current load factor exceeds the new max load factor.
+ */
+extern void _hashtable_set_max_load_factor(_hashtable_t* pt_hashtable, float f_maxloadfactor);
+
 /**
  * Return an iterator that addresses the first element in the hashtable.
  * @param cpt_hashtable      hashtable container.
@@ -241,10 +279,26 @@ extern bfun_t _hashtable_key_comp(const _hashtable_t* cpt_hashtable);
  * @return iterator addresses the sprcific element in the hashtable, otherwise return _hashtable_end().
  * @remarks if cpt_hashtable == NULL or cpv_value == NULL then the behavior is undefined. cpt_hashtable must be initialized,
  *          otherwise the behavior is undefined. the type of specific element and cpt_hashtable must be same, otherwise the
- *          behavior is undefined.
+ *          behavior is undefined. the old buckets of incremental rehash are not moved, so the hashtable is not changed.
  */
 extern _hashtable_iterator_t _hashtable_find(const _hashtable_t* cpt_hashtable, const void* cpv_value);
 
+/**
+ * Find a batch of specific elements.
+ * @param cpt_hashtable     hashtable container.
+ * @param cppv_values       array of pointers to specific elements.
+ * @param t_count           element count of array.
+ * @param pit_result        array of iterators that receives the result.
+ * @return void.
+ * @remarks if cpt_hashtable == NULL, cppv_values == NULL or pit_result == NULL then the behavior is undefined.
+ *          cpt_hashtable must be initialized, otherwise the behavior is undefined. the type of specific elements and
+ *          cpt_hashtable must be same, otherwise the behavior is undefined. the iterator of each element is same as
+ *          _hashtable_find(). the elements are hashed and the buckets are prefetched in groups, so the cache misses
+ *          of lookups are overlapped.
+ */
+extern void _hashtable_find_batch(
+    const _hashtable_t* cpt_hashtable, const void* const* cppv_values, size_t t_count, _hashtable_iterator_t* pit_result);
+
 /**
  * Erases all the elements of an hashtable.
  * @param pt_hashtable       hashtable container.
@@ -352,6 +406,26 @@ extern bool_t _hashtable_greater_equal(const _hashtable_t* cpt_first, const _has
  */
 extern void _hashtable_resize(_hashtable_t* pt_hashtable, size_t t_resize);
 
+/**
+ * Reserve buckets for specific number of elements.
+ * @param pt_hashtable      hashtable container.
+ * @param t_elemcount       element count.
+ * @return void.
+ * @remarks if pt_hashtable == NULL, the behavior is undefined, pt_hashtable must be initialized, otherwise the behavior
+ *          is undefined. the buckets are expanded so that t_elemcount elements are inserted without rehash.
+ */
+extern void _hashtable_reserve(_hashtable_t* pt_hashtable, size_t t_elemcount);
+
+/**
+ * Shrink the buckets to fit the elements.
+ * @param pt_hashtable      hashtable container.
+ * @return void.
+ * @remarks if pt_hashtable == NULL, the behavior is undefined, pt_hashtable must be initialized, otherwise the behavior
+ *          is undefined. the elements are rehashed into the least buckets that do not exceed the max load factor, and
+ *          the memory of unused buckets is released. all iterators are invalid after shrinking.
+ */
+extern void _hashtable_shrink_to_fit(_hashtable_t* pt_hashtable);
+
 /**
  * Inserts an unique element into a hashtable.
  * @param pt_hashtable       hashtable container.
@@ -450,7 +524,8 @@ extern void _hashtable_erase_range(
  * @param cpv_value         specific element.
  * @return the number of erased elements.
  * @remarks if pt_hashtable == NULL or cpv_value == NULL then the behavior is undefined. cpt_hashtable must be initialized,
- *          otherwise the behavior is undefined. 
+ *          otherwise the behavior is undefined. during incremental rehash some old buckets are moved into new buckets like
+ *          insertion, so the iterators of pt_hashtable are invalid.
  */
 extern size_t _hashtable_erase(_hashtable_t* pt_hashtable, const void* cpv_value);
 
@@ -36,6 +36,9 @@ extern "C" {
 typedef struct _taghashnode
 {
     struct _taghashnode* _pt_next;
+#ifdef CSTL_HASHTABLE_HASH_CODE_CACHE
+    size_t               _t_hashcode;
+#endif
     _byte_t              _pby_data[1];
 }_hashnode_t;
 
@@ -50,6 +53,20 @@ typedef struct _taghashtable
     /* buckets and node */
     vector_t          _vec_bucket;
     size_t            _t_nodecount;
+    size_t            _t_nodesize;  /* node size, including the inline storage of pair element */
+
+    /* occupancy bitmap of buckets, one bit for each bucket, the bit of non-empty bucket is set */
+    size_t*           _pt_bucketmap;
+    size_t            _t_firstbucket; /* the first non-empty bucket, it is bucket count if all buckets are empty */
+    /* the maximum average number of elements per bucket, the buckets are expanded when it is exceeded */
+    float             _f_maxloadfactor;
+
+    /* the old buckets that are moved into new buckets step by step during incremental rehash */
+    _hashnode_t**     _ppt_oldbucket;   /* the storage is taken over from the bucket vector */
+    size_t*           _pt_oldbucketmap;
+    size_t            _t_oldbucketcount;
+    size_t            _t_oldbucketcapacity;
+    size_t            _t_rehashpos;
 
     /* hash function */
     ufun_t            _ufun_hash;
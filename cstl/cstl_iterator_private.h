@@ -82,6 +82,11 @@ extern "C" {
 #define _HASHTABLE_ITERATOR_COREPOS(it_iter)            ((it_iter)._t_pos._t_hashpos._pby_corepos)
 #define _HASHTABLE_ITERATOR_HASHTABLE(it_iter)          ((_hashtable_t*)((it_iter)._t_pos._t_hashpos._pt_hashtable))
 #define _HASHTABLE_ITERATOR_HASHTABLE_POINTER(it_iter)  ((it_iter)._t_pos._t_hashpos._pt_hashtable)
+/* flat hashtable iterator handler */
+#define _FLAT_HASHTABLE_ITERATOR_CTRLPOS(it_iter)       ((it_iter)._t_pos._t_hashpos._pby_bucketpos)
+#define _FLAT_HASHTABLE_ITERATOR_COREPOS(it_iter)       ((it_iter)._t_pos._t_hashpos._pby_corepos)
+#define _FLAT_HASHTABLE_ITERATOR_HASHTABLE(it_iter)     ((_flat_hashtable_t*)((it_iter)._t_pos._t_hashpos._pt_hashtable))
+#define _FLAT_HASHTABLE_ITERATOR_HASHTABLE_POINTER(it_iter) ((it_iter)._t_pos._t_hashpos._pt_hashtable)
 /* hash_set iterator handler */
 #define _HASH_SET_ITERATOR_CONTAINER(it_iter)           ((hash_set_t*)((it_iter)._pt_container))
 #define _HASH_SET_ITERATOR_CONTAINER_TYPE(it_iter)      ((it_iter)._t_containertype)
@@ -269,6 +274,14 @@ extern _typestyle_t _iterator_get_typestyle(iterator_t it_iter);
  */
 extern const char* _iterator_get_typebasename(iterator_t it_iter);
 
+/**
+ * Get type id of iterator.
+ * @param it_iter      iterator.
+ * @return type id of iterator.
+ * @remarks iterator must be valid, otherwise behavior is undefined.
+ */
+extern size_t _iterator_get_typeid(iterator_t it_iter);
+
 /**
  * Get type name of iterator.
  * @param it_iter      iterator.
@@ -302,6 +315,15 @@ extern size_t _iterator_get_typesize(iterator_t it_iter);
  */
 extern bool_t _iterator_same_elem_type(iterator_t it_first, iterator_t it_second);
 
+/**
+ * Test whether the element that iterator points to can be relocated in place.
+ * @param it_iter      iterator.
+ * @return whether the element can be relocated.
+ * @remarks iterator must be valid, otherwise behavior is undefined. only the elements of vector, deque, list and slist
+ *          are relocated in place.
+ */
+extern bool_t _iterator_elem_is_relocatable(iterator_t it_iter);
+
 /**
  * Initialize an element according to the type of iterator pointed data.
  * @param it_iter      iterator.
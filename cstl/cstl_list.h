@@ -38,6 +38,29 @@ extern "C" {
  */
 #define create_list(...) _create_list(#__VA_ARGS__)
 
+/**
+ * Create list container that allocates memory by user defined allocator.
+ * @param cpt_allocator  user defined allocator.
+ * @param ...            element type name.
+ * @return if create list successfully return list pointer, otherwise return NULL.
+ * @remarks if cpt_allocator == NULL, then the behavior is undefined. the allocator is used by all the memory of elements
+ *          and must be valid until the list is destroyed. element type name should be C builtin type name, libcstl
+ *          builtin typename or registed user defined type name, otherwise the function will return NULL.
+ */
+#define create_list_with_allocator(cpt_allocator, ...) _create_list_with_allocator((cpt_allocator), #__VA_ARGS__)
+
+/**
+ * Create list container that allocates memory from region.
+ * @param ...        element type name.
+ * @return if create list successfully return list pointer, otherwise return NULL.
+ * @remarks the memory of erased elements is not reused, list_clear() and list_destroy() release the whole region at
+ *          once, and the elements are not destroyed one by one if the element type need not be destroyed, such as C
+ *          builtin types except char*. element type name should be C builtin type name, libcstl builtin typename or
+ *          registed user defined type name, otherwise the function will return NULL. list_clear() invalidates the
+ *          end iterator too, and the nodes can not be spliced into the list that does not use the same region.
+ */
+#define create_list_with_region(...) _create_list_with_region(#__VA_ARGS__)
+
 /**
  * Initialize list with specified element.
  * @param plist_list   uninitialized list container.
@@ -227,6 +250,16 @@ extern bool_t list_empty(const list_t* cplist_list);
  */
 extern size_t list_max_size(const list_t* cplist_list);
 
+/**
+ * Get the memory that is held by the list.
+ * @param cplist_list   list container.
+ * @return the bytes of list structure, nodes and the memory cached by the allocator of list.
+ * @remarks if cplist_list == NULL, then the behavior is undefined. cplist_list must be initialized, otherwise the
+ *          behavior is undefined. the memory that is owned by the elements themselves, such as the string of char* or
+ *          the nodes of nested container, is not counted.
+ */
+extern size_t list_memory_usage(const list_t* cplist_list);
+
 /**
  * Tests if the two lists are equal.
  * @param cplist_first   first list container.
@@ -597,6 +630,28 @@ extern void list_merge_if(list_t* plist_dest, list_t* plist_src, bfun_t bfun_op)
  */
 extern void list_reverse(list_t* plist_list);
 
+/**
+ * Adds an element that is pointed by pointer to the end of list.
+ * @param plist_list    list container.
+ * @param cpv_value    pointer to specific element.
+ * @return void.
+ * @remarks if plist_list == NULL or cpv_value == NULL, then the behavior is undefined. the list must be initialized,
+ *          otherwise the behavior is undefined. cpv_value points to the element, but it is char* for c string element.
+ *          the element is copied without the variable argument list.
+ */
+extern void list_push_back_ptr(list_t* plist_list, const void* cpv_value);
+
+/**
+ * Adds an element that is pointed by pointer to the begin of list.
+ * @param plist_list    list container.
+ * @param cpv_value    pointer to specific element.
+ * @return void.
+ * @remarks if plist_list == NULL or cpv_value == NULL, then the behavior is undefined. the list must be initialized,
+ *          otherwise the behavior is undefined. cpv_value points to the element, but it is char* for c string element.
+ *          the element is copied without the variable argument list.
+ */
+extern void list_push_front_ptr(list_t* plist_list, const void* cpv_value);
+
 #ifdef __cplusplus
 }
 #endif
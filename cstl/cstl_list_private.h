@@ -74,6 +74,26 @@ typedef struct _taglist
  */
 extern list_t* _create_list(const char* s_typename);
 
+/**
+ * Create list container that uses user defined allocator.
+ * @param cpt_allocator     user defined allocator.
+ * @param s_typename        element type name.
+ * @return if create list successfully return list pointer, otherwise return NULL.
+ * @remarks if cpt_allocator == NULL or s_typename == NULL, then the behavior is undefined. s_typename should be C
+ *          builtin type name, libcstl builtin typename or registed user defined type name, otherwise the function will
+ *          return NULL.
+ */
+extern list_t* _create_list_with_allocator(const allocator_t* cpt_allocator, const char* s_typename);
+
+/**
+ * Create list container that allocates memory from region.
+ * @param s_typename        element type name.
+ * @return if create list successfully return list pointer, otherwise return NULL.
+ * @remarks if s_typename == NULL, then the behavior is undefined. s_typename should be C builtin type name, libcstl
+ *          builtin typename or registed user defined type name, otherwise the function will return NULL.
+ */
+extern list_t* _create_list_with_region(const char* s_typename);
+
 /**
  * Create list container auxiliary function.
  * @param plist_list    list container.
@@ -39,6 +39,28 @@ extern "C" {
  */
 #define create_map(...) _create_map(#__VA_ARGS__)
 
+/**
+ * Create map container that allocates memory by user defined allocator.
+ * @param cpt_allocator  user defined allocator.
+ * @param ...            element type name.
+ * @return if create map successfully return map pointer, otherwise return NULL.
+ * @remarks if cpt_allocator == NULL, then the behavior is undefined. the allocator is used by all the memory of elements
+ *          and must be valid until the map is destroyed. element type name should be C builtin type name, libcstl
+ *          builtin typename or registed user defined type name, otherwise the function will return NULL.
+ */
+#define create_map_with_allocator(cpt_allocator, ...) _create_map_with_allocator((cpt_allocator), #__VA_ARGS__)
+
+/**
+ * Create map container that allocates memory from region.
+ * @param ...        element type name.
+ * @return if create map successfully return map pointer, otherwise return NULL.
+ * @remarks the memory of erased elements is not reused, map_clear() and map_destroy() release the whole region at
+ *          once, and the elements are not destroyed one by one if the element type need not be destroyed, such as C
+ *          builtin types except char*. element type name should be C builtin type name, libcstl builtin typename or
+ *          registed user defined type name, otherwise the function will return NULL.
+ */
+#define create_map_with_region(...) _create_map_with_region(#__VA_ARGS__)
+
 /**
  * Find specific element.
  * @param cpmap_map    map container.
@@ -252,6 +274,16 @@ extern bool_t map_empty(const map_t* cpmap_map);
  */
 extern size_t map_max_size(const map_t* cpmap_map);
 
+/**
+ * Get the memory that is held by the map.
+ * @param cpmap_map   map container.
+ * @return the bytes of map structure, nodes, pair elements and the memory cached by the allocator of map.
+ * @remarks if cpmap_map == NULL, then the behavior is undefined. cpmap_map must be initialized, otherwise the
+ *          behavior is undefined. the memory that is owned by the elements themselves, such as the string of char* or
+ *          the nodes of nested container, is not counted.
+ */
+extern size_t map_memory_usage(const map_t* cpmap_map);
+
 /**
  * Return an iterator that addresses the first element in the map.
  * @param cpmap_map      map container.
@@ -428,6 +460,62 @@ extern bool_t map_greater(const map_t* cpmap_first, const map_t* cpmap_second);
  */
 extern bool_t map_greater_equal(const map_t* cpmap_first, const map_t* cpmap_second);
 
+/**
+ * Find specific element by the key that is pointed by pointer.
+ * @param cpmap_map    map container.
+ * @param cpv_key    pointer to specific key.
+ * @return iterator addresses the specific element in the map, otherwise return map_end().
+ * @remarks if cpmap_map == NULL or cpv_key == NULL then the behavior is undefined. cpmap_map must be initialized, otherwise
+ *          the behavior is undefined. cpv_key points to the key, but it is char* for c string key. the key is not
+ *          passed through the variable argument list.
+ */
+extern map_iterator_t map_find_ptr(const map_t* cpmap_map, const void* cpv_key);
+
+/**
+ * Return the number of elements whose key is pointed by pointer.
+ * @param cpmap_map    map container.
+ * @param cpv_key    pointer to specific key.
+ * @return the number of specific elements.
+ * @remarks if cpmap_map == NULL or cpv_key == NULL then the behavior is undefined. cpmap_map must be initialized, otherwise
+ *          the behavior is undefined. cpv_key points to the key, but it is char* for c string key.
+ */
+extern size_t map_count_ptr(const map_t* cpmap_map, const void* cpv_key);
+
+/**
+ * Find a batch of elements by the keys in array.
+ * @param cpmap_map     map container.
+ * @param cpv_keys      array of keys.
+ * @param t_count       key count of array.
+ * @param pit_result    array of iterators that receives the result.
+ * @return void.
+ * @remarks if cpmap_map == NULL, cpv_keys == NULL or pit_result == NULL then the behavior is undefined. cpmap_map must
+ *          be initialized, otherwise the behavior is undefined. the array of c builtin keys holds the keys, the array
+ *          of c string keys holds char*, and the array of other keys holds the pointers to keys. each iterator in
+ *          pit_result is same as map_find_ptr() of the key. the keys are passed to the lookup in groups, so the cache
+ *          misses of lookups are overlapped.
+ */
+extern void map_find_batch(const map_t* cpmap_map, const void* cpv_keys, size_t t_count, map_iterator_t* pit_result);
+
+/**
+ * Erase the elements whose key is pointed by pointer.
+ * @param pmap_map    map container.
+ * @param cpv_key    pointer to specific key.
+ * @return the number of erased elements.
+ * @remarks if pmap_map == NULL or cpv_key == NULL then the behavior is undefined. pmap_map must be initialized, otherwise
+ *          the behavior is undefined. cpv_key points to the key, but it is char* for c string key.
+ */
+extern size_t map_erase_ptr(map_t* pmap_map, const void* cpv_key);
+
+/**
+ * Access an element by the key that is pointed by pointer.
+ * @param pmap_map    map container.
+ * @param cpv_key    pointer to specific key.
+ * @return pointer to the value of element, the element is inserted if the key is not existed.
+ * @remarks if pmap_map == NULL or cpv_key == NULL then the behavior is undefined. pmap_map must be initialized, otherwise
+ *          the behavior is undefined. cpv_key points to the key, but it is char* for c string key.
+ */
+extern void* map_at_ptr(map_t* pmap_map, const void* cpv_key);
+
 #ifdef __cplusplus
 }
 #endif
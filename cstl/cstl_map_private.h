@@ -58,6 +58,26 @@ typedef struct _tagmap
  */
 extern map_t* _create_map(const char* s_typename);
 
+/**
+ * Create map container that uses user defined allocator.
+ * @param cpt_allocator     user defined allocator.
+ * @param s_typename        element type name.
+ * @return if create map successfully return map pointer, otherwise return NULL.
+ * @remarks if cpt_allocator == NULL or s_typename == NULL, then the behavior is undefined. s_typename should be C
+ *          builtin type name, libcstl builtin typename or registed user defined type name, otherwise the function will
+ *          return NULL.
+ */
+extern map_t* _create_map_with_allocator(const allocator_t* cpt_allocator, const char* s_typename);
+
+/**
+ * Create map container that allocates memory from region.
+ * @param s_typename        element type name.
+ * @return if create map successfully return map pointer, otherwise return NULL.
+ * @remarks if s_typename == NULL, then the behavior is undefined. s_typename should be C builtin type name, libcstl
+ *          builtin typename or registed user defined type name, otherwise the function will return NULL.
+ */
+extern map_t* _create_map_with_region(const char* s_typename);
+
 /**
  * Create map container auxiliary function.
  * @param pmap_map          uncreated container.
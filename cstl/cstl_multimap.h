@@ -39,6 +39,28 @@ extern "C" {
  */
 #define create_multimap(...) _create_multimap(#__VA_ARGS__)
 
+/**
+ * Create multimap container that allocates memory by user defined allocator.
+ * @param cpt_allocator  user defined allocator.
+ * @param ...            element type name.
+ * @return if create multimap successfully return multimap pointer, otherwise return NULL.
+ * @remarks if cpt_allocator == NULL, then the behavior is undefined. the allocator is used by all the memory of elements
+ *          and must be valid until the multimap is destroyed. element type name should be C builtin type name, libcstl
+ *          builtin typename or registed user defined type name, otherwise the function will return NULL.
+ */
+#define create_multimap_with_allocator(cpt_allocator, ...) _create_multimap_with_allocator((cpt_allocator), #__VA_ARGS__)
+
+/**
+ * Create multimap container that allocates memory from region.
+ * @param ...        element type name.
+ * @return if create multimap successfully return multimap pointer, otherwise return NULL.
+ * @remarks the memory of erased elements is not reused, multimap_clear() and multimap_destroy() release the whole region at
+ *          once, and the elements are not destroyed one by one if the element type need not be destroyed, such as C
+ *          builtin types except char*. element type name should be C builtin type name, libcstl builtin typename or
+ *          registed user defined type name, otherwise the function will return NULL.
+ */
+#define create_multimap_with_region(...) _create_multimap_with_region(#__VA_ARGS__)
+
 /**
  * Find specific element.
  * @param cpmap_map    multimap container.
@@ -242,6 +264,16 @@ extern bool_t multimap_empty(const multimap_t* cpmmap_map);
  */
 extern size_t multimap_max_size(const multimap_t* cpmmap_map);
 
+/**
+ * Get the memory that is held by the multimap.
+ * @param cpmmap_map   multimap container.
+ * @return the bytes of multimap structure, nodes, pair elements and the memory cached by the allocator of multimap.
+ * @remarks if cpmmap_map == NULL, then the behavior is undefined. cpmmap_map must be initialized, otherwise the
+ *          behavior is undefined. the memory that is owned by the elements themselves, such as the string of char* or
+ *          the nodes of nested container, is not counted.
+ */
+extern size_t multimap_memory_usage(const multimap_t* cpmmap_map);
+
 /**
  * Return the compare function of key.
  * @param cpmap_map      multimap container.
@@ -418,6 +450,37 @@ extern void multimap_erase_pos(multimap_t* pmmap_map, multimap_iterator_t it_pos
  */
 extern void multimap_erase_range(multimap_t* pmmap_map, multimap_iterator_t it_begin, multimap_iterator_t it_end);
 
+/**
+ * Find specific element by the key that is pointed by pointer.
+ * @param cpmmap_map    multimap container.
+ * @param cpv_key    pointer to specific key.
+ * @return iterator addresses the specific element in the multimap, otherwise return multimap_end().
+ * @remarks if cpmmap_map == NULL or cpv_key == NULL then the behavior is undefined. cpmmap_map must be initialized, otherwise
+ *          the behavior is undefined. cpv_key points to the key, but it is char* for c string key. the key is not
+ *          passed through the variable argument list.
+ */
+extern multimap_iterator_t multimap_find_ptr(const multimap_t* cpmmap_map, const void* cpv_key);
+
+/**
+ * Return the number of elements whose key is pointed by pointer.
+ * @param cpmmap_map    multimap container.
+ * @param cpv_key    pointer to specific key.
+ * @return the number of specific elements.
+ * @remarks if cpmmap_map == NULL or cpv_key == NULL then the behavior is undefined. cpmmap_map must be initialized, otherwise
+ *          the behavior is undefined. cpv_key points to the key, but it is char* for c string key.
+ */
+extern size_t multimap_count_ptr(const multimap_t* cpmmap_map, const void* cpv_key);
+
+/**
+ * Erase the elements whose key is pointed by pointer.
+ * @param pmmap_map    multimap container.
+ * @param cpv_key    pointer to specific key.
+ * @return the number of erased elements.
+ * @remarks if pmmap_map == NULL or cpv_key == NULL then the behavior is undefined. pmmap_map must be initialized, otherwise
+ *          the behavior is undefined. cpv_key points to the key, but it is char* for c string key.
+ */
+extern size_t multimap_erase_ptr(multimap_t* pmmap_map, const void* cpv_key);
+
 #ifdef __cplusplus
 }
 #endif
@@ -58,6 +58,26 @@ typedef struct _tagmultimap
  */
 extern multimap_t* _create_multimap(const char* s_typename);
 
+/**
+ * Create multimap container that uses user defined allocator.
+ * @param cpt_allocator     user defined allocator.
+ * @param s_typename        element type name.
+ * @return if create multimap successfully return multimap pointer, otherwise return NULL.
+ * @remarks if cpt_allocator == NULL or s_typename == NULL, then the behavior is undefined. s_typename should be C
+ *          builtin type name, libcstl builtin typename or registed user defined type name, otherwise the function will
+ *          return NULL.
+ */
+extern multimap_t* _create_multimap_with_allocator(const allocator_t* cpt_allocator, const char* s_typename);
+
+/**
+ * Create multimap container that allocates memory from region.
+ * @param s_typename        element type name.
+ * @return if create multimap successfully return multimap pointer, otherwise return NULL.
+ * @remarks if s_typename == NULL, then the behavior is undefined. s_typename should be C builtin type name, libcstl
+ *          builtin typename or registed user defined type name, otherwise the function will return NULL.
+ */
+extern multimap_t* _create_multimap_with_region(const char* s_typename);
+
 /**
  * Create multimap container auxiliary function.
  * @param pmmap_map          uncreated container.
@@ -39,6 +39,28 @@ extern "C" {
  */
 #define create_multiset(...) _create_multiset(#__VA_ARGS__) 
 
+/**
+ * Create multiset container that allocates memory by user defined allocator.
+ * @param cpt_allocator  user defined allocator.
+ * @param ...            element type name.
+ * @return if create multiset successfully return multiset pointer, otherwise return NULL.
+ * @remarks if cpt_allocator == NULL, then the behavior is undefined. the allocator is used by all the memory of elements
+ *          and must be valid until the multiset is destroyed. element type name should be C builtin type name, libcstl
+ *          builtin typename or registed user defined type name, otherwise the function will return NULL.
+ */
+#define create_multiset_with_allocator(cpt_allocator, ...) _create_multiset_with_allocator((cpt_allocator), #__VA_ARGS__)
+
+/**
+ * Create multiset container that allocates memory from region.
+ * @param ...        element type name.
+ * @return if create multiset successfully return multiset pointer, otherwise return NULL.
+ * @remarks the memory of erased elements is not reused, multiset_clear() and multiset_destroy() release the whole region at
+ *          once, and the elements are not destroyed one by one if the element type need not be destroyed, such as C
+ *          builtin types except char*. element type name should be C builtin type name, libcstl builtin typename or
+ *          registed user defined type name, otherwise the function will return NULL.
+ */
+#define create_multiset_with_region(...) _create_multiset_with_region(#__VA_ARGS__)
+
 /**
  * Find specific element.
  * @param cpmset_mset      multiset container.
@@ -251,6 +273,16 @@ extern bool_t multiset_empty(const multiset_t* cpmset_mset);
  */
 extern size_t multiset_max_size(const multiset_t* cpmset_mset);
 
+/**
+ * Get the memory that is held by the multiset.
+ * @param cpmset_mset   multiset container.
+ * @return the bytes of multiset structure, nodes and the memory cached by the allocator of multiset.
+ * @remarks if cpmset_mset == NULL, then the behavior is undefined. cpmset_mset must be initialized, otherwise the
+ *          behavior is undefined. the memory that is owned by the elements themselves, such as the string of char* or
+ *          the nodes of nested container, is not counted.
+ */
+extern size_t multiset_memory_usage(const multiset_t* cpmset_mset);
+
 /**
  * Return an iterator that addresses the first element in the multiset.
  * @param cpmset_mset      multiset container.
@@ -417,6 +449,47 @@ extern void multiset_erase_pos(multiset_t* pmset_mset, multiset_iterator_t it_po
  */
 extern void multiset_erase_range(multiset_t* pmset_mset, multiset_iterator_t it_begin, multiset_iterator_t it_end);
 
+/**
+ * Find specific element that is pointed by pointer.
+ * @param cpmset_mset    multiset container.
+ * @param cpv_value    pointer to specific element.
+ * @return iterator addresses the specific element in the multiset, otherwise return multiset_end().
+ * @remarks if cpmset_mset == NULL or cpv_value == NULL then the behavior is undefined. cpmset_mset must be initialized, otherwise
+ *          the behavior is undefined. cpv_value points to the element, but it is char* for c string element. the
+ *          value is not copied into a temporary element, so the variable argument list is not used.
+ */
+extern multiset_iterator_t multiset_find_ptr(const multiset_t* cpmset_mset, const void* cpv_value);
+
+/**
+ * Return the number of specific elements that is pointed by pointer.
+ * @param cpmset_mset    multiset container.
+ * @param cpv_value    pointer to specific element.
+ * @return the number of specific elements.
+ * @remarks if cpmset_mset == NULL or cpv_value == NULL then the behavior is undefined. cpmset_mset must be initialized, otherwise
+ *          the behavior is undefined. cpv_value points to the element, but it is char* for c string element.
+ */
+extern size_t multiset_count_ptr(const multiset_t* cpmset_mset, const void* cpv_value);
+
+/**
+ * Inserts an element that is pointed by pointer into a multiset.
+ * @param pmset_mset    multiset container.
+ * @param cpv_value    pointer to specific element.
+ * @return iterator addresses the inserted element.
+ * @remarks if pmset_mset == NULL or cpv_value == NULL then the behavior is undefined. pmset_mset must be initialized, otherwise
+ *          the behavior is undefined. cpv_value points to the element, but it is char* for c string element.
+ */
+extern multiset_iterator_t multiset_insert_ptr(multiset_t* pmset_mset, const void* cpv_value);
+
+/**
+ * Erase elements from a multiset that match a element that is pointed by pointer.
+ * @param pmset_mset    multiset container.
+ * @param cpv_value    pointer to specific element.
+ * @return the number of erased elements.
+ * @remarks if pmset_mset == NULL or cpv_value == NULL then the behavior is undefined. pmset_mset must be initialized, otherwise
+ *          the behavior is undefined. cpv_value points to the element, but it is char* for c string element.
+ */
+extern size_t multiset_erase_ptr(multiset_t* pmset_mset, const void* cpv_value);
+
 #ifdef __cplusplus
 }
 #endif
@@ -54,6 +54,26 @@ typedef struct _tagmultiset
  */
 extern multiset_t* _create_multiset(const char* s_typename);
 
+/**
+ * Create multiset container that uses user defined allocator.
+ * @param cpt_allocator     user defined allocator.
+ * @param s_typename        element type name.
+ * @return if create multiset successfully return multiset pointer, otherwise return NULL.
+ * @remarks if cpt_allocator == NULL or s_typename == NULL, then the behavior is undefined. s_typename should be C
+ *          builtin type name, libcstl builtin typename or registed user defined type name, otherwise the function will
+ *          return NULL.
+ */
+extern multiset_t* _create_multiset_with_allocator(const allocator_t* cpt_allocator, const char* s_typename);
+
+/**
+ * Create multiset container that allocates memory from region.
+ * @param s_typename        element type name.
+ * @return if create multiset successfully return multiset pointer, otherwise return NULL.
+ * @remarks if s_typename == NULL, then the behavior is undefined. s_typename should be C builtin type name, libcstl
+ *          builtin typename or registed user defined type name, otherwise the function will return NULL.
+ */
+extern multiset_t* _create_multiset_with_region(const char* s_typename);
+
 /**
  * Create multiset container auxiliary function.
  * @param pmset_mset        uncreated container.
@@ -38,8 +38,10 @@ typedef struct _tagpair
     _typeinfo_t       _t_typeinfofirst;
     _typeinfo_t       _t_typeinfosecond;
 
+    /* the first and second share one block of memory, the second follows the first */
     void*             _pv_first;
     void*             _pv_second;
+    bool_t            _b_inline;  /* the block follows the pair in the same node, it is not freed with pair */
 
     /* this two members are only used for map key and value compare. */
     bfun_t            _bfun_mapkeycompare;
@@ -95,6 +97,37 @@ extern void _pair_make_first(pair_t* ppair_pair, ...);
  */
 extern void _pair_make_second(pair_t* ppair_pair, ...);
 
+/**
+ * Get the size of storage that holds the first and second of pair element inline.
+ * @param cpt_typeinfo          element type information.
+ * @return the size of inline storage, if the element type is not pair_t, then return 0.
+ * @remarks if cpt_typeinfo == NULL, then the behavior is undefined. node based containers allocate the storage right
+ *          after the pair element in each node, so that the pair and its first and second live in one allocation.
+ *          the size includes the padding that aligns the storage, because the pair in node may be not aligned.
+ */
+extern size_t _pair_get_inline_size(const _typeinfo_t* cpt_typeinfo);
+
+/**
+ * Test the pair element that is stored inline need not be destroyed.
+ * @param cpt_typeinfo          element type information.
+ * @return true if the element type is pair_t and its first and second are trivially destructible, otherwise false.
+ * @remarks if cpt_typeinfo == NULL, then the behavior is undefined. the pair that is stored inline by
+ *          _pair_init_inline() owns no memory outside the node, so it need not be destroyed when the node is released
+ *          with region. the other pairs own the storage of first and second, they must be destroyed.
+ */
+extern bool_t _pair_is_inline_trivially_destructible(const _typeinfo_t* cpt_typeinfo);
+
+/**
+ * Create and initialize pair container in the storage that follows the pair.
+ * @param ppair_pair            uncreated container.
+ * @param s_typename            element type name.
+ * @return void.
+ * @remarks if ppair_pair == NULL or s_typename == NULL, then the behavior is undefined. pair must be followed by the
+ *          storage of _pair_get_inline_size() bytes, and it must not be relocated until it is destroyed, otherwise the
+ *          behavior is undefined.
+ */
+extern void _pair_init_inline(pair_t* ppair_pair, const char* s_typename);
+
 /**
  * Test pair is created by create_pair.
  * @param cppair_pair           pair container.
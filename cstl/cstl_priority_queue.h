@@ -174,6 +174,17 @@ extern void* priority_queue_top(const priority_queue_t* cppque_pqueue);
  */
 extern void priority_queue_pop(priority_queue_t* ppque_pqueue);
 
+/**
+ * Adds an element that is pointed by pointer into priority_queue.
+ * @param ppque_pqueue    priority_queue adaptor.
+ * @param cpv_value    pointer to specific element.
+ * @return void.
+ * @remarks if ppque_pqueue == NULL or cpv_value == NULL, then the behavior is undefined. the priority_queue must be initialized,
+ *          otherwise the behavior is undefined. cpv_value points to the element, but it is char* for c string element.
+ *          the element is copied without the variable argument list.
+ */
+extern void priority_queue_push_ptr(priority_queue_t* ppque_pqueue, const void* cpv_value);
+
 #ifdef __cplusplus
 }
 #endif
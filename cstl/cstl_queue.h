@@ -204,6 +204,17 @@ extern bool_t queue_greater(const queue_t* cpque_first, const queue_t* cpque_sec
  */
 extern bool_t queue_greater_equal(const queue_t* cpque_first, const queue_t* cpque_second);
 
+/**
+ * Adds an element that is pointed by pointer to the back of queue.
+ * @param pque_queue    queue adaptor.
+ * @param cpv_value    pointer to specific element.
+ * @return void.
+ * @remarks if pque_queue == NULL or cpv_value == NULL, then the behavior is undefined. the queue must be initialized,
+ *          otherwise the behavior is undefined. cpv_value points to the element, but it is char* for c string element.
+ *          the element is copied without the variable argument list.
+ */
+extern void queue_push_ptr(queue_t* pque_queue, const void* cpv_value);
+
 #ifdef __cplusplus
 }
 #endif
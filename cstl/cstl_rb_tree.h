@@ -228,6 +228,15 @@ extern bool_t _rb_tree_empty(const _rb_tree_t* cpt_rb_tree);
  */
 extern size_t _rb_tree_max_size(const _rb_tree_t* cpt_rb_tree);
 
+/**
+ * Get the memory that is allocated by the rb tree.
+ * @param cpt_rb_tree      rb tree container.
+ * @return the bytes of nodes and the memory cached by the allocator of rb tree.
+ * @remarks if cpt_rb_tree == NULL, then the behavior is undefined, the cpt_rb_tree must be initialized, otherwise
+ *          the behavior is undefined. the rb tree structure itself is not counted.
+ */
+extern size_t _rb_tree_memory_usage(const _rb_tree_t* cpt_rb_tree);
+
 /**
  * Return an iterator that addresses the first element in the rb tree.
  * @param cpt_rb_tree      rb tree container.
@@ -268,6 +277,21 @@ extern bfun_t _rb_tree_key_comp(const _rb_tree_t* cpt_rb_tree);
  */
 extern _rb_tree_iterator_t _rb_tree_find(const _rb_tree_t* cpt_rb_tree, const void* cpv_value);
 
+/**
+ * Find a batch of specific elements.
+ * @param cpt_rb_tree       rb tree container.
+ * @param cppv_values       array of pointers to specific elements.
+ * @param t_count           element count of array.
+ * @param pit_result        array of iterators that receives the result.
+ * @return void.
+ * @remarks if cpt_rb_tree == NULL, cppv_values == NULL or pit_result == NULL then the behavior is undefined.
+ *          cpt_rb_tree must be initialized, otherwise the behavior is undefined. the type of specific elements and
+ *          cpt_rb_tree must be same, otherwise the behavior is undefined. the iterator of each element is same as
+ *          _rb_tree_find(). the lookups descend the tree together, so the cache misses of them are overlapped.
+ */
+extern void _rb_tree_find_batch(
+    const _rb_tree_t* cpt_rb_tree, const void* const* cppv_values, size_t t_count, _rb_tree_iterator_t* pit_result);
+
 /**
  * Erases all the elements of an rb tree.
  * @param pt_rb_tree       rb tree container.
@@ -398,6 +422,17 @@ extern bool_t _rb_tree_greater_equal(const _rb_tree_t* pt_first, const _rb_tree_
  */
 extern void _rb_tree_swap(_rb_tree_t* pt_first, _rb_tree_t* pt_second);
 
+/**
+ * Move the datas of rb tree into uninitialized memory.
+ * @param pt_target         uninitialized rb tree memory.
+ * @param pt_source         source rb tree container.
+ * @return void.
+ * @remarks if pt_target == NULL or pt_source == NULL, then the behavior is undefined. the source rb tree must be
+ *          initialized, otherwise the behavior is undefined. after moving, the memory of source rb tree is
+ *          uninitialized and must not be destroyed.
+ */
+extern void _rb_tree_relocate(_rb_tree_t* pt_target, _rb_tree_t* pt_source);
+
 /**
  * Inserts an unique element into a rb tree.
  * @param pt_rb_tree       rb tree container.
@@ -71,6 +71,7 @@ typedef struct _tagrbtree
     /* rb tree node */
     _rbnode_t         _t_rbroot;
     size_t            _t_nodecount;
+    size_t            _t_nodesize;  /* node size, including the inline storage of pair element */
 
     /* compare function for the inserting order */
     bfun_t            _t_compare;
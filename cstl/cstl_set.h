@@ -39,6 +39,28 @@ extern "C" {
  */
 #define create_set(...) _create_set(#__VA_ARGS__) 
 
+/**
+ * Create set container that allocates memory by user defined allocator.
+ * @param cpt_allocator  user defined allocator.
+ * @param ...            element type name.
+ * @return if create set successfully return set pointer, otherwise return NULL.
+ * @remarks if cpt_allocator == NULL, then the behavior is undefined. the allocator is used by all the memory of elements
+ *          and must be valid until the set is destroyed. element type name should be C builtin type name, libcstl
+ *          builtin typename or registed user defined type name, otherwise the function will return NULL.
+ */
+#define create_set_with_allocator(cpt_allocator, ...) _create_set_with_allocator((cpt_allocator), #__VA_ARGS__)
+
+/**
+ * Create set container that allocates memory from region.
+ * @param ...        element type name.
+ * @return if create set successfully return set pointer, otherwise return NULL.
+ * @remarks the memory of erased elements is not reused, set_clear() and set_destroy() release the whole region at
+ *          once, and the elements are not destroyed one by one if the element type need not be destroyed, such as C
+ *          builtin types except char*. element type name should be C builtin type name, libcstl builtin typename or
+ *          registed user defined type name, otherwise the function will return NULL.
+ */
+#define create_set_with_region(...) _create_set_with_region(#__VA_ARGS__)
+
 /**
  * Find specific element.
  * @param cpset_set      set container.
@@ -252,6 +274,16 @@ extern bool_t set_empty(const set_t* cpset_set);
  */
 extern size_t set_max_size(const set_t* cpset_set);
 
+/**
+ * Get the memory that is held by the set.
+ * @param cpset_set   set container.
+ * @return the bytes of set structure, nodes and the memory cached by the allocator of set.
+ * @remarks if cpset_set == NULL, then the behavior is undefined. cpset_set must be initialized, otherwise the
+ *          behavior is undefined. the memory that is owned by the elements themselves, such as the string of char* or
+ *          the nodes of nested container, is not counted.
+ */
+extern size_t set_memory_usage(const set_t* cpset_set);
+
 /**
  * Return an iterator that addresses the first element in the set.
  * @param cpset_set      set container.
@@ -418,6 +450,62 @@ extern void set_erase_pos(set_t* pset_set, set_iterator_t it_pos);
  */
 extern void set_erase_range(set_t* pset_set, set_iterator_t it_begin, set_iterator_t it_end);
 
+/**
+ * Find specific element that is pointed by pointer.
+ * @param cpset_set    set container.
+ * @param cpv_value    pointer to specific element.
+ * @return iterator addresses the specific element in the set, otherwise return set_end().
+ * @remarks if cpset_set == NULL or cpv_value == NULL then the behavior is undefined. cpset_set must be initialized, otherwise
+ *          the behavior is undefined. cpv_value points to the element, but it is char* for c string element. the
+ *          value is not copied into a temporary element, so the variable argument list is not used.
+ */
+extern set_iterator_t set_find_ptr(const set_t* cpset_set, const void* cpv_value);
+
+/**
+ * Return the number of specific elements that is pointed by pointer.
+ * @param cpset_set    set container.
+ * @param cpv_value    pointer to specific element.
+ * @return the number of specific elements.
+ * @remarks if cpset_set == NULL or cpv_value == NULL then the behavior is undefined. cpset_set must be initialized, otherwise
+ *          the behavior is undefined. cpv_value points to the element, but it is char* for c string element.
+ */
+extern size_t set_count_ptr(const set_t* cpset_set, const void* cpv_value);
+
+/**
+ * Find a batch of elements in array.
+ * @param cpset_set     set container.
+ * @param cpv_values    array of elements.
+ * @param t_count       element count of array.
+ * @param pit_result    array of iterators that receives the result.
+ * @return void.
+ * @remarks if cpset_set == NULL, cpv_values == NULL or pit_result == NULL then the behavior is undefined. cpset_set
+ *          must be initialized, otherwise the behavior is undefined. the array is same as set_insert_array(), but it
+ *          holds char* for c string element. each iterator in pit_result is same as set_find_ptr() of the element. the
+ *          elements are passed to the lookup in groups, so the cache misses of lookups are overlapped, but the c string
+ *          elements are found one by one.
+ */
+extern void set_find_batch(const set_t* cpset_set, const void* cpv_values, size_t t_count, set_iterator_t* pit_result);
+
+/**
+ * Inserts an unique element that is pointed by pointer into a set.
+ * @param pset_set    set container.
+ * @param cpv_value    pointer to specific element.
+ * @return iterator addresses the inserted element, or set_end() if the element is existed.
+ * @remarks if pset_set == NULL or cpv_value == NULL then the behavior is undefined. pset_set must be initialized, otherwise
+ *          the behavior is undefined. cpv_value points to the element, but it is char* for c string element.
+ */
+extern set_iterator_t set_insert_ptr(set_t* pset_set, const void* cpv_value);
+
+/**
+ * Erase elements from a set that match a element that is pointed by pointer.
+ * @param pset_set    set container.
+ * @param cpv_value    pointer to specific element.
+ * @return the number of erased elements.
+ * @remarks if pset_set == NULL or cpv_value == NULL then the behavior is undefined. pset_set must be initialized, otherwise
+ *          the behavior is undefined. cpv_value points to the element, but it is char* for c string element.
+ */
+extern size_t set_erase_ptr(set_t* pset_set, const void* cpv_value);
+
 #ifdef __cplusplus
 }
 #endif
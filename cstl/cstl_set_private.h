@@ -54,6 +54,26 @@ typedef struct _tagset
  */
 extern set_t* _create_set(const char* s_typename);
 
+/**
+ * Create set container that uses user defined allocator.
+ * @param cpt_allocator     user defined allocator.
+ * @param s_typename        element type name.
+ * @return if create set successfully return set pointer, otherwise return NULL.
+ * @remarks if cpt_allocator == NULL or s_typename == NULL, then the behavior is undefined. s_typename should be C
+ *          builtin type name, libcstl builtin typename or registed user defined type name, otherwise the function will
+ *          return NULL.
+ */
+extern set_t* _create_set_with_allocator(const allocator_t* cpt_allocator, const char* s_typename);
+
+/**
+ * Create set container that allocates memory from region.
+ * @param s_typename        element type name.
+ * @return if create set successfully return set pointer, otherwise return NULL.
+ * @remarks if s_typename == NULL, then the behavior is undefined. s_typename should be C builtin type name, libcstl
+ *          builtin typename or registed user defined type name, otherwise the function will return NULL.
+ */
+extern set_t* _create_set_with_region(const char* s_typename);
+
 /**
  * Create set container auxiliary function.
  * @param pset_set          uncreated container.
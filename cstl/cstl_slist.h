@@ -38,6 +38,28 @@ extern "C" {
  */
 #define create_slist(...) _create_slist(#__VA_ARGS__)
 
+/**
+ * Create slist container that allocates memory by user defined allocator.
+ * @param cpt_allocator  user defined allocator.
+ * @param ...            element type name.
+ * @return if create slist successfully return slist pointer, otherwise return NULL.
+ * @remarks if cpt_allocator == NULL, then the behavior is undefined. the allocator is used by all the memory of elements
+ *          and must be valid until the slist is destroyed. element type name should be C builtin type name, libcstl
+ *          builtin typename or registed user defined type name, otherwise the function will return NULL.
+ */
+#define create_slist_with_allocator(cpt_allocator, ...) _create_slist_with_allocator((cpt_allocator), #__VA_ARGS__)
+
+/**
+ * Create slist container that allocates memory from region.
+ * @param ...        element type name.
+ * @return if create slist successfully return slist pointer, otherwise return NULL.
+ * @remarks the memory of erased elements is not reused, slist_clear() and slist_destroy() release the whole region at
+ *          once, and the elements are not destroyed one by one if the element type need not be destroyed, such as C
+ *          builtin types except char*. element type name should be C builtin type name, libcstl builtin typename or
+ *          registed user defined type name, otherwise the function will return NULL.
+ */
+#define create_slist_with_region(...) _create_slist_with_region(#__VA_ARGS__)
+
 /**
  * Initialize slist with specified element.
  * @param pslist_slist   uninitialized slist container.
@@ -276,6 +298,16 @@ extern bool_t slist_empty(const slist_t* cpslist_slist);
  */
 extern size_t slist_max_size(const slist_t* cpslist_slist);
 
+/**
+ * Get the memory that is held by the slist.
+ * @param cpslist_slist   slist container.
+ * @return the bytes of slist structure, nodes and the memory cached by the allocator of slist.
+ * @remarks if cpslist_slist == NULL, then the behavior is undefined. cpslist_slist must be initialized, otherwise the
+ *          behavior is undefined. the memory that is owned by the elements themselves, such as the string of char* or
+ *          the nodes of nested container, is not counted.
+ */
+extern size_t slist_memory_usage(const slist_t* cpslist_slist);
+
 /**
  * Assign slist element with an exist slist container.
  * @param pslist_dest     destination slist container.
@@ -698,6 +730,17 @@ extern bool_t slist_greater(const slist_t* cpslist_first, const slist_t* cpslist
  */
 extern bool_t slist_greater_equal(const slist_t* cpslist_first, const slist_t* cpslist_second);
 
+/**
+ * Adds an element that is pointed by pointer to the begin of slist.
+ * @param pslist_slist    slist container.
+ * @param cpv_value    pointer to specific element.
+ * @return void.
+ * @remarks if pslist_slist == NULL or cpv_value == NULL, then the behavior is undefined. the slist must be initialized,
+ *          otherwise the behavior is undefined. cpv_value points to the element, but it is char* for c string element.
+ *          the element is copied without the variable argument list.
+ */
+extern void slist_push_front_ptr(slist_t* pslist_slist, const void* cpv_value);
+
 #ifdef __cplusplus
 }
 #endif
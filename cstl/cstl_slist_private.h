@@ -71,6 +71,26 @@ typedef struct _tagslist
  */
 extern slist_t* _create_slist(const char* s_typename);
 
+/**
+ * Create slist container that uses user defined allocator.
+ * @param cpt_allocator     user defined allocator.
+ * @param s_typename        element type name.
+ * @return if create slist successfully return slist pointer, otherwise return NULL.
+ * @remarks if cpt_allocator == NULL or s_typename == NULL, then the behavior is undefined. s_typename should be C
+ *          builtin type name, libcstl builtin typename or registed user defined type name, otherwise the function will
+ *          return NULL.
+ */
+extern slist_t* _create_slist_with_allocator(const allocator_t* cpt_allocator, const char* s_typename);
+
+/**
+ * Create slist container that allocates memory from region.
+ * @param s_typename        element type name.
+ * @return if create slist successfully return slist pointer, otherwise return NULL.
+ * @remarks if s_typename == NULL, then the behavior is undefined. s_typename should be C builtin type name, libcstl
+ *          builtin typename or registed user defined type name, otherwise the function will return NULL.
+ */
+extern slist_t* _create_slist_with_region(const char* s_typename);
+
 /**
  * Create slist container auxiliary function.
  * @param pslist_slist  slist container.
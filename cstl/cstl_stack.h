@@ -195,6 +195,17 @@ extern bool_t stack_greater(const stack_t* cpsk_first, const stack_t* cpsk_secon
  */
 extern bool_t stack_greater_equal(const stack_t* cpsk_first, const stack_t* cpsk_second);
 
+/**
+ * Adds an element that is pointed by pointer to the top of stack.
+ * @param psk_stack    stack adaptor.
+ * @param cpv_value    pointer to specific element.
+ * @return void.
+ * @remarks if psk_stack == NULL or cpv_value == NULL, then the behavior is undefined. the stack must be initialized,
+ *          otherwise the behavior is undefined. cpv_value points to the element, but it is char* for c string element.
+ *          the element is copied without the variable argument list.
+ */
+extern void stack_push_ptr(stack_t* psk_stack, const void* cpv_value);
+
 #ifdef __cplusplus
 }
 #endif
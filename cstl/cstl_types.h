@@ -152,15 +152,54 @@ typedef enum _tagtypestley
     _TYPE_INVALID = 0, _TYPE_C_BUILTIN, _TYPE_USER_DEFINE, _TYPE_CSTL_BUILTIN
 }_typestyle_t;
 
+/*
+ * Type id. Builtin types have fixed ids, user defined types are numbered from
+ * _TYPE_ID_USER_DEFINE in the order of register. Duplicated names share the id
+ * of the registered type, so compare the ids instead of the type names.
+ */
+typedef enum _tagtypeid
+{
+    _TYPE_ID_INVALID = 0,
+    /* c builtin type */
+    _TYPE_ID_CHAR, _TYPE_ID_UNSIGNED_CHAR, _TYPE_ID_SHORT, _TYPE_ID_UNSIGNED_SHORT,
+    _TYPE_ID_INT, _TYPE_ID_UNSIGNED_INT, _TYPE_ID_LONG, _TYPE_ID_UNSIGNED_LONG,
+    _TYPE_ID_FLOAT, _TYPE_ID_DOUBLE, _TYPE_ID_LONG_DOUBLE, _TYPE_ID_CSTL_BOOL,
+    _TYPE_ID_C_STRING, _TYPE_ID_POINTER, _TYPE_ID_BOOL, _TYPE_ID_LONG_LONG,
+    _TYPE_ID_UNSIGNED_LONG_LONG,
+    /* cstl builtin type */
+    _TYPE_ID_VECTOR, _TYPE_ID_LIST, _TYPE_ID_SLIST, _TYPE_ID_DEQUE, _TYPE_ID_STACK,
+    _TYPE_ID_QUEUE, _TYPE_ID_PRIORITY_QUEUE, _TYPE_ID_SET, _TYPE_ID_MAP, _TYPE_ID_MULTISET,
+    _TYPE_ID_MULTIMAP, _TYPE_ID_HASH_SET, _TYPE_ID_HASH_MAP, _TYPE_ID_HASH_MULTISET,
+    _TYPE_ID_HASH_MULTIMAP, _TYPE_ID_PAIR, _TYPE_ID_STRING, _TYPE_ID_RANGE,
+    _TYPE_ID_BASIC_STRING, _TYPE_ID_ITERATOR,
+    /* the first id of user defined type */
+    _TYPE_ID_USER_DEFINE
+}_typeid_t;
+
+/*
+ * type traits, the containers use bulk memory operations instead of invoking
+ * the type functions for each element when the type has those traits.
+ */
+#define _TYPE_TRAIT_TRIVIAL_INIT     0x01  /* initialize by filling zero */
+#define _TYPE_TRAIT_TRIVIAL_COPY     0x02  /* copy by copying memory */
+#define _TYPE_TRAIT_TRIVIAL_DESTROY  0x04  /* destroy does nothing */
+#define _TYPE_TRAIT_TRIVIAL_RELOCATE 0x08  /* relocate by copying memory */
+#define _TYPE_TRAIT_TRIVIAL          (_TYPE_TRAIT_TRIVIAL_INIT | _TYPE_TRAIT_TRIVIAL_COPY | _TYPE_TRAIT_TRIVIAL_DESTROY)
+
 typedef struct _tagtype
 {
     size_t               _t_typesize;                        /* type size */
     char                 _s_typename[_TYPE_NAME_SIZE + 1];   /* type name */
+    size_t               _t_typeid;                          /* type id */
     _typestyle_t         _t_style;                           /* type style */
+    int                  _n_typetrait;                       /* type traits */
     bfun_t               _t_typecopy;                        /* type copy function */
     bfun_t               _t_typeless;                        /* type less function */
     ufun_t               _t_typeinit;                        /* type initialize function */
     ufun_t               _t_typedestroy;                     /* type destroy function */
+    ufun_t               _t_typehash;                        /* type hash function */
+    bfun_t               _t_typecompare;                     /* optional three-way compare function */
+    bfun_t               _t_typemove;                        /* optional relocate function */
 }_type_t;
 
 /* type register node */
@@ -178,11 +217,12 @@ typedef struct _tagtyperegister
     bool_t               _t_isinit; /* is initializate for built in types */
     _typenode_t*         _apt_bucket[_TYPE_REGISTER_BUCKET_COUNT]; /* hash table */
     _alloc_t             _t_allocator;
+    size_t               _t_nexttypeid; /* the id for next user defined type */
 }_typeregister_t;
 
 typedef struct _tagtypeinfo
 {
-    char                 _s_typename[_TYPE_NAME_SIZE + 1];
+    const char*          _s_typename;  /* formal type name that is interned by register */
     _type_t*             _pt_type;
     _typestyle_t         _t_style;
 }_typeinfo_t;
@@ -192,6 +232,8 @@ typedef struct _tagtypeinfo
 /** exported function prototype section **/
 #define type_register(type, type_init, type_copy, type_less, type_destroy)\
     _type_register(sizeof(type), #type, (type_init), (type_copy), (type_less), (type_destroy))
+#define type_register_ex(type, type_init, type_copy, type_less, type_destroy, type_hash, type_compare)\
+    _type_register_ex(sizeof(type), #type, (type_init), (type_copy), (type_less), (type_destroy), (type_hash), (type_compare))
 #define type_unregister(type)\
     _type_unregister(sizeof(type), #type)
 #define type_duplicate(type1, type2)\
@@ -201,6 +243,11 @@ extern bool_t _type_register(
     size_t t_typesize, const char* s_typename,
     ufun_t t_typeinit, bfun_t t_typecopy,
     bfun_t t_typeless, ufun_t t_typedestroy);
+extern bool_t _type_register_ex(
+    size_t t_typesize, const char* s_typename,
+    ufun_t t_typeinit, bfun_t t_typecopy,
+    bfun_t t_typeless, ufun_t t_typedestroy, ufun_t t_typehash, bfun_t t_typecompare);
+extern bool_t _type_unregister(size_t t_typesize, const char* s_typename);
 extern bool_t _type_duplicate(
     size_t t_typesize1, const char* s_typename1,
     size_t t_typesize2, const char* s_typename2);
@@ -208,12 +255,21 @@ extern void _type_get_type(_typeinfo_t* pt_typeinfo, const char* s_typename);
 extern void _type_get_type_pair(_typeinfo_t* pt_typeinfofirst, _typeinfo_t* pt_typeinfosecond, const char* s_typename);
 extern bool_t _type_is_same(const char* s_typename1, const char* s_typename2);
 extern bool_t _type_is_same_ex(const _typeinfo_t* pt_first, const _typeinfo_t* pt_second);
+extern bool_t _type_is_trivially_initializable(const _typeinfo_t* cpt_typeinfo);
+extern bool_t _type_is_trivially_copyable(const _typeinfo_t* cpt_typeinfo);
+extern bool_t _type_is_trivially_destructible(const _typeinfo_t* cpt_typeinfo);
+extern bool_t _type_is_trivially_relocatable(const _typeinfo_t* cpt_typeinfo);
+extern bool_t _type_is_relocatable(const _typeinfo_t* cpt_typeinfo);
+extern void _type_relocate(const _typeinfo_t* cpt_typeinfo, void* pv_target, void* pv_source, size_t t_count);
+extern void _type_swap(const _typeinfo_t* cpt_typeinfo, void* pv_first, void* pv_second);
+extern size_t _type_hash_value(const _typeinfo_t* cpt_typeinfo, const void* cpv_value);
 extern void _type_get_varg_value(_typeinfo_t* pt_typeinfo, va_list val_elemlist, void* pv_output);
+extern void _type_get_ptr_value(_typeinfo_t* pt_typeinfo, const void* cpv_value, void* pv_output);
 extern void _type_get_elem_typename(const char* s_typename, char* s_elemtypename);
 
 extern void _type_debug(void);
 
-/* default initialize, copy, less, and destroy function */
+/* default initialize, copy, less, destroy and hash function */
 /* node: the pv_output is used for the size of default type, 
  * so invoke the copy, less, and destroy functions must be put the 
  * type size into the function through pv_output, even if is not used.
@@ -222,6 +278,7 @@ extern void _type_init_default(const void* cpv_input, void* pv_output);
 extern void _type_copy_default(const void* cpv_first, const void* cpv_second, void* pv_output);
 extern void _type_less_default(const void* cpv_first, const void* cpv_second, void* pv_output);
 extern void _type_destroy_default(const void* cpv_input, void* pv_output);
+extern void _type_hash_default(const void* cpv_input, void* pv_output);
 
 #ifdef __cplusplus
 }
@@ -38,6 +38,17 @@ extern "C" {
  */
 #define create_vector(...) _create_vector(#__VA_ARGS__) 
 
+/**
+ * Create vector container that allocates memory by user defined allocator.
+ * @param cpt_allocator  user defined allocator.
+ * @param ...            element type name.
+ * @return if create vector successfully return vector pointer, otherwise return NULL.
+ * @remarks if cpt_allocator == NULL, then the behavior is undefined. the allocator is used by all the memory of elements
+ *          and must be valid until the vector is destroyed. element type name should be C builtin type name, libcstl
+ *          builtin typename or registed user defined type name, otherwise the function will return NULL.
+ */
+#define create_vector_with_allocator(cpt_allocator, ...) _create_vector_with_allocator((cpt_allocator), #__VA_ARGS__)
+
 /**
  * Initialize vector container with mutiple specificed element.
  * @param pvec_vector    vector container.
@@ -208,6 +219,16 @@ extern bool_t vector_empty(const vector_t* cpvec_vector);
  */
 extern size_t vector_max_size(const vector_t* cpvec_vector);
 
+/**
+ * Get the memory that is held by the vector.
+ * @param cpvec_vector   vector container.
+ * @return the bytes of vector structure, elements and the memory cached by the allocator of vector.
+ * @remarks if cpvec_vector == NULL, then the behavior is undefined. cpvec_vector must be initialized, otherwise the
+ *          behavior is undefined. the memory that is owned by the elements themselves, such as the string of char* or
+ *          the nodes of nested container, is not counted.
+ */
+extern size_t vector_memory_usage(const vector_t* cpvec_vector);
+
 /**
  * Get vector capacity.
  * @param cpvec_vector   vector container.
@@ -228,6 +249,16 @@ extern size_t vector_capacity(const vector_t* cpvec_vector);
  */
 extern void vector_reserve(vector_t* pvec_vector, size_t t_reservesize);
 
+/**
+ * Reduce vector capacity to vector size.
+ * @param pvec_vector   vector container.
+ * @return void.
+ * @remarks if pvec_vector == NULL, then the behavior is undefined. pvec_vector must be initialized, otherwise the
+ *          behavior is undefined. the memory that is not used by elements is released, all iterators of vector are
+ *          invalid after shrinking.
+ */
+extern void vector_shrink_to_fit(vector_t* pvec_vector);
+
 /**
  * Test the two vectors are equal.
  * @param cpvec_first   first vector container.
@@ -472,6 +503,18 @@ extern void vector_clear(vector_t* pvec_vector);
  */
 extern void vector_resize(vector_t* pvec_vector, size_t t_resize);
 
+/**
+ * Adds an element that is pointed by pointer to the end of vector.
+ * @param pvec_vector    vector container.
+ * @param cpv_value    pointer to specific element.
+ * @return void.
+ * @remarks if pvec_vector == NULL or cpv_value == NULL, then the behavior is undefined. the vector must be initialized,
+ *          otherwise the behavior is undefined. cpv_value points to the element, but it is char* for c string element.
+ *          the element is copied without the variable argument list.
+ *          if cpv_value points to the element of vector, then the behavior is undefined.
+ */
+extern void vector_push_back_ptr(vector_t* pvec_vector, const void* cpv_value);
+
 #ifdef __cplusplus
 }
 #endif
@@ -69,6 +69,17 @@ typedef struct _tagvector
  */
 extern vector_t* _create_vector(const char* s_typename);
 
+/**
+ * Create vector container that uses user defined allocator.
+ * @param cpt_allocator     user defined allocator.
+ * @param s_typename        element type name.
+ * @return if create vector successfully return vector pointer, otherwise return NULL.
+ * @remarks if cpt_allocator == NULL or s_typename == NULL, then the behavior is undefined. s_typename should be C
+ *          builtin type name, libcstl builtin typename or registed user defined type name, otherwise the function will
+ *          return NULL.
+ */
+extern vector_t* _create_vector_with_allocator(const allocator_t* cpt_allocator, const char* s_typename);
+
 /**
  * Create vector container auxiliary function.
  * @param pvec_vector uncreated container.
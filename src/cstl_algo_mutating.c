@@ -107,10 +107,18 @@ void algo_iter_swap(forward_iterator_t it_first, forward_iterator_t it_second)
     assert(_iterator_limit_type(it_second, _FORWARD_ITERATOR));
     assert(_iterator_same_elem_type(it_first, it_second));
 
-    if (!iterator_equal(it_first, it_second)) {
+    if (iterator_equal(it_first, it_second)) {
+        return;
+    }
+
+    if (_iterator_elem_is_relocatable(it_first) && _iterator_elem_is_relocatable(it_second)) {
+        /* exchange the elements in place without copying the resources that they own */
+        _type_swap(_iterator_get_typeinfo(it_first),
+            (void*)_iterator_get_pointer_ignore_cstr(it_first), (void*)_iterator_get_pointer_ignore_cstr(it_second));
+    } else {
         pv_value = _iterator_allocate_init_elem(it_first);
 
-        if (strncmp(_iterator_get_typebasename(it_first), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+        if (_iterator_get_typeid(it_first) == _TYPE_ID_C_STRING) {
             string_assign_cstr((string_t*)pv_value, iterator_get_pointer(it_first));
             iterator_set_value(it_first, iterator_get_pointer(it_second));
             iterator_set_value(it_second, string_c_str((string_t*)pv_value));
@@ -159,7 +167,7 @@ output_iterator_t algo_transform(
 
     pv_value = _iterator_allocate_init_elem(it_first);
 
-    if (strncmp(_iterator_get_typebasename(it_first), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_iterator_get_typeid(it_first) == _TYPE_ID_C_STRING) {
         for (; !iterator_equal(it_first, it_last); it_first = iterator_next(it_first), it_result = iterator_next(it_result)) {
             string_assign_cstr((string_t*)pv_value, (char*)iterator_get_pointer(it_first));
             (*ufun_op)(iterator_get_pointer(it_first), (char*)string_c_str((string_t*)pv_value));
@@ -200,7 +208,7 @@ output_iterator_t algo_transform_binary(
 
     pv_value = _iterator_allocate_init_elem(it_first1);
 
-    if (strncmp(_iterator_get_typebasename(it_first1), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_iterator_get_typeid(it_first1) == _TYPE_ID_C_STRING) {
         for (;
              !iterator_equal(it_first1, it_last1);
              it_first1 = iterator_next(it_first1),
@@ -241,7 +249,7 @@ void algo_generate(forward_iterator_t it_first, forward_iterator_t it_last, ufun
 
     pv_value = _iterator_allocate_init_elem(it_first);
 
-    if (strncmp(_iterator_get_typebasename(it_first), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_iterator_get_typeid(it_first) == _TYPE_ID_C_STRING) {
         for (; !iterator_equal(it_first, it_last); it_first = iterator_next(it_first)) {
             string_assign_cstr((string_t*)pv_value, (char*)iterator_get_pointer(it_first));
             (*ufun_op)(string_c_str((string_t*)pv_value), (char*)string_c_str((string_t*)pv_value));
@@ -275,7 +283,7 @@ output_iterator_t algo_generate_n(output_iterator_t it_first, size_t t_count, uf
 
     pv_value = _iterator_allocate_init_elem(it_first);
 
-    if (strncmp(_iterator_get_typebasename(it_first), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_iterator_get_typeid(it_first) == _TYPE_ID_C_STRING) {
         for (i = 0; i < t_count; ++i, it_first = iterator_next(it_first)) {
             string_assign_cstr((string_t*)pv_value, (char*)iterator_get_pointer(it_first));
             (*ufun_op)(string_c_str((string_t*)pv_value), (char*)string_c_str((string_t*)pv_value));
@@ -64,7 +64,7 @@ void _algo_replace_once_varg(forward_iterator_t it_iter, va_list val_elemlist)
     assert(_iterator_limit_type(it_iter, _FORWARD_ITERATOR));
 
     _type_get_varg_value(_iterator_get_typeinfo(it_iter), val_elemlist, pv_value);
-    if (strncmp(_iterator_get_typebasename(it_iter), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_iterator_get_typeid(it_iter) == _TYPE_ID_C_STRING) {
         iterator_set_value(it_iter, string_c_str((string_t*)pv_value));
     } else {
         iterator_set_value(it_iter, pv_value);
@@ -103,7 +103,7 @@ void _algo_replace_if_varg(forward_iterator_t it_first, forward_iterator_t it_la
     pv_value = _iterator_allocate_init_elem(it_first);
     _type_get_varg_value(_iterator_get_typeinfo(it_first), val_elemlist, pv_value);
 
-    if (strncmp(_iterator_get_typebasename(it_first), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_iterator_get_typeid(it_first) == _TYPE_ID_C_STRING) {
         for (; !iterator_equal(it_first, it_last); it_first = iterator_next(it_first)) {
             (*ufun_op)(iterator_get_pointer(it_first), &b_result);
             if (b_result) {
@@ -159,7 +159,7 @@ output_iterator_t _algo_replace_copy_if_varg(
     pv_value = _iterator_allocate_init_elem(it_first);
     _type_get_varg_value(_iterator_get_typeinfo(it_first), val_elemlist, pv_value);
 
-    if (strncmp(_iterator_get_typebasename(it_first), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_iterator_get_typeid(it_first) == _TYPE_ID_C_STRING) {
         for (; !iterator_equal(it_first, it_last); it_first = iterator_next(it_first), it_result = iterator_next(it_result)) {
             (*ufun_op)(iterator_get_pointer(it_first), &b_cmp);
             if (b_cmp) {
@@ -209,7 +209,7 @@ void _algo_fill_varg(forward_iterator_t it_first, forward_iterator_t it_last, va
     pv_value = _iterator_allocate_init_elem(it_first);
     _type_get_varg_value(_iterator_get_typeinfo(it_first), val_elemlist, pv_value);
 
-    if (strncmp(_iterator_get_typebasename(it_first), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_iterator_get_typeid(it_first) == _TYPE_ID_C_STRING) {
         for (; !iterator_equal(it_first, it_last); it_first = iterator_next(it_first)) {
             iterator_set_value(it_first, string_c_str((string_t*)pv_value));
         }
@@ -249,7 +249,7 @@ output_iterator_t _algo_fill_n_varg(output_iterator_t it_first, size_t t_fillsiz
     pv_value = _iterator_allocate_init_elem(it_first);
     _type_get_varg_value(_iterator_get_typeinfo(it_first), val_elemlist, pv_value);
 
-    if (strncmp(_iterator_get_typebasename(it_first), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_iterator_get_typeid(it_first) == _TYPE_ID_C_STRING) {
         for (i = 0; i < t_fillsize; ++i, it_first = iterator_next(it_first)) {
             iterator_set_value(it_first, string_c_str((string_t*)pv_value));
         }
@@ -358,7 +358,7 @@ output_iterator_t _algo_remove_copy_varg(input_iterator_t it_first, input_iterat
             }
         }
     } else {
-        if (strncmp(_iterator_get_typebasename(it_first), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+        if (_iterator_get_typeid(it_first) == _TYPE_ID_C_STRING) {
             for (; !iterator_equal(it_first, it_last); it_first = iterator_next(it_first)) {
                 (*bfun_op)(iterator_get_pointer(it_first), string_c_str((string_t*)pv_value), &b_cmp);
                 if (!b_cmp) {
@@ -29,6 +29,8 @@
 #include <cstl/cfunctional.h>
 #include <cstl/calgorithm.h>
 
+#include "cstl_algo_sorting_aux.h"
+
 /** local constant declaration and local macro section **/
 
 /** local data type declaration and local struct, union, enum section **/
@@ -296,8 +298,7 @@ bool_t algo_equal_if(
     input_iterator_t it_first1, input_iterator_t it_last1, input_iterator_t it_first2, bfun_t bfun_op)
 {
     bool_t b_result = false;
-    bool_t b_less = false;
-    bool_t b_greater = false;
+    bfun_t bfun_compare = NULL;
 
     assert(_iterator_valid_range(it_first1, it_last1, _INPUT_ITERATOR));
     assert(_iterator_limit_type(it_first2, _INPUT_ITERATOR));
@@ -309,13 +310,9 @@ bool_t algo_equal_if(
 
     if (bfun_op == fun_default_binary) {
         bfun_op = _fun_get_binary(it_first1, _LESS_FUN);
+        bfun_compare = _fun_get_three_way_compare(it_first1, bfun_op);
         for (; !iterator_equal(it_first1, it_last1); it_first1 = iterator_next(it_first1), it_first2 = iterator_next(it_first2)) {
-            (*bfun_op)(iterator_get_pointer(it_first1), iterator_get_pointer(it_first2), &b_less);
-            if (b_less) {
-                return false;
-            }
-            (*bfun_op)(iterator_get_pointer(it_first2), iterator_get_pointer(it_first1), &b_greater);
-            if (b_greater) {
+            if (_algo_three_way_compare_if(it_first1, it_first2, bfun_op, bfun_compare) != 0) {
                 return false;
             }
         }
@@ -88,7 +88,7 @@ input_iterator_t _algo_find_varg(input_iterator_t it_first, input_iterator_t it_
             break;
         }
     } else {
-        if (strncmp(_iterator_get_typebasename(it_first), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+        if (_iterator_get_typeid(it_first) == _TYPE_ID_C_STRING) {
             for (; !iterator_equal(it_first, it_last); it_first = iterator_next(it_first)) {
                 (*bfun_op)(iterator_get_pointer(it_first), string_c_str((string_t*)pv_value), &b_result);
                 if (b_result) {
@@ -160,7 +160,7 @@ size_t _algo_count_varg(input_iterator_t it_first, input_iterator_t it_last, va_
             t_count++;
         }
     } else {
-        if (strncmp(_iterator_get_typebasename(it_first), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+        if (_iterator_get_typeid(it_first) == _TYPE_ID_C_STRING) {
             for (; !iterator_equal(it_first, it_last); it_first = iterator_next(it_first)) {
                 (*bfun_op)(iterator_get_pointer(it_first), string_c_str((string_t*)pv_value), &b_result);
                 if (b_result) {
@@ -270,7 +270,7 @@ forward_iterator_t _algo_search_n_if_varg(
             }
         }
     } else {
-        if (strncmp(_iterator_get_typebasename(it_first), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+        if (_iterator_get_typeid(it_first) == _TYPE_ID_C_STRING) {
             for (; !iterator_equal(it_first, it_last); it_first = iterator_next(it_first)) {
                 (*bfun_op)(iterator_get_pointer(it_first), string_c_str((string_t*)pv_value), &b_result);
                 if (b_result) {
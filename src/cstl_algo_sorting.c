@@ -374,7 +374,7 @@ void algo_nth_element_if(random_access_iterator_t it_first, random_access_iterat
 
     pv_value = _iterator_allocate_init_elem(it_first);
 
-    if (strncmp(_iterator_get_typebasename(it_first), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_iterator_get_typeid(it_first) == _TYPE_ID_C_STRING) {
         while (iterator_distance(it_first, it_last) > 3) {
             it_pivot = iterator_advance(it_first, iterator_distance(it_first, it_last) / 2);
             it_prev = iterator_prev(it_last);
@@ -476,7 +476,8 @@ bool_t algo_includes(input_iterator_t it_first1, input_iterator_t it_last1, inpu
  */
 bool_t algo_includes_if(input_iterator_t it_first1, input_iterator_t it_last1, input_iterator_t it_first2, input_iterator_t it_last2, bfun_t bfun_op)
 {
-    bool_t b_result = false;
+    int    n_cmp = 0;
+    bfun_t bfun_compare = NULL;
 
     assert(_iterator_valid_range(it_first1, it_last1, _INPUT_ITERATOR));
     assert(_iterator_valid_range(it_first2, it_last2, _INPUT_ITERATOR));
@@ -485,19 +486,17 @@ bool_t algo_includes_if(input_iterator_t it_first1, input_iterator_t it_last1, i
     if (bfun_op == NULL) {
         bfun_op = _fun_get_binary(it_first1, _LESS_FUN);
     }
+    bfun_compare = _fun_get_three_way_compare(it_first1, bfun_op);
 
     while (!iterator_equal(it_first1, it_last1) && !iterator_equal(it_first2, it_last2)) {
-        (*bfun_op)(iterator_get_pointer(it_first2), iterator_get_pointer(it_first1), &b_result);
-        if (b_result) {     /* *it_first2 < *it_first1 */
+        n_cmp = _algo_three_way_compare_if(it_first1, it_first2, bfun_op, bfun_compare);
+        if (n_cmp > 0) {            /* *it_first2 < *it_first1 */
             return false;
-        } else {
-            (*bfun_op)(iterator_get_pointer(it_first1), iterator_get_pointer(it_first2), &b_result);
-            if (b_result){  /* *it_first1 < *it_first2 */
-                it_first1 = iterator_next(it_first1);
-            } else {        /* *it_first1 == *it_first2 */
-                it_first1 = iterator_next(it_first1);
-                it_first2 = iterator_next(it_first2);
-            }
+        } else if (n_cmp < 0) {     /* *it_first1 < *it_first2 */
+            it_first1 = iterator_next(it_first1);
+        } else {                    /* *it_first1 == *it_first2 */
+            it_first1 = iterator_next(it_first1);
+            it_first2 = iterator_next(it_first2);
         }
     }
 
@@ -524,7 +523,8 @@ output_iterator_t algo_set_union_if(
     input_iterator_t it_first2, input_iterator_t it_last2,
     output_iterator_t it_result, bfun_t bfun_op)
 {
-    bool_t b_cmp = false;
+    int    n_cmp = 0;
+    bfun_t bfun_compare = NULL;
 
     assert(_iterator_valid_range(it_first1, it_last1, _INPUT_ITERATOR));
     assert(_iterator_valid_range(it_first2, it_last2, _INPUT_ITERATOR));
@@ -535,21 +535,19 @@ output_iterator_t algo_set_union_if(
     if (bfun_op == NULL) {
         bfun_op = _fun_get_binary(it_first1, _LESS_FUN);
     }
+    bfun_compare = _fun_get_three_way_compare(it_first1, bfun_op);
     while (!iterator_equal(it_first1, it_last1) && !iterator_equal(it_first2, it_last2)) {
-        (*bfun_op)(iterator_get_pointer(it_first1), iterator_get_pointer(it_first2), &b_cmp);
-        if (b_cmp) {        /* it_first1 < it_first2 */
+        n_cmp = _algo_three_way_compare_if(it_first1, it_first2, bfun_op, bfun_compare);
+        if (n_cmp < 0) {            /* it_first1 < it_first2 */
             iterator_set_value(it_result, iterator_get_pointer(it_first1));
             it_first1 = iterator_next(it_first1);
-        } else {
-            (*bfun_op)(iterator_get_pointer(it_first2), iterator_get_pointer(it_first1), &b_cmp);
-            if (b_cmp) {    /* it_first2 < it_first1 */
-                iterator_set_value(it_result, iterator_get_pointer(it_first2));
-                it_first2 = iterator_next(it_first2);
-            } else {        /* it_first1 == it_first2 */
-                iterator_set_value(it_result, iterator_get_pointer(it_first1));
-                it_first1 = iterator_next(it_first1);
-                it_first2 = iterator_next(it_first2);
-            }
+        } else if (n_cmp > 0) {     /* it_first2 < it_first1 */
+            iterator_set_value(it_result, iterator_get_pointer(it_first2));
+            it_first2 = iterator_next(it_first2);
+        } else {                    /* it_first1 == it_first2 */
+            iterator_set_value(it_result, iterator_get_pointer(it_first1));
+            it_first1 = iterator_next(it_first1);
+            it_first2 = iterator_next(it_first2);
         }
         it_result = iterator_next(it_result);
     }
@@ -578,7 +576,8 @@ output_iterator_t algo_set_intersection_if(
     input_iterator_t it_first2, input_iterator_t it_last2,
     output_iterator_t it_result, bfun_t bfun_op)
 {
-    bool_t b_cmp = false;
+    int    n_cmp = 0;
+    bfun_t bfun_compare = NULL;
 
     assert(_iterator_valid_range(it_first1, it_last1, _INPUT_ITERATOR));
     assert(_iterator_valid_range(it_first2, it_last2, _INPUT_ITERATOR));
@@ -589,20 +588,18 @@ output_iterator_t algo_set_intersection_if(
     if (bfun_op == NULL) {
         bfun_op = _fun_get_binary(it_first1, _LESS_FUN);
     }
+    bfun_compare = _fun_get_three_way_compare(it_first1, bfun_op);
     while (!iterator_equal(it_first1, it_last1) && !iterator_equal(it_first2, it_last2)) {
-        (*bfun_op)(iterator_get_pointer(it_first1), iterator_get_pointer(it_first2), &b_cmp);
-        if (b_cmp) {        /* it_first1 < it_first2 */
+        n_cmp = _algo_three_way_compare_if(it_first1, it_first2, bfun_op, bfun_compare);
+        if (n_cmp < 0) {            /* it_first1 < it_first2 */
             it_first1 = iterator_next(it_first1);
-        } else {
-            (*bfun_op)(iterator_get_pointer(it_first2), iterator_get_pointer(it_first1), &b_cmp);
-            if (b_cmp) {    /* it_first2 < it_first1 */
-                it_first2 = iterator_next(it_first2);
-            } else {        /* it_first1 == it_first2 */
-                iterator_set_value(it_result, iterator_get_pointer(it_first1));
-                it_first1 = iterator_next(it_first1);
-                it_first2 = iterator_next(it_first2);
-                it_result = iterator_next(it_result);
-            }
+        } else if (n_cmp > 0) {     /* it_first2 < it_first1 */
+            it_first2 = iterator_next(it_first2);
+        } else {                    /* it_first1 == it_first2 */
+            iterator_set_value(it_result, iterator_get_pointer(it_first1));
+            it_first1 = iterator_next(it_first1);
+            it_first2 = iterator_next(it_first2);
+            it_result = iterator_next(it_result);
         }
     }
 
@@ -630,7 +627,8 @@ output_iterator_t algo_set_difference_if(
     input_iterator_t it_first2, input_iterator_t it_last2,
     output_iterator_t it_result, bfun_t bfun_op)
 {
-    bool_t b_cmp = false;
+    int    n_cmp = 0;
+    bfun_t bfun_compare = NULL;
 
     assert(_iterator_valid_range(it_first1, it_last1, _INPUT_ITERATOR));
     assert(_iterator_valid_range(it_first2, it_last2, _INPUT_ITERATOR));
@@ -641,20 +639,18 @@ output_iterator_t algo_set_difference_if(
     if (bfun_op == NULL) {
         bfun_op = _fun_get_binary(it_first1, _LESS_FUN);
     }
+    bfun_compare = _fun_get_three_way_compare(it_first1, bfun_op);
     while (!iterator_equal(it_first1, it_last1) && !iterator_equal(it_first2, it_last2)) {
-        (*bfun_op)(iterator_get_pointer(it_first1), iterator_get_pointer(it_first2), &b_cmp);
-        if (b_cmp) {        /* it_first1 < it_first2 */
+        n_cmp = _algo_three_way_compare_if(it_first1, it_first2, bfun_op, bfun_compare);
+        if (n_cmp < 0) {            /* it_first1 < it_first2 */
             iterator_set_value(it_result, iterator_get_pointer(it_first1));
             it_first1 = iterator_next(it_first1);
             it_result = iterator_next(it_result);
-        } else {
-            (*bfun_op)(iterator_get_pointer(it_first2), iterator_get_pointer(it_first1), &b_cmp);
-            if (b_cmp) {    /* it_first2 < it_first1 */
-                it_first2 = iterator_next(it_first2);
-            } else {        /* it_first1 == it_first2 */
-                it_first1 = iterator_next(it_first1);
-                it_first2 = iterator_next(it_first2);
-            }
+        } else if (n_cmp > 0) {     /* it_first2 < it_first1 */
+            it_first2 = iterator_next(it_first2);
+        } else {                    /* it_first1 == it_first2 */
+            it_first1 = iterator_next(it_first1);
+            it_first2 = iterator_next(it_first2);
         }
     }
 
@@ -682,7 +678,8 @@ output_iterator_t algo_set_symmetric_difference_if(
     input_iterator_t it_first2, input_iterator_t it_last2,
     output_iterator_t it_result, bfun_t bfun_op)
 {
-    bool_t b_cmp = false;
+    int    n_cmp = 0;
+    bfun_t bfun_compare = NULL;
 
     assert(_iterator_valid_range(it_first1, it_last1, _INPUT_ITERATOR));
     assert(_iterator_valid_range(it_first2, it_last2, _INPUT_ITERATOR));
@@ -693,22 +690,20 @@ output_iterator_t algo_set_symmetric_difference_if(
     if (bfun_op == NULL) {
         bfun_op = _fun_get_binary(it_first1, _LESS_FUN);
     }
+    bfun_compare = _fun_get_three_way_compare(it_first1, bfun_op);
     while (!iterator_equal(it_first1, it_last1) && !iterator_equal(it_first2, it_last2)) {
-        (*bfun_op)(iterator_get_pointer(it_first1), iterator_get_pointer(it_first2), &b_cmp);
-        if (b_cmp) {        /* it_first1 < it_first2 */
+        n_cmp = _algo_three_way_compare_if(it_first1, it_first2, bfun_op, bfun_compare);
+        if (n_cmp < 0) {            /* it_first1 < it_first2 */
             iterator_set_value(it_result, iterator_get_pointer(it_first1));
             it_first1 = iterator_next(it_first1);
             it_result = iterator_next(it_result);
-        } else {
-            (*bfun_op)(iterator_get_pointer(it_first2), iterator_get_pointer(it_first1), &b_cmp);
-            if (b_cmp) {    /* it_first2 < it_first1 */
-                iterator_set_value(it_result, iterator_get_pointer(it_first2));
-                it_first2 = iterator_next(it_first2);
-                it_result = iterator_next(it_result);
-            } else {        /* it_first1 == it_first2 */
-                it_first1 = iterator_next(it_first1);
-                it_first2 = iterator_next(it_first2);
-            }
+        } else if (n_cmp > 0) {     /* it_first2 < it_first1 */
+            iterator_set_value(it_result, iterator_get_pointer(it_first2));
+            it_first2 = iterator_next(it_first2);
+            it_result = iterator_next(it_result);
+        } else {                    /* it_first1 == it_first2 */
+            it_first1 = iterator_next(it_first1);
+            it_first2 = iterator_next(it_first2);
         }
     }
 
@@ -114,7 +114,7 @@ void _algo_insertion_sort_if(random_access_iterator_t it_first, random_access_it
         return;
     }
 
-    if (strncmp(_iterator_get_typebasename(it_first), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_iterator_get_typeid(it_first) == _TYPE_ID_C_STRING) {
         for (it_bound = iterator_next(it_first); !iterator_equal(it_bound, it_last); it_bound = iterator_next(it_bound)) {
             string_assign_cstr((string_t*)pv_value, (char*)iterator_get_pointer(it_bound));
             (*bfun_op)(string_c_str((string_t*)pv_value), iterator_get_pointer(it_first), &b_result);
@@ -194,7 +194,7 @@ void _algo_intro_sort_if(
     it_pivot = _algo_median_of_three_if(it_first, it_pivot, it_prev, bfun_op);
 
     /* the pv_value must be string_t type when the container type is char* */
-    if (strncmp(_iterator_get_typebasename(it_first), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_iterator_get_typeid(it_first) == _TYPE_ID_C_STRING) {
         string_assign_cstr((string_t*)pv_value, (char*)iterator_get_pointer(it_pivot));
         it_begin = it_first;
         it_end = it_last;
@@ -260,5 +260,30 @@ void _algo_intro_sort_if(
     _algo_intro_sort_if(it_pivot, it_last, bfun_op, t_depth, pv_value);
 }
 
+/**
+ * Three-way compare the elements that two iterators address.
+ */
+int _algo_three_way_compare_if(
+    input_iterator_t it_first, input_iterator_t it_second, bfun_t bfun_op, bfun_t bfun_compare)
+{
+    int    n_result = 0;
+    bool_t b_result = false;
+
+    assert(bfun_op != NULL);
+
+    if (bfun_compare != NULL) {
+        (*bfun_compare)(_iterator_get_pointer_ignore_cstr(it_first), _iterator_get_pointer_ignore_cstr(it_second), &n_result);
+        return n_result;
+    }
+
+    (*bfun_op)(iterator_get_pointer(it_first), iterator_get_pointer(it_second), &b_result);
+    if (b_result) {
+        return -1;
+    }
+    (*bfun_op)(iterator_get_pointer(it_second), iterator_get_pointer(it_first), &b_result);
+
+    return b_result ? 1 : 0;
+}
+
 /** eof **/
 
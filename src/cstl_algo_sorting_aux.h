@@ -79,6 +79,20 @@ extern void _algo_insertion_sort_if(random_access_iterator_t it_first, random_ac
 extern void _algo_intro_sort_if(
     random_access_iterator_t it_first, random_access_iterator_t it_last, bfun_t bfun_op, size_t t_depth, void* pv_value);
 
+/**
+ * Three-way compare the elements that two iterators address.
+ * @param it_first      An input iterator addressing the first element.
+ * @param it_second     An input iterator addressing the second element.
+ * @param bfun_op       User-defined predicate function object that defines the ordering of elements.
+ * @param bfun_compare  Three-way compare function that agrees with bfun_op, or NULL.
+ * @return  Negative if the first element is less than the second element, positive if the second element is less
+ *          than the first element, otherwise zero.
+ * @remarks bfun_compare is invoked once if it is not NULL, otherwise bfun_op is invoked at most twice. The two iterators
+ *          must be point element that have same type, otherwise the behavior is undefined.
+ */
+extern int _algo_three_way_compare_if(
+    input_iterator_t it_first, input_iterator_t it_second, bfun_t bfun_op, bfun_t bfun_compare);
+
 #ifdef __cplusplus
 }
 #endif
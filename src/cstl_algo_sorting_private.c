@@ -92,7 +92,7 @@ forward_iterator_t _algo_lower_bound_if_varg(forward_iterator_t it_first, forwar
     pv_value = _iterator_allocate_init_elem(it_first);
     _type_get_varg_value(_iterator_get_typeinfo(it_first), val_elemlist, pv_value);
 
-    if (strncmp(_iterator_get_typebasename(it_first), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_iterator_get_typeid(it_first) == _TYPE_ID_C_STRING) {
         t_len = iterator_distance(it_first, it_last);
         while (t_len > 0) {
             t_halflen = t_len >> 1;
@@ -180,7 +180,7 @@ forward_iterator_t _algo_upper_bound_if_varg(forward_iterator_t it_first, forwar
     pv_value = _iterator_allocate_init_elem(it_first);
     _type_get_varg_value(_iterator_get_typeinfo(it_first), val_elemlist, pv_value);
 
-    if (strncmp(_iterator_get_typebasename(it_first), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_iterator_get_typeid(it_first) == _TYPE_ID_C_STRING) {
         t_len = iterator_distance(it_first, it_last);
         while (t_len > 0) {
             t_halflen = t_len >> 1;
@@ -277,7 +277,7 @@ range_t _algo_equal_range_if_varg(forward_iterator_t it_first, forward_iterator_
     va_copy(val_elemlist_copy, val_elemlist);
     _type_get_varg_value(_iterator_get_typeinfo(it_first), val_elemlist, pv_value);
 
-    if (strncmp(_iterator_get_typebasename(it_first), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_iterator_get_typeid(it_first) == _TYPE_ID_C_STRING) {
         t_len = iterator_distance(it_first, it_last);
         while (t_len > 0) {
             t_halflen = t_len >> 1;
@@ -414,7 +414,7 @@ bool_t _algo_binary_search_if_varg(forward_iterator_t it_first, forward_iterator
     pv_value = _iterator_allocate_init_elem(it_first);
     _type_get_varg_value(_iterator_get_typeinfo(it_first), val_elemlist, pv_value);
 
-    if (strncmp(_iterator_get_typebasename(it_first), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_iterator_get_typeid(it_first) == _TYPE_ID_C_STRING) {
         b_result = iterator_equal(it_lower, it_last) ?
             false : ((*bfun_op)(string_c_str((string_t*)pv_value), iterator_get_pointer(it_lower), &b_cmp), !b_cmp);
     } else {
@@ -45,29 +45,20 @@
  */
 void _alloc_init(_alloc_t* pt_allocator)
 {
-    size_t i = 0;
-
     assert(pt_allocator != NULL);
 
-    pt_allocator->_t_mempoolsize = 0;
-    pt_allocator->_t_mempoolindex = 0;
-    pt_allocator->_pby_mempool = NULL;
-    
-    for (i = 0; i < _MEM_LINK_COUNT; ++i) {
-        pt_allocator->_apt_memlink[i] = NULL;
-    }
-
-    /* initialize memory pool */
-    pt_allocator->_t_mempoolcount = _MEM_POOL_DEFAULT_COUNT;
-    pt_allocator->_ppby_mempoolcontainer = (_byte_t**)malloc(pt_allocator->_t_mempoolcount * sizeof(_byte_t*));
-    if (pt_allocator->_ppby_mempoolcontainer != NULL) {
-        for (i = 0; i < pt_allocator->_t_mempoolcount; ++i) {
-            pt_allocator->_ppby_mempoolcontainer[i] = NULL;
-        }
-    } else {
-        fprintf(stderr, "CSTL FATAL ERROR: memory allocation error!\n");
-        exit(EXIT_FAILURE);
-    }
+#ifdef CSTL_MEMORY_SHARED_POOL
+    /* the allocator of container has no memory pool, all memory is allocated from the shared memory pool */
+    memset(pt_allocator, 0x00, sizeof(_alloc_t));
+#else
+    _alloc_init_pool(pt_allocator);
+    pt_allocator->_t_livesize = 0;
+    pt_allocator->_t_highsize = 0;
+#ifdef CSTL_MEMORY_CLASS_STAT
+    memset(pt_allocator->_at_memclass, 0x00, sizeof(pt_allocator->_at_memclass));
+#endif
+    pt_allocator->_pt_ext = NULL;
+#endif
 }
 
 /**
@@ -75,26 +66,39 @@ void _alloc_init(_alloc_t* pt_allocator)
  */
 void _alloc_destroy(_alloc_t* pt_allocator)
 {
-    size_t i = 0;
-
     assert(pt_allocator != NULL);
 
-    /* destroy memory pool */
-    for (i = 0; i < pt_allocator->_t_mempoolcount; ++i) {
-        free(pt_allocator->_ppby_mempoolcontainer[i]);
-        pt_allocator->_ppby_mempoolcontainer[i] = NULL;
-    }
-    free(pt_allocator->_ppby_mempoolcontainer);
-    pt_allocator->_ppby_mempoolcontainer = NULL;
-
-    for (i = 0; i < _MEM_LINK_COUNT; ++i) {
-        pt_allocator->_apt_memlink[i] = NULL;
-    }
+    _alloc_release_region(pt_allocator);
+    _alloc_destroy_ext(pt_allocator);
+#ifdef CSTL_MEMORY_SHARED_POOL
+    /* the memory released by container is kept in shared memory pool for other containers */
+    memset(pt_allocator, 0x00, sizeof(_alloc_t));
+#else
+    _alloc_destroy_pool(pt_allocator);
+    pt_allocator->_t_livesize = 0;
+    pt_allocator->_t_highsize = 0;
+#ifdef CSTL_MEMORY_CLASS_STAT
+    memset(pt_allocator->_at_memclass, 0x00, sizeof(pt_allocator->_at_memclass));
+#endif
+#endif
+}
 
-    pt_allocator->_pby_mempool = NULL;
-    pt_allocator->_t_mempoolindex = 0;
-    pt_allocator->_t_mempoolsize = 0;
-    pt_allocator->_t_mempoolcount = 0;
+/**
+ * Use user defined allocator instead of the libcstl memory management.
+ */
+void _alloc_set_allocator(_alloc_t* pt_allocator, const allocator_t* cpt_custom)
+{
+    assert(pt_allocator != NULL);
+    assert(cpt_custom != NULL);
+    assert(cpt_custom->_pfun_allocate != NULL && cpt_custom->_pfun_deallocate != NULL);
+    assert(_alloc_is_inited(pt_allocator));
+    assert(!_alloc_is_region(pt_allocator));
+
+#ifndef CSTL_MEMORY_SHARED_POOL
+    /* the memory pool of container is useless, all memory is allocated from user defined allocator */
+    _alloc_destroy_pool(pt_allocator);
+#endif
+    _alloc_get_ext(pt_allocator)->_t_custom = *cpt_custom;
 }
 
 /**
@@ -102,24 +106,53 @@ void _alloc_destroy(_alloc_t* pt_allocator)
  */
 void* _alloc_allocate(_alloc_t* pt_allocator, size_t t_size, size_t t_count)
 {
-    void*       pv_allocmem = NULL;               /* allocated memory pointer */
-    _memlink_t* pt_link = NULL;                   /* memory link */
-    size_t      t_allocsize = t_size * t_count;   /* allocated memory size */
+    void*        pv_allocmem = NULL;               /* allocated memory pointer */
+    _memlink_t*  pt_link = NULL;                   /* memory link */
+    _alloc_t*    pt_pool = pt_allocator;           /* the allocator that owns memory list */
+    _allocext_t* pt_ext = NULL;
+    size_t       t_allocsize = t_size * t_count;   /* allocated memory size */
+    size_t       t_index = 0;
 
     assert(pt_allocator != NULL);
 
-    if (t_allocsize > _MEM_SMALL_MEM_SIZE_MAX) {
+    pt_ext = pt_allocator->_pt_ext;
+    if (pt_ext != NULL && pt_ext->_t_custom._pfun_allocate != NULL) {
+        pv_allocmem = pt_ext->_t_custom._pfun_allocate(pt_ext->_t_custom._pv_context, t_allocsize);
+        assert(pv_allocmem != NULL);
+    } else if (pt_ext != NULL && pt_ext->_b_region) {
+        pv_allocmem = _alloc_allocate_from_region(pt_allocator, t_allocsize);
+    } else if (t_allocsize > _MEM_SMALL_MEM_SIZE_MAX) {
         pv_allocmem = _alloc_malloc(t_allocsize);
         assert(pv_allocmem != NULL);
     } else {
-        pt_link = pt_allocator->_apt_memlink[_MEM_LINK_INDEX(t_allocsize)];
+        t_index = _MEM_LINK_INDEX(t_allocsize);
+#ifdef CSTL_MEMORY_THREAD_CACHE
+        pv_allocmem = _alloc_thread_cache_allocate(t_allocsize);
+#else
+#ifdef CSTL_MEMORY_SHARED_POOL
+        pt_pool = _alloc_get_shared_pool();
+#endif
+        pt_link = pt_pool->_apt_memlink[t_index];
         if (pt_link == NULL) {
-            _alloc_apply_formated_memory(pt_allocator, _MEM_ROUND_UP(t_allocsize));
-            pt_link = pt_allocator->_apt_memlink[_MEM_LINK_INDEX(t_allocsize)];
+            _alloc_apply_formated_memory(pt_pool, _MEM_LINK_SIZE(t_index));
+            pt_link = pt_pool->_apt_memlink[t_index];
             assert(pt_link != NULL);
         }
-        pt_allocator->_apt_memlink[_MEM_LINK_INDEX(t_allocsize)] = pt_link->_pui_nextmem;
+        pt_pool->_apt_memlink[t_index] = pt_link->_pui_nextmem;
         pv_allocmem = (void*)pt_link;
+#endif
+        /* the small memory is counted by the size of memory block */
+        t_allocsize = _MEM_LINK_SIZE(t_index);
+#ifdef CSTL_MEMORY_CLASS_STAT
+        if (++pt_allocator->_at_memclass[t_index]._t_livecount > pt_allocator->_at_memclass[t_index]._t_highcount) {
+            pt_allocator->_at_memclass[t_index]._t_highcount = pt_allocator->_at_memclass[t_index]._t_livecount;
+        }
+#endif
+    }
+
+    pt_allocator->_t_livesize += t_allocsize;
+    if (pt_allocator->_t_livesize > pt_allocator->_t_highsize) {
+        pt_allocator->_t_highsize = pt_allocator->_t_livesize;
     }
 
     return pv_allocmem;
@@ -130,16 +163,68 @@ void* _alloc_allocate(_alloc_t* pt_allocator, size_t t_size, size_t t_count)
  */
 void _alloc_deallocate(_alloc_t* pt_allocator, void* pv_allocmem, size_t t_size, size_t t_count)
 {
-    size_t t_allocsize = t_size * t_count; /* allocated memory size */
+    _alloc_t*    pt_pool = pt_allocator;           /* the allocator that owns memory list */
+    _allocext_t* pt_ext = NULL;
+    size_t       t_allocsize = t_size * t_count;   /* allocated memory size */
+    size_t       t_index = 0;
 
     assert(pt_allocator != NULL);
     assert(pv_allocmem != NULL);
 
-    if (t_allocsize > _MEM_SMALL_MEM_SIZE_MAX) {
+    pt_ext = pt_allocator->_pt_ext;
+    /* the memory in region is released with the whole region */
+    if (pt_ext != NULL && pt_ext->_b_region) {
+        return;
+    }
+
+    if (pt_ext != NULL && pt_ext->_t_custom._pfun_deallocate != NULL) {
+        pt_ext->_t_custom._pfun_deallocate(pt_ext->_t_custom._pv_context, pv_allocmem, t_allocsize);
+    } else if (t_allocsize > _MEM_SMALL_MEM_SIZE_MAX) {
         _alloc_free(pv_allocmem);
     } else {
-        ((_memlink_t*)pv_allocmem)->_pui_nextmem = pt_allocator->_apt_memlink[_MEM_LINK_INDEX(t_allocsize)];
-        pt_allocator->_apt_memlink[_MEM_LINK_INDEX(t_allocsize)] = ((_memlink_t*)pv_allocmem);
+        t_index = _MEM_LINK_INDEX(t_allocsize);
+#ifdef CSTL_MEMORY_THREAD_CACHE
+        _alloc_thread_cache_deallocate(pv_allocmem, t_allocsize);
+#else
+#ifdef CSTL_MEMORY_SHARED_POOL
+        pt_pool = _alloc_get_shared_pool();
+#endif
+        ((_memlink_t*)pv_allocmem)->_pui_nextmem = pt_pool->_apt_memlink[t_index];
+        pt_pool->_apt_memlink[t_index] = ((_memlink_t*)pv_allocmem);
+#endif
+        t_allocsize = _MEM_LINK_SIZE(t_index);
+#ifdef CSTL_MEMORY_CLASS_STAT
+        assert(pt_allocator->_at_memclass[t_index]._t_livecount > 0);
+        pt_allocator->_at_memclass[t_index]._t_livecount--;
+#endif
+    }
+
+    assert(pt_allocator->_t_livesize >= t_allocsize);
+    pt_allocator->_t_livesize -= t_allocsize;
+}
+
+/**
+ * Get the memory statistics of one size class.
+ */
+void _alloc_get_class_stat(const _alloc_t* cpt_allocator, size_t t_index, _memclassstat_t* pt_stat)
+{
+    _memlink_t* pt_link = NULL;
+
+    assert(cpt_allocator != NULL);
+    assert(pt_stat != NULL);
+    assert(t_index < _MEM_LINK_COUNT);
+
+    pt_stat->_t_blocksize = _MEM_LINK_SIZE(t_index);
+#ifdef CSTL_MEMORY_CLASS_STAT
+    pt_stat->_t_livecount = cpt_allocator->_at_memclass[t_index]._t_livecount;
+    pt_stat->_t_highcount = cpt_allocator->_at_memclass[t_index]._t_highcount;
+#else
+    pt_stat->_t_livecount = 0;
+    pt_stat->_t_highcount = 0;
+#endif
+    pt_stat->_t_cachedcount = 0;
+    for (pt_link = cpt_allocator->_apt_memlink[t_index]; pt_link != NULL; pt_link = pt_link->_pui_nextmem) {
+        pt_stat->_t_cachedcount++;
     }
 }
 
@@ -163,6 +248,27 @@ bool_t _alloc_is_inited(const _alloc_t* cpt_allocator)
         }
     }
 
+    if (cpt_allocator->_pt_ext != NULL) {
+        if (cpt_allocator->_pt_ext->_pby_regionblock != NULL || cpt_allocator->_pt_ext->_pby_regionpos != NULL ||
+            cpt_allocator->_pt_ext->_pby_regionend != NULL) {
+            return false;
+        }
+
+#ifndef CSTL_MEMORY_SHARED_POOL
+        /* the allocator that uses user defined allocator or region has no memory pool */
+        if (cpt_allocator->_pt_ext->_t_custom._pfun_allocate != NULL || cpt_allocator->_pt_ext->_b_region) {
+            return cpt_allocator->_t_mempoolcount == 0 && cpt_allocator->_ppby_mempoolcontainer == NULL;
+        }
+#endif
+    }
+
+#ifdef CSTL_MEMORY_SHARED_POOL
+    if (cpt_allocator->_t_mempoolcount != 0 || cpt_allocator->_ppby_mempoolcontainer != NULL) {
+        return false;
+    }
+
+    return true;
+#else
     if (cpt_allocator->_t_mempoolcount != _MEM_POOL_DEFAULT_COUNT || cpt_allocator->_ppby_mempoolcontainer == NULL) {
         return false;
     }
@@ -174,6 +280,7 @@ bool_t _alloc_is_inited(const _alloc_t* cpt_allocator)
     }
 
     return true;
+#endif /* CSTL_MEMORY_SHARED_POOL */
 }
 #endif /* NDEBUG */
 
@@ -184,7 +291,11 @@ bool_t _alloc_is_inited(const _alloc_t* cpt_allocator)
  */
 void _alloc_init(_alloc_t* pt_allocator)
 {
-    pt_allocator = NULL;
+    assert(pt_allocator != NULL);
+
+    pt_allocator->_t_livesize = 0;
+    pt_allocator->_t_highsize = 0;
+    pt_allocator->_pt_ext = NULL;
 }
 
 /**
@@ -192,7 +303,25 @@ void _alloc_init(_alloc_t* pt_allocator)
  */
 void _alloc_destroy(_alloc_t* pt_allocator)
 {
-    pt_allocator = NULL;
+    assert(pt_allocator != NULL);
+
+    _alloc_release_region(pt_allocator);
+    _alloc_destroy_ext(pt_allocator);
+    pt_allocator->_t_livesize = 0;
+    pt_allocator->_t_highsize = 0;
+}
+
+/**
+ * Use user defined allocator instead of the libcstl memory management.
+ */
+void _alloc_set_allocator(_alloc_t* pt_allocator, const allocator_t* cpt_custom)
+{
+    assert(pt_allocator != NULL);
+    assert(cpt_custom != NULL);
+    assert(cpt_custom->_pfun_allocate != NULL && cpt_custom->_pfun_deallocate != NULL);
+    assert(!_alloc_is_region(pt_allocator));
+
+    _alloc_get_ext(pt_allocator)->_t_custom = *cpt_custom;
 }
 
 /**
@@ -200,11 +329,30 @@ void _alloc_destroy(_alloc_t* pt_allocator)
  */
 void* _alloc_allocate(_alloc_t* pt_allocator, size_t t_size, size_t t_count)
 {
+    void*        pv_allocmem = NULL;
+    _allocext_t* pt_ext = NULL;
     /* total allocated memory size */
-    size_t t_allocsize = t_size * t_count;
+    size_t       t_allocsize = t_size * t_count;
+
+    if (pt_allocator == NULL) {
+        return _alloc_malloc(t_allocsize);
+    }
+
+    pt_ext = pt_allocator->_pt_ext;
+    if (pt_ext != NULL && pt_ext->_t_custom._pfun_allocate != NULL) {
+        pv_allocmem = pt_ext->_t_custom._pfun_allocate(pt_ext->_t_custom._pv_context, t_allocsize);
+    } else if (pt_ext != NULL && pt_ext->_b_region) {
+        pv_allocmem = _alloc_allocate_from_region(pt_allocator, t_allocsize);
+    } else {
+        pv_allocmem = _alloc_malloc(t_allocsize);
+    }
 
-    pt_allocator = NULL;
-    return _alloc_malloc(t_allocsize);
+    pt_allocator->_t_livesize += t_allocsize;
+    if (pt_allocator->_t_livesize > pt_allocator->_t_highsize) {
+        pt_allocator->_t_highsize = pt_allocator->_t_livesize;
+    }
+
+    return pv_allocmem;
 }
 
 /**
@@ -212,12 +360,29 @@ void* _alloc_allocate(_alloc_t* pt_allocator, size_t t_size, size_t t_count)
  */
 void _alloc_deallocate(_alloc_t* pt_allocator, void* pv_allocmem, size_t t_size, size_t t_count)
 {
+    _allocext_t* pt_ext = NULL;
+
     assert(pv_allocmem != NULL);
 
-    pt_allocator = NULL;
-    t_size = 0;
-    t_count = 0;
-    _alloc_free(pv_allocmem);
+    if (pt_allocator == NULL) {
+        _alloc_free(pv_allocmem);
+        return;
+    }
+
+    pt_ext = pt_allocator->_pt_ext;
+    /* the memory in region is released with the whole region */
+    if (pt_ext != NULL && pt_ext->_b_region) {
+        return;
+    }
+
+    if (pt_ext != NULL && pt_ext->_t_custom._pfun_deallocate != NULL) {
+        pt_ext->_t_custom._pfun_deallocate(pt_ext->_t_custom._pv_context, pv_allocmem, t_size * t_count);
+    } else {
+        _alloc_free(pv_allocmem);
+    }
+
+    assert(pt_allocator->_t_livesize >= t_size * t_count);
+    pt_allocator->_t_livesize -= t_size * t_count;
 }
 
 #ifndef NDEBUG
@@ -233,6 +398,93 @@ bool_t _alloc_is_inited(const _alloc_t* cpt_allocator)
 
 #endif /* CSTL_MEMORY_MANAGEMENT */
 
+/**
+ * Allocate memory from region, the memory is released all at once.
+ */
+void _alloc_set_region(_alloc_t* pt_allocator)
+{
+    assert(pt_allocator != NULL);
+    assert(_alloc_is_inited(pt_allocator));
+    assert(pt_allocator->_pt_ext == NULL || pt_allocator->_pt_ext->_t_custom._pfun_allocate == NULL);
+
+#if defined(CSTL_MEMORY_MANAGEMENT) && !defined(CSTL_MEMORY_SHARED_POOL)
+    /* the memory pool of container is useless, all memory is allocated from region */
+    _alloc_destroy_pool(pt_allocator);
+#endif
+    _alloc_get_ext(pt_allocator)->_b_region = true;
+}
+
+/**
+ * Test the allocator allocates memory from region.
+ */
+bool_t _alloc_is_region(const _alloc_t* cpt_allocator)
+{
+    assert(cpt_allocator != NULL);
+
+    return cpt_allocator->_pt_ext != NULL && cpt_allocator->_pt_ext->_b_region;
+}
+
+/**
+ * Release all memory that is allocated from region.
+ */
+void _alloc_release_region(_alloc_t* pt_allocator)
+{
+    _allocext_t* pt_ext = NULL;
+    _byte_t*     pby_block = NULL;
+
+    assert(pt_allocator != NULL);
+
+    if (!_alloc_is_region(pt_allocator)) {
+        return;
+    }
+
+    /* the first bytes of each region block point to the next block */
+    pt_ext = pt_allocator->_pt_ext;
+    while (pt_ext->_pby_regionblock != NULL) {
+        pby_block = pt_ext->_pby_regionblock;
+        pt_ext->_pby_regionblock = *(_byte_t**)pby_block;
+        _alloc_free(pby_block);
+    }
+    pt_ext->_pby_regionpos = NULL;
+    pt_ext->_pby_regionend = NULL;
+    pt_allocator->_t_livesize = 0;
+}
+
+/**
+ * Get the memory statistics of allocator.
+ */
+void _alloc_get_stat(const _alloc_t* cpt_allocator, _allocstat_t* pt_stat)
+{
+    _byte_t* pby_block = NULL;
+#ifdef CSTL_MEMORY_MANAGEMENT
+    _memlink_t* pt_link = NULL;
+    size_t      i = 0;
+#endif
+
+    assert(cpt_allocator != NULL);
+    assert(pt_stat != NULL);
+
+    memset(pt_stat, 0x00, sizeof(_allocstat_t));
+    pt_stat->_t_livesize = cpt_allocator->_t_livesize;
+    pt_stat->_t_highsize = cpt_allocator->_t_highsize;
+#ifdef CSTL_MEMORY_MANAGEMENT
+    pt_stat->_t_cachedsize = cpt_allocator->_t_mempoolsize;
+    pt_stat->_t_poolcount = cpt_allocator->_t_mempoolindex;
+    for (i = 0; i < _MEM_LINK_COUNT; ++i) {
+        for (pt_link = cpt_allocator->_apt_memlink[i]; pt_link != NULL; pt_link = pt_link->_pui_nextmem) {
+            pt_stat->_t_cachedsize += _MEM_LINK_SIZE(i);
+        }
+    }
+#endif
+
+    if (cpt_allocator->_pt_ext != NULL) {
+        pt_stat->_t_cachedsize += (size_t)(cpt_allocator->_pt_ext->_pby_regionend - cpt_allocator->_pt_ext->_pby_regionpos);
+        for (pby_block = cpt_allocator->_pt_ext->_pby_regionblock; pby_block != NULL; pby_block = *(_byte_t**)pby_block) {
+            pt_stat->_t_poolcount++;
+        }
+    }
+}
+
 /**
  * Set the out of memory handler and return the old handler.
  */
@@ -24,19 +24,82 @@
 #include <cstl/cstl_def.h>
 #include <cstl/cstl_alloc.h>
 #include <cstl/cstl_types.h>
+#ifdef CSTL_MEMORY_THREAD_CACHE
+#   ifdef _MSC_VER
+#       include <windows.h>
+#   else
+#       include <pthread.h>
+#   endif
+#endif
 
 #include "cstl_alloc_aux.h"
 
 /** local constant declaration and local macro section **/
+#ifdef CSTL_MEMORY_THREAD_CACHE
+#   ifdef _MSC_VER
+#       define _ALLOC_THREAD_LOCAL                        __declspec(thread)
+#       define _ALLOC_ATOMIC_CAS(ppt_dest, pt_old, pt_new) \
+            (_memlink_t*)InterlockedCompareExchangePointer((PVOID volatile*)(ppt_dest), (pt_new), (pt_old))
+#       define _ALLOC_ATOMIC_SWAP(ppt_dest, pt_new)        \
+            (_memlink_t*)InterlockedExchangePointer((PVOID volatile*)(ppt_dest), (pt_new))
+#   else
+#       define _ALLOC_THREAD_LOCAL                        __thread
+#       define _ALLOC_ATOMIC_CAS(ppt_dest, pt_old, pt_new) __sync_val_compare_and_swap((ppt_dest), (pt_old), (pt_new))
+#       define _ALLOC_ATOMIC_SWAP(ppt_dest, pt_new)        __sync_lock_test_and_set((ppt_dest), (pt_new))
+#   endif
+#endif /* CSTL_MEMORY_THREAD_CACHE */
 
 /** local data type declaration and local struct, union, enum section **/
 
 /** local function prototype section **/
+#ifdef CSTL_MEMORY_MANAGEMENT
+/**
+ * Append memory pool to the memory pool container of allocator.
+ * @param pt_allocator  pointer that point to allocator.
+ * @param pby_mempool   memory pool that is applied from system heap.
+ * @return void.
+ * @remarks the memory pool container is enlarged when it is full, the memory pool is released with the allocator.
+ */
+static void _alloc_append_mempool(_alloc_t* pt_allocator, _byte_t* pby_mempool);
+#endif
+
+#if defined(CSTL_MEMORY_THREAD_CACHE) && !defined(_MSC_VER)
+/**
+ * Create the thread specific key that flushes thread cache when thread exits.
+ * @return void.
+ */
+static void _alloc_create_thread_cache_key(void);
+
+/**
+ * Flush thread cache when thread exits.
+ * @param pv_cache  thread cache.
+ * @return void.
+ */
+static void _alloc_exit_thread_cache(void* pv_cache);
+#endif
 
 /** exported global variable definition section **/
 void (*_gpfun_malloc_handler)(void) = NULL;
 
 /** local global variable definition section **/
+#ifdef CSTL_MEMORY_SHARED_POOL
+static _alloc_t _gt_alloc_shared_pool;
+static bool_t   _gb_alloc_shared_pool_inited = false;
+#endif /* CSTL_MEMORY_SHARED_POOL */
+#ifdef CSTL_MEMORY_THREAD_CACHE
+/* the magazines of each thread, the memory pool of thread cache is used for carving new memory blocks only */
+static _ALLOC_THREAD_LOCAL _alloc_t _gt_alloc_thread_cache;
+static _ALLOC_THREAD_LOCAL size_t   _gat_alloc_thread_cache_count[_MEM_LINK_COUNT];
+static _ALLOC_THREAD_LOCAL bool_t   _gb_alloc_thread_cache_inited = false;
+/* the global depot, memory blocks are pushed in batch and poped all at once, so there is no ABA problem */
+static _memlink_t* volatile         _gapt_alloc_depot[_MEM_LINK_COUNT];
+#   ifndef _MSC_VER
+static pthread_key_t                _gt_alloc_thread_cache_key;
+static pthread_once_t               _gt_alloc_thread_cache_once = PTHREAD_ONCE_INIT;
+/* the exited threads hand their memory pools to the shared memory pool one by one */
+static pthread_mutex_t              _gt_alloc_shared_pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+#   endif
+#endif /* CSTL_MEMORY_THREAD_CACHE */
 
 /** exported function implementation section **/
 /**
@@ -84,7 +147,368 @@ void _alloc_free(void* pv_allocmem)
     free(pv_allocmem);
 }
 
+/**
+ * Get the extension of allocator, create it if the allocator has none.
+ */
+_allocext_t* _alloc_get_ext(_alloc_t* pt_allocator)
+{
+    assert(pt_allocator != NULL);
+
+    if (pt_allocator->_pt_ext == NULL) {
+        pt_allocator->_pt_ext = (_allocext_t*)_alloc_malloc(sizeof(_allocext_t));
+        memset(pt_allocator->_pt_ext, 0x00, sizeof(_allocext_t));
+    }
+
+    return pt_allocator->_pt_ext;
+}
+
+/**
+ * Release the extension of allocator.
+ */
+void _alloc_destroy_ext(_alloc_t* pt_allocator)
+{
+    assert(pt_allocator != NULL);
+
+    if (pt_allocator->_pt_ext != NULL) {
+        assert(pt_allocator->_pt_ext->_pby_regionblock == NULL);
+        _alloc_free(pt_allocator->_pt_ext);
+        pt_allocator->_pt_ext = NULL;
+    }
+}
+
+/**
+ * Allocate memory from region of allocator.
+ */
+void* _alloc_allocate_from_region(_alloc_t* pt_allocator, size_t t_allocsize)
+{
+    _allocext_t* pt_ext = NULL;
+    _byte_t*     pby_block = NULL;   /* new region block */
+    _byte_t*     pby_mem = NULL;     /* allocated memory */
+    size_t       t_blocksize = 0;    /* the usable size of new region block */
+
+    assert(pt_allocator != NULL);
+    assert(pt_allocator->_pt_ext != NULL && pt_allocator->_pt_ext->_b_region);
+
+    pt_ext = pt_allocator->_pt_ext;
+    t_allocsize = t_allocsize > 0 ? _MEM_REGION_ROUND_UP(t_allocsize) : _MEM_REGION_ALIGNMENT;
+    if ((size_t)(pt_ext->_pby_regionend - pt_ext->_pby_regionpos) < t_allocsize) {
+        /*
+         * the first bytes of region block point to the next block, and the usable memory starts at the
+         * aligned address behind it.
+         */
+        t_blocksize = t_allocsize > _MEM_REGION_LARGE_SIZE ? t_allocsize : _MEM_REGION_BLOCK_SIZE;
+        pby_block = (_byte_t*)_alloc_malloc(sizeof(_byte_t*) + _MEM_REGION_ALIGNMENT - 1 + t_blocksize);
+        assert(pby_block != NULL);
+        pby_mem = (_byte_t*)_MEM_REGION_ROUND_UP((size_t)(pby_block + sizeof(_byte_t*)));
+
+        if (t_allocsize > _MEM_REGION_LARGE_SIZE && pt_ext->_pby_regionblock != NULL) {
+            /* the large memory is linked behind the current block, so the current block is still used */
+            *(_byte_t**)pby_block = *(_byte_t**)pt_ext->_pby_regionblock;
+            *(_byte_t**)pt_ext->_pby_regionblock = pby_block;
+            return pby_mem;
+        }
+
+        *(_byte_t**)pby_block = pt_ext->_pby_regionblock;
+        pt_ext->_pby_regionblock = pby_block;
+        pt_ext->_pby_regionpos = pby_mem;
+        pt_ext->_pby_regionend = pby_mem + t_blocksize;
+    }
+
+    pby_mem = pt_ext->_pby_regionpos;
+    pt_ext->_pby_regionpos += t_allocsize;
+
+    return pby_mem;
+}
+
 #ifdef CSTL_MEMORY_MANAGEMENT
+/**
+ * Get the memory link index of memory size.
+ */
+size_t _alloc_get_memlink_index(size_t t_memsize)
+{
+    size_t t_tiersize = _MEM_TIER_SIZE;
+    size_t t_index = _MEM_TIER_SIZE / _MEM_ALIGNMENT;
+    size_t t_spacing = 0;
+
+    assert(t_memsize > 0 && t_memsize <= _MEM_SMALL_MEM_SIZE_MAX);
+
+    if (t_memsize <= _MEM_TIER_SIZE) {
+        return (t_memsize + _MEM_ALIGNMENT - 1) / _MEM_ALIGNMENT - 1;
+    }
+
+    /* find the tier (t_tiersize, 2 * t_tiersize] that contains the memory size */
+    while (t_memsize > 2 * t_tiersize) {
+        t_tiersize *= 2;
+        t_index += _MEM_TIER_CLASS_COUNT;
+    }
+    t_spacing = t_tiersize / _MEM_TIER_CLASS_COUNT;
+
+    return t_index + (t_memsize - t_tiersize + t_spacing - 1) / t_spacing - 1;
+}
+
+/**
+ * Get the size of memory block in memory link.
+ */
+size_t _alloc_get_memlink_size(size_t t_index)
+{
+    size_t t_tiersize = _MEM_TIER_SIZE;
+
+    assert(t_index < _MEM_LINK_COUNT);
+
+    if (t_index < _MEM_TIER_SIZE / _MEM_ALIGNMENT) {
+        return (t_index + 1) * _MEM_ALIGNMENT;
+    }
+
+    t_index -= _MEM_TIER_SIZE / _MEM_ALIGNMENT;
+    t_tiersize <<= t_index / _MEM_TIER_CLASS_COUNT;
+
+    return t_tiersize + (t_index % _MEM_TIER_CLASS_COUNT + 1) * (t_tiersize / _MEM_TIER_CLASS_COUNT);
+}
+
+/**
+ * Initialize memory pool of allocator.
+ */
+void _alloc_init_pool(_alloc_t* pt_allocator)
+{
+    size_t i = 0;
+
+    assert(pt_allocator != NULL);
+
+    pt_allocator->_t_mempoolsize = 0;
+    pt_allocator->_t_mempoolindex = 0;
+    pt_allocator->_pby_mempool = NULL;
+    
+    for (i = 0; i < _MEM_LINK_COUNT; ++i) {
+        pt_allocator->_apt_memlink[i] = NULL;
+    }
+
+    /* initialize memory pool */
+    pt_allocator->_t_mempoolcount = _MEM_POOL_DEFAULT_COUNT;
+    pt_allocator->_ppby_mempoolcontainer = (_byte_t**)malloc(pt_allocator->_t_mempoolcount * sizeof(_byte_t*));
+    if (pt_allocator->_ppby_mempoolcontainer != NULL) {
+        for (i = 0; i < pt_allocator->_t_mempoolcount; ++i) {
+            pt_allocator->_ppby_mempoolcontainer[i] = NULL;
+        }
+    } else {
+        fprintf(stderr, "CSTL FATAL ERROR: memory allocation error!\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+/**
+ * Destroy memory pool of allocator.
+ */
+void _alloc_destroy_pool(_alloc_t* pt_allocator)
+{
+    size_t i = 0;
+
+    assert(pt_allocator != NULL);
+
+    /* destroy memory pool */
+    for (i = 0; i < pt_allocator->_t_mempoolcount; ++i) {
+        free(pt_allocator->_ppby_mempoolcontainer[i]);
+        pt_allocator->_ppby_mempoolcontainer[i] = NULL;
+    }
+    free(pt_allocator->_ppby_mempoolcontainer);
+    pt_allocator->_ppby_mempoolcontainer = NULL;
+
+    for (i = 0; i < _MEM_LINK_COUNT; ++i) {
+        pt_allocator->_apt_memlink[i] = NULL;
+    }
+
+    pt_allocator->_pby_mempool = NULL;
+    pt_allocator->_t_mempoolindex = 0;
+    pt_allocator->_t_mempoolsize = 0;
+    pt_allocator->_t_mempoolcount = 0;
+}
+
+#ifdef CSTL_MEMORY_SHARED_POOL
+/**
+ * Get the process wide memory pool that is shared by all containers.
+ */
+_alloc_t* _alloc_get_shared_pool(void)
+{
+    if (!_gb_alloc_shared_pool_inited) {
+        _alloc_init_pool(&_gt_alloc_shared_pool);
+        _gb_alloc_shared_pool_inited = true;
+    }
+
+    return &_gt_alloc_shared_pool;
+}
+#endif /* CSTL_MEMORY_SHARED_POOL */
+
+#ifdef CSTL_MEMORY_THREAD_CACHE
+/**
+ * Get the thread cache of current thread.
+ */
+_alloc_t* _alloc_get_thread_cache(void)
+{
+    size_t i = 0;
+
+    if (!_gb_alloc_thread_cache_inited) {
+        _alloc_init_pool(&_gt_alloc_thread_cache);
+        for (i = 0; i < _MEM_LINK_COUNT; ++i) {
+            _gat_alloc_thread_cache_count[i] = 0;
+        }
+        _gb_alloc_thread_cache_inited = true;
+#ifndef _MSC_VER
+        pthread_once(&_gt_alloc_thread_cache_once, _alloc_create_thread_cache_key);
+        pthread_setspecific(_gt_alloc_thread_cache_key, &_gt_alloc_thread_cache);
+#endif
+    }
+
+    return &_gt_alloc_thread_cache;
+}
+
+/**
+ * Allocate memory block from thread cache.
+ */
+void* _alloc_thread_cache_allocate(size_t t_allocsize)
+{
+    _alloc_t*   pt_cache = _alloc_get_thread_cache();
+    size_t      t_index = _MEM_LINK_INDEX(t_allocsize);
+    _memlink_t* pt_link = NULL;
+    size_t      i = 0;
+
+    assert(t_allocsize > 0 && t_allocsize <= _MEM_SMALL_MEM_SIZE_MAX);
+
+    if (pt_cache->_apt_memlink[t_index] == NULL) {
+        /* refill the magazine with the memory that is released by other threads at first */
+        pt_cache->_apt_memlink[t_index] = _alloc_pop_depot(t_allocsize);
+        if (pt_cache->_apt_memlink[t_index] == NULL) {
+            _alloc_apply_formated_memory(pt_cache, _MEM_LINK_SIZE(t_index));
+        }
+
+        for (i = 0, pt_link = pt_cache->_apt_memlink[t_index]; pt_link != NULL; ++i, pt_link = pt_link->_pui_nextmem) {
+            continue;
+        }
+        _gat_alloc_thread_cache_count[t_index] = i;
+    }
+
+    pt_link = pt_cache->_apt_memlink[t_index];
+    assert(pt_link != NULL);
+    pt_cache->_apt_memlink[t_index] = pt_link->_pui_nextmem;
+    /* the rest of memory pool is put into the magazine without counting when new memory pool is applied */
+    if (_gat_alloc_thread_cache_count[t_index] > 0) {
+        _gat_alloc_thread_cache_count[t_index]--;
+    }
+
+    return (void*)pt_link;
+}
+
+/**
+ * Release memory block to thread cache.
+ */
+void _alloc_thread_cache_deallocate(void* pv_allocmem, size_t t_allocsize)
+{
+    _alloc_t*   pt_cache = _alloc_get_thread_cache();
+    size_t      t_index = _MEM_LINK_INDEX(t_allocsize);
+    _memlink_t* pt_keep = NULL;
+    _memlink_t* pt_last = NULL;
+    size_t      i = 0;
+
+    assert(pv_allocmem != NULL);
+    assert(t_allocsize > 0 && t_allocsize <= _MEM_SMALL_MEM_SIZE_MAX);
+
+    /* the memory block may be allocated by other thread, it belongs to the thread that releases it from now on */
+    ((_memlink_t*)pv_allocmem)->_pui_nextmem = pt_cache->_apt_memlink[t_index];
+    pt_cache->_apt_memlink[t_index] = (_memlink_t*)pv_allocmem;
+    _gat_alloc_thread_cache_count[t_index]++;
+
+    if (_gat_alloc_thread_cache_count[t_index] > 2 * _MEM_MAGAZINE_SIZE) {
+        /* keep the recently released memory blocks and return the others to depot */
+        for (i = 1, pt_keep = pt_cache->_apt_memlink[t_index];
+             i < _MEM_MAGAZINE_SIZE && pt_keep->_pui_nextmem != NULL;
+             ++i, pt_keep = pt_keep->_pui_nextmem) {
+            continue;
+        }
+        if (pt_keep->_pui_nextmem != NULL) {
+            for (pt_last = pt_keep->_pui_nextmem; pt_last->_pui_nextmem != NULL; pt_last = pt_last->_pui_nextmem) {
+                continue;
+            }
+            _alloc_push_depot(t_allocsize, pt_keep->_pui_nextmem, pt_last);
+            pt_keep->_pui_nextmem = NULL;
+        }
+        _gat_alloc_thread_cache_count[t_index] = i;
+    }
+}
+
+/**
+ * Return all memory blocks of thread cache to depot.
+ */
+void _alloc_flush_thread_cache(void)
+{
+    _alloc_t*   pt_cache = _alloc_get_thread_cache();
+    _memlink_t* pt_last = NULL;
+    size_t      i = 0;
+
+    for (i = 0; i < _MEM_LINK_COUNT; ++i) {
+        if (pt_cache->_apt_memlink[i] != NULL) {
+            for (pt_last = pt_cache->_apt_memlink[i]; pt_last->_pui_nextmem != NULL; pt_last = pt_last->_pui_nextmem) {
+                continue;
+            }
+            _alloc_push_depot(_MEM_LINK_SIZE(i), pt_cache->_apt_memlink[i], pt_last);
+            pt_cache->_apt_memlink[i] = NULL;
+        }
+        _gat_alloc_thread_cache_count[i] = 0;
+    }
+}
+
+/**
+ * Push memory block list into depot.
+ */
+void _alloc_push_depot(size_t t_allocsize, _memlink_t* pt_first, _memlink_t* pt_last)
+{
+    size_t      t_index = _MEM_LINK_INDEX(t_allocsize);
+    _memlink_t* pt_head = NULL;
+
+    assert(t_allocsize > 0 && t_allocsize <= _MEM_SMALL_MEM_SIZE_MAX);
+    assert(pt_first != NULL);
+    assert(pt_last != NULL);
+
+    do {
+        pt_head = _gapt_alloc_depot[t_index];
+        pt_last->_pui_nextmem = pt_head;
+    } while (_ALLOC_ATOMIC_CAS(&_gapt_alloc_depot[t_index], pt_head, pt_first) != pt_head);
+}
+
+/**
+ * Pop memory blocks from depot.
+ */
+_memlink_t* _alloc_pop_depot(size_t t_allocsize)
+{
+    size_t      t_index = _MEM_LINK_INDEX(t_allocsize);
+    _memlink_t* pt_first = NULL;
+    _memlink_t* pt_keep = NULL;
+    _memlink_t* pt_rest = NULL;
+    _memlink_t* pt_last = NULL;
+    size_t      i = 0;
+
+    assert(t_allocsize > 0 && t_allocsize <= _MEM_SMALL_MEM_SIZE_MAX);
+
+    if (_gapt_alloc_depot[t_index] == NULL ||
+        (pt_first = _ALLOC_ATOMIC_SWAP(&_gapt_alloc_depot[t_index], NULL)) == NULL) {
+        return NULL;
+    }
+
+    /* take one magazine and give the rest back */
+    for (i = 1, pt_keep = pt_first; i < _MEM_MAGAZINE_SIZE && pt_keep->_pui_nextmem != NULL; ++i, pt_keep = pt_keep->_pui_nextmem) {
+        continue;
+    }
+    pt_rest = pt_keep->_pui_nextmem;
+    pt_keep->_pui_nextmem = NULL;
+    if (pt_rest != NULL && _ALLOC_ATOMIC_CAS(&_gapt_alloc_depot[t_index], NULL, pt_rest) != NULL) {
+        /* other threads have pushed memory blocks into depot in the meantime */
+        for (pt_last = pt_rest; pt_last->_pui_nextmem != NULL; pt_last = pt_last->_pui_nextmem) {
+            continue;
+        }
+        _alloc_push_depot(t_allocsize, pt_rest, pt_last);
+    }
+
+    return pt_first;
+}
+#endif /* CSTL_MEMORY_THREAD_CACHE */
+
 /**
  * Apply a formated memory list.
  */
@@ -96,6 +520,11 @@ void _alloc_apply_formated_memory(_alloc_t* pt_allocator, size_t t_allocsize)
 
     assert(pt_allocator != NULL);
 
+    /* the larger memory block is getted fewer at once */
+    if (t_allocsize * t_alloccount > _MEM_CHUNK_SIZE_MAX) {
+        t_alloccount = t_allocsize < _MEM_CHUNK_SIZE_MAX ? _MEM_CHUNK_SIZE_MAX / t_allocsize : 1;
+    }
+
     pt_link = (_memlink_t*)_alloc_get_memory_chunk(pt_allocator, t_allocsize, &t_alloccount);
     assert(pt_link != NULL);
 
@@ -119,7 +548,7 @@ _byte_t* _alloc_get_memory_chunk(_alloc_t* pt_allocator, size_t t_allocsize, siz
     size_t    t_totalsize = 0;     /* total size of alloc */
     _byte_t*  pby_allocmem = NULL;  /* the allocated memory block */
     size_t    t_getmemsize = 0;    /* bytes to get memory from system heap */
-    size_t    i = 0;
+    size_t    t_index = 0;
 
     assert(pt_allocator != NULL);
     assert(pt_alloccount != NULL);
@@ -145,53 +574,39 @@ _byte_t* _alloc_get_memory_chunk(_alloc_t* pt_allocator, size_t t_allocsize, siz
         /* if the memory pool conatiner is full */
         assert(pt_allocator->_t_mempoolindex <= pt_allocator->_t_mempoolcount);
         /* take the small memory block to the memory list */
-        if (pt_allocator->_t_mempoolsize > 0) {
-            ((_memlink_t*)pt_allocator->_pby_mempool)->_pui_nextmem = 
-                pt_allocator->_apt_memlink[_MEM_LINK_INDEX(pt_allocator->_t_mempoolsize)];
-            pt_allocator->_apt_memlink[_MEM_LINK_INDEX(pt_allocator->_t_mempoolsize)] =
-                (_memlink_t*)pt_allocator->_pby_mempool;
+        if (pt_allocator->_t_mempoolsize >= _MEM_ALIGNMENT) {
+            /* the small memory block is put into the largest size class that it can hold */
+            t_index = _MEM_LINK_INDEX(pt_allocator->_t_mempoolsize);
+            if (_MEM_LINK_SIZE(t_index) > pt_allocator->_t_mempoolsize) {
+                t_index--;
+            }
+            ((_memlink_t*)pt_allocator->_pby_mempool)->_pui_nextmem = pt_allocator->_apt_memlink[t_index];
+            pt_allocator->_apt_memlink[t_index] = (_memlink_t*)pt_allocator->_pby_mempool;
             pt_allocator->_t_mempoolsize = 0;
         }
 
+        /* the extra bytes are used for aligning the memory pool to the boundary of small memory block */
         t_getmemsize = 2 * t_totalsize;
-        pt_allocator->_pby_mempool = (_byte_t*)malloc(t_getmemsize);
+        pt_allocator->_pby_mempool = (_byte_t*)malloc(t_getmemsize + _MEM_ALIGNMENT - 1);
 
         if (pt_allocator->_pby_mempool == NULL) {
             /* search the memory list for unuse memory that meet the size */
-            for (i = t_allocsize; i < _MEM_SMALL_MEM_SIZE_MAX; i += _MEM_ALIGNMENT) {
-                pt_allocator->_pby_mempool = (_byte_t*)pt_allocator->_apt_memlink[_MEM_LINK_INDEX(i)];
+            for (t_index = _MEM_LINK_INDEX(t_allocsize); t_index < _MEM_LINK_COUNT; ++t_index) {
+                pt_allocator->_pby_mempool = (_byte_t*)pt_allocator->_apt_memlink[t_index];
                 if (pt_allocator->_pby_mempool != NULL) {
-                    pt_allocator->_apt_memlink[_MEM_LINK_INDEX(i)] = ((_memlink_t*)pt_allocator->_pby_mempool)->_pui_nextmem;
-                    pt_allocator->_t_mempoolsize = i;
+                    pt_allocator->_apt_memlink[t_index] = ((_memlink_t*)pt_allocator->_pby_mempool)->_pui_nextmem;
+                    pt_allocator->_t_mempoolsize = _MEM_LINK_SIZE(t_index);
 
                     return _alloc_get_memory_chunk(pt_allocator, t_allocsize, pt_alloccount);
                 }
             }
-            pt_allocator->_pby_mempool = (_byte_t*)_alloc_malloc_out_of_memory(t_getmemsize);
+            pt_allocator->_pby_mempool = (_byte_t*)_alloc_malloc_out_of_memory(t_getmemsize + _MEM_ALIGNMENT - 1);
         }
 
-        /* if the memory pool container is full */
-        if (pt_allocator->_t_mempoolindex == pt_allocator->_t_mempoolcount) {
-            _byte_t** ppby_oldmempool = pt_allocator->_ppby_mempoolcontainer;
-
-            pt_allocator->_t_mempoolcount += _MEM_POOL_DEFAULT_COUNT;
-            pt_allocator->_ppby_mempoolcontainer = (_byte_t**)malloc(pt_allocator->_t_mempoolcount * sizeof(_byte_t*));
-            if (pt_allocator->_ppby_mempoolcontainer != NULL) {
-                for (i = 0; i < pt_allocator->_t_mempoolcount; ++i) {
-                    pt_allocator->_ppby_mempoolcontainer[i] = NULL;
-                }
-                memcpy(pt_allocator->_ppby_mempoolcontainer, ppby_oldmempool,
-                    (pt_allocator->_t_mempoolcount - _MEM_POOL_DEFAULT_COUNT) * sizeof(_byte_t*));
-                free(ppby_oldmempool);
-                assert(pt_allocator->_t_mempoolindex < pt_allocator->_t_mempoolcount);
-            } else {
-                fprintf(stderr, "CSTL FATAL ERROR: memory allocation error!\n");
-                exit(EXIT_FAILURE);
-            }
-        }
-        pt_allocator->_ppby_mempoolcontainer[pt_allocator->_t_mempoolindex++] = pt_allocator->_pby_mempool;
+        _alloc_append_mempool(pt_allocator, pt_allocator->_pby_mempool);
 
         /* apply memory from system heap success or call _alloc_malloc_out_of_memory success */
+        pt_allocator->_pby_mempool = (_byte_t*)_MEM_ROUND_UP((size_t)pt_allocator->_pby_mempool);
         pt_allocator->_t_mempoolsize = t_getmemsize;
 
         pby_allocmem = pt_allocator->_pby_mempool;
@@ -205,6 +620,76 @@ _byte_t* _alloc_get_memory_chunk(_alloc_t* pt_allocator, size_t t_allocsize, siz
 #endif /* CSTL_MEMORY_MANAGEMENT */
 
 /** local function implementation section **/
+#ifdef CSTL_MEMORY_MANAGEMENT
+/**
+ * Append memory pool to the memory pool container of allocator.
+ */
+static void _alloc_append_mempool(_alloc_t* pt_allocator, _byte_t* pby_mempool)
+{
+    size_t i = 0;
+
+    assert(pt_allocator != NULL);
+    assert(pby_mempool != NULL);
+    assert(pt_allocator->_t_mempoolindex <= pt_allocator->_t_mempoolcount);
+
+    /* if the memory pool container is full */
+    if (pt_allocator->_t_mempoolindex == pt_allocator->_t_mempoolcount) {
+        _byte_t** ppby_oldmempool = pt_allocator->_ppby_mempoolcontainer;
+
+        pt_allocator->_t_mempoolcount += _MEM_POOL_DEFAULT_COUNT;
+        pt_allocator->_ppby_mempoolcontainer = (_byte_t**)malloc(pt_allocator->_t_mempoolcount * sizeof(_byte_t*));
+        if (pt_allocator->_ppby_mempoolcontainer != NULL) {
+            for (i = 0; i < pt_allocator->_t_mempoolcount; ++i) {
+                pt_allocator->_ppby_mempoolcontainer[i] = NULL;
+            }
+            memcpy(pt_allocator->_ppby_mempoolcontainer, ppby_oldmempool,
+                (pt_allocator->_t_mempoolcount - _MEM_POOL_DEFAULT_COUNT) * sizeof(_byte_t*));
+            free(ppby_oldmempool);
+            assert(pt_allocator->_t_mempoolindex < pt_allocator->_t_mempoolcount);
+        } else {
+            fprintf(stderr, "CSTL FATAL ERROR: memory allocation error!\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    pt_allocator->_ppby_mempoolcontainer[pt_allocator->_t_mempoolindex++] = pby_mempool;
+}
+#endif /* CSTL_MEMORY_MANAGEMENT */
+
+#if defined(CSTL_MEMORY_THREAD_CACHE) && !defined(_MSC_VER)
+/**
+ * Create the thread specific key that flushes thread cache when thread exits.
+ */
+static void _alloc_create_thread_cache_key(void)
+{
+    pthread_key_create(&_gt_alloc_thread_cache_key, _alloc_exit_thread_cache);
+}
+
+/**
+ * Flush thread cache when thread exits.
+ */
+static void _alloc_exit_thread_cache(void* pv_cache)
+{
+    _alloc_t* pt_pool = NULL;
+    size_t    i = 0;
+
+    assert(pv_cache == &_gt_alloc_thread_cache);
+
+    _alloc_flush_thread_cache();
+    /*
+     * the memory pool of exited thread can not be released, the memory blocks of it may be used by other threads,
+     * so it is handed to the shared memory pool and released with it, only the memory pool container is released.
+     */
+    pthread_mutex_lock(&_gt_alloc_shared_pool_mutex);
+    pt_pool = _alloc_get_shared_pool();
+    for (i = 0; i < _gt_alloc_thread_cache._t_mempoolindex; ++i) {
+        _alloc_append_mempool(pt_pool, _gt_alloc_thread_cache._ppby_mempoolcontainer[i]);
+    }
+    pthread_mutex_unlock(&_gt_alloc_shared_pool_mutex);
+    free(_gt_alloc_thread_cache._ppby_mempoolcontainer);
+    memset(&_gt_alloc_thread_cache, 0x00, sizeof(_alloc_t));
+    _gb_alloc_thread_cache_inited = false;
+}
+#endif
 
 /** eof **/
 
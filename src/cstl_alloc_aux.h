@@ -59,7 +59,133 @@ extern void* _alloc_malloc(size_t t_memsize);
  */
 extern void _alloc_free(void* pv_allocmem);
 
+/**
+ * Get the extension of allocator, create it if the allocator has none.
+ * @param pt_allocator  allocator.
+ * @return the extension of allocator.
+ * @remarks if pt_allocator == NULL, then the function of behavior is undefined.
+ */
+extern _allocext_t* _alloc_get_ext(_alloc_t* pt_allocator);
+
+/**
+ * Release the extension of allocator.
+ * @param pt_allocator  allocator.
+ * @return void.
+ * @remarks if pt_allocator == NULL, then the function of behavior is undefined. the region memory must be released
+ *          before, otherwise the behavior is undefined.
+ */
+extern void _alloc_destroy_ext(_alloc_t* pt_allocator);
+
+/**
+ * Allocate memory from region of allocator.
+ * @param pt_allocator  allocator.
+ * @param t_allocsize   memory size.
+ * @return point to the allocated memory.
+ * @remarks if pt_allocator == NULL, then the function of behavior is undefined. if the allocator is not in region mode,
+ *          then the function of behavior is undefined.
+ */
+extern void* _alloc_allocate_from_region(_alloc_t* pt_allocator, size_t t_allocsize);
+
 #ifdef CSTL_MEMORY_MANAGEMENT
+/**
+ * Get the memory link index of memory size.
+ * @param t_memsize  memory size.
+ * @return the index of the smallest size class that is not less than t_memsize.
+ * @remarks if t_memsize == 0 or t_memsize > _MEM_SMALL_MEM_SIZE_MAX, then the function of behavior is undefined.
+ */
+extern size_t _alloc_get_memlink_index(size_t t_memsize);
+
+/**
+ * Get the size of memory block in memory link.
+ * @param t_index  memory link index.
+ * @return the size of memory block.
+ * @remarks if t_index >= _MEM_LINK_COUNT, then the function of behavior is undefined.
+ */
+extern size_t _alloc_get_memlink_size(size_t t_index);
+
+/**
+ * Initialize memory pool of allocator.
+ * @param pt_allocator  pointer that point to allocator.
+ * @return void.
+ * @remarks if pt_allocator == NULL then the function of behavior is undefined.
+ */
+extern void _alloc_init_pool(_alloc_t* pt_allocator);
+
+/**
+ * Destroy memory pool of allocator.
+ * @param pt_allocator  pointer that point to allocator.
+ * @return void.
+ * @remarks if pt_allocator == NULL then the function of behavior is undefined. all memory that is allocated from this
+ *          memory pool is released.
+ */
+extern void _alloc_destroy_pool(_alloc_t* pt_allocator);
+
+#ifdef CSTL_MEMORY_SHARED_POOL
+/**
+ * Get the process wide memory pool that is shared by all containers.
+ * @return pointer that point to the allocator of shared memory pool.
+ * @remarks the shared memory pool is initialized when it is used at first time, and it is never destroyed. the memory
+ *          pools of exited threads are kept in it when thread cache is used.
+ */
+extern _alloc_t* _alloc_get_shared_pool(void);
+#endif /* CSTL_MEMORY_SHARED_POOL */
+
+#ifdef CSTL_MEMORY_THREAD_CACHE
+/**
+ * Get the thread cache of current thread.
+ * @return pointer that point to the allocator of thread cache.
+ * @remarks the thread cache is initialized when it is used at first time in each thread. the memory blocks of thread
+ *          cache are returned to depot and the memory pools of it are handed to the shared memory pool when thread
+ *          exits, this is not done on Windows.
+ */
+extern _alloc_t* _alloc_get_thread_cache(void);
+
+/**
+ * Allocate memory block from thread cache.
+ * @param t_allocsize  the size of allocated memory.
+ * @return point to the allocated memory.
+ * @remarks if t_allocsize == 0 or t_allocsize > _MEM_SMALL_MEM_SIZE_MAX, then the function of behavior is undefined.
+ *          if the thread cache is empty, it is refilled from depot at first, then from the memory pool of thread.
+ */
+extern void* _alloc_thread_cache_allocate(size_t t_allocsize);
+
+/**
+ * Release memory block to thread cache.
+ * @param pv_allocmem  allocated memory.
+ * @param t_allocsize  the size of allocated memory.
+ * @return void.
+ * @remarks if pv_allocmem == NULL, t_allocsize == 0 or t_allocsize > _MEM_SMALL_MEM_SIZE_MAX, then the function of
+ *          behavior is undefined. pv_allocmem can be allocated by any thread. if thread cache holds more than two
+ *          magazines, the older memory blocks are returned to depot.
+ */
+extern void _alloc_thread_cache_deallocate(void* pv_allocmem, size_t t_allocsize);
+
+/**
+ * Return all memory blocks of thread cache to depot.
+ * @return void.
+ */
+extern void _alloc_flush_thread_cache(void);
+
+/**
+ * Push memory block list into depot.
+ * @param t_allocsize  the size of memory block.
+ * @param pt_first     the first memory block of list.
+ * @param pt_last      the last memory block of list.
+ * @return void.
+ * @remarks if pt_first == NULL or pt_last == NULL, then the function of behavior is undefined. this function is lock
+ *          free.
+ */
+extern void _alloc_push_depot(size_t t_allocsize, _memlink_t* pt_first, _memlink_t* pt_last);
+
+/**
+ * Pop memory blocks from depot.
+ * @param t_allocsize  the size of memory block.
+ * @return memory block list that contains one magazine at most, or NULL if depot is empty.
+ * @remarks this function is lock free.
+ */
+extern _memlink_t* _alloc_pop_depot(size_t t_allocsize);
+#endif /* CSTL_MEMORY_THREAD_CACHE */
+
 /**
  * Apply a formated memory list.
  * @param pt_allocator  pointer that point to allocator.
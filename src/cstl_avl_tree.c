@@ -26,6 +26,7 @@
 #include <cstl/cstl_types.h>
 #include <cstl/citerator.h>
 #include <cstl/cstring.h>
+#include <cstl/cutility.h>
 
 #include <cstl/cstl_avl_tree_iterator.h>
 #include <cstl/cstl_avl_tree_private.h>
@@ -34,6 +35,8 @@
 #include "cstl_avl_tree_aux.h"
 
 /** local constant declaration and local macro section **/
+/* the number of elements that descend the tree together in batch find */
+#define _AVL_TREE_FIND_BATCH_COUNT 16
 
 /** local data type declaration and local struct, union, enum section **/
 
@@ -296,6 +299,20 @@ size_t _avl_tree_max_size(const _avl_tree_t* cpt_avl_tree)
     return (size_t)(-1) / _GET_AVL_TREE_TYPE_SIZE(cpt_avl_tree);
 }
 
+/**
+ * Get the memory that is allocated by the avl tree.
+ */
+size_t _avl_tree_memory_usage(const _avl_tree_t* cpt_avl_tree)
+{
+    _allocstat_t t_stat;
+
+    assert(cpt_avl_tree != NULL);
+    assert(_avl_tree_is_inited(cpt_avl_tree));
+
+    _alloc_get_stat(&cpt_avl_tree->_t_allocator, &t_stat);
+    return t_stat._t_livesize + t_stat._t_cachedsize;
+}
+
 /**
  * Return an iterator that addresses the first element in the avl tree.
  */
@@ -384,6 +401,62 @@ _avl_tree_iterator_t _avl_tree_find(const _avl_tree_t* cpt_avl_tree, const void*
     return it_iter;
 }
 
+/**
+ * Find a batch of specific elements.
+ */
+void _avl_tree_find_batch(
+    const _avl_tree_t* cpt_avl_tree, const void* const* cppv_values, size_t t_count, _avl_tree_iterator_t* pit_result)
+{
+    _avlnode_t* apt_node[_AVL_TREE_FIND_BATCH_COUNT];
+    size_t      t_batch = 0;
+    size_t      t_active = 0;
+    size_t      i = 0;
+    size_t      j = 0;
+    int         n_result = 0;
+
+    assert(cpt_avl_tree != NULL);
+    assert(cppv_values != NULL);
+    assert(pit_result != NULL);
+    assert(_avl_tree_is_inited(cpt_avl_tree));
+
+    for (i = 0; i < t_count; i += t_batch) {
+        t_batch = t_count - i < _AVL_TREE_FIND_BATCH_COUNT ? t_count - i : _AVL_TREE_FIND_BATCH_COUNT;
+        for (j = 0; j < t_batch; ++j) {
+            assert(cppv_values[i + j] != NULL);
+            apt_node[j] = cpt_avl_tree->_t_avlroot._pt_parent;
+            _AVL_TREE_ITERATOR_TREE_POINTER(pit_result[i + j]) = (void*)cpt_avl_tree;
+            _AVL_TREE_ITERATOR_COREPOS(pit_result[i + j]) = (_byte_t*)&cpt_avl_tree->_t_avlroot;
+        }
+
+        /*
+         * Each round moves every unfinished lookup down one level like _avl_tree_find_value() and prefetches the
+         * next node, so the cache misses of lookups in one round are overlapped.
+         */
+        for (t_active = t_batch; t_active > 0;) {
+            t_active = 0;
+            for (j = 0; j < t_batch; ++j) {
+                if (apt_node[j] == NULL) {
+                    continue;
+                }
+
+                n_result = _avl_tree_elem_three_way_compare_auxiliary(
+                    cpt_avl_tree, cppv_values[i + j], apt_node[j]->_pby_data);
+                if (n_result == 0) {
+                    _AVL_TREE_ITERATOR_COREPOS(pit_result[i + j]) = (_byte_t*)apt_node[j];
+                    apt_node[j] = NULL;
+                    continue;
+                }
+
+                apt_node[j] = n_result < 0 ? apt_node[j]->_pt_left : apt_node[j]->_pt_right;
+                if (apt_node[j] != NULL) {
+                    _CSTL_PREFETCH(apt_node[j]);
+                    ++t_active;
+                }
+            }
+        }
+    }
+}
+
 /**
  * Erases all the elements of a avl tree.
  */
@@ -392,12 +465,19 @@ void _avl_tree_clear(_avl_tree_t* pt_avl_tree)
     assert(pt_avl_tree != NULL);
     assert(_avl_tree_is_inited(pt_avl_tree));
 
-    /* destroy all elements */
-    pt_avl_tree->_t_avlroot._pt_parent = _avl_tree_destroy_subtree(pt_avl_tree, pt_avl_tree->_t_avlroot._pt_parent);
+    /* destroy all elements, the elements in region that need not be destroyed are released with the region */
+    if (_alloc_is_region(&pt_avl_tree->_t_allocator) &&
+        (_type_is_trivially_destructible(&pt_avl_tree->_t_typeinfo) ||
+         _pair_is_inline_trivially_destructible(&pt_avl_tree->_t_typeinfo))) {
+        pt_avl_tree->_t_avlroot._pt_parent = NULL;
+    } else {
+        pt_avl_tree->_t_avlroot._pt_parent = _avl_tree_destroy_subtree(pt_avl_tree, pt_avl_tree->_t_avlroot._pt_parent);
+    }
     assert(pt_avl_tree->_t_avlroot._pt_parent == NULL);
     pt_avl_tree->_t_avlroot._pt_left = &pt_avl_tree->_t_avlroot;
     pt_avl_tree->_t_avlroot._pt_right = &pt_avl_tree->_t_avlroot;
     pt_avl_tree->_t_nodecount = 0;
+    _alloc_release_region(&pt_avl_tree->_t_allocator);
 }
 
 /**
@@ -422,8 +502,7 @@ _avl_tree_iterator_t _avl_tree_lower_bound(const _avl_tree_t* cpt_avl_tree, cons
 {
     _avlnode_t*          pt_cur = NULL;
     _avlnode_t*          pt_prev = NULL;
-    bool_t               b_less = false;
-    bool_t               b_greater = false;
+    int                  n_result = 0;
     _avl_tree_iterator_t it_iter;
 
     assert(cpt_avl_tree != NULL);
@@ -436,21 +515,17 @@ _avl_tree_iterator_t _avl_tree_lower_bound(const _avl_tree_t* cpt_avl_tree, cons
     if (!_avl_tree_empty(cpt_avl_tree)) {
         pt_prev = cpt_avl_tree->_t_avlroot._pt_parent;
 
-        b_less = b_greater = _GET_AVL_TREE_TYPE_SIZE(cpt_avl_tree);
-        _avl_tree_elem_compare_auxiliary(cpt_avl_tree, cpv_value, pt_prev->_pby_data, &b_less);
-        _avl_tree_elem_compare_auxiliary(cpt_avl_tree, pt_prev->_pby_data, cpv_value, &b_greater);
+        n_result = _avl_tree_elem_three_way_compare_auxiliary(cpt_avl_tree, cpv_value, pt_prev->_pby_data);
 
-        pt_cur = (b_less || !b_greater) ? pt_prev->_pt_left : pt_prev->_pt_right;
+        pt_cur = n_result <= 0 ? pt_prev->_pt_left : pt_prev->_pt_right;
         while (pt_cur != NULL) {
             pt_prev = pt_cur;
-            b_less = b_greater = _GET_AVL_TREE_TYPE_SIZE(cpt_avl_tree);
-            _avl_tree_elem_compare_auxiliary(cpt_avl_tree, cpv_value, pt_prev->_pby_data, &b_less);
-            _avl_tree_elem_compare_auxiliary(cpt_avl_tree, pt_prev->_pby_data, cpv_value, &b_greater);
+            n_result = _avl_tree_elem_three_way_compare_auxiliary(cpt_avl_tree, cpv_value, pt_prev->_pby_data);
 
-            pt_cur = (b_less || !b_greater) ? pt_prev->_pt_left : pt_prev->_pt_right;
+            pt_cur = n_result <= 0 ? pt_prev->_pt_left : pt_prev->_pt_right;
         }
 
-        if (b_less || !b_greater) {
+        if (n_result <= 0) {
             assert(pt_prev->_pt_left == NULL);
             _AVL_TREE_ITERATOR_COREPOS(it_iter) = (_byte_t*)pt_prev;
             assert(_avl_tree_iterator_belong_to_avl_tree(cpt_avl_tree, it_iter));
@@ -700,6 +775,27 @@ void _avl_tree_swap(_avl_tree_t* pt_first, _avl_tree_t* pt_second)
     }
 }
 
+/**
+ * Move the datas of avl tree into uninitialized memory.
+ */
+void _avl_tree_relocate(_avl_tree_t* pt_target, _avl_tree_t* pt_source)
+{
+    assert(pt_target != NULL);
+    assert(pt_source != NULL);
+    assert(_avl_tree_is_inited(pt_source));
+    assert(pt_target != pt_source);
+
+    *pt_target = *pt_source;
+
+    /* the root and the header point to each other, so they are fixed for new address */
+    if (_avl_tree_empty(pt_target)) {
+        pt_target->_t_avlroot._pt_left = &pt_target->_t_avlroot;
+        pt_target->_t_avlroot._pt_right = &pt_target->_t_avlroot;
+    } else {
+        pt_target->_t_avlroot._pt_parent->_pt_parent = &pt_target->_t_avlroot;
+    }
+}
+
 /**
  * Inserts an element into a avl tree.
  */
@@ -787,7 +883,7 @@ void _avl_tree_insert_equal_array(_avl_tree_t* pt_avl_tree, const void* cpv_arra
      * the elements of c builtin array are element itself, but the elements of 
      * c string, user define or cstl are pointer of element.
      */
-    if (strncmp(_GET_AVL_TREE_TYPE_BASENAME(pt_avl_tree), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_AVL_TREE_TYPE_ID(pt_avl_tree) == _TYPE_ID_C_STRING) {
         /*
          * We need built a string_t for c string element.
          */
@@ -845,7 +941,7 @@ void _avl_tree_insert_unique_array(_avl_tree_t* pt_avl_tree, const void* cpv_arr
      * the elements of c builtin array are element itself, but the elements of 
      * c string, user define or cstl are pointer of element.
      */
-    if (strncmp(_GET_AVL_TREE_TYPE_BASENAME(pt_avl_tree), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_AVL_TREE_TYPE_ID(pt_avl_tree) == _TYPE_ID_C_STRING) {
         /*
          * We need built a string_t for c string element.
          */
@@ -1151,8 +1247,7 @@ void _avl_tree_erase_pos(_avl_tree_t* pt_avl_tree, _avl_tree_iterator_t it_pos)
     b_result = _GET_AVL_TREE_TYPE_SIZE(pt_avl_tree);
     _GET_AVL_TREE_TYPE_DESTROY_FUNCTION(pt_avl_tree)(pt_cur->_pby_data, &b_result);
     assert(b_result);
-    _alloc_deallocate(&pt_avl_tree->_t_allocator, pt_cur,
-        _AVL_TREE_NODE_SIZE(_GET_AVL_TREE_TYPE_SIZE(pt_avl_tree)), 1);
+    _alloc_deallocate(&pt_avl_tree->_t_allocator, pt_cur, pt_avl_tree->_t_nodesize, 1);
     pt_avl_tree->_t_nodecount--;
     if (pt_avl_tree->_t_nodecount == 0) {
         pt_avl_tree->_t_avlroot._pt_parent = NULL;
@@ -26,12 +26,14 @@
 #include <cstl/cstl_types.h>
 #include <cstl/citerator.h>
 #include <cstl/cstring.h>
+#include <cstl/cutility.h>
 
 #include <cstl/cstl_avl_tree_iterator.h>
 #include <cstl/cstl_avl_tree_private.h>
 #include <cstl/cstl_avl_tree.h>
 
 #include "cstl_avl_tree_aux.h"
+#include "cstl_map_aux.h"
 
 /** local constant declaration and local macro section **/
 
@@ -203,7 +205,7 @@ bool_t _avl_tree_same_type_ex(const _avl_tree_t* cpt_first, const _avl_tree_t* c
  */
 _avlnode_t* _avl_tree_find_value(const _avl_tree_t* cpt_avl_tree, const _avlnode_t* cpt_root, const void* cpv_value) 
 {
-    bool_t b_result = false;
+    int n_result = 0;
 
     assert(cpt_avl_tree != NULL);
     assert(cpv_value != NULL);
@@ -213,15 +215,10 @@ _avlnode_t* _avl_tree_find_value(const _avl_tree_t* cpt_avl_tree, const _avlnode
         return NULL;
     }
 
-    b_result = _GET_AVL_TREE_TYPE_SIZE(cpt_avl_tree);
-    _avl_tree_elem_compare_auxiliary(cpt_avl_tree, cpv_value, cpt_root->_pby_data, &b_result);
-    if (b_result) {
+    n_result = _avl_tree_elem_three_way_compare_auxiliary(cpt_avl_tree, cpv_value, cpt_root->_pby_data);
+    if (n_result < 0) {
         return _avl_tree_find_value(cpt_avl_tree, cpt_root->_pt_left, cpv_value);
-    }
-
-    b_result = _GET_AVL_TREE_TYPE_SIZE(cpt_avl_tree);
-    _avl_tree_elem_compare_auxiliary(cpt_avl_tree, cpt_root->_pby_data, cpv_value, &b_result);
-    if (b_result) {
+    } else if (n_result > 0) {
         return _avl_tree_find_value(cpt_avl_tree, cpt_root->_pt_right, cpv_value);
     } else {
         return (_avlnode_t*)cpt_root;
@@ -248,7 +245,7 @@ _avlnode_t* _avl_tree_destroy_subtree(_avl_tree_t* pt_avl_tree, _avlnode_t* pt_r
         b_result = _GET_AVL_TREE_TYPE_SIZE(pt_avl_tree);
         _GET_AVL_TREE_TYPE_DESTROY_FUNCTION(pt_avl_tree)(pt_root->_pby_data, &b_result);
         assert(b_result);
-        _alloc_deallocate(&pt_avl_tree->_t_allocator, pt_root,_AVL_TREE_NODE_SIZE(_GET_AVL_TREE_TYPE_SIZE(pt_avl_tree)), 1);
+        _alloc_deallocate(&pt_avl_tree->_t_allocator, pt_root, pt_avl_tree->_t_nodesize, 1);
     }
     
     return NULL;
@@ -425,10 +422,9 @@ _avl_tree_insert_result_t _avl_tree_insert_avlnode(
 
     /* if root is NULL then allocate memory */
     if (pt_root == NULL) {
-        pt_root = _alloc_allocate(
-            (_alloc_t*)&cpt_avl_tree->_t_allocator, _AVL_TREE_NODE_SIZE(_GET_AVL_TREE_TYPE_SIZE(cpt_avl_tree)), 1);
+        pt_root = _alloc_allocate((_alloc_t*)&cpt_avl_tree->_t_allocator, cpt_avl_tree->_t_nodesize, 1);
         assert(pt_root != NULL);
-        _avl_tree_init_elem_auxiliary((_avl_tree_t*)cpt_avl_tree, pt_root);
+        _avl_tree_init_node_auxiliary((_avl_tree_t*)cpt_avl_tree, pt_root);
 
         pt_root->_pt_left = pt_root->_pt_right = NULL;
         pt_root->_un_height = 0;
@@ -526,6 +522,26 @@ void _avl_tree_init_elem_auxiliary(_avl_tree_t* pt_avl_tree, _avlnode_t* pt_node
     }
 }
 
+/**
+ * Initialize the element of new node auxiliary function
+ */
+void _avl_tree_init_node_auxiliary(_avl_tree_t* pt_avl_tree, _avlnode_t* pt_node)
+{
+    assert(pt_avl_tree != NULL);
+    assert(pt_node != NULL);
+    assert(_avl_tree_is_inited(pt_avl_tree) || _avl_tree_is_created(pt_avl_tree));
+
+    /* the first and second of pair element are stored inline after the pair in the same node */
+    if (pt_avl_tree->_t_nodesize > _AVL_TREE_NODE_SIZE(_GET_AVL_TREE_TYPE_SIZE(pt_avl_tree))) {
+        char s_elemtypename[_TYPE_NAME_SIZE + 1];
+        _type_get_elem_typename(_GET_AVL_TREE_TYPE_NAME(pt_avl_tree), s_elemtypename);
+
+        _pair_init_inline((pair_t*)pt_node->_pby_data, s_elemtypename);
+    } else {
+        _avl_tree_init_elem_auxiliary(pt_avl_tree, pt_node);
+    }
+}
+
 /**
  * Element compare function auxiliary
  */
@@ -538,7 +554,7 @@ void _avl_tree_elem_compare_auxiliary(
     assert(pv_output != NULL);
     assert(_avl_tree_is_inited(cpt_avl_tree));
 
-    if (strncmp(_GET_AVL_TREE_TYPE_BASENAME(cpt_avl_tree), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0 &&
+    if (_GET_AVL_TREE_TYPE_ID(cpt_avl_tree) == _TYPE_ID_C_STRING &&
         cpt_avl_tree->_t_compare != _GET_AVL_TREE_TYPE_LESS_FUNCTION(cpt_avl_tree)) {
         cpt_avl_tree->_t_compare(string_c_str((string_t*)cpv_first), string_c_str((string_t*)cpv_second), pv_output);
     } else {
@@ -546,6 +562,42 @@ void _avl_tree_elem_compare_auxiliary(
     }
 }
 
+/**
+ * Element three-way compare function auxiliary
+ */
+int _avl_tree_elem_three_way_compare_auxiliary(
+    const _avl_tree_t* cpt_avl_tree, const void* cpv_first, const void* cpv_second)
+{
+    int    n_result = 0;
+    bool_t b_result = false;
+
+    assert(cpt_avl_tree != NULL);
+    assert(cpv_first != NULL);
+    assert(cpv_second != NULL);
+    assert(_avl_tree_is_inited(cpt_avl_tree));
+
+    /* the three-way compare of element type agrees with the less of element type only */
+    if (cpt_avl_tree->_t_compare == _GET_AVL_TREE_TYPE_LESS_FUNCTION(cpt_avl_tree) &&
+        _GET_AVL_TREE_TYPE_COMPARE_FUNCTION(cpt_avl_tree) != NULL) {
+        _GET_AVL_TREE_TYPE_COMPARE_FUNCTION(cpt_avl_tree)(cpv_first, cpv_second, &n_result);
+        return n_result;
+    }
+    /* the pairs of map containers are ordered by keys only */
+    if (_map_key_three_way_compare(cpt_avl_tree->_t_compare, cpv_first, cpv_second, &n_result)) {
+        return n_result;
+    }
+
+    b_result = _GET_AVL_TREE_TYPE_SIZE(cpt_avl_tree);
+    _avl_tree_elem_compare_auxiliary(cpt_avl_tree, cpv_first, cpv_second, &b_result);
+    if (b_result) {
+        return -1;
+    }
+    b_result = _GET_AVL_TREE_TYPE_SIZE(cpt_avl_tree);
+    _avl_tree_elem_compare_auxiliary(cpt_avl_tree, cpv_second, cpv_first, &b_result);
+
+    return b_result ? 1 : 0;
+}
+
 /** local function implementation section **/
 
 /** eof **/
@@ -34,10 +34,12 @@ extern "C" {
 #define _GET_AVL_TREE_TYPE_SIZE(pt_avl_tree)             ((pt_avl_tree)->_t_typeinfo._pt_type->_t_typesize)
 #define _GET_AVL_TREE_TYPE_NAME(pt_avl_tree)             ((pt_avl_tree)->_t_typeinfo._s_typename)
 #define _GET_AVL_TREE_TYPE_BASENAME(pt_avl_tree)         ((pt_avl_tree)->_t_typeinfo._pt_type->_s_typename)
+#define _GET_AVL_TREE_TYPE_ID(pt_avl_tree)               ((pt_avl_tree)->_t_typeinfo._pt_type->_t_typeid)
 #define _GET_AVL_TREE_TYPE_INIT_FUNCTION(pt_avl_tree)    ((pt_avl_tree)->_t_typeinfo._pt_type->_t_typeinit)
 #define _GET_AVL_TREE_TYPE_COPY_FUNCTION(pt_avl_tree)    ((pt_avl_tree)->_t_typeinfo._pt_type->_t_typecopy)
 #define _GET_AVL_TREE_TYPE_LESS_FUNCTION(pt_avl_tree)    ((pt_avl_tree)->_t_typeinfo._pt_type->_t_typeless)
 #define _GET_AVL_TREE_TYPE_DESTROY_FUNCTION(pt_avl_tree) ((pt_avl_tree)->_t_typeinfo._pt_type->_t_typedestroy)
+#define _GET_AVL_TREE_TYPE_COMPARE_FUNCTION(pt_avl_tree) ((pt_avl_tree)->_t_typeinfo._pt_type->_t_typecompare)
 #define _GET_AVL_TREE_TYPE_STYLE(pt_avl_tree)            ((pt_avl_tree)->_t_typeinfo._t_style)
 
 /** data type declaration and struct, union, enum section **/
@@ -242,6 +244,16 @@ extern _avlnode_t* _avl_tree_rebalance(_avlnode_t* pt_root);
  */
 extern void _avl_tree_init_elem_auxiliary(_avl_tree_t* pt_avl_tree, _avlnode_t* pt_node);
 
+/**
+ * Initialize the element of new node auxiliary function
+ * @param pt_avl_tree           avl tree.
+ * @param pt_node               avl node.
+ * @return void.
+ * @remarks if pt_avl_tree == NULL or pt_node == NULL, then the behavior is undefined. pt_avl_tree must be initialized or
+ *          created by _create_avl_tree(), and pt_node must be allocated with _t_nodesize, otherwise the behavior is undefined.
+ */
+extern void _avl_tree_init_node_auxiliary(_avl_tree_t* pt_avl_tree, _avlnode_t* pt_node);
+
 /**
  * Element compare function auxiliary
  * @param cpt_avl_tree          avl tree.
@@ -256,6 +268,20 @@ extern void _avl_tree_init_elem_auxiliary(_avl_tree_t* pt_avl_tree, _avlnode_t*
 extern void _avl_tree_elem_compare_auxiliary(
     const _avl_tree_t* cpt_avl_tree, const void* cpv_first, const void* cpv_second, void* pv_output);
 
+/**
+ * Element three-way compare function auxiliary
+ * @param cpt_avl_tree          avl tree.
+ * @param cpv_first             first element.
+ * @param cpv_second            second element.
+ * @return negative if the first element is less than the second element, positive if it is greater, otherwise zero.
+ * @remarks if cpt_avl_tree == NULL, cpv_first == NULL or cpv_second == NULL, then the behavior is undefined. cpt_avl_tree
+ *          must be initialized or created by _create_avl_tree(), otherwise the behavior is undefined. The three-way compare function
+ *          of element type is invoked once when the avl tree is ordered by the less function of element type,
+ *          otherwise the compare function of avl tree is invoked twice.
+ */
+extern int _avl_tree_elem_three_way_compare_auxiliary(
+    const _avl_tree_t* cpt_avl_tree, const void* cpv_first, const void* cpv_second);
+
 #ifdef __cplusplus
 }
 #endif
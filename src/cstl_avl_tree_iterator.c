@@ -81,7 +81,7 @@ void _avl_tree_iterator_get_value(_avl_tree_iterator_t it_iter, void* pv_value)
     assert(!_avl_tree_iterator_equal(it_iter, _avl_tree_end(_AVL_TREE_ITERATOR_TREE(it_iter))));
 
     /* char* */
-    if (strncmp(_GET_AVL_TREE_TYPE_BASENAME(_AVL_TREE_ITERATOR_TREE(it_iter)), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_AVL_TREE_TYPE_ID(_AVL_TREE_ITERATOR_TREE(it_iter)) == _TYPE_ID_C_STRING) {
         *(char**)pv_value = (char*)string_c_str((string_t*)((_avlnode_t*)_AVL_TREE_ITERATOR_COREPOS(it_iter))->_pby_data);
     } else {
         bool_t b_result = _GET_AVL_TREE_TYPE_SIZE(_AVL_TREE_ITERATOR_TREE(it_iter));
@@ -100,7 +100,7 @@ const void* _avl_tree_iterator_get_pointer(_avl_tree_iterator_t it_iter)
     assert(!_avl_tree_iterator_equal(it_iter, _avl_tree_end(_AVL_TREE_ITERATOR_TREE(it_iter))));
 
     /* char* */
-    if (strncmp(_GET_AVL_TREE_TYPE_BASENAME(_AVL_TREE_ITERATOR_TREE(it_iter)), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_AVL_TREE_TYPE_ID(_AVL_TREE_ITERATOR_TREE(it_iter)) == _TYPE_ID_C_STRING) {
         return (char*)string_c_str((string_t*)((_avlnode_t*)_AVL_TREE_ITERATOR_COREPOS(it_iter))->_pby_data);
     } else {
         return ((_avlnode_t*)_AVL_TREE_ITERATOR_COREPOS(it_iter))->_pby_data;
@@ -26,6 +26,7 @@
 #include <cstl/cstl_types.h>
 #include <cstl/citerator.h>
 #include <cstl/cstring.h>
+#include <cstl/cutility.h>
 
 #include <cstl/cstl_avl_tree_iterator.h>
 #include <cstl/cstl_avl_tree_private.h>
@@ -64,6 +65,8 @@ bool_t _create_avl_tree_auxiliary(_avl_tree_t* pt_avl_tree, const char* s_typena
     pt_avl_tree->_t_avlroot._un_height = 0;
 
     pt_avl_tree->_t_nodecount = 0;
+    pt_avl_tree->_t_nodesize =
+        _AVL_TREE_NODE_SIZE(_GET_AVL_TREE_TYPE_SIZE(pt_avl_tree)) + _pair_get_inline_size(&pt_avl_tree->_t_typeinfo);
     pt_avl_tree->_t_compare = NULL;
 
     _alloc_init(&pt_avl_tree->_t_allocator);
@@ -78,8 +81,14 @@ void _avl_tree_destroy_auxiliary(_avl_tree_t* pt_avl_tree)
     assert(pt_avl_tree != NULL);
     assert(_avl_tree_is_inited(pt_avl_tree) || _avl_tree_is_created(pt_avl_tree));
 
-    /* destroy all elements */
-    pt_avl_tree->_t_avlroot._pt_parent = _avl_tree_destroy_subtree(pt_avl_tree, pt_avl_tree->_t_avlroot._pt_parent);
+    /* destroy all elements, the elements in region that need not be destroyed are released with the region */
+    if (_alloc_is_region(&pt_avl_tree->_t_allocator) &&
+        (_type_is_trivially_destructible(&pt_avl_tree->_t_typeinfo) ||
+         _pair_is_inline_trivially_destructible(&pt_avl_tree->_t_typeinfo))) {
+        pt_avl_tree->_t_avlroot._pt_parent = NULL;
+    } else {
+        pt_avl_tree->_t_avlroot._pt_parent = _avl_tree_destroy_subtree(pt_avl_tree, pt_avl_tree->_t_avlroot._pt_parent);
+    }
     assert(pt_avl_tree->_t_avlroot._pt_parent == NULL);
     pt_avl_tree->_t_avlroot._pt_left = &pt_avl_tree->_t_avlroot;
     pt_avl_tree->_t_avlroot._pt_right = &pt_avl_tree->_t_avlroot;
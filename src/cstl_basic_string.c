@@ -203,7 +203,7 @@ size_t basic_string_copy(const basic_string_t* cpt_basic_string, void* pv_buffer
     pby_pos = cpt_basic_string->_pby_string + t_pos * t_typesize;
     pby_terminator = cpt_basic_string->_pby_string + basic_string_size(cpt_basic_string) * t_typesize;
 
-    if (strncmp(_GET_BASIC_STRING_TYPE_BASENAME(cpt_basic_string), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_BASIC_STRING_TYPE_ID(cpt_basic_string) == _TYPE_ID_C_STRING) {
         for (i = 0; i < t_size; ++i) {
             if (memcmp(pby_terminator, pby_pos + i * t_typesize, t_typesize) != 0) {
                 *((const char**)pv_buffer + i) = string_c_str((string_t*)(pby_pos + i * t_typesize));
@@ -452,7 +452,7 @@ int basic_string_compare_substring_substring(
     pby_second = cpt_second->_pby_string + t_secondpos * t_typesize;
     pby_terminator = cpt_first->_pby_string + basic_string_size(cpt_first) * t_typesize;
     if (_GET_BASIC_STRING_TYPE_STYLE(cpt_first) == _TYPE_CSTL_BUILTIN ||
-        strncmp(_GET_BASIC_STRING_TYPE_BASENAME(cpt_first), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+        _GET_BASIC_STRING_TYPE_ID(cpt_first) == _TYPE_ID_C_STRING) {
         for (i = 0; i < t_cmplen; ++i) {
             int n_first = memcmp(pby_terminator, pby_first, t_typesize);
             int n_second = memcmp(pby_terminator, pby_second, t_typesize);
@@ -559,7 +559,7 @@ int basic_string_compare_substring_subcstr(
     assert(pby_string != NULL);
 
     /* char* */
-    if (strncmp(_GET_BASIC_STRING_TYPE_BASENAME(cpt_basic_string), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_BASIC_STRING_TYPE_ID(cpt_basic_string) == _TYPE_ID_C_STRING) {
         for (i = 0; i < t_cmplen; ++i) {
             int n_result = memcmp(pby_terminator, pby_string + i * t_typesize, t_typesize);
 
@@ -163,11 +163,11 @@ size_t _basic_string_get_value_string_length(const basic_string_t* cpt_basic_str
     assert(_basic_string_is_inited(cpt_basic_string) || _basic_string_is_created(cpt_basic_string));
 
     t_typesize = _GET_BASIC_STRING_TYPE_SIZE(cpt_basic_string);
-    if (strncmp(_GET_BASIC_STRING_TYPE_BASENAME(cpt_basic_string), _CHAR_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_BASIC_STRING_TYPE_ID(cpt_basic_string) == _TYPE_ID_CHAR) {
         /* char type */
         assert(t_typesize == 1);
         return strlen(cpv_value_string);
-    } else if (strncmp(_GET_BASIC_STRING_TYPE_BASENAME(cpt_basic_string), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    } else if (_GET_BASIC_STRING_TYPE_ID(cpt_basic_string) == _TYPE_ID_C_STRING) {
         /* char* type */
         char** ps_terminator = NULL;
 
@@ -352,7 +352,7 @@ void _basic_string_copy_substring_auxiliary(
      * which improves efficiency.
      */
     if (_GET_BASIC_STRING_TYPE_STYLE(cpt_basic_string) == _TYPE_C_BUILTIN &&
-        strncmp(_GET_BASIC_STRING_TYPE_BASENAME(cpt_basic_string), _C_STRING_TYPE, _TYPE_NAME_SIZE) != 0) {
+        _GET_BASIC_STRING_TYPE_ID(cpt_basic_string) != _TYPE_ID_C_STRING) {
         for (i = 0; i < t_len; ++i) {
             bool_t b_result = _GET_BASIC_STRING_TYPE_SIZE(cpt_basic_string);
             _GET_BASIC_STRING_TYPE_COPY_FUNCTION(cpt_basic_string)(pby_dest, pby_src, &b_result);
@@ -389,7 +389,7 @@ void _basic_string_copy_substring_backward_auxiliary(
     pby_src = pby_src + (t_len - 1) * _GET_BASIC_STRING_TYPE_SIZE(cpt_basic_string);
 
     if (_GET_BASIC_STRING_TYPE_STYLE(cpt_basic_string) == _TYPE_C_BUILTIN &&
-        strncmp(_GET_BASIC_STRING_TYPE_BASENAME(cpt_basic_string), _C_STRING_TYPE, _TYPE_NAME_SIZE) != 0) {
+        _GET_BASIC_STRING_TYPE_ID(cpt_basic_string) != _TYPE_ID_C_STRING) {
         for (i = 0; i < t_len; ++i) {
             bool_t b_result = _GET_BASIC_STRING_TYPE_SIZE(cpt_basic_string);
             _GET_BASIC_STRING_TYPE_COPY_FUNCTION(cpt_basic_string)(pby_dest, pby_src, &b_result);
@@ -426,7 +426,7 @@ void _basic_string_copy_subcstr_auxiliary(
     t_typesize = _GET_BASIC_STRING_TYPE_SIZE(cpt_basic_string);
     pby_terminator = cpt_basic_string->_pby_string + basic_string_size(cpt_basic_string) * t_typesize;
     /* char* */
-    if (strncmp(_GET_BASIC_STRING_TYPE_BASENAME(cpt_basic_string), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_BASIC_STRING_TYPE_ID(cpt_basic_string) == _TYPE_ID_C_STRING) {
         for (i = 0; i < t_len; ++i) {
             n_dest_terminator = memcmp(pby_terminator, pby_dest + i * t_typesize, t_typesize);
 
@@ -495,7 +495,7 @@ void _basic_string_copy_range_auxiliary(
      * which improves efficiency.
      */
     if (_GET_BASIC_STRING_TYPE_STYLE(cpt_basic_string) == _TYPE_C_BUILTIN &&
-        strncmp(_GET_BASIC_STRING_TYPE_BASENAME(cpt_basic_string), _C_STRING_TYPE, _TYPE_NAME_SIZE) != 0) {
+        _GET_BASIC_STRING_TYPE_ID(cpt_basic_string) != _TYPE_ID_C_STRING) {
         for (it = it_begin; !iterator_equal(it, it_end); it = iterator_next(it)) {
             bool_t b_result = _GET_BASIC_STRING_TYPE_SIZE(cpt_basic_string);
             _GET_BASIC_STRING_TYPE_COPY_FUNCTION(cpt_basic_string)(
@@ -540,7 +540,7 @@ void _basic_string_copy_elem_auxiliary(
          * which improves efficiency.
          */
         if (_GET_BASIC_STRING_TYPE_STYLE(cpt_basic_string) == _TYPE_C_BUILTIN &&
-            strncmp(_GET_BASIC_STRING_TYPE_BASENAME(cpt_basic_string), _C_STRING_TYPE, _TYPE_NAME_SIZE) != 0) {
+            _GET_BASIC_STRING_TYPE_ID(cpt_basic_string) != _TYPE_ID_C_STRING) {
             for (i = 0; i < t_count; ++i) {
                 bool_t b_result = _GET_BASIC_STRING_TYPE_SIZE(cpt_basic_string);
                 _GET_BASIC_STRING_TYPE_COPY_FUNCTION(cpt_basic_string)(pby_dest, pv_varg, &b_result);
@@ -580,7 +580,7 @@ void _basic_string_destroy_elem_range_auxiliary(
         basic_string_size(cpt_basic_string) * _GET_BASIC_STRING_TYPE_SIZE(cpt_basic_string);
 
     if (_GET_BASIC_STRING_TYPE_STYLE(cpt_basic_string) == _TYPE_C_BUILTIN &&
-        strncmp(_GET_BASIC_STRING_TYPE_BASENAME(cpt_basic_string), _C_STRING_TYPE, _TYPE_NAME_SIZE) != 0) {
+        _GET_BASIC_STRING_TYPE_ID(cpt_basic_string) != _TYPE_ID_C_STRING) {
         for (i = 0; i < t_len; ++i) {
             bool_t b_result = _GET_BASIC_STRING_TYPE_SIZE(cpt_basic_string);
             _GET_BASIC_STRING_TYPE_DESTROY_FUNCTION(cpt_basic_string)(pby_del, &b_result);
@@ -683,7 +683,7 @@ bool_t _basic_string_substring_find(
     pby_index = cpt_find->_pby_string;
 
     if (_GET_BASIC_STRING_TYPE_STYLE(cpt_basic_string) == _TYPE_C_BUILTIN &&
-        strncmp(_GET_BASIC_STRING_TYPE_BASENAME(cpt_basic_string), _C_STRING_TYPE, _TYPE_NAME_SIZE) != 0) {
+        _GET_BASIC_STRING_TYPE_ID(cpt_basic_string) != _TYPE_ID_C_STRING) {
         for (i = 0; i < basic_string_size(cpt_find); ++i) {
             b_less = b_greater = t_typesize;
             _GET_BASIC_STRING_TYPE_LESS_FUNCTION(cpt_basic_string)(pby_string, pby_index, &b_less);
@@ -737,7 +737,7 @@ bool_t _basic_string_value_string_find(
     pby_string = cpt_basic_string->_pby_string + t_pos * t_typesize;
     pby_index = (_byte_t*)cpv_value_string;
     /* char* */
-    if (strncmp(_GET_BASIC_STRING_TYPE_BASENAME(cpt_basic_string), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_BASIC_STRING_TYPE_ID(cpt_basic_string) == _TYPE_ID_C_STRING) {
         for (i = 0; i < t_len; ++i) {
             int n_string_terminator = memcmp(pby_terminator, pby_string, t_typesize);
 
@@ -34,6 +34,7 @@ extern "C" {
 #define _GET_BASIC_STRING_TYPE_SIZE(pt_basic_string)             ((pt_basic_string)->_t_typeinfo._pt_type->_t_typesize)
 #define _GET_BASIC_STRING_TYPE_NAME(pt_basic_string)             ((pt_basic_string)->_t_typeinfo._s_typename)
 #define _GET_BASIC_STRING_TYPE_BASENAME(pt_basic_string)         ((pt_basic_string)->_t_typeinfo._pt_type->_s_typename)
+#define _GET_BASIC_STRING_TYPE_ID(pt_basic_string)               ((pt_basic_string)->_t_typeinfo._pt_type->_t_typeid)
 #define _GET_BASIC_STRING_TYPE_INIT_FUNCTION(pt_basic_string)    ((pt_basic_string)->_t_typeinfo._pt_type->_t_typeinit)
 #define _GET_BASIC_STRING_TYPE_COPY_FUNCTION(pt_basic_string)    ((pt_basic_string)->_t_typeinfo._pt_type->_t_typecopy)
 #define _GET_BASIC_STRING_TYPE_LESS_FUNCTION(pt_basic_string)    ((pt_basic_string)->_t_typeinfo._pt_type->_t_typeless)
@@ -91,7 +91,7 @@ void _basic_string_iterator_get_value(basic_string_iterator_t it_iter, void* pv_
     pby_terminator = pt_basic_string->_pby_string + basic_string_size(pt_basic_string) * t_typesize;
 
     /* char* */
-    if (strncmp(_GET_BASIC_STRING_TYPE_BASENAME(pt_basic_string), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_BASIC_STRING_TYPE_ID(pt_basic_string) == _TYPE_ID_C_STRING) {
         if (memcmp(pby_terminator, _BASIC_STRING_ITERATOR_COREPOS(it_iter), t_typesize) != 0) {
             *(char**)pv_value = (char*)string_c_str((string_t*)_BASIC_STRING_ITERATOR_COREPOS(it_iter));
         } else {
@@ -127,7 +127,7 @@ void _basic_string_iterator_set_value(basic_string_iterator_t it_iter, const voi
     assert(!_basic_string_iterator_equal(it_iter, basic_string_end(_BASIC_STRING_ITERATOR_CONTAINER(it_iter))));
 
     if (_iterator_get_typestyle(it_iter) == _TYPE_C_BUILTIN &&
-        strncmp(_iterator_get_typebasename(it_iter), _C_STRING_TYPE, _TYPE_NAME_SIZE) != 0) {
+        _iterator_get_typeid(it_iter) != _TYPE_ID_C_STRING) {
         _basic_string_copy_subcstr_auxiliary(
             _BASIC_STRING_ITERATOR_CONTAINER(it_iter), _BASIC_STRING_ITERATOR_COREPOS(it_iter), cpv_value, 1);
     } else {
@@ -145,8 +145,7 @@ const void* _basic_string_iterator_get_pointer(basic_string_iterator_t it_iter)
     assert(!_basic_string_iterator_equal(it_iter, basic_string_end(_BASIC_STRING_ITERATOR_CONTAINER(it_iter))));
 
     /* char* */
-    if (strncmp(_GET_BASIC_STRING_TYPE_BASENAME(_BASIC_STRING_ITERATOR_CONTAINER(it_iter)),
-                _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_BASIC_STRING_TYPE_ID(_BASIC_STRING_ITERATOR_CONTAINER(it_iter)) == _TYPE_ID_C_STRING) {
         basic_string_t* pt_basic_string = _BASIC_STRING_ITERATOR_CONTAINER(it_iter);
         size_t t_typesize = _GET_BASIC_STRING_TYPE_SIZE(pt_basic_string);
         _byte_t* pby_terminator = pt_basic_string->_pby_string + basic_string_size(pt_basic_string) * t_typesize;
@@ -93,7 +93,7 @@ _basic_string_rep_t* _basic_string_rep_reduce_shared(
          * which improves efficiency.
          */
         if (pt_typeinfo->_t_style == _TYPE_C_BUILTIN &&
-            strncmp(pt_typeinfo->_pt_type->_s_typename, _C_STRING_TYPE, _TYPE_NAME_SIZE) != 0) {
+            pt_typeinfo->_pt_type->_t_typeid != _TYPE_ID_C_STRING) {
             for (i = 0; i < pt_rep->_t_length; ++i) {
                 b_result = pt_rep->_t_elemsize;
                 ufun_destroy(pby_string, &b_result);
@@ -362,7 +362,7 @@ size_t _basic_string_find_elem_varg(const basic_string_t* cpt_basic_string, size
     t_findpos = t_pos;
 
     if (_GET_BASIC_STRING_TYPE_STYLE(cpt_basic_string) == _TYPE_C_BUILTIN &&
-        strncmp(_GET_BASIC_STRING_TYPE_BASENAME(cpt_basic_string), _C_STRING_TYPE, _TYPE_NAME_SIZE) != 0) {
+        _GET_BASIC_STRING_TYPE_ID(cpt_basic_string) != _TYPE_ID_C_STRING) {
         while (t_findpos != t_len) {
             b_less = b_greater = t_typesize;
             _GET_BASIC_STRING_TYPE_LESS_FUNCTION(cpt_basic_string)(pby_string + t_findpos * t_typesize, pv_varg, &b_less);
@@ -449,7 +449,7 @@ size_t _basic_string_rfind_elem_varg(const basic_string_t* cpt_basic_string, siz
     t_findpos = t_pos < basic_string_size(cpt_basic_string) ? t_pos + 1 : basic_string_size(cpt_basic_string);
 
     if (_GET_BASIC_STRING_TYPE_STYLE(cpt_basic_string) == _TYPE_C_BUILTIN &&
-        strncmp(_GET_BASIC_STRING_TYPE_BASENAME(cpt_basic_string), _C_STRING_TYPE, _TYPE_NAME_SIZE) != 0) {
+        _GET_BASIC_STRING_TYPE_ID(cpt_basic_string) != _TYPE_ID_C_STRING) {
         while (t_findpos-- > 0) {
             /* The t_findpos is NPOS when underflow. */
             b_less = b_greater = t_typesize;
@@ -526,7 +526,7 @@ size_t _basic_string_find_first_not_of_elem_varg(const basic_string_t* cpt_basic
     pby_terminator = cpt_basic_string->_pby_string + t_len * t_typesize;
 
     if (_GET_BASIC_STRING_TYPE_STYLE(cpt_basic_string) == _TYPE_C_BUILTIN &&
-        strncmp(_GET_BASIC_STRING_TYPE_BASENAME(cpt_basic_string), _C_STRING_TYPE, _TYPE_NAME_SIZE) != 0) {
+        _GET_BASIC_STRING_TYPE_ID(cpt_basic_string) != _TYPE_ID_C_STRING) {
         for (; t_pos < t_len; ++t_pos) {
             pby_string = cpt_basic_string->_pby_string + t_pos * t_typesize;
             b_less = b_greater = t_typesize;
@@ -614,7 +614,7 @@ size_t _basic_string_find_last_not_of_elem_varg(const basic_string_t* cpt_basic_
         pby_terminator = cpt_basic_string->_pby_string + t_len * t_typesize;
 
         if (_GET_BASIC_STRING_TYPE_STYLE(cpt_basic_string) == _TYPE_C_BUILTIN &&
-            strncmp(_GET_BASIC_STRING_TYPE_BASENAME(cpt_basic_string), _C_STRING_TYPE, _TYPE_NAME_SIZE) != 0) {
+            _GET_BASIC_STRING_TYPE_ID(cpt_basic_string) != _TYPE_ID_C_STRING) {
             do {
                 b_less = b_greater = t_typesize;
                 pby_string = cpt_basic_string->_pby_string + t_pos * t_typesize;
@@ -204,7 +204,7 @@ void deque_init_copy_array(deque_t* pdeq_dest, const void* cpv_array, size_t t_c
      * the elements of c builtin array are element itself, but the elements of 
      * c string, user define or cstl are pointer of element.
      */
-    if (strncmp(_GET_DEQUE_TYPE_BASENAME(pdeq_dest), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_DEQUE_TYPE_ID(pdeq_dest) == _TYPE_ID_C_STRING) {
         /*
          * We need built a string_t for c string element.
          */
@@ -289,6 +289,20 @@ size_t deque_max_size(const deque_t* cpdeq_deque)
     return (size_t)(-1) / _GET_DEQUE_TYPE_SIZE(cpdeq_deque);
 }
 
+/**
+ * Get the memory that is held by the deque.
+ */
+size_t deque_memory_usage(const deque_t* cpdeq_deque)
+{
+    _allocstat_t t_stat;
+
+    assert(cpdeq_deque != NULL);
+    assert(_deque_is_inited(cpdeq_deque));
+
+    _alloc_get_stat(&cpdeq_deque->_t_allocator, &t_stat);
+    return sizeof(deque_t) + t_stat._t_livesize + t_stat._t_cachedsize;
+}
+
 /**
  * Access first deque data.
  */
@@ -437,7 +451,7 @@ void deque_assign_array(deque_t* pdeq_deque, const void* cpv_array, size_t t_cou
      * the elements of c builtin array are element itself, but the elements of 
      * c string, user define or cstl are pointer of element.
      */
-    if (strncmp(_GET_DEQUE_TYPE_BASENAME(pdeq_deque), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_DEQUE_TYPE_ID(pdeq_deque) == _TYPE_ID_C_STRING) {
         /*
          * We need built a string_t for c string element.
          */
@@ -775,7 +789,7 @@ void deque_insert_array(deque_t* pdeq_deque, deque_iterator_t it_pos, const void
          * the elements of c builtin array are element itself, but the elements of 
          * c string, user define or cstl are pointer of element.
          */
-        if (strncmp(_GET_DEQUE_TYPE_BASENAME(pdeq_deque), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+        if (_GET_DEQUE_TYPE_ID(pdeq_deque) == _TYPE_ID_C_STRING) {
             /*
              * We need built a string_t for c string element.
              */
@@ -818,7 +832,7 @@ void deque_insert_array(deque_t* pdeq_deque, deque_iterator_t it_pos, const void
          * the elements of c builtin array are element itself, but the elements of 
          * c string, user define or cstl are pointer of element.
          */
-        if (strncmp(_GET_DEQUE_TYPE_BASENAME(pdeq_deque), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+        if (_GET_DEQUE_TYPE_ID(pdeq_deque) == _TYPE_ID_C_STRING) {
             /*
              * We need built a string_t for c string element.
              */
@@ -922,6 +936,35 @@ void deque_clear(deque_t* pdeq_deque)
     deque_erase_range(pdeq_deque, deque_begin(pdeq_deque), deque_end(pdeq_deque));
 }
 
+/**
+ * Add element that is pointed by pointer at the end of deque container.
+ */
+void deque_push_back_ptr(deque_t* pdeq_deque, const void* cpv_value)
+{
+    deque_iterator_t it_oldend = _create_deque_iterator();
+
+    assert(pdeq_deque != NULL);
+    assert(_deque_is_inited(pdeq_deque));
+    assert(cpv_value != NULL);
+
+    it_oldend = _deque_expand_at_end(pdeq_deque, 1, NULL);
+    _type_get_ptr_value(&pdeq_deque->_t_typeinfo, cpv_value, _deque_iterator_get_pointer_auxiliary(it_oldend));
+}
+
+/**
+ * Add element that is pointed by pointer at the begin of deque container.
+ */
+void deque_push_front_ptr(deque_t* pdeq_deque, const void* cpv_value)
+{
+    assert(pdeq_deque != NULL);
+    assert(_deque_is_inited(pdeq_deque));
+    assert(cpv_value != NULL);
+
+    _deque_expand_at_begin(pdeq_deque, 1, NULL);
+    _type_get_ptr_value(&pdeq_deque->_t_typeinfo, cpv_value,
+        _deque_iterator_get_pointer_auxiliary(deque_begin(pdeq_deque)));
+}
+
 /** local function implementation section **/
 
 /** eof **/
@@ -35,6 +35,29 @@
 /** local data type declaration and local struct, union, enum section **/
 
 /** local function prototype section **/
+/**
+ * Move elements of trivially copyable type backward chunk by chunk.
+ * @param pdeq_deque    deque container.
+ * @param it_end        end of source range.
+ * @param it_targetend  end of target range.
+ * @param t_count       element count.
+ * @return void.
+ * @remarks the target range must be after the source range.
+ */
+static void _deque_move_trivially_backward(
+    deque_t* pdeq_deque, deque_iterator_t it_end, deque_iterator_t it_targetend, size_t t_count);
+
+/**
+ * Move elements of trivially copyable type forward chunk by chunk.
+ * @param pdeq_deque      deque container.
+ * @param it_begin        begin of source range.
+ * @param it_targetbegin  begin of target range.
+ * @param t_count         element count.
+ * @return void.
+ * @remarks the target range must be before the source range.
+ */
+static void _deque_move_trivially_forward(
+    deque_t* pdeq_deque, deque_iterator_t it_begin, deque_iterator_t it_targetbegin, size_t t_count);
 
 /** exported global variable definition section **/
 
@@ -555,10 +578,12 @@ void _deque_shrink_at_end(deque_t* pdeq_deque, size_t t_shrinksize)
     assert(_deque_iterator_belong_to_deque(pdeq_deque, it_newend));
 
     /* destroy all elements */
-    for (it_iter = it_newend; !iterator_equal(it_iter, it_oldend); it_iter = iterator_next(it_iter)) {
-        b_result = _GET_DEQUE_TYPE_SIZE(pdeq_deque);
-        _GET_DEQUE_TYPE_DESTROY_FUNCTION(pdeq_deque)(_deque_iterator_get_pointer_auxiliary(it_iter), &b_result);
-        assert(b_result);
+    if (!_type_is_trivially_destructible(&pdeq_deque->_t_typeinfo)) {
+        for (it_iter = it_newend; !iterator_equal(it_iter, it_oldend); it_iter = iterator_next(it_iter)) {
+            b_result = _GET_DEQUE_TYPE_SIZE(pdeq_deque);
+            _GET_DEQUE_TYPE_DESTROY_FUNCTION(pdeq_deque)(_deque_iterator_get_pointer_auxiliary(it_iter), &b_result);
+            assert(b_result);
+        }
     }
     pdeq_deque->_t_finish = it_newend;
 
@@ -588,10 +613,12 @@ void _deque_shrink_at_begin(deque_t* pdeq_deque, size_t t_shrinksize)
     assert(_deque_iterator_belong_to_deque(pdeq_deque, it_newbegin));
 
     /* destroy all elements */
-    for (it_iter = it_oldbegin; !iterator_equal(it_iter, it_newbegin); it_iter = iterator_next(it_iter)) {
-        b_result = _GET_DEQUE_TYPE_SIZE(pdeq_deque);
-        _GET_DEQUE_TYPE_DESTROY_FUNCTION(pdeq_deque)(_deque_iterator_get_pointer_auxiliary(it_iter), &b_result);
-        assert(b_result);
+    if (!_type_is_trivially_destructible(&pdeq_deque->_t_typeinfo)) {
+        for (it_iter = it_oldbegin; !iterator_equal(it_iter, it_newbegin); it_iter = iterator_next(it_iter)) {
+            b_result = _GET_DEQUE_TYPE_SIZE(pdeq_deque);
+            _GET_DEQUE_TYPE_DESTROY_FUNCTION(pdeq_deque)(_deque_iterator_get_pointer_auxiliary(it_iter), &b_result);
+            assert(b_result);
+        }
     }
     pdeq_deque->_t_start = it_newbegin;
 
@@ -626,6 +653,11 @@ deque_iterator_t _deque_move_elem_to_end(
         it_targetend = iterator_next_n(it_targetend, t_step);
         assert(_deque_iterator_before(it_targetbegin, it_targetend));
 
+        if (_type_is_trivially_copyable(&pdeq_deque->_t_typeinfo)) {
+            _deque_move_trivially_backward(pdeq_deque, it_end, it_targetend, iterator_distance(it_begin, it_end));
+            return it_begin;
+        }
+
         while (!iterator_equal(it_targetbegin, it_targetend) && !iterator_equal(it_begin, it_end)) {
             it_targetend = iterator_prev(it_targetend);
             it_end = iterator_prev(it_end);
@@ -664,6 +696,11 @@ deque_iterator_t _deque_move_elem_to_begin(
         it_targetend = iterator_prev_n(it_targetend, t_step);
         assert(_deque_iterator_before(it_targetbegin, it_targetend));
 
+        if (_type_is_trivially_copyable(&pdeq_deque->_t_typeinfo)) {
+            _deque_move_trivially_forward(pdeq_deque, it_begin, it_targetbegin, iterator_distance(it_begin, it_end));
+            return it_targetend;
+        }
+
         for (;
              iterator_less(it_targetbegin, it_targetend) && iterator_less(it_begin, it_end);
              it_targetbegin = iterator_next(it_targetbegin), it_begin = iterator_next(it_begin)) {
@@ -766,6 +803,78 @@ void* _deque_iterator_get_pointer_auxiliary(iterator_t it_iter)
 }
 
 /** local function implementation section **/
+/**
+ * Move elements of trivially copyable type backward chunk by chunk.
+ */
+static void _deque_move_trivially_backward(
+    deque_t* pdeq_deque, deque_iterator_t it_end, deque_iterator_t it_targetend, size_t t_count)
+{
+    size_t        t_chunksize = _GET_DEQUE_TYPE_SIZE(pdeq_deque) * _DEQUE_ELEM_COUNT;
+    size_t        t_movesize = _GET_DEQUE_TYPE_SIZE(pdeq_deque) * t_count;
+    size_t        t_step = 0;
+    _mappointer_t ppby_src = _DEQUE_ITERATOR_MAP_POINTER(it_end);
+    _mappointer_t ppby_dest = _DEQUE_ITERATOR_MAP_POINTER(it_targetend);
+    size_t        t_srcoffset = _DEQUE_ITERATOR_COREPOS(it_end) - _DEQUE_ITERATOR_FIRST_POS(it_end);
+    size_t        t_destoffset = _DEQUE_ITERATOR_COREPOS(it_targetend) - _DEQUE_ITERATOR_FIRST_POS(it_targetend);
+
+    assert(pdeq_deque != NULL);
+    assert(_type_is_trivially_copyable(&pdeq_deque->_t_typeinfo));
+
+    /* the offset is the size of elements before the position in chunk */
+    while (t_movesize > 0) {
+        if (t_srcoffset == 0) {
+            --ppby_src;
+            t_srcoffset = t_chunksize;
+        }
+        if (t_destoffset == 0) {
+            --ppby_dest;
+            t_destoffset = t_chunksize;
+        }
+
+        t_step = t_movesize < t_srcoffset ? t_movesize : t_srcoffset;
+        t_step = t_step < t_destoffset ? t_step : t_destoffset;
+        t_srcoffset -= t_step;
+        t_destoffset -= t_step;
+        memmove(*ppby_dest + t_destoffset, *ppby_src + t_srcoffset, t_step);
+        t_movesize -= t_step;
+    }
+}
+
+/**
+ * Move elements of trivially copyable type forward chunk by chunk.
+ */
+static void _deque_move_trivially_forward(
+    deque_t* pdeq_deque, deque_iterator_t it_begin, deque_iterator_t it_targetbegin, size_t t_count)
+{
+    size_t        t_chunksize = _GET_DEQUE_TYPE_SIZE(pdeq_deque) * _DEQUE_ELEM_COUNT;
+    size_t        t_movesize = _GET_DEQUE_TYPE_SIZE(pdeq_deque) * t_count;
+    size_t        t_step = 0;
+    _mappointer_t ppby_src = _DEQUE_ITERATOR_MAP_POINTER(it_begin);
+    _mappointer_t ppby_dest = _DEQUE_ITERATOR_MAP_POINTER(it_targetbegin);
+    size_t        t_srcoffset = _DEQUE_ITERATOR_COREPOS(it_begin) - _DEQUE_ITERATOR_FIRST_POS(it_begin);
+    size_t        t_destoffset = _DEQUE_ITERATOR_COREPOS(it_targetbegin) - _DEQUE_ITERATOR_FIRST_POS(it_targetbegin);
+
+    assert(pdeq_deque != NULL);
+    assert(_type_is_trivially_copyable(&pdeq_deque->_t_typeinfo));
+
+    while (t_movesize > 0) {
+        if (t_srcoffset == t_chunksize) {
+            ++ppby_src;
+            t_srcoffset = 0;
+        }
+        if (t_destoffset == t_chunksize) {
+            ++ppby_dest;
+            t_destoffset = 0;
+        }
+
+        t_step = t_movesize < t_chunksize - t_srcoffset ? t_movesize : t_chunksize - t_srcoffset;
+        t_step = t_step < t_chunksize - t_destoffset ? t_step : t_chunksize - t_destoffset;
+        memmove(*ppby_dest + t_destoffset, *ppby_src + t_srcoffset, t_step);
+        t_srcoffset += t_step;
+        t_destoffset += t_step;
+        t_movesize -= t_step;
+    }
+}
 
 /** eof **/
 
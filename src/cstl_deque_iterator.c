@@ -149,7 +149,7 @@ void _deque_iterator_get_value(deque_iterator_t it_iter, void* pv_value)
     assert(!iterator_equal(it_iter, deque_end(_DEQUE_ITERATOR_CONTAINER(it_iter))));
 
     /* char* */
-    if (strncmp(_GET_DEQUE_TYPE_BASENAME(_DEQUE_ITERATOR_CONTAINER(it_iter)), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_DEQUE_TYPE_ID(_DEQUE_ITERATOR_CONTAINER(it_iter)) == _TYPE_ID_C_STRING) {
         *(char**)pv_value = (char*)string_c_str((string_t*)_deque_iterator_get_pointer_auxiliary(it_iter));
     } else {
         b_result = _GET_DEQUE_TYPE_SIZE(_DEQUE_ITERATOR_CONTAINER(it_iter));
@@ -171,7 +171,7 @@ void _deque_iterator_set_value(deque_iterator_t it_iter, const void* cpv_value)
     assert(!iterator_equal(it_iter, deque_end(_DEQUE_ITERATOR_CONTAINER(it_iter))));
 
     /* char* */
-    if (strncmp(_GET_DEQUE_TYPE_BASENAME(_DEQUE_ITERATOR_CONTAINER(it_iter)), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_DEQUE_TYPE_ID(_DEQUE_ITERATOR_CONTAINER(it_iter)) == _TYPE_ID_C_STRING) {
         string_assign_cstr((string_t*)_deque_iterator_get_pointer_auxiliary(it_iter), (char*)cpv_value);
     } else {
         b_result = _GET_DEQUE_TYPE_SIZE(_DEQUE_ITERATOR_CONTAINER(it_iter));
@@ -190,7 +190,7 @@ const void* _deque_iterator_get_pointer(deque_iterator_t it_iter)
     assert(!iterator_equal(it_iter, deque_end(_DEQUE_ITERATOR_CONTAINER(it_iter))));
 
     /* char* */
-    if (strncmp(_GET_DEQUE_TYPE_BASENAME(_DEQUE_ITERATOR_CONTAINER(it_iter)), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_DEQUE_TYPE_ID(_DEQUE_ITERATOR_CONTAINER(it_iter)) == _TYPE_ID_C_STRING) {
         return string_c_str((string_t*)_deque_iterator_get_pointer_auxiliary(it_iter));
     } else {
         return _deque_iterator_get_pointer_auxiliary(it_iter);
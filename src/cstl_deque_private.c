@@ -63,6 +63,22 @@ deque_t* _create_deque(const char* s_typename)
     return pdeq_new;
 }
 
+/**
+ * Create deque container that uses user defined allocator.
+ */
+deque_t* _create_deque_with_allocator(const allocator_t* cpt_allocator, const char* s_typename)
+{
+    deque_t* pdeq_deque = NULL;
+
+    assert(cpt_allocator != NULL);
+
+    if ((pdeq_deque = _create_deque(s_typename)) != NULL) {
+        _alloc_set_allocator(&pdeq_deque->_t_allocator, cpt_allocator);
+    }
+
+    return pdeq_deque;
+}
+
 /**
  * Create deque container auxiliary function.
  */
@@ -236,13 +252,15 @@ void _deque_destroy_auxiliary(deque_t* pdeq_deque)
 
     if (_deque_is_inited(pdeq_deque)) {
         /* destroy all elements */
-        it_begin = deque_begin(pdeq_deque);
-        it_end = deque_end(pdeq_deque);
-
-        for (it_iter = it_begin; !iterator_equal(it_iter, it_end); it_iter = iterator_next(it_iter)) {
-            b_result = _GET_DEQUE_TYPE_SIZE(pdeq_deque);
-            _GET_DEQUE_TYPE_DESTROY_FUNCTION(pdeq_deque)(_deque_iterator_get_pointer_auxiliary(it_iter), &b_result);
-            assert(b_result);
+        if (!_type_is_trivially_destructible(&pdeq_deque->_t_typeinfo)) {
+            it_begin = deque_begin(pdeq_deque);
+            it_end = deque_end(pdeq_deque);
+
+            for (it_iter = it_begin; !iterator_equal(it_iter, it_end); it_iter = iterator_next(it_iter)) {
+                b_result = _GET_DEQUE_TYPE_SIZE(pdeq_deque);
+                _GET_DEQUE_TYPE_DESTROY_FUNCTION(pdeq_deque)(_deque_iterator_get_pointer_auxiliary(it_iter), &b_result);
+                assert(b_result);
+            }
         }
 
         /* destroy the all element container */
@@ -530,6 +548,23 @@ void _deque_init_elem_auxiliary(deque_t* pdeq_deque, void* pv_elem)
     }
 }
 
+/**
+ * Move the datas of deque into uninitialized memory.
+ */
+void _deque_relocate(deque_t* pdeq_target, deque_t* pdeq_source)
+{
+    assert(pdeq_target != NULL);
+    assert(pdeq_source != NULL);
+    assert(_deque_is_inited(pdeq_source));
+    assert(pdeq_target != pdeq_source);
+
+    *pdeq_target = *pdeq_source;
+
+    /* the pointer to container must be the new address */
+    _ITERATOR_CONTAINER(pdeq_target->_t_start) = pdeq_target;
+    _ITERATOR_CONTAINER(pdeq_target->_t_finish) = pdeq_target;
+}
+
 /** local function implementation section **/
 
 /** eof **/
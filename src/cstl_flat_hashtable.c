@@ -0,0 +1,1124 @@
+/*
+ *  The implementation of flat hashtable.
+ *  Copyright (C)  2008 - 2014  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+/** include section **/
+#include <cstl/cstl_def.h>
+#include <cstl/cstl_alloc.h>
+#include <cstl/cstl_types.h>
+#include <cstl/citerator.h>
+#include <cstl/cvector.h>
+#include <cstl/cstring.h>
+
+#include <cstl/cstl_hashtable_iterator.h>
+#include <cstl/cstl_hashtable_private.h>
+#include <cstl/cstl_flat_hashtable_iterator.h>
+#include <cstl/cstl_flat_hashtable_private.h>
+#include <cstl/cstl_flat_hashtable.h>
+
+#include "cstl_hashtable_aux.h"
+#include "cstl_flat_hashtable_aux.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define _FLAT_HASHTABLE_SSE2
+#endif
+
+/** local constant declaration and local macro section **/
+/* the number of bits of size_t */
+#define _FLAT_HASHTABLE_HASH_BITS           (sizeof(size_t) * 8)
+/* the 7 bits hash fragment that is saved in control byte */
+#define _FLAT_HASHTABLE_H2(t_hash)          ((_byte_t)((t_hash) & 0x7f))
+#define _FLAT_HASHTABLE_H1(t_hash)          ((t_hash) >> 7)
+/* the number of elements that are hashed and prefetched together in batch find */
+#define _FLAT_HASHTABLE_FIND_BATCH_COUNT    16
+
+/** local data type declaration and local struct, union, enum section **/
+
+/** local function prototype section **/
+/**
+ * Get the hash value of element, the value of hash function is mixed, so the low 7 bits and the high bits are both
+ * usable even if the hash function is weak.
+ */
+static size_t _flat_hashtable_hash_value(const _flat_hashtable_t* cpt_hashtable, const void* cpv_value);
+
+/**
+ * Match the control bytes of group, the bit i of result is set if the control byte i is equal to by_ctrl.
+ */
+static unsigned int _flat_hashtable_group_match(const _byte_t* cpby_group, _byte_t by_ctrl);
+
+/**
+ * Match the empty or deleted control bytes of group.
+ */
+static unsigned int _flat_hashtable_group_match_free(const _byte_t* cpby_group);
+
+/**
+ * Get the index of lowest set bit.
+ */
+static size_t _flat_hashtable_lowest_bit(unsigned int t_mask);
+
+/**
+ * Find the slot index of element, if the element is not found, return slot count.
+ */
+static size_t _flat_hashtable_find_slot(const _flat_hashtable_t* cpt_hashtable, const void* cpv_value, size_t t_hash);
+
+/**
+ * Find the first empty or deleted slot in probe sequence.
+ */
+static size_t _flat_hashtable_find_free_slot(const _flat_hashtable_t* cpt_hashtable, size_t t_hash);
+
+/**
+ * Allocate control bytes and slots and move all elements into new slots.
+ */
+static void _flat_hashtable_rehash(_flat_hashtable_t* pt_hashtable, size_t t_slotcount);
+
+/**
+ * Make iterator that reference the specific slot.
+ */
+static _flat_hashtable_iterator_t _flat_hashtable_make_iterator(const _flat_hashtable_t* cpt_hashtable, size_t t_index);
+
+/** exported global variable definition section **/
+
+/** local global variable definition section **/
+
+/** exported function implementation section **/
+/**
+ * Create flat hashtable container.
+ */
+_flat_hashtable_t* _create_flat_hashtable(const char* s_typename)
+{
+    _flat_hashtable_t* pt_hashtable = NULL;
+
+    if ((pt_hashtable = (_flat_hashtable_t*)malloc(sizeof(_flat_hashtable_t))) == NULL) {
+        return NULL;
+    }
+
+    if (!_create_flat_hashtable_auxiliary(pt_hashtable, s_typename)) {
+        free(pt_hashtable);
+        return NULL;
+    }
+
+    return pt_hashtable;
+}
+
+/**
+ * Initialize flat hashtable container.
+ */
+void _flat_hashtable_init(_flat_hashtable_t* pt_hashtable, size_t t_bucketcount, ufun_t ufun_hash, bfun_t bfun_compare)
+{
+    assert(pt_hashtable != NULL);
+    assert(_flat_hashtable_is_created(pt_hashtable));
+
+    /* allocate the control bytes and slots, all slots are empty */
+    pt_hashtable->_t_slotcount = _flat_hashtable_get_slot_count(
+        t_bucketcount > 0 ? t_bucketcount : _FLAT_HASHTABLE_DEFAULT_SLOT_COUNT);
+    pt_hashtable->_pby_ctrl = (_byte_t*)_alloc_allocate(&pt_hashtable->_t_allocator, 1, pt_hashtable->_t_slotcount);
+    pt_hashtable->_pby_slot = (_byte_t*)_alloc_allocate(
+        &pt_hashtable->_t_allocator, _GET_FLAT_HASHTABLE_TYPE_SIZE(pt_hashtable), pt_hashtable->_t_slotcount);
+    assert(pt_hashtable->_pby_ctrl != NULL && pt_hashtable->_pby_slot != NULL);
+    memset(pt_hashtable->_pby_ctrl, _FLAT_HASHTABLE_CTRL_EMPTY, pt_hashtable->_t_slotcount);
+    pt_hashtable->_t_nodecount = 0;
+    pt_hashtable->_t_growthleft = _flat_hashtable_get_capacity_auxiliary(pt_hashtable, pt_hashtable->_t_slotcount);
+
+    /* initialize the hash, compare function */
+    pt_hashtable->_ufun_hash = ufun_hash != NULL ? ufun_hash : _hashtable_default_hash;
+    pt_hashtable->_bfun_compare = bfun_compare != NULL ? bfun_compare : _GET_FLAT_HASHTABLE_TYPE_LESS_FUNCTION(pt_hashtable);
+}
+
+/**
+ * Initialize flat hashtable container with flat hashtable.
+ */
+void _flat_hashtable_init_copy(_flat_hashtable_t* pt_dest, const _flat_hashtable_t* cpt_src)
+{
+    _flat_hashtable_iterator_t it_iter;
+    _flat_hashtable_iterator_t it_begin;
+    _flat_hashtable_iterator_t it_end;
+
+    assert(pt_dest != NULL);
+    assert(cpt_src != NULL);
+    assert(_flat_hashtable_is_created(pt_dest));
+    assert(_flat_hashtable_is_inited(cpt_src));
+    assert(_flat_hashtable_same_type(pt_dest, cpt_src));
+
+    /* initialize the dest flat hashtable with src flat hashtable attribute */
+    pt_dest->_f_maxloadfactor = cpt_src->_f_maxloadfactor;
+    _flat_hashtable_init(pt_dest, _flat_hashtable_bucket_count(cpt_src), cpt_src->_ufun_hash, cpt_src->_bfun_compare);
+    it_begin = _flat_hashtable_begin(cpt_src);
+    it_end = _flat_hashtable_end(cpt_src);
+
+    /* insert element from src to dest */
+    for (it_iter = it_begin;
+         !_flat_hashtable_iterator_equal(it_iter, it_end);
+         it_iter = _flat_hashtable_iterator_next(it_iter)) {
+        _flat_hashtable_insert_unique(pt_dest, _flat_hashtable_iterator_get_pointer_ignore_cstr(it_iter));
+    }
+}
+
+/**
+ * Initialize flat hashtable container with specific range.
+ */
+void _flat_hashtable_init_copy_unique_range(
+    _flat_hashtable_t* pt_dest, iterator_t it_begin, iterator_t it_end, size_t t_bucketcount,
+    ufun_t ufun_hash, bfun_t bfun_compare)
+{
+    assert(pt_dest != NULL);
+    assert(_flat_hashtable_is_created(pt_dest));
+    assert(_flat_hashtable_same_iterator_type(pt_dest, it_begin));
+    assert(_flat_hashtable_same_iterator_type(pt_dest, it_end));
+    assert(iterator_equal(it_begin, it_end) || _iterator_before(it_begin, it_end));
+
+    _flat_hashtable_init(pt_dest, t_bucketcount, ufun_hash, bfun_compare);
+    _flat_hashtable_insert_unique_range(pt_dest, it_begin, it_end);
+}
+
+/**
+ * Initialize flat hashtable container with specific array.
+ */
+void _flat_hashtable_init_copy_unique_array(
+    _flat_hashtable_t* pt_dest, const void* cpv_array, size_t t_count, size_t t_bucketcount,
+    ufun_t ufun_hash, bfun_t bfun_compare)
+{
+    assert(pt_dest != NULL);
+    assert(_flat_hashtable_is_created(pt_dest));
+    assert(cpv_array != NULL);
+
+    _flat_hashtable_init(pt_dest, t_bucketcount, ufun_hash, bfun_compare);
+    _flat_hashtable_insert_unique_array(pt_dest, cpv_array, t_count);
+}
+
+/**
+ * Destroy flat hashtable.
+ */
+void _flat_hashtable_destroy(_flat_hashtable_t* pt_hashtable)
+{
+    _flat_hashtable_destroy_auxiliary(pt_hashtable);
+    free(pt_hashtable);
+}
+
+/**
+ * Resize.
+ */
+void _flat_hashtable_resize(_flat_hashtable_t* pt_hashtable, size_t t_resize)
+{
+    assert(pt_hashtable != NULL);
+    assert(_flat_hashtable_is_inited(pt_hashtable));
+
+    if (t_resize > _flat_hashtable_bucket_count(pt_hashtable)) {
+        _flat_hashtable_rehash(pt_hashtable, _flat_hashtable_get_slot_count(t_resize));
+    }
+}
+
+/**
+ * Reserve slots for specific number of elements.
+ */
+void _flat_hashtable_reserve(_flat_hashtable_t* pt_hashtable, size_t t_elemcount)
+{
+    size_t t_slotcount = 0;
+
+    assert(pt_hashtable != NULL);
+    assert(_flat_hashtable_is_inited(pt_hashtable));
+
+    t_slotcount = _flat_hashtable_get_least_slot_count_auxiliary(pt_hashtable, t_elemcount);
+    if (t_slotcount > pt_hashtable->_t_slotcount) {
+        _flat_hashtable_rehash(pt_hashtable, t_slotcount);
+    }
+}
+
+/**
+ * Shrink the slots to fit the elements.
+ */
+void _flat_hashtable_shrink_to_fit(_flat_hashtable_t* pt_hashtable)
+{
+    size_t t_slotcount = 0;
+
+    assert(pt_hashtable != NULL);
+    assert(_flat_hashtable_is_inited(pt_hashtable));
+
+    t_slotcount = _flat_hashtable_get_least_slot_count_auxiliary(pt_hashtable, pt_hashtable->_t_nodecount);
+    if (t_slotcount < pt_hashtable->_t_slotcount) {
+        _flat_hashtable_rehash(pt_hashtable, t_slotcount);
+    }
+}
+
+/**
+ * Inserts an unique element into a flat hashtable.
+ */
+_flat_hashtable_iterator_t _flat_hashtable_insert_unique(_flat_hashtable_t* pt_hashtable, const void* cpv_value)
+{
+    size_t t_hash = 0;
+    size_t t_index = 0;
+    size_t t_slotcount = 0;
+    bool_t b_result = false;
+
+    assert(pt_hashtable != NULL);
+    assert(cpv_value != NULL);
+    assert(_flat_hashtable_is_inited(pt_hashtable));
+
+    t_hash = _flat_hashtable_hash_value(pt_hashtable, cpv_value);
+    if (_flat_hashtable_find_slot(pt_hashtable, cpv_value, t_hash) != pt_hashtable->_t_slotcount) {
+        return _flat_hashtable_end(pt_hashtable);
+    }
+
+    /*
+     * There is no empty slot can be used, grow the flat hashtable if it is more than half full, otherwise
+     * rehash in place to drop the deleted slots.
+     */
+    if (pt_hashtable->_t_growthleft == 0) {
+        if (pt_hashtable->_t_nodecount + 1 >
+            _flat_hashtable_get_capacity_auxiliary(pt_hashtable, pt_hashtable->_t_slotcount) / 2) {
+            /* the slot count is doubled at least, a small max load factor may need more */
+            t_slotcount = _flat_hashtable_get_least_slot_count_auxiliary(pt_hashtable, pt_hashtable->_t_nodecount + 1);
+            if (t_slotcount < pt_hashtable->_t_slotcount * 2) {
+                t_slotcount = pt_hashtable->_t_slotcount * 2;
+            }
+            _flat_hashtable_rehash(pt_hashtable, t_slotcount);
+        } else {
+            _flat_hashtable_rehash(pt_hashtable, pt_hashtable->_t_slotcount);
+        }
+    }
+
+    t_index = _flat_hashtable_find_free_slot(pt_hashtable, t_hash);
+    if (pt_hashtable->_pby_ctrl[t_index] == _FLAT_HASHTABLE_CTRL_EMPTY) {
+        pt_hashtable->_t_growthleft--;
+    }
+    pt_hashtable->_pby_ctrl[t_index] = _FLAT_HASHTABLE_H2(t_hash);
+
+    _flat_hashtable_init_elem_auxiliary(pt_hashtable, _FLAT_HASHTABLE_SLOT(pt_hashtable, t_index));
+    b_result = _GET_FLAT_HASHTABLE_TYPE_SIZE(pt_hashtable);
+    _GET_FLAT_HASHTABLE_TYPE_COPY_FUNCTION(pt_hashtable)(_FLAT_HASHTABLE_SLOT(pt_hashtable, t_index), cpv_value, &b_result);
+    assert(b_result);
+    pt_hashtable->_t_nodecount++;
+
+    return _flat_hashtable_make_iterator(pt_hashtable, t_index);
+}
+
+/**
+ * Find specific element.
+ */
+_flat_hashtable_iterator_t _flat_hashtable_find(const _flat_hashtable_t* cpt_hashtable, const void* cpv_value)
+{
+    assert(cpt_hashtable != NULL);
+    assert(cpv_value != NULL);
+    assert(_flat_hashtable_is_inited(cpt_hashtable));
+
+    return _flat_hashtable_make_iterator(cpt_hashtable,
+        _flat_hashtable_find_slot(cpt_hashtable, cpv_value, _flat_hashtable_hash_value(cpt_hashtable, cpv_value)));
+}
+
+/**
+ * Find a batch of specific elements.
+ */
+void _flat_hashtable_find_batch(
+    const _flat_hashtable_t* cpt_hashtable, const void* const* cppv_values, size_t t_count,
+    _flat_hashtable_iterator_t* pit_result)
+{
+    size_t at_hash[_FLAT_HASHTABLE_FIND_BATCH_COUNT];
+    size_t t_groupmask = 0;
+    size_t t_group = 0;
+    size_t t_batch = 0;
+    size_t i = 0;
+    size_t j = 0;
+
+    assert(cpt_hashtable != NULL);
+    assert(cppv_values != NULL);
+    assert(pit_result != NULL);
+    assert(_flat_hashtable_is_inited(cpt_hashtable));
+
+    t_groupmask = cpt_hashtable->_t_slotcount / _FLAT_HASHTABLE_GROUP_WIDTH - 1;
+    for (i = 0; i < t_count; i += t_batch) {
+        t_batch = t_count - i < _FLAT_HASHTABLE_FIND_BATCH_COUNT ? t_count - i : _FLAT_HASHTABLE_FIND_BATCH_COUNT;
+
+        /* hash the whole batch first, the loads of first probed groups and their slots are issued together */
+        for (j = 0; j < t_batch; ++j) {
+            assert(cppv_values[i + j] != NULL);
+            at_hash[j] = _flat_hashtable_hash_value(cpt_hashtable, cppv_values[i + j]);
+            t_group = _FLAT_HASHTABLE_H1(at_hash[j]) & t_groupmask;
+            _CSTL_PREFETCH(cpt_hashtable->_pby_ctrl + t_group * _FLAT_HASHTABLE_GROUP_WIDTH);
+            _CSTL_PREFETCH(_FLAT_HASHTABLE_SLOT(cpt_hashtable, t_group * _FLAT_HASHTABLE_GROUP_WIDTH));
+        }
+        for (j = 0; j < t_batch; ++j) {
+            pit_result[i + j] = _flat_hashtable_make_iterator(
+                cpt_hashtable, _flat_hashtable_find_slot(cpt_hashtable, cppv_values[i + j], at_hash[j]));
+        }
+    }
+}
+
+/**
+ * Return an iterator range that is equal to a specific element.
+ */
+range_t _flat_hashtable_equal_range(const _flat_hashtable_t* cpt_hashtable, const void* cpv_value)
+{
+    range_t r_result;
+
+    assert(cpt_hashtable != NULL);
+    assert(cpv_value != NULL);
+    assert(_flat_hashtable_is_inited(cpt_hashtable));
+
+    /* the element is unique, so the range contains one element at most */
+    r_result.it_begin = _flat_hashtable_find(cpt_hashtable, cpv_value);
+    if (_FLAT_HASHTABLE_ITERATOR_COREPOS(r_result.it_begin) != NULL) {
+        r_result.it_end = _flat_hashtable_iterator_next(r_result.it_begin);
+    } else {
+        r_result.it_end = r_result.it_begin;
+    }
+
+    return r_result;
+}
+
+/**
+ * Return the number of specific elements in an flat hashtable
+ */
+size_t _flat_hashtable_count(const _flat_hashtable_t* cpt_hashtable, const void* cpv_value)
+{
+    assert(cpt_hashtable != NULL);
+    assert(cpv_value != NULL);
+    assert(_flat_hashtable_is_inited(cpt_hashtable));
+
+    return _flat_hashtable_find_slot(cpt_hashtable, cpv_value, _flat_hashtable_hash_value(cpt_hashtable, cpv_value)) !=
+           cpt_hashtable->_t_slotcount ? 1 : 0;
+}
+
+/*
+ * Erase an element in an flat hashtable from specificed position.
+ */
+void _flat_hashtable_erase_pos(_flat_hashtable_t* pt_hashtable, _flat_hashtable_iterator_t it_pos)
+{
+    size_t t_index = 0;
+    size_t t_group = 0;
+    bool_t b_result = false;
+
+    assert(pt_hashtable != NULL);
+    assert(_flat_hashtable_is_inited(pt_hashtable));
+    assert(_flat_hashtable_iterator_belong_to_flat_hashtable(pt_hashtable, it_pos));
+    assert(!_flat_hashtable_iterator_equal(it_pos, _flat_hashtable_end(pt_hashtable)));
+
+    t_index = (size_t)(_FLAT_HASHTABLE_ITERATOR_CTRLPOS(it_pos) - pt_hashtable->_pby_ctrl);
+    b_result = _GET_FLAT_HASHTABLE_TYPE_SIZE(pt_hashtable);
+    _GET_FLAT_HASHTABLE_TYPE_DESTROY_FUNCTION(pt_hashtable)(_FLAT_HASHTABLE_SLOT(pt_hashtable, t_index), &b_result);
+    assert(b_result);
+
+    /*
+     * The lookup stops at a group that has empty slot, so if the group of the erased slot has empty slot, no probe
+     * sequence passes through this group and the slot can be empty, otherwise it must be marked as deleted.
+     */
+    t_group = t_index & ~(size_t)(_FLAT_HASHTABLE_GROUP_WIDTH - 1);
+    if (_flat_hashtable_group_match(pt_hashtable->_pby_ctrl + t_group, _FLAT_HASHTABLE_CTRL_EMPTY) != 0) {
+        pt_hashtable->_pby_ctrl[t_index] = _FLAT_HASHTABLE_CTRL_EMPTY;
+        pt_hashtable->_t_growthleft++;
+    } else {
+        pt_hashtable->_pby_ctrl[t_index] = _FLAT_HASHTABLE_CTRL_DELETED;
+    }
+    pt_hashtable->_t_nodecount--;
+}
+
+/*
+ * Erase a range of element in an flat hashtable.
+ */
+void _flat_hashtable_erase_range(
+    _flat_hashtable_t* pt_hashtable, _flat_hashtable_iterator_t it_begin, _flat_hashtable_iterator_t it_end)
+{
+    _flat_hashtable_iterator_t it_iter;
+    _flat_hashtable_iterator_t it_next;
+
+    assert(pt_hashtable != NULL);
+    assert(_flat_hashtable_is_inited(pt_hashtable));
+    assert(_flat_hashtable_iterator_belong_to_flat_hashtable(pt_hashtable, it_begin));
+    assert(_flat_hashtable_iterator_belong_to_flat_hashtable(pt_hashtable, it_end));
+    assert(_flat_hashtable_iterator_equal(it_begin, it_end) || _flat_hashtable_iterator_before(it_begin, it_end));
+
+    /* the erasure does not move other elements, so the next iterator is always valid */
+    it_iter = it_begin;
+    while (!_flat_hashtable_iterator_equal(it_iter, it_end)) {
+        it_next = _flat_hashtable_iterator_next(it_iter);
+        _flat_hashtable_erase_pos(pt_hashtable, it_iter);
+        it_iter = it_next;
+    }
+}
+
+/**
+ * Erase an element from a flat hashtable that match a specified element.
+ */
+size_t _flat_hashtable_erase(_flat_hashtable_t* pt_hashtable, const void* cpv_value)
+{
+    _flat_hashtable_iterator_t it_pos = _flat_hashtable_find(pt_hashtable, cpv_value);
+
+    if (_flat_hashtable_iterator_equal(it_pos, _flat_hashtable_end(pt_hashtable))) {
+        return 0;
+    }
+
+    _flat_hashtable_erase_pos(pt_hashtable, it_pos);
+    return 1;
+}
+
+/**
+ * Swap the datas of first flat hashtable and second flat hashtable.
+ */
+void _flat_hashtable_swap(_flat_hashtable_t* pt_first, _flat_hashtable_t* pt_second)
+{
+    _flat_hashtable_t t_swap;
+
+    assert(pt_first != NULL);
+    assert(pt_second != NULL);
+    assert(_flat_hashtable_is_inited(pt_first));
+    assert(_flat_hashtable_is_inited(pt_second));
+    assert(_flat_hashtable_same_type_ex(pt_first, pt_second));
+
+    if (pt_first == pt_second) {
+        return;
+    }
+
+    t_swap = *pt_first;
+    *pt_first = *pt_second;
+    *pt_second = t_swap;
+}
+
+/**
+ * Assign flat hashtable container.
+ */
+void _flat_hashtable_assign(_flat_hashtable_t* pt_dest, const _flat_hashtable_t* cpt_src)
+{
+    _flat_hashtable_iterator_t it_iter;
+    _flat_hashtable_iterator_t it_begin;
+    _flat_hashtable_iterator_t it_end;
+
+    assert(pt_dest != NULL);
+    assert(cpt_src != NULL);
+    assert(_flat_hashtable_is_inited(pt_dest));
+    assert(_flat_hashtable_is_inited(cpt_src));
+    assert(_flat_hashtable_same_type_ex(pt_dest, cpt_src));
+
+    if (pt_dest == cpt_src) {
+        return;
+    }
+
+    /* clear all elements */
+    _flat_hashtable_clear(pt_dest);
+    _flat_hashtable_resize(pt_dest, _flat_hashtable_bucket_count(cpt_src));
+    it_begin = _flat_hashtable_begin(cpt_src);
+    it_end = _flat_hashtable_end(cpt_src);
+
+    /* insert element from src to dest */
+    for (it_iter = it_begin;
+         !_flat_hashtable_iterator_equal(it_iter, it_end);
+         it_iter = _flat_hashtable_iterator_next(it_iter)) {
+        _flat_hashtable_insert_unique(pt_dest, _flat_hashtable_iterator_get_pointer_ignore_cstr(it_iter));
+    }
+}
+
+/**
+ * Get the number of elements int the flat hashtable.
+ */
+size_t _flat_hashtable_size(const _flat_hashtable_t* cpt_hashtable)
+{
+    assert(cpt_hashtable != NULL);
+    assert(_flat_hashtable_is_inited(cpt_hashtable));
+
+    return cpt_hashtable->_t_nodecount;
+}
+
+/**
+ * Test if an flat hashtable is empty.
+ */
+bool_t _flat_hashtable_empty(const _flat_hashtable_t* cpt_hashtable)
+{
+    assert(cpt_hashtable != NULL);
+    assert(_flat_hashtable_is_inited(cpt_hashtable));
+
+    return cpt_hashtable->_t_nodecount == 0 ? true : false;
+}
+
+/**
+ * Get the maximum number of elements int the flat hashtable.
+ */
+size_t _flat_hashtable_max_size(const _flat_hashtable_t* cpt_hashtable)
+{
+    assert(cpt_hashtable != NULL);
+    assert(_flat_hashtable_is_inited(cpt_hashtable));
+
+    return (size_t)(-1) / _GET_FLAT_HASHTABLE_TYPE_SIZE(cpt_hashtable);
+}
+
+/**
+ * Get the memory that is allocated by the flat hashtable.
+ */
+size_t _flat_hashtable_memory_usage(const _flat_hashtable_t* cpt_hashtable)
+{
+    _allocstat_t t_stat;
+
+    assert(cpt_hashtable != NULL);
+    assert(_flat_hashtable_is_inited(cpt_hashtable));
+
+    _alloc_get_stat(&cpt_hashtable->_t_allocator, &t_stat);
+    return t_stat._t_livesize + t_stat._t_cachedsize;
+}
+
+/**
+ * Get the slot count of the flat hashtable.
+ */
+size_t _flat_hashtable_bucket_count(const _flat_hashtable_t* cpt_hashtable)
+{
+    assert(cpt_hashtable != NULL);
+    assert(_flat_hashtable_is_inited(cpt_hashtable));
+
+    return cpt_hashtable->_t_slotcount;
+}
+
+/**
+ * Get the average number of elements per slot.
+ */
+float _flat_hashtable_load_factor(const _flat_hashtable_t* cpt_hashtable)
+{
+    assert(cpt_hashtable != NULL);
+    assert(_flat_hashtable_is_inited(cpt_hashtable));
+
+    return (float)cpt_hashtable->_t_nodecount / (float)cpt_hashtable->_t_slotcount;
+}
+
+/**
+ * Get the max load factor of flat hashtable.
+ */
+float _flat_hashtable_max_load_factor(const _flat_hashtable_t* cpt_hashtable)
+{
+    assert(cpt_hashtable != NULL);
+    assert(_flat_hashtable_is_inited(cpt_hashtable));
+
+    return cpt_hashtable->_f_maxloadfactor;
+}
+
+/**
+ * Set the max load factor of flat hashtable.
+ */
+void _flat_hashtable_set_max_load_factor(_flat_hashtable_t* pt_hashtable, float f_maxloadfactor)
+{
+    size_t t_used = 0;
+    size_t t_capacity = 0;
+
+    assert(pt_hashtable != NULL);
+    assert(_flat_hashtable_is_inited(pt_hashtable));
+    assert(f_maxloadfactor > 0.0f);
+
+    /* the slots that are not empty, including the deleted slots */
+    t_used = _flat_hashtable_get_capacity_auxiliary(pt_hashtable, pt_hashtable->_t_slotcount) -
+             pt_hashtable->_t_growthleft;
+    pt_hashtable->_f_maxloadfactor = f_maxloadfactor;
+    t_capacity = _flat_hashtable_get_capacity_auxiliary(pt_hashtable, pt_hashtable->_t_slotcount);
+
+    if (pt_hashtable->_t_nodecount > t_capacity) {
+        _flat_hashtable_rehash(
+            pt_hashtable, _flat_hashtable_get_least_slot_count_auxiliary(pt_hashtable, pt_hashtable->_t_nodecount));
+    } else {
+        pt_hashtable->_t_growthleft = t_capacity > t_used ? t_capacity - t_used : 0;
+    }
+}
+
+/**
+ * Return an iterator that addresses the first element in the flat hashtable.
+ */
+_flat_hashtable_iterator_t _flat_hashtable_begin(const _flat_hashtable_t* cpt_hashtable)
+{
+    size_t t_index = 0;
+
+    assert(cpt_hashtable != NULL);
+    assert(_flat_hashtable_is_inited(cpt_hashtable));
+
+    while (t_index < cpt_hashtable->_t_slotcount && !_FLAT_HASHTABLE_CTRL_IS_FULL(cpt_hashtable->_pby_ctrl[t_index])) {
+        ++t_index;
+    }
+
+    return _flat_hashtable_make_iterator(cpt_hashtable, t_index);
+}
+
+/**
+ * Return an iterator that addresses the location succeeding the last element in the flat hashtable.
+ */
+_flat_hashtable_iterator_t _flat_hashtable_end(const _flat_hashtable_t* cpt_hashtable)
+{
+    assert(cpt_hashtable != NULL);
+    assert(_flat_hashtable_is_inited(cpt_hashtable));
+
+    return _flat_hashtable_make_iterator(cpt_hashtable, cpt_hashtable->_t_slotcount);
+}
+
+/**
+ * Return the hash function.
+ */
+ufun_t _flat_hashtable_hash(const _flat_hashtable_t* cpt_hashtable)
+{
+    assert(cpt_hashtable != NULL);
+    assert(_flat_hashtable_is_inited(cpt_hashtable));
+
+    return cpt_hashtable->_ufun_hash;
+}
+
+/**
+ * Return the compare function of key.
+ */
+bfun_t _flat_hashtable_key_comp(const _flat_hashtable_t* cpt_hashtable)
+{
+    assert(cpt_hashtable != NULL);
+    assert(_flat_hashtable_is_inited(cpt_hashtable));
+
+    return cpt_hashtable->_bfun_compare;
+}
+
+/**
+ * Erases all the elements of an flat hashtable.
+ */
+void _flat_hashtable_clear(_flat_hashtable_t* pt_hashtable)
+{
+    size_t i = 0;
+    bool_t b_result = false;
+
+    assert(pt_hashtable != NULL);
+    assert(_flat_hashtable_is_inited(pt_hashtable) || _flat_hashtable_is_created(pt_hashtable));
+
+    if (pt_hashtable->_pby_ctrl == NULL) {
+        return;
+    }
+
+    /* destroy each element */
+    for (i = 0; i < pt_hashtable->_t_slotcount && pt_hashtable->_t_nodecount > 0; ++i) {
+        if (_FLAT_HASHTABLE_CTRL_IS_FULL(pt_hashtable->_pby_ctrl[i])) {
+            b_result = _GET_FLAT_HASHTABLE_TYPE_SIZE(pt_hashtable);
+            _GET_FLAT_HASHTABLE_TYPE_DESTROY_FUNCTION(pt_hashtable)(_FLAT_HASHTABLE_SLOT(pt_hashtable, i), &b_result);
+            assert(b_result);
+            pt_hashtable->_t_nodecount--;
+        }
+    }
+
+    memset(pt_hashtable->_pby_ctrl, _FLAT_HASHTABLE_CTRL_EMPTY, pt_hashtable->_t_slotcount);
+    pt_hashtable->_t_nodecount = 0;
+    pt_hashtable->_t_growthleft = _flat_hashtable_get_capacity_auxiliary(pt_hashtable, pt_hashtable->_t_slotcount);
+}
+
+/**
+ * Tests if the two flat hashtable are equal.
+ */
+bool_t _flat_hashtable_equal(const _flat_hashtable_t* cpt_first, const _flat_hashtable_t* cpt_second)
+{
+    _flat_hashtable_iterator_t it_first;
+    _flat_hashtable_iterator_t it_first_end;
+    size_t                     t_index = 0;
+    bool_t                     b_less = false;
+    bool_t                     b_greater = false;
+
+    assert(cpt_first != NULL);
+    assert(cpt_second != NULL);
+    assert(_flat_hashtable_is_inited(cpt_first));
+    assert(_flat_hashtable_is_inited(cpt_second));
+    assert(_flat_hashtable_same_type(cpt_first, cpt_second));
+    assert(cpt_first->_ufun_hash == cpt_second->_ufun_hash);
+    assert(cpt_first->_bfun_compare == cpt_second->_bfun_compare);
+
+    if (cpt_first == cpt_second) {
+        return true;
+    }
+
+    /* check size */
+    if (_flat_hashtable_size(cpt_first) != _flat_hashtable_size(cpt_second)) {
+        return false;
+    }
+
+    /*
+     * The position of element depends on the insertion history, so each element of first flat hashtable is
+     * looked up in second flat hashtable instead of comparing in iteration order.
+     */
+    it_first_end = _flat_hashtable_end(cpt_first);
+    for (it_first = _flat_hashtable_begin(cpt_first);
+         !_flat_hashtable_iterator_equal(it_first, it_first_end);
+         it_first = _flat_hashtable_iterator_next(it_first)) {
+        t_index = _flat_hashtable_find_slot(cpt_second, _FLAT_HASHTABLE_ITERATOR_COREPOS(it_first),
+            _flat_hashtable_hash_value(cpt_second, _FLAT_HASHTABLE_ITERATOR_COREPOS(it_first)));
+        if (t_index == cpt_second->_t_slotcount) {
+            return false;
+        }
+
+        b_less = b_greater = _GET_FLAT_HASHTABLE_TYPE_SIZE(cpt_first);
+        _GET_FLAT_HASHTABLE_TYPE_LESS_FUNCTION(cpt_first)(
+            _FLAT_HASHTABLE_ITERATOR_COREPOS(it_first), _FLAT_HASHTABLE_SLOT(cpt_second, t_index), &b_less);
+        _GET_FLAT_HASHTABLE_TYPE_LESS_FUNCTION(cpt_first)(
+            _FLAT_HASHTABLE_SLOT(cpt_second, t_index), _FLAT_HASHTABLE_ITERATOR_COREPOS(it_first), &b_greater);
+        if (b_less || b_greater) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Tests if the two flat hashtable are not equal.
+ */
+bool_t _flat_hashtable_not_equal(const _flat_hashtable_t* cpt_first, const _flat_hashtable_t* cpt_second)
+{
+    return !_flat_hashtable_equal(cpt_first, cpt_second);
+}
+
+/**
+ * Tests if the first flat hashtable is less than the second flat hashtable.
+ */
+bool_t _flat_hashtable_less(const _flat_hashtable_t* cpt_first, const _flat_hashtable_t* cpt_second)
+{
+    _flat_hashtable_iterator_t it_first;
+    _flat_hashtable_iterator_t it_first_end;
+    _flat_hashtable_iterator_t it_second;
+    _flat_hashtable_iterator_t it_second_end;
+    bool_t                     b_less = false;
+    bool_t                     b_greater = false;
+
+    assert(cpt_first != NULL);
+    assert(cpt_second != NULL);
+    assert(_flat_hashtable_is_inited(cpt_first));
+    assert(_flat_hashtable_is_inited(cpt_second));
+    assert(_flat_hashtable_same_type_ex(cpt_first, cpt_second));
+
+    /* the equal flat hashtables may have different iteration order */
+    if (_flat_hashtable_equal(cpt_first, cpt_second)) {
+        return false;
+    }
+
+    /* check slot count */
+    if (cpt_first->_t_slotcount == cpt_second->_t_slotcount) {
+        it_first_end = _flat_hashtable_end(cpt_first);
+        it_second_end = _flat_hashtable_end(cpt_second);
+
+        /* check each element */
+        for (it_first = _flat_hashtable_begin(cpt_first),
+             it_second = _flat_hashtable_begin(cpt_second);
+             !_flat_hashtable_iterator_equal(it_first, it_first_end) &&
+             !_flat_hashtable_iterator_equal(it_second, it_second_end);
+             it_first = _flat_hashtable_iterator_next(it_first),
+             it_second = _flat_hashtable_iterator_next(it_second)) {
+            b_less = _GET_FLAT_HASHTABLE_TYPE_SIZE(cpt_first);
+            _GET_FLAT_HASHTABLE_TYPE_LESS_FUNCTION(cpt_first)(
+                _FLAT_HASHTABLE_ITERATOR_COREPOS(it_first), _FLAT_HASHTABLE_ITERATOR_COREPOS(it_second), &b_less);
+            if (b_less) {
+                return true;
+            }
+            b_greater = _GET_FLAT_HASHTABLE_TYPE_SIZE(cpt_first);
+            _GET_FLAT_HASHTABLE_TYPE_LESS_FUNCTION(cpt_first)(
+                _FLAT_HASHTABLE_ITERATOR_COREPOS(it_second), _FLAT_HASHTABLE_ITERATOR_COREPOS(it_first), &b_greater);
+            if (b_greater) {
+                return false;
+            }
+        }
+    }
+
+    return _flat_hashtable_size(cpt_first) < _flat_hashtable_size(cpt_second) ? true : false;
+}
+
+/**
+ * Tests if the first flat hashtable is less than or equal to the second flat hashtable.
+ */
+bool_t _flat_hashtable_less_equal(const _flat_hashtable_t* cpt_first, const _flat_hashtable_t* cpt_second)
+{
+    return (_flat_hashtable_less(cpt_first, cpt_second) || _flat_hashtable_equal(cpt_first, cpt_second)) ? true : false;
+}
+
+/**
+ * Tests if the first flat hashtable is greater than the second flat hashtable.
+ */
+bool_t _flat_hashtable_greater(const _flat_hashtable_t* cpt_first, const _flat_hashtable_t* cpt_second)
+{
+    return _flat_hashtable_less(cpt_second, cpt_first);
+}
+
+/**
+ * Tests if the first flat hashtable is greater than or equal to the second flat hashtable.
+ */
+bool_t _flat_hashtable_greater_equal(const _flat_hashtable_t* cpt_first, const _flat_hashtable_t* cpt_second)
+{
+    return (_flat_hashtable_greater(cpt_first, cpt_second) || _flat_hashtable_equal(cpt_first, cpt_second)) ? true : false;
+}
+
+/**
+ * Inserts an range of unique element into a flat hashtable.
+ */
+void _flat_hashtable_insert_unique_range(_flat_hashtable_t* pt_hashtable, iterator_t it_begin, iterator_t it_end)
+{
+    iterator_t it_iter;
+
+    assert(pt_hashtable != NULL);
+    assert(_flat_hashtable_is_inited(pt_hashtable));
+    assert(_flat_hashtable_same_iterator_type(pt_hashtable, it_begin));
+    assert(_flat_hashtable_same_iterator_type(pt_hashtable, it_end));
+    assert(iterator_equal(it_begin, it_end) || _iterator_before(it_begin, it_end));
+
+    for (it_iter = it_begin; !iterator_equal(it_iter, it_end); it_iter = iterator_next(it_iter)) {
+        _flat_hashtable_insert_unique(pt_hashtable, _iterator_get_pointer_ignore_cstr(it_iter));
+    }
+}
+
+/**
+ * Inserts an array of unique element into a flat hashtable.
+ */
+void _flat_hashtable_insert_unique_array(_flat_hashtable_t* pt_hashtable, const void* cpv_array, size_t t_count)
+{
+    size_t i = 0;
+
+    assert(pt_hashtable != NULL);
+    assert(_flat_hashtable_is_inited(pt_hashtable));
+    assert(cpv_array != NULL);
+
+    /*
+     * Copy the elements from src array to dest flat hashtable
+     * The array of c builtin and user define or cstl builtin are different,
+     * the elements of c builtin array are element itself, but the elements of
+     * c string, user define or cstl are pointer of element.
+     */
+    if (_GET_FLAT_HASHTABLE_TYPE_ID(pt_hashtable) == _TYPE_ID_C_STRING) {
+        /*
+         * We need built a string_t for c string element.
+         */
+        string_t* pstr_elem = create_string();
+        assert(pstr_elem != NULL);
+        string_init(pstr_elem);
+        for (i = 0; i < t_count; ++i) {
+            string_assign_cstr(pstr_elem, *((const char**)cpv_array + i));
+            _flat_hashtable_insert_unique(pt_hashtable, pstr_elem);
+        }
+        string_destroy(pstr_elem);
+    } else if (_GET_FLAT_HASHTABLE_TYPE_STYLE(pt_hashtable) == _TYPE_C_BUILTIN) {
+        for (i = 0; i < t_count; ++i) {
+            _flat_hashtable_insert_unique(
+                pt_hashtable, (unsigned char*)cpv_array + i * _GET_FLAT_HASHTABLE_TYPE_SIZE(pt_hashtable));
+        }
+    } else {
+        for (i = 0; i < t_count; ++i) {
+            _flat_hashtable_insert_unique(pt_hashtable, *((void**)cpv_array + i));
+        }
+    }
+}
+
+/** local function implementation section **/
+/**
+ * Get the hash value of element.
+ */
+static size_t _flat_hashtable_hash_value(const _flat_hashtable_t* cpt_hashtable, const void* cpv_value)
+{
+    size_t t_hash = _GET_FLAT_HASHTABLE_TYPE_SIZE(cpt_hashtable);
+
+    _flat_hashtable_hash_auxiliary(cpt_hashtable, cpv_value, &t_hash);
+
+    /* fibonacci hashing, the high bits of product depend on all bits of hash value */
+    if (sizeof(size_t) > 4) {
+        t_hash *= (size_t)0x9E3779B97F4A7C15ULL;
+    } else {
+        t_hash *= (size_t)0x9E3779B9UL;
+    }
+    return t_hash ^ (t_hash >> (_FLAT_HASHTABLE_HASH_BITS / 2));
+}
+
+/**
+ * Match the control bytes of group.
+ */
+static unsigned int _flat_hashtable_group_match(const _byte_t* cpby_group, _byte_t by_ctrl)
+{
+#ifdef _FLAT_HASHTABLE_SSE2
+    __m128i t_group = _mm_loadu_si128((const __m128i*)cpby_group);
+    return (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(t_group, _mm_set1_epi8((char)by_ctrl)));
+#else
+    unsigned int t_mask = 0;
+    size_t       i = 0;
+
+    for (i = 0; i < _FLAT_HASHTABLE_GROUP_WIDTH; ++i) {
+        if (cpby_group[i] == by_ctrl) {
+            t_mask |= 1u << i;
+        }
+    }
+    return t_mask;
+#endif
+}
+
+/**
+ * Match the empty or deleted control bytes of group.
+ */
+static unsigned int _flat_hashtable_group_match_free(const _byte_t* cpby_group)
+{
+#ifdef _FLAT_HASHTABLE_SSE2
+    /* the high bit of empty and deleted control byte is set */
+    return (unsigned int)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)cpby_group));
+#else
+    unsigned int t_mask = 0;
+    size_t       i = 0;
+
+    for (i = 0; i < _FLAT_HASHTABLE_GROUP_WIDTH; ++i) {
+        if (!_FLAT_HASHTABLE_CTRL_IS_FULL(cpby_group[i])) {
+            t_mask |= 1u << i;
+        }
+    }
+    return t_mask;
+#endif
+}
+
+/**
+ * Get the index of lowest set bit.
+ */
+static size_t _flat_hashtable_lowest_bit(unsigned int t_mask)
+{
+#if defined(__GNUC__)
+    return (size_t)__builtin_ctz(t_mask);
+#else
+    size_t t_index = 0;
+
+    assert(t_mask != 0);
+    while ((t_mask & 1u) == 0) {
+        t_mask >>= 1;
+        ++t_index;
+    }
+    return t_index;
+#endif
+}
+
+/**
+ * Find the slot index of element.
+ */
+static size_t _flat_hashtable_find_slot(const _flat_hashtable_t* cpt_hashtable, const void* cpv_value, size_t t_hash)
+{
+    size_t       t_groupmask = cpt_hashtable->_t_slotcount / _FLAT_HASHTABLE_GROUP_WIDTH - 1;
+    size_t       t_group = _FLAT_HASHTABLE_H1(t_hash) & t_groupmask;
+    size_t       t_index = 0;
+    size_t       i = 0;
+    unsigned int t_mask = 0;
+    _byte_t*     pby_group = NULL;
+
+    /* triangular probing visits every group once */
+    for (i = 0; i <= t_groupmask; ++i) {
+        pby_group = cpt_hashtable->_pby_ctrl + t_group * _FLAT_HASHTABLE_GROUP_WIDTH;
+        for (t_mask = _flat_hashtable_group_match(pby_group, _FLAT_HASHTABLE_H2(t_hash));
+             t_mask != 0;
+             t_mask &= t_mask - 1) {
+            t_index = t_group * _FLAT_HASHTABLE_GROUP_WIDTH + _flat_hashtable_lowest_bit(t_mask);
+            if (_flat_hashtable_elem_three_way_compare_auxiliary(
+                    cpt_hashtable, _FLAT_HASHTABLE_SLOT(cpt_hashtable, t_index), cpv_value) == 0) {
+                return t_index;
+            }
+        }
+        /* the element is never inserted after a group that has empty slot */
+        if (_flat_hashtable_group_match(pby_group, _FLAT_HASHTABLE_CTRL_EMPTY) != 0) {
+            break;
+        }
+        t_group = (t_group + i + 1) & t_groupmask;
+    }
+
+    return cpt_hashtable->_t_slotcount;
+}
+
+/**
+ * Find the first empty or deleted slot in probe sequence.
+ */
+static size_t _flat_hashtable_find_free_slot(const _flat_hashtable_t* cpt_hashtable, size_t t_hash)
+{
+    size_t       t_groupmask = cpt_hashtable->_t_slotcount / _FLAT_HASHTABLE_GROUP_WIDTH - 1;
+    size_t       t_group = _FLAT_HASHTABLE_H1(t_hash) & t_groupmask;
+    size_t       i = 0;
+    unsigned int t_mask = 0;
+
+    for (i = 0; i <= t_groupmask; ++i) {
+        t_mask = _flat_hashtable_group_match_free(cpt_hashtable->_pby_ctrl + t_group * _FLAT_HASHTABLE_GROUP_WIDTH);
+        if (t_mask != 0) {
+            return t_group * _FLAT_HASHTABLE_GROUP_WIDTH + _flat_hashtable_lowest_bit(t_mask);
+        }
+        t_group = (t_group + i + 1) & t_groupmask;
+    }
+
+    /* the load factor keeps some empty slots, so this never happen */
+    assert(false);
+    return cpt_hashtable->_t_slotcount;
+}
+
+/**
+ * Allocate control bytes and slots and move all elements into new slots.
+ */
+static void _flat_hashtable_rehash(_flat_hashtable_t* pt_hashtable, size_t t_slotcount)
+{
+    _byte_t* pby_oldctrl = pt_hashtable->_pby_ctrl;
+    _byte_t* pby_oldslot = pt_hashtable->_pby_slot;
+    size_t   t_oldcount = pt_hashtable->_t_slotcount;
+    size_t   t_typesize = _GET_FLAT_HASHTABLE_TYPE_SIZE(pt_hashtable);
+    size_t   t_hash = 0;
+    size_t   t_index = 0;
+    size_t   i = 0;
+    bool_t   b_result = false;
+    bool_t   b_relocatable = _type_is_relocatable(&pt_hashtable->_t_typeinfo);
+
+    assert(t_slotcount >= _FLAT_HASHTABLE_GROUP_WIDTH && (t_slotcount & (t_slotcount - 1)) == 0);
+    assert(pt_hashtable->_t_nodecount <= _flat_hashtable_get_capacity_auxiliary(pt_hashtable, t_slotcount));
+
+    pt_hashtable->_pby_ctrl = (_byte_t*)_alloc_allocate(&pt_hashtable->_t_allocator, 1, t_slotcount);
+    pt_hashtable->_pby_slot = (_byte_t*)_alloc_allocate(&pt_hashtable->_t_allocator, t_typesize, t_slotcount);
+    assert(pt_hashtable->_pby_ctrl != NULL && pt_hashtable->_pby_slot != NULL);
+    memset(pt_hashtable->_pby_ctrl, _FLAT_HASHTABLE_CTRL_EMPTY, t_slotcount);
+    pt_hashtable->_t_slotcount = t_slotcount;
+    /* the old growth left may exceed the capacity of fewer slots */
+    pt_hashtable->_t_growthleft = 0;
+
+    for (i = 0; i < t_oldcount; ++i) {
+        if (!_FLAT_HASHTABLE_CTRL_IS_FULL(pby_oldctrl[i])) {
+            continue;
+        }
+
+        t_hash = _flat_hashtable_hash_value(pt_hashtable, pby_oldslot + i * t_typesize);
+        t_index = _flat_hashtable_find_free_slot(pt_hashtable, t_hash);
+        pt_hashtable->_pby_ctrl[t_index] = _FLAT_HASHTABLE_H2(t_hash);
+
+        /*
+         * The element that can be relocated is moved by memory copy or by the move function of type, the
+         * other element may share its representation or contain pointer to itself, so it is copied into the
+         * new slot and destroyed.
+         */
+        if (b_relocatable) {
+            _type_relocate(&pt_hashtable->_t_typeinfo, _FLAT_HASHTABLE_SLOT(pt_hashtable, t_index),
+                pby_oldslot + i * t_typesize, 1);
+        } else {
+            _flat_hashtable_init_elem_auxiliary(pt_hashtable, _FLAT_HASHTABLE_SLOT(pt_hashtable, t_index));
+            b_result = t_typesize;
+            _GET_FLAT_HASHTABLE_TYPE_COPY_FUNCTION(pt_hashtable)(
+                _FLAT_HASHTABLE_SLOT(pt_hashtable, t_index), pby_oldslot + i * t_typesize, &b_result);
+            assert(b_result);
+            b_result = t_typesize;
+            _GET_FLAT_HASHTABLE_TYPE_DESTROY_FUNCTION(pt_hashtable)(pby_oldslot + i * t_typesize, &b_result);
+            assert(b_result);
+        }
+    }
+    pt_hashtable->_t_growthleft =
+        _flat_hashtable_get_capacity_auxiliary(pt_hashtable, t_slotcount) - pt_hashtable->_t_nodecount;
+
+    _alloc_deallocate(&pt_hashtable->_t_allocator, pby_oldctrl, 1, t_oldcount);
+    _alloc_deallocate(&pt_hashtable->_t_allocator, pby_oldslot, t_typesize, t_oldcount);
+}
+
+/**
+ * Make iterator that reference the specific slot.
+ */
+static _flat_hashtable_iterator_t _flat_hashtable_make_iterator(const _flat_hashtable_t* cpt_hashtable, size_t t_index)
+{
+    _flat_hashtable_iterator_t it_iter = _create_flat_hashtable_iterator();
+
+    _FLAT_HASHTABLE_ITERATOR_CTRLPOS(it_iter) = cpt_hashtable->_pby_ctrl + t_index;
+    _FLAT_HASHTABLE_ITERATOR_COREPOS(it_iter) =
+        t_index < cpt_hashtable->_t_slotcount ? _FLAT_HASHTABLE_SLOT(cpt_hashtable, t_index) : NULL;
+    _FLAT_HASHTABLE_ITERATOR_HASHTABLE_POINTER(it_iter) = (_flat_hashtable_t*)cpt_hashtable;
+
+    return it_iter;
+}
+
+/** eof **/
@@ -0,0 +1,348 @@
+/*
+ *  The implementation of flat hashtable auxiliary function.
+ *  Copyright (C)  2008 - 2014  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+/** include section **/
+#include <cstl/cstl_def.h>
+#include <cstl/cstl_alloc.h>
+#include <cstl/cstl_types.h>
+#include <cstl/citerator.h>
+#include <cstl/cstring.h>
+#include <cstl/cutility.h>
+
+#include <cstl/cstl_hashtable_iterator.h>
+#include <cstl/cstl_hashtable_private.h>
+#include <cstl/cstl_flat_hashtable_iterator.h>
+#include <cstl/cstl_flat_hashtable_private.h>
+#include <cstl/cstl_flat_hashtable.h>
+
+#include "cstl_hashtable_aux.h"
+#include "cstl_flat_hashtable_aux.h"
+#include "cstl_map_aux.h"
+
+/** local constant declaration and local macro section **/
+
+/** local data type declaration and local struct, union, enum section **/
+
+/** local function prototype section **/
+
+/** exported global variable definition section **/
+
+/** local global variable definition section **/
+
+/** exported function implementation section **/
+#ifndef NDEBUG
+/**
+ * Test flat hashtable is created by _create_flat_hashtable.
+ */
+bool_t _flat_hashtable_is_created(const _flat_hashtable_t* cpt_hashtable)
+{
+    assert(cpt_hashtable != NULL);
+
+    if (cpt_hashtable->_t_typeinfo._t_style != _TYPE_C_BUILTIN &&
+        cpt_hashtable->_t_typeinfo._t_style != _TYPE_CSTL_BUILTIN &&
+        cpt_hashtable->_t_typeinfo._t_style != _TYPE_USER_DEFINE) {
+        return false;
+    }
+    if (cpt_hashtable->_t_typeinfo._pt_type == NULL) {
+        return false;
+    }
+
+    if (cpt_hashtable->_pby_ctrl != NULL || cpt_hashtable->_pby_slot != NULL || cpt_hashtable->_t_slotcount != 0) {
+        return false;
+    }
+
+    if (cpt_hashtable->_t_nodecount != 0 || cpt_hashtable->_t_growthleft != 0 ||
+        cpt_hashtable->_ufun_hash != NULL || cpt_hashtable->_bfun_compare != NULL) {
+        return false;
+    }
+
+    return _alloc_is_inited(&cpt_hashtable->_t_allocator);
+}
+
+/**
+ * Test flat hashtable is initialized by flat hashtable initialization functions.
+ */
+bool_t _flat_hashtable_is_inited(const _flat_hashtable_t* cpt_hashtable)
+{
+    assert(cpt_hashtable != NULL);
+
+    if (cpt_hashtable->_t_typeinfo._t_style != _TYPE_C_BUILTIN &&
+        cpt_hashtable->_t_typeinfo._t_style != _TYPE_CSTL_BUILTIN &&
+        cpt_hashtable->_t_typeinfo._t_style != _TYPE_USER_DEFINE) {
+        return false;
+    }
+    if (cpt_hashtable->_t_typeinfo._pt_type == NULL) {
+        return false;
+    }
+
+    if (cpt_hashtable->_pby_ctrl == NULL || cpt_hashtable->_pby_slot == NULL ||
+        cpt_hashtable->_t_slotcount < _FLAT_HASHTABLE_GROUP_WIDTH ||
+        (cpt_hashtable->_t_slotcount & (cpt_hashtable->_t_slotcount - 1)) != 0) {
+        return false;
+    }
+
+    if (cpt_hashtable->_t_nodecount + cpt_hashtable->_t_growthleft > _FLAT_HASHTABLE_CAPACITY(cpt_hashtable->_t_slotcount)) {
+        return false;
+    }
+
+    if (cpt_hashtable->_ufun_hash == NULL || cpt_hashtable->_bfun_compare == NULL) {
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Test iterator referenced data is within the flat hashtable.
+ */
+bool_t _flat_hashtable_iterator_belong_to_flat_hashtable(
+    const _flat_hashtable_t* cpt_hashtable, _flat_hashtable_iterator_t it_iter)
+{
+    size_t t_index = 0;
+
+    assert(cpt_hashtable != NULL);
+    assert(_flat_hashtable_is_inited(cpt_hashtable));
+    assert(_FLAT_HASHTABLE_ITERATOR_CTRLPOS(it_iter) != NULL);
+    assert(_FLAT_HASHTABLE_ITERATOR_HASHTABLE(it_iter) == cpt_hashtable);
+
+    if (_FLAT_HASHTABLE_ITERATOR_CTRLPOS(it_iter) < cpt_hashtable->_pby_ctrl ||
+        _FLAT_HASHTABLE_ITERATOR_CTRLPOS(it_iter) > cpt_hashtable->_pby_ctrl + cpt_hashtable->_t_slotcount) {
+        return false;
+    }
+
+    /* check for the end node */
+    t_index = (size_t)(_FLAT_HASHTABLE_ITERATOR_CTRLPOS(it_iter) - cpt_hashtable->_pby_ctrl);
+    if (t_index == cpt_hashtable->_t_slotcount) {
+        return _FLAT_HASHTABLE_ITERATOR_COREPOS(it_iter) == NULL ? true : false;
+    } else {
+        return _FLAT_HASHTABLE_CTRL_IS_FULL(cpt_hashtable->_pby_ctrl[t_index]) &&
+               _FLAT_HASHTABLE_ITERATOR_COREPOS(it_iter) == _FLAT_HASHTABLE_SLOT(cpt_hashtable, t_index);
+    }
+}
+
+/**
+ * Test the type that saved in the flat hashtable container and referenced by it_iter are same.
+ */
+bool_t _flat_hashtable_same_iterator_type(const _flat_hashtable_t* cpt_hashtable, iterator_t it_iter)
+{
+    assert(cpt_hashtable != NULL);
+    assert(_flat_hashtable_is_inited(cpt_hashtable) || _flat_hashtable_is_created(cpt_hashtable));
+    assert(_iterator_is_valid(it_iter));
+
+    return _type_is_same_ex(&cpt_hashtable->_t_typeinfo, _iterator_get_typeinfo(it_iter));
+}
+#endif /* NDEBUG */
+
+/**
+ * Test the type that saved in the flat hashtable container is same.
+ */
+bool_t _flat_hashtable_same_type(const _flat_hashtable_t* cpt_first, const _flat_hashtable_t* cpt_second)
+{
+    assert(cpt_first != NULL);
+    assert(cpt_second != NULL);
+    assert(_flat_hashtable_is_inited(cpt_first) || _flat_hashtable_is_created(cpt_first));
+    assert(_flat_hashtable_is_inited(cpt_second) || _flat_hashtable_is_created(cpt_second));
+
+    if (cpt_first == cpt_second) {
+        return true;
+    }
+
+    return (cpt_first->_t_typeinfo._pt_type == cpt_second->_t_typeinfo._pt_type) &&
+           (cpt_first->_t_typeinfo._t_style == cpt_second->_t_typeinfo._t_style) &&
+           _type_is_same(_GET_FLAT_HASHTABLE_TYPE_NAME(cpt_first), _GET_FLAT_HASHTABLE_TYPE_NAME(cpt_second));
+}
+
+/**
+ * Test the type and compare function that saved in the flat hashtable container is same.
+ */
+bool_t _flat_hashtable_same_type_ex(const _flat_hashtable_t* cpt_first, const _flat_hashtable_t* cpt_second)
+{
+    assert(cpt_first != NULL);
+    assert(cpt_second != NULL);
+    assert(_flat_hashtable_is_inited(cpt_first) || _flat_hashtable_is_created(cpt_first));
+    assert(_flat_hashtable_is_inited(cpt_second) || _flat_hashtable_is_created(cpt_second));
+
+    if (cpt_first == cpt_second) {
+        return true;
+    }
+
+    return (cpt_first->_t_typeinfo._pt_type == cpt_second->_t_typeinfo._pt_type) &&
+           (cpt_first->_t_typeinfo._t_style == cpt_second->_t_typeinfo._t_style) &&
+           (cpt_first->_ufun_hash == cpt_second->_ufun_hash) &&
+           (cpt_first->_bfun_compare == cpt_second->_bfun_compare) &&
+           _type_is_same(_GET_FLAT_HASHTABLE_TYPE_NAME(cpt_first), _GET_FLAT_HASHTABLE_TYPE_NAME(cpt_second));
+}
+
+/**
+ * Get the slot count that is power of 2 and not less than the specific count.
+ */
+size_t _flat_hashtable_get_slot_count(size_t t_count)
+{
+    size_t t_slotcount = _FLAT_HASHTABLE_GROUP_WIDTH;
+
+    while (t_slotcount < t_count && t_slotcount <= ((size_t)-1) / 2) {
+        t_slotcount <<= 1;
+    }
+
+    return t_slotcount;
+}
+
+/**
+ * Get the max element count of specific number of slots under the max load factor.
+ */
+size_t _flat_hashtable_get_capacity_auxiliary(const _flat_hashtable_t* cpt_hashtable, size_t t_slotcount)
+{
+    size_t t_capacity = 0;
+
+    assert(cpt_hashtable != NULL);
+    assert(cpt_hashtable->_f_maxloadfactor > 0.0f);
+
+    /* the lookup needs empty slot to stop, so the max load factor that is more than 7/8 is not used */
+    t_capacity = (size_t)((double)t_slotcount * cpt_hashtable->_f_maxloadfactor);
+    if (t_capacity > _FLAT_HASHTABLE_CAPACITY(t_slotcount)) {
+        t_capacity = _FLAT_HASHTABLE_CAPACITY(t_slotcount);
+    }
+
+    return t_capacity > 0 ? t_capacity : 1;
+}
+
+/**
+ * Get the least slot count that holds specific number of elements under the max load factor.
+ */
+size_t _flat_hashtable_get_least_slot_count_auxiliary(const _flat_hashtable_t* cpt_hashtable, size_t t_elemcount)
+{
+    size_t t_slotcount = _FLAT_HASHTABLE_GROUP_WIDTH;
+
+    assert(cpt_hashtable != NULL);
+
+    while (_flat_hashtable_get_capacity_auxiliary(cpt_hashtable, t_slotcount) < t_elemcount &&
+           t_slotcount <= ((size_t)-1) / 2) {
+        t_slotcount <<= 1;
+    }
+
+    return t_slotcount;
+}
+
+/**
+ * Initialize element auxiliary function
+ */
+void _flat_hashtable_init_elem_auxiliary(_flat_hashtable_t* pt_hashtable, void* pv_elem)
+{
+    assert(pt_hashtable != NULL);
+    assert(pv_elem != NULL);
+    assert(_flat_hashtable_is_inited(pt_hashtable) || _flat_hashtable_is_created(pt_hashtable));
+
+    /* initialize new elements */
+    if (_GET_FLAT_HASHTABLE_TYPE_STYLE(pt_hashtable) == _TYPE_CSTL_BUILTIN) {
+        /* get element type name */
+        char s_elemtypename[_TYPE_NAME_SIZE + 1];
+        _type_get_elem_typename(_GET_FLAT_HASHTABLE_TYPE_NAME(pt_hashtable), s_elemtypename);
+
+        _GET_FLAT_HASHTABLE_TYPE_INIT_FUNCTION(pt_hashtable)(pv_elem, s_elemtypename);
+    } else {
+        bool_t b_result = _GET_FLAT_HASHTABLE_TYPE_SIZE(pt_hashtable);
+        _GET_FLAT_HASHTABLE_TYPE_INIT_FUNCTION(pt_hashtable)(pv_elem, &b_result);
+        assert(b_result);
+    }
+}
+
+/**
+ * hash auxiliary
+ */
+void _flat_hashtable_hash_auxiliary(const _flat_hashtable_t* cpt_hashtable, const void* cpv_input, void* pv_output)
+{
+    assert(cpt_hashtable != NULL);
+    assert(cpv_input != NULL);
+    assert(pv_output != NULL);
+    assert(_flat_hashtable_is_inited(cpt_hashtable));
+
+    if (_GET_FLAT_HASHTABLE_TYPE_ID(cpt_hashtable) == _TYPE_ID_C_STRING) {
+        *(size_t*)pv_output = strlen(string_c_str((string_t*)cpv_input));
+        cpt_hashtable->_ufun_hash(string_c_str((string_t*)cpv_input), pv_output);
+    } else if (cpt_hashtable->_ufun_hash == _hashtable_default_hash) {
+        /* the default hash of element type sees the contents of cstl builtin types, not their handles */
+        _GET_FLAT_HASHTABLE_TYPE_HASH_FUNCTION(cpt_hashtable)(cpv_input, pv_output);
+    } else {
+        cpt_hashtable->_ufun_hash(cpv_input, pv_output);
+    }
+}
+
+/**
+ * Element compare function auxiliary
+ */
+void _flat_hashtable_elem_compare_auxiliary(
+    const _flat_hashtable_t* cpt_hashtable, const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpt_hashtable != NULL);
+    assert(cpv_first != NULL);
+    assert(cpv_second != NULL);
+    assert(pv_output != NULL);
+    assert(_flat_hashtable_is_inited(cpt_hashtable));
+
+    if (_GET_FLAT_HASHTABLE_TYPE_ID(cpt_hashtable) == _TYPE_ID_C_STRING &&
+        cpt_hashtable->_bfun_compare != _GET_FLAT_HASHTABLE_TYPE_LESS_FUNCTION(cpt_hashtable)) {
+        cpt_hashtable->_bfun_compare(string_c_str((string_t*)cpv_first), string_c_str((string_t*)cpv_second), pv_output);
+    } else {
+        cpt_hashtable->_bfun_compare(cpv_first, cpv_second, pv_output);
+    }
+}
+
+/**
+ * Element three-way compare function auxiliary
+ */
+int _flat_hashtable_elem_three_way_compare_auxiliary(
+    const _flat_hashtable_t* cpt_hashtable, const void* cpv_first, const void* cpv_second)
+{
+    int    n_result = 0;
+    bool_t b_result = false;
+
+    assert(cpt_hashtable != NULL);
+    assert(cpv_first != NULL);
+    assert(cpv_second != NULL);
+    assert(_flat_hashtable_is_inited(cpt_hashtable));
+
+    /* the three-way compare of element type agrees with the less of element type only */
+    if (cpt_hashtable->_bfun_compare == _GET_FLAT_HASHTABLE_TYPE_LESS_FUNCTION(cpt_hashtable) &&
+        _GET_FLAT_HASHTABLE_TYPE_COMPARE_FUNCTION(cpt_hashtable) != NULL) {
+        _GET_FLAT_HASHTABLE_TYPE_COMPARE_FUNCTION(cpt_hashtable)(cpv_first, cpv_second, &n_result);
+        return n_result;
+    }
+    /* the pairs of map containers are ordered by keys only */
+    if (_map_key_three_way_compare(cpt_hashtable->_bfun_compare, cpv_first, cpv_second, &n_result)) {
+        return n_result;
+    }
+
+    b_result = _GET_FLAT_HASHTABLE_TYPE_SIZE(cpt_hashtable);
+    _flat_hashtable_elem_compare_auxiliary(cpt_hashtable, cpv_first, cpv_second, &b_result);
+    if (b_result) {
+        return -1;
+    }
+    b_result = _GET_FLAT_HASHTABLE_TYPE_SIZE(cpt_hashtable);
+    _flat_hashtable_elem_compare_auxiliary(cpt_hashtable, cpv_second, cpv_first, &b_result);
+
+    return b_result ? 1 : 0;
+}
+
+/** local function implementation section **/
+
+/** eof **/
+
@@ -0,0 +1,209 @@
+/*
+ *  The interface of flat hashtable auxiliary function.
+ *  Copyright (C)  2008 - 2014  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+#ifndef _CSTL_FLAT_HASHTABLE_AUX_H_
+#define _CSTL_FLAT_HASHTABLE_AUX_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** include section **/
+
+/** constant declaration and macro section **/
+/* macros for type informations */
+#define _GET_FLAT_HASHTABLE_TYPE_SIZE(pt_hashtable)             ((pt_hashtable)->_t_typeinfo._pt_type->_t_typesize)
+#define _GET_FLAT_HASHTABLE_TYPE_NAME(pt_hashtable)             ((pt_hashtable)->_t_typeinfo._s_typename)
+#define _GET_FLAT_HASHTABLE_TYPE_BASENAME(pt_hashtable)         ((pt_hashtable)->_t_typeinfo._pt_type->_s_typename)
+#define _GET_FLAT_HASHTABLE_TYPE_ID(pt_hashtable)               ((pt_hashtable)->_t_typeinfo._pt_type->_t_typeid)
+#define _GET_FLAT_HASHTABLE_TYPE_INIT_FUNCTION(pt_hashtable)    ((pt_hashtable)->_t_typeinfo._pt_type->_t_typeinit)
+#define _GET_FLAT_HASHTABLE_TYPE_COPY_FUNCTION(pt_hashtable)    ((pt_hashtable)->_t_typeinfo._pt_type->_t_typecopy)
+#define _GET_FLAT_HASHTABLE_TYPE_LESS_FUNCTION(pt_hashtable)    ((pt_hashtable)->_t_typeinfo._pt_type->_t_typeless)
+#define _GET_FLAT_HASHTABLE_TYPE_DESTROY_FUNCTION(pt_hashtable) ((pt_hashtable)->_t_typeinfo._pt_type->_t_typedestroy)
+#define _GET_FLAT_HASHTABLE_TYPE_COMPARE_FUNCTION(pt_hashtable) ((pt_hashtable)->_t_typeinfo._pt_type->_t_typecompare)
+#define _GET_FLAT_HASHTABLE_TYPE_HASH_FUNCTION(pt_hashtable)    ((pt_hashtable)->_t_typeinfo._pt_type->_t_typehash)
+#define _GET_FLAT_HASHTABLE_TYPE_STYLE(pt_hashtable)            ((pt_hashtable)->_t_typeinfo._t_style)
+
+/* the number of control bytes that are matched at once */
+#define _FLAT_HASHTABLE_GROUP_WIDTH         16
+#define _FLAT_HASHTABLE_DEFAULT_SLOT_COUNT  64
+#define _FLAT_HASHTABLE_DEFAULT_MAX_LOAD_FACTOR 0.875f
+/* control byte of empty and deleted slot, the control byte of used slot is 0 ~ 127 */
+#define _FLAT_HASHTABLE_CTRL_EMPTY          ((_byte_t)0x80)
+#define _FLAT_HASHTABLE_CTRL_DELETED        ((_byte_t)0xfe)
+#define _FLAT_HASHTABLE_CTRL_IS_FULL(by_ctrl) (((by_ctrl) & 0x80) == 0)
+
+/* get the slot by index */
+#define _FLAT_HASHTABLE_SLOT(pt_hashtable, t_index)\
+    ((pt_hashtable)->_pby_slot + (t_index) * _GET_FLAT_HASHTABLE_TYPE_SIZE(pt_hashtable))
+/* the max element count of flat hashtable, the max load factor is 7/8 */
+#define _FLAT_HASHTABLE_CAPACITY(t_slotcount) ((t_slotcount) - (t_slotcount) / 8)
+
+/** data type declaration and struct, union, enum section **/
+
+/** exported global variable declaration section **/
+
+/** exported function prototype section **/
+#ifndef NDEBUG
+/**
+ * Test flat hashtable is created by _create_flat_hashtable.
+ * @param cpt_hashtable         flat hashtable container.
+ * @return if flat hashtable is created by _create_flat_hashtable, then return true, else return false.
+ * @remarks if cpt_hashtable == NULL, then the behavior is undefined.
+ */
+extern bool_t _flat_hashtable_is_created(const _flat_hashtable_t* cpt_hashtable);
+
+/**
+ * Test flat hashtable is initialized by flat hashtable initialization functions.
+ * @param cpt_hashtable         flat hashtable container.
+ * @return if flat hashtable is initialized by flat hashtable initialization functions, then return true, else return false.
+ * @remarks if cpt_hashtable == NULL, then the behavior is undefined.
+ */
+extern bool_t _flat_hashtable_is_inited(const _flat_hashtable_t* cpt_hashtable);
+
+/**
+ * Test iterator referenced data is within the flat hashtable.
+ * @param cpt_hashtable         point to flat hashtable.
+ * @param it_iter               flat hashtable iterator.
+ * @return if iterator referenced is within the flat hashtable, then return true, otherwise return false.
+ * @remarks if cpt_hashtable == NULL, then the behavior is undefined, cpt_hashtable must be initialized, otherwise the
+ *          behavior is undefined. the it_iter must be valie flat hashtable iterator, otherwist the behavior is undefined.
+ */
+extern bool_t _flat_hashtable_iterator_belong_to_flat_hashtable(
+    const _flat_hashtable_t* cpt_hashtable, _flat_hashtable_iterator_t it_iter);
+
+/**
+ * Test the type that saved in the flat hashtable container and referenced by it_iter are same.
+ * @param cpt_hashtable         flat hashtable container.
+ * @param it_iter               iterator.
+ * @return if the type is same, return true, else return false.
+ * @remarks if cpt_hashtable == NULL, then the behavior is undefined.
+ */
+extern bool_t _flat_hashtable_same_iterator_type(const _flat_hashtable_t* cpt_hashtable, iterator_t it_iter);
+#endif /* NDEBUG */
+
+/**
+ * Test the type that saved in the flat hashtable container is same.
+ * @param cpt_first             first flat hashtable.
+ * @param cpt_second            second flat hashtable.
+ * @return if the type is same, return true, else return false.
+ * @remarks if cpt_first == NULL or cpt_second == NULL, the behavior is undefined. the two flat hashtable must be
+ *          initialized or created by _create_flat_hashtable(), otherwise the behavior is undefined. if
+ *          cpt_first == cpt_second then return true.
+ */
+extern bool_t _flat_hashtable_same_type(const _flat_hashtable_t* cpt_first, const _flat_hashtable_t* cpt_second);
+
+/**
+ * Test the type and compare function that saved in the flat hashtable container is same.
+ * @param cpt_first             first flat hashtable.
+ * @param cpt_second            second flat hashtable.
+ * @return if the type is same, return true, else return false.
+ * @remarks if cpt_first == NULL or cpt_second == NULL, the behavior is undefined. the two flat hashtable must be
+ *          initialized or created by _create_flat_hashtable(), otherwise the behavior is undefined. if
+ *          cpt_first == cpt_second then return true. the slot count is not compared, it depends on the history of
+ *          insertion.
+ */
+extern bool_t _flat_hashtable_same_type_ex(const _flat_hashtable_t* cpt_first, const _flat_hashtable_t* cpt_second);
+
+/**
+ * Get the slot count that is power of 2 and not less than the specific count.
+ * @param t_count               specific count.
+ * @return slot count.
+ * @remarks the slot count is not less than _FLAT_HASHTABLE_GROUP_WIDTH.
+ */
+extern size_t _flat_hashtable_get_slot_count(size_t t_count);
+
+/**
+ * Get the max element count of specific number of slots under the max load factor.
+ * @param cpt_hashtable         flat hashtable container.
+ * @param t_slotcount           slot count.
+ * @return the max element count.
+ * @remarks if cpt_hashtable == NULL, then the behavior is undefined. the max element count is not more than
+ *          _FLAT_HASHTABLE_CAPACITY(t_slotcount) and not less than 1.
+ */
+extern size_t _flat_hashtable_get_capacity_auxiliary(const _flat_hashtable_t* cpt_hashtable, size_t t_slotcount);
+
+/**
+ * Get the least slot count that holds specific number of elements under the max load factor.
+ * @param cpt_hashtable         flat hashtable container.
+ * @param t_elemcount           element count.
+ * @return slot count.
+ * @remarks if cpt_hashtable == NULL, then the behavior is undefined. the slot count is power of 2 and not less than
+ *          _FLAT_HASHTABLE_GROUP_WIDTH.
+ */
+extern size_t _flat_hashtable_get_least_slot_count_auxiliary(const _flat_hashtable_t* cpt_hashtable, size_t t_elemcount);
+
+/**
+ * Initialize element auxiliary function
+ * @param pt_hashtable          flat hashtable.
+ * @param pv_elem               uninitialized slot.
+ * @return void.
+ * @remarks if pt_hashtable == NULL or pv_elem == NULL, then the behavior is undefined. pt_hashtable must be initialized
+ *          or created by _create_flat_hashtable(), otherwise the behavior is undefined.
+ */
+extern void _flat_hashtable_init_elem_auxiliary(_flat_hashtable_t* pt_hashtable, void* pv_elem);
+
+/**
+ * Hash auxiliary function
+ * @param cpt_hashtable         flat hashtable.
+ * @param cpv_input             input.
+ * @param pv_output             output.
+ * @return void.
+ * @remarks if cpt_hashtable == NULL, cpv_input == NULL or pv_output == NULL, then the behavior is undefined.
+ *          cpt_hashtable must be initialized, otherwise the behavior is undefined.
+ */
+extern void _flat_hashtable_hash_auxiliary(const _flat_hashtable_t* cpt_hashtable, const void* cpv_input, void* pv_output);
+
+/**
+ * Element compare function auxiliary
+ * @param cpt_hashtable         flat hashtable.
+ * @param cpv_first             first element.
+ * @param cpv_second            second element.
+ * @param pv_output             output.
+ * @return void.
+ * @remarks if cpt_hashtable == NULL, cpv_first == NULL, cpv_second == NULL or pv_output == NULL, then the behavior
+ *          is undefined. cpt_hashtable must be initialized, otherwise the behavior is undefined.
+ */
+extern void _flat_hashtable_elem_compare_auxiliary(
+    const _flat_hashtable_t* cpt_hashtable, const void* cpv_first, const void* cpv_second, void* pv_output);
+
+/**
+ * Element three-way compare function auxiliary
+ * @param cpt_hashtable         flat hashtable.
+ * @param cpv_first             first element.
+ * @param cpv_second            second element.
+ * @return negative if the first element is less than the second element, positive if it is greater, otherwise zero.
+ * @remarks if cpt_hashtable == NULL, cpv_first == NULL or cpv_second == NULL, then the behavior is undefined. cpt_hashtable
+ *          must be initialized, otherwise the behavior is undefined. The three-way compare function
+ *          of element type is invoked once when the flat hashtable is ordered by the less function of element type,
+ *          otherwise the compare function of flat hashtable is invoked twice.
+ */
+extern int _flat_hashtable_elem_three_way_compare_auxiliary(
+    const _flat_hashtable_t* cpt_hashtable, const void* cpv_first, const void* cpv_second);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CSTL_FLAT_HASHTABLE_AUX_H_ */
+/** eof **/
+
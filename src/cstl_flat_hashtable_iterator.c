@@ -0,0 +1,217 @@
+/*
+ *  The implementation of flat hashtable iterator.
+ *  Copyright (C)  2008 - 2014  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+/** include section **/
+#include <cstl/cstl_def.h>
+#include <cstl/cstl_alloc.h>
+#include <cstl/cstl_types.h>
+#include <cstl/citerator.h>
+#include <cstl/cstring.h>
+
+#include <cstl/cstl_flat_hashtable_iterator.h>
+#include <cstl/cstl_flat_hashtable_private.h>
+#include <cstl/cstl_flat_hashtable.h>
+
+#include "cstl_flat_hashtable_aux.h"
+
+/** local constant declaration and local macro section **/
+
+/** local data type declaration and local struct, union, enum section **/
+
+/** local function prototype section **/
+
+/** exported global variable definition section **/
+
+/** local global variable definition section **/
+
+/** exported function implementation section **/
+/**
+ * Create flat hashtable iterator.
+ */
+_flat_hashtable_iterator_t _create_flat_hashtable_iterator(void)
+{
+    _flat_hashtable_iterator_t it_iter;
+
+    _FLAT_HASHTABLE_ITERATOR_CTRLPOS(it_iter) = NULL;
+    _FLAT_HASHTABLE_ITERATOR_COREPOS(it_iter) = NULL;
+    _FLAT_HASHTABLE_ITERATOR_HASHTABLE_POINTER(it_iter) = NULL;
+
+    _ITERATOR_CONTAINER(it_iter) = NULL;
+
+    return it_iter;
+}
+
+/**
+ * Test the two flat hashtable iterator are equal.
+ */
+bool_t _flat_hashtable_iterator_equal(_flat_hashtable_iterator_t it_first, _flat_hashtable_iterator_t it_second)
+{
+    assert(_flat_hashtable_iterator_belong_to_flat_hashtable(_FLAT_HASHTABLE_ITERATOR_HASHTABLE(it_first), it_first));
+    assert(_flat_hashtable_iterator_belong_to_flat_hashtable(_FLAT_HASHTABLE_ITERATOR_HASHTABLE(it_second), it_second));
+    assert(_FLAT_HASHTABLE_ITERATOR_HASHTABLE(it_first) == _FLAT_HASHTABLE_ITERATOR_HASHTABLE(it_second));
+
+    return _FLAT_HASHTABLE_ITERATOR_CTRLPOS(it_first) == _FLAT_HASHTABLE_ITERATOR_CTRLPOS(it_second) ? true : false;
+}
+
+/**
+ * Get data value referenced by iterator.
+ */
+void _flat_hashtable_iterator_get_value(_flat_hashtable_iterator_t it_iter, void* pv_value)
+{
+    assert(pv_value != NULL);
+    assert(_flat_hashtable_iterator_belong_to_flat_hashtable(_FLAT_HASHTABLE_ITERATOR_HASHTABLE(it_iter), it_iter));
+    assert(_FLAT_HASHTABLE_ITERATOR_COREPOS(it_iter) != NULL);
+
+    /* char* */
+    if (_GET_FLAT_HASHTABLE_TYPE_ID(_FLAT_HASHTABLE_ITERATOR_HASHTABLE(it_iter)) == _TYPE_ID_C_STRING) {
+        *(char**)pv_value = (char*)string_c_str((string_t*)_FLAT_HASHTABLE_ITERATOR_COREPOS(it_iter));
+    } else {
+        bool_t b_result = _GET_FLAT_HASHTABLE_TYPE_SIZE(_FLAT_HASHTABLE_ITERATOR_HASHTABLE(it_iter));
+        _GET_FLAT_HASHTABLE_TYPE_COPY_FUNCTION(_FLAT_HASHTABLE_ITERATOR_HASHTABLE(it_iter))(
+            pv_value, _FLAT_HASHTABLE_ITERATOR_COREPOS(it_iter), &b_result);
+        assert(b_result);
+    }
+}
+
+/**
+ * Get data value pointer referenced by iterator.
+ */
+const void* _flat_hashtable_iterator_get_pointer(_flat_hashtable_iterator_t it_iter)
+{
+    assert(_flat_hashtable_iterator_belong_to_flat_hashtable(_FLAT_HASHTABLE_ITERATOR_HASHTABLE(it_iter), it_iter));
+    assert(_FLAT_HASHTABLE_ITERATOR_COREPOS(it_iter) != NULL);
+
+    /* char* */
+    if (_GET_FLAT_HASHTABLE_TYPE_ID(_FLAT_HASHTABLE_ITERATOR_HASHTABLE(it_iter)) == _TYPE_ID_C_STRING) {
+        return (char*)string_c_str((string_t*)_FLAT_HASHTABLE_ITERATOR_COREPOS(it_iter));
+    } else {
+        return _FLAT_HASHTABLE_ITERATOR_COREPOS(it_iter);
+    }
+}
+
+/**
+ * Get data value pointer referenced by iterator, but ignore char*.
+ */
+const void* _flat_hashtable_iterator_get_pointer_ignore_cstr(_flat_hashtable_iterator_t it_iter)
+{
+    assert(_flat_hashtable_iterator_belong_to_flat_hashtable(_FLAT_HASHTABLE_ITERATOR_HASHTABLE(it_iter), it_iter));
+    assert(_FLAT_HASHTABLE_ITERATOR_COREPOS(it_iter) != NULL);
+
+    return _FLAT_HASHTABLE_ITERATOR_COREPOS(it_iter);
+}
+
+/**
+ * Return iterator reference previous element.
+ */
+_flat_hashtable_iterator_t _flat_hashtable_iterator_prev(_flat_hashtable_iterator_t it_iter)
+{
+    _flat_hashtable_t* pt_hashtable = NULL;
+    size_t             t_index = 0;
+
+    assert(_flat_hashtable_iterator_belong_to_flat_hashtable(_FLAT_HASHTABLE_ITERATOR_HASHTABLE(it_iter), it_iter));
+    assert(!_flat_hashtable_iterator_equal(it_iter, _flat_hashtable_begin(_FLAT_HASHTABLE_ITERATOR_HASHTABLE(it_iter))));
+
+    pt_hashtable = _FLAT_HASHTABLE_ITERATOR_HASHTABLE(it_iter);
+    t_index = (size_t)(_FLAT_HASHTABLE_ITERATOR_CTRLPOS(it_iter) - pt_hashtable->_pby_ctrl);
+    while (t_index > 0) {
+        --t_index;
+        if (_FLAT_HASHTABLE_CTRL_IS_FULL(pt_hashtable->_pby_ctrl[t_index])) {
+            _FLAT_HASHTABLE_ITERATOR_CTRLPOS(it_iter) = pt_hashtable->_pby_ctrl + t_index;
+            _FLAT_HASHTABLE_ITERATOR_COREPOS(it_iter) = _FLAT_HASHTABLE_SLOT(pt_hashtable, t_index);
+            break;
+        }
+    }
+
+    return it_iter;
+}
+
+/**
+ * Return iterator reference next element.
+ */
+_flat_hashtable_iterator_t _flat_hashtable_iterator_next(_flat_hashtable_iterator_t it_iter)
+{
+    _flat_hashtable_t* pt_hashtable = NULL;
+    size_t             t_index = 0;
+
+    assert(_flat_hashtable_iterator_belong_to_flat_hashtable(_FLAT_HASHTABLE_ITERATOR_HASHTABLE(it_iter), it_iter));
+    assert(_FLAT_HASHTABLE_ITERATOR_COREPOS(it_iter) != NULL);
+
+    pt_hashtable = _FLAT_HASHTABLE_ITERATOR_HASHTABLE(it_iter);
+    t_index = (size_t)(_FLAT_HASHTABLE_ITERATOR_CTRLPOS(it_iter) - pt_hashtable->_pby_ctrl) + 1;
+    while (t_index < pt_hashtable->_t_slotcount && !_FLAT_HASHTABLE_CTRL_IS_FULL(pt_hashtable->_pby_ctrl[t_index])) {
+        ++t_index;
+    }
+
+    /* the end iterator is located after the last control byte */
+    _FLAT_HASHTABLE_ITERATOR_CTRLPOS(it_iter) = pt_hashtable->_pby_ctrl + t_index;
+    _FLAT_HASHTABLE_ITERATOR_COREPOS(it_iter) =
+        t_index < pt_hashtable->_t_slotcount ? _FLAT_HASHTABLE_SLOT(pt_hashtable, t_index) : NULL;
+
+    return it_iter;
+}
+
+/**
+ * Calculate distance between two iterators.
+ */
+int _flat_hashtable_iterator_distance(_flat_hashtable_iterator_t it_first, _flat_hashtable_iterator_t it_second)
+{
+    _byte_t* pby_pos = NULL;
+    _byte_t* pby_begin = NULL;
+    _byte_t* pby_end = NULL;
+    int      n_distance = 0;
+
+    assert(_flat_hashtable_iterator_belong_to_flat_hashtable(_FLAT_HASHTABLE_ITERATOR_HASHTABLE(it_first), it_first));
+    assert(_flat_hashtable_iterator_belong_to_flat_hashtable(_FLAT_HASHTABLE_ITERATOR_HASHTABLE(it_second), it_second));
+    assert(_FLAT_HASHTABLE_ITERATOR_HASHTABLE(it_first) == _FLAT_HASHTABLE_ITERATOR_HASHTABLE(it_second));
+
+    /* the number of used slots in [begin, end) */
+    if (_flat_hashtable_iterator_before(it_first, it_second)) {
+        pby_begin = _FLAT_HASHTABLE_ITERATOR_CTRLPOS(it_first);
+        pby_end = _FLAT_HASHTABLE_ITERATOR_CTRLPOS(it_second);
+    } else {
+        pby_begin = _FLAT_HASHTABLE_ITERATOR_CTRLPOS(it_second);
+        pby_end = _FLAT_HASHTABLE_ITERATOR_CTRLPOS(it_first);
+    }
+    for (pby_pos = pby_begin; pby_pos != pby_end; ++pby_pos) {
+        if (_FLAT_HASHTABLE_CTRL_IS_FULL(*pby_pos)) {
+            n_distance++;
+        }
+    }
+
+    return pby_begin == _FLAT_HASHTABLE_ITERATOR_CTRLPOS(it_first) ? n_distance : -n_distance;
+}
+
+/**
+ * Test the first iterator is before the second.
+ */
+bool_t _flat_hashtable_iterator_before(_flat_hashtable_iterator_t it_first, _flat_hashtable_iterator_t it_second)
+{
+    assert(_flat_hashtable_iterator_belong_to_flat_hashtable(_FLAT_HASHTABLE_ITERATOR_HASHTABLE(it_first), it_first));
+    assert(_flat_hashtable_iterator_belong_to_flat_hashtable(_FLAT_HASHTABLE_ITERATOR_HASHTABLE(it_second), it_second));
+    assert(_FLAT_HASHTABLE_ITERATOR_HASHTABLE(it_first) == _FLAT_HASHTABLE_ITERATOR_HASHTABLE(it_second));
+
+    return _FLAT_HASHTABLE_ITERATOR_CTRLPOS(it_first) < _FLAT_HASHTABLE_ITERATOR_CTRLPOS(it_second) ? true : false;
+}
+
+/** local function implementation section **/
+
+/** eof **/
@@ -601,6 +601,28 @@ bfun_t _fun_get_binary(iterator_t it_iter, fun_type_t ftype_type)
     return fun_default_binary;
 }
 
+/**
+ * Select the three-way compare function of element type that agrees with a less predicate.
+ */
+bfun_t _fun_get_three_way_compare(iterator_t it_iter, bfun_t bfun_op)
+{
+    _typeinfo_t* pt_typeinfo = NULL;
+
+    assert(_iterator_is_valid(it_iter));
+
+    pt_typeinfo = _iterator_get_typeinfo(it_iter);
+    if (bfun_op == NULL || pt_typeinfo == NULL || pt_typeinfo->_pt_type == NULL ||
+        pt_typeinfo->_pt_type->_t_typecompare == NULL) {
+        return NULL;
+    }
+
+    if (bfun_op == pt_typeinfo->_pt_type->_t_typeless || bfun_op == _fun_get_binary(it_iter, _LESS_FUN)) {
+        return pt_typeinfo->_pt_type->_t_typecompare;
+    } else {
+        return NULL;
+    }
+}
+
 
 /**
  * Increase.
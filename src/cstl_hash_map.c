@@ -29,8 +29,11 @@
 #include <cstl/chash_map.h>
 
 #include "cstl_hash_map_aux.h"
+#include "cstl_pair_aux.h"
 
 /** local constant declaration and local macro section **/
+/* the number of keys that are passed to the hashtable together in batch find */
+#define _HASH_MAP_FIND_BATCH_COUNT 16
 
 /** local data type declaration and local struct, union, enum section **/
 
@@ -67,7 +70,11 @@ void hash_map_init_ex(hash_map_t* phmap_map, size_t t_bucketcount, ufun_t ufun_h
     ufun_default_hash = ufun_hash != NULL ? ufun_hash : _hash_map_default_hash;
 
     /* initialize the hashtable */
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_init(&phmap_map->_t_hashtable, t_bucketcount, ufun_default_hash, _hash_map_value_compare);
+#else
     _hashtable_init(&phmap_map->_t_hashtable, t_bucketcount, ufun_default_hash, _hash_map_value_compare);
+#endif
 }
 
 /**
@@ -90,6 +97,7 @@ void hash_map_init_copy(hash_map_t* phmap_dest, const hash_map_t* cphmap_src)
     assert(_pair_is_inited(&cphmap_src->_pair_temp));
 
     hash_map_init_ex(phmap_dest, hash_map_bucket_count(cphmap_src), hash_map_hash(cphmap_src), hash_map_key_comp(cphmap_src));
+    hash_map_set_max_load_factor(phmap_dest, hash_map_max_load_factor(cphmap_src));
     phmap_dest->_bfun_keycompare = cphmap_src->_bfun_keycompare;
     phmap_dest->_bfun_valuecompare = cphmap_src->_bfun_valuecompare;
     phmap_dest->_pair_temp._bfun_mapkeycompare = cphmap_src->_pair_temp._bfun_mapkeycompare;
@@ -179,7 +187,11 @@ void hash_map_swap(hash_map_t* phmap_first, hash_map_t* phmap_second)
     assert(_pair_is_inited(&phmap_second->_pair_temp));
     assert(_hash_map_same_pair_type_ex(&phmap_first->_pair_temp, &phmap_second->_pair_temp));
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_swap(&phmap_first->_t_hashtable, &phmap_second->_t_hashtable);
+#else
     _hashtable_swap(&phmap_first->_t_hashtable, &phmap_second->_t_hashtable);
+#endif
 }
 
 /**
@@ -190,7 +202,11 @@ size_t hash_map_size(const hash_map_t* cphmap_map)
     assert(cphmap_map != NULL);
     assert(_pair_is_inited(&cphmap_map->_pair_temp));
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_size(&cphmap_map->_t_hashtable);
+#else
     return _hashtable_size(&cphmap_map->_t_hashtable);
+#endif
 }
 
 /**
@@ -201,7 +217,11 @@ bool_t hash_map_empty(const hash_map_t* cphmap_map)
     assert(cphmap_map != NULL);
     assert(_pair_is_inited(&cphmap_map->_pair_temp));
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_empty(&cphmap_map->_t_hashtable);
+#else
     return _hashtable_empty(&cphmap_map->_t_hashtable);
+#endif
 }
 
 /**
@@ -212,7 +232,35 @@ size_t hash_map_max_size(const hash_map_t* cphmap_map)
     assert(cphmap_map != NULL);
     assert(_pair_is_inited(&cphmap_map->_pair_temp));
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_max_size(&cphmap_map->_t_hashtable);
+#else
     return _hashtable_max_size(&cphmap_map->_t_hashtable);
+#endif
+}
+
+/**
+ * Get the memory that is held by the hash_map.
+ */
+size_t hash_map_memory_usage(const hash_map_t* cphmap_map)
+{
+    size_t t_usage = 0;
+
+    assert(cphmap_map != NULL);
+    assert(_pair_is_inited(&cphmap_map->_pair_temp));
+
+#ifdef CSTL_HASH_FLAT_TABLE
+    t_usage = _flat_hashtable_memory_usage(&cphmap_map->_t_hashtable);
+    /* the slots hold the pairs, the key and value of each pair element and the temporary pair are in separate blocks */
+    t_usage += (hash_map_size(cphmap_map) + 1) *
+               _PAIR_STORAGE_SIZE(_GET_HASH_MAP_FIRST_TYPE_SIZE(cphmap_map), _GET_HASH_MAP_SECOND_TYPE_SIZE(cphmap_map));
+#else
+    t_usage = _hashtable_memory_usage(&cphmap_map->_t_hashtable);
+    /* the key and value of pair elements are stored inline in the nodes, only the temporary pair has a separate block */
+    t_usage += _PAIR_STORAGE_SIZE(_GET_HASH_MAP_FIRST_TYPE_SIZE(cphmap_map), _GET_HASH_MAP_SECOND_TYPE_SIZE(cphmap_map));
+#endif
+
+    return sizeof(hash_map_t) + t_usage;
 }
 
 /**
@@ -223,7 +271,11 @@ size_t hash_map_bucket_count(const hash_map_t* cphmap_map)
     assert(cphmap_map != NULL);
     assert(_pair_is_inited(&cphmap_map->_pair_temp));
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_bucket_count(&cphmap_map->_t_hashtable);
+#else
     return _hashtable_bucket_count(&cphmap_map->_t_hashtable);
+#endif
 }
 
 /**
@@ -234,7 +286,11 @@ ufun_t hash_map_hash(const hash_map_t* cphmap_map)
     assert(cphmap_map != NULL);
     assert(_pair_is_inited(&cphmap_map->_pair_temp));
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_hash(&cphmap_map->_t_hashtable);
+#else
     return _hashtable_hash(&cphmap_map->_t_hashtable);
+#endif
 }
 
 /**
@@ -275,7 +331,86 @@ void hash_map_resize(hash_map_t* phmap_map, size_t t_resize)
     assert(phmap_map != NULL);
     assert(_pair_is_inited(&phmap_map->_pair_temp));
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_resize(&phmap_map->_t_hashtable, t_resize);
+#else
     _hashtable_resize(&phmap_map->_t_hashtable, t_resize);
+#endif
+}
+
+/**
+ * Get the average number of elements per bucket.
+ */
+float hash_map_load_factor(const hash_map_t* cphmap_map)
+{
+    assert(cphmap_map != NULL);
+    assert(_pair_is_inited(&cphmap_map->_pair_temp));
+
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_load_factor(&cphmap_map->_t_hashtable);
+#else
+    return _hashtable_load_factor(&cphmap_map->_t_hashtable);
+#endif
+}
+
+/**
+ * Get the max load factor of hash_map.
+ */
+float hash_map_max_load_factor(const hash_map_t* cphmap_map)
+{
+    assert(cphmap_map != NULL);
+    assert(_pair_is_inited(&cphmap_map->_pair_temp));
+
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_max_load_factor(&cphmap_map->_t_hashtable);
+#else
+    return _hashtable_max_load_factor(&cphmap_map->_t_hashtable);
+#endif
+}
+
+/**
+ * Set the max load factor of hash_map.
+ */
+void hash_map_set_max_load_factor(hash_map_t* phmap_map, float f_maxloadfactor)
+{
+    assert(phmap_map != NULL);
+    assert(_pair_is_inited(&phmap_map->_pair_temp));
+
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_set_max_load_factor(&phmap_map->_t_hashtable, f_maxloadfactor);
+#else
+    _hashtable_set_max_load_factor(&phmap_map->_t_hashtable, f_maxloadfactor);
+#endif
+}
+
+/**
+ * Reserve buckets for specific number of elements.
+ */
+void hash_map_reserve(hash_map_t* phmap_map, size_t t_count)
+{
+    assert(phmap_map != NULL);
+    assert(_pair_is_inited(&phmap_map->_pair_temp));
+
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_reserve(&phmap_map->_t_hashtable, t_count);
+#else
+    _hashtable_reserve(&phmap_map->_t_hashtable, t_count);
+#endif
+}
+
+/**
+ * Shrink the buckets to fit the elements.
+ */
+void hash_map_shrink_to_fit(hash_map_t* phmap_map)
+{
+    assert(phmap_map != NULL);
+    assert(_pair_is_inited(&phmap_map->_pair_temp));
+
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_shrink_to_fit(&phmap_map->_t_hashtable);
+#else
+    _hashtable_shrink_to_fit(&phmap_map->_t_hashtable);
+#endif
 }
 
 /**
@@ -288,7 +423,11 @@ hash_map_iterator_t hash_map_begin(const hash_map_t* cphmap_map)
     assert(cphmap_map != NULL);
     assert(_pair_is_inited(&cphmap_map->_pair_temp));
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    it_begin = _flat_hashtable_begin(&cphmap_map->_t_hashtable);
+#else
     it_begin = _hashtable_begin(&cphmap_map->_t_hashtable);
+#endif
 
     _ITERATOR_CONTAINER(it_begin) = (hash_map_t*)cphmap_map;
     _HASH_MAP_ITERATOR_CONTAINER_TYPE(it_begin) = _HASH_MAP_CONTAINER;
@@ -307,7 +446,11 @@ hash_map_iterator_t hash_map_end(const hash_map_t* cphmap_map)
     assert(cphmap_map != NULL);
     assert(_pair_is_inited(&cphmap_map->_pair_temp));
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    it_end = _flat_hashtable_end(&cphmap_map->_t_hashtable);
+#else
     it_end = _hashtable_end(&cphmap_map->_t_hashtable);
+#endif
 
     _ITERATOR_CONTAINER(it_end) = (hash_map_t*)cphmap_map;
     _HASH_MAP_ITERATOR_CONTAINER_TYPE(it_end) = _HASH_MAP_CONTAINER;
@@ -330,7 +473,11 @@ bool_t hash_map_equal(const hash_map_t* cphmap_first, const hash_map_t* cphmap_s
         return false;
     }
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_equal(&cphmap_first->_t_hashtable, &cphmap_second->_t_hashtable);
+#else
     return _hashtable_equal(&cphmap_first->_t_hashtable, &cphmap_second->_t_hashtable);
+#endif
 }
 
 /**
@@ -347,7 +494,11 @@ bool_t hash_map_not_equal(const hash_map_t* cphmap_first, const hash_map_t* cphm
         return true;
     }
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_not_equal(&cphmap_first->_t_hashtable, &cphmap_second->_t_hashtable);
+#else
     return _hashtable_not_equal(&cphmap_first->_t_hashtable, &cphmap_second->_t_hashtable);
+#endif
 }
 
 /**
@@ -361,7 +512,11 @@ bool_t hash_map_less(const hash_map_t* cphmap_first, const hash_map_t* cphmap_se
     assert(_pair_is_inited(&cphmap_second->_pair_temp));
     assert(_hash_map_same_pair_type_ex(&cphmap_first->_pair_temp, &cphmap_second->_pair_temp));
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_less(&cphmap_first->_t_hashtable, &cphmap_second->_t_hashtable);
+#else
     return _hashtable_less(&cphmap_first->_t_hashtable, &cphmap_second->_t_hashtable);
+#endif
 }
 
 /**
@@ -375,7 +530,11 @@ bool_t hash_map_less_equal(const hash_map_t* cphmap_first, const hash_map_t* cph
     assert(_pair_is_inited(&cphmap_second->_pair_temp));
     assert(_hash_map_same_pair_type_ex(&cphmap_first->_pair_temp, &cphmap_second->_pair_temp));
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_less_equal(&cphmap_first->_t_hashtable, &cphmap_second->_t_hashtable);
+#else
     return _hashtable_less_equal(&cphmap_first->_t_hashtable, &cphmap_second->_t_hashtable);
+#endif
 }
 
 /**
@@ -389,7 +548,11 @@ bool_t hash_map_greater(const hash_map_t* cphmap_first, const hash_map_t* cphmap
     assert(_pair_is_inited(&cphmap_second->_pair_temp));
     assert(_hash_map_same_pair_type_ex(&cphmap_first->_pair_temp, &cphmap_second->_pair_temp));
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_greater(&cphmap_first->_t_hashtable, &cphmap_second->_t_hashtable);
+#else
     return _hashtable_greater(&cphmap_first->_t_hashtable, &cphmap_second->_t_hashtable);
+#endif
 }
 
 /**
@@ -403,7 +566,11 @@ bool_t hash_map_greater_equal(const hash_map_t* cphmap_first, const hash_map_t*
     assert(_pair_is_inited(&cphmap_second->_pair_temp));
     assert(_hash_map_same_pair_type_ex(&cphmap_first->_pair_temp, &cphmap_second->_pair_temp));
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_greater_equal(&cphmap_first->_t_hashtable, &cphmap_second->_t_hashtable);
+#else
     return _hashtable_greater_equal(&cphmap_first->_t_hashtable, &cphmap_second->_t_hashtable);
+#endif
 }
 
 /**
@@ -424,7 +591,11 @@ hash_map_iterator_t hash_map_insert(hash_map_t* phmap_map, const pair_t* cppair_
     assert(_hash_map_same_pair_type_ex(&phmap_map->_pair_temp, cppair_pair));
 
     /* insert int hashtable */
+#ifdef CSTL_HASH_FLAT_TABLE
+    it_iter = _flat_hashtable_insert_unique(&phmap_map->_t_hashtable, cppair_pair);
+#else
     it_iter = _hashtable_insert_unique(&phmap_map->_t_hashtable, cppair_pair);
+#endif
 
     _ITERATOR_CONTAINER(it_iter) = phmap_map;
     _HASH_MAP_ITERATOR_CONTAINER_TYPE(it_iter) = _HASH_MAP_CONTAINER;
@@ -478,7 +649,11 @@ void hash_map_erase_pos(hash_map_t* phmap_map, hash_map_iterator_t it_pos)
     assert(_HASH_MAP_ITERATOR_ITERATOR_TYPE(it_pos) == _BIDIRECTIONAL_ITERATOR);
     assert(_HASH_MAP_ITERATOR_CONTAINER(it_pos) == phmap_map);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_erase_pos(&phmap_map->_t_hashtable, it_pos);
+#else
     _hashtable_erase_pos(&phmap_map->_t_hashtable, it_pos);
+#endif
 }
 
 /*
@@ -495,7 +670,11 @@ void hash_map_erase_range(hash_map_t* phmap_map, hash_map_iterator_t it_begin, h
     assert(_HASH_MAP_ITERATOR_CONTAINER(it_begin) == phmap_map);
     assert(_HASH_MAP_ITERATOR_CONTAINER(it_end) == phmap_map);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_erase_range(&phmap_map->_t_hashtable, it_begin, it_end);
+#else
     _hashtable_erase_range(&phmap_map->_t_hashtable, it_begin, it_end);
+#endif
 }
 
 /**
@@ -506,7 +685,156 @@ void hash_map_clear(hash_map_t* phmap_map)
     assert(phmap_map != NULL);
     assert(_pair_is_inited(&phmap_map->_pair_temp));
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_clear(&phmap_map->_t_hashtable);
+#else
     _hashtable_clear(&phmap_map->_t_hashtable);
+#endif
+}
+
+/**
+ * Find specific element by the key that is pointed by pointer.
+ */
+hash_map_iterator_t hash_map_find_ptr(const hash_map_t* cphmap_map, const void* cpv_key)
+{
+    hash_map_iterator_t it_iter;
+    _pairkey_t t_key;
+
+    assert(cphmap_map != NULL);
+    assert(cpv_key != NULL);
+
+    /* the key is made on the stack, so that the lookup does not modify map */
+    _pair_key_init_ptr(&t_key, &cphmap_map->_pair_temp, cpv_key);
+#ifdef CSTL_HASH_FLAT_TABLE
+    it_iter = _flat_hashtable_find(&cphmap_map->_t_hashtable, &t_key._pair_key);
+#else
+    it_iter = _hashtable_find(&cphmap_map->_t_hashtable, &t_key._pair_key);
+#endif
+    _pair_key_destroy(&t_key);
+
+    _ITERATOR_CONTAINER(it_iter) = (hash_map_t*)cphmap_map;
+    _HASH_MAP_ITERATOR_CONTAINER_TYPE(it_iter) = _HASH_MAP_CONTAINER;
+    _HASH_MAP_ITERATOR_ITERATOR_TYPE(it_iter) = _BIDIRECTIONAL_ITERATOR;
+
+    return it_iter;
+}
+
+/**
+ * Return the number of elements whose key is pointed by pointer.
+ */
+size_t hash_map_count_ptr(const hash_map_t* cphmap_map, const void* cpv_key)
+{
+    size_t     t_count = 0;
+    _pairkey_t t_key;
+
+    assert(cphmap_map != NULL);
+    assert(cpv_key != NULL);
+
+    /* the key is made on the stack, so that the lookup does not modify map */
+    _pair_key_init_ptr(&t_key, &cphmap_map->_pair_temp, cpv_key);
+#ifdef CSTL_HASH_FLAT_TABLE
+    t_count = _flat_hashtable_count(&cphmap_map->_t_hashtable, &t_key._pair_key);
+#else
+    t_count = _hashtable_count(&cphmap_map->_t_hashtable, &t_key._pair_key);
+#endif
+    _pair_key_destroy(&t_key);
+
+    return t_count;
+}
+
+/**
+ * Find a batch of elements by the keys in array.
+ */
+void hash_map_find_batch(
+    const hash_map_t* cphmap_map, const void* cpv_keys, size_t t_count, hash_map_iterator_t* pit_result)
+{
+    _pairkey_t  at_key[_HASH_MAP_FIND_BATCH_COUNT];
+    const void* acpv_key[_HASH_MAP_FIND_BATCH_COUNT];
+    const void* cpv_key = NULL;
+    size_t      t_batch = 0;
+    size_t      i = 0;
+    size_t      j = 0;
+
+    assert(cphmap_map != NULL);
+    assert(cpv_keys != NULL);
+    assert(pit_result != NULL);
+
+    for (i = 0; i < t_count; i += t_batch) {
+        t_batch = t_count - i < _HASH_MAP_FIND_BATCH_COUNT ? t_count - i : _HASH_MAP_FIND_BATCH_COUNT;
+
+        /* the keys are made on the stack, so that the lookup does not modify map */
+        for (j = 0; j < t_batch; ++j) {
+            if (_GET_HASH_MAP_FIRST_TYPE_STYLE(cphmap_map) == _TYPE_C_BUILTIN &&
+                _GET_HASH_MAP_FIRST_TYPE_ID(cphmap_map) != _TYPE_ID_C_STRING) {
+                cpv_key = (const _byte_t*)cpv_keys + (i + j) * _GET_HASH_MAP_FIRST_TYPE_SIZE(cphmap_map);
+            } else {
+                cpv_key = *((void**)cpv_keys + i + j);
+            }
+            assert(cpv_key != NULL);
+            _pair_key_init_ptr(&at_key[j], &cphmap_map->_pair_temp, cpv_key);
+            acpv_key[j] = &at_key[j]._pair_key;
+        }
+
+#ifdef CSTL_HASH_FLAT_TABLE
+        _flat_hashtable_find_batch(&cphmap_map->_t_hashtable, acpv_key, t_batch, pit_result + i);
+#else
+        _hashtable_find_batch(&cphmap_map->_t_hashtable, acpv_key, t_batch, pit_result + i);
+#endif
+        for (j = 0; j < t_batch; ++j) {
+            _pair_key_destroy(&at_key[j]);
+            _ITERATOR_CONTAINER(pit_result[i + j]) = (hash_map_t*)cphmap_map;
+            _HASH_MAP_ITERATOR_CONTAINER_TYPE(pit_result[i + j]) = _HASH_MAP_CONTAINER;
+            _HASH_MAP_ITERATOR_ITERATOR_TYPE(pit_result[i + j]) = _BIDIRECTIONAL_ITERATOR;
+        }
+    }
+}
+
+/**
+ * Erase the elements whose key is pointed by pointer.
+ */
+size_t hash_map_erase_ptr(hash_map_t* phmap_map, const void* cpv_key)
+{
+    assert(phmap_map != NULL);
+    assert(cpv_key != NULL);
+
+    _type_get_ptr_value(&phmap_map->_pair_temp._t_typeinfofirst, cpv_key, phmap_map->_pair_temp._pv_first);
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_erase(&phmap_map->_t_hashtable, &phmap_map->_pair_temp);
+#else
+    return _hashtable_erase(&phmap_map->_t_hashtable, &phmap_map->_pair_temp);
+#endif
+}
+
+/**
+ * Access an element by the key that is pointed by pointer.
+ */
+void* hash_map_at_ptr(hash_map_t* phmap_map, const void* cpv_key)
+{
+    hash_map_iterator_t it_iter;
+
+    assert(phmap_map != NULL);
+    assert(cpv_key != NULL);
+
+    _type_get_ptr_value(&phmap_map->_pair_temp._t_typeinfofirst, cpv_key, phmap_map->_pair_temp._pv_first);
+#ifdef CSTL_HASH_FLAT_TABLE
+    it_iter = _flat_hashtable_insert_unique(&phmap_map->_t_hashtable, &phmap_map->_pair_temp);
+#else
+    it_iter = _hashtable_insert_unique(&phmap_map->_t_hashtable, &phmap_map->_pair_temp);
+#endif
+    _ITERATOR_CONTAINER(it_iter) = phmap_map;
+    _HASH_MAP_ITERATOR_CONTAINER_TYPE(it_iter) = _HASH_MAP_CONTAINER;
+    _HASH_MAP_ITERATOR_ITERATOR_TYPE(it_iter) = _BIDIRECTIONAL_ITERATOR;
+
+    if (iterator_equal(it_iter, hash_map_end(phmap_map))) {
+        it_iter = hash_map_find_ptr(phmap_map, cpv_key);
+    }
+
+    /* char* */
+    if (_GET_HASH_MAP_SECOND_TYPE_ID(phmap_map) == _TYPE_ID_C_STRING) {
+        return (char*)string_c_str((string_t*)((pair_t*)iterator_get_pointer(it_iter))->_pv_second);
+    } else {
+        return ((pair_t*)iterator_get_pointer(it_iter))->_pv_second;
+    }
 }
 
 /** local function implementation section **/
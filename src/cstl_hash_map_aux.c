@@ -28,6 +28,7 @@
 #include <cstl/cstring.h>
 #include <cstl/chash_map.h>
 
+#include "cstl_hashtable_aux.h"
 #include "cstl_hash_map_aux.h"
 
 /** local constant declaration and local macro section **/
@@ -119,28 +120,15 @@ void _hash_map_value_compare(const void* cpv_first, const void* cpv_second, void
  */
 void _hash_map_default_hash(const void* cpv_input, void* pv_output)
 {
-    pair_t*  ppair_pair = NULL;
-    _byte_t* pby_value = NULL;
-    size_t   t_sum = 0;
-    size_t   i = 0;
-    size_t   t_len = 0;
+    pair_t* ppair_pair = NULL;
 
     assert(cpv_input != NULL);
     assert(pv_output != NULL);
 
+    /* hash the key by the hash function of key type, so the keys of cstl builtin types are hashed by contents */
     ppair_pair = (pair_t*)cpv_input;
-    pby_value = (_byte_t*)pair_first(ppair_pair);
-    if (strncmp(ppair_pair->_t_typeinfofirst._pt_type->_s_typename, _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
-        t_len = strlen((char*)pby_value);
-    } else {
-        t_len = ppair_pair->_t_typeinfofirst._pt_type->_t_typesize;
-    }
-
-    for (i = 0; i < t_len; ++i) {
-        t_sum += (size_t)pby_value[i];
-    }
-
-    *(size_t*)pv_output = t_sum;
+    assert(_pair_is_inited(ppair_pair));
+    *(size_t*)pv_output = _type_hash_value(&ppair_pair->_t_typeinfofirst, ppair_pair->_pv_first);
 }
 
 /** local function implementation section **/
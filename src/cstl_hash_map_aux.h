@@ -34,6 +34,7 @@ extern "C" {
 #define _GET_HASH_MAP_FIRST_TYPE_SIZE(phmap_map)              ((phmap_map)->_pair_temp._t_typeinfofirst._pt_type->_t_typesize)
 #define _GET_HASH_MAP_FIRST_TYPE_NAME(phmap_map)              ((phmap_map)->_pair_temp._t_typeinfofirst._s_typename)
 #define _GET_HASH_MAP_FIRST_TYPE_BASENAME(phmap_map)          ((phmap_map)->_pair_temp._t_typeinfofirst._pt_type->_s_typename)
+#define _GET_HASH_MAP_FIRST_TYPE_ID(phmap_map)                ((phmap_map)->_pair_temp._t_typeinfofirst._pt_type->_t_typeid)
 #define _GET_HASH_MAP_FIRST_TYPE_INIT_FUNCTION(phmap_map)     ((phmap_map)->_pair_temp._t_typeinfofirst._pt_type->_t_typeinit)
 #define _GET_HASH_MAP_FIRST_TYPE_COPY_FUNCTION(phmap_map)     ((phmap_map)->_pair_temp._t_typeinfofirst._pt_type->_t_typecopy)
 #define _GET_HASH_MAP_FIRST_TYPE_LESS_FUNCTION(phmap_map)     ((phmap_map)->_pair_temp._t_typeinfofirst._pt_type->_t_typeless)
@@ -43,6 +44,7 @@ extern "C" {
 #define _GET_HASH_MAP_SECOND_TYPE_SIZE(phmap_map)             ((phmap_map)->_pair_temp._t_typeinfosecond._pt_type->_t_typesize)
 #define _GET_HASH_MAP_SECOND_TYPE_NAME(phmap_map)             ((phmap_map)->_pair_temp._t_typeinfosecond._s_typename)
 #define _GET_HASH_MAP_SECOND_TYPE_BASENAME(phmap_map)         ((phmap_map)->_pair_temp._t_typeinfosecond._pt_type->_s_typename)
+#define _GET_HASH_MAP_SECOND_TYPE_ID(phmap_map)               ((phmap_map)->_pair_temp._t_typeinfosecond._pt_type->_t_typeid)
 #define _GET_HASH_MAP_SECOND_TYPE_INIT_FUNCTION(phmap_map)    ((phmap_map)->_pair_temp._t_typeinfosecond._pt_type->_t_typeinit)
 #define _GET_HASH_MAP_SECOND_TYPE_COPY_FUNCTION(phmap_map)    ((phmap_map)->_pair_temp._t_typeinfosecond._pt_type->_t_typecopy)
 #define _GET_HASH_MAP_SECOND_TYPE_LESS_FUNCTION(phmap_map)    ((phmap_map)->_pair_temp._t_typeinfosecond._pt_type->_t_typeless)
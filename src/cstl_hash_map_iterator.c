@@ -46,7 +46,11 @@
  */
 hash_map_iterator_t create_hash_map_iterator(void)
 {
+#ifdef CSTL_HASH_FLAT_TABLE
+    hash_map_iterator_t it_iter = _create_flat_hashtable_iterator();
+#else
     hash_map_iterator_t it_iter = _create_hashtable_iterator();
+#endif
 
     _HASH_MAP_ITERATOR_CONTAINER_TYPE(it_iter) = _HASH_MAP_CONTAINER;
     _HASH_MAP_ITERATOR_ITERATOR_TYPE(it_iter) = _BIDIRECTIONAL_ITERATOR;
@@ -63,7 +67,11 @@ void _hash_map_iterator_get_value(hash_map_iterator_t it_iter, void* pv_value)
     assert(_HASH_MAP_ITERATOR_CONTAINER_TYPE(it_iter) == _HASH_MAP_CONTAINER);
     assert(_HASH_MAP_ITERATOR_ITERATOR_TYPE(it_iter) == _BIDIRECTIONAL_ITERATOR);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_iterator_get_value(it_iter, pv_value);
+#else
     _hashtable_iterator_get_value(it_iter, pv_value);
+#endif
 }
 
 /**
@@ -74,7 +82,11 @@ const void* _hash_map_iterator_get_pointer(hash_map_iterator_t it_iter)
     assert(_HASH_MAP_ITERATOR_CONTAINER_TYPE(it_iter) == _HASH_MAP_CONTAINER);
     assert(_HASH_MAP_ITERATOR_ITERATOR_TYPE(it_iter) == _BIDIRECTIONAL_ITERATOR);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_iterator_get_pointer(it_iter);
+#else
     return _hashtable_iterator_get_pointer(it_iter);
+#endif
 }
 
 /**
@@ -85,7 +97,11 @@ const void* _hash_map_iterator_get_pointer_ignore_cstr(hash_map_iterator_t it_it
     assert(_HASH_MAP_ITERATOR_CONTAINER_TYPE(it_iter) == _HASH_MAP_CONTAINER);
     assert(_HASH_MAP_ITERATOR_ITERATOR_TYPE(it_iter) == _BIDIRECTIONAL_ITERATOR);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_iterator_get_pointer_ignore_cstr(it_iter);
+#else
     return _hashtable_iterator_get_pointer_ignore_cstr(it_iter);
+#endif
 }
 
 /**
@@ -96,7 +112,11 @@ hash_map_iterator_t _hash_map_iterator_prev(hash_map_iterator_t it_iter)
     assert(_HASH_MAP_ITERATOR_CONTAINER_TYPE(it_iter) == _HASH_MAP_CONTAINER);
     assert(_HASH_MAP_ITERATOR_ITERATOR_TYPE(it_iter) == _BIDIRECTIONAL_ITERATOR);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_iterator_prev(it_iter);
+#else
     return _hashtable_iterator_prev(it_iter);
+#endif
 }
 
 /**
@@ -107,7 +127,11 @@ hash_map_iterator_t _hash_map_iterator_next(hash_map_iterator_t it_iter)
     assert(_HASH_MAP_ITERATOR_CONTAINER_TYPE(it_iter) == _HASH_MAP_CONTAINER);
     assert(_HASH_MAP_ITERATOR_ITERATOR_TYPE(it_iter) == _BIDIRECTIONAL_ITERATOR);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_iterator_next(it_iter);
+#else
     return _hashtable_iterator_next(it_iter);
+#endif
 }
 
 /**
@@ -120,7 +144,11 @@ bool_t _hash_map_iterator_equal(hash_map_iterator_t it_first, hash_map_iterator_
     assert(_HASH_MAP_ITERATOR_CONTAINER_TYPE(it_second) == _HASH_MAP_CONTAINER);
     assert(_HASH_MAP_ITERATOR_ITERATOR_TYPE(it_second) == _BIDIRECTIONAL_ITERATOR);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_iterator_equal(it_first, it_second);
+#else
     return _hashtable_iterator_equal(it_first, it_second);
+#endif
 }
 
 /**
@@ -134,7 +162,11 @@ int _hash_map_iterator_distance(hash_map_iterator_t it_first, hash_map_iterator_
     assert(_HASH_MAP_ITERATOR_ITERATOR_TYPE(it_second) == _BIDIRECTIONAL_ITERATOR);
     assert(_HASH_MAP_ITERATOR_CONTAINER(it_first) == _HASH_MAP_ITERATOR_CONTAINER(it_second));
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_iterator_distance(it_first, it_second);
+#else
     return _hashtable_iterator_distance(it_first, it_second);
+#endif
 }
 
 /**
@@ -148,7 +180,11 @@ bool_t _hash_map_iterator_before(hash_map_iterator_t it_first, hash_map_iterator
     assert(_HASH_MAP_ITERATOR_ITERATOR_TYPE(it_second) == _BIDIRECTIONAL_ITERATOR);
     assert(_HASH_MAP_ITERATOR_CONTAINER(it_first) == _HASH_MAP_ITERATOR_CONTAINER(it_second));
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_iterator_before(it_first, it_second);
+#else
     return _hashtable_iterator_before(it_first, it_second);
+#endif
 }
 
 /** local function implementation section **/
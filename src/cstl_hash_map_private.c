@@ -29,6 +29,7 @@
 #include <cstl/chash_map.h>
 
 #include "cstl_hash_map_aux.h"
+#include "cstl_pair_aux.h"
 
 /** local constant declaration and local macro section **/
 
@@ -60,6 +61,25 @@ hash_map_t* _create_hash_map(const char* s_typename)
     return phmap_map;
 }
 
+/**
+ * Create hash_map container that uses user defined allocator.
+ */
+hash_map_t* _create_hash_map_with_allocator(const allocator_t* cpt_allocator, const char* s_typename)
+{
+    hash_map_t* phmap_map = NULL;
+
+    assert(cpt_allocator != NULL);
+
+    if ((phmap_map = _create_hash_map(s_typename)) != NULL) {
+        _alloc_set_allocator(&phmap_map->_t_hashtable._t_allocator, cpt_allocator);
+#ifndef CSTL_HASH_FLAT_TABLE
+        _alloc_set_allocator(&phmap_map->_t_hashtable._vec_bucket._t_allocator, cpt_allocator);
+#endif
+    }
+
+    return phmap_map;
+}
+
 /**
  * Create hash_map container auxiliary function.
  */
@@ -83,7 +103,11 @@ bool_t _create_hash_map_auxiliary(hash_map_t* phmap_map, const char* s_typename)
     phmap_map->_bfun_keycompare = NULL;
     phmap_map->_bfun_valuecompare = NULL;
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _create_flat_hashtable_auxiliary(&phmap_map->_t_hashtable, s_typenameex);
+#else
     return _create_hashtable_auxiliary(&phmap_map->_t_hashtable, s_typenameex);
+#endif
 }
 
 /**
@@ -94,7 +118,11 @@ void _hash_map_destroy_auxiliary(hash_map_t* phmap_map)
     assert(phmap_map != NULL);
 
     _pair_destroy_auxiliary(&phmap_map->_pair_temp);
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_destroy_auxiliary(&phmap_map->_t_hashtable);
+#else
     _hashtable_destroy_auxiliary(&phmap_map->_t_hashtable);
+#endif
 
     phmap_map->_bfun_keycompare = NULL;
     phmap_map->_bfun_valuecompare = NULL;
@@ -121,12 +149,18 @@ hash_map_iterator_t _hash_map_find(const hash_map_t* cphmap_map, ...)
 hash_map_iterator_t _hash_map_find_varg(const hash_map_t* cphmap_map, va_list val_elemlist)
 {
     hash_map_iterator_t it_iter;
+    _pairkey_t t_key;
 
     assert(cphmap_map != NULL);
 
-    _type_get_varg_value(&((hash_map_t*)cphmap_map)->_pair_temp._t_typeinfofirst, val_elemlist, cphmap_map->_pair_temp._pv_first);
-
-    it_iter = _hashtable_find(&cphmap_map->_t_hashtable, &cphmap_map->_pair_temp);
+    /* the key is made on the stack, so that the lookup does not modify map */
+    _pair_key_init_varg(&t_key, &cphmap_map->_pair_temp, val_elemlist);
+#ifdef CSTL_HASH_FLAT_TABLE
+    it_iter = _flat_hashtable_find(&cphmap_map->_t_hashtable, &t_key._pair_key);
+#else
+    it_iter = _hashtable_find(&cphmap_map->_t_hashtable, &t_key._pair_key);
+#endif
+    _pair_key_destroy(&t_key);
 
     _ITERATOR_CONTAINER(it_iter) = (hash_map_t*)cphmap_map;
     _HASH_MAP_ITERATOR_CONTAINER_TYPE(it_iter) = _HASH_MAP_CONTAINER;
@@ -155,11 +189,21 @@ size_t _hash_map_count(const hash_map_t* cphmap_map, ...)
  */
 size_t _hash_map_count_varg(const hash_map_t* cphmap_map, va_list val_elemlist)
 {
+    size_t     t_count = 0;
+    _pairkey_t t_key;
+
     assert(cphmap_map != NULL);
 
-    _type_get_varg_value(&((hash_map_t*)cphmap_map)->_pair_temp._t_typeinfofirst, val_elemlist, cphmap_map->_pair_temp._pv_first);
+    /* the key is made on the stack, so that the lookup does not modify map */
+    _pair_key_init_varg(&t_key, &cphmap_map->_pair_temp, val_elemlist);
+#ifdef CSTL_HASH_FLAT_TABLE
+    t_count = _flat_hashtable_count(&cphmap_map->_t_hashtable, &t_key._pair_key);
+#else
+    t_count = _hashtable_count(&cphmap_map->_t_hashtable, &t_key._pair_key);
+#endif
+    _pair_key_destroy(&t_key);
 
-    return _hashtable_count(&cphmap_map->_t_hashtable, &cphmap_map->_pair_temp);
+    return t_count;
 }
 
 /**
@@ -183,12 +227,18 @@ range_t _hash_map_equal_range(const hash_map_t* cphmap_map, ...)
 range_t _hash_map_equal_range_varg(const hash_map_t* cphmap_map, va_list val_elemlist)
 {
     range_t r_range;
+    _pairkey_t t_key;
 
     assert(cphmap_map != NULL);
 
-    _type_get_varg_value(&((hash_map_t*)cphmap_map)->_pair_temp._t_typeinfofirst, val_elemlist, cphmap_map->_pair_temp._pv_first);
-
-    r_range = _hashtable_equal_range(&cphmap_map->_t_hashtable, &cphmap_map->_pair_temp);
+    /* the key is made on the stack, so that the lookup does not modify map */
+    _pair_key_init_varg(&t_key, &cphmap_map->_pair_temp, val_elemlist);
+#ifdef CSTL_HASH_FLAT_TABLE
+    r_range = _flat_hashtable_equal_range(&cphmap_map->_t_hashtable, &t_key._pair_key);
+#else
+    r_range = _hashtable_equal_range(&cphmap_map->_t_hashtable, &t_key._pair_key);
+#endif
+    _pair_key_destroy(&t_key);
 
     _ITERATOR_CONTAINER(r_range.it_begin) = (hash_map_t*)cphmap_map;
     _HASH_MAP_ITERATOR_CONTAINER_TYPE(r_range.it_begin) = _HASH_MAP_CONTAINER;
@@ -225,7 +275,11 @@ size_t _hash_map_erase_varg(hash_map_t* phmap_map, va_list val_elemlist)
 
     _type_get_varg_value(&phmap_map->_pair_temp._t_typeinfofirst, val_elemlist, phmap_map->_pair_temp._pv_first);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_erase(&phmap_map->_t_hashtable, &phmap_map->_pair_temp);
+#else
     return _hashtable_erase(&phmap_map->_t_hashtable, &phmap_map->_pair_temp);
+#endif
 }
 
 /**
@@ -256,7 +310,11 @@ void* _hash_map_at_varg(hash_map_t* phmap_map, va_list val_elemlist)
     va_copy(val_elemlist_copy, val_elemlist);
     _type_get_varg_value(&phmap_map->_pair_temp._t_typeinfofirst, val_elemlist, phmap_map->_pair_temp._pv_first);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    it_iter = _flat_hashtable_insert_unique(&phmap_map->_t_hashtable, &phmap_map->_pair_temp);
+#else
     it_iter = _hashtable_insert_unique(&phmap_map->_t_hashtable, &phmap_map->_pair_temp);
+#endif
     _ITERATOR_CONTAINER(it_iter) = phmap_map;
     _HASH_MAP_ITERATOR_CONTAINER_TYPE(it_iter) = _HASH_MAP_CONTAINER;
     _HASH_MAP_ITERATOR_ITERATOR_TYPE(it_iter) = _BIDIRECTIONAL_ITERATOR;
@@ -268,7 +326,7 @@ void* _hash_map_at_varg(hash_map_t* phmap_map, va_list val_elemlist)
     va_end(val_elemlist_copy);
 
     /* char* */
-    if (strncmp(_GET_HASH_MAP_SECOND_TYPE_BASENAME(phmap_map), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_HASH_MAP_SECOND_TYPE_ID(phmap_map) == _TYPE_ID_C_STRING) {
         return (char*)string_c_str((string_t*)((pair_t*)iterator_get_pointer(it_iter))->_pv_second);
     } else {
         return ((pair_t*)iterator_get_pointer(it_iter))->_pv_second;
@@ -29,6 +29,7 @@
 #include <cstl/chash_map.h>
 
 #include "cstl_hash_multimap_aux.h"
+#include "cstl_pair_aux.h"
 
 /** local constant declaration and local macro section **/
 
@@ -89,6 +90,7 @@ void hash_multimap_init_copy(hash_multimap_t* phmmap_dest, const hash_multimap_t
     assert(_pair_is_inited(&cphmmap_src->_pair_temp));
 
     hash_multimap_init_ex(phmmap_dest, hash_multimap_bucket_count(cphmmap_src), hash_multimap_hash(cphmmap_src), hash_multimap_key_comp(cphmmap_src));
+    hash_multimap_set_max_load_factor(phmmap_dest, hash_multimap_max_load_factor(cphmmap_src));
     phmmap_dest->_bfun_keycompare = cphmmap_src->_bfun_keycompare;
     phmmap_dest->_bfun_valuecompare = cphmmap_src->_bfun_valuecompare;
     phmmap_dest->_pair_temp._bfun_mapkeycompare = cphmmap_src->_pair_temp._bfun_mapkeycompare;
@@ -214,6 +216,24 @@ size_t hash_multimap_max_size(const hash_multimap_t* cphmmap_map)
     return _hashtable_max_size(&cphmmap_map->_t_hashtable);
 }
 
+/**
+ * Get the memory that is held by the hash_multimap.
+ */
+size_t hash_multimap_memory_usage(const hash_multimap_t* cphmmap_map)
+{
+    size_t t_usage = 0;
+
+    assert(cphmmap_map != NULL);
+    assert(_pair_is_inited(&cphmmap_map->_pair_temp));
+
+    t_usage = _hashtable_memory_usage(&cphmmap_map->_t_hashtable);
+    /* the key and value of pair elements are stored inline in the nodes, only the temporary pair has a separate block */
+    t_usage += _PAIR_STORAGE_SIZE(
+        _GET_HASH_MULTIMAP_FIRST_TYPE_SIZE(cphmmap_map), _GET_HASH_MULTIMAP_SECOND_TYPE_SIZE(cphmmap_map));
+
+    return sizeof(hash_multimap_t) + t_usage;
+}
+
 /**
  * Get the bucket count of elements int the hash_multimap.
  */
@@ -277,6 +297,61 @@ void hash_multimap_resize(hash_multimap_t* phmmap_map, size_t t_resize)
     _hashtable_resize(&phmmap_map->_t_hashtable, t_resize);
 }
 
+/**
+ * Get the average number of elements per bucket.
+ */
+float hash_multimap_load_factor(const hash_multimap_t* cphmmap_map)
+{
+    assert(cphmmap_map != NULL);
+    assert(_pair_is_inited(&cphmmap_map->_pair_temp));
+
+    return _hashtable_load_factor(&cphmmap_map->_t_hashtable);
+}
+
+/**
+ * Get the max load factor of hash_multimap.
+ */
+float hash_multimap_max_load_factor(const hash_multimap_t* cphmmap_map)
+{
+    assert(cphmmap_map != NULL);
+    assert(_pair_is_inited(&cphmmap_map->_pair_temp));
+
+    return _hashtable_max_load_factor(&cphmmap_map->_t_hashtable);
+}
+
+/**
+ * Set the max load factor of hash_multimap.
+ */
+void hash_multimap_set_max_load_factor(hash_multimap_t* phmmap_map, float f_maxloadfactor)
+{
+    assert(phmmap_map != NULL);
+    assert(_pair_is_inited(&phmmap_map->_pair_temp));
+
+    _hashtable_set_max_load_factor(&phmmap_map->_t_hashtable, f_maxloadfactor);
+}
+
+/**
+ * Reserve buckets for specific number of elements.
+ */
+void hash_multimap_reserve(hash_multimap_t* phmmap_map, size_t t_count)
+{
+    assert(phmmap_map != NULL);
+    assert(_pair_is_inited(&phmmap_map->_pair_temp));
+
+    _hashtable_reserve(&phmmap_map->_t_hashtable, t_count);
+}
+
+/**
+ * Shrink the buckets to fit the elements.
+ */
+void hash_multimap_shrink_to_fit(hash_multimap_t* phmmap_map)
+{
+    assert(phmmap_map != NULL);
+    assert(_pair_is_inited(&phmmap_map->_pair_temp));
+
+    _hashtable_shrink_to_fit(&phmmap_map->_t_hashtable);
+}
+
 /**
  * Return an iterator that addresses the first element in the hash_multimap.
  */
@@ -508,6 +583,60 @@ void hash_multimap_clear(hash_multimap_t* phmmap_map)
     _hashtable_clear(&phmmap_map->_t_hashtable);
 }
 
+/**
+ * Find specific element by the key that is pointed by pointer.
+ */
+hash_multimap_iterator_t hash_multimap_find_ptr(const hash_multimap_t* cphmmap_map, const void* cpv_key)
+{
+    hash_multimap_iterator_t it_iter;
+    _pairkey_t t_key;
+
+    assert(cphmmap_map != NULL);
+    assert(cpv_key != NULL);
+
+    /* the key is made on the stack, so that the lookup does not modify map */
+    _pair_key_init_ptr(&t_key, &cphmmap_map->_pair_temp, cpv_key);
+    it_iter = _hashtable_find(&cphmmap_map->_t_hashtable, &t_key._pair_key);
+    _pair_key_destroy(&t_key);
+
+    _ITERATOR_CONTAINER(it_iter) = (hash_multimap_t*)cphmmap_map;
+    _HASH_MULTIMAP_ITERATOR_CONTAINER_TYPE(it_iter) = _HASH_MULTIMAP_CONTAINER;
+    _HASH_MULTIMAP_ITERATOR_ITERATOR_TYPE(it_iter) = _BIDIRECTIONAL_ITERATOR;
+
+    return it_iter;
+}
+
+/**
+ * Return the number of elements whose key is pointed by pointer.
+ */
+size_t hash_multimap_count_ptr(const hash_multimap_t* cphmmap_map, const void* cpv_key)
+{
+    size_t     t_count = 0;
+    _pairkey_t t_key;
+
+    assert(cphmmap_map != NULL);
+    assert(cpv_key != NULL);
+
+    /* the key is made on the stack, so that the lookup does not modify map */
+    _pair_key_init_ptr(&t_key, &cphmmap_map->_pair_temp, cpv_key);
+    t_count = _hashtable_count(&cphmmap_map->_t_hashtable, &t_key._pair_key);
+    _pair_key_destroy(&t_key);
+
+    return t_count;
+}
+
+/**
+ * Erase the elements whose key is pointed by pointer.
+ */
+size_t hash_multimap_erase_ptr(hash_multimap_t* phmmap_map, const void* cpv_key)
+{
+    assert(phmmap_map != NULL);
+    assert(cpv_key != NULL);
+
+    _type_get_ptr_value(&phmmap_map->_pair_temp._t_typeinfofirst, cpv_key, phmmap_map->_pair_temp._pv_first);
+    return _hashtable_erase(&phmmap_map->_t_hashtable, &phmmap_map->_pair_temp);
+}
+
 /** local function implementation section **/
 
 /** eof **/
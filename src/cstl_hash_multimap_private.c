@@ -29,6 +29,7 @@
 #include <cstl/chash_map.h>
 
 #include "cstl_hash_multimap_aux.h"
+#include "cstl_pair_aux.h"
 
 /** local constant declaration and local macro section **/
 
@@ -60,6 +61,23 @@ hash_multimap_t* _create_hash_multimap(const char* s_typename)
     return phmmap_map;
 }
 
+/**
+ * Create hash_multimap container that uses user defined allocator.
+ */
+hash_multimap_t* _create_hash_multimap_with_allocator(const allocator_t* cpt_allocator, const char* s_typename)
+{
+    hash_multimap_t* phmmap_map = NULL;
+
+    assert(cpt_allocator != NULL);
+
+    if ((phmmap_map = _create_hash_multimap(s_typename)) != NULL) {
+        _alloc_set_allocator(&phmmap_map->_t_hashtable._t_allocator, cpt_allocator);
+        _alloc_set_allocator(&phmmap_map->_t_hashtable._vec_bucket._t_allocator, cpt_allocator);
+    }
+
+    return phmmap_map;
+}
+
 /**
  * Create hash_multimap container auxiliary function.
  */
@@ -121,12 +139,14 @@ hash_multimap_iterator_t _hash_multimap_find(const hash_multimap_t* cphmmap_map,
 hash_multimap_iterator_t _hash_multimap_find_varg(const hash_multimap_t* cphmmap_map, va_list val_elemlist)
 {
     hash_multimap_iterator_t it_iter;
+    _pairkey_t t_key;
 
     assert(cphmmap_map != NULL);
 
-    _type_get_varg_value(&((hash_multimap_t*)cphmmap_map)->_pair_temp._t_typeinfofirst, val_elemlist, cphmmap_map->_pair_temp._pv_first);
-
-    it_iter = _hashtable_find(&cphmmap_map->_t_hashtable, &cphmmap_map->_pair_temp);
+    /* the key is made on the stack, so that the lookup does not modify map */
+    _pair_key_init_varg(&t_key, &cphmmap_map->_pair_temp, val_elemlist);
+    it_iter = _hashtable_find(&cphmmap_map->_t_hashtable, &t_key._pair_key);
+    _pair_key_destroy(&t_key);
 
     _ITERATOR_CONTAINER(it_iter) = (hash_multimap_t*)cphmmap_map;
     _HASH_MULTIMAP_ITERATOR_CONTAINER_TYPE(it_iter) = _HASH_MULTIMAP_CONTAINER;
@@ -155,11 +175,17 @@ size_t _hash_multimap_count(const hash_multimap_t* cphmmap_map, ...)
  */
 size_t _hash_multimap_count_varg(const hash_multimap_t* cphmmap_map, va_list val_elemlist)
 {
+    size_t     t_count = 0;
+    _pairkey_t t_key;
+
     assert(cphmmap_map != NULL);
 
-    _type_get_varg_value(&((hash_multimap_t*)cphmmap_map)->_pair_temp._t_typeinfofirst, val_elemlist, cphmmap_map->_pair_temp._pv_first);
+    /* the key is made on the stack, so that the lookup does not modify map */
+    _pair_key_init_varg(&t_key, &cphmmap_map->_pair_temp, val_elemlist);
+    t_count = _hashtable_count(&cphmmap_map->_t_hashtable, &t_key._pair_key);
+    _pair_key_destroy(&t_key);
 
-    return _hashtable_count(&cphmmap_map->_t_hashtable, &cphmmap_map->_pair_temp);
+    return t_count;
 }
 
 /**
@@ -182,13 +208,15 @@ range_t _hash_multimap_equal_range(const hash_multimap_t* cphmmap_map, ...)
  */
 range_t _hash_multimap_equal_range_varg(const hash_multimap_t* cphmmap_map, va_list val_elemlist)
 {
+    _pairkey_t t_key;
     range_t  r_range;
 
     assert(cphmmap_map != NULL);
 
-    _type_get_varg_value(&((hash_multimap_t*)cphmmap_map)->_pair_temp._t_typeinfofirst, val_elemlist, cphmmap_map->_pair_temp._pv_first);
-
-    r_range = _hashtable_equal_range(&cphmmap_map->_t_hashtable, &cphmmap_map->_pair_temp);
+    /* the key is made on the stack, so that the lookup does not modify map */
+    _pair_key_init_varg(&t_key, &cphmmap_map->_pair_temp, val_elemlist);
+    r_range = _hashtable_equal_range(&cphmmap_map->_t_hashtable, &t_key._pair_key);
+    _pair_key_destroy(&t_key);
 
     _ITERATOR_CONTAINER(r_range.it_begin) = (hash_multimap_t*)cphmmap_map;
     _HASH_MULTIMAP_ITERATOR_CONTAINER_TYPE(r_range.it_begin) = _HASH_MULTIMAP_CONTAINER;
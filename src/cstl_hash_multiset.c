@@ -163,6 +163,16 @@ size_t hash_multiset_max_size(const hash_multiset_t* cphmset_set)
     return _hashtable_max_size(&cphmset_set->_t_hashtable);
 }
 
+/**
+ * Get the memory that is held by the hash_multiset.
+ */
+size_t hash_multiset_memory_usage(const hash_multiset_t* cphmset_set)
+{
+    assert(cphmset_set != NULL);
+
+    return sizeof(hash_multiset_t) + _hashtable_memory_usage(&cphmset_set->_t_hashtable);
+}
+
 /**
  * Test if an hash_multiset is empty.
  */
@@ -223,6 +233,56 @@ void hash_multiset_resize(hash_multiset_t* phmset_set, size_t t_resize)
     _hashtable_resize(&phmset_set->_t_hashtable, t_resize);
 }
 
+/**
+ * Get the average number of elements per bucket.
+ */
+float hash_multiset_load_factor(const hash_multiset_t* cphmset_set)
+{
+    assert(cphmset_set != NULL);
+
+    return _hashtable_load_factor(&cphmset_set->_t_hashtable);
+}
+
+/**
+ * Get the max load factor of hash_multiset.
+ */
+float hash_multiset_max_load_factor(const hash_multiset_t* cphmset_set)
+{
+    assert(cphmset_set != NULL);
+
+    return _hashtable_max_load_factor(&cphmset_set->_t_hashtable);
+}
+
+/**
+ * Set the max load factor of hash_multiset.
+ */
+void hash_multiset_set_max_load_factor(hash_multiset_t* phmset_set, float f_maxloadfactor)
+{
+    assert(phmset_set != NULL);
+
+    _hashtable_set_max_load_factor(&phmset_set->_t_hashtable, f_maxloadfactor);
+}
+
+/**
+ * Reserve buckets for specific number of elements.
+ */
+void hash_multiset_reserve(hash_multiset_t* phmset_set, size_t t_count)
+{
+    assert(phmset_set != NULL);
+
+    _hashtable_reserve(&phmset_set->_t_hashtable, t_count);
+}
+
+/**
+ * Shrink the buckets to fit the elements.
+ */
+void hash_multiset_shrink_to_fit(hash_multiset_t* phmset_set)
+{
+    assert(phmset_set != NULL);
+
+    _hashtable_shrink_to_fit(&phmset_set->_t_hashtable);
+}
+
 /**
  * Tests if the two hash_multiset are equal.
  */
@@ -386,6 +446,86 @@ void hash_multiset_clear(hash_multiset_t* phmset_set)
     _hashtable_clear(&phmset_set->_t_hashtable);
 }
 
+/**
+ * Find specific element that is pointed by pointer.
+ */
+hash_multiset_iterator_t hash_multiset_find_ptr(const hash_multiset_t* cphmset_set, const void* cpv_value)
+{
+    hash_multiset_iterator_t it_iter;
+
+    assert(cphmset_set != NULL);
+    assert(cpv_value != NULL);
+
+    /* the element of c string is string_t, so it is built from char* like the variable argument */
+    if (_GET_HASH_MULTISET_TYPE_ID(cphmset_set) == _TYPE_ID_C_STRING) {
+        return _hash_multiset_find(cphmset_set, cpv_value);
+    }
+
+    it_iter = _hashtable_find(&cphmset_set->_t_hashtable, cpv_value);
+
+    _ITERATOR_CONTAINER(it_iter) = (hash_multiset_t*)cphmset_set;
+    _HASH_MULTISET_ITERATOR_CONTAINER_TYPE(it_iter) = _HASH_MULTISET_CONTAINER;
+    _HASH_MULTISET_ITERATOR_ITERATOR_TYPE(it_iter) = _BIDIRECTIONAL_ITERATOR;
+
+    return it_iter;
+}
+
+/**
+ * Return the number of specific elements that is pointed by pointer.
+ */
+size_t hash_multiset_count_ptr(const hash_multiset_t* cphmset_set, const void* cpv_value)
+{
+    assert(cphmset_set != NULL);
+    assert(cpv_value != NULL);
+
+    /* the element of c string is string_t, so it is built from char* like the variable argument */
+    if (_GET_HASH_MULTISET_TYPE_ID(cphmset_set) == _TYPE_ID_C_STRING) {
+        return _hash_multiset_count(cphmset_set, cpv_value);
+    }
+
+    return _hashtable_count(&cphmset_set->_t_hashtable, cpv_value);
+}
+
+/**
+ * Inserts an element that is pointed by pointer into a hash_multiset.
+ */
+hash_multiset_iterator_t hash_multiset_insert_ptr(hash_multiset_t* phmset_set, const void* cpv_value)
+{
+    hash_multiset_iterator_t it_iter;
+
+    assert(phmset_set != NULL);
+    assert(cpv_value != NULL);
+
+    /* the element of c string is string_t, so it is built from char* like the variable argument */
+    if (_GET_HASH_MULTISET_TYPE_ID(phmset_set) == _TYPE_ID_C_STRING) {
+        return _hash_multiset_insert(phmset_set, cpv_value);
+    }
+
+    it_iter = _hashtable_insert_equal(&phmset_set->_t_hashtable, cpv_value);
+
+    _ITERATOR_CONTAINER(it_iter) = phmset_set;
+    _HASH_MULTISET_ITERATOR_CONTAINER_TYPE(it_iter) = _HASH_MULTISET_CONTAINER;
+    _HASH_MULTISET_ITERATOR_ITERATOR_TYPE(it_iter) = _BIDIRECTIONAL_ITERATOR;
+
+    return it_iter;
+}
+
+/**
+ * Erase an element from a hash_multiset that match a element that is pointed by pointer.
+ */
+size_t hash_multiset_erase_ptr(hash_multiset_t* phmset_set, const void* cpv_value)
+{
+    assert(phmset_set != NULL);
+    assert(cpv_value != NULL);
+
+    /* the element of c string is string_t, so it is built from char* like the variable argument */
+    if (_GET_HASH_MULTISET_TYPE_ID(phmset_set) == _TYPE_ID_C_STRING) {
+        return _hash_multiset_erase(phmset_set, cpv_value);
+    }
+
+    return _hashtable_erase(&phmset_set->_t_hashtable, cpv_value);
+}
+
 /** local function implementation section **/
 
 /** eof **/
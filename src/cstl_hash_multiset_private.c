@@ -48,6 +48,23 @@ hash_multiset_t* _create_hash_multiset(const char* s_typename)
     return (hash_multiset_t*)_create_hashtable(s_typename);
 }
 
+/**
+ * Create hash_multiset container that uses user defined allocator.
+ */
+hash_multiset_t* _create_hash_multiset_with_allocator(const allocator_t* cpt_allocator, const char* s_typename)
+{
+    hash_multiset_t* phmset_set = NULL;
+
+    assert(cpt_allocator != NULL);
+
+    if ((phmset_set = _create_hash_multiset(s_typename)) != NULL) {
+        _alloc_set_allocator(&phmset_set->_t_hashtable._t_allocator, cpt_allocator);
+        _alloc_set_allocator(&phmset_set->_t_hashtable._vec_bucket._t_allocator, cpt_allocator);
+    }
+
+    return phmset_set;
+}
+
 /**
  * Create hash_multiset container auxiliary function.
  */
@@ -30,6 +30,8 @@
 #include "cstl_hash_set_aux.h"
 
 /** local constant declaration and local macro section **/
+/* the number of elements that are passed to the hashtable together in batch find */
+#define _HASH_SET_FIND_BATCH_COUNT 16
 
 /** local data type declaration and local struct, union, enum section **/
 
@@ -57,7 +59,11 @@ void hash_set_init_ex(hash_set_t* phset_set, size_t t_bucketcount, ufun_t ufun_h
 {
     assert(phset_set != NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_init(&phset_set->_t_hashtable, t_bucketcount, ufun_hash, bfun_compare);
+#else
     _hashtable_init(&phset_set->_t_hashtable, t_bucketcount, ufun_hash, bfun_compare);
+#endif
 }
 
 /**
@@ -77,7 +83,11 @@ void hash_set_init_copy(hash_set_t* phset_dest, const hash_set_t* cphset_src)
     assert(phset_dest != NULL);
     assert(cphset_src != NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_init_copy(&phset_dest->_t_hashtable, &cphset_src->_t_hashtable);
+#else
     _hashtable_init_copy(&phset_dest->_t_hashtable, &cphset_src->_t_hashtable);
+#endif
 }
 
 /**
@@ -105,7 +115,11 @@ void hash_set_init_copy_range_ex(hash_set_t* phset_set, iterator_t it_begin, ite
     assert(phset_set != NULL);
     assert(iterator_equal(it_begin, it_end) || _iterator_before(it_begin, it_end));
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_init_copy_unique_range(&phset_set->_t_hashtable, it_begin, it_end, t_bucketcount, ufun_hash, bfun_compare);
+#else
     _hashtable_init_copy_unique_range(&phset_set->_t_hashtable, it_begin, it_end, t_bucketcount, ufun_hash, bfun_compare);
+#endif
 }
 
 /**
@@ -117,7 +131,11 @@ void hash_set_init_copy_array_ex(hash_set_t* phset_set, const void* cpv_array, s
     assert(phset_set != NULL);
     assert(cpv_array != NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_init_copy_unique_array(&phset_set->_t_hashtable, cpv_array, t_count, t_bucketcount, ufun_hash, bfun_compare);
+#else
     _hashtable_init_copy_unique_array(&phset_set->_t_hashtable, cpv_array, t_count, t_bucketcount, ufun_hash, bfun_compare);
+#endif
 }
 
 /**
@@ -128,7 +146,11 @@ void hash_set_assign(hash_set_t* phset_dest, const hash_set_t* cphset_src)
     assert(phset_dest != NULL);
     assert(cphset_src != NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_assign(&phset_dest->_t_hashtable, &cphset_src->_t_hashtable);
+#else
     _hashtable_assign(&phset_dest->_t_hashtable, &cphset_src->_t_hashtable);
+#endif
 }
 
 /**
@@ -139,7 +161,11 @@ void hash_set_swap(hash_set_t* phset_first, hash_set_t* phset_second)
     assert(phset_first != NULL);
     assert(phset_second != NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_swap(&phset_first->_t_hashtable, &phset_second->_t_hashtable);
+#else
     _hashtable_swap(&phset_first->_t_hashtable, &phset_second->_t_hashtable);
+#endif
 }
 
 /**
@@ -149,7 +175,11 @@ size_t hash_set_size(const hash_set_t* cphset_set)
 {
     assert(cphset_set != NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_size(&cphset_set->_t_hashtable);
+#else
     return _hashtable_size(&cphset_set->_t_hashtable);
+#endif
 }
 
 /**
@@ -159,7 +189,29 @@ size_t hash_set_max_size(const hash_set_t* cphset_set)
 {
     assert(cphset_set != NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_max_size(&cphset_set->_t_hashtable);
+#else
     return _hashtable_max_size(&cphset_set->_t_hashtable);
+#endif
+}
+
+/**
+ * Get the memory that is held by the hash_set.
+ */
+size_t hash_set_memory_usage(const hash_set_t* cphset_set)
+{
+    size_t t_usage = 0;
+
+    assert(cphset_set != NULL);
+
+#ifdef CSTL_HASH_FLAT_TABLE
+    t_usage = _flat_hashtable_memory_usage(&cphset_set->_t_hashtable);
+#else
+    t_usage = _hashtable_memory_usage(&cphset_set->_t_hashtable);
+#endif
+
+    return sizeof(hash_set_t) + t_usage;
 }
 
 /**
@@ -169,7 +221,11 @@ bool_t hash_set_empty(const hash_set_t* cphset_set)
 {
     assert(cphset_set != NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_empty(&cphset_set->_t_hashtable);
+#else
     return _hashtable_empty(&cphset_set->_t_hashtable);
+#endif
 }
 
 /**
@@ -179,7 +235,11 @@ size_t hash_set_bucket_count(const hash_set_t* cphset_set)
 {
     assert(cphset_set != NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_bucket_count(&cphset_set->_t_hashtable);
+#else
     return _hashtable_bucket_count(&cphset_set->_t_hashtable);
+#endif
 }
 
 /**
@@ -189,7 +249,11 @@ ufun_t hash_set_hash(const hash_set_t* cphset_set)
 {
     assert(cphset_set != NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_hash(&cphset_set->_t_hashtable);
+#else
     return _hashtable_hash(&cphset_set->_t_hashtable);
+#endif
 }
 
 /**
@@ -199,7 +263,11 @@ bfun_t hash_set_key_comp(const hash_set_t* cphset_set)
 {
     assert(cphset_set != NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_key_comp(&cphset_set->_t_hashtable);
+#else
     return _hashtable_key_comp(&cphset_set->_t_hashtable);
+#endif
 }
 
 /**
@@ -209,7 +277,11 @@ bfun_t hash_set_value_comp(const hash_set_t* cphset_set)
 {
     assert(cphset_set != NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_key_comp(&cphset_set->_t_hashtable);
+#else
     return _hashtable_key_comp(&cphset_set->_t_hashtable);
+#endif
 }
 
 /**
@@ -219,7 +291,81 @@ void hash_set_resize(hash_set_t* phset_set, size_t t_resize)
 {
     assert(phset_set != NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_resize(&phset_set->_t_hashtable, t_resize);
+#else
     _hashtable_resize(&phset_set->_t_hashtable, t_resize);
+#endif
+}
+
+/**
+ * Get the average number of elements per bucket.
+ */
+float hash_set_load_factor(const hash_set_t* cphset_set)
+{
+    assert(cphset_set != NULL);
+
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_load_factor(&cphset_set->_t_hashtable);
+#else
+    return _hashtable_load_factor(&cphset_set->_t_hashtable);
+#endif
+}
+
+/**
+ * Get the max load factor of hash_set.
+ */
+float hash_set_max_load_factor(const hash_set_t* cphset_set)
+{
+    assert(cphset_set != NULL);
+
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_max_load_factor(&cphset_set->_t_hashtable);
+#else
+    return _hashtable_max_load_factor(&cphset_set->_t_hashtable);
+#endif
+}
+
+/**
+ * Set the max load factor of hash_set.
+ */
+void hash_set_set_max_load_factor(hash_set_t* phset_set, float f_maxloadfactor)
+{
+    assert(phset_set != NULL);
+
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_set_max_load_factor(&phset_set->_t_hashtable, f_maxloadfactor);
+#else
+    _hashtable_set_max_load_factor(&phset_set->_t_hashtable, f_maxloadfactor);
+#endif
+}
+
+/**
+ * Reserve buckets for specific number of elements.
+ */
+void hash_set_reserve(hash_set_t* phset_set, size_t t_count)
+{
+    assert(phset_set != NULL);
+
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_reserve(&phset_set->_t_hashtable, t_count);
+#else
+    _hashtable_reserve(&phset_set->_t_hashtable, t_count);
+#endif
+}
+
+/**
+ * Shrink the buckets to fit the elements.
+ */
+void hash_set_shrink_to_fit(hash_set_t* phset_set)
+{
+    assert(phset_set != NULL);
+
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_shrink_to_fit(&phset_set->_t_hashtable);
+#else
+    _hashtable_shrink_to_fit(&phset_set->_t_hashtable);
+#endif
 }
 
 /**
@@ -230,7 +376,11 @@ bool_t hash_set_equal(const hash_set_t* cphset_first, const hash_set_t* cphset_s
     assert(cphset_first != NULL);
     assert(cphset_second != NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_equal(&cphset_first->_t_hashtable, &cphset_second->_t_hashtable);
+#else
     return _hashtable_equal(&cphset_first->_t_hashtable, &cphset_second->_t_hashtable);
+#endif
 }
 
 /**
@@ -241,7 +391,11 @@ bool_t hash_set_not_equal(const hash_set_t* cphset_first, const hash_set_t* cphs
     assert(cphset_first != NULL);
     assert(cphset_second != NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_not_equal(&cphset_first->_t_hashtable, &cphset_second->_t_hashtable);
+#else
     return _hashtable_not_equal(&cphset_first->_t_hashtable, &cphset_second->_t_hashtable);
+#endif
 }
 
 /**
@@ -252,7 +406,11 @@ bool_t hash_set_less(const hash_set_t* cphset_first, const hash_set_t* cphset_se
     assert(cphset_first != NULL);
     assert(cphset_second != NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_less(&cphset_first->_t_hashtable, &cphset_second->_t_hashtable);
+#else
     return _hashtable_less(&cphset_first->_t_hashtable, &cphset_second->_t_hashtable);
+#endif
 }
 
 /**
@@ -263,7 +421,11 @@ bool_t hash_set_less_equal(const hash_set_t* cphset_first, const hash_set_t* cph
     assert(cphset_first != NULL);
     assert(cphset_second != NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_less_equal(&cphset_first->_t_hashtable, &cphset_second->_t_hashtable);
+#else
     return _hashtable_less_equal(&cphset_first->_t_hashtable, &cphset_second->_t_hashtable);
+#endif
 }
 
 /**
@@ -274,7 +436,11 @@ bool_t hash_set_greater(const hash_set_t* cphset_first, const hash_set_t* cphset
     assert(cphset_first != NULL);
     assert(cphset_second != NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_greater(&cphset_first->_t_hashtable, &cphset_second->_t_hashtable);
+#else
     return _hashtable_greater(&cphset_first->_t_hashtable, &cphset_second->_t_hashtable);
+#endif
 }
 
 /**
@@ -285,7 +451,11 @@ bool_t hash_set_greater_equal(const hash_set_t* cphset_first, const hash_set_t*
     assert(cphset_first != NULL);
     assert(cphset_second != NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_greater_equal(&cphset_first->_t_hashtable, &cphset_second->_t_hashtable);
+#else
     return _hashtable_greater_equal(&cphset_first->_t_hashtable, &cphset_second->_t_hashtable);
+#endif
 }
 
 /**
@@ -297,7 +467,11 @@ hash_set_iterator_t hash_set_begin(const hash_set_t* cphset_set)
 
     assert(cphset_set != NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    it_begin = _flat_hashtable_begin(&cphset_set->_t_hashtable);
+#else
     it_begin = _hashtable_begin(&cphset_set->_t_hashtable);
+#endif
 
     _ITERATOR_CONTAINER(it_begin) = (hash_set_t*)cphset_set;
     _HASH_SET_ITERATOR_CONTAINER_TYPE(it_begin) = _HASH_SET_CONTAINER;
@@ -315,7 +489,11 @@ hash_set_iterator_t hash_set_end(const hash_set_t* cphset_set)
 
     assert(cphset_set != NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    it_end = _flat_hashtable_end(&cphset_set->_t_hashtable);
+#else
     it_end = _hashtable_end(&cphset_set->_t_hashtable);
+#endif
 
     _ITERATOR_CONTAINER(it_end) = (hash_set_t*)cphset_set;
     _HASH_SET_ITERATOR_CONTAINER_TYPE(it_end) = _HASH_SET_CONTAINER;
@@ -332,7 +510,11 @@ void hash_set_insert_range(hash_set_t* phset_set, iterator_t it_begin, iterator_
     assert(phset_set != NULL);
     assert(iterator_equal(it_begin, it_end) || _iterator_before(it_begin, it_end));
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_insert_unique_range(&phset_set->_t_hashtable, it_begin, it_end);
+#else
     _hashtable_insert_unique_range(&phset_set->_t_hashtable, it_begin, it_end);
+#endif
 }
 
 /**
@@ -343,7 +525,11 @@ void hash_set_insert_array(hash_set_t* phset_set, const void* cpv_array, size_t
     assert(phset_set != NULL);
     assert(cpv_array != NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_insert_unique_array(&phset_set->_t_hashtable, cpv_array, t_count);
+#else
     _hashtable_insert_unique_array(&phset_set->_t_hashtable, cpv_array, t_count);
+#endif
 }
 
 /*
@@ -356,7 +542,11 @@ void hash_set_erase_pos(hash_set_t* phset_set, hash_set_iterator_t it_pos)
     assert(_HASH_SET_ITERATOR_ITERATOR_TYPE(it_pos) == _BIDIRECTIONAL_ITERATOR);
     assert(_HASH_SET_ITERATOR_CONTAINER(it_pos) == phset_set);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_erase_pos(&phset_set->_t_hashtable, it_pos);
+#else
     _hashtable_erase_pos(&phset_set->_t_hashtable, it_pos);
+#endif
 }
 
 /*
@@ -372,7 +562,11 @@ void hash_set_erase_range(hash_set_t* phset_set, hash_set_iterator_t it_begin, h
     assert(_HASH_SET_ITERATOR_CONTAINER(it_begin) == phset_set);
     assert(_HASH_SET_ITERATOR_CONTAINER(it_end) == phset_set);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_erase_range(&phset_set->_t_hashtable, it_begin, it_end);
+#else
     _hashtable_erase_range(&phset_set->_t_hashtable, it_begin, it_end);
+#endif
 }
 
 /**
@@ -382,7 +576,154 @@ void hash_set_clear(hash_set_t* phset_set)
 {
     assert(phset_set != NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_clear(&phset_set->_t_hashtable);
+#else
     _hashtable_clear(&phset_set->_t_hashtable);
+#endif
+}
+
+/**
+ * Find specific element that is pointed by pointer.
+ */
+hash_set_iterator_t hash_set_find_ptr(const hash_set_t* cphset_set, const void* cpv_value)
+{
+    hash_set_iterator_t it_iter;
+
+    assert(cphset_set != NULL);
+    assert(cpv_value != NULL);
+
+    /* the element of c string is string_t, so it is built from char* like the variable argument */
+    if (_GET_HASH_SET_TYPE_ID(cphset_set) == _TYPE_ID_C_STRING) {
+        return _hash_set_find(cphset_set, cpv_value);
+    }
+
+#ifdef CSTL_HASH_FLAT_TABLE
+    it_iter = _flat_hashtable_find(&cphset_set->_t_hashtable, cpv_value);
+#else
+    it_iter = _hashtable_find(&cphset_set->_t_hashtable, cpv_value);
+#endif
+
+    _ITERATOR_CONTAINER(it_iter) = (hash_set_t*)cphset_set;
+    _HASH_SET_ITERATOR_CONTAINER_TYPE(it_iter) = _HASH_SET_CONTAINER;
+    _HASH_SET_ITERATOR_ITERATOR_TYPE(it_iter) = _BIDIRECTIONAL_ITERATOR;
+
+    return it_iter;
+}
+
+/**
+ * Return the number of specific elements that is pointed by pointer.
+ */
+size_t hash_set_count_ptr(const hash_set_t* cphset_set, const void* cpv_value)
+{
+    assert(cphset_set != NULL);
+    assert(cpv_value != NULL);
+
+    /* the element of c string is string_t, so it is built from char* like the variable argument */
+    if (_GET_HASH_SET_TYPE_ID(cphset_set) == _TYPE_ID_C_STRING) {
+        return _hash_set_count(cphset_set, cpv_value);
+    }
+
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_count(&cphset_set->_t_hashtable, cpv_value);
+#else
+    return _hashtable_count(&cphset_set->_t_hashtable, cpv_value);
+#endif
+}
+
+/**
+ * Find a batch of elements in array.
+ */
+void hash_set_find_batch(
+    const hash_set_t* cphset_set, const void* cpv_values, size_t t_count, hash_set_iterator_t* pit_result)
+{
+    const void* acpv_value[_HASH_SET_FIND_BATCH_COUNT];
+    size_t      t_batch = 0;
+    size_t      i = 0;
+    size_t      j = 0;
+
+    assert(cphset_set != NULL);
+    assert(cpv_values != NULL);
+    assert(pit_result != NULL);
+
+    /* the element of c string is string_t, so it is built from char* like the variable argument one by one */
+    if (_GET_HASH_SET_TYPE_ID(cphset_set) == _TYPE_ID_C_STRING) {
+        for (i = 0; i < t_count; ++i) {
+            assert(*((char**)cpv_values + i) != NULL);
+            pit_result[i] = _hash_set_find(cphset_set, *((char**)cpv_values + i));
+        }
+        return;
+    }
+
+    for (i = 0; i < t_count; i += t_batch) {
+        t_batch = t_count - i < _HASH_SET_FIND_BATCH_COUNT ? t_count - i : _HASH_SET_FIND_BATCH_COUNT;
+        for (j = 0; j < t_batch; ++j) {
+            if (_GET_HASH_SET_TYPE_STYLE(cphset_set) == _TYPE_C_BUILTIN) {
+                acpv_value[j] = (const _byte_t*)cpv_values + (i + j) * _GET_HASH_SET_TYPE_SIZE(cphset_set);
+            } else {
+                acpv_value[j] = *((void**)cpv_values + i + j);
+            }
+        }
+
+#ifdef CSTL_HASH_FLAT_TABLE
+        _flat_hashtable_find_batch(&cphset_set->_t_hashtable, acpv_value, t_batch, pit_result + i);
+#else
+        _hashtable_find_batch(&cphset_set->_t_hashtable, acpv_value, t_batch, pit_result + i);
+#endif
+        for (j = 0; j < t_batch; ++j) {
+            _ITERATOR_CONTAINER(pit_result[i + j]) = (hash_set_t*)cphset_set;
+            _HASH_SET_ITERATOR_CONTAINER_TYPE(pit_result[i + j]) = _HASH_SET_CONTAINER;
+            _HASH_SET_ITERATOR_ITERATOR_TYPE(pit_result[i + j]) = _BIDIRECTIONAL_ITERATOR;
+        }
+    }
+}
+
+/**
+ * Inserts an element that is pointed by pointer into a hash_set.
+ */
+hash_set_iterator_t hash_set_insert_ptr(hash_set_t* phset_set, const void* cpv_value)
+{
+    hash_set_iterator_t it_iter;
+
+    assert(phset_set != NULL);
+    assert(cpv_value != NULL);
+
+    /* the element of c string is string_t, so it is built from char* like the variable argument */
+    if (_GET_HASH_SET_TYPE_ID(phset_set) == _TYPE_ID_C_STRING) {
+        return _hash_set_insert(phset_set, cpv_value);
+    }
+
+#ifdef CSTL_HASH_FLAT_TABLE
+    it_iter = _flat_hashtable_insert_unique(&phset_set->_t_hashtable, cpv_value);
+#else
+    it_iter = _hashtable_insert_unique(&phset_set->_t_hashtable, cpv_value);
+#endif
+
+    _ITERATOR_CONTAINER(it_iter) = phset_set;
+    _HASH_SET_ITERATOR_CONTAINER_TYPE(it_iter) = _HASH_SET_CONTAINER;
+    _HASH_SET_ITERATOR_ITERATOR_TYPE(it_iter) = _BIDIRECTIONAL_ITERATOR;
+
+    return it_iter;
+}
+
+/**
+ * Erase an element from a hash_set that match a element that is pointed by pointer.
+ */
+size_t hash_set_erase_ptr(hash_set_t* phset_set, const void* cpv_value)
+{
+    assert(phset_set != NULL);
+    assert(cpv_value != NULL);
+
+    /* the element of c string is string_t, so it is built from char* like the variable argument */
+    if (_GET_HASH_SET_TYPE_ID(phset_set) == _TYPE_ID_C_STRING) {
+        return _hash_set_erase(phset_set, cpv_value);
+    }
+
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_erase(&phset_set->_t_hashtable, cpv_value);
+#else
+    return _hashtable_erase(&phset_set->_t_hashtable, cpv_value);
+#endif
 }
 
 /** local function implementation section **/
@@ -34,6 +34,7 @@ extern "C" {
 #define _GET_HASH_SET_TYPE_SIZE(phset_set)             ((phset_set)->_t_hashtable._t_typeinfo._pt_type->_t_typesize)
 #define _GET_HASH_SET_TYPE_NAME(phset_set)             ((phset_set)->_t_hashtable._t_typeinfo._s_typename)
 #define _GET_HASH_SET_TYPE_BASENAME(phset_set)         ((phset_set)->_t_hashtable._t_typeinfo._pt_type->_s_typename)
+#define _GET_HASH_SET_TYPE_ID(phset_set)               ((phset_set)->_t_hashtable._t_typeinfo._pt_type->_t_typeid)
 #define _GET_HASH_SET_TYPE_INIT_FUNCTION(phset_set)    ((phset_set)->_t_hashtable._t_typeinfo._pt_type->_t_typeinit)
 #define _GET_HASH_SET_TYPE_COPY_FUNCTION(phset_set)    ((phset_set)->_t_hashtable._t_typeinfo._pt_type->_t_typecopy)
 #define _GET_HASH_SET_TYPE_LESS_FUNCTION(phset_set)    ((phset_set)->_t_hashtable._t_typeinfo._pt_type->_t_typeless)
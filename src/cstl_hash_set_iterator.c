@@ -45,7 +45,11 @@
  */
 hash_set_iterator_t create_hash_set_iterator(void)
 {
+#ifdef CSTL_HASH_FLAT_TABLE
+    hash_set_iterator_t it_iter = _create_flat_hashtable_iterator();
+#else
     hash_set_iterator_t it_iter = _create_hashtable_iterator();
+#endif
 
     _HASH_SET_ITERATOR_CONTAINER_TYPE(it_iter) = _HASH_SET_CONTAINER;
     _HASH_SET_ITERATOR_ITERATOR_TYPE(it_iter) = _BIDIRECTIONAL_ITERATOR;
@@ -62,7 +66,11 @@ void _hash_set_iterator_get_value(hash_set_iterator_t it_iter, void* pv_value)
     assert(_HASH_SET_ITERATOR_CONTAINER_TYPE(it_iter) == _HASH_SET_CONTAINER);
     assert(_HASH_SET_ITERATOR_ITERATOR_TYPE(it_iter) == _BIDIRECTIONAL_ITERATOR);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_iterator_get_value(it_iter, pv_value);
+#else
     _hashtable_iterator_get_value(it_iter, pv_value);
+#endif
 }
 
 /**
@@ -73,7 +81,11 @@ const void* _hash_set_iterator_get_pointer(hash_set_iterator_t it_iter)
     assert(_HASH_SET_ITERATOR_CONTAINER_TYPE(it_iter) == _HASH_SET_CONTAINER);
     assert(_HASH_SET_ITERATOR_ITERATOR_TYPE(it_iter) == _BIDIRECTIONAL_ITERATOR);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_iterator_get_pointer(it_iter);
+#else
     return _hashtable_iterator_get_pointer(it_iter);
+#endif
 }
 
 /**
@@ -84,7 +96,11 @@ const void* _hash_set_iterator_get_pointer_ignore_cstr(hash_set_iterator_t it_it
     assert(_HASH_SET_ITERATOR_CONTAINER_TYPE(it_iter) == _HASH_SET_CONTAINER);
     assert(_HASH_SET_ITERATOR_ITERATOR_TYPE(it_iter) == _BIDIRECTIONAL_ITERATOR);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_iterator_get_pointer_ignore_cstr(it_iter);
+#else
     return _hashtable_iterator_get_pointer_ignore_cstr(it_iter);
+#endif
 }
 
 /**
@@ -95,7 +111,11 @@ hash_set_iterator_t _hash_set_iterator_prev(hash_set_iterator_t it_iter)
     assert(_HASH_SET_ITERATOR_CONTAINER_TYPE(it_iter) == _HASH_SET_CONTAINER);
     assert(_HASH_SET_ITERATOR_ITERATOR_TYPE(it_iter) == _BIDIRECTIONAL_ITERATOR);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_iterator_prev(it_iter);
+#else
     return _hashtable_iterator_prev(it_iter);
+#endif
 }
 
 /**
@@ -106,7 +126,11 @@ hash_set_iterator_t _hash_set_iterator_next(hash_set_iterator_t it_iter)
     assert(_HASH_SET_ITERATOR_CONTAINER_TYPE(it_iter) == _HASH_SET_CONTAINER);
     assert(_HASH_SET_ITERATOR_ITERATOR_TYPE(it_iter) == _BIDIRECTIONAL_ITERATOR);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_iterator_next(it_iter);
+#else
     return _hashtable_iterator_next(it_iter);
+#endif
 }
 
 /**
@@ -119,7 +143,11 @@ bool_t _hash_set_iterator_equal(hash_set_iterator_t it_first, hash_set_iterator_
     assert(_HASH_SET_ITERATOR_CONTAINER_TYPE(it_second) == _HASH_SET_CONTAINER);
     assert(_HASH_SET_ITERATOR_ITERATOR_TYPE(it_second) == _BIDIRECTIONAL_ITERATOR);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_iterator_equal(it_first, it_second);
+#else
     return _hashtable_iterator_equal(it_first, it_second);
+#endif
 }
 
 /**
@@ -133,7 +161,11 @@ int _hash_set_iterator_distance(hash_set_iterator_t it_first, hash_set_iterator_
     assert(_HASH_SET_ITERATOR_ITERATOR_TYPE(it_second) == _BIDIRECTIONAL_ITERATOR);
     assert(_HASH_SET_ITERATOR_CONTAINER(it_first) == _HASH_SET_ITERATOR_CONTAINER(it_second));
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_iterator_distance(it_first, it_second);
+#else
     return _hashtable_iterator_distance(it_first, it_second);
+#endif
 }
 
 /**
@@ -147,7 +179,11 @@ bool_t _hash_set_iterator_before(hash_set_iterator_t it_first, hash_set_iterator
     assert(_HASH_SET_ITERATOR_ITERATOR_TYPE(it_second) == _BIDIRECTIONAL_ITERATOR);
     assert(_HASH_SET_ITERATOR_CONTAINER(it_first) == _HASH_SET_ITERATOR_CONTAINER(it_second));
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _flat_hashtable_iterator_before(it_first, it_second);
+#else
     return _hashtable_iterator_before(it_first, it_second);
+#endif
 }
 
 /** local function implementation section **/
@@ -45,7 +45,30 @@
  */
 hash_set_t* _create_hash_set(const char* s_typename)
 {
+#ifdef CSTL_HASH_FLAT_TABLE
+    return (hash_set_t*)_create_flat_hashtable(s_typename);
+#else
     return (hash_set_t*)_create_hashtable(s_typename);
+#endif
+}
+
+/**
+ * Create hash_set container that uses user defined allocator.
+ */
+hash_set_t* _create_hash_set_with_allocator(const allocator_t* cpt_allocator, const char* s_typename)
+{
+    hash_set_t* phset_set = NULL;
+
+    assert(cpt_allocator != NULL);
+
+    if ((phset_set = _create_hash_set(s_typename)) != NULL) {
+        _alloc_set_allocator(&phset_set->_t_hashtable._t_allocator, cpt_allocator);
+#ifndef CSTL_HASH_FLAT_TABLE
+        _alloc_set_allocator(&phset_set->_t_hashtable._vec_bucket._t_allocator, cpt_allocator);
+#endif
+    }
+
+    return phset_set;
 }
 
 /**
@@ -56,7 +79,11 @@ bool_t _create_hash_set_auxiliary(hash_set_t* phset_set, const char* s_typename)
     assert(phset_set != NULL);
     assert(s_typename != NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    return _create_flat_hashtable_auxiliary(&phset_set->_t_hashtable, s_typename);
+#else
     return _create_hashtable_auxiliary(&phset_set->_t_hashtable, s_typename);
+#endif
 }
 
 /**
@@ -66,7 +93,11 @@ void _hash_set_destroy_auxiliary(hash_set_t* phset_set)
 {
     assert(phset_set != NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    _flat_hashtable_destroy_auxiliary(&phset_set->_t_hashtable);
+#else
     _hashtable_destroy_auxiliary(&phset_set->_t_hashtable);
+#endif
 }
 
 /**
@@ -100,7 +131,11 @@ hash_set_iterator_t _hash_set_find_varg(const hash_set_t* cphset_set, va_list va
     assert(pv_varg != NULL);
     _hash_set_get_varg_value_auxiliary((hash_set_t*)cphset_set, val_elemlist, pv_varg);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    it_iter = _flat_hashtable_find(&cphset_set->_t_hashtable, pv_varg);
+#else
     it_iter = _hashtable_find(&cphset_set->_t_hashtable, pv_varg);
+#endif
 
     _hash_set_destroy_varg_value_auxiliary((hash_set_t*)cphset_set, pv_varg);
     _alloc_deallocate(&((hash_set_t*)cphset_set)->_t_hashtable._t_allocator, pv_varg, _GET_HASH_SET_TYPE_SIZE(cphset_set), 1);
@@ -143,7 +178,11 @@ size_t _hash_set_count_varg(const hash_set_t* cphset_set, va_list val_elemlist)
     assert(pv_varg != NULL);
     _hash_set_get_varg_value_auxiliary((hash_set_t*)cphset_set, val_elemlist, pv_varg);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    t_count = _flat_hashtable_count(&cphset_set->_t_hashtable, pv_varg);
+#else
     t_count = _hashtable_count(&cphset_set->_t_hashtable, pv_varg);
+#endif
 
     _hash_set_destroy_varg_value_auxiliary((hash_set_t*)cphset_set, pv_varg);
     _alloc_deallocate(&((hash_set_t*)cphset_set)->_t_hashtable._t_allocator, pv_varg, _GET_HASH_SET_TYPE_SIZE(cphset_set), 1);
@@ -182,7 +221,11 @@ range_t _hash_set_equal_range_varg(const hash_set_t* cphset_set, va_list val_ele
     assert(pv_varg != NULL);
     _hash_set_get_varg_value_auxiliary((hash_set_t*)cphset_set, val_elemlist, pv_varg);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    r_range = _flat_hashtable_equal_range(&cphset_set->_t_hashtable, pv_varg);
+#else
     r_range = _hashtable_equal_range(&cphset_set->_t_hashtable, pv_varg);
+#endif
 
     _hash_set_destroy_varg_value_auxiliary((hash_set_t*)cphset_set, pv_varg);
     _alloc_deallocate(&((hash_set_t*)cphset_set)->_t_hashtable._t_allocator, pv_varg, _GET_HASH_SET_TYPE_SIZE(cphset_set), 1);
@@ -229,7 +272,11 @@ hash_set_iterator_t _hash_set_insert_varg(hash_set_t* phset_set, va_list val_ele
     assert(pv_varg != NULL);
     _hash_set_get_varg_value_auxiliary(phset_set, val_elemlist, pv_varg);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    it_iter = _flat_hashtable_insert_unique(&phset_set->_t_hashtable, pv_varg);
+#else
     it_iter = _hashtable_insert_unique(&phset_set->_t_hashtable, pv_varg);
+#endif
 
     _hash_set_destroy_varg_value_auxiliary(phset_set, pv_varg);
     _alloc_deallocate(&phset_set->_t_hashtable._t_allocator, pv_varg, _GET_HASH_SET_TYPE_SIZE(phset_set), 1);
@@ -272,7 +319,11 @@ size_t _hash_set_erase_varg(hash_set_t* phset_set, va_list val_elemlist)
     assert(pv_varg != NULL);
     _hash_set_get_varg_value_auxiliary(phset_set, val_elemlist, pv_varg);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    t_count = _flat_hashtable_erase(&phset_set->_t_hashtable, pv_varg);
+#else
     t_count = _hashtable_erase(&phset_set->_t_hashtable, pv_varg);
+#endif
 
     _hash_set_destroy_varg_value_auxiliary(phset_set, pv_varg);
     _alloc_deallocate(&phset_set->_t_hashtable._t_allocator, pv_varg, _GET_HASH_SET_TYPE_SIZE(phset_set), 1);
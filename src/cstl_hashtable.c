@@ -35,10 +35,17 @@
 #include "cstl_hashtable_aux.h"
 
 /** local constant declaration and local macro section **/
+/* the number of elements that are hashed and prefetched together in batch find */
+#define _HASHTABLE_FIND_BATCH_COUNT 16
 
 /** local data type declaration and local struct, union, enum section **/
 
 /** local function prototype section **/
+/**
+ * Find specific element in the node list of bucket.
+ */
+static _hashtable_iterator_t _hashtable_find_in_bucket(
+    const _hashtable_t* cpt_hashtable, _hashnode_t** ppt_bucket, const void* cpv_value, size_t t_hash);
 
 /** exported global variable definition section **/
 
@@ -75,9 +82,9 @@ void _hashtable_init(_hashtable_t* pt_hashtable, size_t t_bucketcount, ufun_t uf
     /* initialize the bucket vector and node count */
     vector_init(&pt_hashtable->_vec_bucket);
     if (t_bucketcount > 0) {
-        vector_resize(&pt_hashtable->_vec_bucket, _hashtable_get_prime(t_bucketcount));
+        _hashtable_reset_bucket_auxiliary(pt_hashtable, _hashtable_get_prime(t_bucketcount));
     } else {
-        vector_resize(&pt_hashtable->_vec_bucket, _hashtable_get_prime(_HASHTABLE_DEFAULT_BUCKET_COUNT));
+        _hashtable_reset_bucket_auxiliary(pt_hashtable, _hashtable_get_prime(_HASHTABLE_DEFAULT_BUCKET_COUNT));
     }
     pt_hashtable->_t_nodecount = 0;
 
@@ -102,6 +109,7 @@ void _hashtable_init_copy(_hashtable_t* pt_dest, const _hashtable_t* cpt_src)
     assert(_hashtable_same_type(pt_dest, cpt_src));
 
     /* initialize the dest hashtable with src hashtable attribute */
+    pt_dest->_f_maxloadfactor = cpt_src->_f_maxloadfactor;
     _hashtable_init(pt_dest, _hashtable_bucket_count(cpt_src), cpt_src->_ufun_hash, cpt_src->_bfun_compare);
     it_begin = _hashtable_begin(cpt_src);
     it_end = _hashtable_end(cpt_src);
@@ -192,46 +200,51 @@ void _hashtable_destroy(_hashtable_t* pt_hashtable)
  */
 void _hashtable_resize(_hashtable_t* pt_hashtable, size_t t_resize)
 {
-    size_t        t_tmp = 0;
-    size_t        t_pos = 0;
-    size_t        i = 0;
-    size_t        t_bucketcount = 0;
-    _hashnode_t*  pt_node = NULL;
-    _hashnode_t*  pt_nodelist = NULL;
-    _hashnode_t** ppt_bucket = NULL;
-
     assert(pt_hashtable != NULL);
 
+    /* finish the incremental rehash */
+    if (pt_hashtable->_ppt_oldbucket != NULL) {
+        _hashtable_rehash_step_auxiliary(pt_hashtable, (size_t)-1);
+    }
+
     if (t_resize > _hashtable_bucket_count(pt_hashtable)) {
-        /* select all element in hash node list */
-        for (i = 0; i < vector_size(&pt_hashtable->_vec_bucket); ++i) {
-            ppt_bucket = (_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, i);
-            pt_node = *ppt_bucket;
-            while (pt_node != NULL) {
-                *ppt_bucket = pt_node->_pt_next;
-                pt_node->_pt_next = pt_nodelist;
-                pt_nodelist = pt_node;
-                pt_node = *ppt_bucket;
-            }
-        }
+        _hashtable_rebuild_auxiliary(pt_hashtable, _hashtable_get_prime(t_resize));
+    }
+}
 
-        /* resize vector bucket */
-        vector_resize(&pt_hashtable->_vec_bucket, _hashtable_get_prime(t_resize));
-        t_bucketcount = _hashtable_bucket_count(pt_hashtable);
-
-        /* rehash */
-        while (pt_nodelist != NULL) {
-            pt_node = pt_nodelist;
-            pt_nodelist = pt_node->_pt_next;
-
-            t_tmp = _GET_HASHTABLE_TYPE_SIZE(pt_hashtable);
-            _hashtable_hash_auxiliary(pt_hashtable, pt_node->_pby_data, &t_tmp);
-            t_pos = t_tmp % t_bucketcount;
-            ppt_bucket = (_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, t_pos);
-            pt_node->_pt_next = *ppt_bucket;
-            *ppt_bucket = pt_node;
-        }
+/**
+ * Reserve buckets for specific number of elements.
+ */
+void _hashtable_reserve(_hashtable_t* pt_hashtable, size_t t_elemcount)
+{
+    assert(pt_hashtable != NULL);
+    assert(_hashtable_is_inited(pt_hashtable));
+
+    _hashtable_resize(pt_hashtable, _hashtable_get_least_bucket_count_auxiliary(pt_hashtable, t_elemcount));
+}
+
+/**
+ * Shrink the buckets to fit the elements.
+ */
+void _hashtable_shrink_to_fit(_hashtable_t* pt_hashtable)
+{
+    size_t t_bucketcount = 0;
+
+    assert(pt_hashtable != NULL);
+    assert(_hashtable_is_inited(pt_hashtable));
+
+    /* finish the incremental rehash */
+    if (pt_hashtable->_ppt_oldbucket != NULL) {
+        _hashtable_rehash_step_auxiliary(pt_hashtable, (size_t)-1);
+    }
+
+    t_bucketcount = _hashtable_get_prime(
+        _hashtable_get_least_bucket_count_auxiliary(pt_hashtable, _hashtable_size(pt_hashtable)));
+    if (t_bucketcount < _hashtable_bucket_count(pt_hashtable)) {
+        _hashtable_rebuild_auxiliary(pt_hashtable, t_bucketcount);
     }
+    /* the bucket vector keeps the old capacity after rebuilding, release it */
+    vector_shrink_to_fit(&pt_hashtable->_vec_bucket);
 }
 
 /**
@@ -247,21 +260,34 @@ _hashtable_iterator_t _hashtable_insert_equal(_hashtable_t* pt_hashtable, const
     bool_t                b_result = false;
     size_t                t_tmp = 0;
     size_t                t_pos = 0;
-    bool_t                b_less = false;
-    bool_t                b_greater = false;
 
     assert(pt_hashtable != NULL);
     assert(cpv_value != NULL);
     assert(_hashtable_is_inited(pt_hashtable));
 
-    /* resize */
-    _hashtable_resize(pt_hashtable, _hashtable_size(pt_hashtable) + 1);
+    /* move some old buckets into new buckets */
+    if (pt_hashtable->_ppt_oldbucket != NULL) {
+        _hashtable_rehash_step_auxiliary(pt_hashtable, _HASHTABLE_INCREMENTAL_REHASH_STEP);
+    }
+
+    /* resize when the max load factor is exceeded, the large hashtable is rehashed incrementally */
+    t_bucketcount = _hashtable_get_least_bucket_count_auxiliary(pt_hashtable, _hashtable_size(pt_hashtable) + 1);
+    if (t_bucketcount > _hashtable_bucket_count(pt_hashtable)) {
+        t_bucketcount = _hashtable_get_prime(t_bucketcount);
+        if (_hashtable_bucket_count(pt_hashtable) >= _HASHTABLE_INCREMENTAL_REHASH_BUCKET_COUNT) {
+            _hashtable_rehash_step_auxiliary(pt_hashtable, (size_t)-1);
+            if (t_bucketcount > _hashtable_bucket_count(pt_hashtable)) {
+                _hashtable_rehash_start_auxiliary(pt_hashtable, t_bucketcount);
+            }
+        } else {
+            _hashtable_resize(pt_hashtable, t_bucketcount);
+        }
+    }
 
     /* allocate node */
-    pt_node = _alloc_allocate(
-        &pt_hashtable->_t_allocator, _HASHTABLE_NODE_SIZE(_GET_HASHTABLE_TYPE_SIZE(pt_hashtable)), 1);
+    pt_node = _alloc_allocate(&pt_hashtable->_t_allocator, pt_hashtable->_t_nodesize, 1);
     assert(pt_node != NULL);
-    _hashtable_init_elem_auxiliary(pt_hashtable, pt_node);
+    _hashtable_init_node_auxiliary(pt_hashtable, pt_node);
     b_result = _GET_HASHTABLE_TYPE_SIZE(pt_hashtable);
     _GET_HASHTABLE_TYPE_COPY_FUNCTION(pt_hashtable)(pt_node->_pby_data, cpv_value, &b_result);
     assert(b_result);
@@ -271,6 +297,15 @@ _hashtable_iterator_t _hashtable_insert_equal(_hashtable_t* pt_hashtable, const
     t_tmp = _GET_HASHTABLE_TYPE_SIZE(pt_hashtable);
     _hashtable_hash_auxiliary(pt_hashtable, pt_node->_pby_data, &t_tmp);
     t_pos = t_tmp % t_bucketcount;
+#ifdef CSTL_HASHTABLE_HASH_CODE_CACHE
+    pt_node->_t_hashcode = t_tmp;
+#endif
+
+    /* the equal elements in old bucket must be moved together with the new element */
+    if (pt_hashtable->_ppt_oldbucket != NULL &&
+        pt_hashtable->_ppt_oldbucket[t_tmp % pt_hashtable->_t_oldbucketcount] != NULL) {
+        _hashtable_rehash_bucket_auxiliary(pt_hashtable, t_tmp % pt_hashtable->_t_oldbucketcount);
+    }
 
     /* insert node into hashtable, note the node has same value together */
     ppt_nodelist = (_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, t_pos);
@@ -279,22 +314,14 @@ _hashtable_iterator_t _hashtable_insert_equal(_hashtable_t* pt_hashtable, const
     if (pt_cur == NULL) {
         pt_node->_pt_next = pt_cur;
         *ppt_nodelist = pt_node;
+        _hashtable_update_bucket_auxiliary(pt_hashtable, ppt_nodelist);
     } else {
-        b_less = b_greater = _GET_HASHTABLE_TYPE_SIZE(pt_hashtable);
-        _hashtable_elem_compare_auxiliary(pt_hashtable, pt_cur->_pby_data, pt_node->_pby_data, &b_less);
-        _hashtable_elem_compare_auxiliary(pt_hashtable, pt_node->_pby_data, pt_cur->_pby_data, &b_greater);
-        if (!b_less && !b_greater) {
+        if (_hashtable_node_equal_auxiliary(pt_hashtable, pt_cur, pt_node->_pby_data, t_tmp)) {
             pt_node->_pt_next = pt_cur;
             *ppt_nodelist = pt_node;
         } else {
             while (pt_cur->_pt_next != NULL) {
-                b_less = b_greater = _GET_HASHTABLE_TYPE_SIZE(pt_hashtable);
-                _hashtable_elem_compare_auxiliary(
-                    pt_hashtable, pt_cur->_pt_next->_pby_data, pt_node->_pby_data, &b_less);
-                _hashtable_elem_compare_auxiliary(
-                    pt_hashtable, pt_node->_pby_data, pt_cur->_pt_next->_pby_data, &b_greater);
-
-                if (b_less || b_greater) {
+                if (!_hashtable_node_equal_auxiliary(pt_hashtable, pt_cur->_pt_next, pt_node->_pby_data, t_tmp)) {
                     pt_cur = pt_cur->_pt_next;
                 } else {
                     break;
@@ -341,45 +368,57 @@ _hashtable_iterator_t _hashtable_insert_unique(_hashtable_t* pt_hashtable, const
  */
 _hashtable_iterator_t _hashtable_find(const _hashtable_t* cpt_hashtable, const void* cpv_value)
 {
-    _hashtable_iterator_t it_iter = _create_hashtable_iterator();
-    size_t                t_bucketcount = 0;
-    _hashnode_t*          pt_node = NULL;
-    _hashnode_t**         ppt_bucket = NULL;
-    size_t                t_tmp = 0;
-    size_t                t_pos = 0;
-    bool_t                b_less = false;
-    bool_t                b_greater = false;
+    _hashnode_t** ppt_bucket = NULL;
+    size_t        t_tmp = 0;
 
     assert(cpt_hashtable != NULL);
     assert(cpv_value != NULL);
     assert(_hashtable_is_inited(cpt_hashtable));
 
-    t_bucketcount = _hashtable_bucket_count(cpt_hashtable);
     t_tmp = _GET_HASHTABLE_TYPE_SIZE(cpt_hashtable);
     _hashtable_hash_auxiliary(cpt_hashtable, cpv_value, &t_tmp);
-    t_pos = t_tmp % t_bucketcount;
-    ppt_bucket = (_hashnode_t**)vector_at(&cpt_hashtable->_vec_bucket, t_pos);
-    pt_node = *ppt_bucket;
+    ppt_bucket = _hashtable_get_bucket_auxiliary(cpt_hashtable, t_tmp);
 
-    while (pt_node != NULL) {
-        b_less = b_greater = _GET_HASHTABLE_TYPE_SIZE(cpt_hashtable);
-        _hashtable_elem_compare_auxiliary(cpt_hashtable, pt_node->_pby_data, cpv_value, &b_less);
-        _hashtable_elem_compare_auxiliary(cpt_hashtable, cpv_value, pt_node->_pby_data, &b_greater);
-        if (b_less || b_greater) {
-            pt_node = pt_node->_pt_next;
-        } else {
-            break;
-        }
-    }
+    return _hashtable_find_in_bucket(cpt_hashtable, ppt_bucket, cpv_value, t_tmp);
+}
 
-    if (pt_node == NULL) {
-        return _hashtable_end(cpt_hashtable);
-    } else {
-        _HASHTABLE_ITERATOR_BUCKETPOS(it_iter) = (_byte_t*)ppt_bucket;
-        _HASHTABLE_ITERATOR_COREPOS(it_iter) = (_byte_t*)pt_node;
-        _HASHTABLE_ITERATOR_HASHTABLE_POINTER(it_iter) = (_hashtable_t*)cpt_hashtable;
+/**
+ * Find a batch of specific elements.
+ */
+void _hashtable_find_batch(
+    const _hashtable_t* cpt_hashtable, const void* const* cppv_values, size_t t_count, _hashtable_iterator_t* pit_result)
+{
+    size_t        at_hash[_HASHTABLE_FIND_BATCH_COUNT];
+    _hashnode_t** appt_bucket[_HASHTABLE_FIND_BATCH_COUNT];
+    size_t        t_batch = 0;
+    size_t        i = 0;
+    size_t        j = 0;
 
-        return it_iter;
+    assert(cpt_hashtable != NULL);
+    assert(cppv_values != NULL);
+    assert(pit_result != NULL);
+    assert(_hashtable_is_inited(cpt_hashtable));
+
+    for (i = 0; i < t_count; i += t_batch) {
+        t_batch = t_count - i < _HASHTABLE_FIND_BATCH_COUNT ? t_count - i : _HASHTABLE_FIND_BATCH_COUNT;
+
+        /* hash the whole batch first, the loads of buckets are issued together */
+        for (j = 0; j < t_batch; ++j) {
+            assert(cppv_values[i + j] != NULL);
+            at_hash[j] = _GET_HASHTABLE_TYPE_SIZE(cpt_hashtable);
+            _hashtable_hash_auxiliary(cpt_hashtable, cppv_values[i + j], &at_hash[j]);
+            appt_bucket[j] = _hashtable_get_bucket_auxiliary(cpt_hashtable, at_hash[j]);
+            _CSTL_PREFETCH(appt_bucket[j]);
+        }
+        /* then the first nodes of buckets */
+        for (j = 0; j < t_batch; ++j) {
+            if (*appt_bucket[j] != NULL) {
+                _CSTL_PREFETCH(*appt_bucket[j]);
+            }
+        }
+        for (j = 0; j < t_batch; ++j) {
+            pit_result[i + j] = _hashtable_find_in_bucket(cpt_hashtable, appt_bucket[j], cppv_values[i + j], at_hash[j]);
+        }
     }
 }
 
@@ -389,15 +428,10 @@ _hashtable_iterator_t _hashtable_find(const _hashtable_t* cpt_hashtable, const v
 range_t _hashtable_equal_range(const _hashtable_t* cpt_hashtable, const void* cpv_value)
 {
     range_t       r_result;
-    size_t        t_bucketcount = 0;
     _hashnode_t*  pt_begin = NULL;
     _hashnode_t*  pt_end = NULL;
     _hashnode_t** ppt_bucket = NULL;
     size_t        t_tmp = 0;
-    size_t        t_pos = 0;
-    bool_t        b_less = false;
-    bool_t        b_greater = false;
-    size_t        i = 0;
 
     assert(cpt_hashtable != NULL);
     assert(cpv_value != NULL);
@@ -406,22 +440,14 @@ range_t _hashtable_equal_range(const _hashtable_t* cpt_hashtable, const void* cp
     r_result.it_begin = _create_hashtable_iterator();
     r_result.it_end = _create_hashtable_iterator();
 
-    t_bucketcount = _hashtable_bucket_count(cpt_hashtable);
     t_tmp = _GET_HASHTABLE_TYPE_SIZE(cpt_hashtable);
     _hashtable_hash_auxiliary(cpt_hashtable, cpv_value, &t_tmp);
-    t_pos = t_tmp % t_bucketcount;
-    ppt_bucket = (_hashnode_t**)vector_at(&cpt_hashtable->_vec_bucket, t_pos);
+    ppt_bucket = _hashtable_get_bucket_auxiliary(cpt_hashtable, t_tmp);
 
     for (pt_begin = *ppt_bucket; pt_begin != NULL; pt_begin = pt_begin->_pt_next) {
-        b_less = b_greater = _GET_HASHTABLE_TYPE_SIZE(cpt_hashtable);
-        _hashtable_elem_compare_auxiliary(cpt_hashtable, pt_begin->_pby_data, cpv_value, &b_less);
-        _hashtable_elem_compare_auxiliary(cpt_hashtable, cpv_value, pt_begin->_pby_data, &b_greater);
-        if (!b_less && !b_greater) {
+        if (_hashtable_node_equal_auxiliary(cpt_hashtable, pt_begin, cpv_value, t_tmp)) {
             for (pt_end = pt_begin->_pt_next; pt_end != NULL; pt_end = pt_end->_pt_next) {
-                b_less = b_greater = _GET_HASHTABLE_TYPE_SIZE(cpt_hashtable);
-                _hashtable_elem_compare_auxiliary(cpt_hashtable, pt_end->_pby_data, cpv_value, &b_less);
-                _hashtable_elem_compare_auxiliary(cpt_hashtable, cpv_value, pt_end->_pby_data, &b_greater);
-                if (b_less || b_greater) {
+                if (!_hashtable_node_equal_auxiliary(cpt_hashtable, pt_end, cpv_value, t_tmp)) {
                     _HASHTABLE_ITERATOR_BUCKETPOS(r_result.it_begin) = (_byte_t*)ppt_bucket;
                     _HASHTABLE_ITERATOR_COREPOS(r_result.it_begin) = (_byte_t*)pt_begin;
                     _HASHTABLE_ITERATOR_HASHTABLE_POINTER(r_result.it_begin) = (_hashtable_t*)cpt_hashtable;
@@ -438,16 +464,13 @@ range_t _hashtable_equal_range(const _hashtable_t* cpt_hashtable, const void* cp
             _HASHTABLE_ITERATOR_COREPOS(r_result.it_begin) = (_byte_t*)pt_begin;
             _HASHTABLE_ITERATOR_HASHTABLE_POINTER(r_result.it_begin) = (_hashtable_t*)cpt_hashtable;
 
-            for (i = t_pos + 1; i < t_bucketcount; ++i) {
-                ppt_bucket = (_hashnode_t**)vector_at(&cpt_hashtable->_vec_bucket, i);
-                pt_end = *ppt_bucket;
-                if (pt_end != NULL) {
-                    _HASHTABLE_ITERATOR_BUCKETPOS(r_result.it_end) = (_byte_t*)ppt_bucket;
-                    _HASHTABLE_ITERATOR_COREPOS(r_result.it_end) = (_byte_t*)pt_end;
-                    _HASHTABLE_ITERATOR_HASHTABLE_POINTER(r_result.it_end) = (_hashtable_t*)cpt_hashtable;
+            ppt_bucket = _hashtable_next_bucket_auxiliary(cpt_hashtable, ppt_bucket);
+            if ((_byte_t*)ppt_bucket != _VECTOR_ITERATOR_COREPOS(vector_end(&cpt_hashtable->_vec_bucket))) {
+                _HASHTABLE_ITERATOR_BUCKETPOS(r_result.it_end) = (_byte_t*)ppt_bucket;
+                _HASHTABLE_ITERATOR_COREPOS(r_result.it_end) = (_byte_t*)*ppt_bucket;
+                _HASHTABLE_ITERATOR_HASHTABLE_POINTER(r_result.it_end) = (_hashtable_t*)cpt_hashtable;
 
-                    return r_result;
-                }
+                return r_result;
             }
 
             r_result.it_end = _hashtable_end(cpt_hashtable);
@@ -494,6 +517,9 @@ void _hashtable_erase_pos(_hashtable_t* pt_hashtable, _hashtable_iterator_t it_p
     if (pt_node == pt_deletion) {
         /* the deletion node is the first node of node list */
         *ppt_bucket = pt_node->_pt_next;
+        if (*ppt_bucket == NULL) {
+            _hashtable_update_bucket_auxiliary(pt_hashtable, ppt_bucket);
+        }
     } else {
         while (pt_node->_pt_next != NULL) {
             if (pt_node->_pt_next == pt_deletion) {
@@ -508,8 +534,7 @@ void _hashtable_erase_pos(_hashtable_t* pt_hashtable, _hashtable_iterator_t it_p
     b_result = _GET_HASHTABLE_TYPE_SIZE(pt_hashtable);
     _GET_HASHTABLE_TYPE_DESTROY_FUNCTION(pt_hashtable)(pt_deletion->_pby_data, &b_result);
     assert(b_result);
-    _alloc_deallocate(
-        &pt_hashtable->_t_allocator, pt_deletion, _HASHTABLE_NODE_SIZE(_GET_HASHTABLE_TYPE_SIZE(pt_hashtable)), 1);
+    _alloc_deallocate(&pt_hashtable->_t_allocator, pt_deletion, pt_hashtable->_t_nodesize, 1);
     /* update the hashtable size */
     pt_hashtable->_t_nodecount--;
 }
@@ -548,13 +573,39 @@ void _hashtable_erase_range(
  */
 size_t _hashtable_erase(_hashtable_t* pt_hashtable, const void* cpv_value)
 {
-    size_t t_countsize = _hashtable_count(pt_hashtable, cpv_value);
-    range_t t_range = _hashtable_equal_range(pt_hashtable, cpv_value);
+    size_t t_countsize = 0;
+    range_t t_range;
+#ifdef CSTL_HASHTABLE_AUTO_SHRINK
+    size_t t_bucketcount = 0;
+#endif
 
+    assert(pt_hashtable != NULL);
+    assert(cpv_value != NULL);
+    assert(_hashtable_is_inited(pt_hashtable));
+
+    /* move some old buckets into new buckets before the range of elements is selected */
+    if (pt_hashtable->_ppt_oldbucket != NULL) {
+        _hashtable_rehash_step_auxiliary(pt_hashtable, _HASHTABLE_INCREMENTAL_REHASH_STEP);
+    }
+
+    t_countsize = _hashtable_count(pt_hashtable, cpv_value);
+    t_range = _hashtable_equal_range(pt_hashtable, cpv_value);
     if (!_hashtable_iterator_equal(t_range.it_begin, _hashtable_end(pt_hashtable))) {
         _hashtable_erase_range(pt_hashtable, t_range.it_begin, t_range.it_end);
     }
 
+#ifdef CSTL_HASHTABLE_AUTO_SHRINK
+    /* shrink the buckets when most of elements are erased, so that the iteration does not visit too many buckets */
+    t_bucketcount = _hashtable_get_least_bucket_count_auxiliary(pt_hashtable, _hashtable_size(pt_hashtable));
+    if (t_countsize > 0 &&
+        _hashtable_bucket_count(pt_hashtable) > t_bucketcount * _HASHTABLE_SHRINK_FACTOR &&
+        _hashtable_bucket_count(pt_hashtable) > _hashtable_get_prime(_HASHTABLE_DEFAULT_BUCKET_COUNT)) {
+        _hashtable_rebuild_auxiliary(pt_hashtable,
+            _hashtable_get_prime(t_bucketcount * 2 > _HASHTABLE_DEFAULT_BUCKET_COUNT ?
+                                 t_bucketcount * 2 : _HASHTABLE_DEFAULT_BUCKET_COUNT));
+    }
+#endif
+
     return t_countsize;
 }
 
@@ -641,6 +692,25 @@ size_t _hashtable_max_size(const _hashtable_t* cpt_hashtable)
     return (size_t)(-1) / _GET_HASHTABLE_TYPE_SIZE(cpt_hashtable);
 }
 
+/**
+ * Get the memory that is allocated by the hashtable.
+ */
+size_t _hashtable_memory_usage(const _hashtable_t* cpt_hashtable)
+{
+    _allocstat_t t_stat;
+    size_t       t_usage = 0;
+
+    assert(cpt_hashtable != NULL);
+    assert(_hashtable_is_inited(cpt_hashtable));
+
+    _alloc_get_stat(&cpt_hashtable->_t_allocator, &t_stat);
+    t_usage = t_stat._t_livesize + t_stat._t_cachedsize;
+    _alloc_get_stat(&cpt_hashtable->_vec_bucket._t_allocator, &t_stat);
+    t_usage += t_stat._t_livesize + t_stat._t_cachedsize;
+
+    return t_usage;
+}
+
 /**
  * Get the bucket count of elements int the hashtable.
  */
@@ -652,31 +722,57 @@ size_t _hashtable_bucket_count(const _hashtable_t* cpt_hashtable)
     return vector_size(&cpt_hashtable->_vec_bucket);
 }
 
+/**
+ * Get the average number of elements per bucket.
+ */
+float _hashtable_load_factor(const _hashtable_t* cpt_hashtable)
+{
+    assert(cpt_hashtable != NULL);
+    assert(_hashtable_is_inited(cpt_hashtable));
+
+    return (float)_hashtable_size(cpt_hashtable) / (float)_hashtable_bucket_count(cpt_hashtable);
+}
+
+/**
+ * Get the max load factor of hashtable.
+ */
+float _hashtable_max_load_factor(const _hashtable_t* cpt_hashtable)
+{
+    assert(cpt_hashtable != NULL);
+    assert(_hashtable_is_inited(cpt_hashtable));
+
+    return cpt_hashtable->_f_maxloadfactor;
+}
+
+/**
+ * Set the max load factor of hashtable.
+ */
+void _hashtable_set_max_load_factor(_hashtable_t* pt_hashtable, float f_maxloadfactor)
+{
+    assert(pt_hashtable != NULL);
+    assert(_hashtable_is_inited(pt_hashtable));
+    assert(f_maxloadfactor > 0.0f);
+
+    /* the buckets are expanded at once if the current load factor exceeds the new max load factor */
+    pt_hashtable->_f_maxloadfactor = f_maxloadfactor;
+    _hashtable_reserve(pt_hashtable, _hashtable_size(pt_hashtable));
+}
+
 /**
  * Return an iterator that addresses the first element in the hashtable.
  */
 _hashtable_iterator_t _hashtable_begin(const _hashtable_t* cpt_hashtable)
 {
-    vector_iterator_t     it_bucket;
-    vector_iterator_t     it_begin;
-    vector_iterator_t     it_end;
+    _hashnode_t**         ppt_bucket = NULL;
     _hashtable_iterator_t it_iter = _create_hashtable_iterator();
 
     assert(cpt_hashtable != NULL);
     assert(_hashtable_is_inited(cpt_hashtable));
 
-    it_begin = vector_begin(&cpt_hashtable->_vec_bucket);
-    it_end = vector_end(&cpt_hashtable->_vec_bucket);
-    for (it_bucket = it_begin; !iterator_equal(it_bucket, it_end); it_bucket = iterator_next(it_bucket)) {
-        _HASHTABLE_ITERATOR_BUCKETPOS(it_iter) = _VECTOR_ITERATOR_COREPOS(it_bucket);
-        if (*(_hashnode_t**)_HASHTABLE_ITERATOR_BUCKETPOS(it_iter) != NULL) {
-            _HASHTABLE_ITERATOR_COREPOS(it_iter) = (_byte_t*)*(_hashnode_t**)_HASHTABLE_ITERATOR_BUCKETPOS(it_iter);
-            break;
-        }
-    }
-    if (iterator_equal(it_bucket, it_end)) {
-        assert(_HASHTABLE_ITERATOR_COREPOS(it_iter) == NULL);
-        _HASHTABLE_ITERATOR_BUCKETPOS(it_iter) = _VECTOR_ITERATOR_COREPOS(it_bucket);
+    ppt_bucket = _hashtable_next_bucket_auxiliary(cpt_hashtable, NULL);
+    _HASHTABLE_ITERATOR_BUCKETPOS(it_iter) = (_byte_t*)ppt_bucket;
+    if ((_byte_t*)ppt_bucket != _VECTOR_ITERATOR_COREPOS(vector_end(&cpt_hashtable->_vec_bucket))) {
+        _HASHTABLE_ITERATOR_COREPOS(it_iter) = (_byte_t*)*ppt_bucket;
     }
     _HASHTABLE_ITERATOR_HASHTABLE_POINTER(it_iter) = (_hashtable_t*)cpt_hashtable;
 
@@ -729,21 +825,33 @@ bfun_t _hashtable_key_comp(const _hashtable_t* cpt_hashtable)
  */
 void _hashtable_clear(_hashtable_t* pt_hashtable)
 {
-    size_t       t_bucketcount = 0;
-    size_t       i = 0;
-    _hashnode_t* pt_node = NULL;
-    _hashnode_t* pt_deletion = NULL;
-    bool_t       b_result = false;
+    size_t        t_bucketcount = 0;
+    _hashnode_t*  pt_node = NULL;
+    _hashnode_t*  pt_deletion = NULL;
+    _hashnode_t** ppt_bucket = NULL;
+    bool_t        b_result = false;
 
     assert(pt_hashtable != NULL);
     assert(_hashtable_is_inited(pt_hashtable) || _hashtable_is_created(pt_hashtable));
 
+    /* move all old buckets into new buckets, then destroy them together */
+    if (pt_hashtable->_ppt_oldbucket != NULL) {
+        _hashtable_rehash_step_auxiliary(pt_hashtable, (size_t)-1);
+    }
+
+    /* the hashtable that is created only has no bucket */
+    if (pt_hashtable->_pt_bucketmap == NULL) {
+        return;
+    }
+
     t_bucketcount = vector_size(&pt_hashtable->_vec_bucket);
-    /* iterator all bucket node */
-    for (i = 0; i < t_bucketcount; ++i) {
+    /* iterator all non-empty bucket node, the first non-empty bucket is updated when the bucket is emptied */
+    while (pt_hashtable->_t_firstbucket < t_bucketcount) {
         /* iterator all element list for one bucket node */
-        pt_node = *(_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, i);
-        *(_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, i) = NULL;
+        ppt_bucket = (_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, pt_hashtable->_t_firstbucket);
+        pt_node = *ppt_bucket;
+        *ppt_bucket = NULL;
+        _hashtable_update_bucket_auxiliary(pt_hashtable, ppt_bucket);
         while (pt_node != NULL) {
             /* delete each element */
             pt_deletion = pt_node;
@@ -753,8 +861,7 @@ void _hashtable_clear(_hashtable_t* pt_hashtable)
             b_result = _GET_HASHTABLE_TYPE_SIZE(pt_hashtable);
             _GET_HASHTABLE_TYPE_DESTROY_FUNCTION(pt_hashtable)(pt_deletion->_pby_data, &b_result);
             assert(b_result);
-            _alloc_deallocate(&pt_hashtable->_t_allocator,  pt_deletion, 
-                _HASHTABLE_NODE_SIZE(_GET_HASHTABLE_TYPE_SIZE(pt_hashtable)), 1);
+            _alloc_deallocate(&pt_hashtable->_t_allocator, pt_deletion, pt_hashtable->_t_nodesize, 1);
         }
     }
     
@@ -798,6 +905,20 @@ bool_t _hashtable_equal(const _hashtable_t* cpt_first, const _hashtable_t* cpt_s
     it_second_begin = _hashtable_begin(cpt_second);
     it_second_end = _hashtable_end(cpt_second);
 
+    /* the element order is different during incremental rehash, so check the count of each element */
+    if (cpt_first->_ppt_oldbucket != NULL || cpt_second->_ppt_oldbucket != NULL) {
+        for (it_first = it_first_begin;
+             !_hashtable_iterator_equal(it_first, it_first_end);
+             it_first = _hashtable_iterator_next(it_first)) {
+            if (_hashtable_count(cpt_first, ((_hashnode_t*)_HASHTABLE_ITERATOR_COREPOS(it_first))->_pby_data) !=
+                _hashtable_count(cpt_second, ((_hashnode_t*)_HASHTABLE_ITERATOR_COREPOS(it_first))->_pby_data)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     /* check each element */
     for (it_first = it_first_begin, it_second = it_second_begin;
          !_hashtable_iterator_equal(it_first, it_first_end) && !_hashtable_iterator_equal(it_second, it_second_end);
@@ -940,7 +1061,7 @@ void _hashtable_insert_equal_array(_hashtable_t* pt_hashtable, const void* cpv_a
      * the elements of c builtin array are element itself, but the elements of 
      * c string, user define or cstl are pointer of element.
      */
-    if (strncmp(_GET_HASHTABLE_TYPE_BASENAME(pt_hashtable), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_HASHTABLE_TYPE_ID(pt_hashtable) == _TYPE_ID_C_STRING) {
         /*
          * We need built a string_t for c string element.
          */
@@ -998,7 +1119,7 @@ void _hashtable_insert_unique_array(_hashtable_t* pt_hashtable, const void* cpv_
      * the elements of c builtin array are element itself, but the elements of 
      * c string, user define or cstl are pointer of element.
      */
-    if (strncmp(_GET_HASHTABLE_TYPE_BASENAME(pt_hashtable), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_HASHTABLE_TYPE_ID(pt_hashtable) == _TYPE_ID_C_STRING) {
         /*
          * We need built a string_t for c string element.
          */
@@ -1022,6 +1143,34 @@ void _hashtable_insert_unique_array(_hashtable_t* pt_hashtable, const void* cpv_
 }
 
 /** local function implementation section **/
+/**
+ * Find specific element in the node list of bucket.
+ */
+static _hashtable_iterator_t _hashtable_find_in_bucket(
+    const _hashtable_t* cpt_hashtable, _hashnode_t** ppt_bucket, const void* cpv_value, size_t t_hash)
+{
+    _hashtable_iterator_t it_iter = _create_hashtable_iterator();
+    _hashnode_t*          pt_node = NULL;
 
-/** eof **/
+    assert(cpt_hashtable != NULL);
+    assert(ppt_bucket != NULL);
+    assert(cpv_value != NULL);
+
+    for (pt_node = *ppt_bucket; pt_node != NULL; pt_node = pt_node->_pt_next) {
+        if (_hashtable_node_equal_auxiliary(cpt_hashtable, pt_node, cpv_value, t_hash)) {
+            break;
+        }
+    }
+
+    if (pt_node == NULL) {
+        return _hashtable_end(cpt_hashtable);
+    } else {
+        _HASHTABLE_ITERATOR_BUCKETPOS(it_iter) = (_byte_t*)ppt_bucket;
+        _HASHTABLE_ITERATOR_COREPOS(it_iter) = (_byte_t*)pt_node;
+        _HASHTABLE_ITERATOR_HASHTABLE_POINTER(it_iter) = (_hashtable_t*)cpt_hashtable;
 
+        return it_iter;
+    }
+}
+
+/** eof **/
@@ -27,25 +27,78 @@
 #include <cstl/citerator.h>
 #include <cstl/cvector.h>
 #include <cstl/cstring.h>
+#include <cstl/cutility.h>
 
 #include <cstl/cstl_hashtable_iterator.h>
 #include <cstl/cstl_hashtable_private.h>
 #include <cstl/cstl_hashtable.h>
 
+#include "cstl_types_aux.h"
 #include "cstl_vector_aux.h"
 #include "cstl_hashtable_aux.h"
+#include "cstl_map_aux.h"
 
 /** local constant declaration and local macro section **/
 #define _HASHTABLE_FIRST_PRIME_BUCKET_COUNT 53
 #define _HASHTABLE_LAST_PRIME_BUCKET_COUNT  4294967291ul
 
+/* constants for default hash function, the primes are the same as xxHash64 */
+#define _HASHTABLE_HASH_PRIME_1             0x9E3779B185EBCA87ULL
+#define _HASHTABLE_HASH_PRIME_2             0xC2B2AE3D27D4EB4FULL
+#define _HASHTABLE_HASH_PRIME_3             0x165667B19E3779F9ULL
+#define _HASHTABLE_HASH_PRIME_4             0x85EBCA77C2B2AE63ULL
+#define _HASHTABLE_HASH_PRIME_5             0x27D4EB2F165667C5ULL
+#define _HASHTABLE_HASH_ROTL(x, r)          (((x) << (r)) | ((x) >> (64 - (r))))
+
+#define _HASHTABLE_BUCKETMAP_NONE           ((size_t)-1)
+
 /** local data type declaration and local struct, union, enum section **/
+#ifdef _MSC_VER
+typedef unsigned __int64   _hashvalue_t;
+#else
+typedef unsigned long long _hashvalue_t;
+#endif
 
 /** local function prototype section **/
+/**
+ * Get the seed of default hash function, the seed is selected randomly when it is used first time.
+ * @return the seed of default hash function.
+ */
+static _hashvalue_t _hashtable_hash_seed(void);
+
+/**
+ * Read 8, 4 bytes from memory without alignment requirement.
+ */
+static _hashvalue_t _hashtable_hash_read64(const _byte_t* cpby_data);
+static _hashvalue_t _hashtable_hash_read32(const _byte_t* cpby_data);
+
+/**
+ * Mix one 8 bytes block into the accumulator.
+ */
+static _hashvalue_t _hashtable_hash_round(_hashvalue_t t_acc, _hashvalue_t t_input);
+
+/**
+ * Find the first set bit at or after specific position in occupancy bitmap.
+ * @param cpt_map           occupancy bitmap.
+ * @param t_index           start position.
+ * @param t_count           bit count of bitmap.
+ * @return the position of set bit, if there is no such bit, return t_count.
+ */
+static size_t _hashtable_bucketmap_next(const size_t* cpt_map, size_t t_index, size_t t_count);
+
+/**
+ * Find the last set bit before specific position in occupancy bitmap.
+ * @param cpt_map           occupancy bitmap.
+ * @param t_index           end position.
+ * @return the position of set bit, if there is no such bit, return _HASHTABLE_BUCKETMAP_NONE.
+ */
+static size_t _hashtable_bucketmap_prev(const size_t* cpt_map, size_t t_index);
 
 /** exported global variable definition section **/
 
 /** local global variable definition section **/
+static _hashvalue_t _gt_hashtable_seed = 0;
+static bool_t       _gb_hashtable_seeded = false;
 static const unsigned long _hashtable_prime_list[_HASHTABLE_PRIME_LIST_COUNT] = {
     53,         97,           193,         389,       769,
     1543,       3079,         6151,        12289,     24593,
@@ -105,6 +158,11 @@ bool_t _hashtable_is_inited(const _hashtable_t* cpt_hashtable)
         return false;
     }
 
+    if (cpt_hashtable->_ppt_oldbucket != NULL &&
+        (cpt_hashtable->_t_oldbucketcount == 0 || cpt_hashtable->_t_rehashpos > cpt_hashtable->_t_oldbucketcount)) {
+        return false;
+    }
+
     if (cpt_hashtable->_ufun_hash == NULL || cpt_hashtable->_bfun_compare == NULL) {
         return false;
     }
@@ -148,6 +206,20 @@ bool_t _hashtable_iterator_belong_to_hashtable(const _hashtable_t* cpt_hashtable
             }
         }
 
+        /* the node in old buckets during incremental rehash */
+        if (cpt_hashtable->_ppt_oldbucket != NULL) {
+            size_t i = 0;
+            for (i = cpt_hashtable->_t_rehashpos; i < cpt_hashtable->_t_oldbucketcount; ++i) {
+                if (_HASHTABLE_ITERATOR_BUCKETPOS(it_iter) == (_byte_t*)(cpt_hashtable->_ppt_oldbucket + i)) {
+                    for (pt_node = cpt_hashtable->_ppt_oldbucket[i]; pt_node != NULL; pt_node = pt_node->_pt_next) {
+                        if (pt_node == (_hashnode_t*)_HASHTABLE_ITERATOR_COREPOS(it_iter)) {
+                            return true;
+                        }
+                    }
+                }
+            }
+        }
+
         return false;
     }
 }
@@ -248,19 +320,98 @@ unsigned long _hashtable_get_prime(unsigned long ul_basenum)
  */
 void _hashtable_default_hash(const void* cpv_input, void* pv_output)
 {
-    size_t   t_sum = 0;
-    _byte_t* pby_value = NULL;
-    size_t   i = 0;
-
     assert(cpv_input != NULL);
     assert(pv_output != NULL);
 
-    pby_value = (_byte_t*)cpv_input;
-    for (i = 0; i < *(size_t*)pv_output; ++i) {
-        t_sum += (size_t)pby_value[i];
+    *(size_t*)pv_output = _hashtable_hash_bytes(cpv_input, *(size_t*)pv_output);
+}
+
+/**
+ * Compute the seeded hash value of a memory block.
+ */
+size_t _hashtable_hash_bytes(const void* cpv_data, size_t t_len)
+{
+    const _byte_t* cpby_data = (const _byte_t*)cpv_data;
+    const _byte_t* cpby_end = NULL;
+    _hashvalue_t   t_seed = _hashtable_hash_seed();
+    _hashvalue_t   t_hash = 0;
+
+    assert(cpv_data != NULL || t_len == 0);
+
+    cpby_end = cpby_data + t_len;
+    if (t_len <= 8) {
+        /*
+         * The keys of c builtin types are 1, 2, 4 or 8 bytes, fold the whole key into one word
+         * and finalize it by a bijective mixer, so keys that differ in any bit are spread over all buckets.
+         */
+        _hashvalue_t t_key = 0;
+        if (t_len >= 4) {
+            t_key = _hashtable_hash_read32(cpby_data) | ((_hashvalue_t)_hashtable_hash_read32(cpby_end - 4) << 32);
+        } else if (t_len > 0) {
+            t_key = (_hashvalue_t)cpby_data[0] | ((_hashvalue_t)cpby_data[t_len >> 1] << 8) |
+                    ((_hashvalue_t)cpby_end[-1] << 16);
+        }
+        t_hash = t_key ^ t_seed ^ ((_hashvalue_t)t_len * _HASHTABLE_HASH_PRIME_5);
+        t_hash ^= t_hash >> 32;
+        t_hash *= 0xD6E8FEB86659FD93ULL;
+        t_hash ^= t_hash >> 32;
+        t_hash *= 0xD6E8FEB86659FD93ULL;
+        t_hash ^= t_hash >> 32;
+
+        return (size_t)t_hash;
     }
 
-    *(size_t*)pv_output = t_sum;
+    /* the long keys, e.g. c string or user defined struct, are hashed by the xxHash64 algorithm */
+    if (t_len >= 32) {
+        const _byte_t* cpby_limit = cpby_end - 32;
+        _hashvalue_t   t_v1 = t_seed + _HASHTABLE_HASH_PRIME_1 + _HASHTABLE_HASH_PRIME_2;
+        _hashvalue_t   t_v2 = t_seed + _HASHTABLE_HASH_PRIME_2;
+        _hashvalue_t   t_v3 = t_seed;
+        _hashvalue_t   t_v4 = t_seed - _HASHTABLE_HASH_PRIME_1;
+
+        do {
+            t_v1 = _hashtable_hash_round(t_v1, _hashtable_hash_read64(cpby_data));
+            t_v2 = _hashtable_hash_round(t_v2, _hashtable_hash_read64(cpby_data + 8));
+            t_v3 = _hashtable_hash_round(t_v3, _hashtable_hash_read64(cpby_data + 16));
+            t_v4 = _hashtable_hash_round(t_v4, _hashtable_hash_read64(cpby_data + 24));
+            cpby_data += 32;
+        } while (cpby_data <= cpby_limit);
+
+        t_hash = _HASHTABLE_HASH_ROTL(t_v1, 1) + _HASHTABLE_HASH_ROTL(t_v2, 7) +
+                 _HASHTABLE_HASH_ROTL(t_v3, 12) + _HASHTABLE_HASH_ROTL(t_v4, 18);
+        t_hash = (t_hash ^ _hashtable_hash_round(0, t_v1)) * _HASHTABLE_HASH_PRIME_1 + _HASHTABLE_HASH_PRIME_4;
+        t_hash = (t_hash ^ _hashtable_hash_round(0, t_v2)) * _HASHTABLE_HASH_PRIME_1 + _HASHTABLE_HASH_PRIME_4;
+        t_hash = (t_hash ^ _hashtable_hash_round(0, t_v3)) * _HASHTABLE_HASH_PRIME_1 + _HASHTABLE_HASH_PRIME_4;
+        t_hash = (t_hash ^ _hashtable_hash_round(0, t_v4)) * _HASHTABLE_HASH_PRIME_1 + _HASHTABLE_HASH_PRIME_4;
+    } else {
+        t_hash = t_seed + _HASHTABLE_HASH_PRIME_5;
+    }
+
+    t_hash += (_hashvalue_t)t_len;
+    while (cpby_data + 8 <= cpby_end) {
+        t_hash ^= _hashtable_hash_round(0, _hashtable_hash_read64(cpby_data));
+        t_hash = _HASHTABLE_HASH_ROTL(t_hash, 27) * _HASHTABLE_HASH_PRIME_1 + _HASHTABLE_HASH_PRIME_4;
+        cpby_data += 8;
+    }
+    if (cpby_data + 4 <= cpby_end) {
+        t_hash ^= (_hashvalue_t)_hashtable_hash_read32(cpby_data) * _HASHTABLE_HASH_PRIME_1;
+        t_hash = _HASHTABLE_HASH_ROTL(t_hash, 23) * _HASHTABLE_HASH_PRIME_2 + _HASHTABLE_HASH_PRIME_3;
+        cpby_data += 4;
+    }
+    while (cpby_data < cpby_end) {
+        t_hash ^= (_hashvalue_t)(*cpby_data) * _HASHTABLE_HASH_PRIME_5;
+        t_hash = _HASHTABLE_HASH_ROTL(t_hash, 11) * _HASHTABLE_HASH_PRIME_1;
+        cpby_data++;
+    }
+
+    /* avalanche */
+    t_hash ^= t_hash >> 33;
+    t_hash *= _HASHTABLE_HASH_PRIME_2;
+    t_hash ^= t_hash >> 29;
+    t_hash *= _HASHTABLE_HASH_PRIME_3;
+    t_hash ^= t_hash >> 32;
+
+    return (size_t)t_hash;
 }
 
 /*
@@ -319,6 +470,26 @@ void _hashtable_init_elem_auxiliary(_hashtable_t* pt_hashtable, _hashnode_t* pt_
     }
 }
 
+/**
+ * Initialize the element of new node auxiliary function
+ */
+void _hashtable_init_node_auxiliary(_hashtable_t* pt_hashtable, _hashnode_t* pt_node)
+{
+    assert(pt_hashtable != NULL);
+    assert(pt_node != NULL);
+    assert(_hashtable_is_inited(pt_hashtable) || _hashtable_is_created(pt_hashtable));
+
+    /* the first and second of pair element are stored inline after the pair in the same node */
+    if (pt_hashtable->_t_nodesize > _HASHTABLE_NODE_SIZE(_GET_HASHTABLE_TYPE_SIZE(pt_hashtable))) {
+        char s_elemtypename[_TYPE_NAME_SIZE + 1];
+        _type_get_elem_typename(_GET_HASHTABLE_TYPE_NAME(pt_hashtable), s_elemtypename);
+
+        _pair_init_inline((pair_t*)pt_node->_pby_data, s_elemtypename);
+    } else {
+        _hashtable_init_elem_auxiliary(pt_hashtable, pt_node);
+    }
+}
+
 /**
  * hash auxiliary
  */
@@ -329,12 +500,15 @@ void _hashtable_hash_auxiliary(const _hashtable_t* cpt_hashtable, const void* cp
     assert(pv_output != NULL);
     assert(_hashtable_is_inited(cpt_hashtable));
 
-    if (strncmp(_GET_HASHTABLE_TYPE_NAME(cpt_hashtable), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_HASHTABLE_TYPE_ID(cpt_hashtable) == _TYPE_ID_C_STRING) {
         *(size_t*)pv_output = strlen(string_c_str((string_t*)cpv_input));
         cpt_hashtable->_ufun_hash(string_c_str((string_t*)cpv_input), pv_output);
+    } else if (cpt_hashtable->_ufun_hash == _hashtable_default_hash) {
+        /* the default hash of element type sees the contents of cstl builtin types, not their handles */
+        _GET_HASHTABLE_TYPE_HASH_FUNCTION(cpt_hashtable)(cpv_input, pv_output);
     } else {
         cpt_hashtable->_ufun_hash(cpv_input, pv_output);
-    } 
+    }
 }
 
 /**
@@ -349,7 +523,7 @@ void _hashtable_elem_compare_auxiliary(
     assert(pv_output != NULL);
     assert(_hashtable_is_inited(cpt_hashtable));
 
-    if (strncmp(_GET_HASHTABLE_TYPE_NAME(cpt_hashtable), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0 &&
+    if (_GET_HASHTABLE_TYPE_ID(cpt_hashtable) == _TYPE_ID_C_STRING &&
         cpt_hashtable->_bfun_compare != _GET_HASHTABLE_TYPE_LESS_FUNCTION(cpt_hashtable)) {
         cpt_hashtable->_bfun_compare(string_c_str((string_t*)cpv_first), string_c_str((string_t*)cpv_second), pv_output);
     } else {
@@ -357,7 +531,554 @@ void _hashtable_elem_compare_auxiliary(
     }
 }
 
+/**
+ * Element three-way compare function auxiliary
+ */
+int _hashtable_elem_three_way_compare_auxiliary(
+    const _hashtable_t* cpt_hashtable, const void* cpv_first, const void* cpv_second)
+{
+    int    n_result = 0;
+    bool_t b_result = false;
+
+    assert(cpt_hashtable != NULL);
+    assert(cpv_first != NULL);
+    assert(cpv_second != NULL);
+    assert(_hashtable_is_inited(cpt_hashtable));
+
+    /* the three-way compare of element type agrees with the less of element type only */
+    if (cpt_hashtable->_bfun_compare == _GET_HASHTABLE_TYPE_LESS_FUNCTION(cpt_hashtable) &&
+        _GET_HASHTABLE_TYPE_COMPARE_FUNCTION(cpt_hashtable) != NULL) {
+        _GET_HASHTABLE_TYPE_COMPARE_FUNCTION(cpt_hashtable)(cpv_first, cpv_second, &n_result);
+        return n_result;
+    }
+    /* the pairs of map containers are ordered by keys only */
+    if (_map_key_three_way_compare(cpt_hashtable->_bfun_compare, cpv_first, cpv_second, &n_result)) {
+        return n_result;
+    }
+
+    b_result = _GET_HASHTABLE_TYPE_SIZE(cpt_hashtable);
+    _hashtable_elem_compare_auxiliary(cpt_hashtable, cpv_first, cpv_second, &b_result);
+    if (b_result) {
+        return -1;
+    }
+    b_result = _GET_HASHTABLE_TYPE_SIZE(cpt_hashtable);
+    _hashtable_elem_compare_auxiliary(cpt_hashtable, cpv_second, cpv_first, &b_result);
+
+    return b_result ? 1 : 0;
+}
+
+/**
+ * Get the hash code of element in node.
+ */
+size_t _hashtable_node_hashcode_auxiliary(const _hashtable_t* cpt_hashtable, const _hashnode_t* cpt_node)
+{
+    size_t t_hashcode = 0;
+
+    assert(cpt_hashtable != NULL);
+    assert(cpt_node != NULL);
+
+#ifdef CSTL_HASHTABLE_HASH_CODE_CACHE
+    t_hashcode = cpt_node->_t_hashcode;
+#else
+    t_hashcode = _GET_HASHTABLE_TYPE_SIZE(cpt_hashtable);
+    _hashtable_hash_auxiliary(cpt_hashtable, cpt_node->_pby_data, &t_hashcode);
+#endif
+
+    return t_hashcode;
+}
+
+/**
+ * Test the element in node is equal to specific element.
+ */
+bool_t _hashtable_node_equal_auxiliary(
+    const _hashtable_t* cpt_hashtable, const _hashnode_t* cpt_node, const void* cpv_value, size_t t_hashcode)
+{
+    assert(cpt_hashtable != NULL);
+    assert(cpt_node != NULL);
+    assert(cpv_value != NULL);
+
+#ifdef CSTL_HASHTABLE_HASH_CODE_CACHE
+    /* the elements that have different hash code are not equal */
+    if (cpt_node->_t_hashcode != t_hashcode) {
+        return false;
+    }
+#else
+    (void)t_hashcode;
+#endif
+
+    return _hashtable_elem_three_way_compare_auxiliary(cpt_hashtable, cpt_node->_pby_data, cpv_value) == 0 ? true : false;
+}
+
+/**
+ * Get the bucket that the element with specific hash value is saved in.
+ */
+_hashnode_t** _hashtable_get_bucket_auxiliary(const _hashtable_t* cpt_hashtable, size_t t_hash)
+{
+    assert(cpt_hashtable != NULL);
+    assert(_hashtable_is_inited(cpt_hashtable));
+
+    /*
+     * The old bucket is emptied when it is moved and no element is inserted into old buckets, so if the old bucket
+     * is not empty, all elements with this hash value are still in the old bucket.
+     */
+    if (cpt_hashtable->_ppt_oldbucket != NULL &&
+        cpt_hashtable->_ppt_oldbucket[t_hash % cpt_hashtable->_t_oldbucketcount] != NULL) {
+        return cpt_hashtable->_ppt_oldbucket + t_hash % cpt_hashtable->_t_oldbucketcount;
+    } else {
+        return (_hashnode_t**)vector_at(&cpt_hashtable->_vec_bucket, t_hash % vector_size(&cpt_hashtable->_vec_bucket));
+    }
+}
+
+/**
+ * Get the first bucket that is not empty after the specific bucket in iteration order.
+ */
+_hashnode_t** _hashtable_next_bucket_auxiliary(const _hashtable_t* cpt_hashtable, _hashnode_t** ppt_bucket)
+{
+    _hashnode_t** ppt_begin = NULL;
+    _hashnode_t** ppt_end = NULL;
+    size_t        t_bucketcount = 0;
+    size_t        t_index = 0;
+
+    assert(cpt_hashtable != NULL);
+    assert(_hashtable_is_inited(cpt_hashtable));
+
+    /* the old buckets are iterated before the new buckets */
+    if (cpt_hashtable->_ppt_oldbucket != NULL) {
+        ppt_begin = cpt_hashtable->_ppt_oldbucket + cpt_hashtable->_t_rehashpos;
+        ppt_end = cpt_hashtable->_ppt_oldbucket + cpt_hashtable->_t_oldbucketcount;
+        if (ppt_bucket == NULL || (ppt_bucket >= ppt_begin && ppt_bucket < ppt_end)) {
+            t_index = ppt_bucket == NULL ? cpt_hashtable->_t_rehashpos : (size_t)(ppt_bucket - cpt_hashtable->_ppt_oldbucket) + 1;
+            t_index = _hashtable_bucketmap_next(cpt_hashtable->_pt_oldbucketmap, t_index, cpt_hashtable->_t_oldbucketcount);
+            if (t_index < cpt_hashtable->_t_oldbucketcount) {
+                return cpt_hashtable->_ppt_oldbucket + t_index;
+            }
+            ppt_bucket = NULL;
+        }
+    }
+
+    /* the empty buckets are skipped by the occupancy bitmap, and the first non-empty bucket is recorded */
+    ppt_begin = (_hashnode_t**)vector_at(&cpt_hashtable->_vec_bucket, 0);
+    t_bucketcount = vector_size(&cpt_hashtable->_vec_bucket);
+    if (ppt_bucket == NULL) {
+        return ppt_begin + cpt_hashtable->_t_firstbucket;
+    } else {
+        assert(ppt_bucket >= ppt_begin && ppt_bucket < ppt_begin + t_bucketcount);
+        return ppt_begin + _hashtable_bucketmap_next(
+            cpt_hashtable->_pt_bucketmap, (size_t)(ppt_bucket - ppt_begin) + 1, t_bucketcount);
+    }
+}
+
+/**
+ * Get the last bucket that is not empty before the specific bucket in iteration order.
+ */
+_hashnode_t** _hashtable_prev_bucket_auxiliary(const _hashtable_t* cpt_hashtable, _hashnode_t** ppt_bucket)
+{
+    _hashnode_t** ppt_begin = NULL;
+    _hashnode_t** ppt_end = NULL;
+    size_t        t_index = 0;
+
+    assert(cpt_hashtable != NULL);
+    assert(ppt_bucket != NULL);
+    assert(_hashtable_is_inited(cpt_hashtable));
+
+    ppt_begin = (_hashnode_t**)vector_at(&cpt_hashtable->_vec_bucket, 0);
+    ppt_end = ppt_begin + vector_size(&cpt_hashtable->_vec_bucket);
+    if (ppt_bucket >= ppt_begin && ppt_bucket <= ppt_end) {
+        t_index = _hashtable_bucketmap_prev(cpt_hashtable->_pt_bucketmap, (size_t)(ppt_bucket - ppt_begin));
+        if (t_index != _HASHTABLE_BUCKETMAP_NONE) {
+            return ppt_begin + t_index;
+        }
+
+        if (cpt_hashtable->_ppt_oldbucket == NULL) {
+            return NULL;
+        }
+        ppt_bucket = cpt_hashtable->_ppt_oldbucket + cpt_hashtable->_t_oldbucketcount;
+    }
+
+    /* the old buckets are before the new buckets, and the moved old buckets are all empty */
+    assert(cpt_hashtable->_ppt_oldbucket != NULL);
+    t_index = _hashtable_bucketmap_prev(
+        cpt_hashtable->_pt_oldbucketmap, (size_t)(ppt_bucket - cpt_hashtable->_ppt_oldbucket));
+
+    return t_index != _HASHTABLE_BUCKETMAP_NONE ? cpt_hashtable->_ppt_oldbucket + t_index : NULL;
+}
+
+/**
+ * Update the occupancy bitmap of bucket after the node list of bucket is changed.
+ */
+void _hashtable_update_bucket_auxiliary(_hashtable_t* pt_hashtable, _hashnode_t** ppt_bucket)
+{
+    _hashnode_t** ppt_begin = NULL;
+    size_t*       pt_map = NULL;
+    size_t        t_bucketcount = 0;
+    size_t        t_index = 0;
+    size_t        t_mask = 0;
+
+    assert(pt_hashtable != NULL);
+    assert(ppt_bucket != NULL);
+    assert(_hashtable_is_inited(pt_hashtable));
+
+    if (pt_hashtable->_ppt_oldbucket != NULL &&
+        ppt_bucket >= pt_hashtable->_ppt_oldbucket &&
+        ppt_bucket < pt_hashtable->_ppt_oldbucket + pt_hashtable->_t_oldbucketcount) {
+        ppt_begin = pt_hashtable->_ppt_oldbucket;
+        pt_map = pt_hashtable->_pt_oldbucketmap;
+    } else {
+        ppt_begin = (_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, 0);
+        pt_map = pt_hashtable->_pt_bucketmap;
+    }
+    t_index = (size_t)(ppt_bucket - ppt_begin);
+    t_mask = (size_t)1 << (t_index % _HASHTABLE_BUCKETMAP_BITS);
+
+    if (*ppt_bucket != NULL) {
+        pt_map[t_index / _HASHTABLE_BUCKETMAP_BITS] |= t_mask;
+        if (pt_map == pt_hashtable->_pt_bucketmap && t_index < pt_hashtable->_t_firstbucket) {
+            pt_hashtable->_t_firstbucket = t_index;
+        }
+    } else {
+        pt_map[t_index / _HASHTABLE_BUCKETMAP_BITS] &= ~t_mask;
+        if (pt_map == pt_hashtable->_pt_bucketmap && t_index == pt_hashtable->_t_firstbucket) {
+            t_bucketcount = vector_size(&pt_hashtable->_vec_bucket);
+            pt_hashtable->_t_firstbucket = _hashtable_bucketmap_next(pt_map, t_index + 1, t_bucketcount);
+        }
+    }
+}
+
+/**
+ * Replace the buckets with empty buckets.
+ */
+void _hashtable_reset_bucket_auxiliary(_hashtable_t* pt_hashtable, size_t t_bucketcount)
+{
+    size_t t_mapsize = 0;
+
+    assert(pt_hashtable != NULL);
+    assert(pt_hashtable->_ppt_oldbucket == NULL);
+
+    if (pt_hashtable->_pt_bucketmap != NULL) {
+        _alloc_deallocate(&pt_hashtable->_t_allocator, pt_hashtable->_pt_bucketmap,
+            sizeof(size_t), _HASHTABLE_BUCKETMAP_WORDS(vector_size(&pt_hashtable->_vec_bucket)));
+    }
+
+    vector_clear(&pt_hashtable->_vec_bucket);
+    vector_resize(&pt_hashtable->_vec_bucket, t_bucketcount);
+
+    t_mapsize = _HASHTABLE_BUCKETMAP_WORDS(t_bucketcount);
+    pt_hashtable->_pt_bucketmap = (size_t*)_alloc_allocate(&pt_hashtable->_t_allocator, sizeof(size_t), t_mapsize);
+    assert(pt_hashtable->_pt_bucketmap != NULL);
+    memset(pt_hashtable->_pt_bucketmap, 0x00, sizeof(size_t) * t_mapsize);
+    pt_hashtable->_t_firstbucket = t_bucketcount;
+}
+
+/**
+ * Rehash all elements into specific number of buckets.
+ */
+void _hashtable_rebuild_auxiliary(_hashtable_t* pt_hashtable, size_t t_bucketcount)
+{
+    size_t        t_index = 0;
+    size_t        t_oldcount = 0;
+    _hashnode_t*  pt_node = NULL;
+    _hashnode_t*  pt_nodelist = NULL;
+    _hashnode_t** ppt_bucket = NULL;
+
+    assert(pt_hashtable != NULL);
+    assert(_hashtable_is_inited(pt_hashtable));
+    assert(t_bucketcount > 0);
+
+    /* finish the incremental rehash */
+    if (pt_hashtable->_ppt_oldbucket != NULL) {
+        _hashtable_rehash_step_auxiliary(pt_hashtable, (size_t)-1);
+    }
+
+    /* select all element in non-empty buckets */
+    t_oldcount = vector_size(&pt_hashtable->_vec_bucket);
+    for (t_index = pt_hashtable->_t_firstbucket;
+         t_index < t_oldcount;
+         t_index = _hashtable_bucketmap_next(pt_hashtable->_pt_bucketmap, t_index + 1, t_oldcount)) {
+        ppt_bucket = (_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, t_index);
+        pt_node = *ppt_bucket;
+        while (pt_node != NULL) {
+            *ppt_bucket = pt_node->_pt_next;
+            pt_node->_pt_next = pt_nodelist;
+            pt_nodelist = pt_node;
+            pt_node = *ppt_bucket;
+        }
+    }
+
+    _hashtable_reset_bucket_auxiliary(pt_hashtable, t_bucketcount);
+
+    /* rehash */
+    while (pt_nodelist != NULL) {
+        pt_node = pt_nodelist;
+        pt_nodelist = pt_node->_pt_next;
+
+        t_index = _hashtable_node_hashcode_auxiliary(pt_hashtable, pt_node) % t_bucketcount;
+        ppt_bucket = (_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, t_index);
+        pt_node->_pt_next = *ppt_bucket;
+        *ppt_bucket = pt_node;
+        _hashtable_update_bucket_auxiliary(pt_hashtable, ppt_bucket);
+    }
+}
+
+/**
+ * Get the least bucket count that holds specific number of elements without exceeding the max load factor.
+ */
+size_t _hashtable_get_least_bucket_count_auxiliary(const _hashtable_t* cpt_hashtable, size_t t_elemcount)
+{
+    double d_bucketcount = 0.0;
+    size_t t_bucketcount = 0;
+
+    assert(cpt_hashtable != NULL);
+    assert(cpt_hashtable->_f_maxloadfactor > 0.0f);
+
+    d_bucketcount = (double)t_elemcount / cpt_hashtable->_f_maxloadfactor;
+    if (d_bucketcount >= (double)(size_t)-1) {
+        return (size_t)-1;
+    }
+
+    t_bucketcount = (size_t)d_bucketcount;
+    return (double)t_bucketcount < d_bucketcount ? t_bucketcount + 1 : t_bucketcount;
+}
+
+/**
+ * Start incremental rehash.
+ */
+void _hashtable_rehash_start_auxiliary(_hashtable_t* pt_hashtable, size_t t_bucketcount)
+{
+    _hashnode_t** ppt_oldbucket = NULL;
+    size_t        t_oldbucketcount = 0;
+    size_t        t_oldbucketcapacity = 0;
+
+    assert(pt_hashtable != NULL);
+    assert(_hashtable_is_inited(pt_hashtable));
+    assert(pt_hashtable->_ppt_oldbucket == NULL);
+
+    /*
+     * the current buckets become old buckets, the storage of bucket vector is taken over rather than copied, and
+     * the bucket vector allocates new storage for the new buckets that are all empty.
+     */
+    t_oldbucketcount = vector_size(&pt_hashtable->_vec_bucket);
+    t_oldbucketcapacity = vector_capacity(&pt_hashtable->_vec_bucket);
+    ppt_oldbucket = (_hashnode_t**)pt_hashtable->_vec_bucket._pby_start;
+    pt_hashtable->_vec_bucket._pby_start = NULL;
+    pt_hashtable->_vec_bucket._pby_finish = NULL;
+    pt_hashtable->_vec_bucket._pby_endofstorage = NULL;
+
+    /* the occupancy bitmap is moved together with the buckets */
+    pt_hashtable->_pt_oldbucketmap = pt_hashtable->_pt_bucketmap;
+    pt_hashtable->_pt_bucketmap = NULL;
+    _hashtable_reset_bucket_auxiliary(pt_hashtable, t_bucketcount);
+
+    pt_hashtable->_ppt_oldbucket = ppt_oldbucket;
+    pt_hashtable->_t_oldbucketcount = t_oldbucketcount;
+    pt_hashtable->_t_oldbucketcapacity = t_oldbucketcapacity;
+    pt_hashtable->_t_rehashpos = 0;
+}
+
+/**
+ * Move old buckets into new buckets.
+ */
+void _hashtable_rehash_step_auxiliary(_hashtable_t* pt_hashtable, size_t t_step)
+{
+    assert(pt_hashtable != NULL);
+    assert(_hashtable_is_inited(pt_hashtable));
+
+    if (pt_hashtable->_ppt_oldbucket == NULL) {
+        return;
+    }
+
+    while (t_step > 0 && pt_hashtable->_t_rehashpos < pt_hashtable->_t_oldbucketcount) {
+        if (pt_hashtable->_ppt_oldbucket[pt_hashtable->_t_rehashpos] != NULL) {
+            _hashtable_rehash_bucket_auxiliary(pt_hashtable, pt_hashtable->_t_rehashpos);
+        }
+        pt_hashtable->_t_rehashpos++;
+        t_step--;
+    }
+
+    /* all old buckets are moved, the storage of old buckets was allocated by the bucket vector */
+    if (pt_hashtable->_t_rehashpos == pt_hashtable->_t_oldbucketcount) {
+        _alloc_deallocate(&pt_hashtable->_vec_bucket._t_allocator, pt_hashtable->_ppt_oldbucket,
+            sizeof(_hashnode_pointer_t), pt_hashtable->_t_oldbucketcapacity);
+        _alloc_deallocate(&pt_hashtable->_t_allocator, pt_hashtable->_pt_oldbucketmap,
+            sizeof(size_t), _HASHTABLE_BUCKETMAP_WORDS(pt_hashtable->_t_oldbucketcount));
+        pt_hashtable->_ppt_oldbucket = NULL;
+        pt_hashtable->_pt_oldbucketmap = NULL;
+        pt_hashtable->_t_oldbucketcount = 0;
+        pt_hashtable->_t_oldbucketcapacity = 0;
+        pt_hashtable->_t_rehashpos = 0;
+    }
+}
+
+/**
+ * Move all elements of one old bucket into new buckets.
+ */
+void _hashtable_rehash_bucket_auxiliary(_hashtable_t* pt_hashtable, size_t t_index)
+{
+    size_t        t_bucketcount = 0;
+    size_t        t_tmp = 0;
+    _hashnode_t*  pt_node = NULL;
+    _hashnode_t*  pt_next = NULL;
+    _hashnode_t*  pt_prev = NULL;
+    _hashnode_t** ppt_bucket = NULL;
+    _hashnode_t** ppt_prevbucket = NULL;
+
+    assert(pt_hashtable != NULL);
+    assert(_hashtable_is_inited(pt_hashtable));
+    assert(pt_hashtable->_ppt_oldbucket != NULL);
+    assert(t_index < pt_hashtable->_t_oldbucketcount);
+
+    t_bucketcount = vector_size(&pt_hashtable->_vec_bucket);
+    pt_node = pt_hashtable->_ppt_oldbucket[t_index];
+    pt_hashtable->_ppt_oldbucket[t_index] = NULL;
+    _hashtable_update_bucket_auxiliary(pt_hashtable, pt_hashtable->_ppt_oldbucket + t_index);
+    while (pt_node != NULL) {
+        pt_next = pt_node->_pt_next;
+
+        t_tmp = _hashtable_node_hashcode_auxiliary(pt_hashtable, pt_node);
+        ppt_bucket = (_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, t_tmp % t_bucketcount);
+        if (ppt_bucket == ppt_prevbucket) {
+            /* keep the order of nodes that are moved into same bucket, so the equal elements are still together */
+            pt_node->_pt_next = pt_prev->_pt_next;
+            pt_prev->_pt_next = pt_node;
+        } else {
+            pt_node->_pt_next = *ppt_bucket;
+            *ppt_bucket = pt_node;
+            _hashtable_update_bucket_auxiliary(pt_hashtable, ppt_bucket);
+        }
+
+        pt_prev = pt_node;
+        ppt_prevbucket = ppt_bucket;
+        pt_node = pt_next;
+    }
+}
+
 /** local function implementation section **/
+/**
+ * Get the seed of default hash function, the seed is selected randomly when it is used first time.
+ */
+static _hashvalue_t _hashtable_hash_seed(void)
+{
+    if (!_gb_hashtable_seeded) {
+        /*
+         * The seed is shared by all hashtables in the process, so that the hashtables which have same elements
+         * keep same iteration order and the comparison of hashtables remain valid. the entropy comes from the
+         * time and the address of stack and static data, which are randomized by ASLR.
+         */
+        _hashvalue_t t_entropy = 0;
+        t_entropy = (_hashvalue_t)time(NULL);
+        t_entropy = _hashtable_hash_round(t_entropy, (_hashvalue_t)clock());
+        t_entropy = _hashtable_hash_round(t_entropy, (_hashvalue_t)(size_t)&t_entropy);
+        t_entropy = _hashtable_hash_round(t_entropy, (_hashvalue_t)(size_t)&_gt_hashtable_seed);
+
+        _type_lock();
+        /*
+         * the threads that hash first at the same time select different entropy, only the first one is kept.
+         * the seed is written before the flag is set, so the threads that see the flag read the final seed.
+         */
+        if (!_gb_hashtable_seeded) {
+            _gt_hashtable_seed = t_entropy;
+            _TYPE_MEMORY_BARRIER();
+            _gb_hashtable_seeded = true;
+        }
+        _type_unlock();
+    }
+
+    return _gt_hashtable_seed;
+}
+
+/**
+ * Read 8 bytes from memory without alignment requirement.
+ */
+static _hashvalue_t _hashtable_hash_read64(const _byte_t* cpby_data)
+{
+    _hashvalue_t t_value = 0;
+    memcpy(&t_value, cpby_data, sizeof(t_value));
+    return t_value;
+}
+
+/**
+ * Read 4 bytes from memory without alignment requirement.
+ */
+static _hashvalue_t _hashtable_hash_read32(const _byte_t* cpby_data)
+{
+    unsigned int t_value = 0;
+    memcpy(&t_value, cpby_data, 4);
+    return (_hashvalue_t)t_value;
+}
+
+/**
+ * Mix one 8 bytes block into the accumulator.
+ */
+static _hashvalue_t _hashtable_hash_round(_hashvalue_t t_acc, _hashvalue_t t_input)
+{
+    t_acc += t_input * _HASHTABLE_HASH_PRIME_2;
+    t_acc = _HASHTABLE_HASH_ROTL(t_acc, 31);
+    return t_acc * _HASHTABLE_HASH_PRIME_1;
+}
+
+/**
+ * Find the first set bit at or after specific position in occupancy bitmap.
+ */
+static size_t _hashtable_bucketmap_next(const size_t* cpt_map, size_t t_index, size_t t_count)
+{
+    size_t t_word = 0;
+    size_t t_bits = 0;
+
+    assert(cpt_map != NULL);
+
+    if (t_index >= t_count) {
+        return t_count;
+    }
+
+    /* the bits before start position in first word are ignored, and the zero words are skipped */
+    t_word = t_index / _HASHTABLE_BUCKETMAP_BITS;
+    t_bits = cpt_map[t_word] & ((size_t)-1 << (t_index % _HASHTABLE_BUCKETMAP_BITS));
+    while (t_bits == 0) {
+        if (++t_word >= _HASHTABLE_BUCKETMAP_WORDS(t_count)) {
+            return t_count;
+        }
+        t_bits = cpt_map[t_word];
+    }
+
+#if defined(__GNUC__)
+    t_index = t_word * _HASHTABLE_BUCKETMAP_BITS + (size_t)__builtin_ctzll((unsigned long long)t_bits);
+#else
+    for (t_index = t_word * _HASHTABLE_BUCKETMAP_BITS; (t_bits & 1) == 0; t_bits >>= 1) {
+        ++t_index;
+    }
+#endif
+    return t_index < t_count ? t_index : t_count;
+}
+
+/**
+ * Find the last set bit before specific position in occupancy bitmap.
+ */
+static size_t _hashtable_bucketmap_prev(const size_t* cpt_map, size_t t_index)
+{
+    size_t t_word = 0;
+    size_t t_bits = 0;
+
+    assert(cpt_map != NULL);
+
+    if (t_index == 0) {
+        return _HASHTABLE_BUCKETMAP_NONE;
+    }
+
+    /* the bits at or after end position in last word are ignored, and the zero words are skipped */
+    --t_index;
+    t_word = t_index / _HASHTABLE_BUCKETMAP_BITS;
+    t_bits = cpt_map[t_word] & ((size_t)-1 >> (_HASHTABLE_BUCKETMAP_BITS - 1 - t_index % _HASHTABLE_BUCKETMAP_BITS));
+    while (t_bits == 0) {
+        if (t_word-- == 0) {
+            return _HASHTABLE_BUCKETMAP_NONE;
+        }
+        t_bits = cpt_map[t_word];
+    }
+
+    for (t_index = t_word * _HASHTABLE_BUCKETMAP_BITS; t_bits > 1; t_bits >>= 1) {
+        ++t_index;
+    }
+    return t_index;
+}
 
 /** eof **/
 
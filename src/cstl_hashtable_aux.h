@@ -34,10 +34,13 @@ extern "C" {
 #define _GET_HASHTABLE_TYPE_SIZE(pt_hashtable)             ((pt_hashtable)->_t_typeinfo._pt_type->_t_typesize)
 #define _GET_HASHTABLE_TYPE_NAME(pt_hashtable)             ((pt_hashtable)->_t_typeinfo._s_typename)
 #define _GET_HASHTABLE_TYPE_BASENAME(pt_hashtable)         ((pt_hashtable)->_t_typeinfo._pt_type->_s_typename)
+#define _GET_HASHTABLE_TYPE_ID(pt_hashtable)               ((pt_hashtable)->_t_typeinfo._pt_type->_t_typeid)
 #define _GET_HASHTABLE_TYPE_INIT_FUNCTION(pt_hashtable)    ((pt_hashtable)->_t_typeinfo._pt_type->_t_typeinit)
 #define _GET_HASHTABLE_TYPE_COPY_FUNCTION(pt_hashtable)    ((pt_hashtable)->_t_typeinfo._pt_type->_t_typecopy)
 #define _GET_HASHTABLE_TYPE_LESS_FUNCTION(pt_hashtable)    ((pt_hashtable)->_t_typeinfo._pt_type->_t_typeless)
 #define _GET_HASHTABLE_TYPE_DESTROY_FUNCTION(pt_hashtable) ((pt_hashtable)->_t_typeinfo._pt_type->_t_typedestroy)
+#define _GET_HASHTABLE_TYPE_COMPARE_FUNCTION(pt_hashtable) ((pt_hashtable)->_t_typeinfo._pt_type->_t_typecompare)
+#define _GET_HASHTABLE_TYPE_HASH_FUNCTION(pt_hashtable)    ((pt_hashtable)->_t_typeinfo._pt_type->_t_typehash)
 #define _GET_HASHTABLE_TYPE_STYLE(pt_hashtable)            ((pt_hashtable)->_t_typeinfo._t_style)
 
 typedef _hashnode_t*                    _hashnode_pointer_t;
@@ -45,6 +48,25 @@ typedef _hashnode_t*                    _hashnode_pointer_t;
 #define _HASHTABLE_NODE_NAME            "_hashnode_pointer_t"
 #define _HASHTABLE_DEFAULT_BUCKET_COUNT 50
 #define _HASHTABLE_PRIME_LIST_COUNT     28
+#define _HASHTABLE_DEFAULT_MAX_LOAD_FACTOR  1.0f
+
+/*
+ * The hashtable that has more buckets than this count is expanded by incremental rehash, the old buckets are moved
+ * into new buckets step by step when elements are inserted, so there is no long pause for rehashing all elements.
+ */
+#define _HASHTABLE_INCREMENTAL_REHASH_BUCKET_COUNT  1543
+/* the number of old buckets that are moved into new buckets for each insertion */
+#define _HASHTABLE_INCREMENTAL_REHASH_STEP          8
+
+/* the number of buckets that are recorded by one word of occupancy bitmap */
+#define _HASHTABLE_BUCKETMAP_BITS                   (sizeof(size_t) * 8)
+#define _HASHTABLE_BUCKETMAP_WORDS(bucketcount)\
+    (((bucketcount) + _HASHTABLE_BUCKETMAP_BITS - 1) / _HASHTABLE_BUCKETMAP_BITS)
+
+#ifdef CSTL_HASHTABLE_AUTO_SHRINK
+/* the buckets are shrunk by erasing elements when the bucket count is more than this times of element count */
+#define _HASHTABLE_SHRINK_FACTOR                    8
+#endif
 
 /** data type declaration and struct, union, enum section **/
 
@@ -140,12 +162,23 @@ extern void _hashnode_destroy(const void* cpv_input, void* pv_output);
 /**
  * The default hash function.
  * @param cpv_input             input parameter.
- * @param pv_output             output parameter.
+ * @param pv_output             output parameter, the length of input in bytes is passed in and the hash value
+ *                              is passed out.
  * @return void.
  * @remarks if cpv_input == NULL or pv_output == NULL, the behavior is undefined.
  */
 extern void _hashtable_default_hash(const void* cpv_input, void* pv_output);
 
+/**
+ * Compute the seeded hash value of a memory block.
+ * @param cpv_data              memory block.
+ * @param t_len                 length of memory block in bytes.
+ * @return hash value.
+ * @remarks if cpv_data == NULL and t_len != 0, the behavior is undefined. the seed is selected randomly once per
+ *          process, so the hash value is stable within one process, but it is different between processes.
+ */
+extern size_t _hashtable_hash_bytes(const void* cpv_data, size_t t_len);
+
 /**
  * Get the next prime base the ul_basenum.
  * @param ul_basenum            specifical base number.
@@ -164,6 +197,16 @@ extern unsigned long _hashtable_get_prime(unsigned long ul_basenum);
  */
 extern void _hashtable_init_elem_auxiliary(_hashtable_t* pt_hashtable, _hashnode_t* pt_node);
 
+/**
+ * Initialize the element of new node auxiliary function
+ * @param pt_hashtable          hashtable.
+ * @param pt_node               hashnode.
+ * @return void.
+ * @remarks if pt_hashtable == NULL or pt_node == NULL, then the behavior is undefined. pt_hashtable must be initialized or
+ *          created by _create_hashtable(), and pt_node must be allocated with _t_nodesize, otherwise the behavior is undefined.
+ */
+extern void _hashtable_init_node_auxiliary(_hashtable_t* pt_hashtable, _hashnode_t* pt_node);
+
 /**
  * hash auxiliary
  * @param cpt_hashtable         hashtable.
@@ -189,6 +232,150 @@ extern void _hashtable_hash_auxiliary(const _hashtable_t* cpt_hashtable, const v
 extern void _hashtable_elem_compare_auxiliary(
     const _hashtable_t* cpt_hashtable, const void* cpv_first, const void* cpv_second, void* pv_output);
 
+/**
+ * Element three-way compare function auxiliary
+ * @param cpt_hashtable         hashtable.
+ * @param cpv_first             first element.
+ * @param cpv_second            second element.
+ * @return negative if the first element is less than the second element, positive if it is greater, otherwise zero.
+ * @remarks if cpt_hashtable == NULL, cpv_first == NULL or cpv_second == NULL, then the behavior is undefined. cpt_hashtable
+ *          must be initialized or created by _create_hashtable(), otherwise the behavior is undefined. The three-way compare function
+ *          of element type is invoked once when the hashtable is ordered by the less function of element type,
+ *          otherwise the compare function of hashtable is invoked twice.
+ */
+extern int _hashtable_elem_three_way_compare_auxiliary(
+    const _hashtable_t* cpt_hashtable, const void* cpv_first, const void* cpv_second);
+
+/**
+ * Get the hash code of element in node.
+ * @param cpt_hashtable         hashtable.
+ * @param cpt_node              hashtable node.
+ * @return hash code.
+ * @remarks if cpt_hashtable == NULL or cpt_node == NULL, the behavior is undefined. cpt_hashtable must be initialized,
+ *          otherwise the behavior is undefined. the saved hash code is returned if the hash code is cached in node.
+ */
+extern size_t _hashtable_node_hashcode_auxiliary(const _hashtable_t* cpt_hashtable, const _hashnode_t* cpt_node);
+
+/**
+ * Test the element in node is equal to specific element.
+ * @param cpt_hashtable         hashtable.
+ * @param cpt_node              hashtable node.
+ * @param cpv_value             specific element.
+ * @param t_hashcode            hash code of specific element.
+ * @return true if the two elements are equal, otherwise return false.
+ * @remarks if cpt_hashtable == NULL, cpt_node == NULL or cpv_value == NULL, the behavior is undefined. cpt_hashtable
+ *          must be initialized, otherwise the behavior is undefined. if the hash code is cached in node, the elements
+ *          are not compared when the hash codes are different.
+ */
+extern bool_t _hashtable_node_equal_auxiliary(
+    const _hashtable_t* cpt_hashtable, const _hashnode_t* cpt_node, const void* cpv_value, size_t t_hashcode);
+
+/**
+ * Get the bucket that the element with specific hash value is saved in.
+ * @param cpt_hashtable         hashtable.
+ * @param t_hash                hash value.
+ * @return bucket.
+ * @remarks if cpt_hashtable == NULL, then the behavior is undefined. cpt_hashtable must be initialized, otherwise the
+ *          behavior is undefined. during incremental rehash, the old bucket is returned if it is not moved yet.
+ */
+extern _hashnode_t** _hashtable_get_bucket_auxiliary(const _hashtable_t* cpt_hashtable, size_t t_hash);
+
+/**
+ * Get the first bucket that is not empty after the specific bucket in iteration order.
+ * @param cpt_hashtable         hashtable.
+ * @param ppt_bucket            specific bucket.
+ * @return the first bucket that is not empty, if there is no such bucket, return the end of buckets.
+ * @remarks if cpt_hashtable == NULL, then the behavior is undefined. cpt_hashtable must be initialized, otherwise the
+ *          behavior is undefined. if ppt_bucket == NULL, then search from the first bucket. the old buckets are
+ *          iterated before the new buckets during incremental rehash.
+ */
+extern _hashnode_t** _hashtable_next_bucket_auxiliary(const _hashtable_t* cpt_hashtable, _hashnode_t** ppt_bucket);
+
+/**
+ * Get the last bucket that is not empty before the specific bucket in iteration order.
+ * @param cpt_hashtable         hashtable.
+ * @param ppt_bucket            specific bucket or the end of buckets.
+ * @return the last bucket that is not empty, if there is no such bucket, return NULL.
+ * @remarks if cpt_hashtable == NULL or ppt_bucket == NULL, then the behavior is undefined. cpt_hashtable must be
+ *          initialized, otherwise the behavior is undefined.
+ */
+extern _hashnode_t** _hashtable_prev_bucket_auxiliary(const _hashtable_t* cpt_hashtable, _hashnode_t** ppt_bucket);
+
+/**
+ * Update the occupancy bitmap of bucket after the node list of bucket is changed.
+ * @param pt_hashtable          hashtable.
+ * @param ppt_bucket            bucket or old bucket.
+ * @return void.
+ * @remarks if pt_hashtable == NULL or ppt_bucket == NULL, then the behavior is undefined. pt_hashtable must be
+ *          initialized, otherwise the behavior is undefined. this function must be called when the bucket becomes
+ *          empty or becomes non-empty.
+ */
+extern void _hashtable_update_bucket_auxiliary(_hashtable_t* pt_hashtable, _hashnode_t** ppt_bucket);
+
+/**
+ * Replace the buckets with empty buckets.
+ * @param pt_hashtable          hashtable.
+ * @param t_bucketcount         new bucket count.
+ * @return void.
+ * @remarks if pt_hashtable == NULL, then the behavior is undefined. pt_hashtable must be initialized or created by
+ *          _create_hashtable(), and must not be in incremental rehash, otherwise the behavior is undefined. the nodes in
+ *          buckets are not released, so they must be taken out of buckets before.
+ */
+extern void _hashtable_reset_bucket_auxiliary(_hashtable_t* pt_hashtable, size_t t_bucketcount);
+
+/**
+ * Rehash all elements into specific number of buckets.
+ * @param pt_hashtable          hashtable.
+ * @param t_bucketcount         new bucket count.
+ * @return void.
+ * @remarks if pt_hashtable == NULL, then the behavior is undefined. pt_hashtable must be initialized, otherwise the
+ *          behavior is undefined. the bucket count can be less than current bucket count, and the incremental rehash
+ *          is finished before.
+ */
+extern void _hashtable_rebuild_auxiliary(_hashtable_t* pt_hashtable, size_t t_bucketcount);
+
+/**
+ * Get the least bucket count that holds specific number of elements without exceeding the max load factor.
+ * @param cpt_hashtable     hashtable container.
+ * @param t_elemcount       element count.
+ * @return the least bucket count, it is not adjusted to prime.
+ * @remarks if cpt_hashtable == NULL, then the behavior is undefined.
+ */
+extern size_t _hashtable_get_least_bucket_count_auxiliary(
+    const _hashtable_t* cpt_hashtable, size_t t_elemcount);
+
+/**
+ * Start incremental rehash.
+ * @param pt_hashtable          hashtable.
+ * @param t_bucketcount         the bucket count after rehash.
+ * @return void.
+ * @remarks if pt_hashtable == NULL, then the behavior is undefined. pt_hashtable must be initialized and must not be
+ *          in incremental rehash, otherwise the behavior is undefined. the current buckets become old buckets and the
+ *          elements are not moved, the old buckets take over the storage of bucket vector without copying.
+ */
+extern void _hashtable_rehash_start_auxiliary(_hashtable_t* pt_hashtable, size_t t_bucketcount);
+
+/**
+ * Move old buckets into new buckets.
+ * @param pt_hashtable          hashtable.
+ * @param t_step                the max number of old buckets that are moved.
+ * @return void.
+ * @remarks if pt_hashtable == NULL, then the behavior is undefined. pt_hashtable must be initialized, otherwise the
+ *          behavior is undefined. the old buckets are released when all of them are moved, if the hashtable is not in
+ *          incremental rehash, this function does nothing.
+ */
+extern void _hashtable_rehash_step_auxiliary(_hashtable_t* pt_hashtable, size_t t_step);
+
+/**
+ * Move all elements of one old bucket into new buckets.
+ * @param pt_hashtable          hashtable.
+ * @param t_index               index of old bucket.
+ * @return void.
+ * @remarks if pt_hashtable == NULL, then the behavior is undefined. pt_hashtable must be initialized and must be in
+ *          incremental rehash, t_index must be less than old bucket count, otherwise the behavior is undefined.
+ */
+extern void _hashtable_rehash_bucket_auxiliary(_hashtable_t* pt_hashtable, size_t t_index);
+
 #ifdef __cplusplus
 }
 #endif
@@ -88,7 +88,7 @@ void _hashtable_iterator_get_value(_hashtable_iterator_t it_iter, void* pv_value
     assert(!_hashtable_iterator_equal(it_iter, _hashtable_end(_HASHTABLE_ITERATOR_HASHTABLE(it_iter))));
 
     /* char* */
-    if (strncmp(_GET_HASHTABLE_TYPE_BASENAME(_HASHTABLE_ITERATOR_HASHTABLE(it_iter)), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_HASHTABLE_TYPE_ID(_HASHTABLE_ITERATOR_HASHTABLE(it_iter)) == _TYPE_ID_C_STRING) {
         *(char**)pv_value = (char*)string_c_str((string_t*)((_hashnode_t*)_HASHTABLE_ITERATOR_COREPOS(it_iter))->_pby_data);
     } else {
         bool_t b_result = _GET_HASHTABLE_TYPE_SIZE(_HASHTABLE_ITERATOR_HASHTABLE(it_iter));
@@ -107,7 +107,7 @@ const void* _hashtable_iterator_get_pointer(_hashtable_iterator_t it_iter)
     assert(!_hashtable_iterator_equal(it_iter, _hashtable_end(_HASHTABLE_ITERATOR_HASHTABLE(it_iter))));
 
     /* char* */
-    if (strncmp(_GET_HASHTABLE_TYPE_BASENAME(_HASHTABLE_ITERATOR_HASHTABLE(it_iter)), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_HASHTABLE_TYPE_ID(_HASHTABLE_ITERATOR_HASHTABLE(it_iter)) == _TYPE_ID_C_STRING) {
         return (char*)string_c_str((string_t*)((_hashnode_t*)_HASHTABLE_ITERATOR_COREPOS(it_iter))->_pby_data);
     } else {
         return ((_hashnode_t*)_HASHTABLE_ITERATOR_COREPOS(it_iter))->_pby_data;
@@ -130,42 +130,29 @@ const void* _hashtable_iterator_get_pointer_ignore_cstr(_hashtable_iterator_t it
  */
 _hashtable_iterator_t _hashtable_iterator_prev(_hashtable_iterator_t it_iter)
 {
-    vector_iterator_t it_bucket;
+    _hashnode_t**     ppt_bucket = NULL;
     _hashnode_t*      pt_node = NULL;
     _hashnode_t*      pt_prevnode = NULL;
 
     assert(_hashtable_iterator_belong_to_hashtable(_HASHTABLE_ITERATOR_HASHTABLE(it_iter), it_iter));
     assert(!_hashtable_iterator_equal(it_iter, _hashtable_begin(_HASHTABLE_ITERATOR_HASHTABLE(it_iter))));
 
-    /* hashtable end is specifical condition. corepos == NULL and bucketpos is invalid pos */
-    if (_hashtable_iterator_equal(it_iter, _hashtable_end(_HASHTABLE_ITERATOR_HASHTABLE(it_iter)))) {
-        it_bucket = iterator_prev(vector_end(&_HASHTABLE_ITERATOR_HASHTABLE(it_iter)->_vec_bucket));
-        _HASHTABLE_ITERATOR_BUCKETPOS(it_iter) = _VECTOR_ITERATOR_COREPOS(it_bucket);
-    }
-
     pt_node = (_hashnode_t*)_HASHTABLE_ITERATOR_COREPOS(it_iter);
-    pt_prevnode = *(_hashnode_t**)_HASHTABLE_ITERATOR_BUCKETPOS(it_iter);
-
-    /* current node is first node in current bucket */
-    if (pt_prevnode == pt_node) {
-        it_bucket = vector_begin(&(_HASHTABLE_ITERATOR_HASHTABLE(it_iter)->_vec_bucket));
-        _VECTOR_ITERATOR_COREPOS(it_bucket) = _HASHTABLE_ITERATOR_BUCKETPOS(it_iter);
-        for (it_bucket = iterator_prev(it_bucket);
-             iterator_greater_equal(it_bucket, vector_begin(&(_HASHTABLE_ITERATOR_HASHTABLE(it_iter)->_vec_bucket)));
-             it_bucket = iterator_prev(it_bucket)) {
-            pt_node = *(_hashnode_t**)_VECTOR_ITERATOR_COREPOS(it_bucket);
-            if (pt_node != NULL) {
-                /* get the last hashnode */
-                while (pt_node->_pt_next != NULL) {
-                        pt_node = pt_node->_pt_next;
-                }
-                /* set bucket pos and core pos */
-                _HASHTABLE_ITERATOR_BUCKETPOS(it_iter) = _VECTOR_ITERATOR_COREPOS(it_bucket);
-                _HASHTABLE_ITERATOR_COREPOS(it_iter) = (_byte_t*)pt_node;
-                break;
-            }
+    ppt_bucket = (_hashnode_t**)_HASHTABLE_ITERATOR_BUCKETPOS(it_iter);
+
+    /* hashtable end is specifical condition. corepos == NULL and bucketpos is invalid pos */
+    if (pt_node == NULL || *ppt_bucket == pt_node) {
+        /* current node is first node in current bucket, get the last hashnode in previous bucket */
+        ppt_bucket = _hashtable_prev_bucket_auxiliary(_HASHTABLE_ITERATOR_HASHTABLE(it_iter), ppt_bucket);
+        assert(ppt_bucket != NULL);
+        for (pt_node = *ppt_bucket; pt_node->_pt_next != NULL; pt_node = pt_node->_pt_next) {
+            continue;
         }
+        /* set bucket pos and core pos */
+        _HASHTABLE_ITERATOR_BUCKETPOS(it_iter) = (_byte_t*)ppt_bucket;
+        _HASHTABLE_ITERATOR_COREPOS(it_iter) = (_byte_t*)pt_node;
     } else {
+        pt_prevnode = *ppt_bucket;
         while (pt_prevnode->_pt_next != pt_node) {
             pt_prevnode = pt_prevnode->_pt_next;
         }
@@ -181,8 +168,8 @@ _hashtable_iterator_t _hashtable_iterator_prev(_hashtable_iterator_t it_iter)
  */
 _hashtable_iterator_t _hashtable_iterator_next(_hashtable_iterator_t it_iter)
 {
-    vector_iterator_t it_bucket;
     vector_iterator_t it_end;
+    _hashnode_t**     ppt_bucket = NULL;
     _hashnode_t*      pt_node = NULL;
 
     assert(_hashtable_iterator_belong_to_hashtable(_HASHTABLE_ITERATOR_HASHTABLE(it_iter), it_iter));
@@ -193,23 +180,15 @@ _hashtable_iterator_t _hashtable_iterator_next(_hashtable_iterator_t it_iter)
 
     if (pt_node->_pt_next == NULL) {
         /* iterator from current bucket pos to end */
-        it_bucket = vector_begin(&(_HASHTABLE_ITERATOR_HASHTABLE(it_iter)->_vec_bucket));
-        _VECTOR_ITERATOR_COREPOS(it_bucket) = _HASHTABLE_ITERATOR_BUCKETPOS(it_iter);
+        ppt_bucket = _hashtable_next_bucket_auxiliary(
+            _HASHTABLE_ITERATOR_HASHTABLE(it_iter), (_hashnode_t**)_HASHTABLE_ITERATOR_BUCKETPOS(it_iter));
         it_end = vector_end(&(_HASHTABLE_ITERATOR_HASHTABLE(it_iter)->_vec_bucket));
-        for (it_bucket = iterator_next(it_bucket);
-             !iterator_equal(it_bucket, it_end);
-             it_bucket = iterator_next(it_bucket)) {
-            _HASHTABLE_ITERATOR_BUCKETPOS(it_iter) = _VECTOR_ITERATOR_COREPOS(it_bucket);
-            if (*(_hashnode_t**)_HASHTABLE_ITERATOR_BUCKETPOS(it_iter) != NULL) {
-                _HASHTABLE_ITERATOR_COREPOS(it_iter) = (_byte_t*)(*(_hashnode_t**)_HASHTABLE_ITERATOR_BUCKETPOS(it_iter));
-                break;
-            }
-        }
-        if (iterator_equal(it_bucket, it_end)) {
-            assert((_hashnode_t*)_HASHTABLE_ITERATOR_COREPOS(it_iter) == pt_node);
+        if ((_byte_t*)ppt_bucket == _VECTOR_ITERATOR_COREPOS(it_end)) {
             _HASHTABLE_ITERATOR_COREPOS(it_iter) = NULL;
-            _HASHTABLE_ITERATOR_BUCKETPOS(it_iter) = _VECTOR_ITERATOR_COREPOS(it_bucket);
+        } else {
+            _HASHTABLE_ITERATOR_COREPOS(it_iter) = (_byte_t*)*ppt_bucket;
         }
+        _HASHTABLE_ITERATOR_BUCKETPOS(it_iter) = (_byte_t*)ppt_bucket;
     } else {
         _HASHTABLE_ITERATOR_COREPOS(it_iter) = (_byte_t*)pt_node->_pt_next;
     }
@@ -27,6 +27,7 @@
 #include <cstl/citerator.h>
 #include <cstl/cvector.h>
 #include <cstl/cstring.h>
+#include <cstl/cutility.h>
 
 #include <cstl/cstl_hashtable_iterator.h>
 #include <cstl/cstl_hashtable_private.h>
@@ -67,6 +68,16 @@ bool_t _create_hashtable_auxiliary(_hashtable_t* pt_hashtable, const char* s_typ
     }
 
     pt_hashtable->_t_nodecount = 0;
+    pt_hashtable->_t_nodesize =
+        _HASHTABLE_NODE_SIZE(_GET_HASHTABLE_TYPE_SIZE(pt_hashtable)) + _pair_get_inline_size(&pt_hashtable->_t_typeinfo);
+    pt_hashtable->_pt_bucketmap = NULL;
+    pt_hashtable->_t_firstbucket = 0;
+    pt_hashtable->_f_maxloadfactor = _HASHTABLE_DEFAULT_MAX_LOAD_FACTOR;
+    pt_hashtable->_ppt_oldbucket = NULL;
+    pt_hashtable->_pt_oldbucketmap = NULL;
+    pt_hashtable->_t_oldbucketcount = 0;
+    pt_hashtable->_t_oldbucketcapacity = 0;
+    pt_hashtable->_t_rehashpos = 0;
     pt_hashtable->_ufun_hash = NULL;
     pt_hashtable->_bfun_compare = NULL;
 
@@ -86,6 +97,13 @@ void _hashtable_destroy_auxiliary(_hashtable_t* pt_hashtable)
     /* destroy all elements */
     _hashtable_clear(pt_hashtable);
 
+    /* destroy occupancy bitmap of buckets */
+    if (pt_hashtable->_pt_bucketmap != NULL) {
+        _alloc_deallocate(&pt_hashtable->_t_allocator, pt_hashtable->_pt_bucketmap,
+            sizeof(size_t), _HASHTABLE_BUCKETMAP_WORDS(vector_size(&pt_hashtable->_vec_bucket)));
+        pt_hashtable->_pt_bucketmap = NULL;
+    }
+
     /* destroy bucket vector */
     _vector_destroy_auxiliary(&pt_hashtable->_vec_bucket);
 
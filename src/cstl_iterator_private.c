@@ -334,6 +334,15 @@ const char* _iterator_get_typebasename(iterator_t it_iter)
     return pt_typeinfo != NULL ? pt_typeinfo->_pt_type->_s_typename : NULL;
 }
 
+/**
+ * Get type id of iterator.
+ */
+size_t _iterator_get_typeid(iterator_t it_iter)
+{
+    _typeinfo_t* pt_typeinfo = _iterator_get_typeinfo(it_iter);
+    return pt_typeinfo != NULL ? pt_typeinfo->_pt_type->_t_typeid : _TYPE_ID_INVALID;
+}
+
 /**
  * Get type name of iterator.
  */
@@ -377,6 +386,30 @@ bool_t _iterator_same_elem_type(iterator_t it_first, iterator_t it_second)
            _type_is_same(pt_first->_s_typename, pt_second->_s_typename);
 }
 
+/**
+ * Test whether the element that iterator points to can be relocated in place.
+ */
+bool_t _iterator_elem_is_relocatable(iterator_t it_iter)
+{
+    assert(_iterator_is_valid(it_iter));
+
+    /*
+     * the elements of associative containers are ordered by container, and the basic_string
+     * shares elements between copies, so only the elements of sequence containers are relocated.
+     */
+    switch (it_iter._t_containertype) {
+        case _VECTOR_CONTAINER:
+        case _DEQUE_CONTAINER:
+        case _LIST_CONTAINER:
+        case _SLIST_CONTAINER:
+            return _type_is_relocatable(_iterator_get_typeinfo(it_iter));
+            break;
+        default:
+            return false;
+            break;
+    }
+}
+
 /**
  * Initialize an element according to the type of iterator pointed data.
  */
@@ -191,7 +191,7 @@ void list_init_copy_array(list_t* plist_list, const void* cpv_array, size_t t_co
      * the elements of c builtin array are element itself, but the elements of 
      * c string, user define or cstl are pointer of element.
      */
-    if (strncmp(_GET_LIST_TYPE_BASENAME(plist_list), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_LIST_TYPE_ID(plist_list) == _TYPE_ID_C_STRING) {
         /*
          * We need built a string_t for c string element.
          */
@@ -277,6 +277,20 @@ size_t list_max_size(const list_t* cplist_list)
     return (size_t)(-1) / _GET_LIST_TYPE_SIZE(cplist_list);
 }
 
+/**
+ * Get the memory that is held by the list.
+ */
+size_t list_memory_usage(const list_t* cplist_list)
+{
+    _allocstat_t t_stat;
+
+    assert(cplist_list != NULL);
+    assert(_list_is_inited(cplist_list));
+
+    _alloc_get_stat(&cplist_list->_t_allocator, &t_stat);
+    return sizeof(list_t) + t_stat._t_livesize + t_stat._t_cachedsize;
+}
+
 /**
  * Tests if the two lists are equal.
  */
@@ -461,7 +475,7 @@ void list_assign_array(list_t* plist_list, const void* cpv_array, size_t t_count
      * the elements of c builtin array are element itself, but the elements of 
      * c string, user define or cstl are pointer of element.
      */
-    if (strncmp(_GET_LIST_TYPE_BASENAME(plist_list), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_LIST_TYPE_ID(plist_list) == _TYPE_ID_C_STRING) {
         /*
          * We need built a string_t for c string element.
          */
@@ -683,7 +697,7 @@ void list_insert_array(list_t* plist_list, list_iterator_t it_pos, const void* c
      * the elements of c builtin array are element itself, but the elements of 
      * c string, user define or cstl are pointer of element.
      */
-    if (strncmp(_GET_LIST_TYPE_BASENAME(plist_list), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_LIST_TYPE_ID(plist_list) == _TYPE_ID_C_STRING) {
         /*
          * We need built a string_t for c string element.
          */
@@ -924,7 +938,19 @@ void list_clear(list_t* plist_list)
     assert(plist_list != NULL);
     assert(_list_is_inited(plist_list));
 
-    list_erase_range(plist_list, list_begin(plist_list), list_end(plist_list));
+    if (_alloc_is_region(&plist_list->_t_allocator)) {
+        /* release the whole region and allocate the end node again */
+        if (!_type_is_trivially_destructible(&plist_list->_t_typeinfo)) {
+            list_erase_range(plist_list, list_begin(plist_list), list_end(plist_list));
+        }
+        _alloc_release_region(&plist_list->_t_allocator);
+        plist_list->_pt_node = _alloc_allocate(&plist_list->_t_allocator, _LIST_NODE_SIZE(_GET_LIST_TYPE_SIZE(plist_list)), 1);
+        assert(plist_list->_pt_node != NULL);
+        plist_list->_pt_node->_pt_next = plist_list->_pt_node;
+        plist_list->_pt_node->_pt_prev = plist_list->_pt_node;
+    } else {
+        list_erase_range(plist_list, list_begin(plist_list), list_end(plist_list));
+    }
 }
 
 /**
@@ -1171,6 +1197,56 @@ void list_reverse(list_t* plist_list)
     }
 }
 
+/**
+ * Add element that is pointed by pointer at the end of list container.
+ */
+void list_push_back_ptr(list_t* plist_list, const void* cpv_value)
+{
+    _listnode_t* pt_node = NULL;    /* the insert node */
+
+    assert(plist_list != NULL);
+    assert(_list_is_inited(plist_list));
+    assert(cpv_value != NULL);
+
+    pt_node = _alloc_allocate(&plist_list->_t_allocator, _LIST_NODE_SIZE(_GET_LIST_TYPE_SIZE(plist_list)), 1);
+    assert(pt_node != NULL);
+    /* the trivially copyable element is overwritten entirely, so it need not be initialized */
+    if (!_type_is_trivially_copyable(&plist_list->_t_typeinfo)) {
+        _list_init_node_auxiliary(plist_list, pt_node);
+    }
+    _type_get_ptr_value(&plist_list->_t_typeinfo, cpv_value, pt_node->_pby_data);
+    /* insert the node before the end node */
+    pt_node->_pt_next = plist_list->_pt_node;
+    pt_node->_pt_prev = plist_list->_pt_node->_pt_prev;
+    plist_list->_pt_node->_pt_prev->_pt_next = pt_node;
+    plist_list->_pt_node->_pt_prev = pt_node;
+}
+
+/**
+ * Add element that is pointed by pointer at the begin of list container.
+ */
+void list_push_front_ptr(list_t* plist_list, const void* cpv_value)
+{
+    _listnode_t* pt_node = NULL;    /* the insert node */
+
+    assert(plist_list != NULL);
+    assert(_list_is_inited(plist_list));
+    assert(cpv_value != NULL);
+
+    pt_node = _alloc_allocate(&plist_list->_t_allocator, _LIST_NODE_SIZE(_GET_LIST_TYPE_SIZE(plist_list)), 1);
+    assert(pt_node != NULL);
+    /* the trivially copyable element is overwritten entirely, so it need not be initialized */
+    if (!_type_is_trivially_copyable(&plist_list->_t_typeinfo)) {
+        _list_init_node_auxiliary(plist_list, pt_node);
+    }
+    _type_get_ptr_value(&plist_list->_t_typeinfo, cpv_value, pt_node->_pby_data);
+    /* insert the node into the first position */
+    pt_node->_pt_next = plist_list->_pt_node->_pt_next;
+    pt_node->_pt_prev = plist_list->_pt_node;
+    plist_list->_pt_node->_pt_next->_pt_prev = pt_node;
+    plist_list->_pt_node->_pt_next = pt_node;
+}
+
 /** local function implementation section **/
 
 /** eof **/
@@ -263,7 +263,7 @@ void _list_quick_sort(list_t* plist_list, _listnode_t* pt_first, _listnode_t* pt
             _list_quick_sort(plist_list, pt_pivot->_pt_next, pt_afterlast->_pt_prev, NULL);
         }
     } else {
-        if (strncmp(_GET_LIST_TYPE_BASENAME(plist_list), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+        if (_GET_LIST_TYPE_ID(plist_list) == _TYPE_ID_C_STRING) {
             pt_beforefirst = pt_first->_pt_prev;
             pt_afterlast = pt_last->_pt_next;
             for (pt_pivot = pt_last, pt_before = pt_first->_pt_prev, pt_after = pt_first;
@@ -67,7 +67,7 @@ void _list_iterator_get_value(list_iterator_t it_iter, void* pv_value)
     assert(!iterator_equal(it_iter, list_end(_LIST_ITERATOR_CONTAINER(it_iter))));
 
     /* char* */
-    if (strncmp(_GET_LIST_TYPE_BASENAME(_LIST_ITERATOR_CONTAINER(it_iter)), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_LIST_TYPE_ID(_LIST_ITERATOR_CONTAINER(it_iter)) == _TYPE_ID_C_STRING) {
         *(char**)pv_value = (char*)string_c_str((string_t*)((_listnode_t*)_LIST_ITERATOR_COREPOS(it_iter))->_pby_data);
     } else {
         bool_t b_result = _GET_LIST_TYPE_SIZE(_LIST_ITERATOR_CONTAINER(it_iter));
@@ -87,7 +87,7 @@ void _list_iterator_set_value(list_iterator_t it_iter, const void* cpv_value)
     assert(!iterator_equal(it_iter, list_end(_LIST_ITERATOR_CONTAINER(it_iter))));
 
     /* char* */
-    if (strncmp(_GET_LIST_TYPE_BASENAME(_LIST_ITERATOR_CONTAINER(it_iter)), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_LIST_TYPE_ID(_LIST_ITERATOR_CONTAINER(it_iter)) == _TYPE_ID_C_STRING) {
         string_assign_cstr((string_t*)((_listnode_t*)_LIST_ITERATOR_COREPOS(it_iter))->_pby_data, (char*)cpv_value);
     } else {
         bool_t b_result = _GET_LIST_TYPE_SIZE(_LIST_ITERATOR_CONTAINER(it_iter));
@@ -106,7 +106,7 @@ const void* _list_iterator_get_pointer(list_iterator_t it_iter)
     assert(!iterator_equal(it_iter, list_end(_LIST_ITERATOR_CONTAINER(it_iter))));
 
     /* char* */
-    if (strncmp(_GET_LIST_TYPE_BASENAME(_LIST_ITERATOR_CONTAINER(it_iter)), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_LIST_TYPE_ID(_LIST_ITERATOR_CONTAINER(it_iter)) == _TYPE_ID_C_STRING) {
         return string_c_str((string_t*)((_listnode_t*)_LIST_ITERATOR_COREPOS(it_iter))->_pby_data);
     } else {
         return ((_listnode_t*)_LIST_ITERATOR_COREPOS(it_iter))->_pby_data;
@@ -63,6 +63,36 @@ list_t* _create_list(const char* s_typename)
     return plist_new;
 }
 
+/**
+ * Create list container that uses user defined allocator.
+ */
+list_t* _create_list_with_allocator(const allocator_t* cpt_allocator, const char* s_typename)
+{
+    list_t* plist_list = NULL;
+
+    assert(cpt_allocator != NULL);
+
+    if ((plist_list = _create_list(s_typename)) != NULL) {
+        _alloc_set_allocator(&plist_list->_t_allocator, cpt_allocator);
+    }
+
+    return plist_list;
+}
+
+/**
+ * Create list container that allocates memory from region.
+ */
+list_t* _create_list_with_region(const char* s_typename)
+{
+    list_t* plist_list = NULL;
+
+    if ((plist_list = _create_list(s_typename)) != NULL) {
+        _alloc_set_region(&plist_list->_t_allocator);
+    }
+
+    return plist_list;
+}
+
 /**
  * Create list container auxiliary function.
  */
@@ -168,6 +198,12 @@ void _list_destroy_auxiliary(list_t* plist_list)
     assert(_list_is_inited(plist_list) || _list_is_created(plist_list));
 
     if (plist_list->_pt_node != NULL) {
+        /* the elements in region that need not be destroyed are released with the region at once */
+        if (_alloc_is_region(&plist_list->_t_allocator) && _type_is_trivially_destructible(&plist_list->_t_typeinfo)) {
+            plist_list->_pt_node->_pt_next = plist_list->_pt_node;
+            plist_list->_pt_node->_pt_prev = plist_list->_pt_node;
+        }
+
         pt_node = plist_list->_pt_node->_pt_next;
         /* destroy all element and node except the end node */
         while (pt_node != plist_list->_pt_node) {
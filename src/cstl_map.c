@@ -29,8 +29,11 @@
 #include <cstl/cmap.h>
 
 #include "cstl_map_aux.h"
+#include "cstl_pair_aux.h"
 
 /** local constant declaration and local macro section **/
+/* the number of keys that are passed to the tree together in batch find */
+#define _MAP_FIND_BATCH_COUNT 16
 
 /** local data type declaration and local struct, union, enum section **/
 
@@ -246,6 +249,27 @@ size_t map_max_size(const map_t* cpmap_map)
 #endif
 }
 
+/**
+ * Get the memory that is held by the map.
+ */
+size_t map_memory_usage(const map_t* cpmap_map)
+{
+    size_t t_usage = 0;
+
+    assert(cpmap_map != NULL);
+    assert(_pair_is_inited(&cpmap_map->_pair_temp));
+
+#ifdef CSTL_MAP_AVL_TREE
+    t_usage = _avl_tree_memory_usage(&cpmap_map->_t_tree);
+#else
+    t_usage = _rb_tree_memory_usage(&cpmap_map->_t_tree);
+#endif
+    /* the key and value of pair elements are stored inline in the nodes, only the temporary pair has a separate block */
+    t_usage += _PAIR_STORAGE_SIZE(_GET_MAP_FIRST_TYPE_SIZE(cpmap_map), _GET_MAP_SECOND_TYPE_SIZE(cpmap_map));
+
+    return sizeof(map_t) + t_usage;
+}
+
 /**
  * Return the compare function of key.
  */
@@ -625,6 +649,155 @@ void map_erase_range(map_t* pmap_map, map_iterator_t it_begin, map_iterator_t it
 #endif
 }
 
+/**
+ * Find specific element by the key that is pointed by pointer.
+ */
+map_iterator_t map_find_ptr(const map_t* cpmap_map, const void* cpv_key)
+{
+    map_iterator_t it_iter;
+    _pairkey_t t_key;
+
+    assert(cpmap_map != NULL);
+    assert(cpv_key != NULL);
+    assert(_pair_is_inited(&cpmap_map->_pair_temp));
+
+    /* the key is made on the stack, so that the lookup does not modify map */
+    _pair_key_init_ptr(&t_key, &cpmap_map->_pair_temp, cpv_key);
+#ifdef CSTL_MAP_AVL_TREE
+    it_iter = _avl_tree_find(&cpmap_map->_t_tree, &t_key._pair_key);
+#else
+    it_iter = _rb_tree_find(&cpmap_map->_t_tree, &t_key._pair_key);
+#endif
+    _pair_key_destroy(&t_key);
+
+    _ITERATOR_CONTAINER(it_iter) = (map_t*)cpmap_map;
+    _MAP_ITERATOR_CONTAINER_TYPE(it_iter) = _MAP_CONTAINER;
+    _MAP_ITERATOR_ITERATOR_TYPE(it_iter) = _BIDIRECTIONAL_ITERATOR;
+
+    return it_iter;
+}
+
+/**
+ * Return the number of elements whose key is pointed by pointer.
+ */
+size_t map_count_ptr(const map_t* cpmap_map, const void* cpv_key)
+{
+    size_t     t_count = 0;
+    _pairkey_t t_key;
+
+    assert(cpmap_map != NULL);
+    assert(cpv_key != NULL);
+    assert(_pair_is_inited(&cpmap_map->_pair_temp));
+
+    /* the key is made on the stack, so that the lookup does not modify map */
+    _pair_key_init_ptr(&t_key, &cpmap_map->_pair_temp, cpv_key);
+#ifdef CSTL_MAP_AVL_TREE
+    t_count = _avl_tree_count(&cpmap_map->_t_tree, &t_key._pair_key);
+#else
+    t_count = _rb_tree_count(&cpmap_map->_t_tree, &t_key._pair_key);
+#endif
+    _pair_key_destroy(&t_key);
+
+    return t_count;
+}
+
+/**
+ * Find a batch of elements by the keys in array.
+ */
+void map_find_batch(const map_t* cpmap_map, const void* cpv_keys, size_t t_count, map_iterator_t* pit_result)
+{
+    _pairkey_t  at_key[_MAP_FIND_BATCH_COUNT];
+    const void* acpv_key[_MAP_FIND_BATCH_COUNT];
+    const void* cpv_key = NULL;
+    size_t      t_batch = 0;
+    size_t      i = 0;
+    size_t      j = 0;
+
+    assert(cpmap_map != NULL);
+    assert(cpv_keys != NULL);
+    assert(pit_result != NULL);
+    assert(_pair_is_inited(&cpmap_map->_pair_temp));
+
+    for (i = 0; i < t_count; i += t_batch) {
+        t_batch = t_count - i < _MAP_FIND_BATCH_COUNT ? t_count - i : _MAP_FIND_BATCH_COUNT;
+
+        /* the keys are made on the stack, so that the lookup does not modify map */
+        for (j = 0; j < t_batch; ++j) {
+            if (_GET_MAP_FIRST_TYPE_STYLE(cpmap_map) == _TYPE_C_BUILTIN &&
+                _GET_MAP_FIRST_TYPE_ID(cpmap_map) != _TYPE_ID_C_STRING) {
+                cpv_key = (const _byte_t*)cpv_keys + (i + j) * _GET_MAP_FIRST_TYPE_SIZE(cpmap_map);
+            } else {
+                cpv_key = *((void**)cpv_keys + i + j);
+            }
+            assert(cpv_key != NULL);
+            _pair_key_init_ptr(&at_key[j], &cpmap_map->_pair_temp, cpv_key);
+            acpv_key[j] = &at_key[j]._pair_key;
+        }
+
+#ifdef CSTL_MAP_AVL_TREE
+        _avl_tree_find_batch(&cpmap_map->_t_tree, acpv_key, t_batch, pit_result + i);
+#else
+        _rb_tree_find_batch(&cpmap_map->_t_tree, acpv_key, t_batch, pit_result + i);
+#endif
+        for (j = 0; j < t_batch; ++j) {
+            _pair_key_destroy(&at_key[j]);
+            _ITERATOR_CONTAINER(pit_result[i + j]) = (map_t*)cpmap_map;
+            _MAP_ITERATOR_CONTAINER_TYPE(pit_result[i + j]) = _MAP_CONTAINER;
+            _MAP_ITERATOR_ITERATOR_TYPE(pit_result[i + j]) = _BIDIRECTIONAL_ITERATOR;
+        }
+    }
+}
+
+/**
+ * Erase the elements whose key is pointed by pointer.
+ */
+size_t map_erase_ptr(map_t* pmap_map, const void* cpv_key)
+{
+    assert(pmap_map != NULL);
+    assert(cpv_key != NULL);
+    assert(_pair_is_inited(&pmap_map->_pair_temp));
+
+    _type_get_ptr_value(&pmap_map->_pair_temp._t_typeinfofirst, cpv_key, pmap_map->_pair_temp._pv_first);
+#ifdef CSTL_MAP_AVL_TREE
+    return _avl_tree_erase(&pmap_map->_t_tree, &pmap_map->_pair_temp);
+#else
+    return _rb_tree_erase(&pmap_map->_t_tree, &pmap_map->_pair_temp);
+#endif
+}
+
+/**
+ * Access an element by the key that is pointed by pointer.
+ */
+void* map_at_ptr(map_t* pmap_map, const void* cpv_key)
+{
+    map_iterator_t it_iter;
+
+    assert(pmap_map != NULL);
+    assert(cpv_key != NULL);
+    assert(_pair_is_inited(&pmap_map->_pair_temp));
+
+    _type_get_ptr_value(&pmap_map->_pair_temp._t_typeinfofirst, cpv_key, pmap_map->_pair_temp._pv_first);
+#ifdef CSTL_MAP_AVL_TREE
+    it_iter = _avl_tree_insert_unique(&pmap_map->_t_tree, &pmap_map->_pair_temp);
+#else
+    it_iter = _rb_tree_insert_unique(&pmap_map->_t_tree, &pmap_map->_pair_temp);
+#endif
+    _ITERATOR_CONTAINER(it_iter) = pmap_map;
+    _MAP_ITERATOR_CONTAINER_TYPE(it_iter) = _MAP_CONTAINER;
+    _MAP_ITERATOR_ITERATOR_TYPE(it_iter) = _BIDIRECTIONAL_ITERATOR;
+
+    if (iterator_equal(it_iter, map_end(pmap_map))) {
+        it_iter = map_find_ptr(pmap_map, cpv_key);
+    }
+
+    /* char* */
+    if (_GET_MAP_SECOND_TYPE_ID(pmap_map) == _TYPE_ID_C_STRING) {
+        return (char*)string_c_str((string_t*)((pair_t*)iterator_get_pointer(it_iter))->_pv_second);
+    } else {
+        return ((pair_t*)iterator_get_pointer(it_iter))->_pv_second;
+    }
+}
+
 /** local function implementation section **/
 
 /** eof **/
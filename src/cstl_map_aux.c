@@ -29,6 +29,9 @@
 #include <cstl/cmap.h>
 
 #include "cstl_map_aux.h"
+#include "cstl_multimap_aux.h"
+#include "cstl_hash_map_aux.h"
+#include "cstl_hash_multimap_aux.h"
 
 /** local constant declaration and local macro section **/
 
@@ -111,6 +114,36 @@ void _map_value_compare(const void* cpv_first, const void* cpv_second, void* pv_
     }
 }
 
+/**
+ * Three-way compare the keys of map pairs.
+ */
+bool_t _map_key_three_way_compare(bfun_t bfun_compare, const void* cpv_first, const void* cpv_second, int* pn_result)
+{
+    pair_t* ppair_first = NULL;
+    pair_t* ppair_second = NULL;
+
+    assert(bfun_compare != NULL);
+    assert(cpv_first != NULL);
+    assert(cpv_second != NULL);
+    assert(pn_result != NULL);
+
+    if (bfun_compare != _map_value_compare && bfun_compare != _multimap_value_compare &&
+        bfun_compare != _hash_map_value_compare && bfun_compare != _hash_multimap_value_compare) {
+        return false;
+    }
+
+    ppair_first = (pair_t*)cpv_first;
+    ppair_second = (pair_t*)cpv_second;
+
+    /* the value compare of map containers is the less of key type when there is no user define key compare */
+    if (ppair_first->_bfun_mapkeycompare != NULL || ppair_first->_t_typeinfofirst._pt_type->_t_typecompare == NULL) {
+        return false;
+    }
+
+    ppair_first->_t_typeinfofirst._pt_type->_t_typecompare(ppair_first->_pv_first, ppair_second->_pv_first, pn_result);
+    return true;
+}
+
 /** local function implementation section **/
 
 /** eof **/
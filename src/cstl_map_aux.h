@@ -34,6 +34,7 @@ extern "C" {
 #define _GET_MAP_FIRST_TYPE_SIZE(pmap_map)              ((pmap_map)->_pair_temp._t_typeinfofirst._pt_type->_t_typesize)
 #define _GET_MAP_FIRST_TYPE_NAME(pmap_map)              ((pmap_map)->_pair_temp._t_typeinfofirst._s_typename)
 #define _GET_MAP_FIRST_TYPE_BASENAME(pmap_map)          ((pmap_map)->_pair_temp._t_typeinfofirst._pt_type->_s_typename)
+#define _GET_MAP_FIRST_TYPE_ID(pmap_map)                ((pmap_map)->_pair_temp._t_typeinfofirst._pt_type->_t_typeid)
 #define _GET_MAP_FIRST_TYPE_INIT_FUNCTION(pmap_map)     ((pmap_map)->_pair_temp._t_typeinfofirst._pt_type->_t_typeinit)
 #define _GET_MAP_FIRST_TYPE_COPY_FUNCTION(pmap_map)     ((pmap_map)->_pair_temp._t_typeinfofirst._pt_type->_t_typecopy)
 #define _GET_MAP_FIRST_TYPE_LESS_FUNCTION(pmap_map)     ((pmap_map)->_pair_temp._t_typeinfofirst._pt_type->_t_typeless)
@@ -43,6 +44,7 @@ extern "C" {
 #define _GET_MAP_SECOND_TYPE_SIZE(pmap_map)             ((pmap_map)->_pair_temp._t_typeinfosecond._pt_type->_t_typesize)
 #define _GET_MAP_SECOND_TYPE_NAME(pmap_map)             ((pmap_map)->_pair_temp._t_typeinfosecond._s_typename)
 #define _GET_MAP_SECOND_TYPE_BASENAME(pmap_map)         ((pmap_map)->_pair_temp._t_typeinfosecond._pt_type->_s_typename)
+#define _GET_MAP_SECOND_TYPE_ID(pmap_map)               ((pmap_map)->_pair_temp._t_typeinfosecond._pt_type->_t_typeid)
 #define _GET_MAP_SECOND_TYPE_INIT_FUNCTION(pmap_map)    ((pmap_map)->_pair_temp._t_typeinfosecond._pt_type->_t_typeinit)
 #define _GET_MAP_SECOND_TYPE_COPY_FUNCTION(pmap_map)    ((pmap_map)->_pair_temp._t_typeinfosecond._pt_type->_t_typecopy)
 #define _GET_MAP_SECOND_TYPE_LESS_FUNCTION(pmap_map)    ((pmap_map)->_pair_temp._t_typeinfosecond._pt_type->_t_typeless)
@@ -84,6 +86,19 @@ extern bool_t _map_same_pair_type_ex(const pair_t* cppair_first, const pair_t* c
  */
 extern void _map_value_compare(const void* cpv_first, const void* cpv_second, void* pv_output);
 
+/**
+ * Three-way compare the keys of map pairs.
+ * @param bfun_compare      compare function of container.
+ * @param cpv_first         frist pair.
+ * @param cpv_second        second pair.
+ * @param pn_result         output, negative, zero or positive as the key of first is less, equal or greater.
+ * @return true if the keys are compared, otherwise return false.
+ * @remark if bfun_compare == NULL or cpv_first == NULL or cpv_second == NULL or pn_result == NULL, then the behavior
+ *         is undefined. the keys are compared only when bfun_compare is the value compare of map, multimap, hash_map
+ *         or hash_multimap, the key compare is the less of key type and the key type has three-way compare.
+ */
+extern bool_t _map_key_three_way_compare(bfun_t bfun_compare, const void* cpv_first, const void* cpv_second, int* pn_result);
+
 #ifdef __cplusplus
 }
 #endif
@@ -29,6 +29,7 @@
 #include <cstl/cmap.h>
 
 #include "cstl_map_aux.h"
+#include "cstl_pair_aux.h"
 
 /** local constant declaration and local macro section **/
 
@@ -60,6 +61,36 @@ map_t* _create_map(const char* s_typename)
     return pmap_map;
 }
 
+/**
+ * Create map container that uses user defined allocator.
+ */
+map_t* _create_map_with_allocator(const allocator_t* cpt_allocator, const char* s_typename)
+{
+    map_t* pmap_map = NULL;
+
+    assert(cpt_allocator != NULL);
+
+    if ((pmap_map = _create_map(s_typename)) != NULL) {
+        _alloc_set_allocator(&pmap_map->_t_tree._t_allocator, cpt_allocator);
+    }
+
+    return pmap_map;
+}
+
+/**
+ * Create map container that allocates memory from region.
+ */
+map_t* _create_map_with_region(const char* s_typename)
+{
+    map_t* pmap_map = NULL;
+
+    if ((pmap_map = _create_map(s_typename)) != NULL) {
+        _alloc_set_region(&pmap_map->_t_tree._t_allocator);
+    }
+
+    return pmap_map;
+}
+
 /**
  * Create map container auxiliary function.
  */
@@ -133,18 +164,21 @@ map_iterator_t _map_find(const map_t* cpmap_map, ...)
 map_iterator_t _map_find_varg(const map_t* cpmap_map, va_list val_elemlist)
 {
     map_iterator_t it_iter;
+    _pairkey_t t_key;
 
     assert(cpmap_map != NULL);
     assert(_pair_is_inited(&cpmap_map->_pair_temp));
 
     /* get key */
-    _type_get_varg_value(&((map_t*)cpmap_map)->_pair_temp._t_typeinfofirst, val_elemlist, cpmap_map->_pair_temp._pv_first);
+    /* the key is made on the stack, so that the lookup does not modify map */
+    _pair_key_init_varg(&t_key, &cpmap_map->_pair_temp, val_elemlist);
     /* find key in tree */
 #ifdef CSTL_MAP_AVL_TREE
-    it_iter = _avl_tree_find(&cpmap_map->_t_tree, &cpmap_map->_pair_temp);
+    it_iter = _avl_tree_find(&cpmap_map->_t_tree, &t_key._pair_key);
 #else
-    it_iter = _rb_tree_find(&cpmap_map->_t_tree, &cpmap_map->_pair_temp);
+    it_iter = _rb_tree_find(&cpmap_map->_t_tree, &t_key._pair_key);
 #endif
+    _pair_key_destroy(&t_key);
 
     _ITERATOR_CONTAINER(it_iter) = (map_t*)cpmap_map;
     _MAP_ITERATOR_CONTAINER_TYPE(it_iter) = _MAP_CONTAINER;
@@ -173,15 +207,22 @@ size_t _map_count(const map_t* cpmap_map, ...)
  */
 size_t _map_count_varg(const map_t* cpmap_map, va_list val_elemlist)
 {
+    size_t     t_count = 0;
+    _pairkey_t t_key;
+
     assert(cpmap_map != NULL);
     assert(_pair_is_inited(&cpmap_map->_pair_temp));
 
-    _type_get_varg_value(&((map_t*)cpmap_map)->_pair_temp._t_typeinfofirst, val_elemlist, cpmap_map->_pair_temp._pv_first);
+    /* the key is made on the stack, so that the lookup does not modify map */
+    _pair_key_init_varg(&t_key, &cpmap_map->_pair_temp, val_elemlist);
 #ifdef CSTL_MAP_AVL_TREE
-    return _avl_tree_count(&cpmap_map->_t_tree, &cpmap_map->_pair_temp);
+    t_count = _avl_tree_count(&cpmap_map->_t_tree, &t_key._pair_key);
 #else
-    return _rb_tree_count(&cpmap_map->_t_tree, &cpmap_map->_pair_temp);
+    t_count = _rb_tree_count(&cpmap_map->_t_tree, &t_key._pair_key);
 #endif
+    _pair_key_destroy(&t_key);
+
+    return t_count;
 }
 
 /**
@@ -205,16 +246,19 @@ map_iterator_t _map_lower_bound(const map_t* cpmap_map, ...)
 map_iterator_t _map_lower_bound_varg(const map_t* cpmap_map, va_list val_elemlist)
 {
     map_iterator_t it_iter;
+    _pairkey_t t_key;
 
     assert(cpmap_map != NULL);
     assert(_pair_is_inited(&cpmap_map->_pair_temp));
 
-    _type_get_varg_value(&((map_t*)cpmap_map)->_pair_temp._t_typeinfofirst, val_elemlist, cpmap_map->_pair_temp._pv_first);
+    /* the key is made on the stack, so that the lookup does not modify map */
+    _pair_key_init_varg(&t_key, &cpmap_map->_pair_temp, val_elemlist);
 #ifdef CSTL_MAP_AVL_TREE
-    it_iter = _avl_tree_lower_bound(&cpmap_map->_t_tree, &cpmap_map->_pair_temp);
+    it_iter = _avl_tree_lower_bound(&cpmap_map->_t_tree, &t_key._pair_key);
 #else
-    it_iter = _rb_tree_lower_bound(&cpmap_map->_t_tree, &cpmap_map->_pair_temp);
+    it_iter = _rb_tree_lower_bound(&cpmap_map->_t_tree, &t_key._pair_key);
 #endif
+    _pair_key_destroy(&t_key);
 
     _ITERATOR_CONTAINER(it_iter) = (map_t*)cpmap_map;
     _MAP_ITERATOR_CONTAINER_TYPE(it_iter) = _MAP_CONTAINER;
@@ -244,16 +288,19 @@ map_iterator_t _map_upper_bound(const map_t* cpmap_map, ...)
 map_iterator_t _map_upper_bound_varg(const map_t* cpmap_map, va_list val_elemlist)
 {
     map_iterator_t it_iter;
+    _pairkey_t t_key;
 
     assert(cpmap_map != NULL);
     assert(_pair_is_inited(&cpmap_map->_pair_temp));
 
-    _type_get_varg_value(&((map_t*)cpmap_map)->_pair_temp._t_typeinfofirst, val_elemlist, cpmap_map->_pair_temp._pv_first);
+    /* the key is made on the stack, so that the lookup does not modify map */
+    _pair_key_init_varg(&t_key, &cpmap_map->_pair_temp, val_elemlist);
 #ifdef CSTL_MAP_AVL_TREE
-    it_iter = _avl_tree_upper_bound(&cpmap_map->_t_tree, &cpmap_map->_pair_temp);
+    it_iter = _avl_tree_upper_bound(&cpmap_map->_t_tree, &t_key._pair_key);
 #else
-    it_iter = _rb_tree_upper_bound(&cpmap_map->_t_tree, &cpmap_map->_pair_temp);
+    it_iter = _rb_tree_upper_bound(&cpmap_map->_t_tree, &t_key._pair_key);
 #endif
+    _pair_key_destroy(&t_key);
 
     _ITERATOR_CONTAINER(it_iter) = (map_t*)cpmap_map;
     _MAP_ITERATOR_CONTAINER_TYPE(it_iter) = _MAP_CONTAINER;
@@ -283,16 +330,19 @@ range_t _map_equal_range(const map_t* cpmap_map, ...)
 range_t _map_equal_range_varg(const map_t* cpmap_map, va_list val_elemlist)
 {
     range_t r_range;
+    _pairkey_t t_key;
 
     assert(cpmap_map != NULL);
     assert(_pair_is_inited(&cpmap_map->_pair_temp));
 
-    _type_get_varg_value(&((map_t*)cpmap_map)->_pair_temp._t_typeinfofirst, val_elemlist, cpmap_map->_pair_temp._pv_first);
+    /* the key is made on the stack, so that the lookup does not modify map */
+    _pair_key_init_varg(&t_key, &cpmap_map->_pair_temp, val_elemlist);
 #ifdef CSTL_MAP_AVL_TREE
-    r_range = _avl_tree_equal_range(&cpmap_map->_t_tree, &cpmap_map->_pair_temp);
+    r_range = _avl_tree_equal_range(&cpmap_map->_t_tree, &t_key._pair_key);
 #else
-    r_range = _rb_tree_equal_range(&cpmap_map->_t_tree, &cpmap_map->_pair_temp);
+    r_range = _rb_tree_equal_range(&cpmap_map->_t_tree, &t_key._pair_key);
 #endif
+    _pair_key_destroy(&t_key);
 
     _ITERATOR_CONTAINER(r_range.it_begin) = (map_t*)cpmap_map;
     _MAP_ITERATOR_CONTAINER_TYPE(r_range.it_begin) = _MAP_CONTAINER;
@@ -381,7 +431,7 @@ void* _map_at_varg(map_t* pmap_map, va_list val_elemlist)
     va_end(val_elemlist_copy);
 
     /* char* */
-    if (strncmp(_GET_MAP_SECOND_TYPE_BASENAME(pmap_map), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_MAP_SECOND_TYPE_ID(pmap_map) == _TYPE_ID_C_STRING) {
         return (char*)string_c_str((string_t*)((pair_t*)iterator_get_pointer(it_iter))->_pv_second);
     } else {
         return ((pair_t*)iterator_get_pointer(it_iter))->_pv_second;
@@ -29,6 +29,7 @@
 #include <cstl/cmap.h>
 
 #include "cstl_multimap_aux.h"
+#include "cstl_pair_aux.h"
 
 /** local constant declaration and local macro section **/
 
@@ -246,6 +247,27 @@ size_t multimap_max_size(const multimap_t* cpmmap_map)
 #endif
 }
 
+/**
+ * Get the memory that is held by the multimap.
+ */
+size_t multimap_memory_usage(const multimap_t* cpmmap_map)
+{
+    size_t t_usage = 0;
+
+    assert(cpmmap_map != NULL);
+    assert(_pair_is_inited(&cpmmap_map->_pair_temp));
+
+#ifdef CSTL_MULTIMAP_AVL_TREE
+    t_usage = _avl_tree_memory_usage(&cpmmap_map->_t_tree);
+#else
+    t_usage = _rb_tree_memory_usage(&cpmmap_map->_t_tree);
+#endif
+    /* the key and value of pair elements are stored inline in the nodes, only the temporary pair has a separate block */
+    t_usage += _PAIR_STORAGE_SIZE(_GET_MULTIMAP_FIRST_TYPE_SIZE(cpmmap_map), _GET_MULTIMAP_SECOND_TYPE_SIZE(cpmmap_map));
+
+    return sizeof(multimap_t) + t_usage;
+}
+
 /**
  * Return the compare function of key.
  */
@@ -622,6 +644,75 @@ void multimap_erase_range(multimap_t* pmmap_map, multimap_iterator_t it_begin, m
 #endif
 }
 
+/**
+ * Find specific element by the key that is pointed by pointer.
+ */
+multimap_iterator_t multimap_find_ptr(const multimap_t* cpmmap_map, const void* cpv_key)
+{
+    multimap_iterator_t it_iter;
+    _pairkey_t t_key;
+
+    assert(cpmmap_map != NULL);
+    assert(cpv_key != NULL);
+    assert(_pair_is_inited(&cpmmap_map->_pair_temp));
+
+    /* the key is made on the stack, so that the lookup does not modify map */
+    _pair_key_init_ptr(&t_key, &cpmmap_map->_pair_temp, cpv_key);
+#ifdef CSTL_MULTIMAP_AVL_TREE
+    it_iter = _avl_tree_find(&cpmmap_map->_t_tree, &t_key._pair_key);
+#else
+    it_iter = _rb_tree_find(&cpmmap_map->_t_tree, &t_key._pair_key);
+#endif
+    _pair_key_destroy(&t_key);
+
+    _ITERATOR_CONTAINER(it_iter) = (multimap_t*)cpmmap_map;
+    _MULTIMAP_ITERATOR_CONTAINER_TYPE(it_iter) = _MULTIMAP_CONTAINER;
+    _MULTIMAP_ITERATOR_ITERATOR_TYPE(it_iter) = _BIDIRECTIONAL_ITERATOR;
+
+    return it_iter;
+}
+
+/**
+ * Return the number of elements whose key is pointed by pointer.
+ */
+size_t multimap_count_ptr(const multimap_t* cpmmap_map, const void* cpv_key)
+{
+    size_t     t_count = 0;
+    _pairkey_t t_key;
+
+    assert(cpmmap_map != NULL);
+    assert(cpv_key != NULL);
+    assert(_pair_is_inited(&cpmmap_map->_pair_temp));
+
+    /* the key is made on the stack, so that the lookup does not modify map */
+    _pair_key_init_ptr(&t_key, &cpmmap_map->_pair_temp, cpv_key);
+#ifdef CSTL_MULTIMAP_AVL_TREE
+    t_count = _avl_tree_count(&cpmmap_map->_t_tree, &t_key._pair_key);
+#else
+    t_count = _rb_tree_count(&cpmmap_map->_t_tree, &t_key._pair_key);
+#endif
+    _pair_key_destroy(&t_key);
+
+    return t_count;
+}
+
+/**
+ * Erase the elements whose key is pointed by pointer.
+ */
+size_t multimap_erase_ptr(multimap_t* pmmap_map, const void* cpv_key)
+{
+    assert(pmmap_map != NULL);
+    assert(cpv_key != NULL);
+    assert(_pair_is_inited(&pmmap_map->_pair_temp));
+
+    _type_get_ptr_value(&pmmap_map->_pair_temp._t_typeinfofirst, cpv_key, pmmap_map->_pair_temp._pv_first);
+#ifdef CSTL_MULTIMAP_AVL_TREE
+    return _avl_tree_erase(&pmmap_map->_t_tree, &pmmap_map->_pair_temp);
+#else
+    return _rb_tree_erase(&pmmap_map->_t_tree, &pmmap_map->_pair_temp);
+#endif
+}
+
 /** local function implementation section **/
 
 /** eof **/
@@ -34,6 +34,7 @@ extern "C" {
 #define _GET_MULTIMAP_FIRST_TYPE_SIZE(pmmap_map)              ((pmmap_map)->_pair_temp._t_typeinfofirst._pt_type->_t_typesize)
 #define _GET_MULTIMAP_FIRST_TYPE_NAME(pmmap_map)              ((pmmap_map)->_pair_temp._t_typeinfofirst._s_typename)
 #define _GET_MULTIMAP_FIRST_TYPE_BASENAME(pmmap_map)          ((pmmap_map)->_pair_temp._t_typeinfofirst._pt_type->_s_typename)
+#define _GET_MULTIMAP_FIRST_TYPE_ID(pmmap_map)                ((pmmap_map)->_pair_temp._t_typeinfofirst._pt_type->_t_typeid)
 #define _GET_MULTIMAP_FIRST_TYPE_INIT_FUNCTION(pmmap_map)     ((pmmap_map)->_pair_temp._t_typeinfofirst._pt_type->_t_typeinit)
 #define _GET_MULTIMAP_FIRST_TYPE_COPY_FUNCTION(pmmap_map)     ((pmmap_map)->_pair_temp._t_typeinfofirst._pt_type->_t_typecopy)
 #define _GET_MULTIMAP_FIRST_TYPE_LESS_FUNCTION(pmmap_map)     ((pmmap_map)->_pair_temp._t_typeinfofirst._pt_type->_t_typeless)
@@ -43,6 +44,7 @@ extern "C" {
 #define _GET_MULTIMAP_SECOND_TYPE_SIZE(pmmap_map)             ((pmmap_map)->_pair_temp._t_typeinfosecond._pt_type->_t_typesize)
 #define _GET_MULTIMAP_SECOND_TYPE_NAME(pmmap_map)             ((pmmap_map)->_pair_temp._t_typeinfosecond._s_typename)
 #define _GET_MULTIMAP_SECOND_TYPE_BASENAME(pmmap_map)         ((pmmap_map)->_pair_temp._t_typeinfosecond._pt_type->_s_typename)
+#define _GET_MULTIMAP_SECOND_TYPE_ID(pmmap_map)               ((pmmap_map)->_pair_temp._t_typeinfosecond._pt_type->_t_typeid)
 #define _GET_MULTIMAP_SECOND_TYPE_INIT_FUNCTION(pmmap_map)    ((pmmap_map)->_pair_temp._t_typeinfosecond._pt_type->_t_typeinit)
 #define _GET_MULTIMAP_SECOND_TYPE_COPY_FUNCTION(pmmap_map)    ((pmmap_map)->_pair_temp._t_typeinfosecond._pt_type->_t_typecopy)
 #define _GET_MULTIMAP_SECOND_TYPE_LESS_FUNCTION(pmmap_map)    ((pmmap_map)->_pair_temp._t_typeinfosecond._pt_type->_t_typeless)
@@ -29,6 +29,7 @@
 #include <cstl/cmap.h>
 
 #include "cstl_multimap_aux.h"
+#include "cstl_pair_aux.h"
 
 /** local constant declaration and local macro section **/
 
@@ -60,6 +61,36 @@ multimap_t* _create_multimap(const char* s_typename)
     return pmmap_map;
 }
 
+/**
+ * Create multimap container that uses user defined allocator.
+ */
+multimap_t* _create_multimap_with_allocator(const allocator_t* cpt_allocator, const char* s_typename)
+{
+    multimap_t* pmmap_map = NULL;
+
+    assert(cpt_allocator != NULL);
+
+    if ((pmmap_map = _create_multimap(s_typename)) != NULL) {
+        _alloc_set_allocator(&pmmap_map->_t_tree._t_allocator, cpt_allocator);
+    }
+
+    return pmmap_map;
+}
+
+/**
+ * Create multimap container that allocates memory from region.
+ */
+multimap_t* _create_multimap_with_region(const char* s_typename)
+{
+    multimap_t* pmmap_map = NULL;
+
+    if ((pmmap_map = _create_multimap(s_typename)) != NULL) {
+        _alloc_set_region(&pmmap_map->_t_tree._t_allocator);
+    }
+
+    return pmmap_map;
+}
+
 /**
  * Create multimap container auxiliary function.
  */
@@ -133,18 +164,21 @@ multimap_iterator_t _multimap_find(const multimap_t* cpmmap_map, ...)
 multimap_iterator_t _multimap_find_varg(const multimap_t* cpmmap_map, va_list val_elemlist)
 {
     multimap_iterator_t it_iter;
+    _pairkey_t t_key;
 
     assert(cpmmap_map != NULL);
     assert(_pair_is_inited(&cpmmap_map->_pair_temp));
 
     /* get key */
-    _type_get_varg_value(&((multimap_t*)cpmmap_map)->_pair_temp._t_typeinfofirst, val_elemlist, cpmmap_map->_pair_temp._pv_first);
+    /* the key is made on the stack, so that the lookup does not modify map */
+    _pair_key_init_varg(&t_key, &cpmmap_map->_pair_temp, val_elemlist);
     /* find key in tree */
 #ifdef CSTL_MULTIMAP_AVL_TREE
-    it_iter = _avl_tree_find(&cpmmap_map->_t_tree, &cpmmap_map->_pair_temp);
+    it_iter = _avl_tree_find(&cpmmap_map->_t_tree, &t_key._pair_key);
 #else
-    it_iter = _rb_tree_find(&cpmmap_map->_t_tree, &cpmmap_map->_pair_temp);
+    it_iter = _rb_tree_find(&cpmmap_map->_t_tree, &t_key._pair_key);
 #endif
+    _pair_key_destroy(&t_key);
 
     _ITERATOR_CONTAINER(it_iter) = (multimap_t*)cpmmap_map;
     _MULTIMAP_ITERATOR_CONTAINER_TYPE(it_iter) = _MULTIMAP_CONTAINER;
@@ -173,15 +207,22 @@ size_t _multimap_count(const multimap_t* cpmmap_map, ...)
  */
 size_t _multimap_count_varg(const multimap_t* cpmmap_map, va_list val_elemlist)
 {
+    size_t     t_count = 0;
+    _pairkey_t t_key;
+
     assert(cpmmap_map != NULL);
     assert(_pair_is_inited(&cpmmap_map->_pair_temp));
 
-    _type_get_varg_value(&((multimap_t*)cpmmap_map)->_pair_temp._t_typeinfofirst, val_elemlist, cpmmap_map->_pair_temp._pv_first);
+    /* the key is made on the stack, so that the lookup does not modify map */
+    _pair_key_init_varg(&t_key, &cpmmap_map->_pair_temp, val_elemlist);
 #ifdef CSTL_MULTIMAP_AVL_TREE
-    return _avl_tree_count(&cpmmap_map->_t_tree, &cpmmap_map->_pair_temp);
+    t_count = _avl_tree_count(&cpmmap_map->_t_tree, &t_key._pair_key);
 #else
-    return _rb_tree_count(&cpmmap_map->_t_tree, &cpmmap_map->_pair_temp);
+    t_count = _rb_tree_count(&cpmmap_map->_t_tree, &t_key._pair_key);
 #endif
+    _pair_key_destroy(&t_key);
+
+    return t_count;
 }
 
 /**
@@ -205,16 +246,19 @@ multimap_iterator_t _multimap_lower_bound(const multimap_t* cpmmap_map, ...)
 multimap_iterator_t _multimap_lower_bound_varg(const multimap_t* cpmmap_map, va_list val_elemlist)
 {
     multimap_iterator_t it_iter;
+    _pairkey_t t_key;
 
     assert(cpmmap_map != NULL);
     assert(_pair_is_inited(&cpmmap_map->_pair_temp));
 
-    _type_get_varg_value(&((multimap_t*)cpmmap_map)->_pair_temp._t_typeinfofirst, val_elemlist, cpmmap_map->_pair_temp._pv_first);
+    /* the key is made on the stack, so that the lookup does not modify map */
+    _pair_key_init_varg(&t_key, &cpmmap_map->_pair_temp, val_elemlist);
 #ifdef CSTL_MULTIMAP_AVL_TREE
-    it_iter = _avl_tree_lower_bound(&cpmmap_map->_t_tree, &cpmmap_map->_pair_temp);
+    it_iter = _avl_tree_lower_bound(&cpmmap_map->_t_tree, &t_key._pair_key);
 #else
-    it_iter = _rb_tree_lower_bound(&cpmmap_map->_t_tree, &cpmmap_map->_pair_temp);
+    it_iter = _rb_tree_lower_bound(&cpmmap_map->_t_tree, &t_key._pair_key);
 #endif
+    _pair_key_destroy(&t_key);
 
     _ITERATOR_CONTAINER(it_iter) = (multimap_t*)cpmmap_map;
     _MULTIMAP_ITERATOR_CONTAINER_TYPE(it_iter) = _MULTIMAP_CONTAINER;
@@ -244,16 +288,19 @@ multimap_iterator_t _multimap_upper_bound(const multimap_t* cpmmap_map, ...)
 multimap_iterator_t _multimap_upper_bound_varg(const multimap_t* cpmmap_map, va_list val_elemlist)
 {
     multimap_iterator_t it_iter;
+    _pairkey_t t_key;
 
     assert(cpmmap_map != NULL);
     assert(_pair_is_inited(&cpmmap_map->_pair_temp));
 
-    _type_get_varg_value(&((multimap_t*)cpmmap_map)->_pair_temp._t_typeinfofirst, val_elemlist, cpmmap_map->_pair_temp._pv_first);
+    /* the key is made on the stack, so that the lookup does not modify map */
+    _pair_key_init_varg(&t_key, &cpmmap_map->_pair_temp, val_elemlist);
 #ifdef CSTL_MULTIMAP_AVL_TREE
-    it_iter = _avl_tree_upper_bound(&cpmmap_map->_t_tree, &cpmmap_map->_pair_temp);
+    it_iter = _avl_tree_upper_bound(&cpmmap_map->_t_tree, &t_key._pair_key);
 #else
-    it_iter = _rb_tree_upper_bound(&cpmmap_map->_t_tree, &cpmmap_map->_pair_temp);
+    it_iter = _rb_tree_upper_bound(&cpmmap_map->_t_tree, &t_key._pair_key);
 #endif
+    _pair_key_destroy(&t_key);
 
     _ITERATOR_CONTAINER(it_iter) = (multimap_t*)cpmmap_map;
     _MULTIMAP_ITERATOR_CONTAINER_TYPE(it_iter) = _MULTIMAP_CONTAINER;
@@ -283,16 +330,19 @@ range_t _multimap_equal_range(const multimap_t* cpmmap_map, ...)
 range_t _multimap_equal_range_varg(const multimap_t* cpmmap_map, va_list val_elemlist)
 {
     range_t r_range;
+    _pairkey_t t_key;
 
     assert(cpmmap_map != NULL);
     assert(_pair_is_inited(&cpmmap_map->_pair_temp));
 
-    _type_get_varg_value(&((multimap_t*)cpmmap_map)->_pair_temp._t_typeinfofirst, val_elemlist, cpmmap_map->_pair_temp._pv_first);
+    /* the key is made on the stack, so that the lookup does not modify map */
+    _pair_key_init_varg(&t_key, &cpmmap_map->_pair_temp, val_elemlist);
 #ifdef CSTL_MULTIMAP_AVL_TREE
-    r_range = _avl_tree_equal_range(&cpmmap_map->_t_tree, &cpmmap_map->_pair_temp);
+    r_range = _avl_tree_equal_range(&cpmmap_map->_t_tree, &t_key._pair_key);
 #else
-    r_range = _rb_tree_equal_range(&cpmmap_map->_t_tree, &cpmmap_map->_pair_temp);
+    r_range = _rb_tree_equal_range(&cpmmap_map->_t_tree, &t_key._pair_key);
 #endif
+    _pair_key_destroy(&t_key);
 
     _ITERATOR_CONTAINER(r_range.it_begin) = (multimap_t*)cpmmap_map;
     _MULTIMAP_ITERATOR_CONTAINER_TYPE(r_range.it_begin) = _MULTIMAP_CONTAINER;
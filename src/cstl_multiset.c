@@ -216,6 +216,24 @@ size_t multiset_max_size(const multiset_t* cpmset_mset)
 #endif
 }
 
+/**
+ * Get the memory that is held by the multiset.
+ */
+size_t multiset_memory_usage(const multiset_t* cpmset_mset)
+{
+    size_t t_usage = 0;
+
+    assert(cpmset_mset != NULL);
+
+#ifdef CSTL_MULTISET_AVL_TREE
+    t_usage = _avl_tree_memory_usage(&cpmset_mset->_t_tree);
+#else
+    t_usage = _rb_tree_memory_usage(&cpmset_mset->_t_tree);
+#endif
+
+    return sizeof(multiset_t) + t_usage;
+}
+
 /**
  * Return an iterator that addresses the first element in the multiset.
  */
@@ -506,6 +524,102 @@ void multiset_erase_range(multiset_t* pmset_mset, multiset_iterator_t it_begin,
 #endif
 }
 
+/**
+ * Find specific element that is pointed by pointer.
+ */
+multiset_iterator_t multiset_find_ptr(const multiset_t* cpmset_mset, const void* cpv_value)
+{
+    multiset_iterator_t it_iter;
+
+    assert(cpmset_mset != NULL);
+    assert(cpv_value != NULL);
+
+    /* the element of c string is string_t, so it is built from char* like the variable argument */
+    if (_GET_MULTISET_TYPE_ID(cpmset_mset) == _TYPE_ID_C_STRING) {
+        return _multiset_find(cpmset_mset, cpv_value);
+    }
+
+#ifdef CSTL_MULTISET_AVL_TREE
+    it_iter = _avl_tree_find(&cpmset_mset->_t_tree, cpv_value);
+#else
+    it_iter = _rb_tree_find(&cpmset_mset->_t_tree, cpv_value);
+#endif
+
+    _ITERATOR_CONTAINER(it_iter) = (multiset_t*)cpmset_mset;
+    _MULTISET_ITERATOR_CONTAINER_TYPE(it_iter) = _MULTISET_CONTAINER;
+    _MULTISET_ITERATOR_ITERATOR_TYPE(it_iter) = _BIDIRECTIONAL_ITERATOR;
+
+    return it_iter;
+}
+
+/**
+ * Return the number of specific elements that is pointed by pointer.
+ */
+size_t multiset_count_ptr(const multiset_t* cpmset_mset, const void* cpv_value)
+{
+    assert(cpmset_mset != NULL);
+    assert(cpv_value != NULL);
+
+    /* the element of c string is string_t, so it is built from char* like the variable argument */
+    if (_GET_MULTISET_TYPE_ID(cpmset_mset) == _TYPE_ID_C_STRING) {
+        return _multiset_count(cpmset_mset, cpv_value);
+    }
+
+#ifdef CSTL_MULTISET_AVL_TREE
+    return _avl_tree_count(&cpmset_mset->_t_tree, cpv_value);
+#else
+    return _rb_tree_count(&cpmset_mset->_t_tree, cpv_value);
+#endif
+}
+
+/**
+ * Inserts an element that is pointed by pointer into a multiset.
+ */
+multiset_iterator_t multiset_insert_ptr(multiset_t* pmset_mset, const void* cpv_value)
+{
+    multiset_iterator_t it_iter;
+
+    assert(pmset_mset != NULL);
+    assert(cpv_value != NULL);
+
+    /* the element of c string is string_t, so it is built from char* like the variable argument */
+    if (_GET_MULTISET_TYPE_ID(pmset_mset) == _TYPE_ID_C_STRING) {
+        return _multiset_insert(pmset_mset, cpv_value);
+    }
+
+#ifdef CSTL_MULTISET_AVL_TREE
+    it_iter = _avl_tree_insert_equal(&pmset_mset->_t_tree, cpv_value);
+#else
+    it_iter = _rb_tree_insert_equal(&pmset_mset->_t_tree, cpv_value);
+#endif
+
+    _ITERATOR_CONTAINER(it_iter) = pmset_mset;
+    _MULTISET_ITERATOR_CONTAINER_TYPE(it_iter) = _MULTISET_CONTAINER;
+    _MULTISET_ITERATOR_ITERATOR_TYPE(it_iter) = _BIDIRECTIONAL_ITERATOR;
+
+    return it_iter;
+}
+
+/**
+ * Erase an element from a multiset that match a element that is pointed by pointer.
+ */
+size_t multiset_erase_ptr(multiset_t* pmset_mset, const void* cpv_value)
+{
+    assert(pmset_mset != NULL);
+    assert(cpv_value != NULL);
+
+    /* the element of c string is string_t, so it is built from char* like the variable argument */
+    if (_GET_MULTISET_TYPE_ID(pmset_mset) == _TYPE_ID_C_STRING) {
+        return _multiset_erase(pmset_mset, cpv_value);
+    }
+
+#ifdef CSTL_MULTISET_AVL_TREE
+    return _avl_tree_erase(&pmset_mset->_t_tree, cpv_value);
+#else
+    return _rb_tree_erase(&pmset_mset->_t_tree, cpv_value);
+#endif
+}
+
 /** local function implementation section **/
 
 /** eof **/
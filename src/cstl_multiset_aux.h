@@ -34,6 +34,7 @@ extern "C" {
 #define _GET_MULTISET_TYPE_SIZE(pmset_mset)             ((pmset_mset)->_t_tree._t_typeinfo._pt_type->_t_typesize)
 #define _GET_MULTISET_TYPE_NAME(pmset_mset)             ((pmset_mset)->_t_tree._t_typeinfo._s_typename)
 #define _GET_MULTISET_TYPE_BASENAME(pmset_mset)         ((pmset_mset)->_t_tree._t_typeinfo._pt_type->_s_typename)
+#define _GET_MULTISET_TYPE_ID(pmset_mset)               ((pmset_mset)->_t_tree._t_typeinfo._pt_type->_t_typeid)
 #define _GET_MULTISET_TYPE_INIT_FUNCTION(pmset_mset)    ((pmset_mset)->_t_tree._t_typeinfo._pt_type->_t_typeinit)
 #define _GET_MULTISET_TYPE_COPY_FUNCTION(pmset_mset)    ((pmset_mset)->_t_tree._t_typeinfo._pt_type->_t_typecopy)
 #define _GET_MULTISET_TYPE_LESS_FUNCTION(pmset_mset)    ((pmset_mset)->_t_tree._t_typeinfo._pt_type->_t_typeless)
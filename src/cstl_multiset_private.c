@@ -52,6 +52,36 @@ multiset_t* _create_multiset(const char* s_typename)
 #endif
 }
 
+/**
+ * Create multiset container that uses user defined allocator.
+ */
+multiset_t* _create_multiset_with_allocator(const allocator_t* cpt_allocator, const char* s_typename)
+{
+    multiset_t* pmset_set = NULL;
+
+    assert(cpt_allocator != NULL);
+
+    if ((pmset_set = _create_multiset(s_typename)) != NULL) {
+        _alloc_set_allocator(&pmset_set->_t_tree._t_allocator, cpt_allocator);
+    }
+
+    return pmset_set;
+}
+
+/**
+ * Create multiset container that allocates memory from region.
+ */
+multiset_t* _create_multiset_with_region(const char* s_typename)
+{
+    multiset_t* pmset_set = NULL;
+
+    if ((pmset_set = _create_multiset(s_typename)) != NULL) {
+        _alloc_set_region(&pmset_set->_t_tree._t_allocator);
+    }
+
+    return pmset_set;
+}
+
 /**
  * Create multiset container auxiliary function.
  */
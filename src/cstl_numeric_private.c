@@ -83,7 +83,7 @@ void _algo_accumulate(input_iterator_t it_first, input_iterator_t it_last, void*
     va_list val_elemlist;
 
     if (_iterator_get_typestyle(it_first) == _TYPE_C_BUILTIN &&
-        strncmp(_iterator_get_typebasename(it_first), _C_STRING_TYPE, _TYPE_NAME_SIZE) != 0) {
+        _iterator_get_typeid(it_first) != _TYPE_ID_C_STRING) {
         va_start(val_elemlist, pv_output);
         _algo_accumulate_if_varg(it_first, it_last, _fun_get_binary(it_first, _PLUS_FUN), pv_output, val_elemlist);
         va_end(val_elemlist);
@@ -131,7 +131,7 @@ void _algo_inner_product(
     va_list val_elemlist;
 
     if (_iterator_get_typestyle(it_first1) == _TYPE_C_BUILTIN &&
-        strncmp(_iterator_get_typebasename(it_first1), _C_STRING_TYPE, _TYPE_NAME_SIZE) != 0) {
+        _iterator_get_typeid(it_first1) != _TYPE_ID_C_STRING) {
         va_start(val_elemlist, pv_output);
         _algo_inner_product_if_varg(
             it_first1, it_last1, it_first2, _fun_get_binary(it_first1, _PLUS_FUN),
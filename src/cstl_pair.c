@@ -45,45 +45,19 @@
  */
 void pair_init(pair_t* ppair_pair)
 {
+    void* pv_storage = NULL;
+
     assert(ppair_pair != NULL);
     assert(_pair_is_created(ppair_pair));
 
-    if ((ppair_pair->_pv_first = malloc(_GET_PAIR_FIRST_TYPE_SIZE(ppair_pair))) == NULL) {
+    /* the first and second share one block */
+    if ((pv_storage = malloc(_PAIR_STORAGE_SIZE(
+            _GET_PAIR_FIRST_TYPE_SIZE(ppair_pair), _GET_PAIR_SECOND_TYPE_SIZE(ppair_pair)))) == NULL) {
         fprintf(stderr, "CSTL FATAL ERROR: memory allocation error!\n");
         exit(EXIT_FAILURE);
-    } else {
-        memset(ppair_pair->_pv_first, 0x00, _GET_PAIR_FIRST_TYPE_SIZE(ppair_pair));
-    }
-
-    if ((ppair_pair->_pv_second = malloc(_GET_PAIR_SECOND_TYPE_SIZE(ppair_pair))) == NULL) {
-        fprintf(stderr, "CSTL FATAL ERROR: memory allocation error!\n");
-        exit(EXIT_FAILURE);
-    } else {
-        memset(ppair_pair->_pv_second, 0x00, _GET_PAIR_SECOND_TYPE_SIZE(ppair_pair));
     }
 
-    /* initialize new elements */
-    if (_GET_PAIR_FIRST_TYPE_STYLE(ppair_pair) == _TYPE_CSTL_BUILTIN) {
-        /* get element type name */
-        char s_elemtypename[_TYPE_NAME_SIZE + 1];
-        _type_get_elem_typename(_GET_PAIR_FIRST_TYPE_NAME(ppair_pair), s_elemtypename);
-        _GET_PAIR_FIRST_TYPE_INIT_FUNCTION(ppair_pair)(ppair_pair->_pv_first, s_elemtypename);
-    } else {
-        bool_t b_result = _GET_PAIR_FIRST_TYPE_SIZE(ppair_pair);
-        _GET_PAIR_FIRST_TYPE_INIT_FUNCTION(ppair_pair)(ppair_pair->_pv_first, &b_result);
-        assert(b_result);
-    }
-
-    if (_GET_PAIR_SECOND_TYPE_STYLE(ppair_pair) == _TYPE_CSTL_BUILTIN) {
-        /* get element type name */
-        char s_elemtypename[_TYPE_NAME_SIZE + 1];
-        _type_get_elem_typename(_GET_PAIR_SECOND_TYPE_NAME(ppair_pair), s_elemtypename);
-        _GET_PAIR_SECOND_TYPE_INIT_FUNCTION(ppair_pair)(ppair_pair->_pv_second, s_elemtypename);
-    } else {
-        bool_t b_result = _GET_PAIR_SECOND_TYPE_SIZE(ppair_pair);
-        _GET_PAIR_SECOND_TYPE_INIT_FUNCTION(ppair_pair)(ppair_pair->_pv_second, &b_result);
-        assert(b_result);
-    }
+    _pair_init_elem_auxiliary(ppair_pair, pv_storage);
 }
 
 /**
@@ -161,7 +135,7 @@ void* pair_first(const pair_t* cppair_pair)
     assert(_pair_is_inited(cppair_pair));
 
     /* char* */
-    if (strncmp(_GET_PAIR_FIRST_TYPE_BASENAME(cppair_pair), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_PAIR_FIRST_TYPE_ID(cppair_pair) == _TYPE_ID_C_STRING) {
         return (void*)string_c_str((string_t*)cppair_pair->_pv_first);
     } else {
         return cppair_pair->_pv_first;
@@ -177,7 +151,7 @@ void* pair_second(const pair_t* cppair_pair)
     assert(_pair_is_inited(cppair_pair));
 
     /* char* */
-    if (strncmp(_GET_PAIR_SECOND_TYPE_BASENAME(cppair_pair), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_PAIR_SECOND_TYPE_ID(cppair_pair) == _TYPE_ID_C_STRING) {
         return (void*)string_c_str((string_t*)cppair_pair->_pv_second);
     } else {
         return cppair_pair->_pv_second;
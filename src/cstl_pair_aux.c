@@ -34,6 +34,15 @@
 /** local data type declaration and local struct, union, enum section **/
 
 /** local function prototype section **/
+/**
+ * Initialize the pair of key.
+ * @param pt_key            uninitialized key.
+ * @param cppair_pair       pair that has the same type as the elements of map.
+ * @return void.
+ * @remarks if pt_key == NULL or cppair_pair == NULL, then the behavior is undefined. cppair_pair must be initialized,
+ *          otherwise the behavior is undefined.
+ */
+static void _pair_key_init_auxiliary(_pairkey_t* pt_key, const pair_t* cppair_pair);
 
 /** exported global variable definition section **/
 
@@ -62,7 +71,118 @@ bool_t _pair_same_type(const pair_t* cppair_first, const pair_t* cppair_second)
            _type_is_same(cppair_first->_t_typeinfosecond._s_typename, cppair_second->_t_typeinfosecond._s_typename);
 }
 
+/**
+ * Initialize the first and second of pair in storage.
+ */
+void _pair_init_elem_auxiliary(pair_t* ppair_pair, void* pv_storage)
+{
+    assert(ppair_pair != NULL);
+    assert(pv_storage != NULL);
+
+    ppair_pair->_pv_first = pv_storage;
+    ppair_pair->_pv_second = (_byte_t*)pv_storage + _PAIR_SECOND_OFFSET(_GET_PAIR_FIRST_TYPE_SIZE(ppair_pair));
+    memset(ppair_pair->_pv_first, 0x00,
+        _PAIR_STORAGE_SIZE(_GET_PAIR_FIRST_TYPE_SIZE(ppair_pair), _GET_PAIR_SECOND_TYPE_SIZE(ppair_pair)));
+
+    /* initialize new elements */
+    if (_GET_PAIR_FIRST_TYPE_STYLE(ppair_pair) == _TYPE_CSTL_BUILTIN) {
+        /* get element type name */
+        char s_elemtypename[_TYPE_NAME_SIZE + 1];
+        _type_get_elem_typename(_GET_PAIR_FIRST_TYPE_NAME(ppair_pair), s_elemtypename);
+        _GET_PAIR_FIRST_TYPE_INIT_FUNCTION(ppair_pair)(ppair_pair->_pv_first, s_elemtypename);
+    } else {
+        bool_t b_result = _GET_PAIR_FIRST_TYPE_SIZE(ppair_pair);
+        _GET_PAIR_FIRST_TYPE_INIT_FUNCTION(ppair_pair)(ppair_pair->_pv_first, &b_result);
+        assert(b_result);
+    }
+
+    if (_GET_PAIR_SECOND_TYPE_STYLE(ppair_pair) == _TYPE_CSTL_BUILTIN) {
+        /* get element type name */
+        char s_elemtypename[_TYPE_NAME_SIZE + 1];
+        _type_get_elem_typename(_GET_PAIR_SECOND_TYPE_NAME(ppair_pair), s_elemtypename);
+        _GET_PAIR_SECOND_TYPE_INIT_FUNCTION(ppair_pair)(ppair_pair->_pv_second, s_elemtypename);
+    } else {
+        bool_t b_result = _GET_PAIR_SECOND_TYPE_SIZE(ppair_pair);
+        _GET_PAIR_SECOND_TYPE_INIT_FUNCTION(ppair_pair)(ppair_pair->_pv_second, &b_result);
+        assert(b_result);
+    }
+}
+
+/**
+ * Initialize the key of map with the key in variable argument list.
+ */
+void _pair_key_init_varg(_pairkey_t* pt_key, const pair_t* cppair_pair, va_list val_elemlist)
+{
+    assert(pt_key != NULL);
+    assert(cppair_pair != NULL);
+
+    _pair_key_init_auxiliary(pt_key, cppair_pair);
+    if (_GET_PAIR_FIRST_TYPE_ID(cppair_pair) == _TYPE_ID_C_STRING) {
+        const char* s_key = va_arg(val_elemlist, const char*);
+
+        assert(s_key != NULL);
+        string_init_cstr(&pt_key->_t_cstr, s_key);
+        pt_key->_pair_key._pv_first = &pt_key->_t_cstr;
+    } else if (_GET_PAIR_FIRST_TYPE_STYLE(cppair_pair) == _TYPE_C_BUILTIN) {
+        _type_get_varg_value(&pt_key->_pair_key._t_typeinfofirst, val_elemlist, &pt_key->_t_value);
+        pt_key->_pair_key._pv_first = &pt_key->_t_value;
+    } else {
+        /* the key of libcstl builtin type or user defined type is passed by pointer */
+        pt_key->_pair_key._pv_first = va_arg(val_elemlist, void*);
+        assert(pt_key->_pair_key._pv_first != NULL);
+    }
+}
+
+/**
+ * Initialize the key of map with the key that is pointed by pointer.
+ */
+void _pair_key_init_ptr(_pairkey_t* pt_key, const pair_t* cppair_pair, const void* cpv_key)
+{
+    assert(pt_key != NULL);
+    assert(cppair_pair != NULL);
+    assert(cpv_key != NULL);
+
+    _pair_key_init_auxiliary(pt_key, cppair_pair);
+    if (_GET_PAIR_FIRST_TYPE_ID(cppair_pair) == _TYPE_ID_C_STRING) {
+        string_init_cstr(&pt_key->_t_cstr, (const char*)cpv_key);
+        pt_key->_pair_key._pv_first = &pt_key->_t_cstr;
+    } else {
+        pt_key->_pair_key._pv_first = (void*)cpv_key;
+    }
+}
+
+/**
+ * Destroy the key of map.
+ */
+void _pair_key_destroy(_pairkey_t* pt_key)
+{
+    assert(pt_key != NULL);
+    assert(_pair_is_inited(&pt_key->_pair_key));
+
+    if (_GET_PAIR_FIRST_TYPE_ID(&pt_key->_pair_key) == _TYPE_ID_C_STRING) {
+        _string_destroy_auxiliary(&pt_key->_t_cstr);
+    }
+    pt_key->_pair_key._pv_first = NULL;
+    pt_key->_pair_key._pv_second = NULL;
+}
+
 /** local function implementation section **/
+/**
+ * Initialize the pair of key.
+ */
+static void _pair_key_init_auxiliary(_pairkey_t* pt_key, const pair_t* cppair_pair)
+{
+    assert(pt_key != NULL);
+    assert(cppair_pair != NULL);
+    assert(_pair_is_inited(cppair_pair));
+
+    /* the pair of key shares the type information, compare functions and second with cppair_pair */
+    pt_key->_pair_key = *cppair_pair;
+    pt_key->_pair_key._b_inline = false;
+    if (_GET_PAIR_FIRST_TYPE_ID(cppair_pair) == _TYPE_ID_C_STRING) {
+        _create_string_auxiliary(&pt_key->_t_cstr);
+    }
+}
 
 /** eof **/
 
@@ -34,6 +34,7 @@ extern "C" {
 #define _GET_PAIR_FIRST_TYPE_SIZE(ppair_pair)              ((ppair_pair)->_t_typeinfofirst._pt_type->_t_typesize)
 #define _GET_PAIR_FIRST_TYPE_NAME(ppair_pair)              ((ppair_pair)->_t_typeinfofirst._s_typename)
 #define _GET_PAIR_FIRST_TYPE_BASENAME(ppair_pair)          ((ppair_pair)->_t_typeinfofirst._pt_type->_s_typename)
+#define _GET_PAIR_FIRST_TYPE_ID(ppair_pair)                ((ppair_pair)->_t_typeinfofirst._pt_type->_t_typeid)
 #define _GET_PAIR_FIRST_TYPE_INIT_FUNCTION(ppair_pair)     ((ppair_pair)->_t_typeinfofirst._pt_type->_t_typeinit)
 #define _GET_PAIR_FIRST_TYPE_COPY_FUNCTION(ppair_pair)     ((ppair_pair)->_t_typeinfofirst._pt_type->_t_typecopy)
 #define _GET_PAIR_FIRST_TYPE_LESS_FUNCTION(ppair_pair)     ((ppair_pair)->_t_typeinfofirst._pt_type->_t_typeless)
@@ -43,13 +44,34 @@ extern "C" {
 #define _GET_PAIR_SECOND_TYPE_SIZE(ppair_pair)             ((ppair_pair)->_t_typeinfosecond._pt_type->_t_typesize)
 #define _GET_PAIR_SECOND_TYPE_NAME(ppair_pair)             ((ppair_pair)->_t_typeinfosecond._s_typename)
 #define _GET_PAIR_SECOND_TYPE_BASENAME(ppair_pair)         ((ppair_pair)->_t_typeinfosecond._pt_type->_s_typename)
+#define _GET_PAIR_SECOND_TYPE_ID(ppair_pair)               ((ppair_pair)->_t_typeinfosecond._pt_type->_t_typeid)
 #define _GET_PAIR_SECOND_TYPE_INIT_FUNCTION(ppair_pair)    ((ppair_pair)->_t_typeinfosecond._pt_type->_t_typeinit)
 #define _GET_PAIR_SECOND_TYPE_COPY_FUNCTION(ppair_pair)    ((ppair_pair)->_t_typeinfosecond._pt_type->_t_typecopy)
 #define _GET_PAIR_SECOND_TYPE_LESS_FUNCTION(ppair_pair)    ((ppair_pair)->_t_typeinfosecond._pt_type->_t_typeless)
 #define _GET_PAIR_SECOND_TYPE_DESTROY_FUNCTION(ppair_pair) ((ppair_pair)->_t_typeinfosecond._pt_type->_t_typedestroy)
 #define _GET_PAIR_SECOND_TYPE_STYLE(ppair_pair)            ((ppair_pair)->_t_typeinfosecond._t_style)
 
+/* the first and second are stored in one block, the second is aligned after the first */
+#define _PAIR_ALIGNMENT                                    8
+#define _PAIR_SECOND_OFFSET(firstsize)                     (((firstsize) + _PAIR_ALIGNMENT - 1) & ~(_PAIR_ALIGNMENT - 1))
+#define _PAIR_STORAGE_SIZE(firstsize, secondsize)          (_PAIR_SECOND_OFFSET(firstsize) + (secondsize))
+/* the inline storage follows the pair in node, it is rounded up to the alignment and the node keeps the padding */
+#define _PAIR_INLINE_STORAGE(ppair_pair)                   \
+    ((_byte_t*)(((size_t)((_byte_t*)(ppair_pair) + sizeof(pair_t)) + _PAIR_ALIGNMENT - 1) & ~(size_t)(_PAIR_ALIGNMENT - 1)))
+#define _PAIR_INLINE_SIZE(firstsize, secondsize)           (_PAIR_ALIGNMENT - 1 + _PAIR_STORAGE_SIZE(firstsize, secondsize))
+
 /** data type declaration and struct, union, enum section **/
+/* the key of map that is made on the stack of caller, so that the lookup does not modify the map */
+typedef struct _tagpairkey
+{
+    pair_t            _pair_key;    /* the pair that refers to key, it is used to hash and compare */
+    string_t          _t_cstr;      /* the key of c string */
+    union
+    {
+        long double   _ld_value;
+        void*         _pv_value;
+    }_t_value;                      /* the key of other c builtin types */
+}_pairkey_t;
 
 /** exported global variable declaration section **/
 
@@ -63,6 +85,50 @@ extern "C" {
  */
 extern bool_t _pair_same_type(const pair_t* cppair_first, const pair_t* cppair_second);
 
+/**
+ * Initialize the first and second of pair in storage.
+ * @param ppair_pair        pair container.
+ * @param pv_storage        storage of first and second.
+ * @return void.
+ * @remarks if ppair_pair == NULL or pv_storage == NULL, then the behavior is undefined. pair must be created and the
+ *          size of storage must not be less than _PAIR_STORAGE_SIZE of first and second, otherwise the behavior is
+ *          undefined.
+ */
+extern void _pair_init_elem_auxiliary(pair_t* ppair_pair, void* pv_storage);
+
+/**
+ * Initialize the key of map with the key in variable argument list.
+ * @param pt_key            uninitialized key.
+ * @param cppair_pair       pair that has the same type as the elements of map.
+ * @param val_elemlist      key list.
+ * @return void.
+ * @remarks if pt_key == NULL or cppair_pair == NULL, then the behavior is undefined. cppair_pair must be initialized,
+ *          otherwise the behavior is undefined. the key of libcstl builtin type or user defined type is not copied, it
+ *          is referred by the pair of key directly.
+ */
+extern void _pair_key_init_varg(_pairkey_t* pt_key, const pair_t* cppair_pair, va_list val_elemlist);
+
+/**
+ * Initialize the key of map with the key that is pointed by pointer.
+ * @param pt_key            uninitialized key.
+ * @param cppair_pair       pair that has the same type as the elements of map.
+ * @param cpv_key           pointer to key.
+ * @return void.
+ * @remarks if pt_key == NULL, cppair_pair == NULL or cpv_key == NULL, then the behavior is undefined. cppair_pair must be
+ *          initialized, otherwise the behavior is undefined. the key is referred by the pair of key directly except
+ *          c string.
+ */
+extern void _pair_key_init_ptr(_pairkey_t* pt_key, const pair_t* cppair_pair, const void* cpv_key);
+
+/**
+ * Destroy the key of map.
+ * @param pt_key            key.
+ * @return void.
+ * @remarks if pt_key == NULL, then the behavior is undefined. the key must be initialized by _pair_key_init_varg() or
+ *          _pair_key_init_ptr(), otherwise the behavior is undefined.
+ */
+extern void _pair_key_destroy(_pairkey_t* pt_key);
+
 #ifdef __cplusplus
 }
 #endif
@@ -75,6 +75,7 @@ bool_t _create_pair_auxiliary(pair_t* ppair_pair, const char* s_typename)
 
     ppair_pair->_pv_first = NULL;
     ppair_pair->_pv_second = NULL;
+    ppair_pair->_b_inline = false;
 
     /* this two members are only used for map key and value compare. */
     ppair_pair->_bfun_mapkeycompare = NULL;
@@ -128,21 +129,86 @@ void _pair_destroy_auxiliary(pair_t* ppair_pair)
         b_result = _GET_PAIR_FIRST_TYPE_SIZE(ppair_pair);
         _GET_PAIR_FIRST_TYPE_DESTROY_FUNCTION(ppair_pair)(ppair_pair->_pv_first, &b_result);
         assert(b_result);
-        free(ppair_pair->_pv_first);
-        ppair_pair->_pv_first = NULL;
 
         /* destroy second */
         b_result = _GET_PAIR_SECOND_TYPE_SIZE(ppair_pair);
         _GET_PAIR_SECOND_TYPE_DESTROY_FUNCTION(ppair_pair)(ppair_pair->_pv_second, &b_result);
         assert(b_result);
-        free(ppair_pair->_pv_second);
+
+        /* the second is in the block of first */
+        if (!ppair_pair->_b_inline) {
+            free(ppair_pair->_pv_first);
+        }
+        ppair_pair->_pv_first = NULL;
         ppair_pair->_pv_second = NULL;
+        ppair_pair->_b_inline = false;
     }
 
     ppair_pair->_bfun_mapkeycompare = NULL;
     ppair_pair->_bfun_mapvaluecompare = NULL;
 }
 
+/**
+ * Get the size of storage that holds the first and second of pair element inline.
+ */
+size_t _pair_get_inline_size(const _typeinfo_t* cpt_typeinfo)
+{
+    _typeinfo_t t_typeinfofirst;
+    _typeinfo_t t_typeinfosecond;
+    char        s_elemtypename[_TYPE_NAME_SIZE + 1];
+
+    assert(cpt_typeinfo != NULL);
+
+    if (cpt_typeinfo->_t_style != _TYPE_CSTL_BUILTIN || cpt_typeinfo->_pt_type->_t_typeid != _TYPE_ID_PAIR) {
+        return 0;
+    }
+
+    _type_get_elem_typename(cpt_typeinfo->_s_typename, s_elemtypename);
+    _type_get_type_pair(&t_typeinfofirst, &t_typeinfosecond, s_elemtypename);
+    assert(t_typeinfofirst._t_style != _TYPE_INVALID && t_typeinfosecond._t_style != _TYPE_INVALID);
+
+    return _PAIR_INLINE_SIZE(t_typeinfofirst._pt_type->_t_typesize, t_typeinfosecond._pt_type->_t_typesize);
+}
+
+/**
+ * Test the pair element that is stored inline need not be destroyed.
+ */
+bool_t _pair_is_inline_trivially_destructible(const _typeinfo_t* cpt_typeinfo)
+{
+    _typeinfo_t t_typeinfofirst;
+    _typeinfo_t t_typeinfosecond;
+    char        s_elemtypename[_TYPE_NAME_SIZE + 1];
+
+    assert(cpt_typeinfo != NULL);
+
+    if (cpt_typeinfo->_t_style != _TYPE_CSTL_BUILTIN || cpt_typeinfo->_pt_type->_t_typeid != _TYPE_ID_PAIR) {
+        return false;
+    }
+
+    _type_get_elem_typename(cpt_typeinfo->_s_typename, s_elemtypename);
+    _type_get_type_pair(&t_typeinfofirst, &t_typeinfosecond, s_elemtypename);
+    assert(t_typeinfofirst._t_style != _TYPE_INVALID && t_typeinfosecond._t_style != _TYPE_INVALID);
+
+    /* the inline storage is released together with node, so only the first and second have to be considered */
+    return _type_is_trivially_destructible(&t_typeinfofirst) && _type_is_trivially_destructible(&t_typeinfosecond);
+}
+
+/**
+ * Create and initialize pair container in the storage that follows the pair.
+ */
+void _pair_init_inline(pair_t* ppair_pair, const char* s_typename)
+{
+    bool_t b_result = false;
+
+    assert(ppair_pair != NULL);
+    assert(s_typename != NULL);
+
+    b_result = _create_pair_auxiliary(ppair_pair, s_typename);
+    assert(b_result);
+    _pair_init_elem_auxiliary(ppair_pair, _PAIR_INLINE_STORAGE(ppair_pair));
+    ppair_pair->_b_inline = true;
+}
+
 /**
  * Test pair is created by create_pair.
  */
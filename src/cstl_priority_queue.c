@@ -172,6 +172,17 @@ void priority_queue_pop(priority_queue_t* ppque_pqueue)
     vector_pop_back(&ppque_pqueue->_vec_base);
 }
 
+/**
+ * Add element that is pointed by pointer into priority queue.
+ */
+void priority_queue_push_ptr(priority_queue_t* ppque_pqueue, const void* cpv_value)
+{
+    assert(ppque_pqueue != NULL);
+
+    vector_push_back_ptr(&ppque_pqueue->_vec_base, cpv_value);
+    algo_push_heap_if(vector_begin(&ppque_pqueue->_vec_base), vector_end(&ppque_pqueue->_vec_base), ppque_pqueue->_bfun_priority);
+}
+
 /** local function implementation section **/
 
 /** eof **/
@@ -249,6 +249,20 @@ bool_t queue_greater_equal(const queue_t* cpque_first, const queue_t* cpque_seco
 #endif
 }
 
+/**
+ * Add element that is pointed by pointer at the back of queue.
+ */
+void queue_push_ptr(queue_t* pque_queue, const void* cpv_value)
+{
+    assert(pque_queue != NULL);
+
+#ifdef CSTL_QUEUE_LIST_SEQUENCE
+    list_push_back_ptr(&pque_queue->_t_sequence, cpv_value);
+#else
+    deque_push_back_ptr(&pque_queue->_t_sequence, cpv_value);
+#endif
+}
+
 /** local function implementation section **/
 
 /** eof **/
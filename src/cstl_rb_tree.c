@@ -26,6 +26,7 @@
 #include <cstl/cstl_types.h>
 #include <cstl/citerator.h>
 #include <cstl/cstring.h>
+#include <cstl/cutility.h>
 
 #include <cstl/cstl_rb_tree_iterator.h>
 #include <cstl/cstl_rb_tree_private.h>
@@ -34,6 +35,8 @@
 #include "cstl_rb_tree_aux.h"
 
 /** local constant declaration and local macro section **/
+/* the number of elements that descend the tree together in batch find */
+#define _RB_TREE_FIND_BATCH_COUNT 16
 
 /** local data type declaration and local struct, union, enum section **/
 
@@ -295,6 +298,20 @@ size_t _rb_tree_max_size(const _rb_tree_t* cpt_rb_tree)
     return (size_t)(-1) / _GET_RB_TREE_TYPE_SIZE(cpt_rb_tree);
 }
 
+/**
+ * Get the memory that is allocated by the rb tree.
+ */
+size_t _rb_tree_memory_usage(const _rb_tree_t* cpt_rb_tree)
+{
+    _allocstat_t t_stat;
+
+    assert(cpt_rb_tree != NULL);
+    assert(_rb_tree_is_inited(cpt_rb_tree));
+
+    _alloc_get_stat(&cpt_rb_tree->_t_allocator, &t_stat);
+    return t_stat._t_livesize + t_stat._t_cachedsize;
+}
+
 /**
  * Return an iterator that addresses the first element in the rb tree.
  */
@@ -383,6 +400,62 @@ _rb_tree_iterator_t _rb_tree_find(const _rb_tree_t* cpt_rb_tree, const void* cpv
     return it_iter;
 }
 
+/**
+ * Find a batch of specific elements.
+ */
+void _rb_tree_find_batch(
+    const _rb_tree_t* cpt_rb_tree, const void* const* cppv_values, size_t t_count, _rb_tree_iterator_t* pit_result)
+{
+    _rbnode_t* apt_node[_RB_TREE_FIND_BATCH_COUNT];
+    size_t     t_batch = 0;
+    size_t     t_active = 0;
+    size_t     i = 0;
+    size_t     j = 0;
+    int        n_result = 0;
+
+    assert(cpt_rb_tree != NULL);
+    assert(cppv_values != NULL);
+    assert(pit_result != NULL);
+    assert(_rb_tree_is_inited(cpt_rb_tree));
+
+    for (i = 0; i < t_count; i += t_batch) {
+        t_batch = t_count - i < _RB_TREE_FIND_BATCH_COUNT ? t_count - i : _RB_TREE_FIND_BATCH_COUNT;
+        for (j = 0; j < t_batch; ++j) {
+            assert(cppv_values[i + j] != NULL);
+            apt_node[j] = cpt_rb_tree->_t_rbroot._pt_parent;
+            _RB_TREE_ITERATOR_TREE_POINTER(pit_result[i + j]) = (void*)cpt_rb_tree;
+            _RB_TREE_ITERATOR_COREPOS(pit_result[i + j]) = (_byte_t*)&cpt_rb_tree->_t_rbroot;
+        }
+
+        /*
+         * Each round moves every unfinished lookup down one level like _rb_tree_find_value() and prefetches the
+         * next node, so the cache misses of lookups in one round are overlapped.
+         */
+        for (t_active = t_batch; t_active > 0;) {
+            t_active = 0;
+            for (j = 0; j < t_batch; ++j) {
+                if (apt_node[j] == NULL) {
+                    continue;
+                }
+
+                n_result = _rb_tree_elem_three_way_compare_auxiliary(
+                    cpt_rb_tree, cppv_values[i + j], apt_node[j]->_pby_data);
+                if (n_result == 0) {
+                    _RB_TREE_ITERATOR_COREPOS(pit_result[i + j]) = (_byte_t*)apt_node[j];
+                    apt_node[j] = NULL;
+                    continue;
+                }
+
+                apt_node[j] = n_result < 0 ? apt_node[j]->_pt_left : apt_node[j]->_pt_right;
+                if (apt_node[j] != NULL) {
+                    _CSTL_PREFETCH(apt_node[j]);
+                    ++t_active;
+                }
+            }
+        }
+    }
+}
+
 /**
  * Erases all the elements of an rb tree.
  */
@@ -391,11 +464,19 @@ void _rb_tree_clear(_rb_tree_t* pt_rb_tree)
     assert(pt_rb_tree != NULL);
     assert(_rb_tree_is_inited(pt_rb_tree));
 
-    pt_rb_tree->_t_rbroot._pt_parent = _rb_tree_destroy_subtree(pt_rb_tree, pt_rb_tree->_t_rbroot._pt_parent);
+    /* the elements in region that need not be destroyed are released with the region at once */
+    if (_alloc_is_region(&pt_rb_tree->_t_allocator) &&
+        (_type_is_trivially_destructible(&pt_rb_tree->_t_typeinfo) ||
+         _pair_is_inline_trivially_destructible(&pt_rb_tree->_t_typeinfo))) {
+        pt_rb_tree->_t_rbroot._pt_parent = NULL;
+    } else {
+        pt_rb_tree->_t_rbroot._pt_parent = _rb_tree_destroy_subtree(pt_rb_tree, pt_rb_tree->_t_rbroot._pt_parent);
+    }
     assert(pt_rb_tree->_t_rbroot._pt_parent == NULL);
     pt_rb_tree->_t_rbroot._pt_left = &pt_rb_tree->_t_rbroot;
     pt_rb_tree->_t_rbroot._pt_right = &pt_rb_tree->_t_rbroot;
     pt_rb_tree->_t_nodecount = 0;
+    _alloc_release_region(&pt_rb_tree->_t_allocator);
 }
 
 /**
@@ -569,6 +650,27 @@ void _rb_tree_swap(_rb_tree_t* pt_first, _rb_tree_t* pt_second)
     }
 }
 
+/**
+ * Move the datas of rb tree into uninitialized memory.
+ */
+void _rb_tree_relocate(_rb_tree_t* pt_target, _rb_tree_t* pt_source)
+{
+    assert(pt_target != NULL);
+    assert(pt_source != NULL);
+    assert(_rb_tree_is_inited(pt_source));
+    assert(pt_target != pt_source);
+
+    *pt_target = *pt_source;
+
+    /* the root and the header point to each other, so they are fixed for new address */
+    if (_rb_tree_empty(pt_target)) {
+        pt_target->_t_rbroot._pt_left = &pt_target->_t_rbroot;
+        pt_target->_t_rbroot._pt_right = &pt_target->_t_rbroot;
+    } else {
+        pt_target->_t_rbroot._pt_parent->_pt_parent = &pt_target->_t_rbroot;
+    }
+}
+
 /**
  * Return the number of specific elements in an rb tree
  */
@@ -592,8 +694,7 @@ _rb_tree_iterator_t _rb_tree_lower_bound(const _rb_tree_t* cpt_rb_tree, const vo
     _rbnode_t*          pt_cur = NULL;
     _rbnode_t*          pt_prev = NULL;
     _rb_tree_iterator_t it_iter;
-    bool_t              b_less = false;
-    bool_t              b_greater = false;
+    int                 n_result = 0;
 
     assert(cpt_rb_tree != NULL);
     assert(cpv_value != NULL);
@@ -605,21 +706,17 @@ _rb_tree_iterator_t _rb_tree_lower_bound(const _rb_tree_t* cpt_rb_tree, const vo
     if (!_rb_tree_empty(cpt_rb_tree)) {
         pt_prev = cpt_rb_tree->_t_rbroot._pt_parent;
 
-        b_less = b_greater = _GET_RB_TREE_TYPE_SIZE(cpt_rb_tree);
-        _rb_tree_elem_compare_auxiliary(cpt_rb_tree, cpv_value, pt_prev->_pby_data, &b_less);
-        _rb_tree_elem_compare_auxiliary(cpt_rb_tree, pt_prev->_pby_data, cpv_value, &b_greater);
+        n_result = _rb_tree_elem_three_way_compare_auxiliary(cpt_rb_tree, cpv_value, pt_prev->_pby_data);
 
-        pt_cur = (b_less || !b_greater) ? pt_prev->_pt_left : pt_prev->_pt_right;
+        pt_cur = n_result <= 0 ? pt_prev->_pt_left : pt_prev->_pt_right;
         while (pt_cur != NULL) {
             pt_prev = pt_cur;
-            b_less = b_greater = _GET_RB_TREE_TYPE_SIZE(cpt_rb_tree);
-            _rb_tree_elem_compare_auxiliary(cpt_rb_tree, cpv_value, pt_prev->_pby_data, &b_less);
-            _rb_tree_elem_compare_auxiliary(cpt_rb_tree, pt_prev->_pby_data, cpv_value, &b_greater);
+            n_result = _rb_tree_elem_three_way_compare_auxiliary(cpt_rb_tree, cpv_value, pt_prev->_pby_data);
 
-            pt_cur = (b_less || !b_greater) ? pt_prev->_pt_left : pt_prev->_pt_right;
+            pt_cur = n_result <= 0 ? pt_prev->_pt_left : pt_prev->_pt_right;
         }
 
-        if (b_less || !b_greater) {
+        if (n_result <= 0) {
             assert(pt_prev->_pt_left == NULL);
             _RB_TREE_ITERATOR_COREPOS(it_iter) = (_byte_t*)pt_prev;
             assert(_rb_tree_iterator_belong_to_rb_tree(cpt_rb_tree, it_iter));
@@ -781,7 +878,7 @@ void _rb_tree_insert_equal_array(_rb_tree_t* pt_rb_tree, const void* cpv_array,
      * the elements of c builtin array are element itself, but the elements of 
      * c string, user define or cstl are pointer of element.
      */
-    if (strncmp(_GET_RB_TREE_TYPE_BASENAME(pt_rb_tree), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_RB_TREE_TYPE_ID(pt_rb_tree) == _TYPE_ID_C_STRING) {
         /*
          * We need built a string_t for c string element.
          */
@@ -839,7 +936,7 @@ void _rb_tree_insert_unique_array(_rb_tree_t* pt_rb_tree, const void* cpv_array,
      * the elements of c builtin array are element itself, but the elements of 
      * c string, user define or cstl are pointer of element.
      */
-    if (strncmp(_GET_RB_TREE_TYPE_BASENAME(pt_rb_tree), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_RB_TREE_TYPE_ID(pt_rb_tree) == _TYPE_ID_C_STRING) {
         /*
          * We need built a string_t for c string element.
          */
@@ -1179,7 +1276,7 @@ void _rb_tree_erase_pos(_rb_tree_t* pt_rb_tree, _rb_tree_iterator_t it_pos)
     b_result = _GET_RB_TREE_TYPE_SIZE(pt_rb_tree);
     _GET_RB_TREE_TYPE_DESTROY_FUNCTION(pt_rb_tree)(pt_cur->_pby_data, &b_result);
     assert(b_result);
-    _alloc_deallocate(&pt_rb_tree->_t_allocator, pt_cur, _RB_TREE_NODE_SIZE(_GET_RB_TREE_TYPE_SIZE(pt_rb_tree)), 1);
+    _alloc_deallocate(&pt_rb_tree->_t_allocator, pt_cur, pt_rb_tree->_t_nodesize, 1);
     pt_rb_tree->_t_nodecount--;
     /* update the left and right pointer */
     if (pt_rb_tree->_t_nodecount == 0) {
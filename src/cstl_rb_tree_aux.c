@@ -26,12 +26,14 @@
 #include <cstl/cstl_types.h>
 #include <cstl/citerator.h>
 #include <cstl/cstring.h>
+#include <cstl/cutility.h>
 
 #include <cstl/cstl_rb_tree_iterator.h>
 #include <cstl/cstl_rb_tree_private.h>
 #include <cstl/cstl_rb_tree.h>
 
 #include "cstl_rb_tree_aux.h"
+#include "cstl_map_aux.h"
 
 /** local constant declaration and local macro section **/
 
@@ -216,7 +218,7 @@ _rbnode_t* _rb_tree_destroy_subtree(_rb_tree_t* pt_rb_tree, _rbnode_t* pt_root)
         b_result = _GET_RB_TREE_TYPE_SIZE(pt_rb_tree);
         _GET_RB_TREE_TYPE_DESTROY_FUNCTION(pt_rb_tree)(pt_root->_pby_data, &b_result);
         assert(b_result);
-        _alloc_deallocate(&pt_rb_tree->_t_allocator, pt_root, _RB_TREE_NODE_SIZE(_GET_RB_TREE_TYPE_SIZE(pt_rb_tree)), 1);
+        _alloc_deallocate(&pt_rb_tree->_t_allocator, pt_root, pt_rb_tree->_t_nodesize, 1);
     }
     
     return NULL;
@@ -227,7 +229,7 @@ _rbnode_t* _rb_tree_destroy_subtree(_rb_tree_t* pt_rb_tree, _rbnode_t* pt_root)
  */
 _rbnode_t* _rb_tree_find_value(const _rb_tree_t* cpt_rb_tree, const _rbnode_t* cpt_root, const void* cpv_value)
 {
-    bool_t b_result = false;
+    int n_result = 0;
 
     assert(cpt_rb_tree != NULL);
     assert(cpv_value != NULL);
@@ -237,16 +239,14 @@ _rbnode_t* _rb_tree_find_value(const _rb_tree_t* cpt_rb_tree, const _rbnode_t* c
         return NULL;
     }
 
-    b_result = _GET_RB_TREE_TYPE_SIZE(cpt_rb_tree);
-    _rb_tree_elem_compare_auxiliary(cpt_rb_tree, cpv_value, cpt_root->_pby_data, &b_result);
-    if (b_result) {
+    n_result = _rb_tree_elem_three_way_compare_auxiliary(cpt_rb_tree, cpv_value, cpt_root->_pby_data);
+    if (n_result < 0) {
         return _rb_tree_find_value(cpt_rb_tree, cpt_root->_pt_left, cpv_value);
+    } else if (n_result > 0) {
+        return _rb_tree_find_value(cpt_rb_tree, cpt_root->_pt_right, cpv_value);
+    } else {
+        return (_rbnode_t*)cpt_root;
     }
-
-    b_result = _GET_RB_TREE_TYPE_SIZE(cpt_rb_tree);
-    _rb_tree_elem_compare_auxiliary(cpt_rb_tree, cpt_root->_pby_data, cpv_value, &b_result);
-    
-    return b_result ? _rb_tree_find_value(cpt_rb_tree, cpt_root->_pt_right, cpv_value) : (_rbnode_t*)cpt_root;
 }
 
 /**
@@ -312,10 +312,9 @@ _rbnode_t* _rb_tree_insert_rbnode(_rb_tree_t* pt_rb_tree, const void* cpv_value)
     /* if the rb tree is empty */
     if (_rb_tree_empty(pt_rb_tree)) {
         /* allocat a new root */
-        pt_cur = _alloc_allocate(
-            (_alloc_t*)&pt_rb_tree->_t_allocator, _RB_TREE_NODE_SIZE(_GET_RB_TREE_TYPE_SIZE(pt_rb_tree)), 1);
+        pt_cur = _alloc_allocate((_alloc_t*)&pt_rb_tree->_t_allocator, pt_rb_tree->_t_nodesize, 1);
         assert(pt_cur != NULL);
-        _rb_tree_init_elem_auxiliary(pt_rb_tree, pt_cur);
+        _rb_tree_init_node_auxiliary(pt_rb_tree, pt_cur);
         /* set its color is BLACK */
         pt_cur->_pt_left = pt_cur->_pt_right = NULL;
         pt_cur->_t_color = _COLOR_BLACK;
@@ -343,10 +342,9 @@ _rbnode_t* _rb_tree_insert_rbnode(_rb_tree_t* pt_rb_tree, const void* cpv_value)
         }
 
         /* allocate new node */
-        pt_cur = _alloc_allocate(
-            (_alloc_t*)&pt_rb_tree->_t_allocator, _RB_TREE_NODE_SIZE(_GET_RB_TREE_TYPE_SIZE(pt_rb_tree)), 1);
+        pt_cur = _alloc_allocate((_alloc_t*)&pt_rb_tree->_t_allocator, pt_rb_tree->_t_nodesize, 1);
         assert(pt_cur != NULL);
-        _rb_tree_init_elem_auxiliary(pt_rb_tree, pt_cur);
+        _rb_tree_init_node_auxiliary(pt_rb_tree, pt_cur);
 
         pt_cur->_pt_left = pt_cur->_pt_right = NULL;
         pt_cur->_t_color = _COLOR_RED;
@@ -1036,6 +1034,26 @@ void _rb_tree_init_elem_auxiliary(_rb_tree_t* pt_rb_tree, _rbnode_t* pt_node)
     }
 }
 
+/**
+ * Initialize the element of new node auxiliary function
+ */
+void _rb_tree_init_node_auxiliary(_rb_tree_t* pt_rb_tree, _rbnode_t* pt_node)
+{
+    assert(pt_rb_tree != NULL);
+    assert(pt_node != NULL);
+    assert(_rb_tree_is_inited(pt_rb_tree) || _rb_tree_is_created(pt_rb_tree));
+
+    /* the first and second of pair element are stored inline after the pair in the same node */
+    if (pt_rb_tree->_t_nodesize > _RB_TREE_NODE_SIZE(_GET_RB_TREE_TYPE_SIZE(pt_rb_tree))) {
+        char s_elemtypename[_TYPE_NAME_SIZE + 1];
+        _type_get_elem_typename(_GET_RB_TREE_TYPE_NAME(pt_rb_tree), s_elemtypename);
+
+        _pair_init_inline((pair_t*)pt_node->_pby_data, s_elemtypename);
+    } else {
+        _rb_tree_init_elem_auxiliary(pt_rb_tree, pt_node);
+    }
+}
+
 /**
  * Element compare function auxiliary
  */
@@ -1048,7 +1066,7 @@ void _rb_tree_elem_compare_auxiliary(
     assert(pv_output != NULL); 
     assert(_rb_tree_is_inited(cpt_rb_tree));
 
-    if (strncmp(_GET_RB_TREE_TYPE_BASENAME(cpt_rb_tree), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0 &&
+    if (_GET_RB_TREE_TYPE_ID(cpt_rb_tree) == _TYPE_ID_C_STRING &&
         cpt_rb_tree->_t_compare != _GET_RB_TREE_TYPE_LESS_FUNCTION(cpt_rb_tree)) {
         cpt_rb_tree->_t_compare(string_c_str((string_t*)cpv_first), string_c_str((string_t*)cpv_second), pv_output);
     } else {
@@ -1056,6 +1074,42 @@ void _rb_tree_elem_compare_auxiliary(
     }
 }
 
+/**
+ * Element three-way compare function auxiliary
+ */
+int _rb_tree_elem_three_way_compare_auxiliary(
+    const _rb_tree_t* cpt_rb_tree, const void* cpv_first, const void* cpv_second)
+{
+    int    n_result = 0;
+    bool_t b_result = false;
+
+    assert(cpt_rb_tree != NULL);
+    assert(cpv_first != NULL);
+    assert(cpv_second != NULL);
+    assert(_rb_tree_is_inited(cpt_rb_tree));
+
+    /* the three-way compare of element type agrees with the less of element type only */
+    if (cpt_rb_tree->_t_compare == _GET_RB_TREE_TYPE_LESS_FUNCTION(cpt_rb_tree) &&
+        _GET_RB_TREE_TYPE_COMPARE_FUNCTION(cpt_rb_tree) != NULL) {
+        _GET_RB_TREE_TYPE_COMPARE_FUNCTION(cpt_rb_tree)(cpv_first, cpv_second, &n_result);
+        return n_result;
+    }
+    /* the pairs of map containers are ordered by keys only */
+    if (_map_key_three_way_compare(cpt_rb_tree->_t_compare, cpv_first, cpv_second, &n_result)) {
+        return n_result;
+    }
+
+    b_result = _GET_RB_TREE_TYPE_SIZE(cpt_rb_tree);
+    _rb_tree_elem_compare_auxiliary(cpt_rb_tree, cpv_first, cpv_second, &b_result);
+    if (b_result) {
+        return -1;
+    }
+    b_result = _GET_RB_TREE_TYPE_SIZE(cpt_rb_tree);
+    _rb_tree_elem_compare_auxiliary(cpt_rb_tree, cpv_second, cpv_first, &b_result);
+
+    return b_result ? 1 : 0;
+}
+
 /** local function implementation section **/
 
 /** eof **/
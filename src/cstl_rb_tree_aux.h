@@ -34,10 +34,12 @@ extern "C" {
 #define _GET_RB_TREE_TYPE_SIZE(pt_rb_tree)             ((pt_rb_tree)->_t_typeinfo._pt_type->_t_typesize)
 #define _GET_RB_TREE_TYPE_NAME(pt_rb_tree)             ((pt_rb_tree)->_t_typeinfo._s_typename)
 #define _GET_RB_TREE_TYPE_BASENAME(pt_rb_tree)         ((pt_rb_tree)->_t_typeinfo._pt_type->_s_typename)
+#define _GET_RB_TREE_TYPE_ID(pt_rb_tree)               ((pt_rb_tree)->_t_typeinfo._pt_type->_t_typeid)
 #define _GET_RB_TREE_TYPE_INIT_FUNCTION(pt_rb_tree)    ((pt_rb_tree)->_t_typeinfo._pt_type->_t_typeinit)
 #define _GET_RB_TREE_TYPE_COPY_FUNCTION(pt_rb_tree)    ((pt_rb_tree)->_t_typeinfo._pt_type->_t_typecopy)
 #define _GET_RB_TREE_TYPE_LESS_FUNCTION(pt_rb_tree)    ((pt_rb_tree)->_t_typeinfo._pt_type->_t_typeless)
 #define _GET_RB_TREE_TYPE_DESTROY_FUNCTION(pt_rb_tree) ((pt_rb_tree)->_t_typeinfo._pt_type->_t_typedestroy)
+#define _GET_RB_TREE_TYPE_COMPARE_FUNCTION(pt_rb_tree) ((pt_rb_tree)->_t_typeinfo._pt_type->_t_typecompare)
 #define _GET_RB_TREE_TYPE_STYLE(pt_rb_tree)            ((pt_rb_tree)->_t_typeinfo._t_style)
 
 /** data type declaration and struct, union, enum section **/
@@ -235,6 +237,16 @@ extern _rbnode_t* _rb_tree_clockwise_rotation(_rbnode_t* pt_root);
  */
 extern void _rb_tree_init_elem_auxiliary(_rb_tree_t* pt_rb_tree, _rbnode_t* pt_node);
 
+/**
+ * Initialize the element of new node auxiliary function
+ * @param pt_rb_tree            rb tree.
+ * @param pt_node               rb node.
+ * @return void.
+ * @remarks if pt_rb_tree == NULL or pt_node == NULL, then the behavior is undefined. pt_rb_tree must be initialized or
+ *          created by _create_rb_tree(), and pt_node must be allocated with _t_nodesize, otherwise the behavior is undefined.
+ */
+extern void _rb_tree_init_node_auxiliary(_rb_tree_t* pt_rb_tree, _rbnode_t* pt_node);
+
 /**
  * Element compare function auxiliary
  * @param cpt_rb_tree           rb tree.
@@ -249,6 +261,20 @@ extern void _rb_tree_init_elem_auxiliary(_rb_tree_t* pt_rb_tree, _rbnode_t* pt_n
 extern void _rb_tree_elem_compare_auxiliary(
     const _rb_tree_t* cpt_rb_tree, const void* cpv_first, const void* cpv_second, void* pv_output);
 
+/**
+ * Element three-way compare function auxiliary
+ * @param cpt_rb_tree           rb tree.
+ * @param cpv_first             first element.
+ * @param cpv_second            second element.
+ * @return negative if the first element is less than the second element, positive if it is greater, otherwise zero.
+ * @remarks if cpt_rb_tree == NULL, cpv_first == NULL or cpv_second == NULL, then the behavior is undefined. cpt_rb_tree
+ *          must be initialized or created by _create_rb_tree(), otherwise the behavior is undefined. The three-way compare function
+ *          of element type is invoked once when the rb tree is ordered by the less function of element type,
+ *          otherwise the compare function of rb tree is invoked twice.
+ */
+extern int _rb_tree_elem_three_way_compare_auxiliary(
+    const _rb_tree_t* cpt_rb_tree, const void* cpv_first, const void* cpv_second);
+
 #ifdef __cplusplus
 }
 #endif
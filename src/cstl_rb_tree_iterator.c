@@ -81,7 +81,7 @@ void _rb_tree_iterator_get_value(_rb_tree_iterator_t it_iter, void* pv_value)
     assert(!_rb_tree_iterator_equal(it_iter, _rb_tree_end(_RB_TREE_ITERATOR_TREE(it_iter))));
 
     /* char* */
-    if (strncmp(_GET_RB_TREE_TYPE_BASENAME(_RB_TREE_ITERATOR_TREE(it_iter)), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_RB_TREE_TYPE_ID(_RB_TREE_ITERATOR_TREE(it_iter)) == _TYPE_ID_C_STRING) {
         *(char**)pv_value = (char*)string_c_str((string_t*)((_rbnode_t*)_RB_TREE_ITERATOR_COREPOS(it_iter))->_pby_data);
     } else {
         bool_t b_result = _GET_RB_TREE_TYPE_SIZE(_RB_TREE_ITERATOR_TREE(it_iter));
@@ -100,7 +100,7 @@ const void* _rb_tree_iterator_get_pointer(_rb_tree_iterator_t it_iter)
     assert(!_rb_tree_iterator_equal(it_iter, _rb_tree_end(_RB_TREE_ITERATOR_TREE(it_iter))));
 
     /* char* */
-    if (strncmp(_GET_RB_TREE_TYPE_BASENAME(_RB_TREE_ITERATOR_TREE(it_iter)), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_RB_TREE_TYPE_ID(_RB_TREE_ITERATOR_TREE(it_iter)) == _TYPE_ID_C_STRING) {
         return (char*)string_c_str((string_t*)((_rbnode_t*)_RB_TREE_ITERATOR_COREPOS(it_iter))->_pby_data);
     } else {
         return ((_rbnode_t*)_RB_TREE_ITERATOR_COREPOS(it_iter))->_pby_data;
@@ -26,6 +26,7 @@
 #include <cstl/cstl_types.h>
 #include <cstl/citerator.h>
 #include <cstl/cstring.h>
+#include <cstl/cutility.h>
 
 #include <cstl/cstl_rb_tree_iterator.h>
 #include <cstl/cstl_rb_tree_private.h>
@@ -63,6 +64,8 @@ bool_t _create_rb_tree_auxiliary(_rb_tree_t* pt_rb_tree, const char* s_typename)
     pt_rb_tree->_t_rbroot._pt_right = NULL;
     pt_rb_tree->_t_rbroot._t_color = _COLOR_RED;
     pt_rb_tree->_t_nodecount = 0;
+    pt_rb_tree->_t_nodesize =
+        _RB_TREE_NODE_SIZE(_GET_RB_TREE_TYPE_SIZE(pt_rb_tree)) + _pair_get_inline_size(&pt_rb_tree->_t_typeinfo);
 
     pt_rb_tree->_t_compare = NULL;
 
@@ -78,8 +81,14 @@ void _rb_tree_destroy_auxiliary(_rb_tree_t* pt_rb_tree)
     assert(pt_rb_tree != NULL);
     assert(_rb_tree_is_inited(pt_rb_tree) || _rb_tree_is_created(pt_rb_tree));
 
-    /* destroy all elements */
-    pt_rb_tree->_t_rbroot._pt_parent = _rb_tree_destroy_subtree(pt_rb_tree, pt_rb_tree->_t_rbroot._pt_parent);
+    /* destroy all elements, the elements in region that need not be destroyed are released with the region */
+    if (_alloc_is_region(&pt_rb_tree->_t_allocator) &&
+        (_type_is_trivially_destructible(&pt_rb_tree->_t_typeinfo) ||
+         _pair_is_inline_trivially_destructible(&pt_rb_tree->_t_typeinfo))) {
+        pt_rb_tree->_t_rbroot._pt_parent = NULL;
+    } else {
+        pt_rb_tree->_t_rbroot._pt_parent = _rb_tree_destroy_subtree(pt_rb_tree, pt_rb_tree->_t_rbroot._pt_parent);
+    }
     assert(pt_rb_tree->_t_rbroot._pt_parent == NULL);
     pt_rb_tree->_t_rbroot._pt_left = &pt_rb_tree->_t_rbroot;
     pt_rb_tree->_t_rbroot._pt_right = &pt_rb_tree->_t_rbroot;
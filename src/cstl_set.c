@@ -30,6 +30,8 @@
 #include "cstl_set_aux.h"
 
 /** local constant declaration and local macro section **/
+/* the number of elements that are passed to the tree together in batch find */
+#define _SET_FIND_BATCH_COUNT 16
 
 /** local data type declaration and local struct, union, enum section **/
 
@@ -216,6 +218,24 @@ size_t set_max_size(const set_t* cpset_set)
 #endif
 }
 
+/**
+ * Get the memory that is held by the set.
+ */
+size_t set_memory_usage(const set_t* cpset_set)
+{
+    size_t t_usage = 0;
+
+    assert(cpset_set != NULL);
+
+#ifdef CSTL_SET_AVL_TREE
+    t_usage = _avl_tree_memory_usage(&cpset_set->_t_tree);
+#else
+    t_usage = _rb_tree_memory_usage(&cpset_set->_t_tree);
+#endif
+
+    return sizeof(set_t) + t_usage;
+}
+
 /**
  * Return an iterator that addresses the first element in the set.
  */
@@ -506,6 +526,148 @@ void set_erase_range(set_t* pset_set, set_iterator_t it_begin, set_iterator_t it
 #endif
 }
 
+/**
+ * Find specific element that is pointed by pointer.
+ */
+set_iterator_t set_find_ptr(const set_t* cpset_set, const void* cpv_value)
+{
+    set_iterator_t it_iter;
+
+    assert(cpset_set != NULL);
+    assert(cpv_value != NULL);
+
+    /* the element of c string is string_t, so it is built from char* like the variable argument */
+    if (_GET_SET_TYPE_ID(cpset_set) == _TYPE_ID_C_STRING) {
+        return _set_find(cpset_set, cpv_value);
+    }
+
+#ifdef CSTL_SET_AVL_TREE
+    it_iter = _avl_tree_find(&cpset_set->_t_tree, cpv_value);
+#else
+    it_iter = _rb_tree_find(&cpset_set->_t_tree, cpv_value);
+#endif
+
+    _ITERATOR_CONTAINER(it_iter) = (set_t*)cpset_set;
+    _SET_ITERATOR_CONTAINER_TYPE(it_iter) = _SET_CONTAINER;
+    _SET_ITERATOR_ITERATOR_TYPE(it_iter) = _BIDIRECTIONAL_ITERATOR;
+
+    return it_iter;
+}
+
+/**
+ * Return the number of specific elements that is pointed by pointer.
+ */
+size_t set_count_ptr(const set_t* cpset_set, const void* cpv_value)
+{
+    assert(cpset_set != NULL);
+    assert(cpv_value != NULL);
+
+    /* the element of c string is string_t, so it is built from char* like the variable argument */
+    if (_GET_SET_TYPE_ID(cpset_set) == _TYPE_ID_C_STRING) {
+        return _set_count(cpset_set, cpv_value);
+    }
+
+#ifdef CSTL_SET_AVL_TREE
+    return _avl_tree_count(&cpset_set->_t_tree, cpv_value);
+#else
+    return _rb_tree_count(&cpset_set->_t_tree, cpv_value);
+#endif
+}
+
+/**
+ * Find a batch of elements in array.
+ */
+void set_find_batch(const set_t* cpset_set, const void* cpv_values, size_t t_count, set_iterator_t* pit_result)
+{
+    const void* acpv_value[_SET_FIND_BATCH_COUNT];
+    size_t      t_batch = 0;
+    size_t      i = 0;
+    size_t      j = 0;
+
+    assert(cpset_set != NULL);
+    assert(cpv_values != NULL);
+    assert(pit_result != NULL);
+
+    /* the element of c string is string_t, so it is built from char* like the variable argument one by one */
+    if (_GET_SET_TYPE_ID(cpset_set) == _TYPE_ID_C_STRING) {
+        for (i = 0; i < t_count; ++i) {
+            assert(*((char**)cpv_values + i) != NULL);
+            pit_result[i] = _set_find(cpset_set, *((char**)cpv_values + i));
+        }
+        return;
+    }
+
+    for (i = 0; i < t_count; i += t_batch) {
+        t_batch = t_count - i < _SET_FIND_BATCH_COUNT ? t_count - i : _SET_FIND_BATCH_COUNT;
+        for (j = 0; j < t_batch; ++j) {
+            if (_GET_SET_TYPE_STYLE(cpset_set) == _TYPE_C_BUILTIN) {
+                acpv_value[j] = (const _byte_t*)cpv_values + (i + j) * _GET_SET_TYPE_SIZE(cpset_set);
+            } else {
+                acpv_value[j] = *((void**)cpv_values + i + j);
+            }
+        }
+
+#ifdef CSTL_SET_AVL_TREE
+        _avl_tree_find_batch(&cpset_set->_t_tree, acpv_value, t_batch, pit_result + i);
+#else
+        _rb_tree_find_batch(&cpset_set->_t_tree, acpv_value, t_batch, pit_result + i);
+#endif
+        for (j = 0; j < t_batch; ++j) {
+            _ITERATOR_CONTAINER(pit_result[i + j]) = (set_t*)cpset_set;
+            _SET_ITERATOR_CONTAINER_TYPE(pit_result[i + j]) = _SET_CONTAINER;
+            _SET_ITERATOR_ITERATOR_TYPE(pit_result[i + j]) = _BIDIRECTIONAL_ITERATOR;
+        }
+    }
+}
+
+/**
+ * Inserts an element that is pointed by pointer into a set.
+ */
+set_iterator_t set_insert_ptr(set_t* pset_set, const void* cpv_value)
+{
+    set_iterator_t it_iter;
+
+    assert(pset_set != NULL);
+    assert(cpv_value != NULL);
+
+    /* the element of c string is string_t, so it is built from char* like the variable argument */
+    if (_GET_SET_TYPE_ID(pset_set) == _TYPE_ID_C_STRING) {
+        return _set_insert(pset_set, cpv_value);
+    }
+
+#ifdef CSTL_SET_AVL_TREE
+    it_iter = _avl_tree_insert_unique(&pset_set->_t_tree, cpv_value);
+#else
+    it_iter = _rb_tree_insert_unique(&pset_set->_t_tree, cpv_value);
+#endif
+
+    _ITERATOR_CONTAINER(it_iter) = pset_set;
+    _SET_ITERATOR_CONTAINER_TYPE(it_iter) = _SET_CONTAINER;
+    _SET_ITERATOR_ITERATOR_TYPE(it_iter) = _BIDIRECTIONAL_ITERATOR;
+
+    return it_iter;
+}
+
+/**
+ * Erase an element from a set that match a element that is pointed by pointer.
+ */
+size_t set_erase_ptr(set_t* pset_set, const void* cpv_value)
+{
+    assert(pset_set != NULL);
+    assert(cpv_value != NULL);
+
+    /* the element of c string is string_t, so it is built from char* like the variable argument */
+    if (_GET_SET_TYPE_ID(pset_set) == _TYPE_ID_C_STRING) {
+        return _set_erase(pset_set, cpv_value);
+    }
+
+#ifdef CSTL_SET_AVL_TREE
+    return _avl_tree_erase(&pset_set->_t_tree, cpv_value);
+#else
+    return _rb_tree_erase(&pset_set->_t_tree, cpv_value);
+#endif
+}
+
 /** local function implementation section **/
 
 /** eof **/
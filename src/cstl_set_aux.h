@@ -34,6 +34,7 @@ extern "C" {
 #define _GET_SET_TYPE_SIZE(pset_set)             ((pset_set)->_t_tree._t_typeinfo._pt_type->_t_typesize)
 #define _GET_SET_TYPE_NAME(pset_set)             ((pset_set)->_t_tree._t_typeinfo._s_typename)
 #define _GET_SET_TYPE_BASENAME(pset_set)         ((pset_set)->_t_tree._t_typeinfo._pt_type->_s_typename)
+#define _GET_SET_TYPE_ID(pset_set)               ((pset_set)->_t_tree._t_typeinfo._pt_type->_t_typeid)
 #define _GET_SET_TYPE_INIT_FUNCTION(pset_set)    ((pset_set)->_t_tree._t_typeinfo._pt_type->_t_typeinit)
 #define _GET_SET_TYPE_COPY_FUNCTION(pset_set)    ((pset_set)->_t_tree._t_typeinfo._pt_type->_t_typecopy)
 #define _GET_SET_TYPE_LESS_FUNCTION(pset_set)    ((pset_set)->_t_tree._t_typeinfo._pt_type->_t_typeless)
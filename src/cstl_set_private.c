@@ -52,6 +52,36 @@ set_t* _create_set(const char* s_typename)
 #endif
 }
 
+/**
+ * Create set container that uses user defined allocator.
+ */
+set_t* _create_set_with_allocator(const allocator_t* cpt_allocator, const char* s_typename)
+{
+    set_t* pset_set = NULL;
+
+    assert(cpt_allocator != NULL);
+
+    if ((pset_set = _create_set(s_typename)) != NULL) {
+        _alloc_set_allocator(&pset_set->_t_tree._t_allocator, cpt_allocator);
+    }
+
+    return pset_set;
+}
+
+/**
+ * Create set container that allocates memory from region.
+ */
+set_t* _create_set_with_region(const char* s_typename)
+{
+    set_t* pset_set = NULL;
+
+    if ((pset_set = _create_set(s_typename)) != NULL) {
+        _alloc_set_region(&pset_set->_t_tree._t_allocator);
+    }
+
+    return pset_set;
+}
+
 /**
  * Create set container auxiliary function.
  */
@@ -156,7 +156,7 @@ void slist_init_copy_array(slist_t* pslist_slist, const void* cpv_array, size_t
      * the elements of c builtin array are element itself, but the elements of 
      * c string, user define or cstl are pointer of element.
      */
-    if (strncmp(_GET_SLIST_TYPE_BASENAME(pslist_slist), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_SLIST_TYPE_ID(pslist_slist) == _TYPE_ID_C_STRING) {
         /*
          * We need built a string_t for c string element.
          */
@@ -283,6 +283,20 @@ size_t slist_max_size(const slist_t* cpslist_slist)
     return (size_t)(-1) / _GET_SLIST_TYPE_SIZE(cpslist_slist);
 }
 
+/**
+ * Get the memory that is held by the slist.
+ */
+size_t slist_memory_usage(const slist_t* cpslist_slist)
+{
+    _allocstat_t t_stat;
+
+    assert(cpslist_slist != NULL);
+    assert(_slist_is_inited(cpslist_slist));
+
+    _alloc_get_stat(&cpslist_slist->_t_allocator, &t_stat);
+    return sizeof(slist_t) + t_stat._t_livesize + t_stat._t_cachedsize;
+}
+
 /**
  * Assign slist element with an exist slist container.
  */
@@ -355,7 +369,7 @@ void slist_assign_array(slist_t* pslist_slist, const void* cpv_array, size_t t_c
      * the elements of c builtin array are element itself, but the elements of 
      * c string, user define or cstl are pointer of element.
      */
-    if (strncmp(_GET_SLIST_TYPE_BASENAME(pslist_slist), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_SLIST_TYPE_ID(pslist_slist) == _TYPE_ID_C_STRING) {
         /*
          * We need built a string_t for c string element.
          */
@@ -427,7 +441,7 @@ void* slist_front(const slist_t* cpslist_slist)
     assert(!slist_empty(cpslist_slist));
 
     /* char* */
-    if (strncmp(_GET_SLIST_TYPE_BASENAME(cpslist_slist), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_SLIST_TYPE_ID(cpslist_slist) == _TYPE_ID_C_STRING) {
         return (char*)string_c_str((string_t*)cpslist_slist->_t_head._pt_next->_pby_data);
     } else {
         return cpslist_slist->_t_head._pt_next->_pby_data;
@@ -561,7 +575,7 @@ void slist_insert_array(slist_t* pslist_slist, slist_iterator_t it_pos, const vo
          * the elements of c builtin array are element itself, but the elements of 
          * c string, user define or cstl are pointer of element.
          */
-        if (strncmp(_GET_SLIST_TYPE_BASENAME(pslist_slist), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+        if (_GET_SLIST_TYPE_ID(pslist_slist) == _TYPE_ID_C_STRING) {
             /*
              * We need built a string_t for c string element.
              */
@@ -721,7 +735,7 @@ void slist_insert_after_array(
      * the elements of c builtin array are element itself, but the elements of 
      * c string, user define or cstl are pointer of element.
      */
-    if (strncmp(_GET_SLIST_TYPE_BASENAME(pslist_slist), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_SLIST_TYPE_ID(pslist_slist) == _TYPE_ID_C_STRING) {
         /*
          * We need built a string_t for c string element.
          */
@@ -1314,7 +1328,13 @@ void slist_clear(slist_t* pslist_slist)
     assert(pslist_slist != NULL);
     assert(_slist_is_inited(pslist_slist));
 
-    slist_erase_range(pslist_slist, slist_begin(pslist_slist), slist_end(pslist_slist));
+    /* the elements in region that need not be destroyed are released with the region at once */
+    if (_alloc_is_region(&pslist_slist->_t_allocator) && _type_is_trivially_destructible(&pslist_slist->_t_typeinfo)) {
+        pslist_slist->_t_head._pt_next = NULL;
+    } else {
+        slist_erase_range(pslist_slist, slist_begin(pslist_slist), slist_end(pslist_slist));
+    }
+    _alloc_release_region(&pslist_slist->_t_allocator);
 }
 
 /**
@@ -1493,6 +1513,30 @@ bool_t slist_greater_equal(const slist_t* cpslist_first, const slist_t* cpslist_
     return (slist_greater(cpslist_first, cpslist_second) || slist_equal(cpslist_first, cpslist_second)) ? true : false;
 }
 
+/**
+ * Add element that is pointed by pointer at the begin of slist container.
+ */
+void slist_push_front_ptr(slist_t* pslist_slist, const void* cpv_value)
+{
+    _slistnode_t* pt_node = NULL;
+
+    assert(pslist_slist != NULL);
+    assert(_slist_is_inited(pslist_slist));
+    assert(cpv_value != NULL);
+
+    pt_node = _alloc_allocate(&pslist_slist->_t_allocator, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+    assert(pt_node != NULL);
+    /* the trivially copyable element is overwritten entirely, so it need not be initialized */
+    if (!_type_is_trivially_copyable(&pslist_slist->_t_typeinfo)) {
+        _slist_init_node_auxiliary(pslist_slist, pt_node);
+    }
+    _type_get_ptr_value(&pslist_slist->_t_typeinfo, cpv_value, pt_node->_pby_data);
+
+    /* insert the element after the head */
+    pt_node->_pt_next = pslist_slist->_t_head._pt_next;
+    pslist_slist->_t_head._pt_next = pt_node;
+}
+
 /** local function implementation section **/
 
 /** eof **/
@@ -34,6 +34,7 @@ extern "C" {
 #define _GET_SLIST_TYPE_SIZE(pslist_slist)             ((pslist_slist)->_t_typeinfo._pt_type->_t_typesize)
 #define _GET_SLIST_TYPE_NAME(pslist_slist)             ((pslist_slist)->_t_typeinfo._s_typename)
 #define _GET_SLIST_TYPE_BASENAME(pslist_slist)         ((pslist_slist)->_t_typeinfo._pt_type->_s_typename)
+#define _GET_SLIST_TYPE_ID(pslist_slist)               ((pslist_slist)->_t_typeinfo._pt_type->_t_typeid)
 #define _GET_SLIST_TYPE_INIT_FUNCTION(pslist_slist)    ((pslist_slist)->_t_typeinfo._pt_type->_t_typeinit)
 #define _GET_SLIST_TYPE_COPY_FUNCTION(pslist_slist)    ((pslist_slist)->_t_typeinfo._pt_type->_t_typecopy)
 #define _GET_SLIST_TYPE_LESS_FUNCTION(pslist_slist)    ((pslist_slist)->_t_typeinfo._pt_type->_t_typeless)
@@ -67,7 +67,7 @@ void _slist_iterator_get_value(slist_iterator_t it_iter, void* pv_value)
     assert(!iterator_equal(it_iter, slist_end(_SLIST_ITERATOR_CONTAINER(it_iter))));
 
     /* char* */
-    if (strncmp(_GET_SLIST_TYPE_BASENAME(_SLIST_ITERATOR_CONTAINER(it_iter)), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_SLIST_TYPE_ID(_SLIST_ITERATOR_CONTAINER(it_iter)) == _TYPE_ID_C_STRING) {
         *(char**)pv_value = (char*)string_c_str((string_t*)((_slistnode_t*)_SLIST_ITERATOR_COREPOS(it_iter))->_pby_data);
     } else {
         bool_t b_result = _GET_SLIST_TYPE_SIZE(_SLIST_ITERATOR_CONTAINER(it_iter));
@@ -87,7 +87,7 @@ void _slist_iterator_set_value(slist_iterator_t it_iter, const void* cpv_value)
     assert(!iterator_equal(it_iter, slist_end(_SLIST_ITERATOR_CONTAINER(it_iter))));
 
     /* char* */
-    if (strncmp(_GET_SLIST_TYPE_BASENAME(_SLIST_ITERATOR_CONTAINER(it_iter)), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_SLIST_TYPE_ID(_SLIST_ITERATOR_CONTAINER(it_iter)) == _TYPE_ID_C_STRING) {
         string_assign_cstr((string_t*)((_slistnode_t*)_SLIST_ITERATOR_COREPOS(it_iter))->_pby_data, (char*)cpv_value);
     } else {
         bool_t b_result = _GET_SLIST_TYPE_SIZE(_SLIST_ITERATOR_CONTAINER(it_iter));
@@ -119,7 +119,7 @@ const void* _slist_iterator_get_pointer(slist_iterator_t it_iter)
     assert(!iterator_equal(it_iter, slist_end(_SLIST_ITERATOR_CONTAINER(it_iter))));
 
     /* char* */
-    if (strncmp(_GET_SLIST_TYPE_BASENAME(_SLIST_ITERATOR_CONTAINER(it_iter)), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_SLIST_TYPE_ID(_SLIST_ITERATOR_CONTAINER(it_iter)) == _TYPE_ID_C_STRING) {
         return string_c_str((string_t*)((_slistnode_t*)_SLIST_ITERATOR_COREPOS(it_iter))->_pby_data);
     } else {
         return ((_slistnode_t*)_SLIST_ITERATOR_COREPOS(it_iter))->_pby_data;
@@ -64,6 +64,36 @@ slist_t* _create_slist(const char* s_typename)
     return pslist_new;
 }
 
+/**
+ * Create slist container that uses user defined allocator.
+ */
+slist_t* _create_slist_with_allocator(const allocator_t* cpt_allocator, const char* s_typename)
+{
+    slist_t* pslist_slist = NULL;
+
+    assert(cpt_allocator != NULL);
+
+    if ((pslist_slist = _create_slist(s_typename)) != NULL) {
+        _alloc_set_allocator(&pslist_slist->_t_allocator, cpt_allocator);
+    }
+
+    return pslist_slist;
+}
+
+/**
+ * Create slist container that allocates memory from region.
+ */
+slist_t* _create_slist_with_region(const char* s_typename)
+{
+    slist_t* pslist_slist = NULL;
+
+    if ((pslist_slist = _create_slist(s_typename)) != NULL) {
+        _alloc_set_region(&pslist_slist->_t_allocator);
+    }
+
+    return pslist_slist;
+}
+
 /**
  * Create slist container auxiliary function.
  */
@@ -151,6 +181,11 @@ void _slist_destroy_auxiliary(slist_t* pslist_slist)
     assert(pslist_slist != NULL);
     assert(_slist_is_inited(pslist_slist) || _slist_is_created(pslist_slist));
 
+    /* the elements in region that need not be destroyed are released with the region at once */
+    if (_alloc_is_region(&pslist_slist->_t_allocator) && _type_is_trivially_destructible(&pslist_slist->_t_typeinfo)) {
+        pslist_slist->_t_head._pt_next = NULL;
+    }
+
     /* _alloc_deallocate all nodes in slist */
     while (pslist_slist->_t_head._pt_next != NULL) {
         /* take out each node from the slist */
@@ -260,6 +260,22 @@ bool_t stack_greater_equal(const stack_t* cpsk_first, const stack_t* cpsk_second
 #endif
 }
 
+/**
+ * Add element that is pointed by pointer at the top of stack.
+ */
+void stack_push_ptr(stack_t* psk_stack, const void* cpv_value)
+{
+    assert(psk_stack != NULL);
+
+#if defined (CSTL_STACK_VECTOR_SEQUENCE)
+    vector_push_back_ptr(&psk_stack->_t_sequence, cpv_value);
+#elif defined (CSTL_STACK_LIST_SEQUENCE)
+    list_push_back_ptr(&psk_stack->_t_sequence, cpv_value);
+#else
+    deque_push_back_ptr(&psk_stack->_t_sequence, cpv_value);
+#endif
+}
+
 /** local function implementation section **/
 
 /** eof **/
@@ -37,14 +37,27 @@
 #include <cstl/chash_map.h>
 #include <cstl/cstring.h>
 #include <cstl/cutility.h>
+#ifdef _MSC_VER
+#   include <windows.h>
+#endif
 
 #include "cstl_types_aux.h"
 #include "cstl_types_builtin.h"
 #include "cstl_types_parse.h"
+#include "cstl_hashtable_aux.h"
 
 /** local constant declaration and local macro section **/
+/* the element that is not larger than the buffer is swapped without allocating memory */
+#define _TYPE_SWAP_BUFFER_SIZE  256
 
 /** local data type declaration and local struct, union, enum section **/
+/* the swap buffer is aligned for any element type */
+typedef union _tagtypeswapbuffer
+{
+    _byte_t     _aby_buffer[_TYPE_SWAP_BUFFER_SIZE];
+    long double _ld_align;
+    void*       _pv_align;
+}_typeswapbuffer_t;
 
 /** local function prototype section **/
 
@@ -86,10 +99,11 @@ void _type_debug(void)
     for (j = 0; j < 1024; ++j) {
         pt_type = apt_type[j];
         if (pt_type != NULL) {
-            printf("%p\n----------\n%lu,%s,%p,%p,%p,%p\n========================\n",
+            printf("%p\n----------\n%lu,%s,%p,%p,%p,%p,%p,%p,%p\n========================\n",
                 pt_type, (unsigned long)pt_type->_t_typesize, pt_type->_s_typename,
                 pt_type->_t_typecopy, pt_type->_t_typeless,
-                pt_type->_t_typeinit, pt_type->_t_typedestroy);
+                pt_type->_t_typeinit, pt_type->_t_typedestroy, pt_type->_t_typehash, pt_type->_t_typecompare,
+                pt_type->_t_typemove);
         }
     }
 }
@@ -98,6 +112,14 @@ bool_t _type_register(
     size_t t_typesize, const char* s_typename,
     ufun_t t_typeinit, bfun_t t_typecopy,
     bfun_t t_typeless, ufun_t t_typedestroy)
+{
+    return _type_register_ex(t_typesize, s_typename, t_typeinit, t_typecopy, t_typeless, t_typedestroy, NULL, NULL);
+}
+
+bool_t _type_register_ex(
+    size_t t_typesize, const char* s_typename,
+    ufun_t t_typeinit, bfun_t t_typecopy,
+    bfun_t t_typeless, ufun_t t_typedestroy, ufun_t t_typehash, bfun_t t_typecompare)
 {
     char         s_formalname[_TYPE_NAME_SIZE + 1];
     _typestyle_t t_style = _TYPE_INVALID;
@@ -108,8 +130,14 @@ bool_t _type_register(
 
     /* the main aim is getting formal name */
     t_style = _type_get_style(s_typename, s_formalname);
-    if (t_style == _TYPE_INVALID || _type_is_registered(s_formalname) != NULL || strlen(s_typename) > _TYPE_NAME_SIZE) {
-         return false;
+    if (t_style == _TYPE_INVALID || strlen(s_typename) > _TYPE_NAME_SIZE) {
+        return false;
+    }
+
+    _type_lock();
+    if (_type_is_registered(s_formalname) != NULL) {
+        _type_unlock();
+        return false;
     } else {
         size_t       t_pos = 0;
         _typenode_t* pt_node = (_typenode_t*)_alloc_allocate(&_gt_typeregister._t_allocator, sizeof(_typenode_t), 1);
@@ -121,22 +149,90 @@ bool_t _type_register(
         /* register the new type */
         strncpy(pt_node->_s_typename, s_formalname, _TYPE_NAME_SIZE);
         strncpy(pt_type->_s_typename, s_formalname, _TYPE_NAME_SIZE);
+        pt_type->_t_typeid = _gt_typeregister._t_nexttypeid++;
         pt_type->_t_typesize = t_typesize;
         pt_type->_t_style = t_style; /* save type style for type duplication between different type style */
         pt_type->_t_typeinit = t_typeinit != NULL ? t_typeinit : _type_init_default;
         pt_type->_t_typecopy = t_typecopy != NULL ? t_typecopy : _type_copy_default;
         pt_type->_t_typeless = t_typeless != NULL ? t_typeless : _type_less_default;
         pt_type->_t_typedestroy = t_typedestroy != NULL ? t_typedestroy : _type_destroy_default;
+        pt_type->_t_typehash = t_typehash != NULL ? t_typehash : _type_hash_default;
+        /* there is no default three-way compare, the containers fall back to two less calls */
+        pt_type->_t_typecompare = t_typecompare;
+        /* the type that uses default functions can be handled as raw memory */
+        pt_type->_n_typetrait = 0;
+        if (pt_type->_t_typeinit == _type_init_default) {
+            pt_type->_n_typetrait |= _TYPE_TRAIT_TRIVIAL_INIT;
+        }
+        if (pt_type->_t_typecopy == _type_copy_default) {
+            pt_type->_n_typetrait |= _TYPE_TRAIT_TRIVIAL_COPY;
+        }
+        if (pt_type->_t_typedestroy == _type_destroy_default) {
+            pt_type->_n_typetrait |= _TYPE_TRAIT_TRIVIAL_DESTROY;
+        }
+        if ((pt_type->_n_typetrait & _TYPE_TRAIT_TRIVIAL_COPY) && (pt_type->_n_typetrait & _TYPE_TRAIT_TRIVIAL_DESTROY)) {
+            pt_type->_n_typetrait |= _TYPE_TRAIT_TRIVIAL_RELOCATE;
+        }
+        /* the other user types are relocated by copying and destroying */
+        pt_type->_t_typemove = NULL;
 
         pt_node->_pt_type = pt_type;
         t_pos = _type_hash(s_formalname);
         pt_node->_pt_next = _gt_typeregister._apt_bucket[t_pos];
+        _TYPE_MEMORY_BARRIER();
         _gt_typeregister._apt_bucket[t_pos] = pt_node;
 
+        _type_cache_invalidate();
+        _type_unlock();
         return true;
     }
 }
 
+bool_t _type_unregister(size_t t_typesize, const char* s_typename)
+{
+    char     s_formalname[_TYPE_NAME_SIZE + 1];
+    _type_t* pt_type = NULL;
+    size_t   i = 0;
+
+    assert(s_typename != NULL);
+
+    if (!_gt_typeregister._t_isinit) {
+        _type_init();
+    }
+
+    /* only user define type can be unregistered */
+    if (strlen(s_typename) > _TYPE_NAME_SIZE ||
+        _type_get_style(s_typename, s_formalname) != _TYPE_USER_DEFINE) {
+        return false;
+    }
+
+    _type_lock();
+    if ((pt_type = _type_is_registered(s_formalname)) == NULL ||
+        pt_type->_t_style != _TYPE_USER_DEFINE || pt_type->_t_typesize != t_typesize) {
+        _type_unlock();
+        return false;
+    }
+
+    /*
+     * remove the registered name and all duplicated names. the removed nodes are not released,
+     * because other threads may be walking through them without lock.
+     */
+    for (i = 0; i < _TYPE_REGISTER_BUCKET_COUNT; ++i) {
+        _typenode_t** ppt_node = &_gt_typeregister._apt_bucket[i];
+        while (*ppt_node != NULL) {
+            if ((*ppt_node)->_pt_type == pt_type) {
+                *ppt_node = (*ppt_node)->_pt_next;
+            } else {
+                ppt_node = &(*ppt_node)->_pt_next;
+            }
+        }
+    }
+
+    _type_cache_invalidate();
+    _type_unlock();
+    return true;
+}
+
 bool_t _type_duplicate(
     size_t t_typesize1, const char* s_typename1,
     size_t t_typesize2, const char* s_typename2)
@@ -162,14 +258,17 @@ bool_t _type_duplicate(
     _type_get_style(s_typename1, s_formalname1);
     _type_get_style(s_typename2, s_formalname2);
     /* test the type1 and type2 is registered or not */
+    _type_lock();
     pt_registered1 = _type_is_registered(s_formalname1);
     pt_registered2 = _type_is_registered(s_formalname2);
 
     if (pt_registered1 == NULL && pt_registered2 == NULL) {
         /* type1 and type2 all unregistered */
+        _type_unlock();
         return false;
     } else if (pt_registered1 != NULL && pt_registered2 != NULL) {
         /* type1 and type2 all registered */
+        _type_unlock();
         return pt_registered1 == pt_registered2 ? true : false;
     } else {
         /* only one type is registered */
@@ -197,8 +296,11 @@ bool_t _type_duplicate(
 
         t_pos = _type_hash(s_duplicatename);
         pt_duplicate->_pt_next = _gt_typeregister._apt_bucket[t_pos];
+        _TYPE_MEMORY_BARRIER();
         _gt_typeregister._apt_bucket[t_pos] = pt_duplicate;
 
+        _type_cache_invalidate();
+        _type_unlock();
         return true;
     }
 }
@@ -333,7 +435,9 @@ static inline bool_t _type_cstl_builtin_special(const char* s_typename)
 
 void _type_get_type(_typeinfo_t* pt_typeinfo, const char* s_typename)
 {
-    char s_registeredname[_TYPE_NAME_SIZE + 1];
+    char   s_formalname[_TYPE_NAME_SIZE + 1];
+    char   s_registeredname[_TYPE_NAME_SIZE + 1];
+    size_t t_generation = 0;
 
     assert(pt_typeinfo != NULL);
     assert(s_typename != NULL);
@@ -342,25 +446,35 @@ void _type_get_type(_typeinfo_t* pt_typeinfo, const char* s_typename)
         _type_init();
     }
 
+    /* the same type name is resolved repeatedly, so skip the parser and the register */
+    if (_type_info_cache_find(s_typename, pt_typeinfo)) {
+        return;
+    }
+
+    /* the register may be changed while the type name is resolved, then the result must not be cached */
+    t_generation = _gt_typeinfocache_generation;
+
+    s_formalname[0] = s_formalname[_TYPE_NAME_SIZE] = '\0';
     s_registeredname[0] = s_registeredname[_TYPE_NAME_SIZE] = '\0';
-    pt_typeinfo->_t_style = _type_get_style(s_typename, pt_typeinfo->_s_typename);
+    pt_typeinfo->_s_typename = "";
+    pt_typeinfo->_t_style = _type_get_style(s_typename, s_formalname);
     if (pt_typeinfo->_t_style == _TYPE_INVALID) {
         pt_typeinfo->_pt_type = NULL;
         return;
     } else if (pt_typeinfo->_t_style == _TYPE_C_BUILTIN ||
                pt_typeinfo->_t_style == _TYPE_USER_DEFINE) {
-        strncpy(s_registeredname, pt_typeinfo->_s_typename, _TYPE_NAME_SIZE);
+        strncpy(s_registeredname, s_formalname, _TYPE_NAME_SIZE);
     } else {
         /* the string_t , range_t and iterator types are special codition */
-        if (_type_cstl_builtin_special(pt_typeinfo->_s_typename)) {
-            strncpy(s_registeredname, pt_typeinfo->_s_typename, _TYPE_NAME_SIZE);
+        if (_type_cstl_builtin_special(s_formalname)) {
+            strncpy(s_registeredname, s_formalname, _TYPE_NAME_SIZE);
         } else {
             size_t t_length = 0;
-            char* pc_leftbracket = strchr(pt_typeinfo->_s_typename, _CSTL_LEFT_BRACKET);
+            char* pc_leftbracket = strchr(s_formalname, _CSTL_LEFT_BRACKET);
             assert(pc_leftbracket != NULL);
-            t_length = pc_leftbracket - pt_typeinfo->_s_typename;
+            t_length = pc_leftbracket - s_formalname;
             assert(t_length <= _TYPE_NAME_SIZE);
-            strncpy(s_registeredname, pt_typeinfo->_s_typename, t_length);
+            strncpy(s_registeredname, s_formalname, t_length);
             s_registeredname[t_length] = '\0';
         }
     }
@@ -370,8 +484,11 @@ void _type_get_type(_typeinfo_t* pt_typeinfo, const char* s_typename)
     } else {
         /*
          * types that duplicate between different type style has same type style that saved by type struct.
+         * the formal name is interned, so the type information of container is only a few pointers.
          */
+        pt_typeinfo->_s_typename = _type_intern_name(s_formalname);
         pt_typeinfo->_t_style = pt_typeinfo->_pt_type->_t_style;
+        _type_info_cache_update(s_typename, pt_typeinfo, t_generation);
     }
 }
 
@@ -509,6 +626,119 @@ bool_t _type_is_same_ex(const _typeinfo_t* pt_first, const _typeinfo_t* pt_secon
            _type_is_same(pt_first->_s_typename, pt_second->_s_typename);
 }
 
+bool_t _type_is_trivially_initializable(const _typeinfo_t* cpt_typeinfo)
+{
+    assert(cpt_typeinfo != NULL);
+    assert(cpt_typeinfo->_pt_type != NULL);
+
+    return (cpt_typeinfo->_pt_type->_n_typetrait & _TYPE_TRAIT_TRIVIAL_INIT) != 0;
+}
+
+bool_t _type_is_trivially_copyable(const _typeinfo_t* cpt_typeinfo)
+{
+    assert(cpt_typeinfo != NULL);
+    assert(cpt_typeinfo->_pt_type != NULL);
+
+    return (cpt_typeinfo->_pt_type->_n_typetrait & _TYPE_TRAIT_TRIVIAL_COPY) != 0;
+}
+
+bool_t _type_is_trivially_destructible(const _typeinfo_t* cpt_typeinfo)
+{
+    assert(cpt_typeinfo != NULL);
+    assert(cpt_typeinfo->_pt_type != NULL);
+
+    /* the c string is saved in string_t, so it has no trait and must be destroyed */
+    return (cpt_typeinfo->_pt_type->_n_typetrait & _TYPE_TRAIT_TRIVIAL_DESTROY) != 0;
+}
+
+bool_t _type_is_trivially_relocatable(const _typeinfo_t* cpt_typeinfo)
+{
+    assert(cpt_typeinfo != NULL);
+    assert(cpt_typeinfo->_pt_type != NULL);
+
+    return (cpt_typeinfo->_pt_type->_n_typetrait & _TYPE_TRAIT_TRIVIAL_RELOCATE) != 0;
+}
+
+bool_t _type_is_relocatable(const _typeinfo_t* cpt_typeinfo)
+{
+    assert(cpt_typeinfo != NULL);
+    assert(cpt_typeinfo->_pt_type != NULL);
+
+    return _type_is_trivially_relocatable(cpt_typeinfo) || cpt_typeinfo->_pt_type->_t_typemove != NULL;
+}
+
+void _type_relocate(const _typeinfo_t* cpt_typeinfo, void* pv_target, void* pv_source, size_t t_count)
+{
+    size_t i = 0;
+    bool_t b_result = false;
+
+    assert(cpt_typeinfo != NULL);
+    assert(cpt_typeinfo->_pt_type != NULL);
+    assert(pv_target != NULL);
+    assert(pv_source != NULL);
+    assert(_type_is_relocatable(cpt_typeinfo));
+
+    /*
+     * the source elements are moved into the uninitialized target memory, and then the
+     * source memory is uninitialized, it must not be destroyed.
+     */
+    if (_type_is_trivially_relocatable(cpt_typeinfo)) {
+        memcpy(pv_target, pv_source, cpt_typeinfo->_pt_type->_t_typesize * t_count);
+    } else {
+        for (i = 0; i < t_count; ++i) {
+            b_result = cpt_typeinfo->_pt_type->_t_typesize;
+            cpt_typeinfo->_pt_type->_t_typemove(
+                (_byte_t*)pv_target + cpt_typeinfo->_pt_type->_t_typesize * i,
+                (_byte_t*)pv_source + cpt_typeinfo->_pt_type->_t_typesize * i, &b_result);
+            assert(b_result);
+        }
+    }
+}
+
+void _type_swap(const _typeinfo_t* cpt_typeinfo, void* pv_first, void* pv_second)
+{
+    _typeswapbuffer_t t_buffer;
+    _byte_t*          pby_temp = t_buffer._aby_buffer;
+
+    assert(cpt_typeinfo != NULL);
+    assert(cpt_typeinfo->_pt_type != NULL);
+    assert(pv_first != NULL);
+    assert(pv_second != NULL);
+    assert(_type_is_relocatable(cpt_typeinfo));
+
+    if (pv_first == pv_second) {
+        return;
+    }
+
+    if (cpt_typeinfo->_pt_type->_t_typesize > _TYPE_SWAP_BUFFER_SIZE) {
+        pby_temp = (_byte_t*)malloc(cpt_typeinfo->_pt_type->_t_typesize);
+        assert(pby_temp != NULL);
+    }
+
+    _type_relocate(cpt_typeinfo, pby_temp, pv_first, 1);
+    _type_relocate(cpt_typeinfo, pv_first, pv_second, 1);
+    _type_relocate(cpt_typeinfo, pv_second, pby_temp, 1);
+
+    if (pby_temp != t_buffer._aby_buffer) {
+        free(pby_temp);
+    }
+}
+
+size_t _type_hash_value(const _typeinfo_t* cpt_typeinfo, const void* cpv_value)
+{
+    size_t t_hash = 0;
+
+    assert(cpt_typeinfo != NULL);
+    assert(cpt_typeinfo->_pt_type != NULL);
+    assert(cpv_value != NULL);
+
+    /* the input of c string is the string_t that saves it */
+    t_hash = cpt_typeinfo->_pt_type->_t_typesize;
+    cpt_typeinfo->_pt_type->_t_typehash(cpv_value, &t_hash);
+
+    return t_hash;
+}
+
 void _type_get_elem_typename(const char* s_typename, char* s_elemtypename)
 {
     char* pc_left = NULL;   /* left bracket position */
@@ -545,88 +775,109 @@ void _type_get_varg_value(_typeinfo_t* pt_typeinfo, va_list val_elemlist, void*
      * Note: instead "long double" type with "double" in var_arg function.
      */
     if (pt_typeinfo->_t_style == _TYPE_C_BUILTIN) {
-        if (strncmp(pt_typeinfo->_pt_type->_s_typename, _CHAR_TYPE, _TYPE_NAME_SIZE) == 0) {
-            /* char and shigned char */
-            assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(char));
-            *(char*)pv_output = (char)va_arg(val_elemlist, int);
-        } else if (strncmp(pt_typeinfo->_pt_type->_s_typename, _UNSIGNED_CHAR_TYPE, _TYPE_NAME_SIZE) == 0) {
-            /* unsigned char */
-            assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(unsigned char));
-            *(unsigned char*)pv_output = (unsigned char)va_arg(val_elemlist, int);
-        } else if (strncmp(pt_typeinfo->_pt_type->_s_typename, _SHORT_TYPE, _TYPE_NAME_SIZE) == 0) {
-            /* short, short int, signed short, signed short int */
-            assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(short));
-            *(short*)pv_output = (short)va_arg(val_elemlist, int);
-        } else if (strncmp(pt_typeinfo->_pt_type->_s_typename, _UNSIGNED_SHORT_TYPE, _TYPE_NAME_SIZE) == 0) {
-            /* unsigned short, unsigned short int */
-            assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(unsigned short));
-            *(unsigned short*)pv_output = (unsigned short)va_arg(val_elemlist, int);
-        } else if (strncmp(pt_typeinfo->_pt_type->_s_typename, _INT_TYPE, _TYPE_NAME_SIZE) == 0) {
-            /* int, signed, signed int */
-            assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(int));
-            *(int*)pv_output = va_arg(val_elemlist, int);
-        } else if (strncmp(pt_typeinfo->_pt_type->_s_typename, _UNSIGNED_INT_TYPE, _TYPE_NAME_SIZE) == 0) {
-            /* unsigned int, unsigned */
-            assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(unsigned int));
-            *(unsigned int*)pv_output = va_arg(val_elemlist, unsigned int);
-        } else if (strncmp(pt_typeinfo->_pt_type->_s_typename, _LONG_TYPE, _TYPE_NAME_SIZE) == 0) {
-            /* long, long int, signed long, signed long int */
-            assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(long));
-            *(long*)pv_output = va_arg(val_elemlist, long);
-        } else if (strncmp(pt_typeinfo->_pt_type->_s_typename, _UNSIGNED_LONG_TYPE, _TYPE_NAME_SIZE) == 0) {
-            /* unsigned long, unsigned long int */
-            assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(unsigned long));
-            *(unsigned long*)pv_output = va_arg(val_elemlist, unsigned long);
-        } else if (strncmp(pt_typeinfo->_pt_type->_s_typename, _FLOAT_TYPE, _TYPE_NAME_SIZE) == 0) {
-            /* float */
-            assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(float));
-            *(float*)pv_output = (float)va_arg(val_elemlist, double);
-        } else if (strncmp(pt_typeinfo->_pt_type->_s_typename, _DOUBLE_TYPE, _TYPE_NAME_SIZE) == 0) {
-            /* double */
-            assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(double));
-            *(double*)pv_output = va_arg(val_elemlist, double);
-        } else if (strncmp(pt_typeinfo->_pt_type->_s_typename, _LONG_DOUBLE_TYPE, _TYPE_NAME_SIZE) == 0) {
-            /* long double */
-            assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(long double));
-            *(long double*)pv_output = va_arg(val_elemlist, double);
-        } else if (strncmp(pt_typeinfo->_pt_type->_s_typename, _CSTL_BOOL_TYPE, _TYPE_NAME_SIZE) == 0) {
-            /* bool_t */
-            assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(bool_t));
-            *(bool_t*)pv_output = va_arg(val_elemlist, bool_t);
-        } else if (strncmp(pt_typeinfo->_pt_type->_s_typename, _POINTER_TYPE, _TYPE_NAME_SIZE) == 0) {
-            /* void* */
-            assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(void*));
-            *(void**)pv_output = va_arg(val_elemlist, void*);
-        } else if (strncmp(pt_typeinfo->_pt_type->_s_typename, _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
-            /* char* */
-            char* s_str = va_arg(val_elemlist, char*);
-            assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(string_t));
-
-            if (s_str != NULL) {
-                string_assign_cstr((string_t*)pv_output, s_str);
-            } else {
-                bool_t b_result = pt_typeinfo->_pt_type->_t_typesize;
-                (*pt_typeinfo->_pt_type->_t_typedestroy)(pv_output, &b_result);
-                assert(b_result);
-                memset(pv_output, 0x00, pt_typeinfo->_pt_type->_t_typesize);
-            }
+        switch (pt_typeinfo->_pt_type->_t_typeid) {
+            case _TYPE_ID_CHAR:
+                /* char and shigned char */
+                assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(char));
+                *(char*)pv_output = (char)va_arg(val_elemlist, int);
+                break;
+            case _TYPE_ID_UNSIGNED_CHAR:
+                /* unsigned char */
+                assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(unsigned char));
+                *(unsigned char*)pv_output = (unsigned char)va_arg(val_elemlist, int);
+                break;
+            case _TYPE_ID_SHORT:
+                /* short, short int, signed short, signed short int */
+                assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(short));
+                *(short*)pv_output = (short)va_arg(val_elemlist, int);
+                break;
+            case _TYPE_ID_UNSIGNED_SHORT:
+                /* unsigned short, unsigned short int */
+                assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(unsigned short));
+                *(unsigned short*)pv_output = (unsigned short)va_arg(val_elemlist, int);
+                break;
+            case _TYPE_ID_INT:
+                /* int, signed, signed int */
+                assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(int));
+                *(int*)pv_output = va_arg(val_elemlist, int);
+                break;
+            case _TYPE_ID_UNSIGNED_INT:
+                /* unsigned int, unsigned */
+                assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(unsigned int));
+                *(unsigned int*)pv_output = va_arg(val_elemlist, unsigned int);
+                break;
+            case _TYPE_ID_LONG:
+                /* long, long int, signed long, signed long int */
+                assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(long));
+                *(long*)pv_output = va_arg(val_elemlist, long);
+                break;
+            case _TYPE_ID_UNSIGNED_LONG:
+                /* unsigned long, unsigned long int */
+                assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(unsigned long));
+                *(unsigned long*)pv_output = va_arg(val_elemlist, unsigned long);
+                break;
+            case _TYPE_ID_FLOAT:
+                /* float */
+                assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(float));
+                *(float*)pv_output = (float)va_arg(val_elemlist, double);
+                break;
+            case _TYPE_ID_DOUBLE:
+                /* double */
+                assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(double));
+                *(double*)pv_output = va_arg(val_elemlist, double);
+                break;
+            case _TYPE_ID_LONG_DOUBLE:
+                /* long double */
+                assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(long double));
+                *(long double*)pv_output = va_arg(val_elemlist, double);
+                break;
+            case _TYPE_ID_CSTL_BOOL:
+                /* bool_t */
+                assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(bool_t));
+                *(bool_t*)pv_output = va_arg(val_elemlist, bool_t);
+                break;
+            case _TYPE_ID_POINTER:
+                /* void* */
+                assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(void*));
+                *(void**)pv_output = va_arg(val_elemlist, void*);
+                break;
+            case _TYPE_ID_C_STRING:
+                /* char* */
+                {
+                    char* s_str = va_arg(val_elemlist, char*);
+                    assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(string_t));
+
+                    if (s_str != NULL) {
+                        string_assign_cstr((string_t*)pv_output, s_str);
+                    } else {
+                        bool_t b_result = pt_typeinfo->_pt_type->_t_typesize;
+                        (*pt_typeinfo->_pt_type->_t_typedestroy)(pv_output, &b_result);
+                        assert(b_result);
+                        memset(pv_output, 0x00, pt_typeinfo->_pt_type->_t_typesize);
+                    }
+                }
+                break;
 #ifndef _MSC_VER
-        } else if (strncmp(pt_typeinfo->_pt_type->_s_typename, _BOOL_TYPE, _TYPE_NAME_SIZE) == 0) {
-            /* _Bool */
-            assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(_Bool));
-            *(_Bool*)pv_output = va_arg(val_elemlist, int);
-        } else if (strncmp(pt_typeinfo->_pt_type->_s_typename, _LONG_LONG_TYPE, _TYPE_NAME_SIZE) == 0) {
-            /* long long */
-            assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(long long));
-            *(long long*)pv_output = va_arg(val_elemlist, long long);
-        } else if (strncmp(pt_typeinfo->_pt_type->_s_typename, _UNSIGNED_LONG_LONG_TYPE, _TYPE_NAME_SIZE) == 0) {
-            /* unsigned long long */
-            assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(unsigned long long));
-            *(unsigned long long*)pv_output = va_arg(val_elemlist, unsigned long long);
+            case _TYPE_ID_BOOL:
+                /* _Bool */
+                assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(_Bool));
+                *(_Bool*)pv_output = va_arg(val_elemlist, int);
+                break;
+            case _TYPE_ID_LONG_LONG:
+                /* long long */
+                assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(long long));
+                *(long long*)pv_output = va_arg(val_elemlist, long long);
+                break;
+            case _TYPE_ID_UNSIGNED_LONG_LONG:
+                /* unsigned long long */
+                assert(pt_typeinfo->_pt_type->_t_typesize == sizeof(unsigned long long));
+                *(unsigned long long*)pv_output = va_arg(val_elemlist, unsigned long long);
+                break;
 #endif
-        } else {
-            /* invalid c builtin style */
-            assert(false);
+            default:
+                /* invalid c builtin style */
+                assert(false);
+                break;
         }
     } else if (pt_typeinfo->_t_style == _TYPE_USER_DEFINE || pt_typeinfo->_t_style == _TYPE_CSTL_BUILTIN) {
         /*
@@ -650,6 +901,31 @@ void _type_get_varg_value(_typeinfo_t* pt_typeinfo, va_list val_elemlist, void*
     }
 }
 
+/**
+ * Get value from pointer of element.
+ */
+void _type_get_ptr_value(_typeinfo_t* pt_typeinfo, const void* cpv_value, void* pv_output)
+{
+    bool_t b_result = false;
+
+    assert(pt_typeinfo != NULL && pt_typeinfo->_pt_type != NULL);
+    assert(pt_typeinfo->_t_style != _TYPE_INVALID);
+    assert(cpv_value != NULL);
+    assert(pv_output != NULL);
+
+    if (pt_typeinfo->_pt_type->_t_typeid == _TYPE_ID_C_STRING) {
+        /* the element of c string is string_t, but the value is passed as char* */
+        string_assign_cstr((string_t*)pv_output, (const char*)cpv_value);
+    } else if (_type_is_trivially_copyable(pt_typeinfo)) {
+        memcpy(pv_output, cpv_value, pt_typeinfo->_pt_type->_t_typesize);
+    } else {
+        /* the pv_output must be initialized */
+        b_result = pt_typeinfo->_pt_type->_t_typesize;
+        (*pt_typeinfo->_pt_type->_t_typecopy)(pv_output, cpv_value, &b_result);
+        assert(b_result);
+    }
+}
+
 /* default copy, less, and destroy function */
 void _type_init_default(const void* cpv_input, void* pv_output)
 {
@@ -675,6 +951,11 @@ void _type_destroy_default(const void* cpv_input, void* pv_output)
     pv_avoidwarning = (void*)cpv_input;
     *(bool_t*)pv_output = true;
 }
+void _type_hash_default(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _hashtable_hash_bytes(cpv_input, *(size_t*)pv_output);
+}
 
 /** local function implementation section **/
 
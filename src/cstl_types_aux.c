@@ -36,51 +36,73 @@
 #include <cstl/chash_set.h>
 #include <cstl/chash_map.h>
 #include <cstl/cstring.h>
+#ifdef _MSC_VER
+#   include <windows.h>
+#else
+#   include <sched.h>
+#endif
 
 #include "cstl_types_aux.h"
 #include "cstl_types_parse.h"
 #include "cstl_types_builtin.h"
 
 /** local constant declaration and local macro section **/
-/* the pt_type, pt_node and t_pos must be defined before use those macro */
-#define _TYPE_REGISTER_BEGIN()\
-    _typenode_t* pt_node = NULL;\
-    _type_t*     pt_type = NULL;\
-    size_t       t_pos = 0
-#define _TYPE_REGISTER_TYPE(type, type_text, type_suffix, type_style)\
-    do{\
-        pt_type = (_type_t*)_alloc_allocate(&_gt_typeregister._t_allocator, sizeof(_type_t), 1);\
-        assert(pt_type != NULL);\
-        pt_type->_t_typesize = sizeof(type);\
-        memset(pt_type->_s_typename, '\0', _TYPE_NAME_SIZE+1);\
-        strncpy(pt_type->_s_typename, type_text, _TYPE_NAME_SIZE);\
-        assert(type_style != _TYPE_INVALID);\
-        pt_type->_t_style = type_style;\
-        pt_type->_t_typeinit = _type_init_##type_suffix;\
-        pt_type->_t_typecopy = _type_copy_##type_suffix;\
-        pt_type->_t_typeless = _type_less_##type_suffix;\
-        pt_type->_t_typedestroy = _type_destroy_##type_suffix;\
-    }while(false)
-#define _TYPE_REGISTER_TYPE_NODE(type, type_text)\
-    do{\
-        pt_node = (_typenode_t*)_alloc_allocate(\
-            &_gt_typeregister._t_allocator, sizeof(_typenode_t), 1);\
-        assert(pt_node != NULL);\
-        memset(pt_node->_s_typename, '\0', _TYPE_NAME_SIZE+1);\
-        strncpy(pt_node->_s_typename, type_text, _TYPE_NAME_SIZE);\
-        t_pos = _type_hash(type_text);\
-        pt_node->_pt_next = _gt_typeregister._apt_bucket[t_pos];\
-        _gt_typeregister._apt_bucket[t_pos] = pt_node;\
-        pt_node->_pt_type = pt_type;\
-    }while(false)
-#define _TYPE_REGISTER_END()
+/*
+ * the builtin types are constant data, so they are ready before the first container is created
+ * and they are never registered at runtime.
+ */
+#define _TYPE_BUILTIN_TYPE(type, type_text, type_suffix, type_style, type_id, type_trait, type_compare, type_move)\
+    {sizeof(type), type_text, type_id, type_style, type_trait,\
+     _type_copy_##type_suffix, _type_less_##type_suffix, _type_init_##type_suffix,\
+     _type_destroy_##type_suffix, _type_hash_##type_suffix, type_compare, type_move}
+/* the suffix is pasted directly, because it may be a macro such as bool */
+#define _TYPE_BUILTIN_C_TYPE(type, type_text, type_suffix, type_id)\
+    {sizeof(type), type_text, type_id, _TYPE_C_BUILTIN, _TYPE_TRAIT_TRIVIAL | _TYPE_TRAIT_TRIVIAL_RELOCATE,\
+     _type_copy_##type_suffix, _type_less_##type_suffix, _type_init_##type_suffix,\
+     _type_destroy_##type_suffix, _type_hash_##type_suffix, _type_compare_##type_suffix, NULL}
+/* the cstl builtin type that is moved by copying memory has trivial relocate trait */
+#define _TYPE_BUILTIN_CSTL_TYPE(type, type_text, type_suffix, type_id, type_trait)\
+    {sizeof(type), type_text, type_id, _TYPE_CSTL_BUILTIN, type_trait,\
+     _type_copy_##type_suffix, _type_less_##type_suffix, _type_init_##type_suffix,\
+     _type_destroy_##type_suffix, _type_hash_##type_suffix, NULL, _type_move_##type_suffix}
 
 /* BKDR hash seed */
 #define _TYPE_HASH_BKDR_SEED    131
 
+#ifdef _MSC_VER
+#   define _TYPE_ATOMIC_CAS(pl_dest, l_old, l_new)  InterlockedCompareExchange((LONG volatile*)(pl_dest), (l_new), (l_old))
+#   define _TYPE_YIELD()                            SwitchToThread()
+#else
+#   define _TYPE_ATOMIC_CAS(pl_dest, l_old, l_new)  __sync_val_compare_and_swap((pl_dest), (l_old), (l_new))
+#   define _TYPE_YIELD()                            sched_yield()
+#endif
+
 /** local data type declaration and local struct, union, enum section **/
+/**
+ * builtin type name, all names of builtin types are sorted in one constant table.
+ */
+typedef struct _tagtypebuiltin {
+    const char*    _s_typename;
+    const _type_t* _pt_type;
+}_typebuiltin_t;
 
 /** local function prototype section **/
+/**
+ * Caculate the slot of type information cache.
+ * @param s_typename    type name.
+ * @return slot index.
+ * @remarks s_typename must be not NULL.
+ */
+static size_t _type_info_cache_hash(const char* s_typename);
+
+/**
+ * Find interned type name.
+ * @param s_typename    type name.
+ * @param t_pos         bucket of type name.
+ * @return the interned type name or NULL.
+ * @remarks s_typename must be not NULL.
+ */
+static const char* _type_intern_find(const char* s_typename, size_t t_pos);
 
 /** exported global variable definition section **/
 /*
@@ -109,6 +131,7 @@
  *                             +------------------------------+
  *                             | _t_typesize = ???            |
  *                             | _s_typename = "abc_t"        |
+ *                             | _t_typeid = ???              |
  *                             | _t_typecopy = abc_copy       | "registered type abc_t"
  *                             | _t_typeless = abc_less       |
  *                             | _t_typeinit = abc_init       |
@@ -116,15 +139,192 @@
  *                             +------------------------------+
  */
 #ifdef CSTL_MEMORY_MANAGEMENT
-_typeregister_t _gt_typeregister = {false, {NULL}, {{NULL}, NULL, NULL, 0, 0, 0}};
+#ifdef CSTL_MEMORY_CLASS_STAT
+_typeregister_t _gt_typeregister = {false, {NULL}, {{NULL}, NULL, NULL, 0, 0, 0, 0, 0, {{0, 0}}, NULL}, 0};
+#else
+_typeregister_t _gt_typeregister = {false, {NULL}, {{NULL}, NULL, NULL, 0, 0, 0, 0, 0, NULL}, 0};
+#endif
 #else
-_typeregister_t _gt_typeregister = {false, {NULL}, {0}};
+_typeregister_t _gt_typeregister = {false, {NULL}, {0, 0, NULL}, 0};
 #endif
 
 _typecache_t    _gt_typecache[_TYPE_CACHE_COUNT] = {{'\0'}, {'\0'}, 0};
 size_t          _gt_typecache_index = 0;
+_typeinfocache_t _gt_typeinfocache[_TYPE_INFO_CACHE_COUNT];
+_typename_t*     _gapt_typenamebucket[_TYPE_REGISTER_BUCKET_COUNT];
+size_t           _gt_typeinfocache_generation = 1;
+/* the sequence of type caches is odd when the caches are being written, the readers retry on parsing */
+volatile size_t  _gt_typecache_sequence = 0;
 
 /** local global variable definition section **/
+/* the register lock, it is held by registering types, initializing and the first use of type name */
+static volatile long _gl_typelock = 0;
+
+/* c builtin types */
+static const _type_t _sgt_type_char = _TYPE_BUILTIN_C_TYPE(
+    char, _CHAR_TYPE, char, _TYPE_ID_CHAR);
+static const _type_t _sgt_type_uchar = _TYPE_BUILTIN_C_TYPE(
+    unsigned char, _UNSIGNED_CHAR_TYPE, uchar, _TYPE_ID_UNSIGNED_CHAR);
+static const _type_t _sgt_type_short = _TYPE_BUILTIN_C_TYPE(
+    short, _SHORT_TYPE, short, _TYPE_ID_SHORT);
+static const _type_t _sgt_type_ushort = _TYPE_BUILTIN_C_TYPE(
+    unsigned short, _UNSIGNED_SHORT_TYPE, ushort, _TYPE_ID_UNSIGNED_SHORT);
+static const _type_t _sgt_type_int = _TYPE_BUILTIN_C_TYPE(
+    int, _INT_TYPE, int, _TYPE_ID_INT);
+static const _type_t _sgt_type_uint = _TYPE_BUILTIN_C_TYPE(
+    unsigned int, _UNSIGNED_INT_TYPE, uint, _TYPE_ID_UNSIGNED_INT);
+static const _type_t _sgt_type_long = _TYPE_BUILTIN_C_TYPE(
+    long, _LONG_TYPE, long, _TYPE_ID_LONG);
+static const _type_t _sgt_type_ulong = _TYPE_BUILTIN_C_TYPE(
+    unsigned long, _UNSIGNED_LONG_TYPE, ulong, _TYPE_ID_UNSIGNED_LONG);
+static const _type_t _sgt_type_float = _TYPE_BUILTIN_C_TYPE(
+    float, _FLOAT_TYPE, float, _TYPE_ID_FLOAT);
+static const _type_t _sgt_type_double = _TYPE_BUILTIN_C_TYPE(
+    double, _DOUBLE_TYPE, double, _TYPE_ID_DOUBLE);
+static const _type_t _sgt_type_long_double = _TYPE_BUILTIN_C_TYPE(
+    long double, _LONG_DOUBLE_TYPE, long_double, _TYPE_ID_LONG_DOUBLE);
+static const _type_t _sgt_type_cstl_bool = _TYPE_BUILTIN_C_TYPE(
+    bool_t, _CSTL_BOOL_TYPE, cstl_bool, _TYPE_ID_CSTL_BOOL);
+static const _type_t _sgt_type_cstr = _TYPE_BUILTIN_TYPE(
+    string_t, _C_STRING_TYPE, cstr, _TYPE_C_BUILTIN, _TYPE_ID_C_STRING,
+    _TYPE_TRAIT_TRIVIAL_RELOCATE, _type_compare_cstr, NULL);
+static const _type_t _sgt_type_pointer = _TYPE_BUILTIN_C_TYPE(
+    void*, _POINTER_TYPE, pointer, _TYPE_ID_POINTER);
+#ifndef _MSC_VER
+static const _type_t _sgt_type_bool = _TYPE_BUILTIN_C_TYPE(
+    _Bool, _BOOL_TYPE, bool, _TYPE_ID_BOOL);
+static const _type_t _sgt_type_long_long = _TYPE_BUILTIN_C_TYPE(
+    long long, _LONG_LONG_TYPE, long_long, _TYPE_ID_LONG_LONG);
+static const _type_t _sgt_type_ulong_long = _TYPE_BUILTIN_C_TYPE(
+    unsigned long long, _UNSIGNED_LONG_LONG_TYPE, ulong_long, _TYPE_ID_UNSIGNED_LONG_LONG);
+#endif
+
+/* cstl builtin types */
+static const _type_t _sgt_type_vector = _TYPE_BUILTIN_CSTL_TYPE(
+    vector_t, _VECTOR_TYPE, vector, _TYPE_ID_VECTOR, _TYPE_TRAIT_TRIVIAL_RELOCATE);
+static const _type_t _sgt_type_list = _TYPE_BUILTIN_CSTL_TYPE(
+    list_t, _LIST_TYPE, list, _TYPE_ID_LIST, _TYPE_TRAIT_TRIVIAL_RELOCATE);
+static const _type_t _sgt_type_slist = _TYPE_BUILTIN_CSTL_TYPE(
+    slist_t, _SLIST_TYPE, slist, _TYPE_ID_SLIST, _TYPE_TRAIT_TRIVIAL_RELOCATE);
+static const _type_t _sgt_type_deque = _TYPE_BUILTIN_CSTL_TYPE(
+    deque_t, _DEQUE_TYPE, deque, _TYPE_ID_DEQUE, 0);
+static const _type_t _sgt_type_stack = _TYPE_BUILTIN_CSTL_TYPE(
+    stack_t, _STACK_TYPE, stack, _TYPE_ID_STACK, 0);
+static const _type_t _sgt_type_queue = _TYPE_BUILTIN_CSTL_TYPE(
+    queue_t, _QUEUE_TYPE, queue, _TYPE_ID_QUEUE, 0);
+static const _type_t _sgt_type_priority_queue = _TYPE_BUILTIN_CSTL_TYPE(
+    priority_queue_t, _PRIORITY_QUEUE_TYPE, priority_queue, _TYPE_ID_PRIORITY_QUEUE, _TYPE_TRAIT_TRIVIAL_RELOCATE);
+static const _type_t _sgt_type_set = _TYPE_BUILTIN_CSTL_TYPE(
+    set_t, _SET_TYPE, set, _TYPE_ID_SET, 0);
+static const _type_t _sgt_type_map = _TYPE_BUILTIN_CSTL_TYPE(
+    map_t, _MAP_TYPE, map, _TYPE_ID_MAP, 0);
+static const _type_t _sgt_type_multiset = _TYPE_BUILTIN_CSTL_TYPE(
+    multiset_t, _MULTISET_TYPE, multiset, _TYPE_ID_MULTISET, 0);
+static const _type_t _sgt_type_multimap = _TYPE_BUILTIN_CSTL_TYPE(
+    multimap_t, _MULTIMAP_TYPE, multimap, _TYPE_ID_MULTIMAP, 0);
+static const _type_t _sgt_type_hash_set = _TYPE_BUILTIN_CSTL_TYPE(
+    hash_set_t, _HASH_SET_TYPE, hash_set, _TYPE_ID_HASH_SET, _TYPE_TRAIT_TRIVIAL_RELOCATE);
+static const _type_t _sgt_type_hash_map = _TYPE_BUILTIN_CSTL_TYPE(
+    hash_map_t, _HASH_MAP_TYPE, hash_map, _TYPE_ID_HASH_MAP, _TYPE_TRAIT_TRIVIAL_RELOCATE);
+static const _type_t _sgt_type_hash_multiset = _TYPE_BUILTIN_CSTL_TYPE(
+    hash_multiset_t, _HASH_MULTISET_TYPE, hash_multiset, _TYPE_ID_HASH_MULTISET, _TYPE_TRAIT_TRIVIAL_RELOCATE);
+static const _type_t _sgt_type_hash_multimap = _TYPE_BUILTIN_CSTL_TYPE(
+    hash_multimap_t, _HASH_MULTIMAP_TYPE, hash_multimap, _TYPE_ID_HASH_MULTIMAP, _TYPE_TRAIT_TRIVIAL_RELOCATE);
+static const _type_t _sgt_type_pair = _TYPE_BUILTIN_CSTL_TYPE(
+    pair_t, _PAIR_TYPE, pair, _TYPE_ID_PAIR, _TYPE_TRAIT_TRIVIAL_RELOCATE);
+static const _type_t _sgt_type_string = _TYPE_BUILTIN_TYPE(
+    string_t, _STRING_TYPE, string, _TYPE_CSTL_BUILTIN, _TYPE_ID_STRING,
+    _TYPE_TRAIT_TRIVIAL_RELOCATE, _type_compare_string, _type_move_string);
+static const _type_t _sgt_type_range = _TYPE_BUILTIN_CSTL_TYPE(
+    range_t, _RANGE_TYPE, range, _TYPE_ID_RANGE, _TYPE_TRAIT_TRIVIAL_RELOCATE);
+static const _type_t _sgt_type_basic_string = _TYPE_BUILTIN_CSTL_TYPE(
+    basic_string_t, _BASIC_STRING_TYPE, basic_string, _TYPE_ID_BASIC_STRING, _TYPE_TRAIT_TRIVIAL_RELOCATE);
+static const _type_t _sgt_type_iterator = _TYPE_BUILTIN_CSTL_TYPE(
+    iterator_t, _ITERATOR_TYPE, iterator, _TYPE_ID_ITERATOR, _TYPE_TRAIT_TRIVIAL_RELOCATE);
+
+/* the names of builtin types are sorted by strcmp() for binary search, keep the order when adding new name */
+static const _typebuiltin_t _sgt_typebuiltin[] = {
+#ifndef _MSC_VER
+    {_BOOL_TYPE, &_sgt_type_bool},
+#endif
+    {_BASIC_STRING_ITERATOR_TYPE, &_sgt_type_iterator},
+    {_BASIC_STRING_TYPE, &_sgt_type_basic_string},
+    {_BIDIRECTIONAL_ITERATOR_TYPE, &_sgt_type_iterator},
+    {_CSTL_BOOL_TYPE, &_sgt_type_cstl_bool},
+    {_CHAR_TYPE, &_sgt_type_char},
+    {_C_STRING_TYPE, &_sgt_type_cstr},
+    {_DEQUE_ITERATOR_TYPE, &_sgt_type_iterator},
+    {_DEQUE_TYPE, &_sgt_type_deque},
+    {_DOUBLE_TYPE, &_sgt_type_double},
+    {_FLOAT_TYPE, &_sgt_type_float},
+    {_FORWARD_ITERATOR_TYPE, &_sgt_type_iterator},
+    {_HASH_MAP_ITERATOR_TYPE, &_sgt_type_iterator},
+    {_HASH_MAP_TYPE, &_sgt_type_hash_map},
+    {_HASH_MULTIMAP_ITERATOR_TYPE, &_sgt_type_iterator},
+    {_HASH_MULTIMAP_TYPE, &_sgt_type_hash_multimap},
+    {_HASH_MULTISET_ITERATOR_TYPE, &_sgt_type_iterator},
+    {_HASH_MULTISET_TYPE, &_sgt_type_hash_multiset},
+    {_HASH_SET_ITERATOR_TYPE, &_sgt_type_iterator},
+    {_HASH_SET_TYPE, &_sgt_type_hash_set},
+    {_INPUT_ITERATOR_TYPE, &_sgt_type_iterator},
+    {_INT_TYPE, &_sgt_type_int},
+    {_ITERATOR_TYPE, &_sgt_type_iterator},
+    {_LIST_ITERATOR_TYPE, &_sgt_type_iterator},
+    {_LIST_TYPE, &_sgt_type_list},
+    {_LONG_TYPE, &_sgt_type_long},
+    {_LONG_DOUBLE_TYPE, &_sgt_type_long_double},
+    {_LONG_INT_TYPE, &_sgt_type_long},
+#ifndef _MSC_VER
+    {_LONG_LONG_TYPE, &_sgt_type_long_long},
+    {_LONG_LONG_INT_TYPE, &_sgt_type_long_long},
+#endif
+    {_MAP_ITERATOR_TYPE, &_sgt_type_iterator},
+    {_MAP_TYPE, &_sgt_type_map},
+    {_MULTIMAP_ITERATOR_TYPE, &_sgt_type_iterator},
+    {_MULTIMAP_TYPE, &_sgt_type_multimap},
+    {_MULTISET_ITERATOR_TYPE, &_sgt_type_iterator},
+    {_MULTISET_TYPE, &_sgt_type_multiset},
+    {_OUTPUT_ITERATOR_TYPE, &_sgt_type_iterator},
+    {_PAIR_TYPE, &_sgt_type_pair},
+    {_PRIORITY_QUEUE_TYPE, &_sgt_type_priority_queue},
+    {_QUEUE_TYPE, &_sgt_type_queue},
+    {_RANDOM_ACCESS_ITERATOR_TYPE, &_sgt_type_iterator},
+    {_RANGE_TYPE, &_sgt_type_range},
+    {_SET_ITERATOR_TYPE, &_sgt_type_iterator},
+    {_SET_TYPE, &_sgt_type_set},
+    {_SHORT_TYPE, &_sgt_type_short},
+    {_SHORT_INT_TYPE, &_sgt_type_short},
+    {_SIGNED_TYPE, &_sgt_type_int},
+    {_SIGNED_CHAR_TYPE, &_sgt_type_char},
+    {_SIGNED_INT_TYPE, &_sgt_type_int},
+    {_SIGNED_LONG_TYPE, &_sgt_type_long},
+    {_SIGNED_LONG_INT_TYPE, &_sgt_type_long},
+#ifndef _MSC_VER
+    {_SIGNED_LONG_LONG_TYPE, &_sgt_type_long_long},
+    {_SIGNED_LONG_LONG_INT_TYPE, &_sgt_type_long_long},
+#endif
+    {_SIGNED_SHORT_TYPE, &_sgt_type_short},
+    {_SIGNED_SHORT_INT_TYPE, &_sgt_type_short},
+    {_SLIST_ITERATOR_TYPE, &_sgt_type_iterator},
+    {_SLIST_TYPE, &_sgt_type_slist},
+    {_STACK_TYPE, &_sgt_type_stack},
+    {_STRING_ITERATOR_TYPE, &_sgt_type_iterator},
+    {_STRING_TYPE, &_sgt_type_string},
+    {_UNSIGNED_TYPE, &_sgt_type_uint},
+    {_UNSIGNED_CHAR_TYPE, &_sgt_type_uchar},
+    {_UNSIGNED_INT_TYPE, &_sgt_type_uint},
+    {_UNSIGNED_LONG_TYPE, &_sgt_type_ulong},
+    {_UNSIGNED_LONG_INT_TYPE, &_sgt_type_ulong},
+#ifndef _MSC_VER
+    {_UNSIGNED_LONG_LONG_TYPE, &_sgt_type_ulong_long},
+    {_UNSIGNED_LONG_LONG_INT_TYPE, &_sgt_type_ulong_long},
+#endif
+    {_UNSIGNED_SHORT_TYPE, &_sgt_type_ushort},
+    {_UNSIGNED_SHORT_INT_TYPE, &_sgt_type_ushort},
+    {_VECTOR_ITERATOR_TYPE, &_sgt_type_iterator},
+    {_VECTOR_TYPE, &_sgt_type_vector},
+    {_POINTER_TYPE, &_sgt_type_pointer},
+};
 
 /** exported function implementation section **/
 /**
@@ -157,7 +357,11 @@ _type_t* _type_is_registered(const char* s_typename)
     assert(s_typename != NULL);
     assert(strlen(s_typename) <= _TYPE_NAME_SIZE);
 
-    /* get the registered type pointer */
+    if ((pt_registered = _type_find_builtin(s_typename)) != NULL) {
+        return pt_registered;
+    }
+
+    /* get the registered type pointer, the new node is linked after it is filled, so no lock is needed */
     pt_node = _gt_typeregister._apt_bucket[_type_hash(s_typename)];
     while (pt_node != NULL) {
         if (strncmp(s_typename, pt_node->_s_typename, _TYPE_NAME_SIZE) == 0) {
@@ -173,189 +377,112 @@ _type_t* _type_is_registered(const char* s_typename)
 }
 
 /**
- * Initialize the register and register c builtin type and cstl builtin type 
+ * Find builtin type in the sorted table.
  */
-void _type_init(void)
+_type_t* _type_find_builtin(const char* s_typename)
 {
-    size_t i = 0;
+    size_t t_low = 0;
+    size_t t_high = sizeof(_sgt_typebuiltin) / sizeof(_sgt_typebuiltin[0]);
+    size_t t_mid = 0;
+    int    n_cmp = 0;
 
-    /* set register hash table */
-    for (i = 0; i < _TYPE_REGISTER_BUCKET_COUNT; ++i) {
-        _gt_typeregister._apt_bucket[i] = NULL;
+    assert(s_typename != NULL);
+
+    while (t_low < t_high) {
+        t_mid = t_low + (t_high - t_low) / 2;
+        n_cmp = strncmp(s_typename, _sgt_typebuiltin[t_mid]._s_typename, _TYPE_NAME_SIZE);
+        if (n_cmp == 0) {
+            /* the builtin type is never modified through the register */
+            return (_type_t*)_sgt_typebuiltin[t_mid]._pt_type;
+        } else if (n_cmp < 0) {
+            t_high = t_mid;
+        } else {
+            t_low = t_mid + 1;
+        }
     }
-    /* init allocator */
-    _alloc_init(&_gt_typeregister._t_allocator);
 
-    _type_register_c_builtin();
-    _type_register_cstl_builtin();
-    
-    _gt_typeregister._t_isinit = true;
+    return NULL;
 }
 
-void _type_register_c_builtin(void)
+/**
+ * Intern type name.
+ */
+const char* _type_intern_name(const char* s_typename)
 {
-    _TYPE_REGISTER_BEGIN();
-
-    /* register char type */
-    _TYPE_REGISTER_TYPE(char, _CHAR_TYPE, char, _TYPE_C_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(char, _CHAR_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(signed char, _SIGNED_CHAR_TYPE);
-    /* register unsigned char */
-    _TYPE_REGISTER_TYPE(unsigned char, _UNSIGNED_CHAR_TYPE, uchar, _TYPE_C_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(unsigned char, _UNSIGNED_CHAR_TYPE);
-    /* register short */
-    _TYPE_REGISTER_TYPE(short, _SHORT_TYPE, short, _TYPE_C_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(short, _SHORT_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(short int, _SHORT_INT_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(signed short, _SIGNED_SHORT_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(signed short int, _SIGNED_SHORT_INT_TYPE);
-    /* register unsigned short */
-    _TYPE_REGISTER_TYPE(unsigned short, _UNSIGNED_SHORT_TYPE, ushort, _TYPE_C_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(unsigned short, _UNSIGNED_SHORT_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(unsigned short int, _UNSIGNED_SHORT_INT_TYPE);
-    /* register int */
-    _TYPE_REGISTER_TYPE(int, _INT_TYPE, int, _TYPE_C_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(int, _INT_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(signed, _SIGNED_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(signed int, _SIGNED_INT_TYPE);
-    /* register unsigned int */
-    _TYPE_REGISTER_TYPE(unsigned int, _UNSIGNED_INT_TYPE, uint, _TYPE_C_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(unsigned int, _UNSIGNED_INT_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(signed, _UNSIGNED_TYPE);
-    /* register long */
-    _TYPE_REGISTER_TYPE(long, _LONG_TYPE, long, _TYPE_C_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(long, _LONG_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(long int, _LONG_INT_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(signed long, _SIGNED_LONG_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(signed long int, _SIGNED_LONG_INT_TYPE);
-    /* register unsigned long */
-    _TYPE_REGISTER_TYPE(unsigned long, _UNSIGNED_LONG_TYPE, ulong, _TYPE_C_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(unsigned long, _UNSIGNED_LONG_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(unsigned long int, _UNSIGNED_LONG_INT_TYPE);
-    /* register float */
-    _TYPE_REGISTER_TYPE(float, _FLOAT_TYPE, float, _TYPE_C_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(float, _FLOAT_TYPE);
-    /* register double */
-    _TYPE_REGISTER_TYPE(double, _DOUBLE_TYPE, double, _TYPE_C_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(double, _DOUBLE_TYPE);
-    /* register long double */
-    _TYPE_REGISTER_TYPE(long double, _LONG_DOUBLE_TYPE, long_double, _TYPE_C_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(long double, _LONG_DOUBLE_TYPE);
-    /* register bool_t */
-    _TYPE_REGISTER_TYPE(bool_t, _CSTL_BOOL_TYPE, cstl_bool, _TYPE_C_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(bool_t, _CSTL_BOOL_TYPE);
-    /* register char* */
-    _TYPE_REGISTER_TYPE(string_t, _C_STRING_TYPE, cstr, _TYPE_C_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(string_t, _C_STRING_TYPE);
-    /* register void* */
-    _TYPE_REGISTER_TYPE(void*, _POINTER_TYPE, pointer, _TYPE_C_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(void*, _POINTER_TYPE);
+    size_t       t_pos = 0;
+    size_t       t_len = 0;
+    _typename_t* pt_name = NULL;
+    const char*  s_interned = NULL;
 
-#ifndef _MSC_VER
-    /* register _Bool */
-    _TYPE_REGISTER_TYPE(_Bool, _BOOL_TYPE, bool, _TYPE_C_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(_Bool, _BOOL_TYPE);
-    /* register long long */
-    _TYPE_REGISTER_TYPE(long long, _LONG_LONG_TYPE, long_long, _TYPE_C_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(long long, _LONG_LONG_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(long long int, _LONG_LONG_INT_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(signed long long, _SIGNED_LONG_LONG_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(signed long long int, _SIGNED_LONG_LONG_INT_TYPE);
-    /* register unsigned long long */
-    _TYPE_REGISTER_TYPE(unsigned long long, _UNSIGNED_LONG_LONG_TYPE, ulong_long, _TYPE_C_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(unsigned long long, _UNSIGNED_LONG_LONG_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(unsigned long long int, _UNSIGNED_LONG_LONG_INT_TYPE);
-#endif
+    assert(s_typename != NULL);
+    assert(strlen(s_typename) <= _TYPE_NAME_SIZE);
+
+    t_pos = _type_hash(s_typename);
+    if ((s_interned = _type_intern_find(s_typename, t_pos)) != NULL) {
+        return s_interned;
+    }
+
+    _type_lock();
+    /* other thread may intern the same name before the lock is acquired */
+    if ((s_interned = _type_intern_find(s_typename, t_pos)) == NULL) {
+        /* the interned names are never released, the count of them is limited by the types of program */
+        t_len = strlen(s_typename);
+        pt_name = (_typename_t*)_alloc_allocate(&_gt_typeregister._t_allocator, sizeof(_typename_t), 1);
+        assert(pt_name != NULL);
+        pt_name->_s_typename = (char*)_alloc_allocate(&_gt_typeregister._t_allocator, sizeof(char), t_len + 1);
+        assert(pt_name->_s_typename != NULL);
+        memcpy(pt_name->_s_typename, s_typename, t_len + 1);
+        pt_name->_pt_next = _gapt_typenamebucket[t_pos];
+        _TYPE_MEMORY_BARRIER();
+        _gapt_typenamebucket[t_pos] = pt_name;
+        s_interned = pt_name->_s_typename;
+    }
+    _type_unlock();
+
+    return s_interned;
+}
+
+/**
+ * Acquire and release the register lock.
+ */
+void _type_lock(void)
+{
+    /* the lock is held for a short time and rarely, so spinning is enough */
+    while (!_type_try_lock()) {
+        _TYPE_YIELD();
+    }
+}
 
-    _TYPE_REGISTER_END();
+bool_t _type_try_lock(void)
+{
+    return _gl_typelock == 0 && _TYPE_ATOMIC_CAS(&_gl_typelock, 0, 1) == 0;
 }
 
-void _type_register_cstl_builtin(void)
+void _type_unlock(void)
+{
+    assert(_gl_typelock == 1);
+
+    _TYPE_MEMORY_BARRIER();
+    _gl_typelock = 0;
+}
+
+/**
+ * Initialize the register, the builtin types are constant data and need not be registered.
+ */
+void _type_init(void)
 {
-    _TYPE_REGISTER_BEGIN();
-
-    /* register vector_t */
-    _TYPE_REGISTER_TYPE(vector_t, _VECTOR_TYPE, vector, _TYPE_CSTL_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(vector_t, _VECTOR_TYPE);
-    /* register list_t */
-    _TYPE_REGISTER_TYPE(list_t, _LIST_TYPE, list, _TYPE_CSTL_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(list_t, _LIST_TYPE);
-    /* register slist_t */
-    _TYPE_REGISTER_TYPE(slist_t, _SLIST_TYPE, slist, _TYPE_CSTL_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(slist_t, _SLIST_TYPE);
-    /* register deque_t */
-    _TYPE_REGISTER_TYPE(deque_t, _DEQUE_TYPE, deque, _TYPE_CSTL_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(deque_t, _DEQUE_TYPE);
-    /* register stack_t */
-    _TYPE_REGISTER_TYPE(stack_t, _STACK_TYPE, stack, _TYPE_CSTL_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(stack_t, _STACK_TYPE);
-    /* register queue_t */
-    _TYPE_REGISTER_TYPE(queue_t, _QUEUE_TYPE, queue, _TYPE_CSTL_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(queue_t, _QUEUE_TYPE);
-    /* register priority_queue_t */
-    _TYPE_REGISTER_TYPE(priority_queue_t, _PRIORITY_QUEUE_TYPE, priority_queue, _TYPE_CSTL_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(priority_queue_t, _PRIORITY_QUEUE_TYPE);
-    /* register set_t */
-    _TYPE_REGISTER_TYPE(set_t, _SET_TYPE, set, _TYPE_CSTL_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(set_t, _SET_TYPE);
-    /* register map_t */
-    _TYPE_REGISTER_TYPE(map_t, _MAP_TYPE, map, _TYPE_CSTL_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(map_t, _MAP_TYPE);
-    /* register multiset_t */
-    _TYPE_REGISTER_TYPE(multiset_t, _MULTISET_TYPE, multiset, _TYPE_CSTL_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(multiset_t, _MULTISET_TYPE);
-    /* register multimap_t */
-    _TYPE_REGISTER_TYPE(multimap_t, _MULTIMAP_TYPE, multimap, _TYPE_CSTL_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(multimap_t, _MULTIMAP_TYPE);
-    /* register hash_set_t */
-    _TYPE_REGISTER_TYPE(hash_set_t, _HASH_SET_TYPE, hash_set, _TYPE_CSTL_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(hash_set_t, _HASH_SET_TYPE);
-    /* register hash_map_t */
-    _TYPE_REGISTER_TYPE(hash_map_t, _HASH_MAP_TYPE, hash_map, _TYPE_CSTL_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(hash_map_t, _HASH_MAP_TYPE);
-    /* register hash_multiset_t */
-    _TYPE_REGISTER_TYPE(hash_multiset_t, _HASH_MULTISET_TYPE, hash_multiset, _TYPE_CSTL_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(hash_multiset_t, _HASH_MULTISET_TYPE);
-    /* register hash_multimap_t */
-    _TYPE_REGISTER_TYPE(hash_multimap_t, _HASH_MULTIMAP_TYPE, hash_multimap, _TYPE_CSTL_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(hash_multimap_t, _HASH_MULTIMAP_TYPE);
-    /* register pair_t */
-    _TYPE_REGISTER_TYPE(pair_t, _PAIR_TYPE, pair, _TYPE_CSTL_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(pair_t, _PAIR_TYPE);
-    /* register string_t */
-    _TYPE_REGISTER_TYPE(string_t, _STRING_TYPE, string, _TYPE_CSTL_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(string_t, _STRING_TYPE);
-    /* register range_t */
-    _TYPE_REGISTER_TYPE(range_t, _RANGE_TYPE, range, _TYPE_CSTL_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(range_t, _RANGE_TYPE);
-    /* register basic_string_t */
-    _TYPE_REGISTER_TYPE(basic_string_t, _BASIC_STRING_TYPE, basic_string, _TYPE_CSTL_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(basic_string_t, _BASIC_STRING_TYPE);
-
-    /* register iterator_t */
-    _TYPE_REGISTER_TYPE(iterator_t, _ITERATOR_TYPE, iterator, _TYPE_CSTL_BUILTIN);
-    _TYPE_REGISTER_TYPE_NODE(iterator_t, _ITERATOR_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(vector_iterator_t, _VECTOR_ITERATOR_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(list_iterator_t, _LIST_ITERATOR_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(slist_iterator_t, _SLIST_ITERATOR_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(deque_iterator_t, _DEQUE_ITERATOR_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(set_iterator_t, _SET_ITERATOR_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(map_iterator_t, _MAP_ITERATOR_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(multiset_iterator_t, _MULTISET_ITERATOR_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(multimap_iterator_t, _MULTIMAP_ITERATOR_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(hash_set_iterator_t, _HASH_SET_ITERATOR_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(hash_map_iterator_t, _HASH_MAP_ITERATOR_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(hash_multiset_iterator_t, _HASH_MULTISET_ITERATOR_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(hash_multimap_iterator_t, _HASH_MULTIMAP_ITERATOR_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(string_iterator_t, _STRING_ITERATOR_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(input_iterator_t, _INPUT_ITERATOR_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(output_iterator_t, _OUTPUT_ITERATOR_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(forward_iterator_t, _FORWARD_ITERATOR_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(bidirectional_iterator_t, _BIDIRECTIONAL_ITERATOR_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(random_access_iterator_t, _RANDOM_ACCESS_ITERATOR_TYPE);
-    _TYPE_REGISTER_TYPE_NODE(basic_string_iterator_t, _BASIC_STRING_ITERATOR_TYPE);
-
-    _TYPE_REGISTER_END();
+    _type_lock();
+    /* the threads that find the register uninitialized wait here, only the first one initializes it */
+    if (!_gt_typeregister._t_isinit) {
+        /* init allocator */
+        _alloc_init(&_gt_typeregister._t_allocator);
+
+        _gt_typeregister._t_nexttypeid = _TYPE_ID_USER_DEFINE;
+
+        _TYPE_MEMORY_BARRIER();
+        _gt_typeregister._t_isinit = true;
+    }
+    _type_unlock();
 }
 
 /**
@@ -363,21 +490,37 @@ void _type_register_cstl_builtin(void)
  */
 _typestyle_t _type_cache_find(const char* s_typename, char* s_formalname)
 {
-    size_t i = 0;
+    size_t       i = 0;
+    size_t       t_sequence = _gt_typecache_sequence;
+    _typestyle_t t_style = _TYPE_INVALID;
 
     assert(s_typename != NULL);
     assert(s_formalname != NULL);
 
+    /* the cache is being written */
+    if (t_sequence % 2 != 0) {
+        return _TYPE_INVALID;
+    }
+
+    _TYPE_MEMORY_BARRIER();
     for (i = 0; i < _TYPE_CACHE_COUNT; ++i) {
         if (_gt_typecache[i]._t_style == _TYPE_INVALID) {
-            return _TYPE_INVALID;
+            break;
         } else if (strncmp(s_typename, _gt_typecache[i]._s_typename, _TYPE_NAME_SIZE) == 0) {
             strncpy(s_formalname, _gt_typecache[i]._s_formalname, _TYPE_NAME_SIZE);
-            return _gt_typecache[i]._t_style;
+            t_style = _gt_typecache[i]._t_style;
+            break;
         }
     }
+    _TYPE_MEMORY_BARRIER();
 
-    return _TYPE_INVALID;
+    /* the entry may be changed while it is read, the caller parses the type name again */
+    if (t_style != _TYPE_INVALID && _gt_typecache_sequence != t_sequence) {
+        s_formalname[0] = '\0';
+        t_style = _TYPE_INVALID;
+    }
+
+    return t_style;
 }
 
 void _type_cache_update(const char* s_typename, const char* s_formalname, _typestyle_t t_style)
@@ -388,11 +531,131 @@ void _type_cache_update(const char* s_typename, const char* s_formalname, _types
     assert(strlen(s_formalname) > 0);
     assert(t_style == _TYPE_C_BUILTIN || t_style == _TYPE_USER_DEFINE || t_style == _TYPE_CSTL_BUILTIN);
 
+    /* the cache is only a shortcut, so it is not updated rather than waiting for other writers */
+    if (!_type_try_lock()) {
+        return;
+    }
+
+    _gt_typecache_sequence++;
+    _TYPE_MEMORY_BARRIER();
     strncpy(_gt_typecache[_gt_typecache_index]._s_typename, s_typename, _TYPE_NAME_SIZE);
     strncpy(_gt_typecache[_gt_typecache_index]._s_formalname, s_formalname, _TYPE_NAME_SIZE);
     _gt_typecache[_gt_typecache_index]._t_style = t_style;
+    _TYPE_MEMORY_BARRIER();
+    _gt_typecache_sequence++;
+
+    _gt_typecache_index = (_gt_typecache_index + 1) % _TYPE_CACHE_COUNT;
+    _type_unlock();
+}
+
+/**
+ * Find in type information cache.
+ */
+bool_t _type_info_cache_find(const char* s_typename, _typeinfo_t* pt_typeinfo)
+{
+    _typeinfocache_t* pt_cache = NULL;
+    size_t            t_sequence = _gt_typecache_sequence;
+    bool_t            b_find = false;
+
+    assert(s_typename != NULL);
+    assert(pt_typeinfo != NULL);
+
+    /* the cache is being written */
+    if (t_sequence % 2 != 0) {
+        return false;
+    }
+
+    _TYPE_MEMORY_BARRIER();
+    pt_cache = &_gt_typeinfocache[_type_info_cache_hash(s_typename)];
+    if (pt_cache->_t_generation == _gt_typeinfocache_generation &&
+        strncmp(s_typename, pt_cache->_s_typename, _TYPE_NAME_SIZE) == 0) {
+        memcpy(pt_typeinfo, &pt_cache->_t_typeinfo, sizeof(_typeinfo_t));
+        b_find = true;
+    }
+    _TYPE_MEMORY_BARRIER();
+
+    /* the entry may be changed while it is read, the caller resolves the type name again */
+    return b_find && _gt_typecache_sequence == t_sequence;
+}
+
+/**
+ * Update type information cache.
+ */
+void _type_info_cache_update(const char* s_typename, const _typeinfo_t* cpt_typeinfo, size_t t_generation)
+{
+    _typeinfocache_t* pt_cache = NULL;
+
+    assert(s_typename != NULL);
+    assert(strlen(s_typename) <= _TYPE_NAME_SIZE);
+    assert(cpt_typeinfo != NULL);
+    assert(cpt_typeinfo->_t_style != _TYPE_INVALID && cpt_typeinfo->_pt_type != NULL);
+
+    /* the cache is only a shortcut, so it is not updated rather than waiting for other writers */
+    if (!_type_try_lock()) {
+        return;
+    }
+    /* the caches are invalidated after the type name was resolved, the type information may be stale */
+    if (t_generation != _gt_typeinfocache_generation) {
+        _type_unlock();
+        return;
+    }
+
+    _gt_typecache_sequence++;
+    _TYPE_MEMORY_BARRIER();
+    pt_cache = &_gt_typeinfocache[_type_info_cache_hash(s_typename)];
+    strncpy(pt_cache->_s_typename, s_typename, _TYPE_NAME_SIZE);
+    pt_cache->_s_typename[_TYPE_NAME_SIZE] = '\0';
+    memcpy(&pt_cache->_t_typeinfo, cpt_typeinfo, sizeof(_typeinfo_t));
+    pt_cache->_t_generation = t_generation;
+    _TYPE_MEMORY_BARRIER();
+    _gt_typecache_sequence++;
+
+    _type_unlock();
+}
+
+/**
+ * Invalidate all type caches.
+ */
+void _type_cache_invalidate(void)
+{
+    _gt_typecache_sequence++;
+    _TYPE_MEMORY_BARRIER();
+    /* the type style cache keeps the style of registered user define type too */
+    _gt_typecache_index = 0;
+    memset(_gt_typecache, 0x00, sizeof(_typecache_t) * _TYPE_CACHE_COUNT);
+    /* the entries of old generation are never hit */
+    _gt_typeinfocache_generation++;
+    _TYPE_MEMORY_BARRIER();
+    _gt_typecache_sequence++;
+}
+
+/** local function implementation section **/
+static size_t _type_info_cache_hash(const char* s_typename)
+{
+    size_t t_hash = 0;
+
+    assert(s_typename != NULL);
+
+    while (*s_typename) {
+        t_hash = t_hash * _TYPE_HASH_BKDR_SEED + (*s_typename++);
+    }
+
+    return t_hash % _TYPE_INFO_CACHE_COUNT;
+}
+
+static const char* _type_intern_find(const char* s_typename, size_t t_pos)
+{
+    _typename_t* pt_name = NULL;
+
+    assert(s_typename != NULL);
+
+    for (pt_name = _gapt_typenamebucket[t_pos]; pt_name != NULL; pt_name = pt_name->_pt_next) {
+        if (strncmp(s_typename, pt_name->_s_typename, _TYPE_NAME_SIZE) == 0) {
+            return pt_name->_s_typename;
+        }
+    }
 
-    _gt_typecache_index = (++_gt_typecache_index) % _TYPE_CACHE_COUNT;
+    return NULL;
 }
 
 /** eof **/
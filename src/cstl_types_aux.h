@@ -31,6 +31,17 @@ extern "C" {
 
 /** constant declaration and macro section **/
 #define _TYPE_CACHE_COUNT       256
+#define _TYPE_INFO_CACHE_COUNT  256
+
+/*
+ * the register and the type caches are read without lock, the writers are serialized by the
+ * register lock and link the new node after it is filled, so the readers never see a partial node.
+ */
+#ifdef _MSC_VER
+#   define _TYPE_MEMORY_BARRIER()   MemoryBarrier()
+#else
+#   define _TYPE_MEMORY_BARRIER()   __sync_synchronize()
+#endif
 
 /** data type declaration and struct, union, enum section **/
 /**
@@ -42,10 +53,32 @@ typedef struct _tagtypecache {
     _typestyle_t        _t_style;
 }_typecache_t;
 
+/**
+ * interned type name, all containers of the same type share one copy of the formal name.
+ */
+typedef struct _tagtypename {
+    struct _tagtypename* _pt_next;
+    char*                _s_typename;
+}_typename_t;
+
+/**
+ * type information cache, the resolved type information of the type name that
+ * is used to create container. it is valid only in the generation of register.
+ */
+typedef struct _tagtypeinfocache {
+    char                _s_typename[_TYPE_NAME_SIZE + 1];
+    _typeinfo_t         _t_typeinfo;
+    size_t              _t_generation;
+}_typeinfocache_t;
+
 /** exported global variable declaration section **/
 extern _typeregister_t  _gt_typeregister;
 extern _typecache_t     _gt_typecache[_TYPE_CACHE_COUNT];
 extern size_t           _gt_typecache_index;
+extern _typeinfocache_t _gt_typeinfocache[_TYPE_INFO_CACHE_COUNT];
+extern _typename_t*     _gapt_typenamebucket[_TYPE_REGISTER_BUCKET_COUNT];
+extern size_t           _gt_typeinfocache_generation;
+extern volatile size_t  _gt_typecache_sequence;
 
 /** exported function prototype section **/
 /**
@@ -63,16 +96,61 @@ extern size_t _type_hash(const char* s_typename);
  */
 extern _type_t* _type_is_registered(const char* s_typename);
 /**
- * Initialize the register and register c builtin type and cstl builtin type 
+ * Find builtin type in the sorted table.
+ * @param s_typename    type name.
+ * @return type point to builtin type or NULL.
+ * @remarks s_typename must be not NULL, the builtin types are found without initializing register.
+ */
+extern _type_t* _type_find_builtin(const char* s_typename);
+/**
+ * Acquire and release the register lock, all writers of register and type caches hold it.
+ * @return void or whether the lock is acquired.
+ * @remarks the lock is not recursive.
+ */
+extern void _type_lock(void);
+extern bool_t _type_try_lock(void);
+extern void _type_unlock(void);
+/**
+ * Initialize the register, it is done only once even if the threads call it at the same time.
+ * @remarks c builtin type and cstl builtin type are kept in constant table and need not be registered.
  */
 extern void _type_init(void);
-extern void _type_register_c_builtin(void);
-extern void _type_register_cstl_builtin(void);
+/**
+ * Intern type name.
+ * @param s_typename    formal type name.
+ * @return the interned copy of type name, it is valid until the program exits.
+ * @remarks s_typename must be not NULL.
+ */
+extern const char* _type_intern_name(const char* s_typename);
 /**
  * Find in type style cache and update cache.
+ * @remarks the cache is not updated when the register lock is held by others.
  */
 extern _typestyle_t _type_cache_find(const char* s_typename, char* s_formalname);
 extern void _type_cache_update(const char* s_typename, const char* s_formalname, _typestyle_t t_style);
+/**
+ * Find in type information cache.
+ * @param s_typename    type name that is used to create container.
+ * @param pt_typeinfo   type information of the type name.
+ * @return whether the type name is in cache and pt_typeinfo is filled.
+ * @remarks s_typename and pt_typeinfo must be not NULL.
+ */
+extern bool_t _type_info_cache_find(const char* s_typename, _typeinfo_t* pt_typeinfo);
+/**
+ * Update type information cache.
+ * @param s_typename    type name that is used to create container.
+ * @param cpt_typeinfo  valid type information of the type name.
+ * @param t_generation  the cache generation that is read before the type name is resolved.
+ * @return void.
+ * @remarks s_typename and cpt_typeinfo must be not NULL, the cache is not updated when the
+ *          register lock is held by others or the generation is changed.
+ */
+extern void _type_info_cache_update(const char* s_typename, const _typeinfo_t* cpt_typeinfo, size_t t_generation);
+/**
+ * Invalidate all type caches, it must be called with register lock when the register changed.
+ * @return void.
+ */
+extern void _type_cache_invalidate(void);
 
 #ifdef __cplusplus
 }
@@ -39,12 +39,29 @@
 #include <cstl/cutility.h>
 
 #include "cstl_types_builtin.h"
+#include "cstl_hashtable_aux.h"
 
 /** local constant declaration and local macro section **/
 
 /** local data type declaration and local struct, union, enum section **/
 
 /** local function prototype section **/
+/**
+ * Combine hash value of element with hash value of elements before.
+ * @param t_seed    hash value of elements before.
+ * @param t_hash    hash value of element.
+ * @return the combined hash value.
+ */
+static size_t _type_hash_combine(size_t t_seed, size_t t_hash);
+
+/**
+ * Hash all elements within range [it_begin, it_end) with the element type hash function.
+ * @param t_size    element count of range.
+ * @param it_begin  range begin.
+ * @param it_end    range end.
+ * @return the hash value of range.
+ */
+static size_t _type_hash_elements(size_t t_size, iterator_t it_begin, iterator_t it_end);
 
 /** exported global variable definition section **/
 
@@ -52,7 +69,7 @@
 
 /** exported function implementation section **/
 /**
- * The cstl builtin copy, compare destroy function for c builtin type and cstl builtins.
+ * The cstl builtin initialize, copy, compare, destroy and hash function for c builtin type and cstl builtins.
  */
 /* c builtin */
 /* char */
@@ -81,6 +98,18 @@ void _type_destroy_char(const void* cpv_input, void* pv_output)
     _type_destroy_default(cpv_input, pv_output);
 }
 
+void _type_hash_char(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _hashtable_hash_bytes(cpv_input, sizeof(char));
+}
+
+void _type_compare_char(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    *(int*)pv_output = *(char*)cpv_first < *(char*)cpv_second ? -1 : (*(char*)cpv_second < *(char*)cpv_first ? 1 : 0);
+}
+
 /* unsigned char */
 void _type_init_uchar(const void* cpv_input, void* pv_output)
 {
@@ -107,6 +136,18 @@ void _type_destroy_uchar(const void* cpv_input, void* pv_output)
     _type_destroy_default(cpv_input, pv_output);
 }
 
+void _type_hash_uchar(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _hashtable_hash_bytes(cpv_input, sizeof(unsigned char));
+}
+
+void _type_compare_uchar(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    *(int*)pv_output = *(unsigned char*)cpv_first < *(unsigned char*)cpv_second ? -1 : (*(unsigned char*)cpv_second < *(unsigned char*)cpv_first ? 1 : 0);
+}
+
 /* short */
 void _type_init_short(const void* cpv_input, void* pv_output)
 {
@@ -133,6 +174,18 @@ void _type_destroy_short(const void* cpv_input, void* pv_output)
     _type_destroy_default(cpv_input, pv_output);
 }
 
+void _type_hash_short(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _hashtable_hash_bytes(cpv_input, sizeof(short));
+}
+
+void _type_compare_short(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    *(int*)pv_output = *(short*)cpv_first < *(short*)cpv_second ? -1 : (*(short*)cpv_second < *(short*)cpv_first ? 1 : 0);
+}
+
 /* unsigned short */
 void _type_init_ushort(const void* cpv_input, void* pv_output)
 {
@@ -159,6 +212,18 @@ void _type_destroy_ushort(const void* cpv_input, void* pv_output)
     _type_destroy_default(cpv_input, pv_output);
 }
 
+void _type_hash_ushort(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _hashtable_hash_bytes(cpv_input, sizeof(unsigned short));
+}
+
+void _type_compare_ushort(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    *(int*)pv_output = *(unsigned short*)cpv_first < *(unsigned short*)cpv_second ? -1 : (*(unsigned short*)cpv_second < *(unsigned short*)cpv_first ? 1 : 0);
+}
+
 /* int */
 void _type_init_int(const void* cpv_input, void* pv_output)
 {
@@ -185,6 +250,18 @@ void _type_destroy_int(const void* cpv_input, void* pv_output)
     _type_destroy_default(cpv_input, pv_output);
 }
 
+void _type_hash_int(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _hashtable_hash_bytes(cpv_input, sizeof(int));
+}
+
+void _type_compare_int(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    *(int*)pv_output = *(int*)cpv_first < *(int*)cpv_second ? -1 : (*(int*)cpv_second < *(int*)cpv_first ? 1 : 0);
+}
+
 /* unsigned int */
 void _type_init_uint(const void* cpv_input, void* pv_output)
 {
@@ -211,6 +288,18 @@ void _type_destroy_uint(const void* cpv_input, void* pv_output)
     _type_destroy_default(cpv_input, pv_output);
 }
 
+void _type_hash_uint(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _hashtable_hash_bytes(cpv_input, sizeof(unsigned int));
+}
+
+void _type_compare_uint(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    *(int*)pv_output = *(unsigned int*)cpv_first < *(unsigned int*)cpv_second ? -1 : (*(unsigned int*)cpv_second < *(unsigned int*)cpv_first ? 1 : 0);
+}
+
 /* long */
 void _type_init_long(const void* cpv_input, void* pv_output)
 {
@@ -237,6 +326,18 @@ void _type_destroy_long(const void* cpv_input, void* pv_output)
     _type_destroy_default(cpv_input, pv_output);
 }
 
+void _type_hash_long(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _hashtable_hash_bytes(cpv_input, sizeof(long));
+}
+
+void _type_compare_long(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    *(int*)pv_output = *(long*)cpv_first < *(long*)cpv_second ? -1 : (*(long*)cpv_second < *(long*)cpv_first ? 1 : 0);
+}
+
 /* unsigned long */
 void _type_init_ulong(const void* cpv_input, void* pv_output)
 {
@@ -263,6 +364,18 @@ void _type_destroy_ulong(const void* cpv_input, void* pv_output)
     _type_destroy_default(cpv_input, pv_output);
 }
 
+void _type_hash_ulong(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _hashtable_hash_bytes(cpv_input, sizeof(unsigned long));
+}
+
+void _type_compare_ulong(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    *(int*)pv_output = *(unsigned long*)cpv_first < *(unsigned long*)cpv_second ? -1 : (*(unsigned long*)cpv_second < *(unsigned long*)cpv_first ? 1 : 0);
+}
+
 /* float */
 void _type_init_float(const void* cpv_input, void* pv_output)
 {
@@ -289,6 +402,29 @@ void _type_destroy_float(const void* cpv_input, void* pv_output)
     _type_destroy_default(cpv_input, pv_output);
 }
 
+void _type_hash_float(const void* cpv_input, void* pv_output)
+{
+    float f_value = 0.0f;
+
+    assert(cpv_input != NULL && pv_output != NULL);
+    f_value = *(float*)cpv_input;
+    /* +0.0 and -0.0 are equal but have different bits */
+    if (f_value == 0.0f) {
+        f_value = 0.0f;
+    }
+    *(size_t*)pv_output = _hashtable_hash_bytes(&f_value, sizeof(float));
+}
+
+void _type_compare_float(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    float f_diff = 0.0f;
+
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    /* keep the same epsilon as less, so the result agrees with two less calls */
+    f_diff = *(float*)cpv_first - *(float*)cpv_second;
+    *(int*)pv_output = f_diff < -FLT_EPSILON ? -1 : (f_diff > FLT_EPSILON ? 1 : 0);
+}
+
 /* double */
 void _type_init_double(const void* cpv_input, void* pv_output)
 {
@@ -315,6 +451,29 @@ void _type_destroy_double(const void* cpv_input, void* pv_output)
     _type_destroy_default(cpv_input, pv_output);
 }
 
+void _type_hash_double(const void* cpv_input, void* pv_output)
+{
+    double d_value = 0.0;
+
+    assert(cpv_input != NULL && pv_output != NULL);
+    d_value = *(double*)cpv_input;
+    /* +0.0 and -0.0 are equal but have different bits */
+    if (d_value == 0.0) {
+        d_value = 0.0;
+    }
+    *(size_t*)pv_output = _hashtable_hash_bytes(&d_value, sizeof(double));
+}
+
+void _type_compare_double(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    double d_diff = 0.0;
+
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    /* keep the same epsilon as less, so the result agrees with two less calls */
+    d_diff = *(double*)cpv_first - *(double*)cpv_second;
+    *(int*)pv_output = d_diff < -DBL_EPSILON ? -1 : (d_diff > DBL_EPSILON ? 1 : 0);
+}
+
 /* long double */
 void _type_init_long_double(const void* cpv_input, void* pv_output)
 {
@@ -341,6 +500,29 @@ void _type_destroy_long_double(const void* cpv_input, void* pv_output)
     _type_destroy_default(cpv_input, pv_output);
 }
 
+void _type_hash_long_double(const void* cpv_input, void* pv_output)
+{
+    double d_value = 0.0;
+
+    assert(cpv_input != NULL && pv_output != NULL);
+    d_value = (double)*(long double*)cpv_input;
+    /* long double has padding bytes, so hash the value of double */
+    if (d_value == 0.0) {
+        d_value = 0.0;
+    }
+    *(size_t*)pv_output = _hashtable_hash_bytes(&d_value, sizeof(double));
+}
+
+void _type_compare_long_double(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    long double ld_diff = 0.0L;
+
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    /* keep the same epsilon as less, so the result agrees with two less calls */
+    ld_diff = *(long double*)cpv_first - *(long double*)cpv_second;
+    *(int*)pv_output = ld_diff < -LDBL_EPSILON ? -1 : (ld_diff > LDBL_EPSILON ? 1 : 0);
+}
+
 /* bool_t */
 void _type_init_cstl_bool(const void* cpv_input, void* pv_output)
 {
@@ -367,6 +549,18 @@ void _type_destroy_cstl_bool(const void* cpv_input, void* pv_output)
     _type_destroy_default(cpv_input, pv_output);
 }
 
+void _type_hash_cstl_bool(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _hashtable_hash_bytes(cpv_input, sizeof(bool_t));
+}
+
+void _type_compare_cstl_bool(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    *(int*)pv_output = *(bool_t*)cpv_first < *(bool_t*)cpv_second ? -1 : (*(bool_t*)cpv_second < *(bool_t*)cpv_first ? 1 : 0);
+}
+
 /* void* */
 void _type_init_pointer(const void* cpv_input, void* pv_output)
 {
@@ -393,6 +587,18 @@ void _type_destroy_pointer(const void* cpv_input, void* pv_output)
     _type_destroy_default(cpv_input, pv_output);
 }
 
+void _type_hash_pointer(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _hashtable_hash_bytes(cpv_input, sizeof(void*));
+}
+
+void _type_compare_pointer(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    *(int*)pv_output = *(void**)cpv_first < *(void**)cpv_second ? -1 : (*(void**)cpv_second < *(void**)cpv_first ? 1 : 0);
+}
+
 /* char* */
 /*
  * char* is specific c builtin type, the string_t is used for storing the 
@@ -430,6 +636,18 @@ void _type_destroy_cstr(const void* cpv_input, void* pv_output)
     *(bool_t*)pv_output = true;
 }
 
+void _type_hash_cstr(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _hashtable_hash_bytes(string_c_str((string_t*)cpv_input), string_length((string_t*)cpv_input));
+}
+
+void _type_compare_cstr(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    *(int*)pv_output = string_compare((string_t*)cpv_first, (string_t*)cpv_second);
+}
+
 /* cstl container */
 /* vector_t */
 void _type_init_vector(const void* cpv_input, void* pv_output)
@@ -464,6 +682,20 @@ void _type_destroy_vector(const void* cpv_input, void* pv_output)
     *(bool_t*)pv_output = true;
 }
 
+void _type_hash_vector(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _type_hash_elements(vector_size((vector_t*)cpv_input), vector_begin((vector_t*)cpv_input), vector_end((vector_t*)cpv_input));
+}
+
+void _type_move_vector(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    /* the elements are owned through pointers that do not point back to the container */
+    memcpy((vector_t*)cpv_first, cpv_second, sizeof(vector_t));
+    *(bool_t*)pv_output = true;
+}
+
 /* list_t */
 void _type_init_list(const void* cpv_input, void* pv_output)
 {
@@ -496,6 +728,19 @@ void _type_destroy_list(const void* cpv_input, void* pv_output)
     *(bool_t*)pv_output = true;
 }
 
+void _type_hash_list(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _type_hash_elements(list_size((list_t*)cpv_input), list_begin((list_t*)cpv_input), list_end((list_t*)cpv_input));
+}
+
+void _type_move_list(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    memcpy((list_t*)cpv_first, cpv_second, sizeof(list_t));
+    *(bool_t*)pv_output = true;
+}
+
 /* slist_t */
 void _type_init_slist(const void* cpv_input, void* pv_output)
 {
@@ -528,6 +773,19 @@ void _type_destroy_slist(const void* cpv_input, void* pv_output)
     *(bool_t*)pv_output = true;
 }
 
+void _type_hash_slist(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _type_hash_elements(slist_size((slist_t*)cpv_input), slist_begin((slist_t*)cpv_input), slist_end((slist_t*)cpv_input));
+}
+
+void _type_move_slist(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    memcpy((slist_t*)cpv_first, cpv_second, sizeof(slist_t));
+    *(bool_t*)pv_output = true;
+}
+
 /* deque_t */
 void _type_init_deque(const void* cpv_input, void* pv_output)
 {
@@ -560,6 +818,19 @@ void _type_destroy_deque(const void* cpv_input, void* pv_output)
     *(bool_t*)pv_output = true;
 }
 
+void _type_hash_deque(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _type_hash_elements(deque_size((deque_t*)cpv_input), deque_begin((deque_t*)cpv_input), deque_end((deque_t*)cpv_input));
+}
+
+void _type_move_deque(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    _deque_relocate((deque_t*)cpv_first, (deque_t*)cpv_second);
+    *(bool_t*)pv_output = true;
+}
+
 /* stack_t */
 void _type_init_stack(const void* cpv_input, void* pv_output)
 {
@@ -591,6 +862,24 @@ void _type_destroy_stack(const void* cpv_input, void* pv_output)
     *(bool_t*)pv_output = true;
 }
 
+void _type_hash_stack(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    /* the elements of adapter are not accessible, so only size is hashed */
+    *(size_t*)pv_output = _type_hash_combine(0, stack_size((stack_t*)cpv_input));
+}
+
+void _type_move_stack(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+#if defined (CSTL_STACK_VECTOR_SEQUENCE) || defined (CSTL_STACK_LIST_SEQUENCE)
+    memcpy((stack_t*)cpv_first, cpv_second, sizeof(stack_t));
+#else
+    _deque_relocate(&((stack_t*)cpv_first)->_t_sequence, &((stack_t*)cpv_second)->_t_sequence);
+#endif
+    *(bool_t*)pv_output = true;
+}
+
 /* queue_t */
 void _type_init_queue(const void* cpv_input, void* pv_output)
 {
@@ -623,6 +912,24 @@ void _type_destroy_queue(const void* cpv_input, void* pv_output)
     *(bool_t*)pv_output = true;
 }
 
+void _type_hash_queue(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    /* the elements of adapter are not accessible, so only size is hashed */
+    *(size_t*)pv_output = _type_hash_combine(0, queue_size((queue_t*)cpv_input));
+}
+
+void _type_move_queue(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+#ifdef CSTL_QUEUE_LIST_SEQUENCE
+    memcpy((queue_t*)cpv_first, cpv_second, sizeof(queue_t));
+#else
+    _deque_relocate(&((queue_t*)cpv_first)->_t_sequence, &((queue_t*)cpv_second)->_t_sequence);
+#endif
+    *(bool_t*)pv_output = true;
+}
+
 /* priority_queue_t */
 void _type_init_priority_queue(const void* cpv_input, void* pv_output)
 {
@@ -654,6 +961,20 @@ void _type_destroy_priority_queue(const void* cpv_input, void* pv_output)
     *(bool_t*)pv_output = true;
 }
 
+void _type_hash_priority_queue(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    /* the elements of adapter are not accessible, so only size is hashed */
+    *(size_t*)pv_output = _type_hash_combine(0, priority_queue_size((priority_queue_t*)cpv_input));
+}
+
+void _type_move_priority_queue(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    memcpy((priority_queue_t*)cpv_first, cpv_second, sizeof(priority_queue_t));
+    *(bool_t*)pv_output = true;
+}
+
 /* set_t */
 void _type_init_set(const void* cpv_input, void* pv_output)
 {
@@ -685,6 +1006,23 @@ void _type_destroy_set(const void* cpv_input, void* pv_output)
     *(bool_t*)pv_output = true;
 }
 
+void _type_hash_set(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _type_hash_elements(set_size((set_t*)cpv_input), set_begin((set_t*)cpv_input), set_end((set_t*)cpv_input));
+}
+
+void _type_move_set(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+#ifdef CSTL_SET_AVL_TREE
+    _avl_tree_relocate(&((set_t*)cpv_first)->_t_tree, &((set_t*)cpv_second)->_t_tree);
+#else
+    _rb_tree_relocate(&((set_t*)cpv_first)->_t_tree, &((set_t*)cpv_second)->_t_tree);
+#endif
+    *(bool_t*)pv_output = true;
+}
+
 /* map_t */
 void _type_init_map(const void* cpv_input, void* pv_output)
 {
@@ -716,6 +1054,25 @@ void _type_destroy_map(const void* cpv_input, void* pv_output)
     *(bool_t*)pv_output = true;
 }
 
+void _type_hash_map(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _type_hash_elements(map_size((map_t*)cpv_input), map_begin((map_t*)cpv_input), map_end((map_t*)cpv_input));
+}
+
+void _type_move_map(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    /* the temporary pair and compare functions are copied with the tree, and then the tree is fixed */
+    memcpy((map_t*)cpv_first, cpv_second, sizeof(map_t));
+#ifdef CSTL_MAP_AVL_TREE
+    _avl_tree_relocate(&((map_t*)cpv_first)->_t_tree, &((map_t*)cpv_second)->_t_tree);
+#else
+    _rb_tree_relocate(&((map_t*)cpv_first)->_t_tree, &((map_t*)cpv_second)->_t_tree);
+#endif
+    *(bool_t*)pv_output = true;
+}
+
 /* multiset_t */
 void _type_init_multiset(const void* cpv_input, void* pv_output)
 {
@@ -747,6 +1104,23 @@ void _type_destroy_multiset(const void* cpv_input, void* pv_output)
     *(bool_t*)pv_output = true;
 }
 
+void _type_hash_multiset(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _type_hash_elements(multiset_size((multiset_t*)cpv_input), multiset_begin((multiset_t*)cpv_input), multiset_end((multiset_t*)cpv_input));
+}
+
+void _type_move_multiset(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+#ifdef CSTL_MULTISET_AVL_TREE
+    _avl_tree_relocate(&((multiset_t*)cpv_first)->_t_tree, &((multiset_t*)cpv_second)->_t_tree);
+#else
+    _rb_tree_relocate(&((multiset_t*)cpv_first)->_t_tree, &((multiset_t*)cpv_second)->_t_tree);
+#endif
+    *(bool_t*)pv_output = true;
+}
+
 /* multimap_t */
 void _type_init_multimap(const void* cpv_input, void* pv_output)
 {
@@ -778,6 +1152,24 @@ void _type_destroy_multimap(const void* cpv_input, void* pv_output)
     *(bool_t*)pv_output = true;
 }
 
+void _type_hash_multimap(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _type_hash_elements(multimap_size((multimap_t*)cpv_input), multimap_begin((multimap_t*)cpv_input), multimap_end((multimap_t*)cpv_input));
+}
+
+void _type_move_multimap(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    memcpy((multimap_t*)cpv_first, cpv_second, sizeof(multimap_t));
+#ifdef CSTL_MULTIMAP_AVL_TREE
+    _avl_tree_relocate(&((multimap_t*)cpv_first)->_t_tree, &((multimap_t*)cpv_second)->_t_tree);
+#else
+    _rb_tree_relocate(&((multimap_t*)cpv_first)->_t_tree, &((multimap_t*)cpv_second)->_t_tree);
+#endif
+    *(bool_t*)pv_output = true;
+}
+
 /* hash_set_t */
 void _type_init_hash_set(const void* cpv_input, void* pv_output)
 {
@@ -809,6 +1201,20 @@ void _type_destroy_hash_set(const void* cpv_input, void* pv_output)
     *(bool_t*)pv_output = true;
 }
 
+void _type_hash_hash_set(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    /* the iteration order depends on buckets, so only size is hashed */
+    *(size_t*)pv_output = _type_hash_combine(0, hash_set_size((hash_set_t*)cpv_input));
+}
+
+void _type_move_hash_set(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    memcpy((hash_set_t*)cpv_first, cpv_second, sizeof(hash_set_t));
+    *(bool_t*)pv_output = true;
+}
+
 /* hash_map_t */
 void _type_init_hash_map(const void* cpv_input, void* pv_output)
 {
@@ -840,6 +1246,20 @@ void _type_destroy_hash_map(const void* cpv_input, void* pv_output)
     *(bool_t*)pv_output = true;
 }
 
+void _type_hash_hash_map(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    /* the iteration order depends on buckets, so only size is hashed */
+    *(size_t*)pv_output = _type_hash_combine(0, hash_map_size((hash_map_t*)cpv_input));
+}
+
+void _type_move_hash_map(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    memcpy((hash_map_t*)cpv_first, cpv_second, sizeof(hash_map_t));
+    *(bool_t*)pv_output = true;
+}
+
 /* hash_multiset_t */
 void _type_init_hash_multiset(const void* cpv_input, void* pv_output)
 {
@@ -872,6 +1292,20 @@ void _type_destroy_hash_multiset(const void* cpv_input, void* pv_output)
     *(bool_t*)pv_output = true;
 }
 
+void _type_hash_hash_multiset(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    /* the iteration order depends on buckets, so only size is hashed */
+    *(size_t*)pv_output = _type_hash_combine(0, hash_multiset_size((hash_multiset_t*)cpv_input));
+}
+
+void _type_move_hash_multiset(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    memcpy((hash_multiset_t*)cpv_first, cpv_second, sizeof(hash_multiset_t));
+    *(bool_t*)pv_output = true;
+}
+
 /* hash_multimap_t */
 void _type_init_hash_multimap(const void* cpv_input, void* pv_output)
 {
@@ -904,6 +1338,20 @@ void _type_destroy_hash_multimap(const void* cpv_input, void* pv_output)
     *(bool_t*)pv_output = true;
 }
 
+void _type_hash_hash_multimap(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    /* the iteration order depends on buckets, so only size is hashed */
+    *(size_t*)pv_output = _type_hash_combine(0, hash_multimap_size((hash_multimap_t*)cpv_input));
+}
+
+void _type_move_hash_multimap(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    memcpy((hash_multimap_t*)cpv_first, cpv_second, sizeof(hash_multimap_t));
+    *(bool_t*)pv_output = true;
+}
+
 /* pair_t */
 void _type_init_pair(const void* cpv_input, void* pv_output)
 {
@@ -936,6 +1384,23 @@ void _type_destroy_pair(const void* cpv_input, void* pv_output)
     *(bool_t*)pv_output = true;
 }
 
+void _type_hash_pair(const void* cpv_input, void* pv_output)
+{
+    pair_t* ppair_pair = (pair_t*)cpv_input;
+
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _type_hash_combine(
+        _type_hash_value(&ppair_pair->_t_typeinfofirst, ppair_pair->_pv_first),
+        _type_hash_value(&ppair_pair->_t_typeinfosecond, ppair_pair->_pv_second));
+}
+
+void _type_move_pair(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    memcpy((pair_t*)cpv_first, cpv_second, sizeof(pair_t));
+    *(bool_t*)pv_output = true;
+}
+
 /* string_t */
 void _type_init_string(const void* cpv_input, void* pv_output)
 {
@@ -968,6 +1433,25 @@ void _type_destroy_string(const void* cpv_input, void* pv_output)
     *(bool_t*)pv_output = true;
 }
 
+void _type_hash_string(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _hashtable_hash_bytes(string_c_str((string_t*)cpv_input), string_length((string_t*)cpv_input));
+}
+
+void _type_compare_string(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    *(int*)pv_output = string_compare((string_t*)cpv_first, (string_t*)cpv_second);
+}
+
+void _type_move_string(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    memcpy((string_t*)cpv_first, cpv_second, sizeof(string_t));
+    *(bool_t*)pv_output = true;
+}
+
 /* basic_string_t */
 void _type_init_basic_string(const void* cpv_input, void* pv_output)
 {
@@ -1001,6 +1485,19 @@ void _type_destroy_basic_string(const void* cpv_input, void* pv_output)
     *(bool_t*)pv_output = true;
 }
 
+void _type_hash_basic_string(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _type_hash_elements(basic_string_size((basic_string_t*)cpv_input), basic_string_begin((basic_string_t*)cpv_input), basic_string_end((basic_string_t*)cpv_input));
+}
+
+void _type_move_basic_string(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    memcpy((basic_string_t*)cpv_first, cpv_second, sizeof(basic_string_t));
+    *(bool_t*)pv_output = true;
+}
+
 /* iterator_t */
 void _type_init_iterator(const void* cpv_input, void* pv_output)
 {
@@ -1032,6 +1529,19 @@ void _type_destroy_iterator(const void* cpv_input, void* pv_output)
     _type_destroy_default(cpv_input, pv_output);
 }
 
+void _type_hash_iterator(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _hashtable_hash_bytes(cpv_input, sizeof(iterator_t));
+}
+
+void _type_move_iterator(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    memcpy((iterator_t*)cpv_first, cpv_second, sizeof(iterator_t));
+    *(bool_t*)pv_output = true;
+}
+
 /* range_t */
 void _type_init_range(const void* cpv_input, void* pv_output)
 {
@@ -1063,6 +1573,19 @@ void _type_destroy_range(const void* cpv_input, void* pv_output)
     _type_destroy_default(cpv_input, pv_output);
 }
 
+void _type_hash_range(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _hashtable_hash_bytes(cpv_input, sizeof(range_t));
+}
+
+void _type_move_range(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    memcpy((range_t*)cpv_first, cpv_second, sizeof(range_t));
+    *(bool_t*)pv_output = true;
+}
+
 #ifndef _MSC_VER
 /* _Bool */
 void _type_init_bool(const void* cpv_input, void* pv_output)
@@ -1090,6 +1613,18 @@ void _type_destroy_bool(const void* cpv_input, void* pv_output)
     _type_destroy_default(cpv_input, pv_output);
 }
 
+void _type_hash_bool(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _hashtable_hash_bytes(cpv_input, sizeof(_Bool));
+}
+
+void _type_compare_bool(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    *(int*)pv_output = *(_Bool*)cpv_first < *(_Bool*)cpv_second ? -1 : (*(_Bool*)cpv_second < *(_Bool*)cpv_first ? 1 : 0);
+}
+
 /* long long */
 void _type_init_long_long(const void* cpv_input, void* pv_output)
 {
@@ -1116,6 +1651,18 @@ void _type_destroy_long_long(const void* cpv_input, void* pv_output)
     _type_destroy_default(cpv_input, pv_output);
 }
 
+void _type_hash_long_long(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _hashtable_hash_bytes(cpv_input, sizeof(long long));
+}
+
+void _type_compare_long_long(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    *(int*)pv_output = *(long long*)cpv_first < *(long long*)cpv_second ? -1 : (*(long long*)cpv_second < *(long long*)cpv_first ? 1 : 0);
+}
+
 /* unsigned long long */
 void _type_init_ulong_long(const void* cpv_input, void* pv_output)
 {
@@ -1141,9 +1688,45 @@ void _type_destroy_ulong_long(const void* cpv_input, void* pv_output)
 {
     _type_destroy_default(cpv_input, pv_output);
 }
+
+void _type_hash_ulong_long(const void* cpv_input, void* pv_output)
+{
+    assert(cpv_input != NULL && pv_output != NULL);
+    *(size_t*)pv_output = _hashtable_hash_bytes(cpv_input, sizeof(unsigned long long));
+}
+
+void _type_compare_ulong_long(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
+    *(int*)pv_output = *(unsigned long long*)cpv_first < *(unsigned long long*)cpv_second ? -1 : (*(unsigned long long*)cpv_second < *(unsigned long long*)cpv_first ? 1 : 0);
+}
 #endif
 
 /** local function implementation section **/
+/**
+ * Combine hash value of element with hash value of elements before.
+ */
+static size_t _type_hash_combine(size_t t_seed, size_t t_hash)
+{
+    return t_seed ^ (t_hash + (size_t)0x9E3779B9 + (t_seed << 6) + (t_seed >> 2));
+}
+
+/**
+ * Hash all elements within range [it_begin, it_end) with the element type hash function.
+ */
+static size_t _type_hash_elements(size_t t_size, iterator_t it_begin, iterator_t it_end)
+{
+    _typeinfo_t* pt_typeinfo = _iterator_get_typeinfo(it_begin);
+    size_t       t_hash = _type_hash_combine(0, t_size);
+
+    assert(pt_typeinfo != NULL);
+
+    for (; !iterator_equal(it_begin, it_end); it_begin = iterator_next(it_begin)) {
+        t_hash = _type_hash_combine(t_hash, _type_hash_value(pt_typeinfo, _iterator_get_pointer_ignore_cstr(it_begin)));
+    }
+
+    return t_hash;
+}
 
 /** eof **/
 
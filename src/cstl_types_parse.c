@@ -30,15 +30,16 @@
 #include "cstl_types_builtin.h"
 
 /** local constant declaration and local macro section **/
+/* the pt_analysis must be defined before use those macro */
 #define _TOKEN_MATCH(s_tokentext, s_formalname)\
     do {\
-        assert(strncmp(_gt_typeanalysis._s_tokentext, s_tokentext, _TYPE_NAME_SIZE) == 0);\
-        strncat(s_formalname, _gt_typeanalysis._s_tokentext, _TYPE_NAME_SIZE);\
+        assert(strncmp(pt_analysis->_s_tokentext, s_tokentext, _TYPE_NAME_SIZE) == 0);\
+        strncat(s_formalname, pt_analysis->_s_tokentext, _TYPE_NAME_SIZE);\
     } while (false)
 #define _TOKEN_MATCH_SPACE(s_formalname)\
     strncat(s_formalname, _TOKEN_TEXT_SPACE, _TYPE_NAME_SIZE)
 #define _TOKEN_MATCH_IDENTIFIER(s_formalname)\
-    strncat(s_formalname, _gt_typeanalysis._s_tokentext, _TYPE_NAME_SIZE)
+    strncat(s_formalname, pt_analysis->_s_tokentext, _TYPE_NAME_SIZE)
 
 #define _TOKEN_TEXT_CHAR                           "char"
 #define _TOKEN_TEXT_SHORT                          "short"
@@ -117,7 +118,6 @@ typedef struct _tagkeytable
 /** local function prototype section **/
 
 /** exported global variable definition section **/
-_typeanalysis_t _gt_typeanalysis = {{'\0'}, {'\0'}, 0, _TOKEN_INVALID};
 
 /** local global variable definition section **/
 static keytable_t _sgt_table[] = {
@@ -188,6 +188,7 @@ _typestyle_t _type_get_style(const char* s_typename, char* s_formalname)
      */
     char            s_userdefine[_TYPE_NAME_SIZE + 1];
     _typestyle_t    t_style = _TYPE_INVALID;
+    _typeanalysis_t t_analysis;     /* the parser state is owned by each call, so the parser is reentrant */
 
     assert(s_typename != NULL);
     assert(s_formalname != NULL);
@@ -203,15 +204,15 @@ _typestyle_t _type_get_style(const char* s_typename, char* s_formalname)
 
     /* initialize the type analysis */
     s_userdefine[0] = s_userdefine[_TYPE_NAME_SIZE] = '\0';
-    memset(_gt_typeanalysis._s_typename, '\0', _TYPE_NAME_SIZE+1);
-    memset(_gt_typeanalysis._s_tokentext, '\0', _TYPE_NAME_SIZE+1);
-    _gt_typeanalysis._t_index = 0;
-    _gt_typeanalysis._t_token = _TOKEN_INVALID;
-    strncpy(_gt_typeanalysis._s_typename, s_typename, _TYPE_NAME_SIZE);
+    memset(t_analysis._s_typename, '\0', _TYPE_NAME_SIZE+1);
+    memset(t_analysis._s_tokentext, '\0', _TYPE_NAME_SIZE+1);
+    t_analysis._t_index = 0;
+    t_analysis._t_token = _TOKEN_INVALID;
+    strncpy(t_analysis._s_typename, s_typename, _TYPE_NAME_SIZE);
 
     /* TYPE_DESCRIPT -> C_BUILTIN | USER_DEFINE | CSTL_BUILTIN */
-    _type_get_token();
-    switch (_gt_typeanalysis._t_token) {
+    _type_get_token(&t_analysis);
+    switch (t_analysis._t_token) {
         /* TYPE_DESCRIPT -> C_BUILTIN */
         case _TOKEN_KEY_CHAR:
         case _TOKEN_KEY_SHORT:
@@ -224,14 +225,14 @@ _typestyle_t _type_get_style(const char* s_typename, char* s_formalname)
         case _TOKEN_KEY_VOID:
         case _TOKEN_KEY_CSTL_BOOL:
         case _TOKEN_KEY_BOOL:
-            t_style = _type_parse_c_builtin(s_formalname) ? _TYPE_C_BUILTIN : _TYPE_INVALID;
+            t_style = _type_parse_c_builtin(&t_analysis, s_formalname) ? _TYPE_C_BUILTIN : _TYPE_INVALID;
             break;
         /* TYPE_DESCRIPT -> USER_DEFINE */
         case _TOKEN_KEY_STRUCT:
         case _TOKEN_KEY_ENUM:
         case _TOKEN_KEY_UNION:
         case _TOKEN_IDENTIFIER:
-            if (_type_parse_user_define(s_userdefine)) {
+            if (_type_parse_user_define(&t_analysis, s_userdefine)) {
                 t_style = _TYPE_USER_DEFINE;
                 strncat(s_formalname, s_userdefine, _TYPE_NAME_SIZE);
             } else {
@@ -278,15 +279,15 @@ _typestyle_t _type_get_style(const char* s_typename, char* s_formalname)
         case _TOKEN_KEY_BIDIRECTIONAL_ITERATOR:
         case _TOKEN_KEY_RANDOM_ACCESS_ITERATOR:
         case _TOKEN_KEY_BASIC_STRING_ITERATOR:
-            t_style = _type_parse_cstl_builtin(s_formalname) ? _TYPE_CSTL_BUILTIN : _TYPE_INVALID;
+            t_style = _type_parse_cstl_builtin(&t_analysis, s_formalname) ? _TYPE_CSTL_BUILTIN : _TYPE_INVALID;
             break;
         default:
             t_style = _TYPE_INVALID;
             break;
     }
 
-    _type_get_token();
-    t_style = _gt_typeanalysis._t_token == _TOKEN_END_OF_INPUT ? t_style : _TYPE_INVALID;
+    _type_get_token(&t_analysis);
+    t_style = t_analysis._t_token == _TOKEN_END_OF_INPUT ? t_style : _TYPE_INVALID;
 
     /* update type style cache */
     if (t_style != _TYPE_INVALID) {
@@ -299,7 +300,7 @@ _typestyle_t _type_get_style(const char* s_typename, char* s_formalname)
 /**
  * Get the next toke from input string.
  */
-void _type_get_token(void)
+void _type_get_token(_typeanalysis_t* pt_analysis)
 {
     /*
      * this lexical analysis algorithm is associated with 
@@ -309,55 +310,56 @@ void _type_get_token(void)
     size_t       t_keyindex = 0;
     _typelex_t   t_lexstate = _LEX_START;
 
-    memset(_gt_typeanalysis._s_tokentext, '\0', _TYPE_NAME_SIZE + 1);
+    assert(pt_analysis != NULL);
+    memset(pt_analysis->_s_tokentext, '\0', _TYPE_NAME_SIZE + 1);
 
     while (t_lexstate != _LEX_ACCEPT) {
         switch (t_lexstate) {
             case _LEX_START:
-                if (isalpha(_gt_typeanalysis._s_typename[_gt_typeanalysis._t_index]) ||
-                    _gt_typeanalysis._s_typename[_gt_typeanalysis._t_index] == _TOKEN_CHARACTER_UNDERLINE) {
-                    _gt_typeanalysis._s_tokentext[t_tokentextindex++] = _gt_typeanalysis._s_typename[_gt_typeanalysis._t_index++];
+                if (isalpha(pt_analysis->_s_typename[pt_analysis->_t_index]) ||
+                    pt_analysis->_s_typename[pt_analysis->_t_index] == _TOKEN_CHARACTER_UNDERLINE) {
+                    pt_analysis->_s_tokentext[t_tokentextindex++] = pt_analysis->_s_typename[pt_analysis->_t_index++];
                     t_lexstate = _LEX_IN_IDENTIFIER;
-                } else if (_gt_typeanalysis._s_typename[_gt_typeanalysis._t_index] == _TOKEN_CHARACTER_LEFT_BRACKET) {
-                    _gt_typeanalysis._s_tokentext[t_tokentextindex++] = _gt_typeanalysis._s_typename[_gt_typeanalysis._t_index++];
-                    _gt_typeanalysis._t_token = _TOKEN_SIGN_LEFT_BRACKET;
+                } else if (pt_analysis->_s_typename[pt_analysis->_t_index] == _TOKEN_CHARACTER_LEFT_BRACKET) {
+                    pt_analysis->_s_tokentext[t_tokentextindex++] = pt_analysis->_s_typename[pt_analysis->_t_index++];
+                    pt_analysis->_t_token = _TOKEN_SIGN_LEFT_BRACKET;
                     t_lexstate = _LEX_ACCEPT;
-                } else if (_gt_typeanalysis._s_typename[_gt_typeanalysis._t_index] == _TOKEN_CHARACTER_RIGHT_BRACKET) {
-                    _gt_typeanalysis._s_tokentext[t_tokentextindex++] = _gt_typeanalysis._s_typename[_gt_typeanalysis._t_index++];
-                    _gt_typeanalysis._t_token = _TOKEN_SIGN_RIGHT_BRACKET;
+                } else if (pt_analysis->_s_typename[pt_analysis->_t_index] == _TOKEN_CHARACTER_RIGHT_BRACKET) {
+                    pt_analysis->_s_tokentext[t_tokentextindex++] = pt_analysis->_s_typename[pt_analysis->_t_index++];
+                    pt_analysis->_t_token = _TOKEN_SIGN_RIGHT_BRACKET;
                     t_lexstate = _LEX_ACCEPT;
-                } else if (_gt_typeanalysis._s_typename[_gt_typeanalysis._t_index] == _TOKEN_CHARACTER_COMMA) {
-                    _gt_typeanalysis._s_tokentext[t_tokentextindex++] = _gt_typeanalysis._s_typename[_gt_typeanalysis._t_index++];
-                    _gt_typeanalysis._t_token = _TOKEN_SIGN_COMMA;
+                } else if (pt_analysis->_s_typename[pt_analysis->_t_index] == _TOKEN_CHARACTER_COMMA) {
+                    pt_analysis->_s_tokentext[t_tokentextindex++] = pt_analysis->_s_typename[pt_analysis->_t_index++];
+                    pt_analysis->_t_token = _TOKEN_SIGN_COMMA;
                     t_lexstate = _LEX_ACCEPT;
-                } else if (_gt_typeanalysis._s_typename[_gt_typeanalysis._t_index] == _TOKEN_CHARACTER_POINTER) {
-                    _gt_typeanalysis._s_tokentext[t_tokentextindex++] = _gt_typeanalysis._s_typename[_gt_typeanalysis._t_index++];
-                    _gt_typeanalysis._t_token = _TOKEN_SIGN_POINTER;
+                } else if (pt_analysis->_s_typename[pt_analysis->_t_index] == _TOKEN_CHARACTER_POINTER) {
+                    pt_analysis->_s_tokentext[t_tokentextindex++] = pt_analysis->_s_typename[pt_analysis->_t_index++];
+                    pt_analysis->_t_token = _TOKEN_SIGN_POINTER;
                     t_lexstate = _LEX_ACCEPT;
-                } else if (isspace(_gt_typeanalysis._s_typename[_gt_typeanalysis._t_index])) {
-                    _gt_typeanalysis._t_index++;
+                } else if (isspace(pt_analysis->_s_typename[pt_analysis->_t_index])) {
+                    pt_analysis->_t_index++;
                     t_lexstate = _LEX_START;
-                } else if (_gt_typeanalysis._s_typename[_gt_typeanalysis._t_index] == _TOKEN_CHARACTER_END_OF_INPUT) {
-                    _gt_typeanalysis._t_token =  _TOKEN_END_OF_INPUT;
+                } else if (pt_analysis->_s_typename[pt_analysis->_t_index] == _TOKEN_CHARACTER_END_OF_INPUT) {
+                    pt_analysis->_t_token =  _TOKEN_END_OF_INPUT;
                     t_lexstate = _LEX_ACCEPT;
                 } else {
-                    _gt_typeanalysis._t_token =  _TOKEN_INVALID;
+                    pt_analysis->_t_token =  _TOKEN_INVALID;
                     t_lexstate = _LEX_ACCEPT;
                 }
                 break;
             case _LEX_IN_IDENTIFIER:
-                if (isalpha(_gt_typeanalysis._s_typename[_gt_typeanalysis._t_index]) ||
-                    isdigit(_gt_typeanalysis._s_typename[_gt_typeanalysis._t_index]) ||
-                    _gt_typeanalysis._s_typename[_gt_typeanalysis._t_index] == _TOKEN_CHARACTER_UNDERLINE) {
-                    _gt_typeanalysis._s_tokentext[t_tokentextindex++] = _gt_typeanalysis._s_typename[_gt_typeanalysis._t_index++];
+                if (isalpha(pt_analysis->_s_typename[pt_analysis->_t_index]) ||
+                    isdigit(pt_analysis->_s_typename[pt_analysis->_t_index]) ||
+                    pt_analysis->_s_typename[pt_analysis->_t_index] == _TOKEN_CHARACTER_UNDERLINE) {
+                    pt_analysis->_s_tokentext[t_tokentextindex++] = pt_analysis->_s_typename[pt_analysis->_t_index++];
                     t_lexstate = _LEX_IN_IDENTIFIER;
                 } else {
-                    _gt_typeanalysis._t_token = _TOKEN_IDENTIFIER;
+                    pt_analysis->_t_token = _TOKEN_IDENTIFIER;
                     t_lexstate = _LEX_ACCEPT;
                 }
                 break;
             default:
-                _gt_typeanalysis._t_token = _TOKEN_INVALID;
+                pt_analysis->_t_token = _TOKEN_INVALID;
                 t_lexstate = _LEX_ACCEPT;
                 assert(false);
                 break;
@@ -365,10 +367,10 @@ void _type_get_token(void)
     }
 
     /* if token is identifier then check is keyword */
-    if (_gt_typeanalysis._t_token == _TOKEN_IDENTIFIER) {
+    if (pt_analysis->_t_token == _TOKEN_IDENTIFIER) {
         while (_sgt_table[t_keyindex]._s_tokentext != NULL) {
-            if (strncmp(_gt_typeanalysis._s_tokentext, _sgt_table[t_keyindex]._s_tokentext, _TYPE_NAME_SIZE) == 0) {
-                _gt_typeanalysis._t_token = _sgt_table[t_keyindex]._t_token;
+            if (strncmp(pt_analysis->_s_tokentext, _sgt_table[t_keyindex]._s_tokentext, _TYPE_NAME_SIZE) == 0) {
+                pt_analysis->_t_token = _sgt_table[t_keyindex]._t_token;
                 return;
             }
 
@@ -380,35 +382,37 @@ void _type_get_token(void)
 /**
  * Rollback current token to input string.
  */
-void _type_token_rollback(void)
+void _type_token_rollback(_typeanalysis_t* pt_analysis)
 {
-    assert(_gt_typeanalysis._t_token == _TOKEN_END_OF_INPUT ||
-           _gt_typeanalysis._t_token == _TOKEN_SIGN_COMMA ||
-           _gt_typeanalysis._t_token == _TOKEN_SIGN_RIGHT_BRACKET);
-    assert(_gt_typeanalysis._s_typename[_gt_typeanalysis._t_index] == _TOKEN_CHARACTER_END_OF_INPUT ||
-           _gt_typeanalysis._s_typename[_gt_typeanalysis._t_index-1] == _TOKEN_CHARACTER_COMMA ||
-           _gt_typeanalysis._s_typename[_gt_typeanalysis._t_index-1] == _TOKEN_CHARACTER_RIGHT_BRACKET);
-    assert(strncmp(_gt_typeanalysis._s_tokentext, _TOKEN_TEXT_EMPTY, _TYPE_NAME_SIZE) == 0 ||
-           strncmp(_gt_typeanalysis._s_tokentext, _TOKEN_TEXT_COMMA, _TYPE_NAME_SIZE) == 0 ||
-           strncmp(_gt_typeanalysis._s_tokentext, _TOKEN_TEXT_RIGHT_BRACKET, _TYPE_NAME_SIZE) == 0);
+    assert(pt_analysis != NULL);
+    assert(pt_analysis->_t_token == _TOKEN_END_OF_INPUT ||
+           pt_analysis->_t_token == _TOKEN_SIGN_COMMA ||
+           pt_analysis->_t_token == _TOKEN_SIGN_RIGHT_BRACKET);
+    assert(pt_analysis->_s_typename[pt_analysis->_t_index] == _TOKEN_CHARACTER_END_OF_INPUT ||
+           pt_analysis->_s_typename[pt_analysis->_t_index-1] == _TOKEN_CHARACTER_COMMA ||
+           pt_analysis->_s_typename[pt_analysis->_t_index-1] == _TOKEN_CHARACTER_RIGHT_BRACKET);
+    assert(strncmp(pt_analysis->_s_tokentext, _TOKEN_TEXT_EMPTY, _TYPE_NAME_SIZE) == 0 ||
+           strncmp(pt_analysis->_s_tokentext, _TOKEN_TEXT_COMMA, _TYPE_NAME_SIZE) == 0 ||
+           strncmp(pt_analysis->_s_tokentext, _TOKEN_TEXT_RIGHT_BRACKET, _TYPE_NAME_SIZE) == 0);
 
-    if (_gt_typeanalysis._s_typename[_gt_typeanalysis._t_index] != _TOKEN_CHARACTER_END_OF_INPUT) {
-        _gt_typeanalysis._t_index--;
-    } else if (_gt_typeanalysis._t_token == _TOKEN_SIGN_COMMA ||
-               _gt_typeanalysis._t_token == _TOKEN_SIGN_RIGHT_BRACKET) {
-        _gt_typeanalysis._t_index--;
+    if (pt_analysis->_s_typename[pt_analysis->_t_index] != _TOKEN_CHARACTER_END_OF_INPUT) {
+        pt_analysis->_t_index--;
+    } else if (pt_analysis->_t_token == _TOKEN_SIGN_COMMA ||
+               pt_analysis->_t_token == _TOKEN_SIGN_RIGHT_BRACKET) {
+        pt_analysis->_t_index--;
     }
-    _gt_typeanalysis._t_token = _TOKEN_ROLLBACK;
+    pt_analysis->_t_token = _TOKEN_ROLLBACK;
 }
 
 /**
  * Parse specific token, and get formal name.
  */
-bool_t _type_parse_c_builtin(char* s_formalname)
+bool_t _type_parse_c_builtin(_typeanalysis_t* pt_analysis, char* s_formalname)
 {
+    assert(pt_analysis != NULL);
     assert(s_formalname != NULL);
     /* C_BUILTIN -> SIMPLE_BUILTIN | SIGNED_BUILTIN | UNSIGNED_BUILTIN | POINTER_BUILTIN */
-    switch (_gt_typeanalysis._t_token) {
+    switch (pt_analysis->_t_token) {
         /* C_BUILTIN -> SIMPLE_BUILTIN */
         case _TOKEN_KEY_CHAR:
         case _TOKEN_KEY_SHORT:
@@ -418,19 +422,19 @@ bool_t _type_parse_c_builtin(char* s_formalname)
         case _TOKEN_KEY_DOUBLE:
         case _TOKEN_KEY_CSTL_BOOL:
         case _TOKEN_KEY_BOOL:
-            return _type_parse_simple_builtin(s_formalname);
+            return _type_parse_simple_builtin(pt_analysis, s_formalname);
             break;
         /* C_BUILTIN -> SIGNED_BUILTIN */
         case _TOKEN_KEY_SIGNED:
-            return _type_parse_signed_builtin(s_formalname);
+            return _type_parse_signed_builtin(pt_analysis, s_formalname);
             break;
         /* C_BUILTIN -> UNSIGNED_BUILTIN */
         case _TOKEN_KEY_UNSIGNED:
-            return _type_parse_unsigned_builtin(s_formalname);
+            return _type_parse_unsigned_builtin(pt_analysis, s_formalname);
             break;
         /* C_BUILTIN -> POINTER_BUILTIN */
         case _TOKEN_KEY_VOID:
-            return _type_parse_pointer_builtin(s_formalname);
+            return _type_parse_pointer_builtin(pt_analysis, s_formalname);
             break;
         default:
             return false;
@@ -438,14 +442,15 @@ bool_t _type_parse_c_builtin(char* s_formalname)
     }
 }
 
-bool_t _type_parse_pointer_builtin(char* s_formalname)
+bool_t _type_parse_pointer_builtin(_typeanalysis_t* pt_analysis, char* s_formalname)
 {
+    assert(pt_analysis != NULL);
     assert(s_formalname != NULL);
     /* POINTER_BUILTIN -> void * */
-    switch (_gt_typeanalysis._t_token) {
+    switch (pt_analysis->_t_token) {
         case _TOKEN_KEY_VOID:
             _TOKEN_MATCH(_TOKEN_TEXT_VOID, s_formalname);
-            _type_get_token();
+            _type_get_token(pt_analysis);
             _TOKEN_MATCH(_TOKEN_TEXT_POINTER, s_formalname);
             return true;
             break;
@@ -455,11 +460,12 @@ bool_t _type_parse_pointer_builtin(char* s_formalname)
     }
 }
 
-bool_t _type_parse_pointer_suffix(char* s_formalname)
+bool_t _type_parse_pointer_suffix(_typeanalysis_t* pt_analysis, char* s_formalname)
 {
+    assert(pt_analysis != NULL);
     assert(s_formalname != NULL);
     /* POINTER_SUFFIX -> * | $ */
-    switch (_gt_typeanalysis._t_token) {
+    switch (pt_analysis->_t_token) {
         /* POINTER_SUFFIX -> * */
         case _TOKEN_SIGN_POINTER:
             _TOKEN_MATCH(_TOKEN_TEXT_POINTER, s_formalname);
@@ -469,7 +475,7 @@ bool_t _type_parse_pointer_suffix(char* s_formalname)
         case _TOKEN_END_OF_INPUT:
         case _TOKEN_SIGN_RIGHT_BRACKET:
         case _TOKEN_SIGN_COMMA:
-            _type_token_rollback();
+            _type_token_rollback(pt_analysis);
             return true;
             break;
         default:
@@ -478,11 +484,12 @@ bool_t _type_parse_pointer_suffix(char* s_formalname)
     }
 }
 
-bool_t _type_parse_common_suffix(char* s_formalname)
+bool_t _type_parse_common_suffix(_typeanalysis_t* pt_analysis, char* s_formalname)
 {
+    assert(pt_analysis != NULL);
     assert(s_formalname != NULL);
     /* COMMON_SUFFIX -> {+' '}int | $ */
-    switch (_gt_typeanalysis._t_token) {
+    switch (pt_analysis->_t_token) {
         /* COMMON_SUFFIX -> {+' '}int */
         case _TOKEN_KEY_INT:
             _TOKEN_MATCH_SPACE(s_formalname);
@@ -493,7 +500,7 @@ bool_t _type_parse_common_suffix(char* s_formalname)
         case _TOKEN_END_OF_INPUT:
         case _TOKEN_SIGN_RIGHT_BRACKET:
         case _TOKEN_SIGN_COMMA:
-            _type_token_rollback();
+            _type_token_rollback(pt_analysis);
             return true;
             break;
         default:
@@ -503,24 +510,25 @@ bool_t _type_parse_common_suffix(char* s_formalname)
 }
 
 
-bool_t _type_parse_complex_long_suffix(char* s_formalname)
+bool_t _type_parse_complex_long_suffix(_typeanalysis_t* pt_analysis, char* s_formalname)
 {
+    assert(pt_analysis != NULL);
     assert(s_formalname != NULL);
     /* COMPLEX_LONG_SUFFIX -> {+' '}long COMMON_SUFFIX | COMMON_SUFFIX */
-    switch (_gt_typeanalysis._t_token) {
+    switch (pt_analysis->_t_token) {
         /* COMPLEX_LONG_SUFFIX -> {+' '}long COMMON_SUFFIX */
         case _TOKEN_KEY_LONG:
             _TOKEN_MATCH_SPACE(s_formalname);
             _TOKEN_MATCH(_TOKEN_TEXT_LONG, s_formalname);
-            _type_get_token();
-            return _type_parse_common_suffix(s_formalname);
+            _type_get_token(pt_analysis);
+            return _type_parse_common_suffix(pt_analysis, s_formalname);
             break;
         /* COMPLEX_LONG_SUFFIX -> COMMON_SUFFIX */
         case _TOKEN_KEY_INT:
         case _TOKEN_END_OF_INPUT:
         case _TOKEN_SIGN_RIGHT_BRACKET:
         case _TOKEN_SIGN_COMMA:
-            return _type_parse_common_suffix(s_formalname);
+            return _type_parse_common_suffix(pt_analysis, s_formalname);
             break;
         default:
             return false;
@@ -528,11 +536,12 @@ bool_t _type_parse_complex_long_suffix(char* s_formalname)
     }
 }
 
-bool_t _type_parse_simple_long_suffix(char* s_formalname)
+bool_t _type_parse_simple_long_suffix(_typeanalysis_t* pt_analysis, char* s_formalname)
 {
+    assert(pt_analysis != NULL);
     assert(s_formalname != NULL);
     /* SIMPLE_LONG_SUFFIX -> {+' '}double | COMPLEX_LONG_SUFFIX */
-    switch (_gt_typeanalysis._t_token) {
+    switch (pt_analysis->_t_token) {
         /* SIMPLE_LONG_SUFFIX -> {+' '}double */
         case _TOKEN_KEY_DOUBLE:
             _TOKEN_MATCH_SPACE(s_formalname);
@@ -545,7 +554,7 @@ bool_t _type_parse_simple_long_suffix(char* s_formalname)
         case _TOKEN_END_OF_INPUT:
         case _TOKEN_SIGN_RIGHT_BRACKET:
         case _TOKEN_SIGN_COMMA:
-            return _type_parse_complex_long_suffix(s_formalname);
+            return _type_parse_complex_long_suffix(pt_analysis, s_formalname);
             break;
         default:
             return false;
@@ -553,25 +562,26 @@ bool_t _type_parse_simple_long_suffix(char* s_formalname)
     }
 }
 
-bool_t _type_parse_simple_builtin(char* s_formalname)
+bool_t _type_parse_simple_builtin(_typeanalysis_t* pt_analysis, char* s_formalname)
 {
+    assert(pt_analysis != NULL);
     assert(s_formalname != NULL);
     /* 
      * SIMPLE_BUILTIN -> char POINTER_SUFFIX | short COMMON_SUFFIX | int |
      *                   long SIMPLE_LONG_SUFFIX | float | double | bool_t | _Bool
      */
-    switch (_gt_typeanalysis._t_token) {
+    switch (pt_analysis->_t_token) {
         /* SIMPLE_BUILTIN -> char POINTER_SUFFIX */
         case _TOKEN_KEY_CHAR:
             _TOKEN_MATCH(_TOKEN_TEXT_CHAR, s_formalname);
-            _type_get_token();
-            return _type_parse_pointer_suffix(s_formalname);
+            _type_get_token(pt_analysis);
+            return _type_parse_pointer_suffix(pt_analysis, s_formalname);
             break;
         /* SIMPLE_BUILTIN -> short COMMON_SUFFIX */
         case _TOKEN_KEY_SHORT:
             _TOKEN_MATCH(_TOKEN_TEXT_SHORT, s_formalname);
-            _type_get_token();
-            return _type_parse_common_suffix(s_formalname);
+            _type_get_token(pt_analysis);
+            return _type_parse_common_suffix(pt_analysis, s_formalname);
             break;
         /* SIMPLE_BUILTIN -> int */
         case _TOKEN_KEY_INT:
@@ -581,8 +591,8 @@ bool_t _type_parse_simple_builtin(char* s_formalname)
         /* SIMPLE_BUILTIN -> long SIMPLE_LONG_SUFFIX */
         case _TOKEN_KEY_LONG:
             _TOKEN_MATCH(_TOKEN_TEXT_LONG, s_formalname);
-            _type_get_token();
-            return _type_parse_simple_long_suffix(s_formalname);
+            _type_get_token(pt_analysis);
+            return _type_parse_simple_long_suffix(pt_analysis, s_formalname);
             break;
         /* SIMPLE_BUILTIN -> float */
         case _TOKEN_KEY_FLOAT:
@@ -610,15 +620,16 @@ bool_t _type_parse_simple_builtin(char* s_formalname)
     }
 }
 
-bool_t _type_parse_unsigned_builtin(char* s_formalname)
+bool_t _type_parse_unsigned_builtin(_typeanalysis_t* pt_analysis, char* s_formalname)
 {
+    assert(pt_analysis != NULL);
     assert(s_formalname != NULL);
     /* UNSIGNED_BUILTIN -> unsigned COMPLEX_SUFFIX */
-    switch (_gt_typeanalysis._t_token) {
+    switch (pt_analysis->_t_token) {
         case _TOKEN_KEY_UNSIGNED:
             _TOKEN_MATCH(_TOKEN_TEXT_UNSIGNED, s_formalname);
-            _type_get_token();
-            return _type_parse_complex_suffix(s_formalname);
+            _type_get_token(pt_analysis);
+            return _type_parse_complex_suffix(pt_analysis, s_formalname);
             break;
         default:
             return false;
@@ -626,14 +637,15 @@ bool_t _type_parse_unsigned_builtin(char* s_formalname)
     }
 }
 
-bool_t _type_parse_complex_suffix(char* s_formalname)
+bool_t _type_parse_complex_suffix(_typeanalysis_t* pt_analysis, char* s_formalname)
 {
+    assert(pt_analysis != NULL);
     assert(s_formalname != NULL);
     /* 
      * COMPLEX_SUFFIX -> {+' '}char | {+' '}short COMMON_SUFFIX |
      *                   {+' '}int | {+' '}long COMPLEX_LONG_SUFFIX | $
      */
-    switch (_gt_typeanalysis._t_token) {
+    switch (pt_analysis->_t_token) {
         /* COMPLEX_SUFFIX -> {+' '}char */
         case _TOKEN_KEY_CHAR:
             _TOKEN_MATCH_SPACE(s_formalname);
@@ -644,8 +656,8 @@ bool_t _type_parse_complex_suffix(char* s_formalname)
         case _TOKEN_KEY_SHORT:
             _TOKEN_MATCH_SPACE(s_formalname);
             _TOKEN_MATCH(_TOKEN_TEXT_SHORT, s_formalname);
-            _type_get_token();
-            return _type_parse_common_suffix(s_formalname);
+            _type_get_token(pt_analysis);
+            return _type_parse_common_suffix(pt_analysis, s_formalname);
             break;
         /* COMPLEX_SUFFIX -> {+' '}int */
         case _TOKEN_KEY_INT:
@@ -657,14 +669,14 @@ bool_t _type_parse_complex_suffix(char* s_formalname)
         case _TOKEN_KEY_LONG:
             _TOKEN_MATCH_SPACE(s_formalname);
             _TOKEN_MATCH(_TOKEN_TEXT_LONG, s_formalname);
-            _type_get_token();
-            return _type_parse_complex_long_suffix(s_formalname);
+            _type_get_token(pt_analysis);
+            return _type_parse_complex_long_suffix(pt_analysis, s_formalname);
             break;
         /* COMPLEX_SUFFIX -> $ */
         case _TOKEN_END_OF_INPUT:
         case _TOKEN_SIGN_RIGHT_BRACKET:
         case _TOKEN_SIGN_COMMA:
-            _type_token_rollback();
+            _type_token_rollback(pt_analysis);
             return true;
             break;
         default:
@@ -673,15 +685,16 @@ bool_t _type_parse_complex_suffix(char* s_formalname)
     }
 }
 
-bool_t _type_parse_signed_builtin(char* s_formalname)
+bool_t _type_parse_signed_builtin(_typeanalysis_t* pt_analysis, char* s_formalname)
 {
+    assert(pt_analysis != NULL);
     assert(s_formalname != NULL);
     /* SIGNED_BUILTIN -> signed COMPLEX_SUFFIX */
-    switch (_gt_typeanalysis._t_token) {
+    switch (pt_analysis->_t_token) {
         case _TOKEN_KEY_SIGNED:
             _TOKEN_MATCH(_TOKEN_TEXT_SIGNED, s_formalname);
-            _type_get_token();
-            return _type_parse_complex_suffix(s_formalname);
+            _type_get_token(pt_analysis);
+            return _type_parse_complex_suffix(pt_analysis, s_formalname);
             break;
         default:
             return false;
@@ -689,11 +702,12 @@ bool_t _type_parse_signed_builtin(char* s_formalname)
     }
 }
 
-bool_t _type_parse_user_define_type(char* s_formalname)
+bool_t _type_parse_user_define_type(_typeanalysis_t* pt_analysis, char* s_formalname)
 {
+    assert(pt_analysis != NULL);
     assert(s_formalname != NULL);
     /* USER_DEFINE_TYPE -> struct | enum | union */
-    switch (_gt_typeanalysis._t_token) {
+    switch (pt_analysis->_t_token) {
         case _TOKEN_KEY_STRUCT:
             _TOKEN_MATCH(_TOKEN_TEXT_STRUCT, s_formalname);
             return true;
@@ -712,19 +726,20 @@ bool_t _type_parse_user_define_type(char* s_formalname)
     }
 }
 
-bool_t _type_parse_user_define(char* s_formalname)
+bool_t _type_parse_user_define(_typeanalysis_t* pt_analysis, char* s_formalname)
 {
+    assert(pt_analysis != NULL);
     assert(s_formalname != NULL);
     /* USER_DEFINE -> USER_DEFINE_TYPE {+' '}identifier | identifier */
-    switch (_gt_typeanalysis._t_token) {
+    switch (pt_analysis->_t_token) {
         /* USER_DEFINE -> USER_DEFINE_TYPE {+' '}identifier */
         case _TOKEN_KEY_STRUCT:
         case _TOKEN_KEY_ENUM:
         case _TOKEN_KEY_UNION:
-            if (_type_parse_user_define_type(s_formalname)) {
+            if (_type_parse_user_define_type(pt_analysis, s_formalname)) {
                 _TOKEN_MATCH_SPACE(s_formalname);
-                _type_get_token();
-                if (_gt_typeanalysis._t_token != _TOKEN_IDENTIFIER) {
+                _type_get_token(pt_analysis);
+                if (pt_analysis->_t_token != _TOKEN_IDENTIFIER) {
                     return false;
                 } else {
                     _TOKEN_MATCH_IDENTIFIER(s_formalname);
@@ -745,15 +760,16 @@ bool_t _type_parse_user_define(char* s_formalname)
     }
 }
 
-bool_t _type_parse_sequence_name(char* s_formalname)
+bool_t _type_parse_sequence_name(_typeanalysis_t* pt_analysis, char* s_formalname)
 {
+    assert(pt_analysis != NULL);
     assert(s_formalname != NULL);
     /* 
      * SEQUENCE_NAME -> vector_t | list_t | slist_t | deque_t | stack_t | 
      *                  queue_t | priority_queue_t | set_t | multiset_t |
      *                  hash_set_t | hash_multiset_t | basic_string_t
      */
-    switch (_gt_typeanalysis._t_token) {
+    switch (pt_analysis->_t_token) {
         case _TOKEN_KEY_VECTOR:
             _TOKEN_MATCH(_TOKEN_TEXT_VECTOR, s_formalname);
             return true;
@@ -808,25 +824,26 @@ bool_t _type_parse_sequence_name(char* s_formalname)
     }
 }
 
-bool_t _type_parse_sequence(char* s_formalname)
+bool_t _type_parse_sequence(_typeanalysis_t* pt_analysis, char* s_formalname)
 {
+    assert(pt_analysis != NULL);
     assert(s_formalname != NULL);
     /* SEQUENCE -> SEQUENCE_NAME < TYPE_DESCRIPT > */
-    if (_type_parse_sequence_name(s_formalname)) {
+    if (_type_parse_sequence_name(pt_analysis, s_formalname)) {
         /* < */
-        _type_get_token();
-        if (_gt_typeanalysis._t_token != _TOKEN_SIGN_LEFT_BRACKET) {
+        _type_get_token(pt_analysis);
+        if (pt_analysis->_t_token != _TOKEN_SIGN_LEFT_BRACKET) {
             return false;
         }
         _TOKEN_MATCH(_TOKEN_TEXT_LEFT_BRACKET, s_formalname);
         /* TYPE_DESCRIPT */
-        _type_get_token();
-        if (!_type_parse_type_descript(s_formalname)) {
+        _type_get_token(pt_analysis);
+        if (!_type_parse_type_descript(pt_analysis, s_formalname)) {
             return false;
         }
         /* > */
-        _type_get_token();
-        if (_gt_typeanalysis._t_token != _TOKEN_SIGN_RIGHT_BRACKET) {
+        _type_get_token(pt_analysis);
+        if (pt_analysis->_t_token != _TOKEN_SIGN_RIGHT_BRACKET) {
             return false;
         }
         _TOKEN_MATCH(_TOKEN_TEXT_RIGHT_BRACKET, s_formalname);
@@ -836,13 +853,14 @@ bool_t _type_parse_sequence(char* s_formalname)
     }
 }
 
-bool_t _type_parse_relation_name(char* s_formalname)
+bool_t _type_parse_relation_name(_typeanalysis_t* pt_analysis, char* s_formalname)
 {
+    assert(pt_analysis != NULL);
     assert(s_formalname != NULL);
     /*
      * RELATION_NAME -> map_t | multimap_t | hash_map_t | hash_multimap_t | pair_t
      */
-    switch (_gt_typeanalysis._t_token) {
+    switch (pt_analysis->_t_token) {
         case _TOKEN_KEY_MAP:
             _TOKEN_MATCH(_TOKEN_TEXT_MAP, s_formalname);
             return true;
@@ -869,8 +887,9 @@ bool_t _type_parse_relation_name(char* s_formalname)
     }
 }
 
-bool_t _type_parse_iterator(char* s_formalname)
+bool_t _type_parse_iterator(_typeanalysis_t* pt_analysis, char* s_formalname)
 {
+    assert(pt_analysis != NULL);
     assert(s_formalname != NULL);
     /*
      * ITERATOR -> iterator_t | vector_iterator_t | list_iterator_t | slist_iterator_t |
@@ -880,7 +899,7 @@ bool_t _type_parse_iterator(char* s_formalname)
      *             string_iterator_t | input_iterator_t | output_iterator_t | forward_iterator_t |
      *             bidirectional_iterator_t | random_access_iterator_t | basic_string_iterator_t
      */
-    switch (_gt_typeanalysis._t_token) {
+    switch (pt_analysis->_t_token) {
         case _TOKEN_KEY_ITERATOR:
             _TOKEN_MATCH(_TOKEN_TEXT_ITERATOR, s_formalname);
             return true;
@@ -967,36 +986,37 @@ bool_t _type_parse_iterator(char* s_formalname)
     }
 }
 
-bool_t _type_parse_relation(char* s_formalname)
+bool_t _type_parse_relation(_typeanalysis_t* pt_analysis, char* s_formalname)
 {
+    assert(pt_analysis != NULL);
     assert(s_formalname != NULL);
     /* RELATION -> RELATION_NAME < TYPE_DESCRIPT, TYPE_DESCRIPT > */
-    if (_type_parse_relation_name(s_formalname)) {
+    if (_type_parse_relation_name(pt_analysis, s_formalname)) {
         /* < */
-        _type_get_token();
-        if (_gt_typeanalysis._t_token != _TOKEN_SIGN_LEFT_BRACKET) {
+        _type_get_token(pt_analysis);
+        if (pt_analysis->_t_token != _TOKEN_SIGN_LEFT_BRACKET) {
             return false;
         }
         _TOKEN_MATCH(_TOKEN_TEXT_LEFT_BRACKET, s_formalname);
         /* TYPE_DESCRIPT */
-        _type_get_token();
-        if (!_type_parse_type_descript(s_formalname)) {
+        _type_get_token(pt_analysis);
+        if (!_type_parse_type_descript(pt_analysis, s_formalname)) {
             return false;
         }
         /* , */
-        _type_get_token();
-        if (_gt_typeanalysis._t_token != _TOKEN_SIGN_COMMA) {
+        _type_get_token(pt_analysis);
+        if (pt_analysis->_t_token != _TOKEN_SIGN_COMMA) {
             return false;
         }
         _TOKEN_MATCH(_TOKEN_TEXT_COMMA, s_formalname);
         /* TYPE_DESCRIPT */
-        _type_get_token();
-        if (!_type_parse_type_descript(s_formalname)) {
+        _type_get_token(pt_analysis);
+        if (!_type_parse_type_descript(pt_analysis, s_formalname)) {
             return false;
         }
         /* > */
-        _type_get_token();
-        if (_gt_typeanalysis._t_token != _TOKEN_SIGN_RIGHT_BRACKET) {
+        _type_get_token(pt_analysis);
+        if (pt_analysis->_t_token != _TOKEN_SIGN_RIGHT_BRACKET) {
             return false;
         }
         _TOKEN_MATCH(_TOKEN_TEXT_RIGHT_BRACKET, s_formalname);
@@ -1006,11 +1026,12 @@ bool_t _type_parse_relation(char* s_formalname)
     }
 }
 
-bool_t _type_parse_cstl_builtin(char* s_formalname)
+bool_t _type_parse_cstl_builtin(_typeanalysis_t* pt_analysis, char* s_formalname)
 {
+    assert(pt_analysis != NULL);
     assert(s_formalname != NULL);
     /* CSTL_BUILTIN -> SEQUENCE | RELATION | string_t | range_t | ITERATOR */
-    switch (_gt_typeanalysis._t_token) {
+    switch (pt_analysis->_t_token) {
         /* CSTL_BUILTIN -> SEQUENCE */
         case _TOKEN_KEY_VECTOR:
         case _TOKEN_KEY_LIST:
@@ -1024,7 +1045,7 @@ bool_t _type_parse_cstl_builtin(char* s_formalname)
         case _TOKEN_KEY_HASH_SET:
         case _TOKEN_KEY_HASH_MULTISET:
         case _TOKEN_KEY_BASIC_STRING:
-            return _type_parse_sequence(s_formalname);
+            return _type_parse_sequence(pt_analysis, s_formalname);
             break;
         /* CSTL_BUILTIN -> RELATION */
         case _TOKEN_KEY_MAP:
@@ -1032,7 +1053,7 @@ bool_t _type_parse_cstl_builtin(char* s_formalname)
         case _TOKEN_KEY_HASH_MAP:
         case _TOKEN_KEY_HASH_MULTIMAP:
         case _TOKEN_KEY_PAIR:
-            return _type_parse_relation(s_formalname);
+            return _type_parse_relation(pt_analysis, s_formalname);
             break;
         /* CSTL_BUILTIN -> string_t */
         case _TOKEN_KEY_STRING:
@@ -1065,7 +1086,7 @@ bool_t _type_parse_cstl_builtin(char* s_formalname)
         case _TOKEN_KEY_BIDIRECTIONAL_ITERATOR:
         case _TOKEN_KEY_RANDOM_ACCESS_ITERATOR:
         case _TOKEN_KEY_BASIC_STRING_ITERATOR:
-            return _type_parse_iterator(s_formalname);
+            return _type_parse_iterator(pt_analysis, s_formalname);
             break;
         default:
             return false;
@@ -1073,15 +1094,16 @@ bool_t _type_parse_cstl_builtin(char* s_formalname)
     }
 }
 
-bool_t _type_parse_type_descript(char* s_formalname)
+bool_t _type_parse_type_descript(_typeanalysis_t* pt_analysis, char* s_formalname)
 {
     char   s_userdefine[_TYPE_NAME_SIZE + 1];
 
     memset(s_userdefine, '\0', _TYPE_NAME_SIZE+1);
 
+    assert(pt_analysis != NULL);
     assert(s_formalname != NULL);
     /* TYPE_DESCRIPT -> C_BUILTIN | USER_DEFINE | CSTL_BUILTIN */
-    switch (_gt_typeanalysis._t_token) {
+    switch (pt_analysis->_t_token) {
         /* TYPE_DESCRIPT -> C_BUILTIN */
         case _TOKEN_KEY_CHAR:
         case _TOKEN_KEY_SHORT:
@@ -1094,14 +1116,14 @@ bool_t _type_parse_type_descript(char* s_formalname)
         case _TOKEN_KEY_VOID:
         case _TOKEN_KEY_CSTL_BOOL:
         case _TOKEN_KEY_BOOL:
-            return _type_parse_c_builtin(s_formalname);
+            return _type_parse_c_builtin(pt_analysis, s_formalname);
             break;
         /* TYPE_DESCRIPT -> USER_DEFINE */
         case _TOKEN_KEY_STRUCT:
         case _TOKEN_KEY_ENUM:
         case _TOKEN_KEY_UNION:
         case _TOKEN_IDENTIFIER:
-            if (_type_parse_user_define(s_userdefine)) {
+            if (_type_parse_user_define(pt_analysis, s_userdefine)) {
                 strncat(s_formalname, s_userdefine, _TYPE_NAME_SIZE);
                 return _type_is_registered(s_userdefine) != NULL ? true : false;
             } else {
@@ -1148,7 +1170,7 @@ bool_t _type_parse_type_descript(char* s_formalname)
         case _TOKEN_KEY_BIDIRECTIONAL_ITERATOR:
         case _TOKEN_KEY_RANDOM_ACCESS_ITERATOR:
         case _TOKEN_KEY_BASIC_STRING_ITERATOR:
-            return _type_parse_cstl_builtin(s_formalname);
+            return _type_parse_cstl_builtin(pt_analysis, s_formalname);
             break;
         default:
             return false;
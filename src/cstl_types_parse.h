@@ -73,6 +73,9 @@ typedef enum _tagtypetoken
     _TOKEN_ROLLBACK
 }_typetoken_t;
 
+/**
+ * the state of one parsing, each call of _type_get_style() has its own state.
+ */
 typedef struct _tagtypeanalysis
 {
     char         _s_typename[_TYPE_NAME_SIZE + 1];
@@ -82,7 +85,6 @@ typedef struct _tagtypeanalysis
 }_typeanalysis_t;
 
 /** exported global variable declaration section **/
-extern _typeanalysis_t _gt_typeanalysis;
 
 /** exported function prototype section **/
 /* the functions blow is used for analyse the type style */
@@ -96,39 +98,44 @@ extern _typeanalysis_t _gt_typeanalysis;
 extern _typestyle_t _type_get_style(const char* s_typename, char* s_formalname);
 /**
  * Get the next toke from input string.
+ * @param pt_analysis  parser state.
  * @return void.
+ * @remarks pt_analysis must be not NULL.
  */
-extern void _type_get_token(void);
+extern void _type_get_token(_typeanalysis_t* pt_analysis);
 /**
  * Rollback current token to input string.
+ * @param pt_analysis  parser state.
  * @return void.
+ * @remarks pt_analysis must be not NULL.
  */
-extern void _type_token_rollback(void);
+extern void _type_token_rollback(_typeanalysis_t* pt_analysis);
 /**
  * Parse specific token, and get formal name.
+ * @param pt_analysis  parser state.
  * @param s_formalname formal name.
  * @return bool_t.
- * @remarks s_formalname must be not NULL.
+ * @remarks pt_analysis and s_formalname must be not NULL.
  */
-extern bool_t _type_parse_c_builtin(char* s_formalname);
-extern bool_t _type_parse_pointer_builtin(char* s_formalname);
-extern bool_t _type_parse_pointer_suffix(char* s_formalname);
-extern bool_t _type_parse_complex_long_suffix(char* s_formalname);
-extern bool_t _type_parse_common_suffix(char* s_formalname);
-extern bool_t _type_parse_simple_long_suffix(char* s_formalname);
-extern bool_t _type_parse_simple_builtin(char* s_formalname);
-extern bool_t _type_parse_unsigned_builtin(char* s_formalname);
-extern bool_t _type_parse_complex_suffix(char* s_formalname);
-extern bool_t _type_parse_signed_builtin(char* s_formalname);
-extern bool_t _type_parse_user_define_type(char* s_formalname);
-extern bool_t _type_parse_user_define(char* s_formalname);
-extern bool_t _type_parse_sequence_name(char* s_formalname);
-extern bool_t _type_parse_sequence(char* s_formalname);
-extern bool_t _type_parse_relation_name(char* s_formalname);
-extern bool_t _type_parse_iterator(char* s_formalname);
-extern bool_t _type_parse_relation(char* s_formalname);
-extern bool_t _type_parse_cstl_builtin(char* s_formalname);
-extern bool_t _type_parse_type_descript(char* s_formalname);
+extern bool_t _type_parse_c_builtin(_typeanalysis_t* pt_analysis, char* s_formalname);
+extern bool_t _type_parse_pointer_builtin(_typeanalysis_t* pt_analysis, char* s_formalname);
+extern bool_t _type_parse_pointer_suffix(_typeanalysis_t* pt_analysis, char* s_formalname);
+extern bool_t _type_parse_complex_long_suffix(_typeanalysis_t* pt_analysis, char* s_formalname);
+extern bool_t _type_parse_common_suffix(_typeanalysis_t* pt_analysis, char* s_formalname);
+extern bool_t _type_parse_simple_long_suffix(_typeanalysis_t* pt_analysis, char* s_formalname);
+extern bool_t _type_parse_simple_builtin(_typeanalysis_t* pt_analysis, char* s_formalname);
+extern bool_t _type_parse_unsigned_builtin(_typeanalysis_t* pt_analysis, char* s_formalname);
+extern bool_t _type_parse_complex_suffix(_typeanalysis_t* pt_analysis, char* s_formalname);
+extern bool_t _type_parse_signed_builtin(_typeanalysis_t* pt_analysis, char* s_formalname);
+extern bool_t _type_parse_user_define_type(_typeanalysis_t* pt_analysis, char* s_formalname);
+extern bool_t _type_parse_user_define(_typeanalysis_t* pt_analysis, char* s_formalname);
+extern bool_t _type_parse_sequence_name(_typeanalysis_t* pt_analysis, char* s_formalname);
+extern bool_t _type_parse_sequence(_typeanalysis_t* pt_analysis, char* s_formalname);
+extern bool_t _type_parse_relation_name(_typeanalysis_t* pt_analysis, char* s_formalname);
+extern bool_t _type_parse_iterator(_typeanalysis_t* pt_analysis, char* s_formalname);
+extern bool_t _type_parse_relation(_typeanalysis_t* pt_analysis, char* s_formalname);
+extern bool_t _type_parse_cstl_builtin(_typeanalysis_t* pt_analysis, char* s_formalname);
+extern bool_t _type_parse_type_descript(_typeanalysis_t* pt_analysis, char* s_formalname);
 
 #ifdef __cplusplus
 }
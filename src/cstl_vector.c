@@ -35,6 +35,14 @@
 /** local data type declaration and local struct, union, enum section **/
 
 /** local function prototype section **/
+/**
+ * Move the elements into new memory with specific capacity.
+ * @param pvec_vector   vector container.
+ * @param t_capacity    new capacity.
+ * @return void.
+ * @remarks t_capacity must not be less than the size of vector.
+ */
+static void _vector_reallocate(vector_t* pvec_vector, size_t t_capacity);
 
 /** exported global variable definition section **/
 
@@ -107,6 +115,14 @@ void vector_init_copy_range(vector_t* pvec_dest, iterator_t it_begin, iterator_t
     /* initialize all elements with default value */
     vector_init_n(pvec_dest, iterator_distance(it_begin, it_end));
 
+    /* the range of other vector is continuous memory */
+    if (_ITERATOR_CONTAINER_TYPE(it_begin) == _VECTOR_CONTAINER && _type_is_trivially_copyable(&pvec_dest->_t_typeinfo)) {
+        if (!iterator_equal(it_begin, it_end)) {
+            memcpy(pvec_dest->_pby_start, _VECTOR_ITERATOR_COREPOS(it_begin), pvec_dest->_pby_finish - pvec_dest->_pby_start);
+        }
+        return;
+    }
+
     /* copy values for range */
     it_dest_begin = vector_begin(pvec_dest);
     it_dest_end = vector_end(pvec_dest);
@@ -148,7 +164,7 @@ void vector_init_copy_array(vector_t* pvec_dest, const void* cpv_array, size_t t
      * the elements of c builtin array are element itself, but the elements of 
      * c string, user define or cstl are pointer of element.
      */
-    if (strncmp(_GET_VECTOR_TYPE_BASENAME(pvec_dest), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_VECTOR_TYPE_ID(pvec_dest) == _TYPE_ID_C_STRING) {
         /*
          * We need built a string_t for c string element.
          */
@@ -235,6 +251,20 @@ size_t vector_max_size(const vector_t* cpvec_vector)
     return (size_t)(-1) / _GET_VECTOR_TYPE_SIZE(cpvec_vector);
 }
 
+/**
+ * Get the memory that is held by the vector.
+ */
+size_t vector_memory_usage(const vector_t* cpvec_vector)
+{
+    _allocstat_t t_stat;
+
+    assert(cpvec_vector != NULL);
+    assert(_vector_is_inited(cpvec_vector));
+
+    _alloc_get_stat(&cpvec_vector->_t_allocator, &t_stat);
+    return sizeof(vector_t) + t_stat._t_livesize + t_stat._t_cachedsize;
+}
+
 /**
  * Get vector capacity.
  */
@@ -251,57 +281,24 @@ size_t vector_capacity(const vector_t* cpvec_vector)
  */
 void vector_reserve(vector_t* pvec_vector, size_t t_reservesize)
 {
-    _byte_t* pby_reservemem = NULL; /* new memory for reserve */
-    _byte_t* pby_newstart = NULL;
-    _byte_t* pby_newfinish = NULL;
-    _byte_t* pby_newendofstorage = NULL;
-    _byte_t* pby_newpos = NULL;
-    _byte_t* pby_oldpos = NULL;
-    size_t   t_oldsize = 0;
-    size_t   t_oldcapacity = 0;
-    bool_t   b_result = false;
-
     assert(pvec_vector != NULL);
     assert(_vector_is_inited(pvec_vector));
 
     if (vector_capacity(pvec_vector) < t_reservesize) {
-        /* allocate the new vector with reserve size */
-        pby_reservemem = _alloc_allocate(&pvec_vector->_t_allocator, _GET_VECTOR_TYPE_SIZE(pvec_vector), t_reservesize);
-        assert(pby_reservemem != NULL);
-        /* get the new position */
-        t_oldsize = pvec_vector->_pby_finish - pvec_vector->_pby_start;
-        t_oldcapacity = pvec_vector->_pby_endofstorage - pvec_vector->_pby_start;
-        pby_newstart = pby_reservemem;
-        pby_newfinish = pby_reservemem + t_oldsize;
-        pby_newendofstorage = pby_reservemem + _GET_VECTOR_TYPE_SIZE(pvec_vector) * t_reservesize;
-
-        /* initialize new elements */
-        _vector_init_elem_range_auxiliary(pvec_vector, pby_newstart, pby_newfinish);
+        _vector_reallocate(pvec_vector, t_reservesize);
+    }
+}
 
-        /* copy elements from old memory and destroy those */
-        for (pby_newpos = pby_newstart, pby_oldpos = pvec_vector->_pby_start;
-             pby_newpos < pby_newfinish && pby_oldpos < pvec_vector->_pby_finish;
-             pby_newpos += _GET_VECTOR_TYPE_SIZE(pvec_vector),
-             pby_oldpos += _GET_VECTOR_TYPE_SIZE(pvec_vector)) {
-            /* copy from old vector_t memory */
-            b_result = _GET_VECTOR_TYPE_SIZE(pvec_vector);
-            _GET_VECTOR_TYPE_COPY_FUNCTION(pvec_vector)(pby_newpos, pby_oldpos, &b_result);
-            assert(b_result);
-            /* destroy old vector_t memory */
-            b_result = _GET_VECTOR_TYPE_SIZE(pvec_vector);
-            _GET_VECTOR_TYPE_DESTROY_FUNCTION(pvec_vector)(pby_oldpos, &b_result);
-            assert(b_result);
-        }
-        assert(pby_newpos == pby_newfinish && pby_oldpos == pvec_vector->_pby_finish);
+/**
+ * Reduce vector capacity to vector size.
+ */
+void vector_shrink_to_fit(vector_t* pvec_vector)
+{
+    assert(pvec_vector != NULL);
+    assert(_vector_is_inited(pvec_vector));
 
-        /* free the old vector element */
-        if (pvec_vector->_pby_start != NULL) {
-            _alloc_deallocate(&pvec_vector->_t_allocator, pvec_vector->_pby_start,
-                _GET_VECTOR_TYPE_SIZE(pvec_vector), t_oldcapacity / _GET_VECTOR_TYPE_SIZE(pvec_vector));
-        }
-        pvec_vector->_pby_start = pby_newstart;
-        pvec_vector->_pby_finish = pby_newfinish;
-        pvec_vector->_pby_endofstorage = pby_newendofstorage;
+    if (vector_size(pvec_vector) < vector_capacity(pvec_vector)) {
+        _vector_reallocate(pvec_vector, vector_size(pvec_vector));
     }
 }
 
@@ -474,6 +471,13 @@ void vector_assign_range(vector_t* pvec_vector, iterator_t it_begin, iterator_t
 
     /* copy value from range [it_begin, it_end) for each element */
     vector_resize(pvec_vector, iterator_distance(it_begin, it_end));
+    if (_ITERATOR_CONTAINER_TYPE(it_begin) == _VECTOR_CONTAINER && _type_is_trivially_copyable(&pvec_vector->_t_typeinfo)) {
+        /* the range may be in the same vector */
+        if (!iterator_equal(it_begin, it_end)) {
+            memmove(pvec_vector->_pby_start, _VECTOR_ITERATOR_COREPOS(it_begin), pvec_vector->_pby_finish - pvec_vector->_pby_start);
+        }
+        return;
+    }
     it_dest_begin = vector_begin(pvec_vector);
     it_dest_end = vector_end(pvec_vector);
     for (it_dest = it_dest_begin, it_src = it_begin;
@@ -515,7 +519,7 @@ void vector_assign_array(vector_t* pvec_vector, const void* cpv_array, size_t t_
      * the elements of c builtin array are element itself, but the elements of 
      * c string, user define or cstl are pointer of element.
      */
-    if (strncmp(_GET_VECTOR_TYPE_BASENAME(pvec_vector), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_VECTOR_TYPE_ID(pvec_vector) == _TYPE_ID_C_STRING) {
         /*
          * We need built a string_t for c string element.
          */
@@ -717,17 +721,29 @@ void vector_insert_range(vector_t* pvec_vector, vector_iterator_t it_pos, iterat
         _vector_init_elem_range_auxiliary(pvec_vector, pby_oldfinish, pvec_vector->_pby_finish);
 
         /* move element from old finish to new finish */
-        for (pby_pos = pby_oldfinish - _GET_VECTOR_TYPE_SIZE(pvec_vector),
-             pby_destpos = pvec_vector->_pby_finish - _GET_VECTOR_TYPE_SIZE(pvec_vector);
-             pby_pos >= _VECTOR_ITERATOR_COREPOS(it_pos);
-             pby_pos -= _GET_VECTOR_TYPE_SIZE(pvec_vector),
-             pby_destpos -= _GET_VECTOR_TYPE_SIZE(pvec_vector)) {
-            b_result = _GET_VECTOR_TYPE_SIZE(pvec_vector);
-            _GET_VECTOR_TYPE_COPY_FUNCTION(pvec_vector)(pby_destpos, pby_pos, &b_result);
-            assert(b_result);
+        if (_type_is_trivially_copyable(&pvec_vector->_t_typeinfo)) {
+            memmove(_VECTOR_ITERATOR_COREPOS(it_pos) + t_count * _GET_VECTOR_TYPE_SIZE(pvec_vector),
+                _VECTOR_ITERATOR_COREPOS(it_pos), pby_oldfinish - _VECTOR_ITERATOR_COREPOS(it_pos));
+        } else {
+            for (pby_pos = pby_oldfinish - _GET_VECTOR_TYPE_SIZE(pvec_vector),
+                 pby_destpos = pvec_vector->_pby_finish - _GET_VECTOR_TYPE_SIZE(pvec_vector);
+                 pby_pos >= _VECTOR_ITERATOR_COREPOS(it_pos);
+                 pby_pos -= _GET_VECTOR_TYPE_SIZE(pvec_vector),
+                 pby_destpos -= _GET_VECTOR_TYPE_SIZE(pvec_vector)) {
+                b_result = _GET_VECTOR_TYPE_SIZE(pvec_vector);
+                _GET_VECTOR_TYPE_COPY_FUNCTION(pvec_vector)(pby_destpos, pby_pos, &b_result);
+                assert(b_result);
+            }
         }
 
         /* insert element counts copys to the pos */
+        if (_ITERATOR_CONTAINER_TYPE(it_begin) == _VECTOR_CONTAINER &&
+            _type_is_trivially_copyable(&pvec_vector->_t_typeinfo) &&
+            _VECTOR_ITERATOR_CONTAINER(it_begin) != pvec_vector) {
+            memcpy(_VECTOR_ITERATOR_COREPOS(it_pos), _VECTOR_ITERATOR_COREPOS(it_begin),
+                t_count * _GET_VECTOR_TYPE_SIZE(pvec_vector));
+            return;
+        }
         for (it_first = it_pos, it_second = it_begin;
              !iterator_equal(it_second, it_end);
              it_first = iterator_next(it_first), it_second = iterator_next(it_second)) {
@@ -791,7 +807,7 @@ void vector_insert_array(vector_t* pvec_vector, vector_iterator_t it_pos, const
          * the elements of c builtin array are element itself, but the elements of 
          * c string, user define or cstl are pointer of element.
          */
-        if (strncmp(_GET_VECTOR_TYPE_BASENAME(pvec_vector), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+        if (_GET_VECTOR_TYPE_ID(pvec_vector) == _TYPE_ID_C_STRING) {
             /*
              * We need built a string_t for c string element.
              */
@@ -881,18 +897,27 @@ vector_iterator_t vector_erase_range(vector_t* pvec_vector, vector_iterator_t it
     it_vec_end = vector_end(pvec_vector);
     t_erasesize = iterator_distance(it_begin, it_end);
 
-    for (; !iterator_equal(it_end, it_vec_end); it_begin = iterator_next(it_begin), it_end = iterator_next(it_end)) {
-        b_result = _GET_VECTOR_TYPE_SIZE(pvec_vector);
-        _GET_VECTOR_TYPE_COPY_FUNCTION(pvec_vector)(_VECTOR_ITERATOR_COREPOS(it_begin), _VECTOR_ITERATOR_COREPOS(it_end), &b_result);
-        assert(b_result);
+    if (_type_is_trivially_copyable(&pvec_vector->_t_typeinfo)) {
+        memmove(_VECTOR_ITERATOR_COREPOS(it_begin), _VECTOR_ITERATOR_COREPOS(it_end),
+            _VECTOR_ITERATOR_COREPOS(it_vec_end) - _VECTOR_ITERATOR_COREPOS(it_end));
+        _VECTOR_ITERATOR_COREPOS(it_begin) = pvec_vector->_pby_finish - t_erasesize * _GET_VECTOR_TYPE_SIZE(pvec_vector);
+        it_end = it_vec_end;
+    } else {
+        for (; !iterator_equal(it_end, it_vec_end); it_begin = iterator_next(it_begin), it_end = iterator_next(it_end)) {
+            b_result = _GET_VECTOR_TYPE_SIZE(pvec_vector);
+            _GET_VECTOR_TYPE_COPY_FUNCTION(pvec_vector)(_VECTOR_ITERATOR_COREPOS(it_begin), _VECTOR_ITERATOR_COREPOS(it_end), &b_result);
+            assert(b_result);
+        }
     }
     assert(_VECTOR_ITERATOR_COREPOS(it_begin) == pvec_vector->_pby_finish - t_erasesize * _GET_VECTOR_TYPE_SIZE(pvec_vector));
 
     /* destroy the deleted elements */
-    for (; !iterator_equal(it_begin, it_end); it_begin = iterator_next(it_begin)) {
-        b_result = _GET_VECTOR_TYPE_SIZE(pvec_vector);
-        _GET_VECTOR_TYPE_DESTROY_FUNCTION(pvec_vector)(_VECTOR_ITERATOR_COREPOS(it_begin), &b_result);
-        assert(b_result);
+    if (!_type_is_trivially_destructible(&pvec_vector->_t_typeinfo)) {
+        for (; !iterator_equal(it_begin, it_end); it_begin = iterator_next(it_begin)) {
+            b_result = _GET_VECTOR_TYPE_SIZE(pvec_vector);
+            _GET_VECTOR_TYPE_DESTROY_FUNCTION(pvec_vector)(_VECTOR_ITERATOR_COREPOS(it_begin), &b_result);
+            assert(b_result);
+        }
     }
     pvec_vector->_pby_finish -= t_erasesize * _GET_VECTOR_TYPE_SIZE(pvec_vector);
 
@@ -941,7 +966,95 @@ void vector_clear(vector_t* pvec_vector)
     vector_erase_range(pvec_vector, vector_begin(pvec_vector), vector_end(pvec_vector));
 }
 
+/**
+ * Add element that is pointed by pointer at the end of vector container.
+ */
+void vector_push_back_ptr(vector_t* pvec_vector, const void* cpv_value)
+{
+    _byte_t* pby_last = NULL;
+
+    assert(pvec_vector != NULL);
+    assert(_vector_is_inited(pvec_vector));
+    assert(cpv_value != NULL);
+
+    /* if the remain capacity is less then the element count */
+    if (vector_capacity(pvec_vector) == vector_size(pvec_vector)) {
+        vector_reserve(pvec_vector, _vector_calculate_new_capacity(vector_size(pvec_vector), 1));
+    }
+
+    pby_last = pvec_vector->_pby_finish;
+    assert(pby_last != NULL);
+    pvec_vector->_pby_finish += _GET_VECTOR_TYPE_SIZE(pvec_vector);
+    /* the trivially copyable element is overwritten entirely, so it need not be initialized */
+    if (!_type_is_trivially_copyable(&pvec_vector->_t_typeinfo)) {
+        _vector_init_elem_auxiliary(pvec_vector, pby_last);
+    }
+    _type_get_ptr_value(&pvec_vector->_t_typeinfo, cpv_value, pby_last);
+}
+
 /** local function implementation section **/
+/**
+ * Move the elements into new memory with specific capacity.
+ */
+static void _vector_reallocate(vector_t* pvec_vector, size_t t_capacity)
+{
+    _byte_t* pby_newstart = NULL;
+    _byte_t* pby_newfinish = NULL;
+    _byte_t* pby_newpos = NULL;
+    _byte_t* pby_oldpos = NULL;
+    size_t   t_oldsize = 0;
+    size_t   t_oldcapacity = 0;
+    bool_t   b_result = false;
+
+    assert(pvec_vector != NULL);
+    assert(vector_size(pvec_vector) <= t_capacity);
+
+    /* allocate the new memory, the empty vector with zero capacity has no memory */
+    if (t_capacity > 0) {
+        pby_newstart = _alloc_allocate(&pvec_vector->_t_allocator, _GET_VECTOR_TYPE_SIZE(pvec_vector), t_capacity);
+        assert(pby_newstart != NULL);
+    }
+    /* get the new position */
+    t_oldsize = pvec_vector->_pby_finish - pvec_vector->_pby_start;
+    t_oldcapacity = pvec_vector->_pby_endofstorage - pvec_vector->_pby_start;
+    pby_newfinish = pby_newstart + t_oldsize;
+
+    if (_type_is_relocatable(&pvec_vector->_t_typeinfo)) {
+        /* move the elements into new memory without copying the resources that they own */
+        if (t_oldsize > 0) {
+            _type_relocate(&pvec_vector->_t_typeinfo, pby_newstart, pvec_vector->_pby_start,
+                t_oldsize / _GET_VECTOR_TYPE_SIZE(pvec_vector));
+        }
+    } else {
+        /* initialize new elements */
+        _vector_init_elem_range_auxiliary(pvec_vector, pby_newstart, pby_newfinish);
+
+        /* copy elements from old memory and destroy those */
+        for (pby_newpos = pby_newstart, pby_oldpos = pvec_vector->_pby_start;
+             pby_newpos < pby_newfinish && pby_oldpos < pvec_vector->_pby_finish;
+             pby_newpos += _GET_VECTOR_TYPE_SIZE(pvec_vector),
+             pby_oldpos += _GET_VECTOR_TYPE_SIZE(pvec_vector)) {
+            /* copy from old vector_t memory */
+            b_result = _GET_VECTOR_TYPE_SIZE(pvec_vector);
+            _GET_VECTOR_TYPE_COPY_FUNCTION(pvec_vector)(pby_newpos, pby_oldpos, &b_result);
+            assert(b_result);
+            /* destroy old vector_t memory */
+            b_result = _GET_VECTOR_TYPE_SIZE(pvec_vector);
+            _GET_VECTOR_TYPE_DESTROY_FUNCTION(pvec_vector)(pby_oldpos, &b_result);
+            assert(b_result);
+        }
+        assert(pby_newpos == pby_newfinish && pby_oldpos == pvec_vector->_pby_finish);
+    }
+
+    /* free the old vector element */
+    if (pvec_vector->_pby_start != NULL) {
+        _alloc_deallocate(&pvec_vector->_t_allocator, pvec_vector->_pby_start,
+            _GET_VECTOR_TYPE_SIZE(pvec_vector), t_oldcapacity / _GET_VECTOR_TYPE_SIZE(pvec_vector));
+    }
+    pvec_vector->_pby_start = pby_newstart;
+    pvec_vector->_pby_finish = pby_newfinish;
+    pvec_vector->_pby_endofstorage = pby_newstart + _GET_VECTOR_TYPE_SIZE(pvec_vector) * t_capacity;
+}
 
 /** eof **/
 
@@ -174,7 +174,9 @@ void _vector_init_elem_range_auxiliary(vector_t* pvec_vector, _byte_t* pby_start
     assert(_vector_is_inited(pvec_vector) || _vector_is_created(pvec_vector));
 
     /* initialize new elements */
-    if (_GET_VECTOR_TYPE_STYLE(pvec_vector) == _TYPE_CSTL_BUILTIN) {
+    if (_type_is_trivially_initializable(&pvec_vector->_t_typeinfo)) {
+        memset(pby_start, 0x00, pby_finish - pby_start);
+    } else if (_GET_VECTOR_TYPE_STYLE(pvec_vector) == _TYPE_CSTL_BUILTIN) {
         /* get element type name */
         char s_elemtypename[_TYPE_NAME_SIZE + 1];
         _type_get_elem_typename(_GET_VECTOR_TYPE_NAME(pvec_vector), s_elemtypename);
@@ -34,6 +34,7 @@ extern "C" {
 #define _GET_VECTOR_TYPE_SIZE(pvec_vector)             ((pvec_vector)->_t_typeinfo._pt_type->_t_typesize)
 #define _GET_VECTOR_TYPE_NAME(pvec_vector)             ((pvec_vector)->_t_typeinfo._s_typename)
 #define _GET_VECTOR_TYPE_BASENAME(pvec_vector)         ((pvec_vector)->_t_typeinfo._pt_type->_s_typename)
+#define _GET_VECTOR_TYPE_ID(pvec_vector)               ((pvec_vector)->_t_typeinfo._pt_type->_t_typeid)
 #define _GET_VECTOR_TYPE_INIT_FUNCTION(pvec_vector)    ((pvec_vector)->_t_typeinfo._pt_type->_t_typeinit)
 #define _GET_VECTOR_TYPE_COPY_FUNCTION(pvec_vector)    ((pvec_vector)->_t_typeinfo._pt_type->_t_typecopy)
 #define _GET_VECTOR_TYPE_LESS_FUNCTION(pvec_vector)    ((pvec_vector)->_t_typeinfo._pt_type->_t_typeless)
@@ -81,7 +81,7 @@ void _vector_iterator_get_value(vector_iterator_t it_iter, void* pv_value)
     assert(!_vector_iterator_equal(it_iter, vector_end(_VECTOR_ITERATOR_CONTAINER(it_iter))));
 
     /* char* */
-    if (strncmp(_GET_VECTOR_TYPE_BASENAME(_VECTOR_ITERATOR_CONTAINER(it_iter)), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_VECTOR_TYPE_ID(_VECTOR_ITERATOR_CONTAINER(it_iter)) == _TYPE_ID_C_STRING) {
         *(char**)pv_value = (char*)string_c_str((string_t*)_VECTOR_ITERATOR_COREPOS(it_iter));
     } else {
         b_result = _GET_VECTOR_TYPE_SIZE(_VECTOR_ITERATOR_CONTAINER(it_iter));
@@ -102,7 +102,7 @@ void _vector_iterator_set_value(vector_iterator_t it_iter, const void* cpv_value
     assert(!_vector_iterator_equal(it_iter, vector_end(_VECTOR_ITERATOR_CONTAINER(it_iter))));
 
     /* char* */
-    if (strncmp(_GET_VECTOR_TYPE_BASENAME(_VECTOR_ITERATOR_CONTAINER(it_iter)), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_VECTOR_TYPE_ID(_VECTOR_ITERATOR_CONTAINER(it_iter)) == _TYPE_ID_C_STRING) {
         string_assign_cstr((string_t*)_VECTOR_ITERATOR_COREPOS(it_iter), (char*)cpv_value);
     } else {
         b_result = _GET_VECTOR_TYPE_SIZE(_VECTOR_ITERATOR_CONTAINER(it_iter));
@@ -120,7 +120,7 @@ const void* _vector_iterator_get_pointer(vector_iterator_t it_iter)
     assert(!_vector_iterator_equal(it_iter, vector_end(_VECTOR_ITERATOR_CONTAINER(it_iter))));
 
     /* char* */
-    if (strncmp(_GET_VECTOR_TYPE_BASENAME(_VECTOR_ITERATOR_CONTAINER(it_iter)), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+    if (_GET_VECTOR_TYPE_ID(_VECTOR_ITERATOR_CONTAINER(it_iter)) == _TYPE_ID_C_STRING) {
         return string_c_str((string_t*)_VECTOR_ITERATOR_COREPOS(it_iter));
     } else {
         return _VECTOR_ITERATOR_COREPOS(it_iter);
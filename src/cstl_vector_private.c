@@ -61,6 +61,22 @@ vector_t* _create_vector(const char* s_typename)
     return pvec_vector;
 }
 
+/**
+ * Create vector container that uses user defined allocator.
+ */
+vector_t* _create_vector_with_allocator(const allocator_t* cpt_allocator, const char* s_typename)
+{
+    vector_t* pvec_vector = NULL;
+
+    assert(cpt_allocator != NULL);
+
+    if ((pvec_vector = _create_vector(s_typename)) != NULL) {
+        _alloc_set_allocator(&pvec_vector->_t_allocator, cpt_allocator);
+    }
+
+    return pvec_vector;
+}
+
 /**
  * Create vector container auxiliary function.
  */
@@ -149,12 +165,14 @@ void _vector_destroy_auxiliary(vector_t* pvec_vector)
     assert(_vector_is_inited(pvec_vector) || _vector_is_created(pvec_vector));
 
     /* destroy all elements */
-    it_begin = vector_begin(pvec_vector);
-    it_end = vector_end(pvec_vector);
-    for (it_iter = it_begin; !iterator_equal(it_iter, it_end); it_iter = iterator_next(it_iter)) {
-        b_result = _GET_VECTOR_TYPE_SIZE(pvec_vector);
-        _GET_VECTOR_TYPE_DESTROY_FUNCTION(pvec_vector)(_VECTOR_ITERATOR_COREPOS(it_iter), &b_result);
-        assert(b_result);
+    if (!_type_is_trivially_destructible(&pvec_vector->_t_typeinfo)) {
+        it_begin = vector_begin(pvec_vector);
+        it_end = vector_end(pvec_vector);
+        for (it_iter = it_begin; !iterator_equal(it_iter, it_end); it_iter = iterator_next(it_iter)) {
+            b_result = _GET_VECTOR_TYPE_SIZE(pvec_vector);
+            _GET_VECTOR_TYPE_DESTROY_FUNCTION(pvec_vector)(_VECTOR_ITERATOR_COREPOS(it_iter), &b_result);
+            assert(b_result);
+        }
     }
     /* free vector memory */
     if (pvec_vector->_pby_start != NULL) {
@@ -390,14 +408,19 @@ vector_iterator_t _vector_insert_n_varg(vector_t* pvec_vector, vector_iterator_t
         pvec_vector->_pby_finish += t_count * _GET_VECTOR_TYPE_SIZE(pvec_vector);
         _vector_init_elem_range_auxiliary(pvec_vector, pby_oldfinish, pvec_vector->_pby_finish);
         /* move element from old finish to new finish */
-        for (pby_pos = pby_oldfinish - _GET_VECTOR_TYPE_SIZE(pvec_vector),
-             pby_destpos = pvec_vector->_pby_finish - _GET_VECTOR_TYPE_SIZE(pvec_vector);
-             pby_pos >= _VECTOR_ITERATOR_COREPOS(it_pos);
-             pby_pos -= _GET_VECTOR_TYPE_SIZE(pvec_vector),
-             pby_destpos -= _GET_VECTOR_TYPE_SIZE(pvec_vector)) {
-            b_result = _GET_VECTOR_TYPE_SIZE(pvec_vector);
-            _GET_VECTOR_TYPE_COPY_FUNCTION(pvec_vector)(pby_destpos, pby_pos, &b_result);
-            assert(b_result);
+        if (_type_is_trivially_copyable(&pvec_vector->_t_typeinfo)) {
+            memmove(_VECTOR_ITERATOR_COREPOS(it_pos) + t_count * _GET_VECTOR_TYPE_SIZE(pvec_vector),
+                _VECTOR_ITERATOR_COREPOS(it_pos), pby_oldfinish - _VECTOR_ITERATOR_COREPOS(it_pos));
+        } else {
+            for (pby_pos = pby_oldfinish - _GET_VECTOR_TYPE_SIZE(pvec_vector),
+                 pby_destpos = pvec_vector->_pby_finish - _GET_VECTOR_TYPE_SIZE(pvec_vector);
+                 pby_pos >= _VECTOR_ITERATOR_COREPOS(it_pos);
+                 pby_pos -= _GET_VECTOR_TYPE_SIZE(pvec_vector),
+                 pby_destpos -= _GET_VECTOR_TYPE_SIZE(pvec_vector)) {
+                b_result = _GET_VECTOR_TYPE_SIZE(pvec_vector);
+                _GET_VECTOR_TYPE_COPY_FUNCTION(pvec_vector)(pby_destpos, pby_pos, &b_result);
+                assert(b_result);
+            }
         }
 
         /* get varg value only once */
@@ -405,10 +428,16 @@ vector_iterator_t _vector_insert_n_varg(vector_t* pvec_vector, vector_iterator_t
         assert(pv_varg != NULL);
         _vector_get_varg_value_auxiliary(pvec_vector, val_elemlist, pv_varg);
         /* copy value for varg */
-        for (i = 0; i < t_count; ++i) {
-            b_result = _GET_VECTOR_TYPE_SIZE(pvec_vector);
-            _GET_VECTOR_TYPE_COPY_FUNCTION(pvec_vector)(_VECTOR_ITERATOR_COREPOS(it_pos) + i * _GET_VECTOR_TYPE_SIZE(pvec_vector), pv_varg, &b_result);
-            assert(b_result);
+        if (_type_is_trivially_copyable(&pvec_vector->_t_typeinfo)) {
+            for (i = 0; i < t_count; ++i) {
+                memcpy(_VECTOR_ITERATOR_COREPOS(it_pos) + i * _GET_VECTOR_TYPE_SIZE(pvec_vector), pv_varg, _GET_VECTOR_TYPE_SIZE(pvec_vector));
+            }
+        } else {
+            for (i = 0; i < t_count; ++i) {
+                b_result = _GET_VECTOR_TYPE_SIZE(pvec_vector);
+                _GET_VECTOR_TYPE_COPY_FUNCTION(pvec_vector)(_VECTOR_ITERATOR_COREPOS(it_pos) + i * _GET_VECTOR_TYPE_SIZE(pvec_vector), pv_varg, &b_result);
+                assert(b_result);
+            }
         }
         /* destroy varg and free memory */
         _vector_destroy_varg_value_auxiliary(pvec_vector, pv_varg);
@@ -0,0 +1,92 @@
+/*
+ *  The benchmark of container teardown for normal memory and region.
+ *  Copyright (C)  2008 - 2014  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+/*
+ * Builds per request scratch lists and sets of int, then destroys them, once with
+ * the normal allocator and once with the region:
+ *
+ *     cc -O2 -I/usr/local/include bench_alloc_region.c -L/usr/local/lib -lcstl -o bench_alloc_region
+ *     ./bench_alloc_region [request count]
+ */
+
+/** include section **/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <cstl/clist.h>
+#include <cstl/cset.h>
+
+/** local constant declaration and local macro section **/
+#define _BENCH_DEFAULT_REQUEST 20
+#define _BENCH_ELEM_COUNT      10000
+
+/** local function implementation section **/
+static double _bench_now(void)
+{
+    struct timespec t_now;
+
+    clock_gettime(CLOCK_MONOTONIC, &t_now);
+    return t_now.tv_sec + t_now.tv_nsec / 1e9;
+}
+
+static void _bench_run(const char* s_name, size_t t_request, bool_t b_region)
+{
+    double  d_fill = 0.0;
+    double  d_destroy = 0.0;
+    double  d_start = 0.0;
+    list_t* pt_list = NULL;
+    set_t*  pt_set = NULL;
+    size_t  i = 0;
+    int     j = 0;
+
+    for (i = 0; i < t_request; ++i) {
+        d_start = _bench_now();
+        pt_list = b_region ? create_list_with_region(int) : create_list(int);
+        pt_set = b_region ? create_set_with_region(int) : create_set(int);
+        list_init(pt_list);
+        set_init(pt_set);
+        for (j = 0; j < _BENCH_ELEM_COUNT; ++j) {
+            list_push_back(pt_list, j);
+            set_insert(pt_set, j);
+        }
+        d_fill += _bench_now() - d_start;
+
+        d_start = _bench_now();
+        list_destroy(pt_list);
+        set_destroy(pt_set);
+        d_destroy += _bench_now() - d_start;
+    }
+
+    printf("%-8s fill %8.3f s    destroy %8.3f s\n", s_name, d_fill, d_destroy);
+}
+
+int main(int argc, char* argv[])
+{
+    size_t t_request = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : _BENCH_DEFAULT_REQUEST;
+
+    _bench_run("normal", t_request, false);
+    _bench_run("region", t_request, true);
+
+    return 0;
+}
+
+/** eof **/
@@ -0,0 +1,118 @@
+/*
+ *  The benchmark of memory footprint for per container and shared memory pool.
+ *  Copyright (C)  2008 - 2014  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+/*
+ * Holds many small lists and sets at the same time, releases half of their
+ * elements and then grows the other half, and reports the resident memory of
+ * the process after each phase. Run it once against a libcstl configured with
+ * --with-memory-management and once with --with-memory-management=shared:
+ *
+ *     cc -O2 -I/usr/local/include bench_alloc_shared_pool.c -L/usr/local/lib -lcstl -o bench_alloc_shared_pool
+ *     ./bench_alloc_shared_pool [container count]
+ *
+ * The resident memory is read from /proc/self/statm, so the numbers are only
+ * reported on Linux.
+ */
+
+/** include section **/
+#include <stdio.h>
+#include <stdlib.h>
+#include <cstl/clist.h>
+#include <cstl/cset.h>
+
+/** local constant declaration and local macro section **/
+#define _BENCH_DEFAULT_COUNT 100000
+#define _BENCH_ELEM_COUNT    8
+#define _BENCH_GROW_COUNT    64
+
+/** local function implementation section **/
+static void _bench_report(const char* s_phase)
+{
+    FILE*         fp_statm = fopen("/proc/self/statm", "r");
+    unsigned long ul_size = 0;
+    unsigned long ul_resident = 0;
+
+    if (fp_statm != NULL && fscanf(fp_statm, "%lu %lu", &ul_size, &ul_resident) == 2) {
+        printf("%-24s resident %8lu pages\n", s_phase, ul_resident);
+    } else {
+        printf("%-24s resident n/a\n", s_phase);
+    }
+
+    if (fp_statm != NULL) {
+        fclose(fp_statm);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    size_t   t_count = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : _BENCH_DEFAULT_COUNT;
+    list_t** ppt_list = (list_t**)malloc(t_count * sizeof(list_t*));
+    set_t**  ppt_set = (set_t**)malloc(t_count * sizeof(set_t*));
+    size_t   i = 0;
+    int      j = 0;
+
+    if (ppt_list == NULL || ppt_set == NULL) {
+        return EXIT_FAILURE;
+    }
+
+    _bench_report("start");
+
+    for (i = 0; i < t_count; ++i) {
+        ppt_list[i] = create_list(int);
+        ppt_set[i] = create_set(int);
+        list_init(ppt_list[i]);
+        set_init(ppt_set[i]);
+        for (j = 0; j < _BENCH_ELEM_COUNT; ++j) {
+            list_push_back(ppt_list[i], j);
+            set_insert(ppt_set[i], j);
+        }
+    }
+    _bench_report("filled");
+
+    /* release the elements of half containers, the other containers keep growing */
+    for (i = 0; i < t_count; i += 2) {
+        list_clear(ppt_list[i]);
+        set_clear(ppt_set[i]);
+    }
+    _bench_report("half cleared");
+
+    for (i = 1; i < t_count; i += 2) {
+        for (j = _BENCH_ELEM_COUNT; j < _BENCH_GROW_COUNT; ++j) {
+            list_push_back(ppt_list[i], j);
+            set_insert(ppt_set[i], j);
+        }
+    }
+    _bench_report("half regrown");
+
+    for (i = 0; i < t_count; ++i) {
+        list_destroy(ppt_list[i]);
+        set_destroy(ppt_set[i]);
+    }
+    _bench_report("destroyed");
+
+    free(ppt_list);
+    free(ppt_set);
+
+    return 0;
+}
+
+/** eof **/
@@ -0,0 +1,134 @@
+/*
+ *  The benchmark of memory management for containers that are used by many threads.
+ *  Copyright (C)  2008 - 2014  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+/*
+ * Each thread fills and clears its own list and set repeatedly, then the lists
+ * are handed to the next thread and destroyed there, so the memory is released
+ * by the thread other than the one that allocated it. Run it against a libcstl
+ * configured without memory management and with --with-memory-management=thread:
+ *
+ *     cc -O2 -I/usr/local/include bench_alloc_thread_cache.c -L/usr/local/lib -lcstl -lpthread -o bench_alloc_thread_cache
+ *     ./bench_alloc_thread_cache [thread count]
+ */
+
+/** include section **/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+#include <cstl/clist.h>
+#include <cstl/cset.h>
+
+/** local constant declaration and local macro section **/
+#define _BENCH_DEFAULT_THREAD 4
+#define _BENCH_MAX_THREAD     64
+#define _BENCH_ROUND_COUNT    50
+#define _BENCH_ELEM_COUNT     2000
+
+/** local global variable definition section **/
+static list_t* _gapt_bench_list[_BENCH_MAX_THREAD];
+static size_t  _gt_bench_thread = _BENCH_DEFAULT_THREAD;
+
+/** local function implementation section **/
+static void* _bench_fill(void* pv_arg)
+{
+    size_t  t_index = (size_t)pv_arg;
+    list_t* pt_list = create_list(int);
+    set_t*  pt_set = create_set(int);
+    int     i = 0;
+    int     j = 0;
+
+    list_init(pt_list);
+    set_init(pt_set);
+    for (i = 0; i < _BENCH_ROUND_COUNT; ++i) {
+        for (j = 0; j < _BENCH_ELEM_COUNT; ++j) {
+            list_push_back(pt_list, j);
+            set_insert(pt_set, j);
+        }
+        list_clear(pt_list);
+        set_clear(pt_set);
+    }
+    set_destroy(pt_set);
+
+    /* leave the last round of elements to the next thread */
+    for (j = 0; j < _BENCH_ELEM_COUNT; ++j) {
+        list_push_back(pt_list, j);
+    }
+    _gapt_bench_list[t_index] = pt_list;
+
+    return NULL;
+}
+
+static void* _bench_release(void* pv_arg)
+{
+    size_t t_index = ((size_t)pv_arg + 1) % _gt_bench_thread;
+
+    list_destroy(_gapt_bench_list[t_index]);
+    _gapt_bench_list[t_index] = NULL;
+
+    return NULL;
+}
+
+static void _bench_run(void* (*pfun_thread)(void*))
+{
+    pthread_t at_thread[_BENCH_MAX_THREAD];
+    size_t    i = 0;
+
+    for (i = 0; i < _gt_bench_thread; ++i) {
+        pthread_create(&at_thread[i], NULL, pfun_thread, (void*)i);
+    }
+    for (i = 0; i < _gt_bench_thread; ++i) {
+        pthread_join(at_thread[i], NULL);
+    }
+}
+
+static double _bench_now(void)
+{
+    struct timespec t_now;
+
+    clock_gettime(CLOCK_MONOTONIC, &t_now);
+    return t_now.tv_sec + t_now.tv_nsec / 1e9;
+}
+
+int main(int argc, char* argv[])
+{
+    double d_start = 0.0;
+
+    if (argc > 1) {
+        _gt_bench_thread = (size_t)strtoul(argv[1], NULL, 10);
+    }
+    if (_gt_bench_thread == 0 || _gt_bench_thread > _BENCH_MAX_THREAD) {
+        return EXIT_FAILURE;
+    }
+
+    d_start = _bench_now();
+    _bench_run(_bench_fill);
+    printf("%-24s %8.3f s\n", "fill and clear", _bench_now() - d_start);
+
+    d_start = _bench_now();
+    _bench_run(_bench_release);
+    printf("%-24s %8.3f s\n", "release by other thread", _bench_now() - d_start);
+
+    return 0;
+}
+
+/** eof **/
@@ -0,0 +1,127 @@
+/*
+ *  The benchmark of bulk element moves in vector and deque.
+ *  Copyright (C)  2008 - 2014  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+/*
+ * Grow, copy, insert into and erase from vector and deque of int, whose element
+ * type is trivially copyable, so the elements are moved as raw memory instead of
+ * by the type functions. Build libcstl with CFLAGS="-O2 -DNDEBUG", the debug
+ * assertions dominate the result otherwise:
+ *
+ *     cc -O2 -I/usr/local/include bench_bulk_move.c -L/usr/local/lib -lcstl -o bench_bulk_move
+ *     ./bench_bulk_move [element count]
+ */
+
+/** include section **/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <cstl/cvector.h>
+#include <cstl/cdeque.h>
+
+/** local constant declaration and local macro section **/
+#define _BENCH_DEFAULT_ELEM   10000000
+#define _BENCH_ROUND_COUNT    5
+#define _BENCH_MIDDLE_COUNT   64
+
+/** local function implementation section **/
+static double _bench_now(void)
+{
+    struct timespec t_now;
+
+    clock_gettime(CLOCK_MONOTONIC, &t_now);
+    return t_now.tv_sec + t_now.tv_nsec / 1e9;
+}
+
+static void _bench_report(const char* s_name, double d_elapse)
+{
+    printf("%-24s %8.3f s\n", s_name, d_elapse);
+}
+
+int main(int argc, char* argv[])
+{
+    size_t    t_count = _BENCH_DEFAULT_ELEM;
+    size_t    i = 0;
+    size_t    j = 0;
+    double    d_start = 0.0;
+    vector_t* pvec_src = create_vector(int);
+    vector_t* pvec_dest = create_vector(int);
+    deque_t*  pdeq_int = create_deque(int);
+
+    if (argc > 1) {
+        t_count = (size_t)strtoul(argv[1], NULL, 10);
+    }
+    if (t_count == 0) {
+        return EXIT_FAILURE;
+    }
+
+    vector_init_n(pvec_src, t_count);
+    deque_init_n(pdeq_int, t_count / _BENCH_MIDDLE_COUNT);
+
+    d_start = _bench_now();
+    for (i = 0; i < _BENCH_ROUND_COUNT; ++i) {
+        vector_init(pvec_dest);
+        for (j = 1; j <= t_count; j *= 2) {
+            vector_resize(pvec_dest, j);
+        }
+        vector_destroy(pvec_dest);
+        pvec_dest = create_vector(int);
+    }
+    _bench_report("vector resize growth", _bench_now() - d_start);
+
+    d_start = _bench_now();
+    for (i = 0; i < _BENCH_ROUND_COUNT; ++i) {
+        vector_init_copy(pvec_dest, pvec_src);
+        vector_destroy(pvec_dest);
+        pvec_dest = create_vector(int);
+    }
+    _bench_report("vector init_copy", _bench_now() - d_start);
+
+    vector_init(pvec_dest);
+    d_start = _bench_now();
+    for (i = 0; i < _BENCH_ROUND_COUNT; ++i) {
+        vector_assign(pvec_dest, pvec_src);
+        vector_clear(pvec_dest);
+    }
+    _bench_report("vector assign", _bench_now() - d_start);
+
+    vector_assign(pvec_dest, pvec_src);
+    d_start = _bench_now();
+    for (i = 0; i < _BENCH_MIDDLE_COUNT; ++i) {
+        vector_insert_n(pvec_dest, vector_begin(pvec_dest), 1, 0);
+        vector_erase_range(pvec_dest, vector_begin(pvec_dest), iterator_next(vector_begin(pvec_dest)));
+    }
+    _bench_report("vector insert/erase", _bench_now() - d_start);
+
+    d_start = _bench_now();
+    for (i = 0; i < _BENCH_MIDDLE_COUNT; ++i) {
+        deque_insert_n(pdeq_int, iterator_next_n(deque_begin(pdeq_int), deque_size(pdeq_int) / 2), 1, 0);
+        deque_erase(pdeq_int, iterator_next_n(deque_begin(pdeq_int), deque_size(pdeq_int) / 2));
+    }
+    _bench_report("deque insert/erase", _bench_now() - d_start);
+
+    vector_destroy(pvec_src);
+    vector_destroy(pvec_dest);
+    deque_destroy(pdeq_int);
+
+    return 0;
+}
+
+/** eof **/
@@ -0,0 +1,118 @@
+/*
+ *  The benchmark of creating and destroying short-lived containers.
+ *  Copyright (C)  2008 - 2014  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+/*
+ * Create, initialize and destroy empty containers with the same few type names
+ * over and over, so the cost is dominated by resolving the type name. Build
+ * libcstl with CFLAGS="-O2 -DNDEBUG", the debug assertions dominate the result
+ * otherwise:
+ *
+ *     cc -O2 -I/usr/local/include bench_create.c -L/usr/local/lib -lcstl -o bench_create
+ *     ./bench_create [round count]
+ */
+
+/** include section **/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <cstl/cvector.h>
+#include <cstl/clist.h>
+#include <cstl/cmap.h>
+
+/** local constant declaration and local macro section **/
+#define _BENCH_DEFAULT_ROUND  200000
+#define _BENCH_NAME_COUNT     (sizeof(_gas_bench_name) / sizeof(_gas_bench_name[0]))
+
+/** local global variable definition section **/
+/* element type names of a program that uses many kinds of container */
+static const char* _gas_bench_name[] = {
+    "char", "unsigned char", "short", "unsigned short", "int", "unsigned int", "long", "unsigned long",
+    "float", "double", "long double", "bool_t", "char*", "void*", "long long", "unsigned long long",
+    "vector_t<int>", "vector_t<double>", "vector_t<char*>", "list_t<int>", "list_t<char*>",
+    "slist_t<long>", "deque_t<int>", "set_t<int>", "set_t<char*>", "multiset_t<double>",
+    "map_t<int, char*>", "map_t<char*, vector_t<int>>", "hash_set_t<int>", "hash_map_t<char*, int>",
+    "pair_t<int, double>", "string_t"
+};
+
+/** local function implementation section **/
+static double _bench_now(void)
+{
+    struct timespec t_now;
+
+    clock_gettime(CLOCK_MONOTONIC, &t_now);
+    return t_now.tv_sec + t_now.tv_nsec / 1e9;
+}
+
+static void _bench_report(const char* s_name, double d_elapse, size_t t_count)
+{
+    printf("%-32s %8.3f s %8.1f ns/op\n", s_name, d_elapse, d_elapse * 1e9 / t_count);
+}
+
+int main(int argc, char* argv[])
+{
+    size_t t_round = _BENCH_DEFAULT_ROUND;
+    size_t i = 0;
+    double d_start = 0.0;
+
+    if (argc > 1) {
+        t_round = (size_t)strtoul(argv[1], NULL, 10);
+    }
+    if (t_round == 0) {
+        return EXIT_FAILURE;
+    }
+
+    d_start = _bench_now();
+    for (i = 0; i < t_round; ++i) {
+        vector_t* pvec = create_vector(int);
+        vector_init(pvec);
+        vector_destroy(pvec);
+    }
+    _bench_report("vector_t<int>", _bench_now() - d_start, t_round);
+
+    d_start = _bench_now();
+    for (i = 0; i < t_round; ++i) {
+        vector_t* pvec = _create_vector(_gas_bench_name[i % _BENCH_NAME_COUNT]);
+        vector_init(pvec);
+        vector_destroy(pvec);
+    }
+    _bench_report("vector_t<...> of 32 types", _bench_now() - d_start, t_round);
+
+    d_start = _bench_now();
+    for (i = 0; i < t_round; ++i) {
+        list_t* plist = create_list(vector_t<unsigned long>);
+        list_init(plist);
+        list_destroy(plist);
+    }
+    _bench_report("list_t<vector_t<unsigned long>>", _bench_now() - d_start, t_round);
+
+    d_start = _bench_now();
+    for (i = 0; i < t_round; ++i) {
+        map_t* pmap = create_map(int, char*);
+        map_init(pmap);
+        map_destroy(pmap);
+    }
+    _bench_report("map_t<int, char*>", _bench_now() - d_start, t_round);
+
+    return 0;
+}
+
+/** eof **/
@@ -0,0 +1,124 @@
+/*
+ *  The benchmark of container creation from multiple threads.
+ *  Copyright (C)  2008 - 2014  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+/*
+ * Each thread creates and destroys containers of several type names without any
+ * lock of its own, while the first thread keeps registering new user types, so the
+ * type register, the type caches and the parser are used by all threads at once:
+ *
+ *     cc -O2 -I/usr/local/include bench_create_threads.c -L/usr/local/lib -lcstl -lpthread -o bench_create_threads
+ *     ./bench_create_threads [thread count]
+ */
+
+/** include section **/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+#include <cstl/cvector.h>
+#include <cstl/clist.h>
+#include <cstl/cmap.h>
+#include <cstl/chash_set.h>
+
+/** local constant declaration and local macro section **/
+#define _BENCH_DEFAULT_THREAD 4
+#define _BENCH_MAX_THREAD     64
+#define _BENCH_CREATE_COUNT   200000
+#define _BENCH_REGISTER_COUNT 64
+
+/** local data type declaration and local struct, union, enum section **/
+typedef struct _tagbenchpoint {
+    int n_x;
+    int n_y;
+}_bench_point_t;
+
+/** local global variable definition section **/
+static size_t _gt_bench_thread = _BENCH_DEFAULT_THREAD;
+
+/** local function implementation section **/
+static void* _bench_create(void* pv_arg)
+{
+    size_t i = 0;
+    char   s_typename[32];
+
+    for (i = 0; i < _BENCH_CREATE_COUNT; ++i) {
+        vector_t*   pvec = create_vector(int);
+        list_t*     plist = create_list(vector_t<double>);
+        map_t*      pmap = create_map(int, list_t<char*>);
+        hash_set_t* phset = create_hash_set(_bench_point_t);
+
+        if (pvec == NULL || plist == NULL || pmap == NULL || phset == NULL) {
+            fprintf(stderr, "create failed\n");
+            exit(EXIT_FAILURE);
+        }
+        vector_destroy(pvec);
+        list_destroy(plist);
+        map_destroy(pmap);
+        hash_set_destroy(phset);
+
+        /* registering invalidates the type caches of all threads */
+        if ((size_t)pv_arg == 0 && i % (_BENCH_CREATE_COUNT / _BENCH_REGISTER_COUNT) == 0) {
+            sprintf(s_typename, "_bench_type_%lu_t", (unsigned long)i);
+            _type_register(sizeof(_bench_point_t), s_typename, NULL, NULL, NULL, NULL);
+        }
+    }
+
+    return NULL;
+}
+
+static double _bench_now(void)
+{
+    struct timespec t_now;
+
+    clock_gettime(CLOCK_MONOTONIC, &t_now);
+    return t_now.tv_sec + t_now.tv_nsec / 1e9;
+}
+
+int main(int argc, char* argv[])
+{
+    pthread_t at_thread[_BENCH_MAX_THREAD];
+    double    d_start = 0.0;
+    size_t    i = 0;
+
+    if (argc > 1) {
+        _gt_bench_thread = (size_t)strtoul(argv[1], NULL, 10);
+    }
+    if (_gt_bench_thread == 0 || _gt_bench_thread > _BENCH_MAX_THREAD) {
+        return EXIT_FAILURE;
+    }
+
+    /* the element type of hash set is registered before the threads start */
+    type_register(_bench_point_t, NULL, NULL, NULL, NULL);
+
+    d_start = _bench_now();
+    for (i = 0; i < _gt_bench_thread; ++i) {
+        pthread_create(&at_thread[i], NULL, _bench_create, (void*)i);
+    }
+    for (i = 0; i < _gt_bench_thread; ++i) {
+        pthread_join(at_thread[i], NULL);
+    }
+    printf("%-24s %8.3f s\n", "create and destroy", _bench_now() - d_start);
+
+    return 0;
+}
+
+/** eof **/
@@ -0,0 +1,182 @@
+/*
+ *  The benchmark of batched find for hash_map and map.
+ *  Copyright (C)  2008 - 2014  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+/*
+ * Compares the probe throughput of finding keys one by one with finding them
+ * in batches of different sizes. The containers should be much larger than the
+ * cache to see the prefetching pay off. Build against an installed libcstl that
+ * was configured with --disable-assert:
+ *
+ *     cc -O2 -I/usr/local/include bench_find_batch.c -L/usr/local/lib -lcstl -o bench_find_batch
+ *     ./bench_find_batch [element count]
+ */
+
+/** include section **/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <cstl/chash_map.h>
+#include <cstl/cmap.h>
+
+/** local constant declaration and local macro section **/
+#define _BENCH_DEFAULT_COUNT 1000000
+#define _BENCH_MAX_BATCH     256
+
+/** local function implementation section **/
+static double _bench_elapsed(clock_t t_start)
+{
+    return (double)(clock() - t_start) / CLOCKS_PER_SEC;
+}
+
+/* random probe keys, so that consecutive probes do not share cache lines */
+static int* _bench_make_keys(size_t t_count)
+{
+    int*   pn_keys = (int*)malloc(t_count * sizeof(int));
+    size_t i = 0;
+
+    srand(1);
+    for (i = 0; i < t_count; ++i) {
+        pn_keys[i] = (int)(((size_t)rand() * RAND_MAX + (size_t)rand()) % (t_count * 2));
+    }
+    return pn_keys;
+}
+
+static void _bench_report(const char* s_name, size_t t_batch, double d_elapsed, size_t t_found, size_t t_count)
+{
+    printf("%-8s batch %3u  %8.3fs  %10.0f probes/s  found %u/%u\n",
+        s_name, (unsigned)t_batch, d_elapsed, d_elapsed > 0.0 ? (double)t_count / d_elapsed : 0.0,
+        (unsigned)t_found, (unsigned)t_count);
+}
+
+static void _bench_hash_map(const int* cpn_keys, size_t t_count)
+{
+    hash_map_t*         phmap = create_hash_map(int, int);
+    pair_t*             ppair = create_pair(int, int);
+    hash_map_iterator_t at_iter[_BENCH_MAX_BATCH];
+    size_t              at_batch[] = {4, 16, 64, 256};
+    clock_t             t_start = 0;
+    size_t              t_found = 0;
+    size_t              t_batch = 0;
+    size_t              i = 0;
+    size_t              j = 0;
+    size_t              k = 0;
+
+    hash_map_init(phmap);
+    pair_init(ppair);
+    /* even keys only, half of the probes miss */
+    for (i = 0; i < t_count; ++i) {
+        pair_make(ppair, (int)(i * 2), (int)i);
+        hash_map_insert(phmap, ppair);
+    }
+
+    t_start = clock();
+    for (i = 0; i < t_count; ++i) {
+        if (!iterator_equal(hash_map_find_ptr(phmap, cpn_keys + i), hash_map_end(phmap))) {
+            ++t_found;
+        }
+    }
+    _bench_report("hash_map", 1, _bench_elapsed(t_start), t_found, t_count);
+
+    for (k = 0; k < sizeof(at_batch) / sizeof(at_batch[0]); ++k) {
+        t_found = 0;
+        t_start = clock();
+        for (i = 0; i < t_count; i += t_batch) {
+            t_batch = t_count - i < at_batch[k] ? t_count - i : at_batch[k];
+            hash_map_find_batch(phmap, cpn_keys + i, t_batch, at_iter);
+            for (j = 0; j < t_batch; ++j) {
+                if (!iterator_equal(at_iter[j], hash_map_end(phmap))) {
+                    ++t_found;
+                }
+            }
+        }
+        _bench_report("hash_map", at_batch[k], _bench_elapsed(t_start), t_found, t_count);
+    }
+
+    hash_map_destroy(phmap);
+    pair_destroy(ppair);
+}
+
+static void _bench_map(const int* cpn_keys, size_t t_count)
+{
+    map_t*         pmap = create_map(int, int);
+    pair_t*        ppair = create_pair(int, int);
+    map_iterator_t at_iter[_BENCH_MAX_BATCH];
+    size_t         at_batch[] = {4, 16, 64, 256};
+    clock_t        t_start = 0;
+    size_t         t_found = 0;
+    size_t         t_batch = 0;
+    size_t         i = 0;
+    size_t         j = 0;
+    size_t         k = 0;
+
+    map_init(pmap);
+    pair_init(ppair);
+    for (i = 0; i < t_count; ++i) {
+        pair_make(ppair, (int)(i * 2), (int)i);
+        map_insert(pmap, ppair);
+    }
+
+    t_start = clock();
+    for (i = 0; i < t_count; ++i) {
+        if (!iterator_equal(map_find_ptr(pmap, cpn_keys + i), map_end(pmap))) {
+            ++t_found;
+        }
+    }
+    _bench_report("map", 1, _bench_elapsed(t_start), t_found, t_count);
+
+    for (k = 0; k < sizeof(at_batch) / sizeof(at_batch[0]); ++k) {
+        t_found = 0;
+        t_start = clock();
+        for (i = 0; i < t_count; i += t_batch) {
+            t_batch = t_count - i < at_batch[k] ? t_count - i : at_batch[k];
+            map_find_batch(pmap, cpn_keys + i, t_batch, at_iter);
+            for (j = 0; j < t_batch; ++j) {
+                if (!iterator_equal(at_iter[j], map_end(pmap))) {
+                    ++t_found;
+                }
+            }
+        }
+        _bench_report("map", at_batch[k], _bench_elapsed(t_start), t_found, t_count);
+    }
+
+    map_destroy(pmap);
+    pair_destroy(ppair);
+}
+
+int main(int argc, char* argv[])
+{
+    size_t t_count = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : _BENCH_DEFAULT_COUNT;
+    int*   pn_keys = NULL;
+
+    if (t_count == 0) {
+        return 0;
+    }
+
+    pn_keys = _bench_make_keys(t_count);
+    _bench_hash_map(pn_keys, t_count);
+    _bench_map(pn_keys, t_count);
+    free(pn_keys);
+
+    return 0;
+}
+
+/** eof **/
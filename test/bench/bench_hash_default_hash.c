@@ -0,0 +1,131 @@
+/*
+ *  The benchmark of default hash function for hash containers.
+ *  Copyright (C)  2008 - 2014  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+/*
+ * Compares the seeded default hash with the legacy byte-sum hash on integer
+ * and string keys. Build against an installed libcstl that was configured with
+ * --disable-assert, the iterator checks in debug builds dominate the timings:
+ *
+ *     cc -O2 -I/usr/local/include bench_hash_default_hash.c -L/usr/local/lib -lcstl -o bench_hash_default_hash
+ *     ./bench_hash_default_hash [element count]
+ */
+
+/** include section **/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <cstl/chash_set.h>
+
+/** local constant declaration and local macro section **/
+#define _BENCH_DEFAULT_COUNT 100000
+#define _BENCH_KEY_LEN       16
+
+/** local function implementation section **/
+/* the hash function used by hash containers before the seeded default hash */
+static void _bench_byte_sum_hash(const void* cpv_input, void* pv_output)
+{
+    const unsigned char* pby_input = (const unsigned char*)cpv_input;
+    size_t               t_len = *(size_t*)pv_output;
+    size_t               t_sum = 0;
+    size_t               i = 0;
+
+    for (i = 0; i < t_len; ++i) {
+        t_sum += (size_t)pby_input[i];
+    }
+    *(size_t*)pv_output = t_sum;
+}
+
+static double _bench_elapsed(clock_t t_start)
+{
+    return (double)(clock() - t_start) / CLOCKS_PER_SEC;
+}
+
+static void _bench_int(const char* s_name, ufun_t ufun_hash, size_t t_count)
+{
+    hash_set_t* phset = create_hash_set(int);
+    clock_t     t_start = 0;
+    size_t      t_found = 0;
+    int         i = 0;
+
+    hash_set_init_ex(phset, 0, ufun_hash, NULL);
+    t_start = clock();
+    for (i = 0; i < (int)t_count; ++i) {
+        hash_set_insert(phset, i * 64);
+    }
+    printf("int    %-10s insert %8.3fs", s_name, _bench_elapsed(t_start));
+
+    t_start = clock();
+    for (i = 0; i < (int)t_count; ++i) {
+        if (!iterator_equal(hash_set_find(phset, i * 64), hash_set_end(phset))) {
+            ++t_found;
+        }
+    }
+    printf("  find %8.3fs  found %u/%u\n", _bench_elapsed(t_start), (unsigned)t_found, (unsigned)t_count);
+
+    hash_set_destroy(phset);
+}
+
+static void _bench_cstr(const char* s_name, ufun_t ufun_hash, size_t t_count)
+{
+    hash_set_t* phset = create_hash_set(char*);
+    char*       pc_keys = (char*)malloc(t_count * _BENCH_KEY_LEN);
+    clock_t     t_start = 0;
+    size_t      t_found = 0;
+    size_t      i = 0;
+
+    for (i = 0; i < t_count; ++i) {
+        sprintf(pc_keys + i * _BENCH_KEY_LEN, "key_%010u", (unsigned)i);
+    }
+
+    hash_set_init_ex(phset, 0, ufun_hash, NULL);
+    t_start = clock();
+    for (i = 0; i < t_count; ++i) {
+        hash_set_insert(phset, pc_keys + i * _BENCH_KEY_LEN);
+    }
+    printf("char*  %-10s insert %8.3fs", s_name, _bench_elapsed(t_start));
+
+    t_start = clock();
+    for (i = 0; i < t_count; ++i) {
+        if (!iterator_equal(hash_set_find(phset, pc_keys + i * _BENCH_KEY_LEN), hash_set_end(phset))) {
+            ++t_found;
+        }
+    }
+    printf("  find %8.3fs  found %u/%u\n", _bench_elapsed(t_start), (unsigned)t_found, (unsigned)t_count);
+
+    hash_set_destroy(phset);
+    free(pc_keys);
+}
+
+int main(int argc, char* argv[])
+{
+    size_t t_count = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : _BENCH_DEFAULT_COUNT;
+
+    _bench_int("byte-sum", _bench_byte_sum_hash, t_count);
+    _bench_int("default", NULL, t_count);
+    _bench_cstr("byte-sum", _bench_byte_sum_hash, t_count);
+    _bench_cstr("default", NULL, t_count);
+
+    return 0;
+}
+
+/** eof **/
@@ -0,0 +1,141 @@
+/*
+ *  The benchmark of inserting elements at the back of sequence containers.
+ *  Copyright (C)  2008 - 2014  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+/*
+ * Fill vector, deque and list of int and of char* with push_back and clear them
+ * again. Every push_back resolves the element type of the varg, so this measures
+ * the per element type dispatch as much as the container itself. Build libcstl
+ * with CFLAGS="-O2 -DNDEBUG", the debug assertions dominate the result otherwise:
+ *
+ *     cc -O2 -I/usr/local/include bench_push_back.c -L/usr/local/lib -lcstl -o bench_push_back
+ *     ./bench_push_back [element count]
+ */
+
+/** include section **/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <cstl/cvector.h>
+#include <cstl/cdeque.h>
+#include <cstl/clist.h>
+
+/** local constant declaration and local macro section **/
+#define _BENCH_DEFAULT_ELEM   1000000
+#define _BENCH_ROUND_COUNT    5
+#define _BENCH_STRING_DIVISOR 10
+
+/** local function implementation section **/
+static double _bench_now(void)
+{
+    struct timespec t_now;
+
+    clock_gettime(CLOCK_MONOTONIC, &t_now);
+    return t_now.tv_sec + t_now.tv_nsec / 1e9;
+}
+
+static void _bench_report(const char* s_name, double d_elapse, size_t t_count)
+{
+    printf("%-24s %8.3f s %8.1f ns/elem\n", s_name, d_elapse, d_elapse * 1e9 / t_count);
+}
+
+int main(int argc, char* argv[])
+{
+    size_t    t_count = _BENCH_DEFAULT_ELEM;
+    size_t    t_strcount = 0;
+    size_t    i = 0;
+    size_t    j = 0;
+    double    d_start = 0.0;
+    vector_t* pvec_int = create_vector(int);
+    deque_t*  pdeq_int = create_deque(int);
+    list_t*   plist_int = create_list(int);
+    vector_t* pvec_str = create_vector(char*);
+    list_t*   plist_str = create_list(char*);
+
+    if (argc > 1) {
+        t_count = (size_t)strtoul(argv[1], NULL, 10);
+    }
+    if (t_count == 0) {
+        return EXIT_FAILURE;
+    }
+    t_strcount = t_count / _BENCH_STRING_DIVISOR + 1;
+
+    vector_init(pvec_int);
+    deque_init(pdeq_int);
+    list_init(plist_int);
+    vector_init(pvec_str);
+    list_init(plist_str);
+
+    d_start = _bench_now();
+    for (i = 0; i < _BENCH_ROUND_COUNT; ++i) {
+        for (j = 0; j < t_count; ++j) {
+            vector_push_back(pvec_int, (int)j);
+        }
+        vector_clear(pvec_int);
+    }
+    _bench_report("vector<int>", _bench_now() - d_start, t_count * _BENCH_ROUND_COUNT);
+
+    d_start = _bench_now();
+    for (i = 0; i < _BENCH_ROUND_COUNT; ++i) {
+        for (j = 0; j < t_count; ++j) {
+            deque_push_back(pdeq_int, (int)j);
+        }
+        deque_clear(pdeq_int);
+    }
+    _bench_report("deque<int>", _bench_now() - d_start, t_count * _BENCH_ROUND_COUNT);
+
+    d_start = _bench_now();
+    for (i = 0; i < _BENCH_ROUND_COUNT; ++i) {
+        for (j = 0; j < t_count; ++j) {
+            list_push_back(plist_int, (int)j);
+        }
+        list_clear(plist_int);
+    }
+    _bench_report("list<int>", _bench_now() - d_start, t_count * _BENCH_ROUND_COUNT);
+
+    d_start = _bench_now();
+    for (i = 0; i < _BENCH_ROUND_COUNT; ++i) {
+        for (j = 0; j < t_strcount; ++j) {
+            vector_push_back(pvec_str, "libcstl");
+        }
+        vector_clear(pvec_str);
+    }
+    _bench_report("vector<char*>", _bench_now() - d_start, t_strcount * _BENCH_ROUND_COUNT);
+
+    d_start = _bench_now();
+    for (i = 0; i < _BENCH_ROUND_COUNT; ++i) {
+        for (j = 0; j < t_strcount; ++j) {
+            list_push_back(plist_str, "libcstl");
+        }
+        list_clear(plist_str);
+    }
+    _bench_report("list<char*>", _bench_now() - d_start, t_strcount * _BENCH_ROUND_COUNT);
+
+    vector_destroy(pvec_int);
+    deque_destroy(pdeq_int);
+    list_destroy(plist_int);
+    vector_destroy(pvec_str);
+    list_destroy(plist_str);
+
+    return 0;
+}
+
+/** eof **/
@@ -732,6 +732,52 @@ void test_algo_swap_algo_iter_swap__cstl_builtin(void** state)
     set_destroy(pset);
 }
 
+void test_algo_swap_algo_iter_swap__cstl_builtin_relocate(void** state)
+{
+    vector_t* pvec = create_vector(map_t<int, int>);
+    list_t* plist = create_list(deque_t<int>);
+    deque_t* pdeq = create_deque(deque_t<int>);
+    map_t* pmap = create_map(int, int);
+    deque_t* pdeq_elem = create_deque(int);
+    iterator_t it_first;
+    iterator_t it_second;
+
+    vector_init(pvec);
+    map_init(pmap);
+    vector_push_back(pvec, pmap);
+    *(int*)map_at(pmap, 1) = 10;
+    vector_push_back(pvec, pmap);
+    it_first = vector_begin(pvec);
+    it_second = iterator_next(it_first);
+    algo_iter_swap(it_first, it_second);
+    assert_true(map_size((map_t*)iterator_get_pointer(it_first)) == 1);
+    assert_true(map_size((map_t*)iterator_get_pointer(it_second)) == 0);
+    *(int*)map_at((map_t*)iterator_get_pointer(it_first), 2) = 20;
+    *(int*)map_at((map_t*)iterator_get_pointer(it_second), 3) = 30;
+    assert_true(map_size((map_t*)iterator_get_pointer(it_first)) == 2);
+    assert_true(map_size((map_t*)iterator_get_pointer(it_second)) == 1);
+
+    list_init(plist);
+    deque_init(pdeq);
+    deque_init_n(pdeq_elem, 5);
+    list_push_back(plist, pdeq_elem);
+    deque_clear(pdeq_elem);
+    deque_push_back(pdeq, pdeq_elem);
+    algo_iter_swap(list_begin(plist), deque_begin(pdeq));
+    assert_true(deque_empty((deque_t*)iterator_get_pointer(list_begin(plist))));
+    assert_true(deque_size((deque_t*)iterator_get_pointer(deque_begin(pdeq))) == 5);
+    deque_push_back((deque_t*)iterator_get_pointer(list_begin(plist)), 1);
+    deque_push_front((deque_t*)iterator_get_pointer(deque_begin(pdeq)), 1);
+    assert_true(deque_size((deque_t*)iterator_get_pointer(list_begin(plist))) == 1);
+    assert_true(deque_size((deque_t*)iterator_get_pointer(deque_begin(pdeq))) == 6);
+
+    vector_destroy(pvec);
+    list_destroy(plist);
+    deque_destroy(pdeq);
+    map_destroy(pmap);
+    deque_destroy(pdeq_elem);
+}
+
 typedef struct _tag_test_algo_swap_algo_iter_swap__user_define {
     int a;
     int b;
@@ -59,6 +59,7 @@ void test_algo_swap_algo_iter_swap__not_same_type(void** state);
 void test_algo_swap_algo_iter_swap__c_builtin(void** state);
 void test_algo_swap_algo_iter_swap__cstr(void** state);
 void test_algo_swap_algo_iter_swap__cstl_builtin(void** state);
+void test_algo_swap_algo_iter_swap__cstl_builtin_relocate(void** state);
 void test_algo_swap_algo_iter_swap__user_define(void** state);
 /*
  * test algo_swap_ranges
@@ -444,6 +445,7 @@ void test_algo_stable_partition__normal(void** state);
     UT_CASE(test_algo_swap_algo_iter_swap__c_builtin),\
     UT_CASE(test_algo_swap_algo_iter_swap__cstr),\
     UT_CASE(test_algo_swap_algo_iter_swap__cstl_builtin),\
+    UT_CASE(test_algo_swap_algo_iter_swap__cstl_builtin_relocate),\
     UT_CASE(test_algo_swap_algo_iter_swap__user_define),\
     UT_CASE_BEGIN(algo_swap_ranges, test_algo_swap_ranges__invalid_first_range),\
     UT_CASE(test_algo_swap_ranges__invalid_first_range2),\
@@ -17,6 +17,7 @@
 #include "cstl/calgorithm.h"
 #include "cstl/cfunctional.h"
 #include "cstl_algo_sorting_aux.h"
+#include "cstl_types_builtin.h"
 
 #include "ut_def.h"
 #include "ut_cstl_algo_sorting_aux.h"
@@ -767,3 +768,58 @@ void test__algo_intro_sort_if__cstr_sorted(void** state)
     string_destroy(pstr);
 }
 
+/*
+ * test _algo_three_way_compare_if
+ */
+UT_CASE_DEFINATION(_algo_three_way_compare_if)
+void test__algo_three_way_compare_if__bfun_NULL(void** state)
+{
+    deque_t* pdeq = create_deque(int);
+    deque_init_n(pdeq, 2);
+    expect_assert_failure(_algo_three_way_compare_if(deque_begin(pdeq), deque_begin(pdeq), NULL, NULL));
+    deque_destroy(pdeq);
+}
+
+void test__algo_three_way_compare_if__less(void** state)
+{
+    deque_t* pdeq = create_deque(int);
+    int an_array[] = {1, 5, 5};
+    iterator_t it_iter;
+
+    deque_init_copy_array(pdeq, an_array, sizeof(an_array)/sizeof(an_array[0]));
+    it_iter = iterator_next(deque_begin(pdeq));
+    assert_true(_algo_three_way_compare_if(deque_begin(pdeq), it_iter, fun_less_int, NULL) < 0);
+    assert_true(_algo_three_way_compare_if(it_iter, deque_begin(pdeq), fun_less_int, NULL) > 0);
+    assert_true(_algo_three_way_compare_if(it_iter, iterator_next(it_iter), fun_less_int, NULL) == 0);
+    deque_destroy(pdeq);
+}
+
+void test__algo_three_way_compare_if__compare(void** state)
+{
+    deque_t* pdeq = create_deque(int);
+    int an_array[] = {1, 5, 5};
+    iterator_t it_iter;
+
+    deque_init_copy_array(pdeq, an_array, sizeof(an_array)/sizeof(an_array[0]));
+    it_iter = iterator_next(deque_begin(pdeq));
+    assert_true(_algo_three_way_compare_if(deque_begin(pdeq), it_iter, fun_less_int, _type_compare_int) < 0);
+    assert_true(_algo_three_way_compare_if(it_iter, deque_begin(pdeq), fun_less_int, _type_compare_int) > 0);
+    assert_true(_algo_three_way_compare_if(it_iter, iterator_next(it_iter), fun_less_int, _type_compare_int) == 0);
+    deque_destroy(pdeq);
+}
+
+void test__algo_three_way_compare_if__cstr(void** state)
+{
+    deque_t* pdeq = create_deque(char*);
+    const char* as_array[] = {"abc", "xyz", "xyz"};
+    iterator_t it_iter;
+
+    deque_init_copy_array(pdeq, as_array, sizeof(as_array)/sizeof(as_array[0]));
+    it_iter = iterator_next(deque_begin(pdeq));
+    assert_true(_algo_three_way_compare_if(deque_begin(pdeq), it_iter, fun_less_cstr, NULL) < 0);
+    assert_true(_algo_three_way_compare_if(deque_begin(pdeq), it_iter, fun_less_cstr, _type_compare_cstr) < 0);
+    assert_true(_algo_three_way_compare_if(it_iter, deque_begin(pdeq), fun_less_cstr, _type_compare_cstr) > 0);
+    assert_true(_algo_three_way_compare_if(it_iter, iterator_next(it_iter), fun_less_cstr, _type_compare_cstr) == 0);
+    deque_destroy(pdeq);
+}
+
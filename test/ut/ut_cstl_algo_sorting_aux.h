@@ -71,6 +71,14 @@ void test__algo_intro_sort_if__cstr_normal(void** state);
 void test__algo_intro_sort_if__cstr_duplicate(void** state);
 void test__algo_intro_sort_if__cstr_equal(void** state);
 void test__algo_intro_sort_if__cstr_sorted(void** state);
+/*
+ * test _algo_three_way_compare_if
+ */
+UT_CASE_DECLARATION(_algo_three_way_compare_if)
+void test__algo_three_way_compare_if__bfun_NULL(void** state);
+void test__algo_three_way_compare_if__less(void** state);
+void test__algo_three_way_compare_if__compare(void** state);
+void test__algo_three_way_compare_if__cstr(void** state);
 
 #define UT_CSTL_ALGO_SORTING_AUX_CASE\
     UT_SUIT_BEGIN(cstl_algo_sorting_aux, test__algo_lg__0),\
@@ -124,7 +132,11 @@ void test__algo_intro_sort_if__cstr_sorted(void** state);
     UT_CASE(test__algo_intro_sort_if__cstr_normal),\
     UT_CASE(test__algo_intro_sort_if__cstr_duplicate),\
     UT_CASE(test__algo_intro_sort_if__cstr_equal),\
-    UT_CASE(test__algo_intro_sort_if__cstr_sorted)
+    UT_CASE(test__algo_intro_sort_if__cstr_sorted),\
+    UT_CASE_BEGIN(_algo_three_way_compare_if, test__algo_three_way_compare_if__bfun_NULL),\
+    UT_CASE(test__algo_three_way_compare_if__less),\
+    UT_CASE(test__algo_three_way_compare_if__compare),\
+    UT_CASE(test__algo_three_way_compare_if__cstr)
 
 #endif /* _UT_CSTL_ALGO_SORTING_AUX_H_ */
 
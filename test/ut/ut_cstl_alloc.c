@@ -25,7 +25,7 @@ void test__alloc_init__invalid_allocator(void** state)
 
 void test__alloc_init__success(void** state)
 {
-#ifdef CSTL_MEMORY_MANAGEMENT
+#if defined(CSTL_MEMORY_MANAGEMENT) && !defined(CSTL_MEMORY_SHARED_POOL)
     size_t i = 0;
     _alloc_t allocator;
     _alloc_init(&allocator);
@@ -59,7 +59,7 @@ void test__alloc_destroy__invalid_allocator(void** state)
 
 void test__alloc_destroy__success(void** state)
 {
-#ifdef CSTL_MEMORY_MANAGEMENT
+#if defined(CSTL_MEMORY_MANAGEMENT) && !defined(CSTL_MEMORY_SHARED_POOL)
     size_t i = 0;
     _alloc_t allocator;
     _alloc_init(&allocator);
@@ -93,24 +93,28 @@ void test__alloc_destroy__success(void** state)
 
 void test__alloc_destroy__success_after_allocate(void** state)
 {
-#ifdef CSTL_MEMORY_MANAGEMENT
+#if defined(CSTL_MEMORY_MANAGEMENT) && !defined(CSTL_MEMORY_SHARED_POOL)
     size_t i = 0;
     void* pv_mem = NULL;
+    _byte_t* pby_pool = NULL;
+    size_t t_chunksize = _MEM_ROUND_UP(8) * _MEM_CHUNK_COUNT;
     _alloc_t allocator;
     _alloc_init(&allocator);
     pv_mem = _alloc_allocate(&allocator, 8, 1);
+    /* the memory pool is aligned to the boundary of small memory block */
+    pby_pool = (_byte_t*)_MEM_ROUND_UP((size_t)allocator._ppby_mempoolcontainer[0]);
 
     assert_true(pv_mem != NULL);
-    assert_true(allocator._pby_mempool == allocator._ppby_mempoolcontainer[0] + 128);
-    assert_true(allocator._t_mempoolsize == 128);
+    assert_true(allocator._pby_mempool == pby_pool + t_chunksize);
+    assert_true(allocator._t_mempoolsize == t_chunksize);
     assert_true(allocator._t_mempoolindex == 1);
     assert_true(allocator._t_mempoolcount == _MEM_POOL_DEFAULT_COUNT);
-    assert_true(allocator._ppby_mempoolcontainer[0] == pv_mem);
+    assert_true(pby_pool == pv_mem);
     for(i = 0; i < _MEM_LINK_COUNT; ++i)
     {
         if(i == _MEM_LINK_INDEX(8))
         {
-            assert_true(allocator._apt_memlink[i] == (_memlink_t*)((_byte_t*)pv_mem + 8));
+            assert_true(allocator._apt_memlink[i] == (_memlink_t*)((_byte_t*)pv_mem + _MEM_ROUND_UP(8)));
         }
         else
         {
@@ -149,7 +153,7 @@ void test__alloc_allocate__invalid_alocator(void** state)
 
 void test__alloc_allocate__greater_than_max_small_memory(void** state)
 {
-#ifdef CSTL_MEMORY_MANAGEMENT
+#if defined(CSTL_MEMORY_MANAGEMENT) && !defined(CSTL_MEMORY_SHARED_POOL)
     size_t i = 0;
     void* pv_mem = NULL;
     _alloc_t allocator;
@@ -173,7 +177,7 @@ void test__alloc_allocate__greater_than_max_small_memory(void** state)
     }
 
     _alloc_destroy(&allocator);
-#else
+#elif !defined(CSTL_MEMORY_MANAGEMENT)
     void* pv_mem = _alloc_allocate(NULL, 128, 2);
     assert_true(pv_mem != NULL);
     _alloc_deallocate(NULL, pv_mem, 128, 2);
@@ -182,23 +186,27 @@ void test__alloc_allocate__greater_than_max_small_memory(void** state)
 
 void test__alloc_allocate__less_than_max_small_memory(void** state)
 {
-#ifdef CSTL_MEMORY_MANAGEMENT
+#if defined(CSTL_MEMORY_MANAGEMENT) && !defined(CSTL_MEMORY_SHARED_POOL)
     size_t i = 0;
     void* pv_mem = NULL;
+    _byte_t* pby_pool = NULL;
+    size_t t_chunksize = _MEM_ROUND_UP(8) * _MEM_CHUNK_COUNT;
     _alloc_t allocator;
     _alloc_init(&allocator);
     pv_mem = _alloc_allocate(&allocator, 8, 1);
+    /* the memory pool is aligned to the boundary of small memory block */
+    pby_pool = (_byte_t*)_MEM_ROUND_UP((size_t)allocator._ppby_mempoolcontainer[0]);
 
-    assert_true(allocator._pby_mempool == allocator._ppby_mempoolcontainer[0] + 128);
-    assert_true(allocator._t_mempoolsize == 128);
+    assert_true(allocator._pby_mempool == pby_pool + t_chunksize);
+    assert_true(allocator._t_mempoolsize == t_chunksize);
     assert_true(allocator._t_mempoolindex == 1);
     assert_true(allocator._t_mempoolcount == _MEM_POOL_DEFAULT_COUNT);
-    assert_true(allocator._ppby_mempoolcontainer[0] == pv_mem);
+    assert_true(pby_pool == pv_mem);
     for(i = 0; i < _MEM_LINK_COUNT; ++i)
     {
         if(i == _MEM_LINK_INDEX(8))
         {
-            assert_true(allocator._apt_memlink[i] == (_memlink_t*)((_byte_t*)pv_mem + 8));
+            assert_true(allocator._apt_memlink[i] == (_memlink_t*)((_byte_t*)pv_mem + _MEM_ROUND_UP(8)));
         }
         else
         {
@@ -208,7 +216,7 @@ void test__alloc_allocate__less_than_max_small_memory(void** state)
     assert_true(allocator._ppby_mempoolcontainer != NULL);
 
     _alloc_destroy(&allocator);
-#else
+#elif !defined(CSTL_MEMORY_MANAGEMENT)
     void* pv_mem = _alloc_allocate(NULL, 8, 1);
     assert_true(pv_mem != NULL);
     _alloc_deallocate(NULL, pv_mem, 8, 1);
@@ -251,7 +259,7 @@ void test__alloc_deallocate__invalid_allocated_memory(void** state)
 
 void test__alloc_deallocate__greater_than_max_small_memory(void** state)
 {
-#ifdef CSTL_MEMORY_MANAGEMENT
+#if defined(CSTL_MEMORY_MANAGEMENT) && !defined(CSTL_MEMORY_SHARED_POOL)
     size_t i = 0;
     void* pv_mem = NULL;
     _alloc_t allocator;
@@ -291,7 +299,7 @@ void test__alloc_deallocate__greater_than_max_small_memory(void** state)
     }
 
     _alloc_destroy(&allocator);
-#else
+#elif !defined(CSTL_MEMORY_MANAGEMENT)
     void* pv_mem = _alloc_allocate(NULL, 128, 2);
     assert_true(pv_mem != NULL);
     _alloc_deallocate(NULL, pv_mem, 128, 2);
@@ -300,23 +308,27 @@ void test__alloc_deallocate__greater_than_max_small_memory(void** state)
 
 void test__alloc_deallocate__less_than_max_small_memory(void** state)
 {
-#ifdef CSTL_MEMORY_MANAGEMENT
+#if defined(CSTL_MEMORY_MANAGEMENT) && !defined(CSTL_MEMORY_SHARED_POOL)
     size_t i = 0;
     void* pv_mem = NULL;
+    _byte_t* pby_pool = NULL;
+    size_t t_chunksize = _MEM_ROUND_UP(8) * _MEM_CHUNK_COUNT;
     _alloc_t allocator;
     _alloc_init(&allocator);
     pv_mem = _alloc_allocate(&allocator, 8, 1);
+    /* the memory pool is aligned to the boundary of small memory block */
+    pby_pool = (_byte_t*)_MEM_ROUND_UP((size_t)allocator._ppby_mempoolcontainer[0]);
 
-    assert_true(allocator._pby_mempool == allocator._ppby_mempoolcontainer[0] + 128);
-    assert_true(allocator._t_mempoolsize == 128);
+    assert_true(allocator._pby_mempool == pby_pool + t_chunksize);
+    assert_true(allocator._t_mempoolsize == t_chunksize);
     assert_true(allocator._t_mempoolindex == 1);
     assert_true(allocator._t_mempoolcount == _MEM_POOL_DEFAULT_COUNT);
-    assert_true(allocator._ppby_mempoolcontainer[0] == pv_mem);
+    assert_true(pby_pool == pv_mem);
     for(i = 0; i < _MEM_LINK_COUNT; ++i)
     {
         if(i == _MEM_LINK_INDEX(8))
         {
-            assert_true(allocator._apt_memlink[i] == (_memlink_t*)((_byte_t*)pv_mem + 8));
+            assert_true(allocator._apt_memlink[i] == (_memlink_t*)((_byte_t*)pv_mem + _MEM_ROUND_UP(8)));
         }
         else
         {
@@ -327,16 +339,16 @@ void test__alloc_deallocate__less_than_max_small_memory(void** state)
 
     _alloc_deallocate(&allocator, pv_mem, 8, 1);
 
-    assert_true(allocator._pby_mempool == allocator._ppby_mempoolcontainer[0] + 128);
-    assert_true(allocator._t_mempoolsize == 128);
+    assert_true(allocator._pby_mempool == pby_pool + t_chunksize);
+    assert_true(allocator._t_mempoolsize == t_chunksize);
     assert_true(allocator._t_mempoolindex == 1);
     assert_true(allocator._t_mempoolcount == _MEM_POOL_DEFAULT_COUNT);
-    assert_true(allocator._ppby_mempoolcontainer[0] == (_byte_t*)allocator._apt_memlink[_MEM_LINK_INDEX(8)]);
+    assert_true(pby_pool == (_byte_t*)allocator._apt_memlink[_MEM_LINK_INDEX(8)]);
     for(i = 0; i < _MEM_LINK_COUNT; ++i)
     {
         if(i == _MEM_LINK_INDEX(8))
         {
-            assert_true((_byte_t*)allocator._apt_memlink[i] == allocator._ppby_mempoolcontainer[0]);
+            assert_true((_byte_t*)allocator._apt_memlink[i] == pby_pool);
         }
         else
         {
@@ -346,13 +358,505 @@ void test__alloc_deallocate__less_than_max_small_memory(void** state)
     assert_true(allocator._ppby_mempoolcontainer != NULL);
 
     _alloc_destroy(&allocator);
-#else
+#elif !defined(CSTL_MEMORY_MANAGEMENT)
     void* pv_mem = _alloc_allocate(NULL, 8, 1);
     assert_true(pv_mem != NULL);
     _alloc_deallocate(NULL, pv_mem, 8, 1);
 #endif
 }
 
+void test__alloc_deallocate__reuse_by_other_allocator(void** state)
+{
+#ifdef CSTL_MEMORY_MANAGEMENT
+    void* pv_first = NULL;
+    void* pv_second = NULL;
+    _alloc_t t_first;
+    _alloc_t t_second;
+    _alloc_init(&t_first);
+    _alloc_init(&t_second);
+
+    pv_first = _alloc_allocate(&t_first, 24, 1);
+    _alloc_deallocate(&t_first, pv_first, 24, 1);
+    pv_second = _alloc_allocate(&t_second, 24, 1);
+#ifdef CSTL_MEMORY_SHARED_POOL
+    /* the memory released by one allocator is reused by other allocator */
+    assert_true(pv_second == pv_first);
+#else
+    assert_true(pv_second != pv_first);
+#endif
+    _alloc_deallocate(&t_second, pv_second, 24, 1);
+
+    _alloc_destroy(&t_first);
+    _alloc_destroy(&t_second);
+#endif
+}
+
+/*
+ * test _alloc_set_allocator
+ */
+UT_CASE_DEFINATION(_alloc_set_allocator)
+static void* _alloc_set_allocator__allocate(void* pv_context, size_t t_size)
+{
+    ((size_t*)pv_context)[0] += t_size;
+    return malloc(t_size);
+}
+
+static void _alloc_set_allocator__deallocate(void* pv_context, void* pv_mem, size_t t_size)
+{
+    ((size_t*)pv_context)[1] += t_size;
+    free(pv_mem);
+}
+
+void test__alloc_set_allocator__null_allocator(void** state)
+{
+    allocator_t t_custom = {_alloc_set_allocator__allocate, _alloc_set_allocator__deallocate, NULL};
+    expect_assert_failure(_alloc_set_allocator(NULL, &t_custom));
+}
+
+void test__alloc_set_allocator__null_custom_allocator(void** state)
+{
+    _alloc_t t_allocator;
+    _alloc_init(&t_allocator);
+
+    expect_assert_failure(_alloc_set_allocator(&t_allocator, NULL));
+
+    _alloc_destroy(&t_allocator);
+}
+
+void test__alloc_set_allocator__null_custom_function(void** state)
+{
+    allocator_t t_custom = {_alloc_set_allocator__allocate, NULL, NULL};
+    _alloc_t t_allocator;
+    _alloc_init(&t_allocator);
+
+    expect_assert_failure(_alloc_set_allocator(&t_allocator, &t_custom));
+    t_custom._pfun_allocate = NULL;
+    t_custom._pfun_deallocate = _alloc_set_allocator__deallocate;
+    expect_assert_failure(_alloc_set_allocator(&t_allocator, &t_custom));
+
+    _alloc_destroy(&t_allocator);
+}
+
+void test__alloc_set_allocator__successfully(void** state)
+{
+    size_t at_size[2] = {0, 0};
+    allocator_t t_custom = {_alloc_set_allocator__allocate, _alloc_set_allocator__deallocate, NULL};
+    _alloc_t t_allocator;
+    _alloc_init(&t_allocator);
+
+    t_custom._pv_context = at_size;
+    _alloc_set_allocator(&t_allocator, &t_custom);
+    assert_true(_alloc_is_inited(&t_allocator));
+    assert_true(t_allocator._pt_ext->_t_custom._pfun_allocate == _alloc_set_allocator__allocate);
+    assert_true(t_allocator._pt_ext->_t_custom._pfun_deallocate == _alloc_set_allocator__deallocate);
+    assert_true(t_allocator._pt_ext->_t_custom._pv_context == at_size);
+#if defined(CSTL_MEMORY_MANAGEMENT) && !defined(CSTL_MEMORY_SHARED_POOL)
+    assert_true(t_allocator._ppby_mempoolcontainer == NULL);
+    assert_true(t_allocator._t_mempoolcount == 0);
+#endif
+
+    _alloc_destroy(&t_allocator);
+}
+
+void test__alloc_set_allocator__allocate_by_custom_allocator(void** state)
+{
+    size_t at_size[2] = {0, 0};
+    allocator_t t_custom = {_alloc_set_allocator__allocate, _alloc_set_allocator__deallocate, NULL};
+    void* pv_small = NULL;
+    void* pv_large = NULL;
+    _alloc_t t_allocator;
+    _alloc_init(&t_allocator);
+
+    t_custom._pv_context = at_size;
+    _alloc_set_allocator(&t_allocator, &t_custom);
+    pv_small = _alloc_allocate(&t_allocator, 8, 3);
+    pv_large = _alloc_allocate(&t_allocator, 1024, 100);
+    assert_true(pv_small != NULL && pv_large != NULL);
+    assert_true(at_size[0] == 8 * 3 + 1024 * 100);
+    assert_true(at_size[1] == 0);
+#ifdef CSTL_MEMORY_MANAGEMENT
+    assert_true(_alloc_is_inited(&t_allocator));
+#endif
+
+    _alloc_deallocate(&t_allocator, pv_small, 8, 3);
+    _alloc_deallocate(&t_allocator, pv_large, 1024, 100);
+    assert_true(at_size[1] == at_size[0]);
+
+    _alloc_destroy(&t_allocator);
+}
+
+void test__alloc_set_allocator__region_allocator(void** state)
+{
+    allocator_t t_custom = {_alloc_set_allocator__allocate, _alloc_set_allocator__deallocate, NULL};
+    _alloc_t t_allocator;
+    _alloc_init(&t_allocator);
+
+    _alloc_set_region(&t_allocator);
+    expect_assert_failure(_alloc_set_allocator(&t_allocator, &t_custom));
+
+    _alloc_destroy(&t_allocator);
+}
+
+/*
+ * test _alloc_set_region
+ */
+UT_CASE_DEFINATION(_alloc_set_region)
+void test__alloc_set_region__null_allocator(void** state)
+{
+    expect_assert_failure(_alloc_set_region(NULL));
+}
+
+void test__alloc_set_region__custom_allocator(void** state)
+{
+    size_t at_size[2] = {0, 0};
+    allocator_t t_custom = {_alloc_set_allocator__allocate, _alloc_set_allocator__deallocate, NULL};
+    _alloc_t t_allocator;
+    _alloc_init(&t_allocator);
+
+    t_custom._pv_context = at_size;
+    _alloc_set_allocator(&t_allocator, &t_custom);
+    expect_assert_failure(_alloc_set_region(&t_allocator));
+
+    _alloc_destroy(&t_allocator);
+}
+
+void test__alloc_set_region__successfully(void** state)
+{
+    _alloc_t t_allocator;
+    _alloc_init(&t_allocator);
+
+    assert_true(t_allocator._pt_ext == NULL);
+    _alloc_set_region(&t_allocator);
+    assert_true(t_allocator._pt_ext->_b_region);
+    assert_true(t_allocator._pt_ext->_pby_regionblock == NULL);
+    assert_true(t_allocator._pt_ext->_pby_regionpos == NULL);
+    assert_true(t_allocator._pt_ext->_pby_regionend == NULL);
+#if defined(CSTL_MEMORY_MANAGEMENT) && !defined(CSTL_MEMORY_SHARED_POOL)
+    assert_true(t_allocator._ppby_mempoolcontainer == NULL);
+    assert_true(t_allocator._t_mempoolcount == 0);
+#endif
+    assert_true(_alloc_is_inited(&t_allocator));
+
+    _alloc_destroy(&t_allocator);
+}
+
+void test__alloc_set_region__allocate_from_region(void** state)
+{
+    _byte_t* pby_first = NULL;
+    _byte_t* pby_second = NULL;
+    _byte_t* pby_large = NULL;
+    _alloc_t t_allocator;
+    _alloc_init(&t_allocator);
+
+    _alloc_set_region(&t_allocator);
+    pby_first = (_byte_t*)_alloc_allocate(&t_allocator, 8, 3);
+    pby_second = (_byte_t*)_alloc_allocate(&t_allocator, 8, 1);
+    assert_true(pby_second == pby_first + _MEM_REGION_ROUND_UP(24));
+    assert_true((size_t)pby_first % _MEM_REGION_ALIGNMENT == 0);
+    assert_true(t_allocator._pt_ext->_pby_regionpos == pby_second + _MEM_REGION_ROUND_UP(8));
+
+    /* the large memory does not change the current block */
+    pby_large = (_byte_t*)_alloc_allocate(&t_allocator, _MEM_REGION_BLOCK_SIZE, 2);
+    assert_true(pby_large != NULL);
+    memset(pby_large, 0xff, _MEM_REGION_BLOCK_SIZE * 2);
+    assert_true(t_allocator._pt_ext->_pby_regionpos == pby_second + _MEM_REGION_ROUND_UP(8));
+
+    /* deallocate does nothing */
+    _alloc_deallocate(&t_allocator, pby_second, 8, 1);
+    assert_true(t_allocator._pt_ext->_pby_regionpos == pby_second + _MEM_REGION_ROUND_UP(8));
+    assert_true(_alloc_allocate(&t_allocator, 8, 1) == pby_second + _MEM_REGION_ROUND_UP(8));
+
+    _alloc_destroy(&t_allocator);
+    assert_true(t_allocator._pt_ext == NULL);
+}
+
+/*
+ * test _alloc_is_region
+ */
+UT_CASE_DEFINATION(_alloc_is_region)
+void test__alloc_is_region__null_allocator(void** state)
+{
+    expect_assert_failure(_alloc_is_region(NULL));
+}
+
+void test__alloc_is_region__not_region(void** state)
+{
+    _alloc_t t_allocator;
+    _alloc_init(&t_allocator);
+
+    assert_false(_alloc_is_region(&t_allocator));
+
+    _alloc_destroy(&t_allocator);
+}
+
+void test__alloc_is_region__region(void** state)
+{
+    _alloc_t t_allocator;
+    _alloc_init(&t_allocator);
+
+    _alloc_set_region(&t_allocator);
+    assert_true(_alloc_is_region(&t_allocator));
+
+    _alloc_destroy(&t_allocator);
+}
+
+/*
+ * test _alloc_release_region
+ */
+UT_CASE_DEFINATION(_alloc_release_region)
+void test__alloc_release_region__null_allocator(void** state)
+{
+    expect_assert_failure(_alloc_release_region(NULL));
+}
+
+void test__alloc_release_region__not_region(void** state)
+{
+    void* pv_mem = NULL;
+    _alloc_t t_allocator;
+    _alloc_init(&t_allocator);
+
+    pv_mem = _alloc_allocate(&t_allocator, 8, 1);
+    _alloc_release_region(&t_allocator);
+    assert_false(_alloc_is_region(&t_allocator));
+    _alloc_deallocate(&t_allocator, pv_mem, 8, 1);
+
+    _alloc_destroy(&t_allocator);
+}
+
+void test__alloc_release_region__empty(void** state)
+{
+    _alloc_t t_allocator;
+    _alloc_init(&t_allocator);
+
+    _alloc_set_region(&t_allocator);
+    _alloc_release_region(&t_allocator);
+    assert_true(_alloc_is_region(&t_allocator));
+    assert_true(_alloc_is_inited(&t_allocator));
+
+    _alloc_destroy(&t_allocator);
+}
+
+void test__alloc_release_region__successfully(void** state)
+{
+    size_t i = 0;
+    _alloc_t t_allocator;
+    _alloc_init(&t_allocator);
+
+    _alloc_set_region(&t_allocator);
+    for (i = 0; i < 1000; ++i) {
+        assert_true(_alloc_allocate(&t_allocator, 24, 1) != NULL);
+    }
+    assert_true(_alloc_allocate(&t_allocator, _MEM_REGION_BLOCK_SIZE, 1) != NULL);
+    assert_true(t_allocator._pt_ext->_pby_regionblock != NULL);
+
+    _alloc_release_region(&t_allocator);
+    assert_true(_alloc_is_region(&t_allocator));
+    assert_true(t_allocator._pt_ext->_pby_regionblock == NULL);
+    assert_true(t_allocator._pt_ext->_pby_regionpos == NULL);
+    assert_true(t_allocator._pt_ext->_pby_regionend == NULL);
+    assert_true(_alloc_allocate(&t_allocator, 24, 1) != NULL);
+
+    _alloc_destroy(&t_allocator);
+}
+
+/*
+ * test _alloc_get_stat
+ */
+UT_CASE_DEFINATION(_alloc_get_stat)
+void test__alloc_get_stat__null_allocator(void** state)
+{
+    _allocstat_t t_stat;
+
+    expect_assert_failure(_alloc_get_stat(NULL, &t_stat));
+}
+
+void test__alloc_get_stat__null_stat(void** state)
+{
+    _alloc_t t_allocator;
+    _alloc_init(&t_allocator);
+
+    expect_assert_failure(_alloc_get_stat(&t_allocator, NULL));
+
+    _alloc_destroy(&t_allocator);
+}
+
+void test__alloc_get_stat__init(void** state)
+{
+    _allocstat_t t_stat;
+    _alloc_t t_allocator;
+    _alloc_init(&t_allocator);
+
+    _alloc_get_stat(&t_allocator, &t_stat);
+    assert_true(t_stat._t_livesize == 0);
+    assert_true(t_stat._t_highsize == 0);
+    assert_true(t_stat._t_cachedsize == 0);
+    assert_true(t_stat._t_poolcount == 0);
+
+    _alloc_destroy(&t_allocator);
+}
+
+void test__alloc_get_stat__small_memory(void** state)
+{
+    void* apv_mem[3] = {NULL, NULL, NULL};
+    _allocstat_t t_stat;
+    _alloc_t t_allocator;
+    _alloc_init(&t_allocator);
+
+    apv_mem[0] = _alloc_allocate(&t_allocator, 8, 1);
+    apv_mem[1] = _alloc_allocate(&t_allocator, 8, 1);
+    apv_mem[2] = _alloc_allocate(&t_allocator, 8, 1);
+    _alloc_get_stat(&t_allocator, &t_stat);
+    assert_true(t_stat._t_livesize >= 24);
+    assert_true(t_stat._t_highsize == t_stat._t_livesize);
+
+    _alloc_deallocate(&t_allocator, apv_mem[0], 8, 1);
+    _alloc_deallocate(&t_allocator, apv_mem[1], 8, 1);
+    _alloc_get_stat(&t_allocator, &t_stat);
+    assert_true(t_stat._t_livesize >= 8 && t_stat._t_livesize < t_stat._t_highsize);
+#if defined(CSTL_MEMORY_MANAGEMENT) && !defined(CSTL_MEMORY_SHARED_POOL)
+    assert_true(t_stat._t_cachedsize >= 16);
+    assert_true(t_stat._t_poolcount == 1);
+#endif
+
+    _alloc_deallocate(&t_allocator, apv_mem[2], 8, 1);
+    _alloc_get_stat(&t_allocator, &t_stat);
+    assert_true(t_stat._t_livesize == 0);
+    assert_true(t_stat._t_highsize >= 24);
+
+    _alloc_destroy(&t_allocator);
+}
+
+void test__alloc_get_stat__large_memory(void** state)
+{
+#ifdef CSTL_MEMORY_MANAGEMENT
+    size_t t_size = _MEM_SMALL_MEM_SIZE_MAX + 1;
+#else
+    size_t t_size = 5000;
+#endif
+    void* pv_mem = NULL;
+    _allocstat_t t_stat;
+    _alloc_t t_allocator;
+    _alloc_init(&t_allocator);
+
+    pv_mem = _alloc_allocate(&t_allocator, t_size, 1);
+    assert_true(t_allocator._pt_ext == NULL);
+    _alloc_get_stat(&t_allocator, &t_stat);
+    assert_true(t_stat._t_livesize == t_size);
+    assert_true(t_stat._t_highsize == t_size);
+    assert_true(t_stat._t_cachedsize == 0);
+
+    _alloc_deallocate(&t_allocator, pv_mem, t_size, 1);
+    _alloc_get_stat(&t_allocator, &t_stat);
+    assert_true(t_stat._t_livesize == 0);
+    assert_true(t_stat._t_highsize == t_size);
+
+    _alloc_destroy(&t_allocator);
+}
+
+void test__alloc_get_stat__region(void** state)
+{
+    void* pv_mem = NULL;
+    _allocstat_t t_stat;
+    _alloc_t t_allocator;
+    _alloc_init(&t_allocator);
+
+    _alloc_set_region(&t_allocator);
+    pv_mem = _alloc_allocate(&t_allocator, 100, 1);
+    _alloc_deallocate(&t_allocator, pv_mem, 100, 1);
+    _alloc_get_stat(&t_allocator, &t_stat);
+    assert_true(t_stat._t_livesize == 100);
+    assert_true(t_stat._t_highsize == 100);
+    assert_true(t_stat._t_cachedsize > 0 && t_stat._t_cachedsize < _MEM_REGION_BLOCK_SIZE);
+    assert_true(t_stat._t_poolcount == 1);
+
+    _alloc_release_region(&t_allocator);
+    _alloc_get_stat(&t_allocator, &t_stat);
+    assert_true(t_stat._t_livesize == 0);
+    assert_true(t_stat._t_highsize == 100);
+    assert_true(t_stat._t_cachedsize == 0);
+    assert_true(t_stat._t_poolcount == 0);
+
+    _alloc_destroy(&t_allocator);
+}
+
+/*
+ * test _alloc_get_class_stat
+ */
+UT_CASE_DEFINATION(_alloc_get_class_stat)
+void test__alloc_get_class_stat__null_allocator(void** state)
+{
+#ifdef CSTL_MEMORY_MANAGEMENT
+    _memclassstat_t t_stat;
+
+    expect_assert_failure(_alloc_get_class_stat(NULL, 0, &t_stat));
+#endif
+}
+
+void test__alloc_get_class_stat__null_stat(void** state)
+{
+#ifdef CSTL_MEMORY_MANAGEMENT
+    _alloc_t t_allocator;
+    _alloc_init(&t_allocator);
+
+    expect_assert_failure(_alloc_get_class_stat(&t_allocator, 0, NULL));
+
+    _alloc_destroy(&t_allocator);
+#endif
+}
+
+void test__alloc_get_class_stat__invalid_index(void** state)
+{
+#ifdef CSTL_MEMORY_MANAGEMENT
+    _memclassstat_t t_stat;
+    _alloc_t t_allocator;
+    _alloc_init(&t_allocator);
+
+    expect_assert_failure(_alloc_get_class_stat(&t_allocator, _MEM_LINK_COUNT, &t_stat));
+
+    _alloc_destroy(&t_allocator);
+#endif
+}
+
+void test__alloc_get_class_stat__successfully(void** state)
+{
+#ifdef CSTL_MEMORY_MANAGEMENT
+    void* apv_mem[3] = {NULL, NULL, NULL};
+    size_t t_index = _MEM_LINK_INDEX(24);
+    _memclassstat_t t_stat;
+    _alloc_t t_allocator;
+    _alloc_init(&t_allocator);
+
+    apv_mem[0] = _alloc_allocate(&t_allocator, 24, 1);
+    apv_mem[1] = _alloc_allocate(&t_allocator, 24, 1);
+    apv_mem[2] = _alloc_allocate(&t_allocator, 24, 1);
+    _alloc_deallocate(&t_allocator, apv_mem[1], 24, 1);
+    _alloc_get_class_stat(&t_allocator, t_index, &t_stat);
+    assert_true(t_stat._t_blocksize == _MEM_LINK_SIZE(t_index));
+#ifdef CSTL_MEMORY_CLASS_STAT
+    assert_true(t_stat._t_livecount == 2);
+    assert_true(t_stat._t_highcount == 3);
+#else
+    assert_true(t_stat._t_livecount == 0);
+    assert_true(t_stat._t_highcount == 0);
+#endif
+#ifndef CSTL_MEMORY_SHARED_POOL
+    assert_true(t_stat._t_cachedcount > 0);
+#endif
+
+    _alloc_deallocate(&t_allocator, apv_mem[0], 24, 1);
+    _alloc_deallocate(&t_allocator, apv_mem[2], 24, 1);
+    _alloc_get_class_stat(&t_allocator, t_index, &t_stat);
+    assert_true(t_stat._t_livecount == 0);
+#ifdef CSTL_MEMORY_CLASS_STAT
+    assert_true(t_stat._t_highcount == 3);
+#else
+    assert_true(t_stat._t_highcount == 0);
+#endif
+
+    _alloc_destroy(&t_allocator);
+#endif
+}
+
 /*
  * test _alloc_is_inited
  */
@@ -375,6 +879,7 @@ void test__alloc_is_inited__non_zero_mempoolsize(void** state)
     t_allocator._t_mempoolsize = 10;
     t_allocator._t_mempoolindex = 0;
     t_allocator._pby_mempool = NULL;
+    t_allocator._pt_ext = NULL;
     
     for(i = 0; i < _MEM_LINK_COUNT; ++i)
     {
@@ -407,6 +912,7 @@ void test__alloc_is_inited__non_zero_mempoolindex(void** state)
     t_allocator._t_mempoolsize = 0;
     t_allocator._t_mempoolindex = 10;
     t_allocator._pby_mempool = NULL;
+    t_allocator._pt_ext = NULL;
     
     for(i = 0; i < _MEM_LINK_COUNT; ++i)
     {
@@ -438,6 +944,7 @@ void test__alloc_is_inited__non_null_mempool(void** state)
     t_allocator._t_mempoolsize = 0;
     t_allocator._t_mempoolindex = 0;
     t_allocator._pby_mempool = (_byte_t*)0xcc;
+    t_allocator._pt_ext = NULL;
     
     for(i = 0; i < _MEM_LINK_COUNT; ++i)
     {
@@ -469,6 +976,7 @@ void test__alloc_is_inited__non_empty_memlink(void** state)
     t_allocator._t_mempoolsize = 0;
     t_allocator._t_mempoolindex = 0;
     t_allocator._pby_mempool = NULL;
+    t_allocator._pt_ext = NULL;
     
     for(i = 0; i < _MEM_LINK_COUNT; ++i)
     {
@@ -500,6 +1008,7 @@ void test__alloc_is_inited__invalid_default_mempoolcount(void** state)
     t_allocator._t_mempoolsize = 0;
     t_allocator._t_mempoolindex = 0;
     t_allocator._pby_mempool = NULL;
+    t_allocator._pt_ext = NULL;
     
     for(i = 0; i < _MEM_LINK_COUNT; ++i)
     {
@@ -531,6 +1040,7 @@ void test__alloc_is_inited__null_mempoolcontainer(void** state)
     t_allocator._t_mempoolsize = 0;
     t_allocator._t_mempoolindex = 0;
     t_allocator._pby_mempool = NULL;
+    t_allocator._pt_ext = NULL;
     
     for(i = 0; i < _MEM_LINK_COUNT; ++i)
     {
@@ -554,6 +1064,7 @@ void test__alloc_is_inited__non_empty_mempoolcontainer(void** state)
     t_allocator._t_mempoolsize = 0;
     t_allocator._t_mempoolindex = 0;
     t_allocator._pby_mempool = NULL;
+    t_allocator._pt_ext = NULL;
     
     for(i = 0; i < _MEM_LINK_COUNT; ++i)
     {
@@ -30,6 +30,58 @@ void test__alloc_deallocate__invalid_allocator(void** state);
 void test__alloc_deallocate__invalid_allocated_memory(void** state);
 void test__alloc_deallocate__greater_than_max_small_memory(void** state);
 void test__alloc_deallocate__less_than_max_small_memory(void** state);
+void test__alloc_deallocate__reuse_by_other_allocator(void** state);
+/*
+ * test _alloc_set_allocator
+ */
+UT_CASE_DECLARATION(_alloc_set_allocator)
+void test__alloc_set_allocator__null_allocator(void** state);
+void test__alloc_set_allocator__null_custom_allocator(void** state);
+void test__alloc_set_allocator__null_custom_function(void** state);
+void test__alloc_set_allocator__successfully(void** state);
+void test__alloc_set_allocator__allocate_by_custom_allocator(void** state);
+void test__alloc_set_allocator__region_allocator(void** state);
+/*
+ * test _alloc_set_region
+ */
+UT_CASE_DECLARATION(_alloc_set_region)
+void test__alloc_set_region__null_allocator(void** state);
+void test__alloc_set_region__custom_allocator(void** state);
+void test__alloc_set_region__successfully(void** state);
+void test__alloc_set_region__allocate_from_region(void** state);
+/*
+ * test _alloc_is_region
+ */
+UT_CASE_DECLARATION(_alloc_is_region)
+void test__alloc_is_region__null_allocator(void** state);
+void test__alloc_is_region__not_region(void** state);
+void test__alloc_is_region__region(void** state);
+/*
+ * test _alloc_release_region
+ */
+UT_CASE_DECLARATION(_alloc_release_region)
+void test__alloc_release_region__null_allocator(void** state);
+void test__alloc_release_region__not_region(void** state);
+void test__alloc_release_region__empty(void** state);
+void test__alloc_release_region__successfully(void** state);
+/*
+ * test _alloc_get_stat
+ */
+UT_CASE_DECLARATION(_alloc_get_stat)
+void test__alloc_get_stat__null_allocator(void** state);
+void test__alloc_get_stat__null_stat(void** state);
+void test__alloc_get_stat__init(void** state);
+void test__alloc_get_stat__small_memory(void** state);
+void test__alloc_get_stat__large_memory(void** state);
+void test__alloc_get_stat__region(void** state);
+/*
+ * test _alloc_get_class_stat
+ */
+UT_CASE_DECLARATION(_alloc_get_class_stat)
+void test__alloc_get_class_stat__null_allocator(void** state);
+void test__alloc_get_class_stat__null_stat(void** state);
+void test__alloc_get_class_stat__invalid_index(void** state);
+void test__alloc_get_class_stat__successfully(void** state);
 /*
  * test _alloc_set_malloc_handler
  */
@@ -63,6 +115,34 @@ void test__alloc_is_inited__successfully(void** state);
     UT_CASE(test__alloc_deallocate__invalid_allocated_memory),\
     UT_CASE(test__alloc_deallocate__greater_than_max_small_memory),\
     UT_CASE(test__alloc_deallocate__less_than_max_small_memory),\
+    UT_CASE(test__alloc_deallocate__reuse_by_other_allocator),\
+    UT_CASE_BEGIN(_alloc_set_allocator, test__alloc_set_allocator__null_allocator),\
+    UT_CASE(test__alloc_set_allocator__null_custom_allocator),\
+    UT_CASE(test__alloc_set_allocator__null_custom_function),\
+    UT_CASE(test__alloc_set_allocator__successfully),\
+    UT_CASE(test__alloc_set_allocator__allocate_by_custom_allocator),\
+    UT_CASE(test__alloc_set_allocator__region_allocator),\
+    UT_CASE_BEGIN(_alloc_set_region, test__alloc_set_region__null_allocator),\
+    UT_CASE(test__alloc_set_region__custom_allocator),\
+    UT_CASE(test__alloc_set_region__successfully),\
+    UT_CASE(test__alloc_set_region__allocate_from_region),\
+    UT_CASE_BEGIN(_alloc_is_region, test__alloc_is_region__null_allocator),\
+    UT_CASE(test__alloc_is_region__not_region),\
+    UT_CASE(test__alloc_is_region__region),\
+    UT_CASE_BEGIN(_alloc_release_region, test__alloc_release_region__null_allocator),\
+    UT_CASE(test__alloc_release_region__not_region),\
+    UT_CASE(test__alloc_release_region__empty),\
+    UT_CASE(test__alloc_release_region__successfully),\
+    UT_CASE_BEGIN(_alloc_get_stat, test__alloc_get_stat__null_allocator),\
+    UT_CASE(test__alloc_get_stat__null_stat),\
+    UT_CASE(test__alloc_get_stat__init),\
+    UT_CASE(test__alloc_get_stat__small_memory),\
+    UT_CASE(test__alloc_get_stat__large_memory),\
+    UT_CASE(test__alloc_get_stat__region),\
+    UT_CASE_BEGIN(_alloc_get_class_stat, test__alloc_get_class_stat__null_allocator),\
+    UT_CASE(test__alloc_get_class_stat__null_stat),\
+    UT_CASE(test__alloc_get_class_stat__invalid_index),\
+    UT_CASE(test__alloc_get_class_stat__successfully),\
     UT_CASE_BEGIN(_alloc_set_malloc_handler, test__alloc_set_malloc_handler___new_handler),\
     UT_CASE(test__alloc_set_malloc_handler___delete_handler),\
     UT_CASE_BEGIN(_alloc_is_inited, test__alloc_is_inited__null_allocator),\
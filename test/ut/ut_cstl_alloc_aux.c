@@ -4,6 +4,9 @@
 #include <google/cmockery.h>
 
 #include <stdlib.h>
+#ifdef CSTL_MEMORY_THREAD_CACHE
+#include <pthread.h>
+#endif
 
 #include "ut_def.h"
 #include "ut_cstl_alloc_aux.h"
@@ -36,7 +39,7 @@ void test__alloc_get_memory_chunk__total_size_less_than_memory_pool(void** state
     _alloc_t allocator;
     _byte_t* pby_malloc = NULL;
     size_t t_old_size = 0;
-    _alloc_init(&allocator);
+    _alloc_init_pool(&allocator);
 
     allocator._t_mempoolsize = t_old_size = 64 * sizeof(_byte_t);
     allocator._pby_mempool = (_byte_t*)malloc(allocator._t_mempoolsize);
@@ -50,7 +53,7 @@ void test__alloc_get_memory_chunk__total_size_less_than_memory_pool(void** state
     assert_true(allocator._t_mempoolsize == t_old_size - 2 * 8);
     assert_true(allocator._pby_mempool = allocator._ppby_mempoolcontainer[0] + 2 * 8);
 
-    _alloc_destroy(&allocator);
+    _alloc_destroy_pool(&allocator);
 }
 
 void test__alloc_get_memory_chunk__memory_pool_less_than_total_size_greater_than_one_size(void** state)
@@ -59,7 +62,7 @@ void test__alloc_get_memory_chunk__memory_pool_less_than_total_size_greater_than
     _alloc_t allocator;
     _byte_t* pby_malloc = NULL;
     size_t t_old_size = 0;
-    _alloc_init(&allocator);
+    _alloc_init_pool(&allocator);
 
     allocator._t_mempoolsize = t_old_size = 64 * sizeof(_byte_t);
     allocator._pby_mempool = (_byte_t*)malloc(allocator._t_mempoolsize);
@@ -73,7 +76,7 @@ void test__alloc_get_memory_chunk__memory_pool_less_than_total_size_greater_than
     assert_true(allocator._t_mempoolsize == 0);
     assert_true(allocator._pby_mempool = allocator._ppby_mempoolcontainer[0] + t_old_size);
 
-    _alloc_destroy(&allocator);
+    _alloc_destroy_pool(&allocator);
 }
 
 void test__alloc_get_memory_chunk__memory_pool_size_equal_to_0(void** state)
@@ -81,7 +84,7 @@ void test__alloc_get_memory_chunk__memory_pool_size_equal_to_0(void** state)
     size_t t_alloccount = 10;
     _alloc_t allocator;
     _byte_t* pby_malloc = NULL;
-    _alloc_init(&allocator);
+    _alloc_init_pool(&allocator);
 
     pby_malloc = _alloc_get_memory_chunk(&allocator, 8, &t_alloccount);
 
@@ -91,7 +94,7 @@ void test__alloc_get_memory_chunk__memory_pool_size_equal_to_0(void** state)
     assert_true(allocator._t_mempoolsize == 80);
     assert_true(allocator._pby_mempool = allocator._ppby_mempoolcontainer[0] + t_alloccount * 8);
 
-    _alloc_destroy(&allocator);
+    _alloc_destroy_pool(&allocator);
 }
 
 void test__alloc_get_memory_chunk__memory_pool_size_less_then_one_allocated_chunk(void** state)
@@ -100,22 +103,23 @@ void test__alloc_get_memory_chunk__memory_pool_size_less_then_one_allocated_chun
     _alloc_t allocator;
     _byte_t* pby_malloc = NULL;
     size_t t_old_size = 0;
-    _alloc_init(&allocator);
+    _alloc_init_pool(&allocator);
 
-    allocator._t_mempoolsize = t_old_size = 8;
+    /* the rest of memory pool is put into memory list when it is not less than the smallest memory block */
+    allocator._t_mempoolsize = t_old_size = _MEM_ALIGNMENT;
     allocator._pby_mempool = (_byte_t*)malloc(allocator._t_mempoolsize);
     allocator._ppby_mempoolcontainer[allocator._t_mempoolindex++] = allocator._pby_mempool;
 
-    pby_malloc = _alloc_get_memory_chunk(&allocator, 16, &t_alloccount);
+    pby_malloc = _alloc_get_memory_chunk(&allocator, 2 * _MEM_ALIGNMENT, &t_alloccount);
 
     assert_true(pby_malloc != NULL);
     assert_true(t_alloccount == 2);
-    assert_true(pby_malloc == allocator._ppby_mempoolcontainer[1]);
-    assert_true(allocator._t_mempoolsize == 32);
-    assert_true(allocator._pby_mempool = allocator._ppby_mempoolcontainer[1] + 32);
+    assert_true(pby_malloc == (_byte_t*)_MEM_ROUND_UP((size_t)allocator._ppby_mempoolcontainer[1]));
+    assert_true(allocator._t_mempoolsize == 4 * _MEM_ALIGNMENT);
+    assert_true(allocator._pby_mempool == pby_malloc + 4 * _MEM_ALIGNMENT);
     assert_true(allocator._ppby_mempoolcontainer[0] == (_byte_t*)allocator._apt_memlink[_MEM_LINK_INDEX(t_old_size)]);
 
-    _alloc_destroy(&allocator);
+    _alloc_destroy_pool(&allocator);
 }
 
 void test__alloc_get_memory_chunk__reallocate_memory_pool_container(void** state)
@@ -124,25 +128,68 @@ void test__alloc_get_memory_chunk__reallocate_memory_pool_container(void** state
     _alloc_t allocator;
     _byte_t* pby_malloc = NULL;
     size_t t_old_size = 0;
-    _alloc_init(&allocator);
+    _alloc_init_pool(&allocator);
 
-    allocator._t_mempoolsize = t_old_size = 8;
+    allocator._t_mempoolsize = t_old_size = _MEM_ALIGNMENT;
     allocator._pby_mempool = (_byte_t*)malloc(allocator._t_mempoolsize);
     allocator._t_mempoolindex = _MEM_POOL_DEFAULT_COUNT - 1;
     allocator._ppby_mempoolcontainer[allocator._t_mempoolindex++] = allocator._pby_mempool;
 
-    pby_malloc = _alloc_get_memory_chunk(&allocator, 16, &t_alloccount);
+    pby_malloc = _alloc_get_memory_chunk(&allocator, 2 * _MEM_ALIGNMENT, &t_alloccount);
 
     assert_true(pby_malloc != NULL);
     assert_true(t_alloccount == 2);
-    assert_true(pby_malloc == allocator._ppby_mempoolcontainer[_MEM_POOL_DEFAULT_COUNT]);
-    assert_true(allocator._t_mempoolcount = 2 * _MEM_POOL_DEFAULT_COUNT);
-    assert_true(allocator._t_mempoolsize == 32);
-    assert_true(allocator._pby_mempool = allocator._ppby_mempoolcontainer[_MEM_POOL_DEFAULT_COUNT] + 32);
+    assert_true(pby_malloc == (_byte_t*)_MEM_ROUND_UP((size_t)allocator._ppby_mempoolcontainer[_MEM_POOL_DEFAULT_COUNT]));
+    assert_true(allocator._t_mempoolcount == 2 * _MEM_POOL_DEFAULT_COUNT);
+    assert_true(allocator._t_mempoolsize == 4 * _MEM_ALIGNMENT);
+    assert_true(allocator._pby_mempool == pby_malloc + 4 * _MEM_ALIGNMENT);
     assert_true(allocator._ppby_mempoolcontainer[_MEM_POOL_DEFAULT_COUNT - 1] == 
             (_byte_t*)allocator._apt_memlink[_MEM_LINK_INDEX(t_old_size)]);
 
-    _alloc_destroy(&allocator);
+    _alloc_destroy_pool(&allocator);
+}
+
+void test__alloc_get_memory_chunk__small_memory_pool_round_down(void** state)
+{
+#if _MEM_SMALL_MEM_SIZE_MAX > _MEM_TIER_SIZE
+    size_t t_alloccount = 1;
+    _alloc_t allocator;
+    _byte_t* pby_malloc = NULL;
+    _byte_t* pby_oldpool = NULL;
+    _alloc_init_pool(&allocator);
+
+    /* the size of memory pool is not a size class */
+    allocator._t_mempoolsize = _MEM_TIER_SIZE + _MEM_ALIGNMENT;
+    allocator._pby_mempool = pby_oldpool = (_byte_t*)malloc(allocator._t_mempoolsize);
+    allocator._ppby_mempoolcontainer[allocator._t_mempoolindex++] = allocator._pby_mempool;
+
+    pby_malloc = _alloc_get_memory_chunk(&allocator, _MEM_LINK_SIZE(_MEM_LINK_INDEX(_MEM_TIER_SIZE + 1)), &t_alloccount);
+
+    assert_true(pby_malloc != NULL);
+    assert_true(t_alloccount == 1);
+    assert_true((_byte_t*)allocator._apt_memlink[_MEM_LINK_INDEX(_MEM_TIER_SIZE)] == pby_oldpool);
+    assert_true(allocator._apt_memlink[_MEM_LINK_INDEX(_MEM_TIER_SIZE + 1)] == NULL);
+
+    _alloc_destroy_pool(&allocator);
+#endif
+}
+
+void test__alloc_get_memory_chunk__aligned_memory_pool(void** state)
+{
+    size_t t_alloccount = 3;
+    _alloc_t allocator;
+    _byte_t* pby_malloc = NULL;
+    _alloc_init_pool(&allocator);
+
+    pby_malloc = _alloc_get_memory_chunk(&allocator, _MEM_ALIGNMENT, &t_alloccount);
+
+    assert_true(pby_malloc != NULL);
+    assert_true((size_t)pby_malloc % _MEM_ALIGNMENT == 0);
+    assert_true(pby_malloc >= allocator._ppby_mempoolcontainer[0]);
+    assert_true(pby_malloc < allocator._ppby_mempoolcontainer[0] + _MEM_ALIGNMENT);
+    assert_true(allocator._t_mempoolsize == 3 * _MEM_ALIGNMENT);
+
+    _alloc_destroy_pool(&allocator);
 }
 
 /*
@@ -159,7 +206,7 @@ void test__alloc_apply_formated_memory__success(void** state)
     _alloc_t allocator;
     _memlink_t* pt_link = NULL;
     _memlink_t* pt_link_prev = NULL;
-    _alloc_init(&allocator);
+    _alloc_init_pool(&allocator);
 
     _alloc_apply_formated_memory(&allocator, 8);
 
@@ -170,7 +217,591 @@ void test__alloc_apply_formated_memory__success(void** state)
     }
     assert_true((_byte_t*)allocator._pby_mempool == (_byte_t*)pt_link_prev + 8);
 
+    _alloc_destroy_pool(&allocator);
+}
+
+void test__alloc_apply_formated_memory__large_size(void** state)
+{
+    _alloc_t allocator;
+    _memlink_t* pt_link = NULL;
+    size_t t_size = _MEM_LINK_SIZE(_MEM_LINK_COUNT - 1);
+    size_t t_count = 0;
+    _alloc_init_pool(&allocator);
+
+    _alloc_apply_formated_memory(&allocator, t_size);
+
+    for(pt_link = allocator._apt_memlink[_MEM_LINK_COUNT - 1]; pt_link != NULL; pt_link = pt_link->_pui_nextmem)
+    {
+        assert_true((size_t)pt_link % _MEM_ALIGNMENT == 0);
+        ++t_count;
+    }
+    if(t_size * _MEM_CHUNK_COUNT > _MEM_CHUNK_SIZE_MAX)
+    {
+        assert_true(t_count == (t_size < _MEM_CHUNK_SIZE_MAX ? _MEM_CHUNK_SIZE_MAX / t_size : 1));
+    }
+    else
+    {
+        assert_true(t_count == _MEM_CHUNK_COUNT);
+    }
+
+    _alloc_destroy_pool(&allocator);
+}
+
+/*
+ * test _alloc_get_memlink_index
+ */
+UT_CASE_DEFINATION(_alloc_get_memlink_index)
+void test__alloc_get_memlink_index__invalid_size(void** state)
+{
+    expect_assert_failure(_alloc_get_memlink_index(0));
+    expect_assert_failure(_alloc_get_memlink_index(_MEM_SMALL_MEM_SIZE_MAX + 1));
+}
+
+void test__alloc_get_memlink_index__aligned_tier(void** state)
+{
+    assert_true(_alloc_get_memlink_index(1) == 0);
+    assert_true(_alloc_get_memlink_index(_MEM_ALIGNMENT) == 0);
+    assert_true(_alloc_get_memlink_index(_MEM_ALIGNMENT + 1) == 1);
+    assert_true(_alloc_get_memlink_index(_MEM_TIER_SIZE) == _MEM_TIER_SIZE / _MEM_ALIGNMENT - 1);
+}
+
+void test__alloc_get_memlink_index__upper_tier(void** state)
+{
+#if _MEM_SMALL_MEM_SIZE_MAX > _MEM_TIER_SIZE
+    assert_true(_alloc_get_memlink_index(_MEM_TIER_SIZE + 1) == _MEM_TIER_SIZE / _MEM_ALIGNMENT);
+    assert_true(_alloc_get_memlink_index(_MEM_TIER_SIZE * 2) == _MEM_TIER_SIZE / _MEM_ALIGNMENT + _MEM_TIER_CLASS_COUNT - 1);
+    assert_true(_alloc_get_memlink_index(_MEM_TIER_SIZE * 2 + 1) == _MEM_TIER_SIZE / _MEM_ALIGNMENT + _MEM_TIER_CLASS_COUNT);
+#endif
+    assert_true(_alloc_get_memlink_index(_MEM_SMALL_MEM_SIZE_MAX) == _MEM_LINK_COUNT - 1);
+}
+
+void test__alloc_get_memlink_index__all_size(void** state)
+{
+    size_t t_size = 0;
+    size_t t_index = 0;
+
+    for(t_size = 1; t_size <= _MEM_SMALL_MEM_SIZE_MAX; ++t_size)
+    {
+        t_index = _alloc_get_memlink_index(t_size);
+        assert_true(t_index < _MEM_LINK_COUNT);
+        assert_true(_alloc_get_memlink_size(t_index) >= t_size);
+        assert_true(t_index == 0 || _alloc_get_memlink_size(t_index - 1) < t_size);
+    }
+}
+
+/*
+ * test _alloc_get_memlink_size
+ */
+UT_CASE_DEFINATION(_alloc_get_memlink_size)
+void test__alloc_get_memlink_size__invalid_index(void** state)
+{
+    expect_assert_failure(_alloc_get_memlink_size(_MEM_LINK_COUNT));
+}
+
+void test__alloc_get_memlink_size__all_index(void** state)
+{
+    size_t i = 0;
+
+    for(i = 0; i < _MEM_LINK_COUNT; ++i)
+    {
+        assert_true(_alloc_get_memlink_size(i) % _MEM_ALIGNMENT == 0);
+        assert_true(_alloc_get_memlink_index(_alloc_get_memlink_size(i)) == i);
+        assert_true(i == 0 || _alloc_get_memlink_size(i) > _alloc_get_memlink_size(i - 1));
+    }
+    assert_true(_alloc_get_memlink_size(0) == _MEM_ALIGNMENT);
+    assert_true(_alloc_get_memlink_size(_MEM_LINK_COUNT - 1) == _MEM_SMALL_MEM_SIZE_MAX);
+}
+
+/*
+ * test _alloc_init_pool
+ */
+UT_CASE_DEFINATION(_alloc_init_pool)
+void test__alloc_init_pool__invalid_allocator(void** state)
+{
+    expect_assert_failure(_alloc_init_pool(NULL));
+}
+
+void test__alloc_init_pool__success(void** state)
+{
+    size_t i = 0;
+    _alloc_t allocator;
+    _alloc_init_pool(&allocator);
+
+    assert_true(allocator._pby_mempool == NULL);
+    assert_true(allocator._t_mempoolsize == 0);
+    assert_true(allocator._t_mempoolindex == 0);
+    assert_true(allocator._t_mempoolcount == _MEM_POOL_DEFAULT_COUNT);
+    for(i = 0; i < _MEM_LINK_COUNT; ++i)
+    {
+        assert_true(allocator._apt_memlink[i] == NULL);
+    }
+    assert_true(allocator._ppby_mempoolcontainer != NULL);
+    for(i = 0; i < allocator._t_mempoolcount; ++i)
+    {
+        assert_true(allocator._ppby_mempoolcontainer[i] == NULL);
+    }
+
+    _alloc_destroy_pool(&allocator);
+}
+
+/*
+ * test _alloc_destroy_pool
+ */
+UT_CASE_DEFINATION(_alloc_destroy_pool)
+void test__alloc_destroy_pool__invalid_allocator(void** state)
+{
+    expect_assert_failure(_alloc_destroy_pool(NULL));
+}
+
+void test__alloc_destroy_pool__success(void** state)
+{
+    size_t i = 0;
+    _alloc_t allocator;
+    _alloc_init_pool(&allocator);
+    _alloc_apply_formated_memory(&allocator, 8);
+
+    _alloc_destroy_pool(&allocator);
+    assert_true(allocator._pby_mempool == NULL);
+    assert_true(allocator._t_mempoolsize == 0);
+    assert_true(allocator._t_mempoolindex == 0);
+    assert_true(allocator._t_mempoolcount == 0);
+    for(i = 0; i < _MEM_LINK_COUNT; ++i)
+    {
+        assert_true(allocator._apt_memlink[i] == NULL);
+    }
+    assert_true(allocator._ppby_mempoolcontainer == NULL);
+}
+
+/*
+ * test _alloc_get_shared_pool
+ */
+UT_CASE_DEFINATION(_alloc_get_shared_pool)
+void test__alloc_get_shared_pool__same_pool(void** state)
+{
+#ifdef CSTL_MEMORY_SHARED_POOL
+    _alloc_t* pt_pool = _alloc_get_shared_pool();
+
+    assert_true(pt_pool != NULL);
+    assert_true(pt_pool->_ppby_mempoolcontainer != NULL);
+    assert_true(pt_pool->_t_mempoolcount >= _MEM_POOL_DEFAULT_COUNT);
+    assert_true(_alloc_get_shared_pool() == pt_pool);
+#endif
+}
+
+void test__alloc_get_shared_pool__allocate(void** state)
+{
+#if defined(CSTL_MEMORY_SHARED_POOL) && !defined(CSTL_MEMORY_THREAD_CACHE)
+    _alloc_t allocator;
+    void* pv_mem = NULL;
+    _alloc_init(&allocator);
+
+    pv_mem = _alloc_allocate(&allocator, 8, 1);
+    assert_true(pv_mem != NULL);
+    assert_true(_alloc_is_inited(&allocator));
+    _alloc_deallocate(&allocator, pv_mem, 8, 1);
+    assert_true((void*)_alloc_get_shared_pool()->_apt_memlink[_MEM_LINK_INDEX(8)] == pv_mem);
+
     _alloc_destroy(&allocator);
+#endif
+}
+
+#ifdef CSTL_MEMORY_THREAD_CACHE
+#define _UT_ALLOC_THREAD_COUNT 4
+#define _UT_ALLOC_BLOCK_COUNT  512
+
+static void* _gapv_ut_alloc_block[_UT_ALLOC_THREAD_COUNT][_UT_ALLOC_BLOCK_COUNT];
+
+static _memlink_t* _ut_alloc_drain_depot(size_t t_allocsize)
+{
+    _memlink_t* pt_saved = NULL;
+    _memlink_t* pt_first = NULL;
+    _memlink_t* pt_last = NULL;
+
+    while ((pt_first = _alloc_pop_depot(t_allocsize)) != NULL) {
+        for (pt_last = pt_first; pt_last->_pui_nextmem != NULL; pt_last = pt_last->_pui_nextmem) {
+            continue;
+        }
+        pt_last->_pui_nextmem = pt_saved;
+        pt_saved = pt_first;
+    }
+
+    return pt_saved;
+}
+
+static void _ut_alloc_restore_depot(size_t t_allocsize, _memlink_t* pt_saved)
+{
+    _memlink_t* pt_last = NULL;
+
+    if (pt_saved != NULL) {
+        for (pt_last = pt_saved; pt_last->_pui_nextmem != NULL; pt_last = pt_last->_pui_nextmem) {
+            continue;
+        }
+        _alloc_push_depot(t_allocsize, pt_saved, pt_last);
+    }
+}
+
+static void* _ut_alloc_get_thread_cache(void* pv_arg)
+{
+    return _alloc_get_thread_cache();
+}
+
+static void* _ut_alloc_thread_cache_allocate(void* pv_arg)
+{
+    return _alloc_thread_cache_allocate(*(size_t*)pv_arg);
+}
+
+static void* _ut_alloc_thread_cache_exit(void* pv_arg)
+{
+    _alloc_thread_cache_deallocate(pv_arg, 56);
+    return NULL;
+}
+
+static void* _ut_alloc_thread_cache_fill(void* pv_arg)
+{
+    size_t t_thread = (size_t)pv_arg;
+    size_t t_size = 0;
+    void*  pv_mem = NULL;
+    size_t i = 0;
+
+    for (i = 0; i < _UT_ALLOC_BLOCK_COUNT; ++i) {
+        /* churn the thread cache while other threads do the same thing */
+        t_size = _MEM_LINK_SIZE(i % _MEM_LINK_COUNT);
+        pv_mem = _alloc_thread_cache_allocate(t_size);
+        _alloc_thread_cache_deallocate(pv_mem, t_size);
+
+        _gapv_ut_alloc_block[t_thread][i] = _alloc_thread_cache_allocate(t_size);
+        memset(_gapv_ut_alloc_block[t_thread][i], (int)t_thread + 1, t_size);
+    }
+
+    return NULL;
+}
+
+static void* _ut_alloc_thread_cache_release(void* pv_arg)
+{
+    size_t t_thread = ((size_t)pv_arg + 1) % _UT_ALLOC_THREAD_COUNT;
+    size_t t_size = 0;
+    size_t i = 0;
+    size_t j = 0;
+
+    for (i = 0; i < _UT_ALLOC_BLOCK_COUNT; ++i) {
+        t_size = _MEM_LINK_SIZE(i % _MEM_LINK_COUNT);
+        for (j = 0; j < t_size; ++j) {
+            if (((_byte_t*)_gapv_ut_alloc_block[t_thread][i])[j] != (_byte_t)(t_thread + 1)) {
+                return pv_arg;
+            }
+        }
+        _alloc_thread_cache_deallocate(_gapv_ut_alloc_block[t_thread][i], t_size);
+    }
+
+    return NULL;
+}
+#endif /* CSTL_MEMORY_THREAD_CACHE */
+
+/*
+ * test _alloc_get_thread_cache
+ */
+UT_CASE_DEFINATION(_alloc_get_thread_cache)
+void test__alloc_get_thread_cache__same_cache(void** state)
+{
+#ifdef CSTL_MEMORY_THREAD_CACHE
+    _alloc_t* pt_cache = _alloc_get_thread_cache();
+
+    assert_true(pt_cache != NULL);
+    assert_true(pt_cache->_ppby_mempoolcontainer != NULL);
+    assert_true(_alloc_get_thread_cache() == pt_cache);
+#endif
+}
+
+void test__alloc_get_thread_cache__other_thread(void** state)
+{
+#ifdef CSTL_MEMORY_THREAD_CACHE
+    pthread_t t_thread;
+    void*     pv_cache = NULL;
+
+    assert_true(pthread_create(&t_thread, NULL, _ut_alloc_get_thread_cache, NULL) == 0);
+    assert_true(pthread_join(t_thread, &pv_cache) == 0);
+    assert_true(pv_cache != NULL);
+    assert_true(pv_cache != (void*)_alloc_get_thread_cache());
+#endif
+}
+
+/*
+ * test _alloc_thread_cache_allocate
+ */
+UT_CASE_DEFINATION(_alloc_thread_cache_allocate)
+void test__alloc_thread_cache_allocate__invalid_size(void** state)
+{
+#ifdef CSTL_MEMORY_THREAD_CACHE
+    expect_assert_failure(_alloc_thread_cache_allocate(0));
+    expect_assert_failure(_alloc_thread_cache_allocate(_MEM_SMALL_MEM_SIZE_MAX + 1));
+#endif
+}
+
+void test__alloc_thread_cache_allocate__reuse(void** state)
+{
+#ifdef CSTL_MEMORY_THREAD_CACHE
+    void* pv_mem = _alloc_thread_cache_allocate(16);
+
+    assert_true(pv_mem != NULL);
+    _alloc_thread_cache_deallocate(pv_mem, 16);
+    assert_true(_alloc_thread_cache_allocate(16) == pv_mem);
+    _alloc_thread_cache_deallocate(pv_mem, 16);
+#endif
+}
+
+void test__alloc_thread_cache_allocate__refill_from_depot(void** state)
+{
+#ifdef CSTL_MEMORY_THREAD_CACHE
+    _memlink_t* pt_saved = NULL;
+    _memlink_t* pt_first = (_memlink_t*)malloc(_MEM_LINK_SIZE(_MEM_LINK_INDEX(24)));
+    _memlink_t* pt_last = (_memlink_t*)malloc(_MEM_LINK_SIZE(_MEM_LINK_INDEX(24)));
+
+    _alloc_flush_thread_cache();
+    pt_saved = _ut_alloc_drain_depot(24);
+    pt_first->_pui_nextmem = pt_last;
+    _alloc_push_depot(24, pt_first, pt_last);
+
+    assert_true(_alloc_thread_cache_allocate(24) == pt_first);
+    assert_true(_alloc_get_thread_cache()->_apt_memlink[_MEM_LINK_INDEX(24)] == pt_last);
+    assert_true(_alloc_pop_depot(24) == NULL);
+    _alloc_thread_cache_deallocate(pt_first, 24);
+
+    _ut_alloc_restore_depot(24, pt_saved);
+#endif
+}
+
+/*
+ * test _alloc_thread_cache_deallocate
+ */
+UT_CASE_DEFINATION(_alloc_thread_cache_deallocate)
+void test__alloc_thread_cache_deallocate__invalid_memory(void** state)
+{
+#ifdef CSTL_MEMORY_THREAD_CACHE
+    expect_assert_failure(_alloc_thread_cache_deallocate(NULL, 8));
+#endif
+}
+
+void test__alloc_thread_cache_deallocate__other_thread(void** state)
+{
+#ifdef CSTL_MEMORY_THREAD_CACHE
+    pthread_t t_thread;
+    size_t    t_size = 32;
+    void*     pv_mem = NULL;
+
+    assert_true(pthread_create(&t_thread, NULL, _ut_alloc_thread_cache_allocate, &t_size) == 0);
+    assert_true(pthread_join(t_thread, &pv_mem) == 0);
+    assert_true(pv_mem != NULL);
+
+    _alloc_thread_cache_deallocate(pv_mem, t_size);
+    assert_true((void*)_alloc_get_thread_cache()->_apt_memlink[_MEM_LINK_INDEX(t_size)] == pv_mem);
+    assert_true(_alloc_thread_cache_allocate(t_size) == pv_mem);
+    _alloc_thread_cache_deallocate(pv_mem, t_size);
+#endif
+}
+
+void test__alloc_thread_cache_deallocate__return_to_depot(void** state)
+{
+#ifdef CSTL_MEMORY_THREAD_CACHE
+    void*       apv_mem[2 * _MEM_MAGAZINE_SIZE + 1];
+    _memlink_t* pt_saved = NULL;
+    _memlink_t* pt_link = NULL;
+    size_t      t_count = 0;
+    size_t      i = 0;
+
+    _alloc_flush_thread_cache();
+    pt_saved = _ut_alloc_drain_depot(40);
+    for (i = 0; i < sizeof(apv_mem) / sizeof(apv_mem[0]); ++i) {
+        apv_mem[i] = _alloc_thread_cache_allocate(40);
+    }
+    for (i = 0; i < sizeof(apv_mem) / sizeof(apv_mem[0]); ++i) {
+        _alloc_thread_cache_deallocate(apv_mem[i], 40);
+    }
+
+    /* the recently released magazine is kept by thread cache */
+    for (pt_link = _alloc_get_thread_cache()->_apt_memlink[_MEM_LINK_INDEX(40)]; pt_link != NULL; pt_link = pt_link->_pui_nextmem) {
+        t_count++;
+    }
+    assert_true(t_count >= _MEM_MAGAZINE_SIZE && t_count <= 2 * _MEM_MAGAZINE_SIZE);
+    assert_true(_alloc_get_thread_cache()->_apt_memlink[_MEM_LINK_INDEX(40)] == apv_mem[2 * _MEM_MAGAZINE_SIZE]);
+
+    t_count = 0;
+    for (pt_link = _alloc_pop_depot(40); pt_link != NULL; pt_link = pt_link->_pui_nextmem) {
+        t_count++;
+    }
+    assert_true(t_count == _MEM_MAGAZINE_SIZE);
+    assert_true(_alloc_pop_depot(40) != NULL);
+
+    _ut_alloc_restore_depot(40, pt_saved);
+#endif
+}
+
+void test__alloc_thread_cache_deallocate__concurrent(void** state)
+{
+#ifdef CSTL_MEMORY_THREAD_CACHE
+    pthread_t at_thread[_UT_ALLOC_THREAD_COUNT];
+    void*     pv_result = NULL;
+    size_t    t_round = 0;
+    size_t    i = 0;
+
+    for (t_round = 0; t_round < 16; ++t_round) {
+        for (i = 0; i < _UT_ALLOC_THREAD_COUNT; ++i) {
+            assert_true(pthread_create(&at_thread[i], NULL, _ut_alloc_thread_cache_fill, (void*)i) == 0);
+        }
+        for (i = 0; i < _UT_ALLOC_THREAD_COUNT; ++i) {
+            assert_true(pthread_join(at_thread[i], NULL) == 0);
+        }
+
+        /* each thread releases the memory that is allocated by next thread */
+        for (i = 0; i < _UT_ALLOC_THREAD_COUNT; ++i) {
+            assert_true(pthread_create(&at_thread[i], NULL, _ut_alloc_thread_cache_release, (void*)i) == 0);
+        }
+        for (i = 0; i < _UT_ALLOC_THREAD_COUNT; ++i) {
+            assert_true(pthread_join(at_thread[i], &pv_result) == 0);
+            assert_true(pv_result == NULL);
+        }
+    }
+#endif
+}
+
+/*
+ * test _alloc_flush_thread_cache
+ */
+UT_CASE_DEFINATION(_alloc_flush_thread_cache)
+void test__alloc_flush_thread_cache__success(void** state)
+{
+#ifdef CSTL_MEMORY_THREAD_CACHE
+    void*  pv_mem = _alloc_thread_cache_allocate(48);
+    size_t i = 0;
+
+    _alloc_thread_cache_deallocate(pv_mem, 48);
+    _alloc_flush_thread_cache();
+    for (i = 0; i < _MEM_LINK_COUNT; ++i) {
+        assert_true(_alloc_get_thread_cache()->_apt_memlink[i] == NULL);
+    }
+#endif
+}
+
+void test__alloc_flush_thread_cache__thread_exit(void** state)
+{
+#ifdef CSTL_MEMORY_THREAD_CACHE
+    pthread_t   t_thread;
+    void*       pv_mem = _alloc_thread_cache_allocate(56);
+    _memlink_t* pt_saved = NULL;
+    _memlink_t* pt_link = NULL;
+    bool_t      b_found = false;
+
+    _alloc_flush_thread_cache();
+    pt_saved = _ut_alloc_drain_depot(56);
+    assert_true(pthread_create(&t_thread, NULL, _ut_alloc_thread_cache_exit, pv_mem) == 0);
+    assert_true(pthread_join(t_thread, NULL) == 0);
+
+    for (pt_link = _alloc_pop_depot(56); pt_link != NULL; pt_link = pt_link->_pui_nextmem) {
+        if ((void*)pt_link == pv_mem) {
+            b_found = true;
+        }
+    }
+    assert_true(b_found);
+
+    _ut_alloc_restore_depot(56, pt_saved);
+#endif
+}
+
+void test__alloc_flush_thread_cache__thread_exit_mempool(void** state)
+{
+#ifdef CSTL_MEMORY_THREAD_CACHE
+    pthread_t   t_thread;
+    size_t      t_size = 64;
+    size_t      t_mempoolindex = 0;
+    void*       pv_mem = NULL;
+    _memlink_t* pt_saved = NULL;
+
+    /* the thread carves new memory pool when depot is empty */
+    pt_saved = _ut_alloc_drain_depot(t_size);
+    t_mempoolindex = _alloc_get_shared_pool()->_t_mempoolindex;
+    assert_true(pthread_create(&t_thread, NULL, _ut_alloc_thread_cache_allocate, &t_size) == 0);
+    assert_true(pthread_join(t_thread, &pv_mem) == 0);
+    assert_true(pv_mem != NULL);
+    assert_true(_alloc_get_shared_pool()->_t_mempoolindex > t_mempoolindex);
+
+    _alloc_thread_cache_deallocate(pv_mem, t_size);
+    _alloc_flush_thread_cache();
+    _ut_alloc_restore_depot(t_size, pt_saved);
+#endif
+}
+
+/*
+ * test _alloc_push_depot
+ */
+UT_CASE_DEFINATION(_alloc_push_depot)
+void test__alloc_push_depot__null_first(void** state)
+{
+#ifdef CSTL_MEMORY_THREAD_CACHE
+    _memlink_t t_link;
+    expect_assert_failure(_alloc_push_depot(8, NULL, &t_link));
+#endif
+}
+
+void test__alloc_push_depot__null_last(void** state)
+{
+#ifdef CSTL_MEMORY_THREAD_CACHE
+    _memlink_t t_link;
+    expect_assert_failure(_alloc_push_depot(8, &t_link, NULL));
+#endif
+}
+
+void test__alloc_push_depot__successfully(void** state)
+{
+#ifdef CSTL_MEMORY_THREAD_CACHE
+    _memlink_t  at_link[3];
+    _memlink_t* pt_saved = _ut_alloc_drain_depot(64);
+
+    at_link[0]._pui_nextmem = &at_link[1];
+    _alloc_push_depot(64, &at_link[0], &at_link[1]);
+    _alloc_push_depot(64, &at_link[2], &at_link[2]);
+    assert_true(_alloc_pop_depot(64) == &at_link[2]);
+    assert_true(at_link[2]._pui_nextmem == &at_link[0]);
+    assert_true(at_link[0]._pui_nextmem == &at_link[1]);
+    assert_true(at_link[1]._pui_nextmem == NULL);
+
+    _ut_alloc_restore_depot(64, pt_saved);
+#endif
+}
+
+/*
+ * test _alloc_pop_depot
+ */
+UT_CASE_DEFINATION(_alloc_pop_depot)
+void test__alloc_pop_depot__empty(void** state)
+{
+#ifdef CSTL_MEMORY_THREAD_CACHE
+    _memlink_t* pt_saved = _ut_alloc_drain_depot(72);
+
+    assert_true(_alloc_pop_depot(72) == NULL);
+
+    _ut_alloc_restore_depot(72, pt_saved);
+#endif
+}
+
+void test__alloc_pop_depot__one_magazine(void** state)
+{
+#ifdef CSTL_MEMORY_THREAD_CACHE
+    _memlink_t  at_link[_MEM_MAGAZINE_SIZE + 3];
+    _memlink_t* pt_saved = _ut_alloc_drain_depot(72);
+    size_t      i = 0;
+
+    for (i = 0; i < _MEM_MAGAZINE_SIZE + 2; ++i) {
+        at_link[i]._pui_nextmem = &at_link[i + 1];
+    }
+    _alloc_push_depot(72, &at_link[0], &at_link[_MEM_MAGAZINE_SIZE + 2]);
+
+    assert_true(_alloc_pop_depot(72) == &at_link[0]);
+    assert_true(at_link[_MEM_MAGAZINE_SIZE - 1]._pui_nextmem == NULL);
+    assert_true(_alloc_pop_depot(72) == &at_link[_MEM_MAGAZINE_SIZE]);
+    assert_true(at_link[_MEM_MAGAZINE_SIZE + 2]._pui_nextmem == NULL);
+    assert_true(_alloc_pop_depot(72) == NULL);
+
+    _ut_alloc_restore_depot(72, pt_saved);
+#endif
 }
 #else
 UT_SUIT_DEFINATION(cstl_alloc_aux, _alloc_free)
@@ -212,3 +843,95 @@ void test__alloc_malloc_out_of_memory__success(void** state)
     _alloc_free(pv_allocmem);
 }
 
+
+/*
+ * test _alloc_allocate_from_region
+ */
+UT_CASE_DEFINATION(_alloc_allocate_from_region)
+void test__alloc_allocate_from_region__invalid_allocator(void** state)
+{
+    expect_assert_failure(_alloc_allocate_from_region(NULL, 8));
+}
+
+void test__alloc_allocate_from_region__not_region(void** state)
+{
+    _alloc_t t_allocator;
+    _alloc_init(&t_allocator);
+
+    expect_assert_failure(_alloc_allocate_from_region(&t_allocator, 8));
+
+    _alloc_destroy(&t_allocator);
+}
+
+void test__alloc_allocate_from_region__zero_size(void** state)
+{
+    _byte_t* pby_first = NULL;
+    _byte_t* pby_second = NULL;
+    _alloc_t t_allocator;
+    _alloc_init(&t_allocator);
+    _alloc_set_region(&t_allocator);
+
+    pby_first = (_byte_t*)_alloc_allocate_from_region(&t_allocator, 0);
+    pby_second = (_byte_t*)_alloc_allocate_from_region(&t_allocator, 0);
+    assert_true(pby_first != NULL);
+    assert_true(pby_second == pby_first + _MEM_REGION_ALIGNMENT);
+
+    _alloc_destroy(&t_allocator);
+}
+
+void test__alloc_allocate_from_region__new_block(void** state)
+{
+    size_t   i = 0;
+    _byte_t* pby_block = NULL;
+    _byte_t* pby_mem = NULL;
+    _alloc_t t_allocator;
+    _alloc_init(&t_allocator);
+    _alloc_set_region(&t_allocator);
+
+    pby_mem = (_byte_t*)_alloc_allocate_from_region(&t_allocator, _MEM_REGION_ALIGNMENT);
+    pby_block = t_allocator._pt_ext->_pby_regionblock;
+    assert_true(t_allocator._pt_ext->_pby_regionend == pby_mem + _MEM_REGION_BLOCK_SIZE);
+    for (i = 1; i < _MEM_REGION_BLOCK_SIZE / _MEM_REGION_ALIGNMENT; ++i) {
+        assert_true(_alloc_allocate_from_region(&t_allocator, _MEM_REGION_ALIGNMENT) == pby_mem + i * _MEM_REGION_ALIGNMENT);
+    }
+    assert_true(t_allocator._pt_ext->_pby_regionpos == t_allocator._pt_ext->_pby_regionend);
+    assert_true(t_allocator._pt_ext->_pby_regionblock == pby_block);
+
+    /* the current block is full */
+    pby_mem = (_byte_t*)_alloc_allocate_from_region(&t_allocator, 1);
+    assert_true((size_t)pby_mem % _MEM_REGION_ALIGNMENT == 0);
+    assert_true(t_allocator._pt_ext->_pby_regionblock != pby_block);
+    assert_true(*(_byte_t**)t_allocator._pt_ext->_pby_regionblock == pby_block);
+    assert_true(t_allocator._pt_ext->_pby_regionpos == pby_mem + _MEM_REGION_ALIGNMENT);
+
+    _alloc_destroy(&t_allocator);
+}
+
+void test__alloc_allocate_from_region__large_size(void** state)
+{
+    _byte_t* pby_block = NULL;
+    _byte_t* pby_pos = NULL;
+    _byte_t* pby_large = NULL;
+    _alloc_t t_allocator;
+    _alloc_init(&t_allocator);
+    _alloc_set_region(&t_allocator);
+
+    /* the large memory is the first block */
+    pby_large = (_byte_t*)_alloc_allocate_from_region(&t_allocator, _MEM_REGION_LARGE_SIZE + 1);
+    assert_true(pby_large != NULL);
+    assert_true(t_allocator._pt_ext->_pby_regionend == pby_large + _MEM_REGION_ROUND_UP(_MEM_REGION_LARGE_SIZE + 1));
+
+    assert_true(_alloc_allocate_from_region(&t_allocator, 8) != NULL);
+    pby_block = t_allocator._pt_ext->_pby_regionblock;
+    pby_pos = t_allocator._pt_ext->_pby_regionpos;
+
+    /* the large memory is linked behind the current block */
+    pby_large = (_byte_t*)_alloc_allocate_from_region(&t_allocator, _MEM_REGION_BLOCK_SIZE * 2);
+    assert_true(pby_large != NULL);
+    memset(pby_large, 0x00, _MEM_REGION_BLOCK_SIZE * 2);
+    assert_true(t_allocator._pt_ext->_pby_regionblock == pby_block);
+    assert_true(t_allocator._pt_ext->_pby_regionpos == pby_pos);
+    assert_true(*(_byte_t**)pby_block != NULL);
+
+    _alloc_destroy(&t_allocator);
+}
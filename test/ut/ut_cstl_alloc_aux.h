@@ -15,6 +15,8 @@ void test__alloc_get_memory_chunk__memory_pool_less_than_total_size_greater_than
 void test__alloc_get_memory_chunk__memory_pool_size_equal_to_0(void** state);
 void test__alloc_get_memory_chunk__memory_pool_size_less_then_one_allocated_chunk(void** state);
 void test__alloc_get_memory_chunk__reallocate_memory_pool_container(void** state);
+void test__alloc_get_memory_chunk__small_memory_pool_round_down(void** state);
+void test__alloc_get_memory_chunk__aligned_memory_pool(void** state);
 
 /*
  * test _alloc_apply_formated_memory
@@ -22,6 +24,91 @@ void test__alloc_get_memory_chunk__reallocate_memory_pool_container(void** state
 UT_CASE_DECLARATION(_alloc_apply_formated_memory)
 void test__alloc_apply_formated_memory__invalid_allocator(void** state);
 void test__alloc_apply_formated_memory__success(void** state);
+void test__alloc_apply_formated_memory__large_size(void** state);
+
+/*
+ * test _alloc_get_memlink_index
+ */
+UT_CASE_DECLARATION(_alloc_get_memlink_index)
+void test__alloc_get_memlink_index__invalid_size(void** state);
+void test__alloc_get_memlink_index__aligned_tier(void** state);
+void test__alloc_get_memlink_index__upper_tier(void** state);
+void test__alloc_get_memlink_index__all_size(void** state);
+
+/*
+ * test _alloc_get_memlink_size
+ */
+UT_CASE_DECLARATION(_alloc_get_memlink_size)
+void test__alloc_get_memlink_size__invalid_index(void** state);
+void test__alloc_get_memlink_size__all_index(void** state);
+
+/*
+ * test _alloc_init_pool
+ */
+UT_CASE_DECLARATION(_alloc_init_pool)
+void test__alloc_init_pool__invalid_allocator(void** state);
+void test__alloc_init_pool__success(void** state);
+
+/*
+ * test _alloc_destroy_pool
+ */
+UT_CASE_DECLARATION(_alloc_destroy_pool)
+void test__alloc_destroy_pool__invalid_allocator(void** state);
+void test__alloc_destroy_pool__success(void** state);
+
+/*
+ * test _alloc_get_shared_pool
+ */
+UT_CASE_DECLARATION(_alloc_get_shared_pool)
+void test__alloc_get_shared_pool__same_pool(void** state);
+void test__alloc_get_shared_pool__allocate(void** state);
+
+/*
+ * test _alloc_get_thread_cache
+ */
+UT_CASE_DECLARATION(_alloc_get_thread_cache)
+void test__alloc_get_thread_cache__same_cache(void** state);
+void test__alloc_get_thread_cache__other_thread(void** state);
+
+/*
+ * test _alloc_thread_cache_allocate
+ */
+UT_CASE_DECLARATION(_alloc_thread_cache_allocate)
+void test__alloc_thread_cache_allocate__invalid_size(void** state);
+void test__alloc_thread_cache_allocate__reuse(void** state);
+void test__alloc_thread_cache_allocate__refill_from_depot(void** state);
+
+/*
+ * test _alloc_thread_cache_deallocate
+ */
+UT_CASE_DECLARATION(_alloc_thread_cache_deallocate)
+void test__alloc_thread_cache_deallocate__invalid_memory(void** state);
+void test__alloc_thread_cache_deallocate__other_thread(void** state);
+void test__alloc_thread_cache_deallocate__return_to_depot(void** state);
+void test__alloc_thread_cache_deallocate__concurrent(void** state);
+
+/*
+ * test _alloc_flush_thread_cache
+ */
+UT_CASE_DECLARATION(_alloc_flush_thread_cache)
+void test__alloc_flush_thread_cache__success(void** state);
+void test__alloc_flush_thread_cache__thread_exit(void** state);
+void test__alloc_flush_thread_cache__thread_exit_mempool(void** state);
+
+/*
+ * test _alloc_push_depot
+ */
+UT_CASE_DECLARATION(_alloc_push_depot)
+void test__alloc_push_depot__null_first(void** state);
+void test__alloc_push_depot__null_last(void** state);
+void test__alloc_push_depot__successfully(void** state);
+
+/*
+ * test _alloc_pop_depot
+ */
+UT_CASE_DECLARATION(_alloc_pop_depot)
+void test__alloc_pop_depot__empty(void** state);
+void test__alloc_pop_depot__one_magazine(void** state);
 #endif /* CSTL_MEMORY_MANAGEMENT */
 
 /*
@@ -42,6 +129,16 @@ void test__alloc_malloc__success(void** state);
 UT_CASE_DECLARATION(_alloc_malloc_out_of_memory)
 void test__alloc_malloc_out_of_memory__success(void** state);
 
+/*
+ * test _alloc_allocate_from_region
+ */
+UT_CASE_DECLARATION(_alloc_allocate_from_region)
+void test__alloc_allocate_from_region__invalid_allocator(void** state);
+void test__alloc_allocate_from_region__not_region(void** state);
+void test__alloc_allocate_from_region__zero_size(void** state);
+void test__alloc_allocate_from_region__new_block(void** state);
+void test__alloc_allocate_from_region__large_size(void** state);
+
 #ifdef CSTL_MEMORY_MANAGEMENT
 #   define UT_CSTL_ALLOC_AUX_CASE \
         UT_SUIT_BEGIN(cstl_alloc_aux, test__alloc_get_memory_chunk__invalid_allocator),\
@@ -51,16 +148,58 @@ void test__alloc_malloc_out_of_memory__success(void** state);
         UT_CASE(test__alloc_get_memory_chunk__memory_pool_size_equal_to_0),\
         UT_CASE(test__alloc_get_memory_chunk__memory_pool_size_less_then_one_allocated_chunk),\
         UT_CASE(test__alloc_get_memory_chunk__reallocate_memory_pool_container),\
+        UT_CASE(test__alloc_get_memory_chunk__small_memory_pool_round_down),\
+        UT_CASE(test__alloc_get_memory_chunk__aligned_memory_pool),\
         UT_CASE_BEGIN(_alloc_apply_formated_memory, test__alloc_apply_formated_memory__invalid_allocator),\
         UT_CASE(test__alloc_apply_formated_memory__success),\
+        UT_CASE(test__alloc_apply_formated_memory__large_size),\
+        UT_CASE_BEGIN(_alloc_get_memlink_index, test__alloc_get_memlink_index__invalid_size),\
+        UT_CASE(test__alloc_get_memlink_index__aligned_tier),\
+        UT_CASE(test__alloc_get_memlink_index__upper_tier),\
+        UT_CASE(test__alloc_get_memlink_index__all_size),\
+        UT_CASE_BEGIN(_alloc_get_memlink_size, test__alloc_get_memlink_size__invalid_index),\
+        UT_CASE(test__alloc_get_memlink_size__all_index),\
+        UT_CASE_BEGIN(_alloc_init_pool, test__alloc_init_pool__invalid_allocator),\
+        UT_CASE(test__alloc_init_pool__success),\
+        UT_CASE_BEGIN(_alloc_destroy_pool, test__alloc_destroy_pool__invalid_allocator),\
+        UT_CASE(test__alloc_destroy_pool__success),\
+        UT_CASE_BEGIN(_alloc_get_shared_pool, test__alloc_get_shared_pool__same_pool),\
+        UT_CASE(test__alloc_get_shared_pool__allocate),\
+        UT_CASE_BEGIN(_alloc_get_thread_cache, test__alloc_get_thread_cache__same_cache),\
+        UT_CASE(test__alloc_get_thread_cache__other_thread),\
+        UT_CASE_BEGIN(_alloc_thread_cache_allocate, test__alloc_thread_cache_allocate__invalid_size),\
+        UT_CASE(test__alloc_thread_cache_allocate__reuse),\
+        UT_CASE(test__alloc_thread_cache_allocate__refill_from_depot),\
+        UT_CASE_BEGIN(_alloc_thread_cache_deallocate, test__alloc_thread_cache_deallocate__invalid_memory),\
+        UT_CASE(test__alloc_thread_cache_deallocate__other_thread),\
+        UT_CASE(test__alloc_thread_cache_deallocate__return_to_depot),\
+        UT_CASE(test__alloc_thread_cache_deallocate__concurrent),\
+        UT_CASE_BEGIN(_alloc_flush_thread_cache, test__alloc_flush_thread_cache__success),\
+        UT_CASE(test__alloc_flush_thread_cache__thread_exit),\
+        UT_CASE(test__alloc_flush_thread_cache__thread_exit_mempool),\
+        UT_CASE_BEGIN(_alloc_push_depot, test__alloc_push_depot__null_first),\
+        UT_CASE(test__alloc_push_depot__null_last),\
+        UT_CASE(test__alloc_push_depot__successfully),\
+        UT_CASE_BEGIN(_alloc_pop_depot, test__alloc_pop_depot__empty),\
+        UT_CASE(test__alloc_pop_depot__one_magazine),\
         UT_CASE_BEGIN(_alloc_free, test__alloc_free__invalid_memory),\
         UT_CASE_BEGIN(_alloc_malloc, test__alloc_malloc__success),\
-        UT_CASE_BEGIN(_alloc_malloc_out_of_memory, test__alloc_malloc_out_of_memory__success)
+        UT_CASE_BEGIN(_alloc_malloc_out_of_memory, test__alloc_malloc_out_of_memory__success),\
+        UT_CASE_BEGIN(_alloc_allocate_from_region, test__alloc_allocate_from_region__invalid_allocator),\
+        UT_CASE(test__alloc_allocate_from_region__not_region),\
+        UT_CASE(test__alloc_allocate_from_region__zero_size),\
+        UT_CASE(test__alloc_allocate_from_region__new_block),\
+        UT_CASE(test__alloc_allocate_from_region__large_size)
 #else
 #   define UT_CSTL_ALLOC_AUX_CASE \
         UT_SUIT_BEGIN(cstl_alloc_aux, test__alloc_free__invalid_memory),\
         UT_CASE_BEGIN(_alloc_malloc, test__alloc_malloc__success),\
-        UT_CASE_BEGIN(_alloc_malloc_out_of_memory, test__alloc_malloc_out_of_memory__success)
+        UT_CASE_BEGIN(_alloc_malloc_out_of_memory, test__alloc_malloc_out_of_memory__success),\
+        UT_CASE_BEGIN(_alloc_allocate_from_region, test__alloc_allocate_from_region__invalid_allocator),\
+        UT_CASE(test__alloc_allocate_from_region__not_region),\
+        UT_CASE(test__alloc_allocate_from_region__zero_size),\
+        UT_CASE(test__alloc_allocate_from_region__new_block),\
+        UT_CASE(test__alloc_allocate_from_region__large_size)
 #endif /* CSTL_MEMORY_MANAGEMENT */
 
 #endif /* _UT_CSTL_ALLOC_AUX_H */
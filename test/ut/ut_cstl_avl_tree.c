@@ -1616,6 +1616,50 @@ void test__avl_tree_max_size__non_empty(void** state)
     _avl_tree_destroy(pt_avl_tree);
 }
 
+/*
+ * test _avl_tree_memory_usage
+ */
+UT_CASE_DEFINATION(_avl_tree_memory_usage)
+void test__avl_tree_memory_usage__null_avl_tree(void** state)
+{
+    expect_assert_failure(_avl_tree_memory_usage(NULL));
+}
+
+void test__avl_tree_memory_usage__non_inited(void** state)
+{
+    _avl_tree_t* pt_avl_tree = _create_avl_tree("int");
+    _avl_tree_init(pt_avl_tree, NULL);
+
+    pt_avl_tree->_t_avlroot._un_height = 4;
+    expect_assert_failure(_avl_tree_memory_usage(pt_avl_tree));
+    pt_avl_tree->_t_avlroot._un_height = 0;
+
+    _avl_tree_destroy(pt_avl_tree);
+}
+
+void test__avl_tree_memory_usage__empty(void** state)
+{
+    _avl_tree_t* pt_avl_tree = _create_avl_tree("int");
+    _avl_tree_init(pt_avl_tree, NULL);
+
+    assert_true(_avl_tree_memory_usage(pt_avl_tree) == 0);
+
+    _avl_tree_destroy(pt_avl_tree);
+}
+
+void test__avl_tree_memory_usage__non_empty(void** state)
+{
+    _avl_tree_t* pt_avl_tree = _create_avl_tree("int");
+    int elem = 9;
+
+    _avl_tree_init(pt_avl_tree, NULL);
+    _avl_tree_insert_unique(pt_avl_tree, &elem);
+
+    assert_true(_avl_tree_memory_usage(pt_avl_tree) >= sizeof(int));
+
+    _avl_tree_destroy(pt_avl_tree);
+}
+
 /*
  * test _avl_tree_begin
  */
@@ -1983,6 +2027,152 @@ void test__avl_tree_find__user_define_not_find(void** state)
     _avl_tree_destroy(pt_avl_tree);
 }
 
+/*
+ * test _avl_tree_find_batch
+ */
+UT_CASE_DEFINATION(_avl_tree_find_batch)
+void test__avl_tree_find_batch__null_avl_tree(void** state)
+{
+    const void* acpv_value[1];
+    _avl_tree_iterator_t at_iter[1];
+    int elem = 9;
+
+    acpv_value[0] = &elem;
+    expect_assert_failure(_avl_tree_find_batch(NULL, acpv_value, 1, at_iter));
+}
+
+void test__avl_tree_find_batch__null_values(void** state)
+{
+    _avl_tree_t* pt_avl_tree = _create_avl_tree("int");
+    _avl_tree_iterator_t at_iter[1];
+
+    _avl_tree_init(pt_avl_tree, NULL);
+    expect_assert_failure(_avl_tree_find_batch(pt_avl_tree, NULL, 1, at_iter));
+
+    _avl_tree_destroy(pt_avl_tree);
+}
+
+void test__avl_tree_find_batch__null_result(void** state)
+{
+    _avl_tree_t* pt_avl_tree = _create_avl_tree("int");
+    const void* acpv_value[1];
+    int elem = 9;
+
+    _avl_tree_init(pt_avl_tree, NULL);
+    acpv_value[0] = &elem;
+    expect_assert_failure(_avl_tree_find_batch(pt_avl_tree, acpv_value, 1, NULL));
+
+    _avl_tree_destroy(pt_avl_tree);
+}
+
+void test__avl_tree_find_batch__non_inited(void** state)
+{
+    _avl_tree_t* pt_avl_tree = _create_avl_tree("int");
+    const void* acpv_value[1];
+    _avl_tree_iterator_t at_iter[1];
+    int elem = 9;
+
+    _avl_tree_init(pt_avl_tree, NULL);
+    acpv_value[0] = &elem;
+    pt_avl_tree->_t_avlroot._un_height = 4;
+    expect_assert_failure(_avl_tree_find_batch(pt_avl_tree, acpv_value, 1, at_iter));
+    pt_avl_tree->_t_avlroot._un_height = 0;
+
+    _avl_tree_destroy(pt_avl_tree);
+}
+
+void test__avl_tree_find_batch__empty(void** state)
+{
+    _avl_tree_t* pt_avl_tree = _create_avl_tree("int");
+    const void* acpv_value[2];
+    _avl_tree_iterator_t at_iter[2];
+    int an_elem[2] = {1, 2};
+
+    _avl_tree_init(pt_avl_tree, NULL);
+    acpv_value[0] = &an_elem[0];
+    acpv_value[1] = &an_elem[1];
+    _avl_tree_find_batch(pt_avl_tree, acpv_value, 2, at_iter);
+    assert_true(_avl_tree_iterator_equal(at_iter[0], _avl_tree_end(pt_avl_tree)));
+    assert_true(_avl_tree_iterator_equal(at_iter[1], _avl_tree_end(pt_avl_tree)));
+
+    _avl_tree_destroy(pt_avl_tree);
+}
+
+void test__avl_tree_find_batch__c_builtin(void** state)
+{
+    _avl_tree_t* pt_avl_tree = _create_avl_tree("int");
+    const void* acpv_value[40];
+    _avl_tree_iterator_t at_iter[40];
+    int an_elem[40];
+    int i;
+
+    _avl_tree_init(pt_avl_tree, NULL);
+    for (i = 0; i < 40; i += 2) {
+        _avl_tree_insert_unique(pt_avl_tree, &i);
+    }
+    for (i = 0; i < 40; ++i) {
+        an_elem[i] = 39 - i;
+        acpv_value[i] = &an_elem[i];
+    }
+    _avl_tree_find_batch(pt_avl_tree, acpv_value, 40, at_iter);
+    for (i = 0; i < 40; ++i) {
+        if (an_elem[i] % 2 == 0) {
+            assert_true(*(int*)_avl_tree_iterator_get_pointer(at_iter[i]) == an_elem[i]);
+        } else {
+            assert_true(_avl_tree_iterator_equal(at_iter[i], _avl_tree_end(pt_avl_tree)));
+        }
+    }
+
+    _avl_tree_destroy(pt_avl_tree);
+}
+
+void test__avl_tree_find_batch__cstr(void** state)
+{
+    _avl_tree_t* pt_avl_tree = _create_avl_tree("char*");
+    string_t* pstr_abc = create_string();
+    string_t* pstr_xyz = create_string();
+    const void* acpv_value[2];
+    _avl_tree_iterator_t at_iter[2];
+
+    _avl_tree_init(pt_avl_tree, NULL);
+    string_init_cstr(pstr_abc, "abc");
+    string_init_cstr(pstr_xyz, "xyz");
+    _avl_tree_insert_unique(pt_avl_tree, pstr_abc);
+    acpv_value[0] = pstr_xyz;
+    acpv_value[1] = pstr_abc;
+    _avl_tree_find_batch(pt_avl_tree, acpv_value, 2, at_iter);
+    assert_true(_avl_tree_iterator_equal(at_iter[0], _avl_tree_end(pt_avl_tree)));
+    assert_true(strcmp((char*)_avl_tree_iterator_get_pointer(at_iter[1]), "abc") == 0);
+
+    _avl_tree_destroy(pt_avl_tree);
+    string_destroy(pstr_abc);
+    string_destroy(pstr_xyz);
+}
+
+void test__avl_tree_find_batch__large(void** state)
+{
+    _avl_tree_t* pt_avl_tree = _create_avl_tree("int");
+    const void* acpv_value[1000];
+    _avl_tree_iterator_t at_iter[1000];
+    int an_elem[1000];
+    int i;
+
+    _avl_tree_init(pt_avl_tree, NULL);
+    for (i = 0; i < 1000; i += 3) {
+        _avl_tree_insert_unique(pt_avl_tree, &i);
+    }
+    for (i = 0; i < 1000; ++i) {
+        an_elem[i] = (i * 7) % 1000;
+        acpv_value[i] = &an_elem[i];
+    }
+    _avl_tree_find_batch(pt_avl_tree, acpv_value, 1000, at_iter);
+    for (i = 0; i < 1000; ++i) {
+        assert_true(_avl_tree_iterator_equal(at_iter[i], _avl_tree_find(pt_avl_tree, &an_elem[i])));
+    }
+
+    _avl_tree_destroy(pt_avl_tree);
+}
+
 /*
  * test _avl_tree_clear
  */
@@ -13,6 +13,9 @@
 #include "cstl_avl_tree_aux.h"
 #include "cstl/cstring.h"
 #include "cstl/clist.h"
+#include "cstl/cvector.h"
+#include "cstl/cutility.h"
+#include "cstl_pair_aux.h"
 
 #include "ut_def.h"
 #include "ut_cstl_avl_tree_aux.h"
@@ -2035,3 +2038,61 @@ void test__avl_tree_elem_compare_auxiliary__cstr(void** state)
     string_destroy(pstr_second);
 }
 
+/*
+ * test _avl_tree_init_node_auxiliary
+ */
+UT_CASE_DEFINATION(_avl_tree_init_node_auxiliary)
+void test__avl_tree_init_node_auxiliary__null_avl_tree(void** state)
+{
+    _avlnode_t node;
+    expect_assert_failure(_avl_tree_init_node_auxiliary(NULL, &node));
+}
+
+void test__avl_tree_init_node_auxiliary__null_node(void** state)
+{
+    _avl_tree_t* pt_avl_tree = _create_avl_tree("int");
+    _avl_tree_init(pt_avl_tree, NULL);
+
+    expect_assert_failure(_avl_tree_init_node_auxiliary(pt_avl_tree, NULL));
+
+    _avl_tree_destroy(pt_avl_tree);
+}
+
+void test__avl_tree_init_node_auxiliary__c_builtin(void** state)
+{
+    _avlnode_t* p = NULL;
+    _avl_tree_t* pt_avl_tree = _create_avl_tree("int");
+    _avl_tree_init(pt_avl_tree, NULL);
+    p = malloc(pt_avl_tree->_t_nodesize);
+
+    assert_true(pt_avl_tree->_t_nodesize == _AVL_TREE_NODE_SIZE(_GET_AVL_TREE_TYPE_SIZE(pt_avl_tree)));
+    *(int*)p->_pby_data = 100;
+    _avl_tree_init_node_auxiliary(pt_avl_tree, p);
+    assert_true(*(int*)p->_pby_data == 0);
+
+    free(p);
+    _avl_tree_destroy(pt_avl_tree);
+}
+
+void test__avl_tree_init_node_auxiliary__pair(void** state)
+{
+    _avlnode_t* p = NULL;
+    pair_t* ppair = NULL;
+    _avl_tree_t* pt_avl_tree = _create_avl_tree("pair_t<int, vector_t<int>>");
+    _avl_tree_init(pt_avl_tree, NULL);
+    p = malloc(pt_avl_tree->_t_nodesize);
+
+    assert_true(pt_avl_tree->_t_nodesize ==
+        _AVL_TREE_NODE_SIZE(_GET_AVL_TREE_TYPE_SIZE(pt_avl_tree)) + _pair_get_inline_size(&pt_avl_tree->_t_typeinfo));
+    _avl_tree_init_node_auxiliary(pt_avl_tree, p);
+    ppair = (pair_t*)p->_pby_data;
+    assert_true(_pair_is_inited(ppair));
+    assert_true(ppair->_pv_first == (void*)_PAIR_INLINE_STORAGE(ppair));
+    assert_true((_byte_t*)ppair->_pv_second + sizeof(vector_t) <= (_byte_t*)p + pt_avl_tree->_t_nodesize);
+    assert_true(*(int*)pair_first(ppair) == 0);
+    assert_true(vector_empty((vector_t*)pair_second(ppair)));
+
+    _pair_destroy_auxiliary(ppair);
+    free(p);
+    _avl_tree_destroy(pt_avl_tree);
+}
@@ -216,6 +216,15 @@ void test__avl_tree_elem_compare_auxiliary__non_inited(void** state);
 void test__avl_tree_elem_compare_auxiliary__int(void** state);
 void test__avl_tree_elem_compare_auxiliary__cstr(void** state);
 
+/*
+ * test _avl_tree_init_node_auxiliary
+ */
+UT_CASE_DECLARATION(_avl_tree_init_node_auxiliary)
+void test__avl_tree_init_node_auxiliary__null_avl_tree(void** state);
+void test__avl_tree_init_node_auxiliary__null_node(void** state);
+void test__avl_tree_init_node_auxiliary__c_builtin(void** state);
+void test__avl_tree_init_node_auxiliary__pair(void** state);
+
 #define UT_CSTL_AVL_TREE_AUX_CASE\
     UT_SUIT_BEGIN(cstl_avl_tree_aux, test__avl_tree_is_created__null_avl_tree),\
     UT_CASE(test__avl_tree_is_created__non_inited_allocator),\
@@ -336,7 +345,11 @@ void test__avl_tree_elem_compare_auxiliary__cstr(void** state);
     UT_CASE(test__avl_tree_elem_compare_auxiliary__null_output),\
     UT_CASE(test__avl_tree_elem_compare_auxiliary__non_inited),\
     UT_CASE(test__avl_tree_elem_compare_auxiliary__int),\
-    UT_CASE(test__avl_tree_elem_compare_auxiliary__cstr)
+    UT_CASE(test__avl_tree_elem_compare_auxiliary__cstr),\
+    UT_CASE_BEGIN(_avl_tree_init_node_auxiliary, test__avl_tree_init_node_auxiliary__null_avl_tree),\
+    UT_CASE(test__avl_tree_init_node_auxiliary__null_node),\
+    UT_CASE(test__avl_tree_init_node_auxiliary__c_builtin),\
+    UT_CASE(test__avl_tree_init_node_auxiliary__pair)
 
 #endif /* _UT_CSTL_AVL_TREE_AUX_H_ */
 
@@ -928,9 +928,9 @@ void test__basic_string_clone_representation__cstl_builtin_length_not_0(void** s
     for (i = 0; i < prep->_t_length; ++i) {
         assert_true(*(int*)list_front((list_t*)(_basic_string_rep_get_data(prep) + i * prep->_t_elemsize)) == 111);
     }
+    _basic_string_rep_reduce_shared(prep, _GET_BASIC_STRING_TYPE_DESTROY_FUNCTION(pbstr), &pbstr->_t_typeinfo);
     basic_string_destroy(pbstr);
     list_destroy(plist);
-    _basic_string_rep_reduce_shared(prep, _GET_BASIC_STRING_TYPE_DESTROY_FUNCTION(pbstr), &pbstr->_t_typeinfo);
     /*free(prep);*/
 }
 typedef struct _tag_basic_string_clone_representation
@@ -1002,6 +1002,48 @@ void test_deque_max_size__non_empty(void** state)
     deque_destroy(pdeq);
 }
 
+/*
+ * test deque_memory_usage
+ */
+UT_CASE_DEFINATION(deque_memory_usage)
+void test_deque_memory_usage__null_deque_container(void** state)
+{
+    expect_assert_failure(deque_memory_usage(NULL));
+}
+
+void test_deque_memory_usage__non_inited_deque_container(void** state)
+{
+    deque_t* pdeq = create_deque(int);
+
+    expect_assert_failure(deque_memory_usage(pdeq));
+
+    deque_destroy(pdeq);
+}
+
+void test_deque_memory_usage__empty(void** state)
+{
+    deque_t* pdeq = create_deque(int);
+
+    deque_init(pdeq);
+    assert_true(deque_memory_usage(pdeq) >= sizeof(deque_t));
+
+    deque_destroy(pdeq);
+}
+
+void test_deque_memory_usage__non_empty(void** state)
+{
+    deque_t* pdeq = create_deque(int);
+    int i = 0;
+
+    deque_init(pdeq);
+    for (i = 0; i < 100; ++i) {
+        deque_push_back(pdeq, i);
+    }
+    assert_true(deque_memory_usage(pdeq) >= sizeof(deque_t) + 100 * sizeof(int));
+
+    deque_destroy(pdeq);
+}
+
 /*
  * test deque_begin
  */
@@ -4493,3 +4535,115 @@ void test_deque_resize__successfully_10_resize_1000(void** state)
     deque_destroy(pdeq);
 }
 
+/*
+ * test deque_push_back_ptr
+ */
+UT_CASE_DEFINATION(deque_push_back_ptr)
+void test_deque_push_back_ptr__null_deque(void** state)
+{
+    int elem = 9;
+
+    expect_assert_failure(deque_push_back_ptr(NULL, &elem));
+}
+
+void test_deque_push_back_ptr__c_builtin(void** state)
+{
+    deque_t* pt_deque = create_deque(int);
+    int elem;
+    int i;
+
+    deque_init(pt_deque);
+    for (i = 0; i < 100; ++i) {
+        elem = i;
+        deque_push_back_ptr(pt_deque, &elem);
+        assert_true(*(int*)deque_back(pt_deque) == i);
+    }
+    assert_true(deque_size(pt_deque) == 100);
+
+    deque_destroy(pt_deque);
+}
+
+void test_deque_push_back_ptr__cstr(void** state)
+{
+    deque_t* pt_deque = create_deque(char*);
+
+    deque_init(pt_deque);
+    deque_push_back_ptr(pt_deque, "abc");
+    deque_push_back_ptr(pt_deque, "defg");
+    assert_true(strcmp((char*)deque_back(pt_deque), "defg") == 0);
+    assert_true(deque_size(pt_deque) == 2);
+
+    deque_destroy(pt_deque);
+}
+
+void test_deque_push_back_ptr__libcstl_builtin(void** state)
+{
+    deque_t* pt_deque = create_deque(list_t<int>);
+    list_t* plist_list = create_list(int);
+
+    deque_init(pt_deque);
+    list_init_n(plist_list, 5);
+    deque_push_back_ptr(pt_deque, plist_list);
+    assert_true(list_equal((list_t*)deque_back(pt_deque), plist_list));
+    assert_true((list_t*)deque_back(pt_deque) != plist_list);
+
+    deque_destroy(pt_deque);
+    list_destroy(plist_list);
+}
+
+/*
+ * test deque_push_front_ptr
+ */
+UT_CASE_DEFINATION(deque_push_front_ptr)
+void test_deque_push_front_ptr__null_deque(void** state)
+{
+    int elem = 9;
+
+    expect_assert_failure(deque_push_front_ptr(NULL, &elem));
+}
+
+void test_deque_push_front_ptr__c_builtin(void** state)
+{
+    deque_t* pt_deque = create_deque(int);
+    int elem;
+    int i;
+
+    deque_init(pt_deque);
+    for (i = 0; i < 100; ++i) {
+        elem = i;
+        deque_push_front_ptr(pt_deque, &elem);
+        assert_true(*(int*)deque_front(pt_deque) == i);
+    }
+    assert_true(deque_size(pt_deque) == 100);
+
+    deque_destroy(pt_deque);
+}
+
+void test_deque_push_front_ptr__cstr(void** state)
+{
+    deque_t* pt_deque = create_deque(char*);
+
+    deque_init(pt_deque);
+    deque_push_front_ptr(pt_deque, "abc");
+    deque_push_front_ptr(pt_deque, "defg");
+    assert_true(strcmp((char*)deque_front(pt_deque), "defg") == 0);
+    assert_true(deque_size(pt_deque) == 2);
+
+    deque_destroy(pt_deque);
+}
+
+void test_deque_push_front_ptr__libcstl_builtin(void** state)
+{
+    deque_t* pt_deque = create_deque(list_t<int>);
+    list_t* plist_list = create_list(int);
+
+    deque_init(pt_deque);
+    list_init_n(plist_list, 5);
+    deque_push_front_ptr(pt_deque, plist_list);
+    assert_true(list_equal((list_t*)deque_front(pt_deque), plist_list));
+    assert_true((list_t*)deque_front(pt_deque) != plist_list);
+
+    deque_destroy(pt_deque);
+    list_destroy(plist_list);
+}
+
@@ -99,6 +99,14 @@ void test_deque_max_size__null_deque_container(void** state);
 void test_deque_max_size__non_inited_deque_container(void** state);
 void test_deque_max_size__empty(void** state);
 void test_deque_max_size__non_empty(void** state);
+/*
+ * test deque_memory_usage
+ */
+UT_CASE_DECLARATION(deque_memory_usage)
+void test_deque_memory_usage__null_deque_container(void** state);
+void test_deque_memory_usage__non_inited_deque_container(void** state);
+void test_deque_memory_usage__empty(void** state);
+void test_deque_memory_usage__non_empty(void** state);
 /*
  * test deque_begin
  */
@@ -405,6 +413,22 @@ void test_deque_resize__successfully_10_resize_0(void** state);
 void test_deque_resize__successfully_10_resize_10(void** state);
 void test_deque_resize__successfully_10_resize_1000(void** state);
 
+/*
+ * test deque_push_back_ptr
+ */
+UT_CASE_DECLARATION(deque_push_back_ptr)
+void test_deque_push_back_ptr__null_deque(void** state);
+void test_deque_push_back_ptr__c_builtin(void** state);
+void test_deque_push_back_ptr__cstr(void** state);
+void test_deque_push_back_ptr__libcstl_builtin(void** state);
+/*
+ * test deque_push_front_ptr
+ */
+UT_CASE_DECLARATION(deque_push_front_ptr)
+void test_deque_push_front_ptr__null_deque(void** state);
+void test_deque_push_front_ptr__c_builtin(void** state);
+void test_deque_push_front_ptr__cstr(void** state);
+void test_deque_push_front_ptr__libcstl_builtin(void** state);
 #define UT_CSTL_DEQUE_CASE\
     UT_SUIT_BEGIN(cstl_deque, test_deque_init__null_deque_container),\
     UT_CASE(test_deque_init__non_created_deque_container),\
@@ -466,6 +490,10 @@ void test_deque_resize__successfully_10_resize_1000(void** state);
     UT_CASE(test_deque_max_size__non_inited_deque_container),\
     UT_CASE(test_deque_max_size__empty),\
     UT_CASE(test_deque_max_size__non_empty),\
+    UT_CASE_BEGIN(deque_memory_usage, test_deque_memory_usage__null_deque_container),\
+    UT_CASE(test_deque_memory_usage__non_inited_deque_container),\
+    UT_CASE(test_deque_memory_usage__empty),\
+    UT_CASE(test_deque_memory_usage__non_empty),\
     UT_CASE_BEGIN(deque_begin, test_deque_begin__null_deque_container),\
     UT_CASE(test_deque_begin__non_inited_deque_container),\
     UT_CASE(test_deque_begin__empty),\
@@ -678,7 +706,15 @@ void test_deque_resize__successfully_10_resize_1000(void** state);
     UT_CASE(test_deque_resize__successfully_0_resize_10),\
     UT_CASE(test_deque_resize__successfully_10_resize_0),\
     UT_CASE(test_deque_resize__successfully_10_resize_10),\
-    UT_CASE(test_deque_resize__successfully_10_resize_1000)
+    UT_CASE(test_deque_resize__successfully_10_resize_1000),\
+    UT_CASE_BEGIN(deque_push_back_ptr, test_deque_push_back_ptr__null_deque),\
+    UT_CASE(test_deque_push_back_ptr__c_builtin),\
+    UT_CASE(test_deque_push_back_ptr__cstr),\
+    UT_CASE(test_deque_push_back_ptr__libcstl_builtin),\
+    UT_CASE_BEGIN(deque_push_front_ptr, test_deque_push_front_ptr__null_deque),\
+    UT_CASE(test_deque_push_front_ptr__c_builtin),\
+    UT_CASE(test_deque_push_front_ptr__cstr),\
+    UT_CASE(test_deque_push_front_ptr__libcstl_builtin)
 
 #endif /* _UT_CSTL_DEQUE_H_ */
 
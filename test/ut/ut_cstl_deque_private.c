@@ -80,6 +80,58 @@ void test__create_deque__user_defined_type_dup(void** state)
     deque_destroy(pdeq);
 }
 
+/*
+ * test _create_deque_with_allocator
+ */
+UT_CASE_DEFINATION(_create_deque_with_allocator)
+static void* _create_deque_with_allocator__allocate(void* pv_context, size_t t_size)
+{
+    ((size_t*)pv_context)[0]++;
+    return malloc(t_size);
+}
+
+static void _create_deque_with_allocator__deallocate(void* pv_context, void* pv_mem, size_t t_size)
+{
+    ((size_t*)pv_context)[1]++;
+    free(pv_mem);
+}
+
+void test__create_deque_with_allocator__null_allocator(void** state)
+{
+    expect_assert_failure(_create_deque_with_allocator(NULL, "int"));
+}
+
+void test__create_deque_with_allocator__unregisted_type(void** state)
+{
+    size_t at_count[2] = {0, 0};
+    allocator_t t_allocator = {_create_deque_with_allocator__allocate, _create_deque_with_allocator__deallocate, NULL};
+
+    t_allocator._pv_context = at_count;
+    assert_true(_create_deque_with_allocator(&t_allocator, "unregisted_type_t") == NULL);
+    assert_true(at_count[0] == 0 && at_count[1] == 0);
+}
+
+void test__create_deque_with_allocator__allocate_by_allocator(void** state)
+{
+    size_t at_count[2] = {0, 0};
+    allocator_t t_allocator = {_create_deque_with_allocator__allocate, _create_deque_with_allocator__deallocate, NULL};
+    deque_t* pdeq = NULL;
+    int i = 0;
+
+    t_allocator._pv_context = at_count;
+    pdeq = _create_deque_with_allocator(&t_allocator, "int");
+    assert_true(pdeq != NULL);
+    deque_init(pdeq);
+    for (i = 0; i < 100; ++i) {
+        deque_push_back(pdeq, i);
+    }
+    assert_true(deque_size(pdeq) == 100);
+    assert_true(at_count[0] > 0);
+
+    deque_destroy(pdeq);
+    assert_true(at_count[0] == at_count[1]);
+}
+
 /*
  * test _create_deque_auxiliary
  */
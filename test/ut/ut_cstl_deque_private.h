@@ -13,6 +13,13 @@ void test__create_deque__c_builtin_type(void** state);
 void test__create_deque__libcstl_builtin_type(void** state);
 void test__create_deque__user_defined_type(void** state);
 void test__create_deque__user_defined_type_dup(void** state);
+/*
+ * test _create_deque_with_allocator
+ */
+UT_CASE_DECLARATION(_create_deque_with_allocator)
+void test__create_deque_with_allocator__null_allocator(void** state);
+void test__create_deque_with_allocator__unregisted_type(void** state);
+void test__create_deque_with_allocator__allocate_by_allocator(void** state);
 /*
  * test _create_deque_auxiliary
  */
@@ -123,6 +130,9 @@ void test__deque_init_elem_auxiliary__successfully_user_defined(void** state);
     UT_CASE(test__create_deque__libcstl_builtin_type),\
     UT_CASE(test__create_deque__user_defined_type),\
     UT_CASE(test__create_deque__user_defined_type_dup),\
+    UT_CASE_BEGIN(_create_deque_with_allocator, test__create_deque_with_allocator__null_allocator),\
+    UT_CASE(test__create_deque_with_allocator__unregisted_type),\
+    UT_CASE(test__create_deque_with_allocator__allocate_by_allocator),\
     UT_CASE_BEGIN(_create_deque_auxiliary, test__create_deque_auxiliary__null_deque_container),\
     UT_CASE(test__create_deque_auxiliary__null_typename),\
     UT_CASE(test__create_deque_auxiliary__unregisted_type),\
@@ -0,0 +1,766 @@
+#include <stddef.h>
+#include <stdarg.h>
+#include <setjmp.h>
+#include <google/cmockery.h>
+
+#include "cstl/cstl_def.h"
+#include "cstl/cstl_alloc.h"
+#include "cstl/cstl_types.h"
+#include "cstl/citerator.h"
+#include "cstl/cvector.h"
+#include "cstl/cstl_hashtable_iterator.h"
+#include "cstl/cstl_hashtable_private.h"
+#include "cstl/cstl_flat_hashtable_iterator.h"
+#include "cstl/cstl_flat_hashtable_private.h"
+#include "cstl/cstl_flat_hashtable.h"
+#include "cstl_hashtable_aux.h"
+#include "cstl_flat_hashtable_aux.h"
+#include "cstl/cstring.h"
+
+#include "ut_def.h"
+#include "ut_cstl_flat_hashtable.h"
+
+UT_SUIT_DEFINATION(cstl_flat_hashtable, _create_flat_hashtable)
+
+/*
+ * test _create_flat_hashtable
+ */
+UT_CASE_DEFINATION(_create_flat_hashtable)
+void test__create_flat_hashtable__null_typename(void** state)
+{
+    expect_assert_failure(_create_flat_hashtable(NULL));
+}
+
+void test__create_flat_hashtable__c_builtin(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("double");
+    assert_true(_flat_hashtable_is_created(pt_hashtable));
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+void test__create_flat_hashtable__cstr(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("char*");
+    assert_true(_flat_hashtable_is_created(pt_hashtable));
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+void test__create_flat_hashtable__unregister(void** state)
+{
+    assert_true(_create_flat_hashtable("test__create_flat_hashtable__unregister") == NULL);
+}
+
+/*
+ * test _flat_hashtable_init
+ */
+UT_CASE_DEFINATION(_flat_hashtable_init)
+void test__flat_hashtable_init__null_hashtable(void** state)
+{
+    expect_assert_failure(_flat_hashtable_init(NULL, 0, NULL, NULL));
+}
+
+void test__flat_hashtable_init__non_created(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+
+    pt_hashtable->_t_typeinfo._t_style = 9999;
+    expect_assert_failure(_flat_hashtable_init(pt_hashtable, 0, NULL, NULL));
+    pt_hashtable->_t_typeinfo._t_style = _TYPE_C_BUILTIN;
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+void test__flat_hashtable_init__bucket_0(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+
+    _flat_hashtable_init(pt_hashtable, 0, NULL, NULL);
+    assert_true(_flat_hashtable_is_inited(pt_hashtable));
+    assert_true(_flat_hashtable_bucket_count(pt_hashtable) == 64);
+    assert_true(_flat_hashtable_empty(pt_hashtable));
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+void test__flat_hashtable_init__bucket_not_0(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+
+    _flat_hashtable_init(pt_hashtable, 100, NULL, NULL);
+    assert_true(_flat_hashtable_is_inited(pt_hashtable));
+    assert_true(_flat_hashtable_bucket_count(pt_hashtable) == 128);
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+void test__flat_hashtable_init__null_hash(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+
+    _flat_hashtable_init(pt_hashtable, 0, NULL, NULL);
+    assert_true(_flat_hashtable_hash(pt_hashtable) == _hashtable_default_hash);
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+static void _test__flat_hashtable__same_hash(const void* cpv_input, void* pv_output)
+{
+    *(size_t*)pv_output = 7;
+}
+void test__flat_hashtable_init__non_null_hash(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+
+    _flat_hashtable_init(pt_hashtable, 0, _test__flat_hashtable__same_hash, NULL);
+    assert_true(_flat_hashtable_hash(pt_hashtable) == _test__flat_hashtable__same_hash);
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+/*
+ * test _flat_hashtable_insert_unique
+ */
+UT_CASE_DEFINATION(_flat_hashtable_insert_unique)
+void test__flat_hashtable_insert_unique__null_hashtable(void** state)
+{
+    int elem = 9;
+    expect_assert_failure(_flat_hashtable_insert_unique(NULL, &elem));
+}
+
+void test__flat_hashtable_insert_unique__unique(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+    _flat_hashtable_iterator_t it_iter;
+    int elem = 9;
+
+    _flat_hashtable_init(pt_hashtable, 0, NULL, NULL);
+    it_iter = _flat_hashtable_insert_unique(pt_hashtable, &elem);
+    assert_true(*(int*)_flat_hashtable_iterator_get_pointer(it_iter) == 9);
+    assert_true(_flat_hashtable_size(pt_hashtable) == 1);
+    assert_true(_flat_hashtable_count(pt_hashtable, &elem) == 1);
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+void test__flat_hashtable_insert_unique__duplicate(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+    _flat_hashtable_iterator_t it_iter;
+    int elem = 9;
+
+    _flat_hashtable_init(pt_hashtable, 0, NULL, NULL);
+    _flat_hashtable_insert_unique(pt_hashtable, &elem);
+    it_iter = _flat_hashtable_insert_unique(pt_hashtable, &elem);
+    assert_true(_flat_hashtable_iterator_equal(it_iter, _flat_hashtable_end(pt_hashtable)));
+    assert_true(_flat_hashtable_size(pt_hashtable) == 1);
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+void test__flat_hashtable_insert_unique__grow(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+    int i = 0;
+
+    _flat_hashtable_init(pt_hashtable, 16, NULL, NULL);
+    for (i = 0; i < 1000; ++i) {
+        _flat_hashtable_insert_unique(pt_hashtable, &i);
+    }
+    assert_true(_flat_hashtable_is_inited(pt_hashtable));
+    assert_true(_flat_hashtable_size(pt_hashtable) == 1000);
+    assert_true(_flat_hashtable_bucket_count(pt_hashtable) >= 1000 / 7 * 8);
+    for (i = 0; i < 1000; ++i) {
+        assert_true(*(int*)_flat_hashtable_iterator_get_pointer(_flat_hashtable_find(pt_hashtable, &i)) == i);
+    }
+    i = 1000;
+    assert_true(_flat_hashtable_iterator_equal(_flat_hashtable_find(pt_hashtable, &i), _flat_hashtable_end(pt_hashtable)));
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+void test__flat_hashtable_insert_unique__same_hash(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+    int i = 0;
+
+    /* all elements are in the same probe sequence */
+    _flat_hashtable_init(pt_hashtable, 0, _test__flat_hashtable__same_hash, NULL);
+    for (i = 0; i < 100; ++i) {
+        _flat_hashtable_insert_unique(pt_hashtable, &i);
+    }
+    assert_true(_flat_hashtable_size(pt_hashtable) == 100);
+    for (i = 0; i < 100; ++i) {
+        assert_true(_flat_hashtable_count(pt_hashtable, &i) == 1);
+    }
+    i = 100;
+    assert_true(_flat_hashtable_count(pt_hashtable, &i) == 0);
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+void test__flat_hashtable_insert_unique__cstr(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("char*");
+    _flat_hashtable_iterator_t it_iter;
+    string_t* pstr = create_string();
+
+    _flat_hashtable_init(pt_hashtable, 0, NULL, NULL);
+    string_init(pstr);
+    string_assign_cstr(pstr, "aaa");
+    _flat_hashtable_insert_unique(pt_hashtable, pstr);
+    string_assign_cstr(pstr, "ggg");
+    _flat_hashtable_insert_unique(pt_hashtable, pstr);
+    string_assign_cstr(pstr, "linux");
+    _flat_hashtable_insert_unique(pt_hashtable, pstr);
+    string_assign_cstr(pstr, "ggg");
+    it_iter = _flat_hashtable_insert_unique(pt_hashtable, pstr);
+    assert_true(_flat_hashtable_iterator_equal(it_iter, _flat_hashtable_end(pt_hashtable)));
+    assert_true(_flat_hashtable_size(pt_hashtable) == 3);
+    it_iter = _flat_hashtable_find(pt_hashtable, pstr);
+    assert_true(strcmp((char*)_flat_hashtable_iterator_get_pointer(it_iter), "ggg") == 0);
+
+    _flat_hashtable_destroy(pt_hashtable);
+    string_destroy(pstr);
+}
+
+void test__flat_hashtable_insert_unique__grow_relocate(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("vector_t<int>");
+    vector_t* pvec = create_vector(int);
+    _flat_hashtable_iterator_t it_iter;
+    _byte_t* pby_start = NULL;
+    int i = 0;
+
+    _flat_hashtable_init(pt_hashtable, 16, NULL, NULL);
+    vector_init(pvec);
+    vector_push_back(pvec, 0);
+    it_iter = _flat_hashtable_insert_unique(pt_hashtable, pvec);
+    pby_start = ((vector_t*)_flat_hashtable_iterator_get_pointer(it_iter))->_pby_start;
+    for (i = 1; i < 100; ++i) {
+        vector_assign_elem(pvec, 1, i);
+        _flat_hashtable_insert_unique(pt_hashtable, pvec);
+    }
+    assert_true(_flat_hashtable_size(pt_hashtable) == 100);
+    assert_true(_flat_hashtable_bucket_count(pt_hashtable) > 16);
+
+    /* the element is relocated into the new slots, its storage is not copied */
+    vector_assign_elem(pvec, 1, 0);
+    it_iter = _flat_hashtable_find(pt_hashtable, pvec);
+    assert_true(((vector_t*)_flat_hashtable_iterator_get_pointer(it_iter))->_pby_start == pby_start);
+    assert_true(*(int*)vector_at((vector_t*)_flat_hashtable_iterator_get_pointer(it_iter), 0) == 0);
+
+    _flat_hashtable_destroy(pt_hashtable);
+    vector_destroy(pvec);
+}
+
+/*
+ * test _flat_hashtable_find_batch
+ */
+UT_CASE_DEFINATION(_flat_hashtable_find_batch)
+void test__flat_hashtable_find_batch__null_hashtable(void** state)
+{
+    const void* acpv_value[1];
+    _flat_hashtable_iterator_t at_iter[1];
+    int elem = 9;
+
+    acpv_value[0] = &elem;
+    expect_assert_failure(_flat_hashtable_find_batch(NULL, acpv_value, 1, at_iter));
+}
+
+void test__flat_hashtable_find_batch__null_values(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+    _flat_hashtable_iterator_t at_iter[1];
+
+    _flat_hashtable_init(pt_hashtable, 0, NULL, NULL);
+    expect_assert_failure(_flat_hashtable_find_batch(pt_hashtable, NULL, 1, at_iter));
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+void test__flat_hashtable_find_batch__null_result(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+    const void* acpv_value[1];
+    int elem = 9;
+
+    _flat_hashtable_init(pt_hashtable, 0, NULL, NULL);
+    acpv_value[0] = &elem;
+    expect_assert_failure(_flat_hashtable_find_batch(pt_hashtable, acpv_value, 1, NULL));
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+void test__flat_hashtable_find_batch__c_builtin(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+    const void* acpv_value[40];
+    _flat_hashtable_iterator_t at_iter[40];
+    int an_elem[40];
+    int i;
+
+    _flat_hashtable_init(pt_hashtable, 0, NULL, NULL);
+    for (i = 0; i < 40; i += 2) {
+        _flat_hashtable_insert_unique(pt_hashtable, &i);
+    }
+    for (i = 0; i < 40; ++i) {
+        an_elem[i] = i;
+        acpv_value[i] = &an_elem[i];
+    }
+    _flat_hashtable_find_batch(pt_hashtable, acpv_value, 40, at_iter);
+    for (i = 0; i < 40; ++i) {
+        if (i % 2 == 0) {
+            assert_true(*(int*)_flat_hashtable_iterator_get_pointer(at_iter[i]) == i);
+        } else {
+            assert_true(_flat_hashtable_iterator_equal(at_iter[i], _flat_hashtable_end(pt_hashtable)));
+        }
+    }
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+void test__flat_hashtable_find_batch__grow(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+    const void* acpv_value[1001];
+    _flat_hashtable_iterator_t at_iter[1001];
+    int an_elem[1001];
+    int i;
+
+    _flat_hashtable_init(pt_hashtable, 16, NULL, NULL);
+    for (i = 0; i < 1000; ++i) {
+        _flat_hashtable_insert_unique(pt_hashtable, &i);
+    }
+    for (i = 0; i < 1001; ++i) {
+        an_elem[i] = i;
+        acpv_value[i] = &an_elem[i];
+    }
+    _flat_hashtable_find_batch(pt_hashtable, acpv_value, 1001, at_iter);
+    for (i = 0; i < 1001; ++i) {
+        assert_true(_flat_hashtable_iterator_equal(at_iter[i], _flat_hashtable_find(pt_hashtable, &an_elem[i])));
+    }
+    assert_true(_flat_hashtable_iterator_equal(at_iter[1000], _flat_hashtable_end(pt_hashtable)));
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+/*
+ * test _flat_hashtable_erase
+ */
+UT_CASE_DEFINATION(_flat_hashtable_erase)
+void test__flat_hashtable_erase__not_exist(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+    int elem = 9;
+
+    _flat_hashtable_init(pt_hashtable, 0, NULL, NULL);
+    _flat_hashtable_insert_unique(pt_hashtable, &elem);
+    elem = 10;
+    assert_true(_flat_hashtable_erase(pt_hashtable, &elem) == 0);
+    assert_true(_flat_hashtable_size(pt_hashtable) == 1);
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+void test__flat_hashtable_erase__exist(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+    int elem = 9;
+
+    _flat_hashtable_init(pt_hashtable, 0, NULL, NULL);
+    _flat_hashtable_insert_unique(pt_hashtable, &elem);
+    assert_true(_flat_hashtable_erase(pt_hashtable, &elem) == 1);
+    assert_true(_flat_hashtable_empty(pt_hashtable));
+    assert_true(_flat_hashtable_count(pt_hashtable, &elem) == 0);
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+void test__flat_hashtable_erase__half(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+    int i = 0;
+
+    _flat_hashtable_init(pt_hashtable, 0, _test__flat_hashtable__same_hash, NULL);
+    for (i = 0; i < 100; ++i) {
+        _flat_hashtable_insert_unique(pt_hashtable, &i);
+    }
+    for (i = 0; i < 100; i += 2) {
+        assert_true(_flat_hashtable_erase(pt_hashtable, &i) == 1);
+    }
+    assert_true(_flat_hashtable_size(pt_hashtable) == 50);
+    for (i = 0; i < 100; ++i) {
+        assert_true(_flat_hashtable_count(pt_hashtable, &i) == (size_t)(i % 2));
+    }
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+void test__flat_hashtable_erase__reuse_slot(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+    int i = 0;
+    int j = 0;
+
+    /* the erased slots are reused, so the flat hashtable does not grow */
+    _flat_hashtable_init(pt_hashtable, 16, NULL, NULL);
+    for (i = 0; i < 10; ++i) {
+        _flat_hashtable_insert_unique(pt_hashtable, &i);
+    }
+    for (i = 10; i < 10000; ++i) {
+        j = i - 10;
+        _flat_hashtable_erase(pt_hashtable, &j);
+        _flat_hashtable_insert_unique(pt_hashtable, &i);
+    }
+    assert_true(_flat_hashtable_is_inited(pt_hashtable));
+    assert_true(_flat_hashtable_size(pt_hashtable) == 10);
+    assert_true(_flat_hashtable_bucket_count(pt_hashtable) == 16);
+    for (i = 9990; i < 10000; ++i) {
+        assert_true(_flat_hashtable_count(pt_hashtable, &i) == 1);
+    }
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+/*
+ * test _flat_hashtable_iterator
+ */
+UT_CASE_DEFINATION(_flat_hashtable_iterator)
+void test__flat_hashtable_iterator__empty(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+
+    _flat_hashtable_init(pt_hashtable, 0, NULL, NULL);
+    assert_true(_flat_hashtable_iterator_equal(_flat_hashtable_begin(pt_hashtable), _flat_hashtable_end(pt_hashtable)));
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+void test__flat_hashtable_iterator__traverse(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+    _flat_hashtable_iterator_t it_iter;
+    int i = 0;
+    int n_sum = 0;
+
+    _flat_hashtable_init(pt_hashtable, 0, NULL, NULL);
+    for (i = 0; i < 100; ++i) {
+        _flat_hashtable_insert_unique(pt_hashtable, &i);
+    }
+    assert_true(_flat_hashtable_iterator_distance(
+        _flat_hashtable_begin(pt_hashtable), _flat_hashtable_end(pt_hashtable)) == 100);
+    for (it_iter = _flat_hashtable_begin(pt_hashtable);
+         !_flat_hashtable_iterator_equal(it_iter, _flat_hashtable_end(pt_hashtable));
+         it_iter = _flat_hashtable_iterator_next(it_iter)) {
+        n_sum += *(int*)_flat_hashtable_iterator_get_pointer(it_iter);
+    }
+    assert_true(n_sum == 4950);
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+void test__flat_hashtable_iterator__prev(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+    _flat_hashtable_iterator_t it_iter;
+    int i = 0;
+
+    _flat_hashtable_init(pt_hashtable, 0, NULL, NULL);
+    for (i = 0; i < 10; ++i) {
+        _flat_hashtable_insert_unique(pt_hashtable, &i);
+    }
+    it_iter = _flat_hashtable_end(pt_hashtable);
+    for (i = 0; i < 10; ++i) {
+        it_iter = _flat_hashtable_iterator_prev(it_iter);
+    }
+    assert_true(_flat_hashtable_iterator_equal(it_iter, _flat_hashtable_begin(pt_hashtable)));
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+/*
+ * test _flat_hashtable_equal
+ */
+UT_CASE_DEFINATION(_flat_hashtable_equal)
+void test__flat_hashtable_equal__different_order(void** state)
+{
+    _flat_hashtable_t* pt_first = _create_flat_hashtable("int");
+    _flat_hashtable_t* pt_second = _create_flat_hashtable("int");
+    int i = 0;
+
+    _flat_hashtable_init(pt_first, 16, NULL, NULL);
+    _flat_hashtable_init(pt_second, 0, NULL, NULL);
+    for (i = 0; i < 100; ++i) {
+        _flat_hashtable_insert_unique(pt_first, &i);
+    }
+    for (i = 99; i >= 0; --i) {
+        _flat_hashtable_insert_unique(pt_second, &i);
+    }
+    assert_true(_flat_hashtable_equal(pt_first, pt_second));
+    assert_false(_flat_hashtable_less(pt_first, pt_second));
+    assert_false(_flat_hashtable_greater(pt_first, pt_second));
+
+    _flat_hashtable_destroy(pt_first);
+    _flat_hashtable_destroy(pt_second);
+}
+
+void test__flat_hashtable_equal__different_size(void** state)
+{
+    _flat_hashtable_t* pt_first = _create_flat_hashtable("int");
+    _flat_hashtable_t* pt_second = _create_flat_hashtable("int");
+    int elem = 9;
+
+    _flat_hashtable_init(pt_first, 0, NULL, NULL);
+    _flat_hashtable_init(pt_second, 0, NULL, NULL);
+    _flat_hashtable_insert_unique(pt_first, &elem);
+    assert_false(_flat_hashtable_equal(pt_first, pt_second));
+    assert_true(_flat_hashtable_not_equal(pt_first, pt_second));
+
+    _flat_hashtable_destroy(pt_first);
+    _flat_hashtable_destroy(pt_second);
+}
+
+void test__flat_hashtable_equal__different_elem(void** state)
+{
+    _flat_hashtable_t* pt_first = _create_flat_hashtable("int");
+    _flat_hashtable_t* pt_second = _create_flat_hashtable("int");
+    int elem = 9;
+
+    _flat_hashtable_init(pt_first, 0, NULL, NULL);
+    _flat_hashtable_init(pt_second, 0, NULL, NULL);
+    _flat_hashtable_insert_unique(pt_first, &elem);
+    elem = 10;
+    _flat_hashtable_insert_unique(pt_second, &elem);
+    assert_false(_flat_hashtable_equal(pt_first, pt_second));
+
+    _flat_hashtable_destroy(pt_first);
+    _flat_hashtable_destroy(pt_second);
+}
+
+/*
+ * test _flat_hashtable_clear
+ */
+UT_CASE_DEFINATION(_flat_hashtable_clear)
+void test__flat_hashtable_clear__empty(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+
+    _flat_hashtable_init(pt_hashtable, 0, NULL, NULL);
+    _flat_hashtable_clear(pt_hashtable);
+    assert_true(_flat_hashtable_empty(pt_hashtable));
+    assert_true(_flat_hashtable_bucket_count(pt_hashtable) == 64);
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+void test__flat_hashtable_clear__non_empty(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("vector_t<int>");
+    vector_t* pvec = create_vector(int);
+    int i = 0;
+
+    _flat_hashtable_init(pt_hashtable, 0, NULL, NULL);
+    vector_init(pvec);
+    for (i = 0; i < 100; ++i) {
+        vector_push_back(pvec, i);
+        _flat_hashtable_insert_unique(pt_hashtable, pvec);
+    }
+    assert_true(_flat_hashtable_size(pt_hashtable) == 100);
+    _flat_hashtable_clear(pt_hashtable);
+    assert_true(_flat_hashtable_is_inited(pt_hashtable));
+    assert_true(_flat_hashtable_empty(pt_hashtable));
+    assert_true(_flat_hashtable_iterator_equal(_flat_hashtable_begin(pt_hashtable), _flat_hashtable_end(pt_hashtable)));
+
+    _flat_hashtable_destroy(pt_hashtable);
+    vector_destroy(pvec);
+}
+
+/*
+ * test _flat_hashtable_load_factor
+ */
+UT_CASE_DEFINATION(_flat_hashtable_load_factor)
+void test__flat_hashtable_load_factor__empty(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+
+    _flat_hashtable_init(pt_hashtable, 0, NULL, NULL);
+    assert_true(_flat_hashtable_load_factor(pt_hashtable) == 0.0f);
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+void test__flat_hashtable_load_factor__non_empty(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+    int i = 0;
+
+    _flat_hashtable_init(pt_hashtable, 0, NULL, NULL);
+    for (i = 0; i < 32; ++i) {
+        _flat_hashtable_insert_unique(pt_hashtable, &i);
+    }
+    assert_true(_flat_hashtable_bucket_count(pt_hashtable) == 64);
+    assert_true(_flat_hashtable_load_factor(pt_hashtable) == 0.5f);
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+/*
+ * test _flat_hashtable_set_max_load_factor
+ */
+UT_CASE_DEFINATION(_flat_hashtable_set_max_load_factor)
+void test__flat_hashtable_set_max_load_factor__default(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+
+    _flat_hashtable_init(pt_hashtable, 0, NULL, NULL);
+    assert_true(_flat_hashtable_max_load_factor(pt_hashtable) == 0.875f);
+    expect_assert_failure(_flat_hashtable_set_max_load_factor(pt_hashtable, 0.0f));
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+void test__flat_hashtable_set_max_load_factor__less(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+    int i = 0;
+
+    _flat_hashtable_init(pt_hashtable, 0, NULL, NULL);
+    for (i = 0; i < 40; ++i) {
+        _flat_hashtable_insert_unique(pt_hashtable, &i);
+    }
+    assert_true(_flat_hashtable_bucket_count(pt_hashtable) == 64);
+    _flat_hashtable_set_max_load_factor(pt_hashtable, 0.5f);
+    assert_true(_flat_hashtable_max_load_factor(pt_hashtable) == 0.5f);
+    assert_true(_flat_hashtable_bucket_count(pt_hashtable) == 128);
+    for (i = 0; i < 40; ++i) {
+        assert_true(*(int*)_flat_hashtable_iterator_get_pointer(_flat_hashtable_find(pt_hashtable, &i)) == i);
+    }
+    for (i = 40; i < 64; ++i) {
+        _flat_hashtable_insert_unique(pt_hashtable, &i);
+    }
+    assert_true(_flat_hashtable_bucket_count(pt_hashtable) == 128);
+    _flat_hashtable_insert_unique(pt_hashtable, &i);
+    assert_true(_flat_hashtable_bucket_count(pt_hashtable) == 256);
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+void test__flat_hashtable_set_max_load_factor__greater(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+    int i = 0;
+
+    _flat_hashtable_init(pt_hashtable, 0, NULL, NULL);
+    _flat_hashtable_set_max_load_factor(pt_hashtable, 0.25f);
+    for (i = 0; i < 16; ++i) {
+        _flat_hashtable_insert_unique(pt_hashtable, &i);
+    }
+    assert_true(_flat_hashtable_bucket_count(pt_hashtable) == 64);
+    _flat_hashtable_set_max_load_factor(pt_hashtable, 2.0f);
+    for (i = 16; i < 56; ++i) {
+        _flat_hashtable_insert_unique(pt_hashtable, &i);
+    }
+    assert_true(_flat_hashtable_bucket_count(pt_hashtable) == 64);
+    _flat_hashtable_insert_unique(pt_hashtable, &i);
+    assert_true(_flat_hashtable_bucket_count(pt_hashtable) == 128);
+    assert_true(_flat_hashtable_size(pt_hashtable) == 57);
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+void test__flat_hashtable_set_max_load_factor__tiny(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+    int i = 0;
+
+    _flat_hashtable_init(pt_hashtable, 0, NULL, NULL);
+    _flat_hashtable_set_max_load_factor(pt_hashtable, 0.001f);
+    for (i = 0; i < 10; ++i) {
+        _flat_hashtable_insert_unique(pt_hashtable, &i);
+    }
+    assert_true(_flat_hashtable_size(pt_hashtable) == 10);
+    assert_true(_flat_hashtable_bucket_count(pt_hashtable) == 16384);
+    for (i = 0; i < 10; ++i) {
+        assert_true(*(int*)_flat_hashtable_iterator_get_pointer(_flat_hashtable_find(pt_hashtable, &i)) == i);
+    }
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+/*
+ * test _flat_hashtable_reserve
+ */
+UT_CASE_DEFINATION(_flat_hashtable_reserve)
+void test__flat_hashtable_reserve__less(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+
+    _flat_hashtable_init(pt_hashtable, 0, NULL, NULL);
+    _flat_hashtable_reserve(pt_hashtable, 56);
+    assert_true(_flat_hashtable_bucket_count(pt_hashtable) == 64);
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+void test__flat_hashtable_reserve__greater(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+    int i = 0;
+
+    _flat_hashtable_init(pt_hashtable, 0, NULL, NULL);
+    _flat_hashtable_reserve(pt_hashtable, 1000);
+    assert_true(_flat_hashtable_bucket_count(pt_hashtable) == 2048);
+    for (i = 0; i < 1000; ++i) {
+        _flat_hashtable_insert_unique(pt_hashtable, &i);
+    }
+    assert_true(_flat_hashtable_bucket_count(pt_hashtable) == 2048);
+    assert_true(_flat_hashtable_size(pt_hashtable) == 1000);
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+/*
+ * test _flat_hashtable_shrink_to_fit
+ */
+UT_CASE_DEFINATION(_flat_hashtable_shrink_to_fit)
+void test__flat_hashtable_shrink_to_fit__empty(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+    size_t t_usage = 0;
+
+    _flat_hashtable_init(pt_hashtable, 4000, NULL, NULL);
+    t_usage = _flat_hashtable_memory_usage(pt_hashtable);
+    _flat_hashtable_shrink_to_fit(pt_hashtable);
+    assert_true(_flat_hashtable_bucket_count(pt_hashtable) == 16);
+    assert_true(_flat_hashtable_memory_usage(pt_hashtable) < t_usage);
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
+void test__flat_hashtable_shrink_to_fit__shrink(void** state)
+{
+    _flat_hashtable_t* pt_hashtable = _create_flat_hashtable("int");
+    int i = 0;
+
+    _flat_hashtable_init(pt_hashtable, 0, NULL, NULL);
+    for (i = 0; i < 1000; ++i) {
+        _flat_hashtable_insert_unique(pt_hashtable, &i);
+    }
+    for (i = 14; i < 1000; ++i) {
+        _flat_hashtable_erase(pt_hashtable, &i);
+    }
+    _flat_hashtable_shrink_to_fit(pt_hashtable);
+    assert_true(_flat_hashtable_bucket_count(pt_hashtable) == 16);
+    assert_true(_flat_hashtable_size(pt_hashtable) == 14);
+    for (i = 0; i < 14; ++i) {
+        assert_true(*(int*)_flat_hashtable_iterator_get_pointer(_flat_hashtable_find(pt_hashtable, &i)) == i);
+    }
+    _flat_hashtable_insert_unique(pt_hashtable, &i);
+    assert_true(_flat_hashtable_bucket_count(pt_hashtable) == 32);
+    assert_true(_flat_hashtable_size(pt_hashtable) == 15);
+
+    _flat_hashtable_destroy(pt_hashtable);
+}
+
@@ -0,0 +1,145 @@
+#ifndef _UT_CSTL_FLAT_HASHTABLE_H_
+#define _UT_CSTL_FLAT_HASHTABLE_H_
+
+UT_SUIT_DECLARATION(cstl_flat_hashtable)
+/*
+ * test _create_flat_hashtable
+ */
+UT_CASE_DECLARATION(_create_flat_hashtable)
+void test__create_flat_hashtable__null_typename(void** state);
+void test__create_flat_hashtable__c_builtin(void** state);
+void test__create_flat_hashtable__cstr(void** state);
+void test__create_flat_hashtable__unregister(void** state);
+/*
+ * test _flat_hashtable_init
+ */
+UT_CASE_DECLARATION(_flat_hashtable_init)
+void test__flat_hashtable_init__null_hashtable(void** state);
+void test__flat_hashtable_init__non_created(void** state);
+void test__flat_hashtable_init__bucket_0(void** state);
+void test__flat_hashtable_init__bucket_not_0(void** state);
+void test__flat_hashtable_init__null_hash(void** state);
+void test__flat_hashtable_init__non_null_hash(void** state);
+/*
+ * test _flat_hashtable_insert_unique
+ */
+UT_CASE_DECLARATION(_flat_hashtable_insert_unique)
+void test__flat_hashtable_insert_unique__null_hashtable(void** state);
+void test__flat_hashtable_insert_unique__unique(void** state);
+void test__flat_hashtable_insert_unique__duplicate(void** state);
+void test__flat_hashtable_insert_unique__grow(void** state);
+void test__flat_hashtable_insert_unique__same_hash(void** state);
+void test__flat_hashtable_insert_unique__cstr(void** state);
+void test__flat_hashtable_insert_unique__grow_relocate(void** state);
+/*
+ * test _flat_hashtable_find_batch
+ */
+UT_CASE_DECLARATION(_flat_hashtable_find_batch)
+void test__flat_hashtable_find_batch__null_hashtable(void** state);
+void test__flat_hashtable_find_batch__null_values(void** state);
+void test__flat_hashtable_find_batch__null_result(void** state);
+void test__flat_hashtable_find_batch__c_builtin(void** state);
+void test__flat_hashtable_find_batch__grow(void** state);
+/*
+ * test _flat_hashtable_erase
+ */
+UT_CASE_DECLARATION(_flat_hashtable_erase)
+void test__flat_hashtable_erase__not_exist(void** state);
+void test__flat_hashtable_erase__exist(void** state);
+void test__flat_hashtable_erase__half(void** state);
+void test__flat_hashtable_erase__reuse_slot(void** state);
+/*
+ * test _flat_hashtable_iterator
+ */
+UT_CASE_DECLARATION(_flat_hashtable_iterator)
+void test__flat_hashtable_iterator__empty(void** state);
+void test__flat_hashtable_iterator__traverse(void** state);
+void test__flat_hashtable_iterator__prev(void** state);
+/*
+ * test _flat_hashtable_equal
+ */
+UT_CASE_DECLARATION(_flat_hashtable_equal)
+void test__flat_hashtable_equal__different_order(void** state);
+void test__flat_hashtable_equal__different_size(void** state);
+void test__flat_hashtable_equal__different_elem(void** state);
+/*
+ * test _flat_hashtable_clear
+ */
+UT_CASE_DECLARATION(_flat_hashtable_clear)
+void test__flat_hashtable_clear__empty(void** state);
+void test__flat_hashtable_clear__non_empty(void** state);
+
+/*
+ * test _flat_hashtable_load_factor
+ */
+UT_CASE_DECLARATION(_flat_hashtable_load_factor)
+void test__flat_hashtable_load_factor__empty(void** state);
+void test__flat_hashtable_load_factor__non_empty(void** state);
+/*
+ * test _flat_hashtable_set_max_load_factor
+ */
+UT_CASE_DECLARATION(_flat_hashtable_set_max_load_factor)
+void test__flat_hashtable_set_max_load_factor__default(void** state);
+void test__flat_hashtable_set_max_load_factor__less(void** state);
+void test__flat_hashtable_set_max_load_factor__greater(void** state);
+void test__flat_hashtable_set_max_load_factor__tiny(void** state);
+/*
+ * test _flat_hashtable_reserve
+ */
+UT_CASE_DECLARATION(_flat_hashtable_reserve)
+void test__flat_hashtable_reserve__less(void** state);
+void test__flat_hashtable_reserve__greater(void** state);
+/*
+ * test _flat_hashtable_shrink_to_fit
+ */
+UT_CASE_DECLARATION(_flat_hashtable_shrink_to_fit)
+void test__flat_hashtable_shrink_to_fit__empty(void** state);
+void test__flat_hashtable_shrink_to_fit__shrink(void** state);
+#define UT_CSTL_FLAT_HASHTABLE_CASE\
+    UT_SUIT_BEGIN(cstl_flat_hashtable, test__create_flat_hashtable__null_typename),\
+    UT_CASE(test__create_flat_hashtable__c_builtin),\
+    UT_CASE(test__create_flat_hashtable__cstr),\
+    UT_CASE(test__create_flat_hashtable__unregister),\
+    UT_CASE_BEGIN(_flat_hashtable_init, test__flat_hashtable_init__null_hashtable),\
+    UT_CASE(test__flat_hashtable_init__non_created),\
+    UT_CASE(test__flat_hashtable_init__bucket_0),\
+    UT_CASE(test__flat_hashtable_init__bucket_not_0),\
+    UT_CASE(test__flat_hashtable_init__null_hash),\
+    UT_CASE(test__flat_hashtable_init__non_null_hash),\
+    UT_CASE_BEGIN(_flat_hashtable_insert_unique, test__flat_hashtable_insert_unique__null_hashtable),\
+    UT_CASE(test__flat_hashtable_insert_unique__unique),\
+    UT_CASE(test__flat_hashtable_insert_unique__duplicate),\
+    UT_CASE(test__flat_hashtable_insert_unique__grow),\
+    UT_CASE(test__flat_hashtable_insert_unique__same_hash),\
+    UT_CASE(test__flat_hashtable_insert_unique__cstr),\
+    UT_CASE(test__flat_hashtable_insert_unique__grow_relocate),\
+    UT_CASE_BEGIN(_flat_hashtable_find_batch, test__flat_hashtable_find_batch__null_hashtable),\
+    UT_CASE(test__flat_hashtable_find_batch__null_values),\
+    UT_CASE(test__flat_hashtable_find_batch__null_result),\
+    UT_CASE(test__flat_hashtable_find_batch__c_builtin),\
+    UT_CASE(test__flat_hashtable_find_batch__grow),\
+    UT_CASE_BEGIN(_flat_hashtable_erase, test__flat_hashtable_erase__not_exist),\
+    UT_CASE(test__flat_hashtable_erase__exist),\
+    UT_CASE(test__flat_hashtable_erase__half),\
+    UT_CASE(test__flat_hashtable_erase__reuse_slot),\
+    UT_CASE_BEGIN(_flat_hashtable_iterator, test__flat_hashtable_iterator__empty),\
+    UT_CASE(test__flat_hashtable_iterator__traverse),\
+    UT_CASE(test__flat_hashtable_iterator__prev),\
+    UT_CASE_BEGIN(_flat_hashtable_equal, test__flat_hashtable_equal__different_order),\
+    UT_CASE(test__flat_hashtable_equal__different_size),\
+    UT_CASE(test__flat_hashtable_equal__different_elem),\
+    UT_CASE_BEGIN(_flat_hashtable_clear, test__flat_hashtable_clear__empty),\
+    UT_CASE(test__flat_hashtable_clear__non_empty),\
+    UT_CASE_BEGIN(_flat_hashtable_load_factor, test__flat_hashtable_load_factor__empty),\
+    UT_CASE(test__flat_hashtable_load_factor__non_empty),\
+    UT_CASE_BEGIN(_flat_hashtable_set_max_load_factor, test__flat_hashtable_set_max_load_factor__default),\
+    UT_CASE(test__flat_hashtable_set_max_load_factor__less),\
+    UT_CASE(test__flat_hashtable_set_max_load_factor__greater),\
+    UT_CASE(test__flat_hashtable_set_max_load_factor__tiny),\
+    UT_CASE_BEGIN(_flat_hashtable_reserve, test__flat_hashtable_reserve__less),\
+    UT_CASE(test__flat_hashtable_reserve__greater),\
+    UT_CASE_BEGIN(_flat_hashtable_shrink_to_fit, test__flat_hashtable_shrink_to_fit__empty),\
+    UT_CASE(test__flat_hashtable_shrink_to_fit__shrink)
+
+#endif /* _UT_CSTL_FLAT_HASHTABLE_H_ */
+
@@ -16,6 +16,7 @@
 #include "cstl/chash_set.h"
 #include "cstl/calgorithm.h"
 #include "cstl/cfunctional.h"
+#include "cstl_types_builtin.h"
 
 #include "ut_def.h"
 #include "ut_cstl_function_private.h"
@@ -4360,6 +4361,63 @@ void test__fun_get_binary__basic_string_LOGICAL_OR(void** state)
     deque_destroy(pdeq);
 }
 
+/*
+ * test _fun_get_three_way_compare
+ */
+UT_CASE_DEFINATION(_fun_get_three_way_compare)
+void test__fun_get_three_way_compare__invalid_iter(void** state)
+{
+    iterator_t it;
+
+    it._t_iteratortype = 100;
+    expect_assert_failure(_fun_get_three_way_compare(it, fun_less_int));
+}
+
+void test__fun_get_three_way_compare__null_op(void** state)
+{
+    deque_t* pdeq = create_deque(int);
+
+    deque_init(pdeq);
+    assert_true(_fun_get_three_way_compare(deque_begin(pdeq), NULL) == NULL);
+    deque_destroy(pdeq);
+}
+
+void test__fun_get_three_way_compare__int_less(void** state)
+{
+    deque_t* pdeq = create_deque(int);
+
+    deque_init(pdeq);
+    assert_true(_fun_get_three_way_compare(deque_begin(pdeq), fun_less_int) == _type_compare_int);
+    deque_destroy(pdeq);
+}
+
+void test__fun_get_three_way_compare__int_greater(void** state)
+{
+    deque_t* pdeq = create_deque(int);
+
+    deque_init(pdeq);
+    assert_true(_fun_get_three_way_compare(deque_begin(pdeq), fun_greater_int) == NULL);
+    deque_destroy(pdeq);
+}
+
+void test__fun_get_three_way_compare__string_less(void** state)
+{
+    deque_t* pdeq = create_deque(string_t);
+
+    deque_init(pdeq);
+    assert_true(_fun_get_three_way_compare(deque_begin(pdeq), fun_less_string) == _type_compare_string);
+    deque_destroy(pdeq);
+}
+
+void test__fun_get_three_way_compare__vector_less(void** state)
+{
+    deque_t* pdeq = create_deque(vector_t<int>);
+
+    deque_init(pdeq);
+    assert_true(_fun_get_three_way_compare(deque_begin(pdeq), fun_less_vector) == NULL);
+    deque_destroy(pdeq);
+}
+
 #ifndef _MSC_VER
 void test__fun_get_binary__bool_PLUS(void** state)
 {
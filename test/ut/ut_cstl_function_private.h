@@ -486,6 +486,16 @@ void test__fun_get_binary__basic_string_GREATER(void** state);
 void test__fun_get_binary__basic_string_GREATER_EQUAL(void** state);
 void test__fun_get_binary__basic_string_LOGICAL_AND(void** state);
 void test__fun_get_binary__basic_string_LOGICAL_OR(void** state);
+/*
+ * test _fun_get_three_way_compare
+ */
+UT_CASE_DECLARATION(_fun_get_three_way_compare)
+void test__fun_get_three_way_compare__invalid_iter(void** state);
+void test__fun_get_three_way_compare__null_op(void** state);
+void test__fun_get_three_way_compare__int_less(void** state);
+void test__fun_get_three_way_compare__int_greater(void** state);
+void test__fun_get_three_way_compare__string_less(void** state);
+void test__fun_get_three_way_compare__vector_less(void** state);
 #ifndef _MSC_VER
 void test__fun_get_binary__bool_PLUS(void** state);
 void test__fun_get_binary__bool_MINUS(void** state);
@@ -989,7 +999,13 @@ void test__fun_get_binary__ulong_long_LOGICAL_OR(void** state);
     UT_CASE(test__fun_get_binary__basic_string_GREATER),\
     UT_CASE(test__fun_get_binary__basic_string_GREATER_EQUAL),\
     UT_CASE(test__fun_get_binary__basic_string_LOGICAL_AND),\
-    UT_CASE(test__fun_get_binary__basic_string_LOGICAL_OR)
+    UT_CASE(test__fun_get_binary__basic_string_LOGICAL_OR),\
+    UT_CASE_BEGIN(_fun_get_three_way_compare, test__fun_get_three_way_compare__invalid_iter),\
+    UT_CASE(test__fun_get_three_way_compare__null_op),\
+    UT_CASE(test__fun_get_three_way_compare__int_less),\
+    UT_CASE(test__fun_get_three_way_compare__int_greater),\
+    UT_CASE(test__fun_get_three_way_compare__string_less),\
+    UT_CASE(test__fun_get_three_way_compare__vector_less)
 
 #ifndef _MSC_VER
 #define UT_CSTL_FUNCTION_PRIVATE_CASE_C99\
@@ -14,7 +14,9 @@
 #include "cstl/cset.h"
 #include "cstl_vector_aux.h"
 #include "cstl_hashtable_aux.h"
+#include "cstl_flat_hashtable_aux.h"
 #include "cstl_hash_map_aux.h"
+#include "cstl_pair_aux.h"
 
 #include "ut_def.h"
 #include "ut_cstl_hash_map.h"
@@ -58,7 +60,11 @@ void test_hash_map_init__null_compare(void** state)
 
     hash_map_init(pt_hash_map);
     assert_true(_pair_is_inited(&pt_hash_map->_pair_temp));
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_hash_map->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_hash_map->_t_hashtable));
+#endif
 
     hash_map_destroy(pt_hash_map);
 }
@@ -99,9 +105,17 @@ void test_hash_map_init_ex__0_bucketcount(void** state)
     hash_map_t* pt_hash_map = create_hash_map(int, int);
 
     hash_map_init_ex(pt_hash_map, 0, NULL, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_hash_map->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_hash_map->_t_hashtable));
+#endif
     assert_true(_pair_is_inited(&pt_hash_map->_pair_temp));
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_map_bucket_count(pt_hash_map) == 64);
+#else
     assert_true(hash_map_bucket_count(pt_hash_map) == 53);
+#endif
     assert_true(hash_map_hash(pt_hash_map) == _hash_map_default_hash);
     assert_true(pt_hash_map->_bfun_keycompare == NULL);
     assert_true(pt_hash_map->_pair_temp._bfun_mapkeycompare == NULL);
@@ -114,9 +128,17 @@ void test_hash_map_init_ex__100_bucketcount(void** state)
     hash_map_t* pt_hash_map = create_hash_map(int, int);
 
     hash_map_init_ex(pt_hash_map, 100, NULL, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_hash_map->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_hash_map->_t_hashtable));
+#endif
     assert_true(_pair_is_inited(&pt_hash_map->_pair_temp));
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_map_bucket_count(pt_hash_map) == 128);
+#else
     assert_true(hash_map_bucket_count(pt_hash_map) == 193);
+#endif
     assert_true(hash_map_hash(pt_hash_map) == _hash_map_default_hash);
     assert_true(pt_hash_map->_bfun_keycompare == NULL);
     assert_true(pt_hash_map->_pair_temp._bfun_mapkeycompare == NULL);
@@ -129,9 +151,17 @@ void test_hash_map_init_ex__null_hash(void** state)
     hash_map_t* pt_hash_map = create_hash_map(int, int);
 
     hash_map_init_ex(pt_hash_map, 0, NULL, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_hash_map->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_hash_map->_t_hashtable));
+#endif
     assert_true(_pair_is_inited(&pt_hash_map->_pair_temp));
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_map_bucket_count(pt_hash_map) == 64);
+#else
     assert_true(hash_map_bucket_count(pt_hash_map) == 53);
+#endif
     assert_true(hash_map_hash(pt_hash_map) == _hash_map_default_hash);
     assert_true(pt_hash_map->_bfun_keycompare == NULL);
     assert_true(pt_hash_map->_pair_temp._bfun_mapkeycompare == NULL);
@@ -148,9 +178,17 @@ void test_hash_map_init_ex__non_null_hash(void** state)
     hash_map_t* pt_hash_map = create_hash_map(int, int);
 
     hash_map_init_ex(pt_hash_map, 0, _test_hash_map_init_ex__non_null_hash, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_hash_map->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_hash_map->_t_hashtable));
+#endif
     assert_true(_pair_is_inited(&pt_hash_map->_pair_temp));
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_map_bucket_count(pt_hash_map) == 64);
+#else
     assert_true(hash_map_bucket_count(pt_hash_map) == 53);
+#endif
     assert_true(hash_map_hash(pt_hash_map) == _test_hash_map_init_ex__non_null_hash);
     assert_true(pt_hash_map->_bfun_keycompare == NULL);
     assert_true(pt_hash_map->_pair_temp._bfun_mapkeycompare == NULL);
@@ -163,9 +201,17 @@ void test_hash_map_init_ex__null_compare(void** state)
     hash_map_t* pt_hash_map = create_hash_map(int, int);
 
     hash_map_init_ex(pt_hash_map, 0, NULL, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_hash_map->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_hash_map->_t_hashtable));
+#endif
     assert_true(_pair_is_inited(&pt_hash_map->_pair_temp));
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_map_bucket_count(pt_hash_map) == 64);
+#else
     assert_true(hash_map_bucket_count(pt_hash_map) == 53);
+#endif
     assert_true(hash_map_hash(pt_hash_map) == _hash_map_default_hash);
     assert_true(pt_hash_map->_bfun_keycompare == NULL);
     assert_true(pt_hash_map->_pair_temp._bfun_mapkeycompare == NULL);
@@ -182,9 +228,17 @@ void test_hash_map_init_ex__non_null_compare(void** state)
     hash_map_t* pt_hash_map = create_hash_map(int, int);
 
     hash_map_init_ex(pt_hash_map, 0, NULL, _test_hash_map_init_ex__non_null_compare);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_hash_map->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_hash_map->_t_hashtable));
+#endif
     assert_true(_pair_is_inited(&pt_hash_map->_pair_temp));
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_map_bucket_count(pt_hash_map) == 64);
+#else
     assert_true(hash_map_bucket_count(pt_hash_map) == 53);
+#endif
     assert_true(hash_map_hash(pt_hash_map) == _hash_map_default_hash);
     assert_true(pt_hash_map->_bfun_keycompare == _test_hash_map_init_ex__non_null_compare);
     assert_true(pt_hash_map->_pair_temp._bfun_mapkeycompare == _test_hash_map_init_ex__non_null_compare);
@@ -292,7 +346,11 @@ void test_hash_map_init_copy__empty(void** state)
 
     hash_map_init(pt_src);
     hash_map_init_copy(pt_dest, pt_src);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(_pair_is_inited(&pt_dest->_pair_temp));
     assert_true(hash_map_empty(pt_dest));
 
@@ -311,7 +369,11 @@ void test_hash_map_init_copy__non_empty(void** state)
     pair_init_elem(pt_pair, elem, elem);
     hash_map_insert(pt_src, pt_pair);
     hash_map_init_copy(pt_dest, pt_src);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(_pair_is_inited(&pt_dest->_pair_temp));
     assert_true(hash_map_size(pt_dest) == 1);
 
@@ -331,10 +393,18 @@ void test_hash_map_init_copy__bucketcount(void** state)
     pair_init_elem(pt_pair, elem, elem);
     hash_map_insert(pt_src, pt_pair);
     hash_map_init_copy(pt_dest, pt_src);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(_pair_is_inited(&pt_dest->_pair_temp));
     assert_true(hash_map_size(pt_dest) == 1);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_map_bucket_count(pt_dest) == 128);
+#else
     assert_true(hash_map_bucket_count(pt_dest) == 193);
+#endif
 
     hash_map_destroy(pt_dest);
     hash_map_destroy(pt_src);
@@ -356,10 +426,18 @@ void test_hash_map_init_copy__non_null_hash(void** state)
     pair_init_elem(pt_pair, elem, elem);
     hash_map_insert(pt_src, pt_pair);
     hash_map_init_copy(pt_dest, pt_src);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(_pair_is_inited(&pt_dest->_pair_temp));
     assert_true(hash_map_size(pt_dest) == 1);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_map_bucket_count(pt_dest) == 64);
+#else
     assert_true(hash_map_bucket_count(pt_dest) == 53);
+#endif
 
     hash_map_destroy(pt_dest);
     hash_map_destroy(pt_src);
@@ -385,7 +463,11 @@ void test_hash_map_init_copy__non_null_compare(void** state)
         hash_map_insert(pt_src, pt_pair);
     }
     hash_map_init_copy(pt_dest, pt_src);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(_pair_is_inited(&pt_dest->_pair_temp));
     assert_true(hash_map_size(pt_dest) == 10);
     assert_true(pt_dest->_bfun_keycompare == _test_hash_map_init_copy__non_null_compare);
@@ -524,7 +606,11 @@ void test_hash_map_init_copy_range__empty(void** state)
     it_begin = hash_map_begin(pt_src);
     it_end = hash_map_end(pt_src);
     hash_map_init_copy_range(pt_dest, it_begin, it_end);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(_pair_is_inited(&pt_dest->_pair_temp));
     assert_true(hash_map_empty(pt_dest));
 
@@ -547,7 +633,11 @@ void test_hash_map_init_copy_range__non_empty(void** state)
     it_begin = hash_map_begin(pt_src);
     it_end = hash_map_end(pt_src);
     hash_map_init_copy_range(pt_dest, it_begin, it_end);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(_pair_is_inited(&pt_dest->_pair_temp));
     assert_true(hash_map_size(pt_dest) == 1);
     assert_true(hash_map_equal(pt_dest, pt_src));
@@ -660,7 +750,11 @@ void test_hash_map_init_copy_array__empty(void** state)
         pair_init(apair[i]);
     }
     hash_map_init_copy_array(pt_dest, apair, 0);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(_pair_is_inited(&pt_dest->_pair_temp));
     assert_true(hash_map_empty(pt_dest));
 
@@ -681,7 +775,11 @@ void test_hash_map_init_copy_array__non_empty(void** state)
         pair_init_elem(apair[i], i, i);
     }
     hash_map_init_copy_array(pt_dest, apair, 10);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(_pair_is_inited(&pt_dest->_pair_temp));
     assert_true(hash_map_size(pt_dest) == 10);
 
@@ -704,7 +802,11 @@ void test_hash_map_init_copy_array__non_empty_dup(void** state)
         pair_init_elem(apair[i + 1], i, i);
     }
     hash_map_init_copy_array(pt_dest, apair, 20);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(_pair_is_inited(&pt_dest->_pair_temp));
     assert_true(hash_map_size(pt_dest) == 10);
 
@@ -842,7 +944,11 @@ void test_hash_map_init_copy_range_ex__empty(void** state)
     it_begin = hash_map_begin(pt_src);
     it_end = hash_map_end(pt_src);
     hash_map_init_copy_range_ex(pt_dest, it_begin, it_end, 0, NULL, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(_pair_is_inited(&pt_dest->_pair_temp));
     assert_true(hash_map_empty(pt_dest));
 
@@ -865,7 +971,11 @@ void test_hash_map_init_copy_range_ex__non_empty(void** state)
     it_begin = hash_map_begin(pt_src);
     it_end = hash_map_end(pt_src);
     hash_map_init_copy_range_ex(pt_dest, it_begin, it_end, 0, NULL, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(_pair_is_inited(&pt_dest->_pair_temp));
     assert_true(hash_map_size(pt_dest) == 1);
     assert_true(hash_map_equal(pt_dest, pt_src));
@@ -890,10 +1000,18 @@ void test_hash_map_init_copy_range_ex__bucketcount(void** state)
     it_begin = hash_map_begin(pt_src);
     it_end = hash_map_end(pt_src);
     hash_map_init_copy_range_ex(pt_dest, it_begin, it_end, 100, NULL, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(_pair_is_inited(&pt_dest->_pair_temp));
     assert_true(hash_map_size(pt_dest) == 1);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_map_bucket_count(pt_dest) == 128);
+#else
     assert_true(hash_map_bucket_count(pt_dest) == 193);
+#endif
 
     hash_map_destroy(pt_dest);
     hash_map_destroy(pt_src);
@@ -919,10 +1037,18 @@ void test_hash_map_init_copy_range_ex__hash(void** state)
     it_begin = hash_map_begin(pt_src);
     it_end = hash_map_end(pt_src);
     hash_map_init_copy_range_ex(pt_dest, it_begin, it_end, 0, _test_hash_map_init_copy__hash, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(_pair_is_inited(&pt_dest->_pair_temp));
     assert_true(hash_map_size(pt_dest) == 1);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_map_bucket_count(pt_dest) == 64);
+#else
     assert_true(hash_map_bucket_count(pt_dest) == 53);
+#endif
     assert_true(hash_map_hash(pt_dest) == _test_hash_map_init_copy__hash);
 
     hash_map_destroy(pt_dest);
@@ -949,7 +1075,11 @@ void test_hash_map_init_copy_range_ex__compare(void** state)
     it_begin = hash_map_begin(pt_src);
     it_end = hash_map_end(pt_src);
     hash_map_init_copy_range_ex(pt_dest, it_begin, it_end, 0, NULL, _test__hash_map_init_compare_range_ex__compare);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(_pair_is_inited(&pt_dest->_pair_temp));
     assert_true(hash_map_size(pt_dest) == 1);
     assert_true(pt_dest->_bfun_keycompare == _test__hash_map_init_compare_range_ex__compare);
@@ -1063,7 +1193,11 @@ void test_hash_map_init_copy_array_ex__empty(void** state)
         pair_init_elem(apair[i], i, i);
     }
     hash_map_init_copy_array_ex(pt_dest, apair, 0, 0, NULL, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(_pair_is_inited(&pt_dest->_pair_temp));
     assert_true(hash_map_empty(pt_dest));
 
@@ -1084,7 +1218,11 @@ void test_hash_map_init_copy_array_ex__non_empty(void** state)
         pair_init_elem(apair[i], i, i);
     }
     hash_map_init_copy_array_ex(pt_dest, apair, 10, 0, NULL, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(_pair_is_inited(&pt_dest->_pair_temp));
     assert_true(hash_map_size(pt_dest) == 10);
 
@@ -1107,7 +1245,11 @@ void test_hash_map_init_copy_array_ex__non_empty_dup(void** state)
         pair_init_elem(apair[i + 1], i, i);
     }
     hash_map_init_copy_array_ex(pt_dest, apair, 20, 0, NULL, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(_pair_is_inited(&pt_dest->_pair_temp));
     assert_true(hash_map_size(pt_dest) == 10);
 
@@ -1128,10 +1270,18 @@ void test_hash_map_init_copy_array_ex__bucketcount(void** state)
         pair_init_elem(apair[i], i, i);
     }
     hash_map_init_copy_array_ex(pt_dest, apair, 10, 100, NULL, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(_pair_is_inited(&pt_dest->_pair_temp));
     assert_true(hash_map_size(pt_dest) == 10);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_map_bucket_count(pt_dest) == 128);
+#else
     assert_true(hash_map_bucket_count(pt_dest) == 193);
+#endif
 
     hash_map_destroy(pt_dest);
     for (i = 0; i < 10; ++i) {
@@ -1150,10 +1300,18 @@ void test_hash_map_init_copy_array_ex__hash(void** state)
         pair_init_elem(apair[i], i, i);
     }
     hash_map_init_copy_array_ex(pt_dest, apair, 10, 0, _test_hash_map_init_copy__hash, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(_pair_is_inited(&pt_dest->_pair_temp));
     assert_true(hash_map_size(pt_dest) == 10);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_map_bucket_count(pt_dest) == 64);
+#else
     assert_true(hash_map_bucket_count(pt_dest) == 53);
+#endif
     assert_true(hash_map_hash(pt_dest) == _test_hash_map_init_copy__hash);
 
     hash_map_destroy(pt_dest);
@@ -1177,7 +1335,11 @@ void test_hash_map_init_copy_array_ex__compare(void** state)
         pair_init_elem(apair[i], i, i);
     }
     hash_map_init_copy_array_ex(pt_dest, apair, 10, 0, NULL, _test__hash_map_init_compare_array_ex__compare);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(_pair_is_inited(&pt_dest->_pair_temp));
     assert_true(hash_map_size(pt_dest) == 10);
     assert_true(pt_dest->_bfun_keycompare == _test__hash_map_init_compare_array_ex__compare);
@@ -1683,6 +1845,97 @@ void test_hash_map_max_size__non_empty(void** state)
     pair_destroy(pt_pair);
 }
 
+/*
+ * test hash_map_memory_usage
+ */
+UT_CASE_DEFINATION(hash_map_memory_usage)
+void test_hash_map_memory_usage__null_hash_map(void** state)
+{
+    expect_assert_failure(hash_map_memory_usage(NULL));
+}
+
+void test_hash_map_memory_usage__non_inited(void** state)
+{
+    hash_map_t* pt_hash_map = create_hash_map(int, int);
+    hash_map_init(pt_hash_map);
+
+    pt_hash_map->_pair_temp._t_typeinfofirst._t_style = 999;
+    expect_assert_failure(hash_map_memory_usage(pt_hash_map));
+    pt_hash_map->_pair_temp._t_typeinfofirst._t_style = _TYPE_C_BUILTIN;
+
+    hash_map_destroy(pt_hash_map);
+}
+
+void test_hash_map_memory_usage__non_inited_pair(void** state)
+{
+    hash_map_t* pt_hash_map = create_hash_map(int, int);
+    void* pv_tmp = NULL;
+    hash_map_init(pt_hash_map);
+
+    pv_tmp = pt_hash_map->_pair_temp._pv_first;
+    pt_hash_map->_pair_temp._pv_first = NULL;
+    expect_assert_failure(hash_map_memory_usage(pt_hash_map));
+    pt_hash_map->_pair_temp._pv_first = pv_tmp;
+
+    hash_map_destroy(pt_hash_map);
+}
+
+void test_hash_map_memory_usage__empty(void** state)
+{
+    hash_map_t* pt_hash_map = create_hash_map(int, int);
+    hash_map_init(pt_hash_map);
+
+    assert_true(hash_map_memory_usage(pt_hash_map) >= sizeof(hash_map_t));
+
+    hash_map_destroy(pt_hash_map);
+}
+
+void test_hash_map_memory_usage__non_empty(void** state)
+{
+    hash_map_t* pt_hash_map = create_hash_map(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    size_t t_usage = 0;
+    int i = 0;
+
+    hash_map_init(pt_hash_map);
+    pair_init(pt_pair);
+    t_usage = hash_map_memory_usage(pt_hash_map);
+    for (i = 0; i < 100; ++i) {
+        pair_make(pt_pair, i, i);
+        hash_map_insert(pt_hash_map, pt_pair);
+    }
+    assert_true(hash_map_memory_usage(pt_hash_map) >= t_usage + 100 * 2 * sizeof(int));
+
+    hash_map_destroy(pt_hash_map);
+    pair_destroy(pt_pair);
+}
+
+void test_hash_map_memory_usage__inline_pair(void** state)
+{
+    hash_map_t* pt_hash_map = create_hash_map(int, double);
+    pair_t* pt_pair = create_pair(int, double);
+    size_t t_usage = 0;
+    int i = 0;
+
+    hash_map_init(pt_hash_map);
+    pair_init(pt_pair);
+    for (i = 0; i < 100; ++i) {
+        pair_make(pt_pair, i, 1.5);
+        hash_map_insert(pt_hash_map, pt_pair);
+    }
+#ifdef CSTL_HASH_FLAT_TABLE
+    /* the key and value of each pair in slot and of the temporary pair are in separate blocks */
+    t_usage = _flat_hashtable_memory_usage(&pt_hash_map->_t_hashtable) + 101 * _PAIR_STORAGE_SIZE(sizeof(int), sizeof(double));
+#else
+    /* the key and value in nodes are counted by hashtable, only the temporary pair is added */
+    t_usage = _hashtable_memory_usage(&pt_hash_map->_t_hashtable) + _PAIR_STORAGE_SIZE(sizeof(int), sizeof(double));
+#endif
+    assert_true(hash_map_memory_usage(pt_hash_map) == sizeof(hash_map_t) + t_usage);
+
+    hash_map_destroy(pt_hash_map);
+    pair_destroy(pt_pair);
+}
+
 /*
  * test hash_map_bucket_count
  */
@@ -1723,7 +1976,11 @@ void test_hash_map_bucket_count__0(void** state)
     hash_map_t* pt_hash_map = create_hash_map(int, int);
     hash_map_init_ex(pt_hash_map, 0, NULL, NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_map_bucket_count(pt_hash_map) == 64);
+#else
     assert_true(hash_map_bucket_count(pt_hash_map) == 53);
+#endif
 
     hash_map_destroy(pt_hash_map);
 }
@@ -1733,7 +1990,11 @@ void test_hash_map_bucket_count__100(void** state)
     hash_map_t* pt_hash_map = create_hash_map(int, int);
     hash_map_init_ex(pt_hash_map, 100, NULL, NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_map_bucket_count(pt_hash_map) == 128);
+#else
     assert_true(hash_map_bucket_count(pt_hash_map) == 193);
+#endif
 
     hash_map_destroy(pt_hash_map);
 }
@@ -2334,7 +2595,11 @@ void test_hash_map_equal__bucketcount_not_equal(void** state)
         hash_map_insert(pt_second, pt_pair);
     }
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_map_equal(pt_first, pt_second));
+#else
     assert_false(hash_map_equal(pt_first, pt_second));
+#endif
 
     hash_map_destroy(pt_first);
     hash_map_destroy(pt_second);
@@ -2688,7 +2953,11 @@ void test_hash_map_not_equal__bucketcount_not_equal(void** state)
         hash_map_insert(pt_second, pt_pair);
     }
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_false(hash_map_not_equal(pt_first, pt_second));
+#else
     assert_true(hash_map_not_equal(pt_first, pt_second));
+#endif
 
     hash_map_destroy(pt_first);
     hash_map_destroy(pt_second);
@@ -3042,7 +3311,11 @@ void test_hash_map_less__bucketcount_not_equal(void** state)
         hash_map_insert(pt_second, pt_pair);
     }
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_false(hash_map_less(pt_first, pt_second));
+#else
     expect_assert_failure(hash_map_less(pt_first, pt_second));
+#endif
 
     hash_map_destroy(pt_first);
     hash_map_destroy(pt_second);
@@ -3396,7 +3669,11 @@ void test_hash_map_less_equal__bucketcount_not_equal(void** state)
         hash_map_insert(pt_second, pt_pair);
     }
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_map_less_equal(pt_first, pt_second));
+#else
     expect_assert_failure(hash_map_less_equal(pt_first, pt_second));
+#endif
 
     hash_map_destroy(pt_first);
     hash_map_destroy(pt_second);
@@ -3750,7 +4027,11 @@ void test_hash_map_greater__bucketcount_not_equal(void** state)
         hash_map_insert(pt_second, pt_pair);
     }
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_false(hash_map_greater(pt_first, pt_second));
+#else
     expect_assert_failure(hash_map_greater(pt_first, pt_second));
+#endif
 
     hash_map_destroy(pt_first);
     hash_map_destroy(pt_second);
@@ -4104,7 +4385,11 @@ void test_hash_map_greater_equal__bucketcount_not_equal(void** state)
         hash_map_insert(pt_second, pt_pair);
     }
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_map_greater_equal(pt_first, pt_second));
+#else
     expect_assert_failure(hash_map_greater_equal(pt_first, pt_second));
+#endif
 
     hash_map_destroy(pt_first);
     hash_map_destroy(pt_second);
@@ -5373,6 +5658,7 @@ void test_hash_map_erase_pos__begin(void** state)
     pair_t* pt_pair = create_pair(int, int);
     hash_map_iterator_t it_pos;
     int i = 0;
+    int n_expect = 0;
 
     hash_map_init_ex(pt_hash_map, 0, NULL, NULL);
     pair_init(pt_pair);
@@ -5382,11 +5668,11 @@ void test_hash_map_erase_pos__begin(void** state)
         hash_map_insert(pt_hash_map, pt_pair);
     }
     it_pos = hash_map_begin(pt_hash_map);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_pos)) == 0);
+    n_expect = *(int*)pair_first((pair_t*)iterator_get_pointer(iterator_next(it_pos)));
     hash_map_erase_pos(pt_hash_map, it_pos);
     assert_true(hash_map_size(pt_hash_map) == 9);
     it_pos = hash_map_begin(pt_hash_map);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_pos)) == 1);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_pos)) == n_expect);
 
     hash_map_destroy(pt_hash_map);
     pair_destroy(pt_pair);
@@ -5424,6 +5710,7 @@ void test_hash_map_erase_pos__last(void** state)
     pair_t* pt_pair = create_pair(int, int);
     hash_map_iterator_t it_pos;
     int i = 0;
+    int n_expect = 0;
 
     hash_map_init_ex(pt_hash_map, 0, NULL, NULL);
     pair_init(pt_pair);
@@ -5433,11 +5720,11 @@ void test_hash_map_erase_pos__last(void** state)
         hash_map_insert(pt_hash_map, pt_pair);
     }
     it_pos = iterator_prev(hash_map_end(pt_hash_map));
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_pos)) == 9);
+    n_expect = *(int*)pair_first((pair_t*)iterator_get_pointer(iterator_prev(it_pos)));
     hash_map_erase_pos(pt_hash_map, it_pos);
     assert_true(hash_map_size(pt_hash_map) == 9);
     it_pos = iterator_prev(hash_map_end(pt_hash_map));
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_pos)) == 8);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_pos)) == n_expect);
 
     hash_map_destroy(pt_hash_map);
     pair_destroy(pt_pair);
@@ -5587,6 +5874,7 @@ void test_hash_map_erase_range__begin(void** state)
     hash_map_iterator_t it_begin;
     hash_map_iterator_t it_end;
     int i = 0;
+    int n_expect = 0;
 
     hash_map_init_ex(pt_dest, 0, NULL, NULL);
     pair_init(pt_pair);
@@ -5598,9 +5886,10 @@ void test_hash_map_erase_range__begin(void** state)
 
     it_begin = hash_map_begin(pt_dest);
     it_end = iterator_next(it_begin);
+    n_expect = *(int*)pair_first((pair_t*)iterator_get_pointer(iterator_next(it_begin)));
     hash_map_erase_range(pt_dest, it_begin, it_end);
     assert_true(hash_map_size(pt_dest) == 9);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(hash_map_begin(pt_dest))) == 1);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(hash_map_begin(pt_dest))) == n_expect);
 
     hash_map_destroy(pt_dest);
     pair_destroy(pt_pair);
@@ -5613,6 +5902,8 @@ void test_hash_map_erase_range__middle(void** state)
     hash_map_iterator_t it_begin;
     hash_map_iterator_t it_end;
     int i = 0;
+    int n_first = 0;
+    int n_second = 0;
 
     hash_map_init_ex(pt_dest, 0, NULL, NULL);
     pair_init(pt_pair);
@@ -5624,11 +5915,13 @@ void test_hash_map_erase_range__middle(void** state)
 
     it_begin = iterator_next(hash_map_begin(pt_dest));
     it_end = iterator_next(it_begin);
+    n_first = *(int*)pair_first((pair_t*)iterator_get_pointer(iterator_prev(it_begin)));
+    n_second = *(int*)pair_first((pair_t*)iterator_get_pointer(it_end));
     hash_map_erase_range(pt_dest, it_begin, it_end);
     assert_true(hash_map_size(pt_dest) == 9);
     it_begin = hash_map_begin(pt_dest);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_begin)) == 0);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(iterator_next(it_begin))) == 2);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_begin)) == n_first);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(iterator_next(it_begin))) == n_second);
 
     hash_map_destroy(pt_dest);
     pair_destroy(pt_pair);
@@ -5641,6 +5934,7 @@ void test_hash_map_erase_range__end(void** state)
     hash_map_iterator_t it_begin;
     hash_map_iterator_t it_end;
     int i = 0;
+    int n_expect = 0;
 
     hash_map_init_ex(pt_dest, 0, NULL, NULL);
     pair_init(pt_pair);
@@ -5652,10 +5946,11 @@ void test_hash_map_erase_range__end(void** state)
 
     it_end = hash_map_end(pt_dest);
     it_begin = iterator_prev(it_end);
+    n_expect = *(int*)pair_first((pair_t*)iterator_get_pointer(iterator_prev(it_begin)));
     hash_map_erase_range(pt_dest, it_begin, it_end);
     assert_true(hash_map_size(pt_dest) == 9);
     it_end = hash_map_end(pt_dest);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(iterator_prev(it_end))) == 8);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(iterator_prev(it_end))) == n_expect);
 
     hash_map_destroy(pt_dest);
     pair_destroy(pt_pair);
@@ -5731,10 +6026,495 @@ void test_hash_map_resize__resize(void** state)
     hash_map_t* pt_dest = create_hash_map(int, int);
 
     hash_map_init_ex(pt_dest, 0, NULL, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_map_bucket_count(pt_dest) == 64);
+#else
     assert_true(hash_map_bucket_count(pt_dest) == 53);
+#endif
     hash_map_resize(pt_dest, 100);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_map_bucket_count(pt_dest) == 128);
+#else
     assert_true(hash_map_bucket_count(pt_dest) == 193);
+#endif
 
     hash_map_destroy(pt_dest);
 }
 
+/*
+ * test hash_map_load_factor
+ */
+UT_CASE_DEFINATION(hash_map_load_factor)
+void test_hash_map_load_factor__null_hash_map(void** state)
+{
+    expect_assert_failure(hash_map_load_factor(NULL));
+}
+
+void test_hash_map_load_factor__successfully(void** state)
+{
+    hash_map_t* pt_hash_map = create_hash_map(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    int i = 0;
+
+    hash_map_init(pt_hash_map);
+    pair_init(pt_pair);
+    for (i = 0; i < 32; ++i) {
+        pair_make(pt_pair, i, i);
+        hash_map_insert(pt_hash_map, pt_pair);
+    }
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_map_load_factor(pt_hash_map) == 0.5f);
+#else
+    assert_true(hash_map_load_factor(pt_hash_map) == (float)32 / (float)53);
+#endif
+
+    hash_map_destroy(pt_hash_map);
+    pair_destroy(pt_pair);
+}
+
+/*
+ * test hash_map_max_load_factor
+ */
+UT_CASE_DEFINATION(hash_map_max_load_factor)
+void test_hash_map_max_load_factor__null_hash_map(void** state)
+{
+    expect_assert_failure(hash_map_max_load_factor(NULL));
+}
+
+void test_hash_map_max_load_factor__default(void** state)
+{
+    hash_map_t* pt_hash_map = create_hash_map(int, int);
+
+    hash_map_init(pt_hash_map);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_map_max_load_factor(pt_hash_map) == 0.875f);
+#else
+    assert_true(hash_map_max_load_factor(pt_hash_map) == 1.0f);
+#endif
+
+    hash_map_destroy(pt_hash_map);
+}
+
+/*
+ * test hash_map_set_max_load_factor
+ */
+UT_CASE_DEFINATION(hash_map_set_max_load_factor)
+void test_hash_map_set_max_load_factor__null_hash_map(void** state)
+{
+    expect_assert_failure(hash_map_set_max_load_factor(NULL, 1.0f));
+}
+
+void test_hash_map_set_max_load_factor__invalid(void** state)
+{
+    hash_map_t* pt_hash_map = create_hash_map(int, int);
+
+    hash_map_init(pt_hash_map);
+    expect_assert_failure(hash_map_set_max_load_factor(pt_hash_map, 0.0f));
+
+    hash_map_destroy(pt_hash_map);
+}
+
+void test_hash_map_set_max_load_factor__less(void** state)
+{
+    hash_map_t* pt_hash_map = create_hash_map(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    int i = 0;
+
+    hash_map_init(pt_hash_map);
+    pair_init(pt_pair);
+    for (i = 0; i < 50; ++i) {
+        pair_make(pt_pair, i, i);
+        hash_map_insert(pt_hash_map, pt_pair);
+    }
+    hash_map_set_max_load_factor(pt_hash_map, 0.5f);
+    assert_true(hash_map_max_load_factor(pt_hash_map) == 0.5f);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_map_bucket_count(pt_hash_map) == 128);
+#else
+    assert_true(hash_map_bucket_count(pt_hash_map) == 193);
+#endif
+    assert_true(hash_map_size(pt_hash_map) == 50);
+
+    hash_map_destroy(pt_hash_map);
+    pair_destroy(pt_pair);
+}
+
+void test_hash_map_set_max_load_factor__init_copy(void** state)
+{
+    hash_map_t* pt_hash_map = create_hash_map(int, int);
+    hash_map_t* pt_dest = create_hash_map(int, int);
+
+    hash_map_init(pt_hash_map);
+    hash_map_set_max_load_factor(pt_hash_map, 0.5f);
+    hash_map_init_copy(pt_dest, pt_hash_map);
+    assert_true(hash_map_max_load_factor(pt_dest) == 0.5f);
+
+    hash_map_destroy(pt_hash_map);
+    hash_map_destroy(pt_dest);
+}
+
+/*
+ * test hash_map_reserve
+ */
+UT_CASE_DEFINATION(hash_map_reserve)
+void test_hash_map_reserve__null_hash_map(void** state)
+{
+    expect_assert_failure(hash_map_reserve(NULL, 100));
+}
+
+void test_hash_map_reserve__reserve(void** state)
+{
+    hash_map_t* pt_hash_map = create_hash_map(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    int i = 0;
+
+    hash_map_init(pt_hash_map);
+    pair_init(pt_pair);
+    hash_map_reserve(pt_hash_map, 1000);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_map_bucket_count(pt_hash_map) == 2048);
+#else
+    assert_true(hash_map_bucket_count(pt_hash_map) == 1543);
+#endif
+    for (i = 0; i < 1000; ++i) {
+        pair_make(pt_pair, i, i);
+        hash_map_insert(pt_hash_map, pt_pair);
+    }
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_map_bucket_count(pt_hash_map) == 2048);
+#else
+    assert_true(hash_map_bucket_count(pt_hash_map) == 1543);
+#endif
+    assert_true(hash_map_size(pt_hash_map) == 1000);
+
+    hash_map_destroy(pt_hash_map);
+    pair_destroy(pt_pair);
+}
+
+/*
+ * test hash_map_shrink_to_fit
+ */
+UT_CASE_DEFINATION(hash_map_shrink_to_fit)
+void test_hash_map_shrink_to_fit__null_hash_map(void** state)
+{
+    expect_assert_failure(hash_map_shrink_to_fit(NULL));
+}
+
+void test_hash_map_shrink_to_fit__shrink(void** state)
+{
+    hash_map_t* pt_hash_map = create_hash_map(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    int i = 0;
+
+    hash_map_init(pt_hash_map);
+    pair_init(pt_pair);
+    for (i = 0; i < 1000; ++i) {
+        pair_make(pt_pair, i, i);
+        hash_map_insert(pt_hash_map, pt_pair);
+    }
+    for (i = 100; i < 1000; ++i) {
+        hash_map_erase(pt_hash_map, i);
+    }
+    hash_map_shrink_to_fit(pt_hash_map);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_map_bucket_count(pt_hash_map) == 128);
+#else
+    assert_true(hash_map_bucket_count(pt_hash_map) == 193);
+#endif
+    assert_true(hash_map_size(pt_hash_map) == 100);
+    for (i = 0; i < 100; ++i) {
+        assert_true(hash_map_count(pt_hash_map, i) == 1);
+    }
+
+    hash_map_destroy(pt_hash_map);
+    pair_destroy(pt_pair);
+}
+
+/*
+ * test hash_map_find_ptr
+ */
+UT_CASE_DEFINATION(hash_map_find_ptr)
+void test_hash_map_find_ptr__null_hash_map(void** state)
+{
+    int key = 9;
+
+    expect_assert_failure(hash_map_find_ptr(NULL, &key));
+}
+
+void test_hash_map_find_ptr__null_key(void** state)
+{
+    hash_map_t* pt_hash_map = create_hash_map(int, int);
+
+    hash_map_init(pt_hash_map);
+    expect_assert_failure(hash_map_find_ptr(pt_hash_map, NULL));
+
+    hash_map_destroy(pt_hash_map);
+}
+
+void test_hash_map_find_ptr__c_builtin(void** state)
+{
+    hash_map_t* pt_hash_map = create_hash_map(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    hash_map_iterator_t it_iter;
+    int key;
+    int i;
+
+    hash_map_init(pt_hash_map);
+    pair_init(pt_pair);
+    for (i = 0; i < 10; ++i) {
+        pair_make(pt_pair, i, i * 10);
+        hash_map_insert(pt_hash_map, pt_pair);
+    }
+
+    key = 4;
+    it_iter = hash_map_find_ptr(pt_hash_map, &key);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 4);
+    assert_true(*(int*)pair_second((pair_t*)iterator_get_pointer(it_iter)) == 40);
+    key = 42;
+    it_iter = hash_map_find_ptr(pt_hash_map, &key);
+    assert_true(iterator_equal(it_iter, hash_map_end(pt_hash_map)));
+
+    hash_map_destroy(pt_hash_map);
+    pair_destroy(pt_pair);
+}
+
+void test_hash_map_find_ptr__cstr(void** state)
+{
+    hash_map_t* pt_hash_map = create_hash_map(char*, int);
+    pair_t* pt_pair = create_pair(char*, int);
+    hash_map_iterator_t it_iter;
+
+    hash_map_init(pt_hash_map);
+    pair_init(pt_pair);
+    pair_make(pt_pair, "abc", 1);
+    hash_map_insert(pt_hash_map, pt_pair);
+    pair_make(pt_pair, "def", 2);
+    hash_map_insert(pt_hash_map, pt_pair);
+
+    it_iter = hash_map_find_ptr(pt_hash_map, "def");
+    assert_true(*(int*)pair_second((pair_t*)iterator_get_pointer(it_iter)) == 2);
+    it_iter = hash_map_find_ptr(pt_hash_map, "xyz");
+    assert_true(iterator_equal(it_iter, hash_map_end(pt_hash_map)));
+
+    hash_map_destroy(pt_hash_map);
+    pair_destroy(pt_pair);
+}
+
+/*
+ * test hash_map_count_ptr
+ */
+UT_CASE_DEFINATION(hash_map_count_ptr)
+void test_hash_map_count_ptr__null_hash_map(void** state)
+{
+    int key = 9;
+
+    expect_assert_failure(hash_map_count_ptr(NULL, &key));
+}
+
+void test_hash_map_count_ptr__c_builtin(void** state)
+{
+    hash_map_t* pt_hash_map = create_hash_map(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    int key;
+    int i;
+
+    hash_map_init(pt_hash_map);
+    pair_init(pt_pair);
+    for (i = 0; i < 10; ++i) {
+        pair_make(pt_pair, i, i * 10);
+        hash_map_insert(pt_hash_map, pt_pair);
+    }
+    pair_make(pt_pair, 3, 0);
+    hash_map_insert(pt_hash_map, pt_pair);
+
+    key = 3;
+    assert_true(hash_map_count_ptr(pt_hash_map, &key) == 1);
+    key = 42;
+    assert_true(hash_map_count_ptr(pt_hash_map, &key) == 0);
+
+    hash_map_destroy(pt_hash_map);
+    pair_destroy(pt_pair);
+}
+
+/*
+ * test hash_map_find_batch
+ */
+UT_CASE_DEFINATION(hash_map_find_batch)
+void test_hash_map_find_batch__null_hash_map(void** state)
+{
+    int an_key[1] = {9};
+    hash_map_iterator_t at_iter[1];
+
+    expect_assert_failure(hash_map_find_batch(NULL, an_key, 1, at_iter));
+}
+
+void test_hash_map_find_batch__null_keys(void** state)
+{
+    hash_map_t* pt_hash_map = create_hash_map(int, int);
+    hash_map_iterator_t at_iter[1];
+
+    hash_map_init(pt_hash_map);
+    expect_assert_failure(hash_map_find_batch(pt_hash_map, NULL, 1, at_iter));
+
+    hash_map_destroy(pt_hash_map);
+}
+
+void test_hash_map_find_batch__null_result(void** state)
+{
+    hash_map_t* pt_hash_map = create_hash_map(int, int);
+    int an_key[1] = {9};
+
+    hash_map_init(pt_hash_map);
+    expect_assert_failure(hash_map_find_batch(pt_hash_map, an_key, 1, NULL));
+
+    hash_map_destroy(pt_hash_map);
+}
+
+void test_hash_map_find_batch__c_builtin(void** state)
+{
+    hash_map_t* pt_hash_map = create_hash_map(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    int an_key[100];
+    hash_map_iterator_t at_iter[100];
+    int i;
+
+    hash_map_init(pt_hash_map);
+    pair_init(pt_pair);
+    for (i = 0; i < 100; i += 2) {
+        pair_make(pt_pair, i, i * 10);
+        hash_map_insert(pt_hash_map, pt_pair);
+    }
+    for (i = 0; i < 100; ++i) {
+        an_key[i] = 99 - i;
+    }
+
+    hash_map_find_batch(pt_hash_map, an_key, 100, at_iter);
+    for (i = 0; i < 100; ++i) {
+        if (an_key[i] % 2 == 0) {
+            assert_true(*(int*)pair_second((pair_t*)iterator_get_pointer(at_iter[i])) == an_key[i] * 10);
+            assert_true(iterator_equal(at_iter[i], hash_map_find(pt_hash_map, an_key[i])));
+        } else {
+            assert_true(iterator_equal(at_iter[i], hash_map_end(pt_hash_map)));
+        }
+    }
+
+    hash_map_destroy(pt_hash_map);
+    pair_destroy(pt_pair);
+}
+
+void test_hash_map_find_batch__cstr(void** state)
+{
+    hash_map_t* pt_hash_map = create_hash_map(char*, int);
+    pair_t* pt_pair = create_pair(char*, int);
+    const char* as_key[3] = {"def", "xyz", "abc"};
+    hash_map_iterator_t at_iter[3];
+
+    hash_map_init(pt_hash_map);
+    pair_init(pt_pair);
+    pair_make(pt_pair, "abc", 1);
+    hash_map_insert(pt_hash_map, pt_pair);
+    pair_make(pt_pair, "def", 2);
+    hash_map_insert(pt_hash_map, pt_pair);
+
+    hash_map_find_batch(pt_hash_map, as_key, 3, at_iter);
+    assert_true(*(int*)pair_second((pair_t*)iterator_get_pointer(at_iter[0])) == 2);
+    assert_true(iterator_equal(at_iter[1], hash_map_end(pt_hash_map)));
+    assert_true(*(int*)pair_second((pair_t*)iterator_get_pointer(at_iter[2])) == 1);
+
+    hash_map_destroy(pt_hash_map);
+    pair_destroy(pt_pair);
+}
+
+/*
+ * test hash_map_erase_ptr
+ */
+UT_CASE_DEFINATION(hash_map_erase_ptr)
+void test_hash_map_erase_ptr__null_hash_map(void** state)
+{
+    int key = 9;
+
+    expect_assert_failure(hash_map_erase_ptr(NULL, &key));
+}
+
+void test_hash_map_erase_ptr__c_builtin(void** state)
+{
+    hash_map_t* pt_hash_map = create_hash_map(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    int key;
+    int i;
+
+    hash_map_init(pt_hash_map);
+    pair_init(pt_pair);
+    for (i = 0; i < 10; ++i) {
+        pair_make(pt_pair, i, i * 10);
+        hash_map_insert(pt_hash_map, pt_pair);
+    }
+
+    key = 3;
+    assert_true(hash_map_erase_ptr(pt_hash_map, &key) == 1);
+    assert_true(hash_map_size(pt_hash_map) == 9);
+    assert_true(hash_map_erase_ptr(pt_hash_map, &key) == 0);
+
+    hash_map_destroy(pt_hash_map);
+    pair_destroy(pt_pair);
+}
+
+/*
+ * test hash_map_at_ptr
+ */
+UT_CASE_DEFINATION(hash_map_at_ptr)
+void test_hash_map_at_ptr__null_hash_map(void** state)
+{
+    int key = 9;
+
+    expect_assert_failure(hash_map_at_ptr(NULL, &key));
+}
+
+void test_hash_map_at_ptr__null_key(void** state)
+{
+    hash_map_t* pt_hash_map = create_hash_map(int, int);
+
+    hash_map_init(pt_hash_map);
+    expect_assert_failure(hash_map_at_ptr(pt_hash_map, NULL));
+
+    hash_map_destroy(pt_hash_map);
+}
+
+void test_hash_map_at_ptr__c_builtin(void** state)
+{
+    hash_map_t* pt_hash_map = create_hash_map(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    int key;
+    int i;
+
+    hash_map_init(pt_hash_map);
+    pair_init(pt_pair);
+    for (i = 0; i < 10; ++i) {
+        pair_make(pt_pair, i, i * 10);
+        hash_map_insert(pt_hash_map, pt_pair);
+    }
+
+    key = 5;
+    assert_true(*(int*)hash_map_at_ptr(pt_hash_map, &key) == 50);
+    key = 100;
+    *(int*)hash_map_at_ptr(pt_hash_map, &key) = 1000;
+    assert_true(hash_map_size(pt_hash_map) == 11);
+    assert_true(*(int*)hash_map_at(pt_hash_map, 100) == 1000);
+
+    hash_map_destroy(pt_hash_map);
+    pair_destroy(pt_pair);
+}
+
+void test_hash_map_at_ptr__cstr(void** state)
+{
+    hash_map_t* pt_hash_map = create_hash_map(char*, int);
+
+    hash_map_init(pt_hash_map);
+    *(int*)hash_map_at_ptr(pt_hash_map, "key") = 3;
+    assert_true(*(int*)hash_map_at(pt_hash_map, "key") == 3);
+    assert_true(*(int*)hash_map_at_ptr(pt_hash_map, "key") == 3);
+    assert_true(hash_map_size(pt_hash_map) == 1);
+
+    hash_map_destroy(pt_hash_map);
+}
+
@@ -153,6 +153,16 @@ void test_hash_map_max_size__non_inited(void** state);
 void test_hash_map_max_size__non_inited_pair(void** state);
 void test_hash_map_max_size__empty(void** state);
 void test_hash_map_max_size__non_empty(void** state);
+/*
+ * test hash_map_memory_usage
+ */
+UT_CASE_DECLARATION(hash_map_memory_usage)
+void test_hash_map_memory_usage__null_hash_map(void** state);
+void test_hash_map_memory_usage__non_inited(void** state);
+void test_hash_map_memory_usage__non_inited_pair(void** state);
+void test_hash_map_memory_usage__empty(void** state);
+void test_hash_map_memory_usage__non_empty(void** state);
+void test_hash_map_memory_usage__inline_pair(void** state);
 /*
  * test hash_map_bucket_count
  */
@@ -441,6 +451,75 @@ void test_hash_map_resize__non_inited(void** state);
 void test_hash_map_resize__non_inited_pair(void** state);
 void test_hash_map_resize__resize(void** state);
 
+/*
+ * test hash_map_load_factor
+ */
+UT_CASE_DECLARATION(hash_map_load_factor)
+void test_hash_map_load_factor__null_hash_map(void** state);
+void test_hash_map_load_factor__successfully(void** state);
+/*
+ * test hash_map_max_load_factor
+ */
+UT_CASE_DECLARATION(hash_map_max_load_factor)
+void test_hash_map_max_load_factor__null_hash_map(void** state);
+void test_hash_map_max_load_factor__default(void** state);
+/*
+ * test hash_map_set_max_load_factor
+ */
+UT_CASE_DECLARATION(hash_map_set_max_load_factor)
+void test_hash_map_set_max_load_factor__null_hash_map(void** state);
+void test_hash_map_set_max_load_factor__invalid(void** state);
+void test_hash_map_set_max_load_factor__less(void** state);
+void test_hash_map_set_max_load_factor__init_copy(void** state);
+/*
+ * test hash_map_reserve
+ */
+UT_CASE_DECLARATION(hash_map_reserve)
+void test_hash_map_reserve__null_hash_map(void** state);
+void test_hash_map_reserve__reserve(void** state);
+/*
+ * test hash_map_shrink_to_fit
+ */
+UT_CASE_DECLARATION(hash_map_shrink_to_fit)
+void test_hash_map_shrink_to_fit__null_hash_map(void** state);
+void test_hash_map_shrink_to_fit__shrink(void** state);
+/*
+ * test hash_map_find_ptr
+ */
+UT_CASE_DECLARATION(hash_map_find_ptr)
+void test_hash_map_find_ptr__null_hash_map(void** state);
+void test_hash_map_find_ptr__null_key(void** state);
+void test_hash_map_find_ptr__c_builtin(void** state);
+void test_hash_map_find_ptr__cstr(void** state);
+/*
+ * test hash_map_count_ptr
+ */
+UT_CASE_DECLARATION(hash_map_count_ptr)
+void test_hash_map_count_ptr__null_hash_map(void** state);
+void test_hash_map_count_ptr__c_builtin(void** state);
+/*
+ * test hash_map_find_batch
+ */
+UT_CASE_DECLARATION(hash_map_find_batch)
+void test_hash_map_find_batch__null_hash_map(void** state);
+void test_hash_map_find_batch__null_keys(void** state);
+void test_hash_map_find_batch__null_result(void** state);
+void test_hash_map_find_batch__c_builtin(void** state);
+void test_hash_map_find_batch__cstr(void** state);
+/*
+ * test hash_map_erase_ptr
+ */
+UT_CASE_DECLARATION(hash_map_erase_ptr)
+void test_hash_map_erase_ptr__null_hash_map(void** state);
+void test_hash_map_erase_ptr__c_builtin(void** state);
+/*
+ * test hash_map_at_ptr
+ */
+UT_CASE_DECLARATION(hash_map_at_ptr)
+void test_hash_map_at_ptr__null_hash_map(void** state);
+void test_hash_map_at_ptr__null_key(void** state);
+void test_hash_map_at_ptr__c_builtin(void** state);
+void test_hash_map_at_ptr__cstr(void** state);
 #define UT_CSTL_HASH_MAP_CASE\
     UT_SUIT_BEGIN(cstl_hash_map, test_hash_map_init__null_hash_map),\
     UT_CASE(test_hash_map_init__non_created),\
@@ -545,6 +624,12 @@ void test_hash_map_resize__resize(void** state);
     UT_CASE(test_hash_map_max_size__non_inited_pair),\
     UT_CASE(test_hash_map_max_size__empty),\
     UT_CASE(test_hash_map_max_size__non_empty),\
+    UT_CASE_BEGIN(hash_map_memory_usage, test_hash_map_memory_usage__null_hash_map),\
+    UT_CASE(test_hash_map_memory_usage__non_inited),\
+    UT_CASE(test_hash_map_memory_usage__non_inited_pair),\
+    UT_CASE(test_hash_map_memory_usage__empty),\
+    UT_CASE(test_hash_map_memory_usage__non_empty),\
+    UT_CASE(test_hash_map_memory_usage__inline_pair),\
     UT_CASE_BEGIN(hash_map_bucket_count, test_hash_map_bucket_count__null_hash_map),\
     UT_CASE(test_hash_map_bucket_count__non_inited),\
     UT_CASE(test_hash_map_bucket_count__non_inited_pair),\
@@ -752,7 +837,36 @@ void test_hash_map_resize__resize(void** state);
     UT_CASE_BEGIN(hash_map_resize, test_hash_map_resize__null_hash_map),\
     UT_CASE(test_hash_map_resize__non_inited),\
     UT_CASE(test_hash_map_resize__non_inited_pair),\
-    UT_CASE(test_hash_map_resize__resize)
+    UT_CASE(test_hash_map_resize__resize),\
+    UT_CASE_BEGIN(hash_map_load_factor, test_hash_map_load_factor__null_hash_map),\
+    UT_CASE(test_hash_map_load_factor__successfully),\
+    UT_CASE_BEGIN(hash_map_max_load_factor, test_hash_map_max_load_factor__null_hash_map),\
+    UT_CASE(test_hash_map_max_load_factor__default),\
+    UT_CASE_BEGIN(hash_map_set_max_load_factor, test_hash_map_set_max_load_factor__null_hash_map),\
+    UT_CASE(test_hash_map_set_max_load_factor__invalid),\
+    UT_CASE(test_hash_map_set_max_load_factor__less),\
+    UT_CASE(test_hash_map_set_max_load_factor__init_copy),\
+    UT_CASE_BEGIN(hash_map_reserve, test_hash_map_reserve__null_hash_map),\
+    UT_CASE(test_hash_map_reserve__reserve),\
+    UT_CASE_BEGIN(hash_map_shrink_to_fit, test_hash_map_shrink_to_fit__null_hash_map),\
+    UT_CASE(test_hash_map_shrink_to_fit__shrink),\
+    UT_CASE_BEGIN(hash_map_find_ptr, test_hash_map_find_ptr__null_hash_map),\
+    UT_CASE(test_hash_map_find_ptr__null_key),\
+    UT_CASE(test_hash_map_find_ptr__c_builtin),\
+    UT_CASE(test_hash_map_find_ptr__cstr),\
+    UT_CASE_BEGIN(hash_map_count_ptr, test_hash_map_count_ptr__null_hash_map),\
+    UT_CASE(test_hash_map_count_ptr__c_builtin),\
+    UT_CASE_BEGIN(hash_map_find_batch, test_hash_map_find_batch__null_hash_map),\
+    UT_CASE(test_hash_map_find_batch__null_keys),\
+    UT_CASE(test_hash_map_find_batch__null_result),\
+    UT_CASE(test_hash_map_find_batch__c_builtin),\
+    UT_CASE(test_hash_map_find_batch__cstr),\
+    UT_CASE_BEGIN(hash_map_erase_ptr, test_hash_map_erase_ptr__null_hash_map),\
+    UT_CASE(test_hash_map_erase_ptr__c_builtin),\
+    UT_CASE_BEGIN(hash_map_at_ptr, test_hash_map_at_ptr__null_hash_map),\
+    UT_CASE(test_hash_map_at_ptr__null_key),\
+    UT_CASE(test_hash_map_at_ptr__c_builtin),\
+    UT_CASE(test_hash_map_at_ptr__cstr)
 
 #endif /* _UT_CSTL_HASH_MAP_H_ */
 
@@ -73,6 +73,58 @@ void test__create_hash_map__unregister(void** state)
     assert_true(pt_hash_map == NULL);
 }
 
+/*
+ * test _create_hash_map_with_allocator
+ */
+UT_CASE_DEFINATION(_create_hash_map_with_allocator)
+static void* _create_hash_map_with_allocator__allocate(void* pv_context, size_t t_size)
+{
+    ((size_t*)pv_context)[0]++;
+    return malloc(t_size);
+}
+
+static void _create_hash_map_with_allocator__deallocate(void* pv_context, void* pv_mem, size_t t_size)
+{
+    ((size_t*)pv_context)[1]++;
+    free(pv_mem);
+}
+
+void test__create_hash_map_with_allocator__null_allocator(void** state)
+{
+    expect_assert_failure(_create_hash_map_with_allocator(NULL, "int, int"));
+}
+
+void test__create_hash_map_with_allocator__unregisted_type(void** state)
+{
+    size_t at_count[2] = {0, 0};
+    allocator_t t_allocator = {_create_hash_map_with_allocator__allocate, _create_hash_map_with_allocator__deallocate, NULL};
+
+    t_allocator._pv_context = at_count;
+    assert_true(_create_hash_map_with_allocator(&t_allocator, "unregisted_type_t") == NULL);
+    assert_true(at_count[0] == 0 && at_count[1] == 0);
+}
+
+void test__create_hash_map_with_allocator__allocate_by_allocator(void** state)
+{
+    size_t at_count[2] = {0, 0};
+    allocator_t t_allocator = {_create_hash_map_with_allocator__allocate, _create_hash_map_with_allocator__deallocate, NULL};
+    hash_map_t* phmap = NULL;
+    int i = 0;
+
+    t_allocator._pv_context = at_count;
+    phmap = _create_hash_map_with_allocator(&t_allocator, "int, int");
+    assert_true(phmap != NULL);
+    hash_map_init(phmap);
+    for (i = 0; i < 100; ++i) {
+        *(int*)hash_map_at(phmap, i) = i;
+    }
+    assert_true(hash_map_size(phmap) == 100);
+    assert_true(at_count[0] > 0);
+
+    hash_map_destroy(phmap);
+    assert_true(at_count[0] == at_count[1]);
+}
+
 /*
  * test _create_hash_map_auxiliary
  */
@@ -504,6 +556,32 @@ void test__hash_map_find__hash_map_find_varg__user_define_not_find(void** state)
     pair_destroy(pt_pair);
 }
 
+void test__hash_map_find__hash_map_find_varg__not_modify_pair_temp(void** state)
+{
+    hash_map_t* pt_hash_map = _create_hash_map("int, int");
+    pair_t* pt_pair = create_pair(int, int);
+    hash_map_iterator_t it_iter;
+    int elem;
+    int i;
+
+    pair_init(pt_pair);
+    hash_map_init(pt_hash_map);
+    for(i = 0; i < 10; ++i)
+    {
+        pair_make(pt_pair, i, i+8);
+        hash_map_insert(pt_hash_map, pt_pair);
+    }
+
+    *(int*)pt_hash_map->_pair_temp._pv_first = -1;
+    elem = 2;
+    it_iter = _hash_map_find(pt_hash_map, elem);
+    assert_true(*(int*)pair_second((pair_t*)iterator_get_pointer(it_iter)) == 10);
+    assert_true(*(int*)pt_hash_map->_pair_temp._pv_first == -1);
+
+    hash_map_destroy(pt_hash_map);
+    pair_destroy(pt_pair);
+}
+
 /*
  * test _hash_map_count and _hash_map_count_varg
  */
@@ -925,7 +1003,7 @@ void test__hash_map_equal_range__hash_map_equal_range_varg__c_builtin_equal(void
     elem = 2;
     r_range = _hash_map_equal_range(pt_hash_map, elem);
     assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(r_range.it_begin)) == 2);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(r_range.it_end)) == 3);
+    assert_true(iterator_equal(r_range.it_end, iterator_next(r_range.it_begin)));
 
     hash_map_destroy(pt_hash_map);
     pair_destroy(pt_pair);
@@ -977,7 +1055,7 @@ void test__hash_map_equal_range__hash_map_equal_range_varg__cstr_upper_equal(voi
 
     r_range = _hash_map_equal_range(pt_hash_map, "ggg");
     assert_true(strcmp((char*)pair_first((pair_t*)iterator_get_pointer(r_range.it_begin)), "ggg") == 0);
-    assert_true(iterator_equal(r_range.it_end, hash_map_end(pt_hash_map)));
+    assert_true(iterator_equal(r_range.it_end, iterator_next(r_range.it_begin)));
 
     hash_map_destroy(pt_hash_map);
     pair_destroy(pt_pair);
@@ -1038,7 +1116,11 @@ void test__hash_map_equal_range__hash_map_equal_range_varg__libcstl_builtin_equa
     list_push_back(plist, 6);
     r_range = _hash_map_equal_range(pt_hash_map, plist);
     assert_true(*(int*)list_front((list_t*)pair_first((pair_t*)iterator_get_pointer(r_range.it_begin))) == 6);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(iterator_equal(r_range.it_end, iterator_next(r_range.it_begin)));
+#else
     assert_true(*(int*)list_front((list_t*)pair_first((pair_t*)iterator_get_pointer(r_range.it_end))) == 7);
+#endif
 
     hash_map_destroy(pt_hash_map);
     list_destroy(plist);
@@ -1111,7 +1193,7 @@ void test__hash_map_equal_range__hash_map_equal_range_varg__user_define_equal(vo
     elem.n_elem = 8;
     r_range = _hash_map_equal_range(pt_hash_map, &elem);
     assert_true(((_test__hash_map_equal_range__hash_map_equal_range_varg__user_define_t*)pair_first((pair_t*)iterator_get_pointer(r_range.it_begin)))->n_elem == 8);
-    assert_true(((_test__hash_map_equal_range__hash_map_equal_range_varg__user_define_t*)pair_first((pair_t*)iterator_get_pointer(r_range.it_end)))->n_elem == 9);
+    assert_true(iterator_equal(r_range.it_end, iterator_next(r_range.it_begin)));
 
     hash_map_destroy(pt_hash_map);
     pair_destroy(pt_pair);
@@ -12,6 +12,13 @@ void test__create_hash_map__cstr(void** state);
 void test__create_hash_map__libcstl_builtin(void** state);
 void test__create_hash_map__user_define(void** state);
 void test__create_hash_map__unregister(void** state);
+/*
+ * test _create_hash_map_with_allocator
+ */
+UT_CASE_DECLARATION(_create_hash_map_with_allocator)
+void test__create_hash_map_with_allocator__null_allocator(void** state);
+void test__create_hash_map_with_allocator__unregisted_type(void** state);
+void test__create_hash_map_with_allocator__allocate_by_allocator(void** state);
 /*
  * test _create_hash_map_auxiliary
  */
@@ -47,6 +54,7 @@ void test__hash_map_find__hash_map_find_varg__libcstl_builtin_find(void** state)
 void test__hash_map_find__hash_map_find_varg__libcstl_builtin_not_find(void** state);
 void test__hash_map_find__hash_map_find_varg__user_define_find(void** state);
 void test__hash_map_find__hash_map_find_varg__user_define_not_find(void** state);
+void test__hash_map_find__hash_map_find_varg__not_modify_pair_temp(void** state);
 /*
  * test _hash_map_count and _hash_map_count_varg
  */
@@ -135,6 +143,9 @@ void test__hash_map_init_elem_auxiliary__successfully_user_defined(void** state)
     UT_CASE(test__create_hash_map__libcstl_builtin),\
     UT_CASE(test__create_hash_map__user_define),\
     UT_CASE(test__create_hash_map__unregister),\
+    UT_CASE_BEGIN(_create_hash_map_with_allocator, test__create_hash_map_with_allocator__null_allocator),\
+    UT_CASE(test__create_hash_map_with_allocator__unregisted_type),\
+    UT_CASE(test__create_hash_map_with_allocator__allocate_by_allocator),\
     UT_CASE_BEGIN(_create_hash_map_auxiliary, test__create_hash_map_auxiliary__null_hash_map),\
     UT_CASE(test__create_hash_map_auxiliary__null_typename),\
     UT_CASE(test__create_hash_map_auxiliary__unregistered),\
@@ -158,6 +169,7 @@ void test__hash_map_init_elem_auxiliary__successfully_user_defined(void** state)
     UT_CASE(test__hash_map_find__hash_map_find_varg__libcstl_builtin_not_find),\
     UT_CASE(test__hash_map_find__hash_map_find_varg__user_define_find),\
     UT_CASE(test__hash_map_find__hash_map_find_varg__user_define_not_find),\
+    UT_CASE(test__hash_map_find__hash_map_find_varg__not_modify_pair_temp),\
     UT_CASE_BEGIN(_hash_map_count__hash_map_count_varg, test__hash_map_count__hash_map_count_varg__null_hash_map),\
     UT_CASE(test__hash_map_count__hash_map_count_varg__non_inited),\
     UT_CASE(test__hash_map_count__hash_map_count_varg__non_inited_pair),\
@@ -1681,6 +1681,71 @@ void test_hash_multimap_max_size__non_empty(void** state)
     pair_destroy(pt_pair);
 }
 
+/*
+ * test hash_multimap_memory_usage
+ */
+UT_CASE_DEFINATION(hash_multimap_memory_usage)
+void test_hash_multimap_memory_usage__null_hash_multimap(void** state)
+{
+    expect_assert_failure(hash_multimap_memory_usage(NULL));
+}
+
+void test_hash_multimap_memory_usage__non_inited(void** state)
+{
+    hash_multimap_t* pt_hash_multimap = create_hash_multimap(int, int);
+    hash_multimap_init(pt_hash_multimap);
+
+    pt_hash_multimap->_pair_temp._t_typeinfofirst._t_style = 999;
+    expect_assert_failure(hash_multimap_memory_usage(pt_hash_multimap));
+    pt_hash_multimap->_pair_temp._t_typeinfofirst._t_style = _TYPE_C_BUILTIN;
+
+    hash_multimap_destroy(pt_hash_multimap);
+}
+
+void test_hash_multimap_memory_usage__non_inited_pair(void** state)
+{
+    hash_multimap_t* pt_hash_multimap = create_hash_multimap(int, int);
+    void* pv_tmp = NULL;
+    hash_multimap_init(pt_hash_multimap);
+
+    pv_tmp = pt_hash_multimap->_pair_temp._pv_first;
+    pt_hash_multimap->_pair_temp._pv_first = NULL;
+    expect_assert_failure(hash_multimap_memory_usage(pt_hash_multimap));
+    pt_hash_multimap->_pair_temp._pv_first = pv_tmp;
+
+    hash_multimap_destroy(pt_hash_multimap);
+}
+
+void test_hash_multimap_memory_usage__empty(void** state)
+{
+    hash_multimap_t* pt_hash_multimap = create_hash_multimap(int, int);
+    hash_multimap_init(pt_hash_multimap);
+
+    assert_true(hash_multimap_memory_usage(pt_hash_multimap) >= sizeof(hash_multimap_t));
+
+    hash_multimap_destroy(pt_hash_multimap);
+}
+
+void test_hash_multimap_memory_usage__non_empty(void** state)
+{
+    hash_multimap_t* pt_hash_multimap = create_hash_multimap(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    size_t t_usage = 0;
+    int i = 0;
+
+    hash_multimap_init(pt_hash_multimap);
+    pair_init(pt_pair);
+    t_usage = hash_multimap_memory_usage(pt_hash_multimap);
+    for (i = 0; i < 100; ++i) {
+        pair_make(pt_pair, i, i);
+        hash_multimap_insert(pt_hash_multimap, pt_pair);
+    }
+    assert_true(hash_multimap_memory_usage(pt_hash_multimap) >= t_usage + 100 * 2 * sizeof(int));
+
+    hash_multimap_destroy(pt_hash_multimap);
+    pair_destroy(pt_pair);
+}
+
 /*
  * test hash_multimap_bucket_count
  */
@@ -5361,6 +5426,7 @@ void test_hash_multimap_erase_pos__begin(void** state)
     pair_t* pt_pair = create_pair(int, int);
     hash_multimap_iterator_t it_pos;
     int i = 0;
+    int n_expect = 0;
 
     hash_multimap_init_ex(pt_hash_multimap, 0, NULL, NULL);
     pair_init(pt_pair);
@@ -5370,11 +5436,11 @@ void test_hash_multimap_erase_pos__begin(void** state)
         hash_multimap_insert(pt_hash_multimap, pt_pair);
     }
     it_pos = hash_multimap_begin(pt_hash_multimap);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_pos)) == 0);
+    n_expect = *(int*)pair_first((pair_t*)iterator_get_pointer(iterator_next(it_pos)));
     hash_multimap_erase_pos(pt_hash_multimap, it_pos);
     assert_true(hash_multimap_size(pt_hash_multimap) == 9);
     it_pos = hash_multimap_begin(pt_hash_multimap);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_pos)) == 1);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_pos)) == n_expect);
 
     hash_multimap_destroy(pt_hash_multimap);
     pair_destroy(pt_pair);
@@ -5412,6 +5478,7 @@ void test_hash_multimap_erase_pos__last(void** state)
     pair_t* pt_pair = create_pair(int, int);
     hash_multimap_iterator_t it_pos;
     int i = 0;
+    int n_expect = 0;
 
     hash_multimap_init_ex(pt_hash_multimap, 0, NULL, NULL);
     pair_init(pt_pair);
@@ -5421,11 +5488,11 @@ void test_hash_multimap_erase_pos__last(void** state)
         hash_multimap_insert(pt_hash_multimap, pt_pair);
     }
     it_pos = iterator_prev(hash_multimap_end(pt_hash_multimap));
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_pos)) == 9);
+    n_expect = *(int*)pair_first((pair_t*)iterator_get_pointer(iterator_prev(it_pos)));
     hash_multimap_erase_pos(pt_hash_multimap, it_pos);
     assert_true(hash_multimap_size(pt_hash_multimap) == 9);
     it_pos = iterator_prev(hash_multimap_end(pt_hash_multimap));
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_pos)) == 8);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_pos)) == n_expect);
 
     hash_multimap_destroy(pt_hash_multimap);
     pair_destroy(pt_pair);
@@ -5575,6 +5642,7 @@ void test_hash_multimap_erase_range__begin(void** state)
     hash_multimap_iterator_t it_begin;
     hash_multimap_iterator_t it_end;
     int i = 0;
+    int n_expect = 0;
 
     hash_multimap_init_ex(pt_dest, 0, NULL, NULL);
     pair_init(pt_pair);
@@ -5586,9 +5654,10 @@ void test_hash_multimap_erase_range__begin(void** state)
 
     it_begin = hash_multimap_begin(pt_dest);
     it_end = iterator_next(it_begin);
+    n_expect = *(int*)pair_first((pair_t*)iterator_get_pointer(iterator_next(it_begin)));
     hash_multimap_erase_range(pt_dest, it_begin, it_end);
     assert_true(hash_multimap_size(pt_dest) == 9);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(hash_multimap_begin(pt_dest))) == 1);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(hash_multimap_begin(pt_dest))) == n_expect);
 
     hash_multimap_destroy(pt_dest);
     pair_destroy(pt_pair);
@@ -5601,6 +5670,8 @@ void test_hash_multimap_erase_range__middle(void** state)
     hash_multimap_iterator_t it_begin;
     hash_multimap_iterator_t it_end;
     int i = 0;
+    int n_first = 0;
+    int n_second = 0;
 
     hash_multimap_init_ex(pt_dest, 0, NULL, NULL);
     pair_init(pt_pair);
@@ -5612,11 +5683,13 @@ void test_hash_multimap_erase_range__middle(void** state)
 
     it_begin = iterator_next(hash_multimap_begin(pt_dest));
     it_end = iterator_next(it_begin);
+    n_first = *(int*)pair_first((pair_t*)iterator_get_pointer(iterator_prev(it_begin)));
+    n_second = *(int*)pair_first((pair_t*)iterator_get_pointer(it_end));
     hash_multimap_erase_range(pt_dest, it_begin, it_end);
     assert_true(hash_multimap_size(pt_dest) == 9);
     it_begin = hash_multimap_begin(pt_dest);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_begin)) == 0);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(iterator_next(it_begin))) == 2);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_begin)) == n_first);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(iterator_next(it_begin))) == n_second);
 
     hash_multimap_destroy(pt_dest);
     pair_destroy(pt_pair);
@@ -5629,6 +5702,7 @@ void test_hash_multimap_erase_range__end(void** state)
     hash_multimap_iterator_t it_begin;
     hash_multimap_iterator_t it_end;
     int i = 0;
+    int n_expect = 0;
 
     hash_multimap_init_ex(pt_dest, 0, NULL, NULL);
     pair_init(pt_pair);
@@ -5640,10 +5714,11 @@ void test_hash_multimap_erase_range__end(void** state)
 
     it_end = hash_multimap_end(pt_dest);
     it_begin = iterator_prev(it_end);
+    n_expect = *(int*)pair_first((pair_t*)iterator_get_pointer(iterator_prev(it_begin)));
     hash_multimap_erase_range(pt_dest, it_begin, it_end);
     assert_true(hash_multimap_size(pt_dest) == 9);
     it_end = hash_multimap_end(pt_dest);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(iterator_prev(it_end))) == 8);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(iterator_prev(it_end))) == n_expect);
 
     hash_multimap_destroy(pt_dest);
     pair_destroy(pt_pair);
@@ -5726,3 +5801,308 @@ void test_hash_multimap_resize__resize(void** state)
     hash_multimap_destroy(pt_dest);
 }
 
+/*
+ * test hash_multimap_load_factor
+ */
+UT_CASE_DEFINATION(hash_multimap_load_factor)
+void test_hash_multimap_load_factor__null_hash_multimap(void** state)
+{
+    expect_assert_failure(hash_multimap_load_factor(NULL));
+}
+
+void test_hash_multimap_load_factor__successfully(void** state)
+{
+    hash_multimap_t* pt_hash_multimap = create_hash_multimap(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    int i = 0;
+
+    hash_multimap_init(pt_hash_multimap);
+    pair_init(pt_pair);
+    for (i = 0; i < 32; ++i) {
+        pair_make(pt_pair, i, i);
+        hash_multimap_insert(pt_hash_multimap, pt_pair);
+    }
+    assert_true(hash_multimap_load_factor(pt_hash_multimap) == (float)32 / (float)53);
+
+    hash_multimap_destroy(pt_hash_multimap);
+    pair_destroy(pt_pair);
+}
+
+/*
+ * test hash_multimap_max_load_factor
+ */
+UT_CASE_DEFINATION(hash_multimap_max_load_factor)
+void test_hash_multimap_max_load_factor__null_hash_multimap(void** state)
+{
+    expect_assert_failure(hash_multimap_max_load_factor(NULL));
+}
+
+void test_hash_multimap_max_load_factor__default(void** state)
+{
+    hash_multimap_t* pt_hash_multimap = create_hash_multimap(int, int);
+
+    hash_multimap_init(pt_hash_multimap);
+    assert_true(hash_multimap_max_load_factor(pt_hash_multimap) == 1.0f);
+
+    hash_multimap_destroy(pt_hash_multimap);
+}
+
+/*
+ * test hash_multimap_set_max_load_factor
+ */
+UT_CASE_DEFINATION(hash_multimap_set_max_load_factor)
+void test_hash_multimap_set_max_load_factor__null_hash_multimap(void** state)
+{
+    expect_assert_failure(hash_multimap_set_max_load_factor(NULL, 1.0f));
+}
+
+void test_hash_multimap_set_max_load_factor__invalid(void** state)
+{
+    hash_multimap_t* pt_hash_multimap = create_hash_multimap(int, int);
+
+    hash_multimap_init(pt_hash_multimap);
+    expect_assert_failure(hash_multimap_set_max_load_factor(pt_hash_multimap, 0.0f));
+
+    hash_multimap_destroy(pt_hash_multimap);
+}
+
+void test_hash_multimap_set_max_load_factor__less(void** state)
+{
+    hash_multimap_t* pt_hash_multimap = create_hash_multimap(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    int i = 0;
+
+    hash_multimap_init(pt_hash_multimap);
+    pair_init(pt_pair);
+    for (i = 0; i < 50; ++i) {
+        pair_make(pt_pair, i, i);
+        hash_multimap_insert(pt_hash_multimap, pt_pair);
+    }
+    hash_multimap_set_max_load_factor(pt_hash_multimap, 0.5f);
+    assert_true(hash_multimap_max_load_factor(pt_hash_multimap) == 0.5f);
+    assert_true(hash_multimap_bucket_count(pt_hash_multimap) == 193);
+    assert_true(hash_multimap_size(pt_hash_multimap) == 50);
+
+    hash_multimap_destroy(pt_hash_multimap);
+    pair_destroy(pt_pair);
+}
+
+void test_hash_multimap_set_max_load_factor__init_copy(void** state)
+{
+    hash_multimap_t* pt_hash_multimap = create_hash_multimap(int, int);
+    hash_multimap_t* pt_dest = create_hash_multimap(int, int);
+
+    hash_multimap_init(pt_hash_multimap);
+    hash_multimap_set_max_load_factor(pt_hash_multimap, 0.5f);
+    hash_multimap_init_copy(pt_dest, pt_hash_multimap);
+    assert_true(hash_multimap_max_load_factor(pt_dest) == 0.5f);
+
+    hash_multimap_destroy(pt_hash_multimap);
+    hash_multimap_destroy(pt_dest);
+}
+
+/*
+ * test hash_multimap_reserve
+ */
+UT_CASE_DEFINATION(hash_multimap_reserve)
+void test_hash_multimap_reserve__null_hash_multimap(void** state)
+{
+    expect_assert_failure(hash_multimap_reserve(NULL, 100));
+}
+
+void test_hash_multimap_reserve__reserve(void** state)
+{
+    hash_multimap_t* pt_hash_multimap = create_hash_multimap(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    int i = 0;
+
+    hash_multimap_init(pt_hash_multimap);
+    pair_init(pt_pair);
+    hash_multimap_reserve(pt_hash_multimap, 1000);
+    assert_true(hash_multimap_bucket_count(pt_hash_multimap) == 1543);
+    for (i = 0; i < 1000; ++i) {
+        pair_make(pt_pair, i, i);
+        hash_multimap_insert(pt_hash_multimap, pt_pair);
+    }
+    assert_true(hash_multimap_bucket_count(pt_hash_multimap) == 1543);
+    assert_true(hash_multimap_size(pt_hash_multimap) == 1000);
+
+    hash_multimap_destroy(pt_hash_multimap);
+    pair_destroy(pt_pair);
+}
+
+/*
+ * test hash_multimap_shrink_to_fit
+ */
+UT_CASE_DEFINATION(hash_multimap_shrink_to_fit)
+void test_hash_multimap_shrink_to_fit__null_hash_multimap(void** state)
+{
+    expect_assert_failure(hash_multimap_shrink_to_fit(NULL));
+}
+
+void test_hash_multimap_shrink_to_fit__shrink(void** state)
+{
+    hash_multimap_t* pt_hash_multimap = create_hash_multimap(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    int i = 0;
+
+    hash_multimap_init(pt_hash_multimap);
+    pair_init(pt_pair);
+    for (i = 0; i < 1000; ++i) {
+        pair_make(pt_pair, i, i);
+        hash_multimap_insert(pt_hash_multimap, pt_pair);
+    }
+    for (i = 100; i < 1000; ++i) {
+        hash_multimap_erase(pt_hash_multimap, i);
+    }
+    hash_multimap_shrink_to_fit(pt_hash_multimap);
+    assert_true(hash_multimap_bucket_count(pt_hash_multimap) == 193);
+    assert_true(hash_multimap_size(pt_hash_multimap) == 100);
+    for (i = 0; i < 100; ++i) {
+        assert_true(hash_multimap_count(pt_hash_multimap, i) == 1);
+    }
+
+    hash_multimap_destroy(pt_hash_multimap);
+    pair_destroy(pt_pair);
+}
+
+/*
+ * test hash_multimap_find_ptr
+ */
+UT_CASE_DEFINATION(hash_multimap_find_ptr)
+void test_hash_multimap_find_ptr__null_hash_multimap(void** state)
+{
+    int key = 9;
+
+    expect_assert_failure(hash_multimap_find_ptr(NULL, &key));
+}
+
+void test_hash_multimap_find_ptr__null_key(void** state)
+{
+    hash_multimap_t* pt_hash_multimap = create_hash_multimap(int, int);
+
+    hash_multimap_init(pt_hash_multimap);
+    expect_assert_failure(hash_multimap_find_ptr(pt_hash_multimap, NULL));
+
+    hash_multimap_destroy(pt_hash_multimap);
+}
+
+void test_hash_multimap_find_ptr__c_builtin(void** state)
+{
+    hash_multimap_t* pt_hash_multimap = create_hash_multimap(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    hash_multimap_iterator_t it_iter;
+    int key;
+    int i;
+
+    hash_multimap_init(pt_hash_multimap);
+    pair_init(pt_pair);
+    for (i = 0; i < 10; ++i) {
+        pair_make(pt_pair, i, i * 10);
+        hash_multimap_insert(pt_hash_multimap, pt_pair);
+    }
+
+    key = 4;
+    it_iter = hash_multimap_find_ptr(pt_hash_multimap, &key);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 4);
+    assert_true(*(int*)pair_second((pair_t*)iterator_get_pointer(it_iter)) == 40);
+    key = 42;
+    it_iter = hash_multimap_find_ptr(pt_hash_multimap, &key);
+    assert_true(iterator_equal(it_iter, hash_multimap_end(pt_hash_multimap)));
+
+    hash_multimap_destroy(pt_hash_multimap);
+    pair_destroy(pt_pair);
+}
+
+void test_hash_multimap_find_ptr__cstr(void** state)
+{
+    hash_multimap_t* pt_hash_multimap = create_hash_multimap(char*, int);
+    pair_t* pt_pair = create_pair(char*, int);
+    hash_multimap_iterator_t it_iter;
+
+    hash_multimap_init(pt_hash_multimap);
+    pair_init(pt_pair);
+    pair_make(pt_pair, "abc", 1);
+    hash_multimap_insert(pt_hash_multimap, pt_pair);
+    pair_make(pt_pair, "def", 2);
+    hash_multimap_insert(pt_hash_multimap, pt_pair);
+
+    it_iter = hash_multimap_find_ptr(pt_hash_multimap, "def");
+    assert_true(*(int*)pair_second((pair_t*)iterator_get_pointer(it_iter)) == 2);
+    it_iter = hash_multimap_find_ptr(pt_hash_multimap, "xyz");
+    assert_true(iterator_equal(it_iter, hash_multimap_end(pt_hash_multimap)));
+
+    hash_multimap_destroy(pt_hash_multimap);
+    pair_destroy(pt_pair);
+}
+
+/*
+ * test hash_multimap_count_ptr
+ */
+UT_CASE_DEFINATION(hash_multimap_count_ptr)
+void test_hash_multimap_count_ptr__null_hash_multimap(void** state)
+{
+    int key = 9;
+
+    expect_assert_failure(hash_multimap_count_ptr(NULL, &key));
+}
+
+void test_hash_multimap_count_ptr__c_builtin(void** state)
+{
+    hash_multimap_t* pt_hash_multimap = create_hash_multimap(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    int key;
+    int i;
+
+    hash_multimap_init(pt_hash_multimap);
+    pair_init(pt_pair);
+    for (i = 0; i < 10; ++i) {
+        pair_make(pt_pair, i, i * 10);
+        hash_multimap_insert(pt_hash_multimap, pt_pair);
+    }
+    pair_make(pt_pair, 3, 0);
+    hash_multimap_insert(pt_hash_multimap, pt_pair);
+
+    key = 3;
+    assert_true(hash_multimap_count_ptr(pt_hash_multimap, &key) == 2);
+    key = 42;
+    assert_true(hash_multimap_count_ptr(pt_hash_multimap, &key) == 0);
+
+    hash_multimap_destroy(pt_hash_multimap);
+    pair_destroy(pt_pair);
+}
+
+/*
+ * test hash_multimap_erase_ptr
+ */
+UT_CASE_DEFINATION(hash_multimap_erase_ptr)
+void test_hash_multimap_erase_ptr__null_hash_multimap(void** state)
+{
+    int key = 9;
+
+    expect_assert_failure(hash_multimap_erase_ptr(NULL, &key));
+}
+
+void test_hash_multimap_erase_ptr__c_builtin(void** state)
+{
+    hash_multimap_t* pt_hash_multimap = create_hash_multimap(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    int key;
+    int i;
+
+    hash_multimap_init(pt_hash_multimap);
+    pair_init(pt_pair);
+    for (i = 0; i < 10; ++i) {
+        pair_make(pt_pair, i, i * 10);
+        hash_multimap_insert(pt_hash_multimap, pt_pair);
+    }
+
+    key = 3;
+    assert_true(hash_multimap_erase_ptr(pt_hash_multimap, &key) == 1);
+    assert_true(hash_multimap_size(pt_hash_multimap) == 9);
+    assert_true(hash_multimap_erase_ptr(pt_hash_multimap, &key) == 0);
+
+    hash_multimap_destroy(pt_hash_multimap);
+    pair_destroy(pt_pair);
+}
+
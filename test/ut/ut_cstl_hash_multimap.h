@@ -153,6 +153,15 @@ void test_hash_multimap_max_size__non_inited(void** state);
 void test_hash_multimap_max_size__non_inited_pair(void** state);
 void test_hash_multimap_max_size__empty(void** state);
 void test_hash_multimap_max_size__non_empty(void** state);
+/*
+ * test hash_multimap_memory_usage
+ */
+UT_CASE_DECLARATION(hash_multimap_memory_usage)
+void test_hash_multimap_memory_usage__null_hash_multimap(void** state);
+void test_hash_multimap_memory_usage__non_inited(void** state);
+void test_hash_multimap_memory_usage__non_inited_pair(void** state);
+void test_hash_multimap_memory_usage__empty(void** state);
+void test_hash_multimap_memory_usage__non_empty(void** state);
 /*
  * test hash_multimap_bucket_count
  */
@@ -441,6 +450,58 @@ void test_hash_multimap_resize__non_inited(void** state);
 void test_hash_multimap_resize__non_inited_pair(void** state);
 void test_hash_multimap_resize__resize(void** state);
 
+/*
+ * test hash_multimap_load_factor
+ */
+UT_CASE_DECLARATION(hash_multimap_load_factor)
+void test_hash_multimap_load_factor__null_hash_multimap(void** state);
+void test_hash_multimap_load_factor__successfully(void** state);
+/*
+ * test hash_multimap_max_load_factor
+ */
+UT_CASE_DECLARATION(hash_multimap_max_load_factor)
+void test_hash_multimap_max_load_factor__null_hash_multimap(void** state);
+void test_hash_multimap_max_load_factor__default(void** state);
+/*
+ * test hash_multimap_set_max_load_factor
+ */
+UT_CASE_DECLARATION(hash_multimap_set_max_load_factor)
+void test_hash_multimap_set_max_load_factor__null_hash_multimap(void** state);
+void test_hash_multimap_set_max_load_factor__invalid(void** state);
+void test_hash_multimap_set_max_load_factor__less(void** state);
+void test_hash_multimap_set_max_load_factor__init_copy(void** state);
+/*
+ * test hash_multimap_reserve
+ */
+UT_CASE_DECLARATION(hash_multimap_reserve)
+void test_hash_multimap_reserve__null_hash_multimap(void** state);
+void test_hash_multimap_reserve__reserve(void** state);
+/*
+ * test hash_multimap_shrink_to_fit
+ */
+UT_CASE_DECLARATION(hash_multimap_shrink_to_fit)
+void test_hash_multimap_shrink_to_fit__null_hash_multimap(void** state);
+void test_hash_multimap_shrink_to_fit__shrink(void** state);
+/*
+ * test hash_multimap_find_ptr
+ */
+UT_CASE_DECLARATION(hash_multimap_find_ptr)
+void test_hash_multimap_find_ptr__null_hash_multimap(void** state);
+void test_hash_multimap_find_ptr__null_key(void** state);
+void test_hash_multimap_find_ptr__c_builtin(void** state);
+void test_hash_multimap_find_ptr__cstr(void** state);
+/*
+ * test hash_multimap_count_ptr
+ */
+UT_CASE_DECLARATION(hash_multimap_count_ptr)
+void test_hash_multimap_count_ptr__null_hash_multimap(void** state);
+void test_hash_multimap_count_ptr__c_builtin(void** state);
+/*
+ * test hash_multimap_erase_ptr
+ */
+UT_CASE_DECLARATION(hash_multimap_erase_ptr)
+void test_hash_multimap_erase_ptr__null_hash_multimap(void** state);
+void test_hash_multimap_erase_ptr__c_builtin(void** state);
 #define UT_CSTL_HASH_MULTIMAP_CASE\
     UT_SUIT_BEGIN(cstl_hash_multimap, test_hash_multimap_init__null_hash_multimap),\
     UT_CASE(test_hash_multimap_init__non_created),\
@@ -545,6 +606,11 @@ void test_hash_multimap_resize__resize(void** state);
     UT_CASE(test_hash_multimap_max_size__non_inited_pair),\
     UT_CASE(test_hash_multimap_max_size__empty),\
     UT_CASE(test_hash_multimap_max_size__non_empty),\
+    UT_CASE_BEGIN(hash_multimap_memory_usage, test_hash_multimap_memory_usage__null_hash_multimap),\
+    UT_CASE(test_hash_multimap_memory_usage__non_inited),\
+    UT_CASE(test_hash_multimap_memory_usage__non_inited_pair),\
+    UT_CASE(test_hash_multimap_memory_usage__empty),\
+    UT_CASE(test_hash_multimap_memory_usage__non_empty),\
     UT_CASE_BEGIN(hash_multimap_bucket_count, test_hash_multimap_bucket_count__null_hash_multimap),\
     UT_CASE(test_hash_multimap_bucket_count__non_inited),\
     UT_CASE(test_hash_multimap_bucket_count__non_inited_pair),\
@@ -752,7 +818,27 @@ void test_hash_multimap_resize__resize(void** state);
     UT_CASE_BEGIN(hash_multimap_resize, test_hash_multimap_resize__null_hash_multimap),\
     UT_CASE(test_hash_multimap_resize__non_inited),\
     UT_CASE(test_hash_multimap_resize__non_inited_pair),\
-    UT_CASE(test_hash_multimap_resize__resize)
+    UT_CASE(test_hash_multimap_resize__resize),\
+    UT_CASE_BEGIN(hash_multimap_load_factor, test_hash_multimap_load_factor__null_hash_multimap),\
+    UT_CASE(test_hash_multimap_load_factor__successfully),\
+    UT_CASE_BEGIN(hash_multimap_max_load_factor, test_hash_multimap_max_load_factor__null_hash_multimap),\
+    UT_CASE(test_hash_multimap_max_load_factor__default),\
+    UT_CASE_BEGIN(hash_multimap_set_max_load_factor, test_hash_multimap_set_max_load_factor__null_hash_multimap),\
+    UT_CASE(test_hash_multimap_set_max_load_factor__invalid),\
+    UT_CASE(test_hash_multimap_set_max_load_factor__less),\
+    UT_CASE(test_hash_multimap_set_max_load_factor__init_copy),\
+    UT_CASE_BEGIN(hash_multimap_reserve, test_hash_multimap_reserve__null_hash_multimap),\
+    UT_CASE(test_hash_multimap_reserve__reserve),\
+    UT_CASE_BEGIN(hash_multimap_shrink_to_fit, test_hash_multimap_shrink_to_fit__null_hash_multimap),\
+    UT_CASE(test_hash_multimap_shrink_to_fit__shrink),\
+    UT_CASE_BEGIN(hash_multimap_find_ptr, test_hash_multimap_find_ptr__null_hash_multimap),\
+    UT_CASE(test_hash_multimap_find_ptr__null_key),\
+    UT_CASE(test_hash_multimap_find_ptr__c_builtin),\
+    UT_CASE(test_hash_multimap_find_ptr__cstr),\
+    UT_CASE_BEGIN(hash_multimap_count_ptr, test_hash_multimap_count_ptr__null_hash_multimap),\
+    UT_CASE(test_hash_multimap_count_ptr__c_builtin),\
+    UT_CASE_BEGIN(hash_multimap_erase_ptr, test_hash_multimap_erase_ptr__null_hash_multimap),\
+    UT_CASE(test_hash_multimap_erase_ptr__c_builtin)
 
 #endif /* _UT_CSTL_HASH_MULTIMAP_H_ */
 
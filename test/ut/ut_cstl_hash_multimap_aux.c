@@ -8,6 +8,7 @@
 #include "cstl/chash_map.h"
 #include "cstl/cstring.h"
 #include "cstl/cvector.h"
+#include "cstl_hashtable_aux.h"
 #include "cstl_hash_multimap_aux.h"
 
 #include "ut_def.h"
@@ -437,7 +438,7 @@ void test__hash_multimap_default_hash__int(void** state)
     pair_init_elem(ppair_pair, 0x01020304, 100);
 
     _hash_multimap_default_hash(ppair_pair, &t_result);
-    assert_true(t_result == 10);
+    assert_true(t_result == _hashtable_hash_bytes(pair_first(ppair_pair), sizeof(int)));
 
     pair_destroy(ppair_pair);
 }
@@ -449,7 +450,7 @@ void test__hash_multimap_default_hash__cstr(void** state)
     pair_init_elem(ppair_pair, "abc", 100);
 
     _hash_multimap_default_hash(ppair_pair, &t_result);
-    assert_true(t_result == 294);
+    assert_true(t_result == _hashtable_hash_bytes("abc", 3));
 
     pair_destroy(ppair_pair);
 }
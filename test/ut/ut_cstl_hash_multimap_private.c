@@ -73,6 +73,62 @@ void test__create_hash_multimap__unregister(void** state)
     assert_true(pt_hash_multimap == NULL);
 }
 
+/*
+ * test _create_hash_multimap_with_allocator
+ */
+UT_CASE_DEFINATION(_create_hash_multimap_with_allocator)
+static void* _create_hash_multimap_with_allocator__allocate(void* pv_context, size_t t_size)
+{
+    ((size_t*)pv_context)[0]++;
+    return malloc(t_size);
+}
+
+static void _create_hash_multimap_with_allocator__deallocate(void* pv_context, void* pv_mem, size_t t_size)
+{
+    ((size_t*)pv_context)[1]++;
+    free(pv_mem);
+}
+
+void test__create_hash_multimap_with_allocator__null_allocator(void** state)
+{
+    expect_assert_failure(_create_hash_multimap_with_allocator(NULL, "int, int"));
+}
+
+void test__create_hash_multimap_with_allocator__unregisted_type(void** state)
+{
+    size_t at_count[2] = {0, 0};
+    allocator_t t_allocator = {_create_hash_multimap_with_allocator__allocate, _create_hash_multimap_with_allocator__deallocate, NULL};
+
+    t_allocator._pv_context = at_count;
+    assert_true(_create_hash_multimap_with_allocator(&t_allocator, "unregisted_type_t") == NULL);
+    assert_true(at_count[0] == 0 && at_count[1] == 0);
+}
+
+void test__create_hash_multimap_with_allocator__allocate_by_allocator(void** state)
+{
+    size_t at_count[2] = {0, 0};
+    allocator_t t_allocator = {_create_hash_multimap_with_allocator__allocate, _create_hash_multimap_with_allocator__deallocate, NULL};
+    hash_multimap_t* phmmap = NULL;
+    pair_t* ppair = create_pair(int, int);
+    int i = 0;
+
+    t_allocator._pv_context = at_count;
+    phmmap = _create_hash_multimap_with_allocator(&t_allocator, "int, int");
+    assert_true(phmmap != NULL);
+    hash_multimap_init(phmmap);
+    pair_init(ppair);
+    for (i = 0; i < 100; ++i) {
+        pair_make(ppair, i, i);
+        hash_multimap_insert(phmmap, ppair);
+    }
+    assert_true(hash_multimap_size(phmmap) == 100);
+    assert_true(at_count[0] > 0);
+
+    hash_multimap_destroy(phmmap);
+    pair_destroy(ppair);
+    assert_true(at_count[0] == at_count[1]);
+}
+
 /*
  * test _create_hash_multimap_auxiliary
  */
@@ -925,7 +981,7 @@ void test__hash_multimap_equal_range__hash_multimap_equal_range_varg__c_builtin_
     elem = 2;
     r_range = _hash_multimap_equal_range(pt_hash_multimap, elem);
     assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(r_range.it_begin)) == 2);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(r_range.it_end)) == 3);
+    assert_true(iterator_equal(r_range.it_end, iterator_next(r_range.it_begin)));
 
     hash_multimap_destroy(pt_hash_multimap);
     pair_destroy(pt_pair);
@@ -977,7 +1033,7 @@ void test__hash_multimap_equal_range__hash_multimap_equal_range_varg__cstr_upper
 
     r_range = _hash_multimap_equal_range(pt_hash_multimap, "ggg");
     assert_true(strcmp((char*)pair_first((pair_t*)iterator_get_pointer(r_range.it_begin)), "ggg") == 0);
-    assert_true(iterator_equal(r_range.it_end, hash_multimap_end(pt_hash_multimap)));
+    assert_true(iterator_equal(r_range.it_end, iterator_next(r_range.it_begin)));
 
     hash_multimap_destroy(pt_hash_multimap);
     pair_destroy(pt_pair);
@@ -1111,7 +1167,7 @@ void test__hash_multimap_equal_range__hash_multimap_equal_range_varg__user_defin
     elem.n_elem = 8;
     r_range = _hash_multimap_equal_range(pt_hash_multimap, &elem);
     assert_true(((_test__hash_multimap_equal_range__hash_multimap_equal_range_varg__user_define_t*)pair_first((pair_t*)iterator_get_pointer(r_range.it_begin)))->n_elem == 8);
-    assert_true(((_test__hash_multimap_equal_range__hash_multimap_equal_range_varg__user_define_t*)pair_first((pair_t*)iterator_get_pointer(r_range.it_end)))->n_elem == 9);
+    assert_true(iterator_equal(r_range.it_end, iterator_next(r_range.it_begin)));
 
     hash_multimap_destroy(pt_hash_multimap);
     pair_destroy(pt_pair);
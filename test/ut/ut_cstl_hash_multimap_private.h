@@ -12,6 +12,13 @@ void test__create_hash_multimap__cstr(void** state);
 void test__create_hash_multimap__libcstl_builtin(void** state);
 void test__create_hash_multimap__user_define(void** state);
 void test__create_hash_multimap__unregister(void** state);
+/*
+ * test _create_hash_multimap_with_allocator
+ */
+UT_CASE_DECLARATION(_create_hash_multimap_with_allocator)
+void test__create_hash_multimap_with_allocator__null_allocator(void** state);
+void test__create_hash_multimap_with_allocator__unregisted_type(void** state);
+void test__create_hash_multimap_with_allocator__allocate_by_allocator(void** state);
 /*
  * test _create_hash_multimap_auxiliary
  */
@@ -120,6 +127,9 @@ void test__hash_multimap_init_elem_auxiliary__successfully_user_defined(void** s
     UT_CASE(test__create_hash_multimap__libcstl_builtin),\
     UT_CASE(test__create_hash_multimap__user_define),\
     UT_CASE(test__create_hash_multimap__unregister),\
+    UT_CASE_BEGIN(_create_hash_multimap_with_allocator, test__create_hash_multimap_with_allocator__null_allocator),\
+    UT_CASE(test__create_hash_multimap_with_allocator__unregisted_type),\
+    UT_CASE(test__create_hash_multimap_with_allocator__allocate_by_allocator),\
     UT_CASE_BEGIN(_create_hash_multimap_auxiliary, test__create_hash_multimap_auxiliary__null_hash_multimap),\
     UT_CASE(test__create_hash_multimap_auxiliary__null_typename),\
     UT_CASE(test__create_hash_multimap_auxiliary__unregistered),\
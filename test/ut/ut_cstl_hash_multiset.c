@@ -1314,6 +1314,53 @@ void test_hash_multiset_max_size__non_empty(void** state)
     hash_multiset_destroy(pt_hash_multiset);
 }
 
+/*
+ * test hash_multiset_memory_usage
+ */
+UT_CASE_DEFINATION(hash_multiset_memory_usage)
+void test_hash_multiset_memory_usage__null_hash_multiset(void** state)
+{
+    expect_assert_failure(hash_multiset_memory_usage(NULL));
+}
+
+void test_hash_multiset_memory_usage__non_inited(void** state)
+{
+    hash_multiset_t* pt_hash_multiset = create_hash_multiset(int);
+    hash_multiset_init_ex(pt_hash_multiset, 0, NULL, NULL);
+
+    pt_hash_multiset->_t_hashtable._t_typeinfo._t_style = 3333;
+    expect_assert_failure(hash_multiset_memory_usage(pt_hash_multiset));
+    pt_hash_multiset->_t_hashtable._t_typeinfo._t_style = _TYPE_C_BUILTIN;
+
+    hash_multiset_destroy(pt_hash_multiset);
+}
+
+void test_hash_multiset_memory_usage__empty(void** state)
+{
+    hash_multiset_t* pt_hash_multiset = create_hash_multiset(int);
+    hash_multiset_init_ex(pt_hash_multiset, 0, NULL, NULL);
+
+    assert_true(hash_multiset_memory_usage(pt_hash_multiset) >= sizeof(hash_multiset_t));
+
+    hash_multiset_destroy(pt_hash_multiset);
+}
+
+void test_hash_multiset_memory_usage__non_empty(void** state)
+{
+    hash_multiset_t* pt_hash_multiset = create_hash_multiset(int);
+    size_t t_usage = 0;
+    int i = 0;
+
+    hash_multiset_init(pt_hash_multiset);
+    t_usage = hash_multiset_memory_usage(pt_hash_multiset);
+    for (i = 0; i < 100; ++i) {
+        hash_multiset_insert(pt_hash_multiset, i);
+    }
+    assert_true(hash_multiset_memory_usage(pt_hash_multiset) >= t_usage + 100 * sizeof(int));
+
+    hash_multiset_destroy(pt_hash_multiset);
+}
+
 /*
  * test hash_multiset_bucket_count
  */
@@ -4013,6 +4060,7 @@ void test_hash_multiset_erase_pos__begin(void** state)
     hash_multiset_t* pt_hash_multiset = create_hash_multiset(int);
     hash_multiset_iterator_t it_pos;
     int i = 0;
+    int n_expect = 0;
 
     hash_multiset_init(pt_hash_multiset);
     for(i = 0; i < 10; ++i)
@@ -4020,11 +4068,11 @@ void test_hash_multiset_erase_pos__begin(void** state)
         hash_multiset_insert(pt_hash_multiset, i);
     }
     it_pos = hash_multiset_begin(pt_hash_multiset);
-    assert_true(*(int*)iterator_get_pointer(it_pos) == 0);
+    n_expect = *(int*)iterator_get_pointer(iterator_next(it_pos));
     hash_multiset_erase_pos(pt_hash_multiset, it_pos);
     assert_true(hash_multiset_size(pt_hash_multiset) == 9);
     it_pos = hash_multiset_begin(pt_hash_multiset);
-    assert_true(*(int*)iterator_get_pointer(it_pos) == 1);
+    assert_true(*(int*)iterator_get_pointer(it_pos) == n_expect);
 
     hash_multiset_destroy(pt_hash_multiset);
 }
@@ -4056,6 +4104,7 @@ void test_hash_multiset_erase_pos__last(void** state)
     hash_multiset_t* pt_hash_multiset = create_hash_multiset(int);
     hash_multiset_iterator_t it_pos;
     int i = 0;
+    int n_expect = 0;
 
     hash_multiset_init(pt_hash_multiset);
     for(i = 0; i < 10; ++i)
@@ -4063,11 +4112,11 @@ void test_hash_multiset_erase_pos__last(void** state)
         hash_multiset_insert(pt_hash_multiset, i);
     }
     it_pos = iterator_prev(hash_multiset_end(pt_hash_multiset));
-    assert_true(*(int*)iterator_get_pointer(it_pos) == 9);
+    n_expect = *(int*)iterator_get_pointer(iterator_prev(it_pos));
     hash_multiset_erase_pos(pt_hash_multiset, it_pos);
     assert_true(hash_multiset_size(pt_hash_multiset) == 9);
     it_pos = iterator_prev(hash_multiset_end(pt_hash_multiset));
-    assert_true(*(int*)iterator_get_pointer(it_pos) == 8);
+    assert_true(*(int*)iterator_get_pointer(it_pos) == n_expect);
 
     hash_multiset_destroy(pt_hash_multiset);
 }
@@ -4190,6 +4239,7 @@ void test_hash_multiset_erase_range__begin(void** state)
     hash_multiset_iterator_t it_begin;
     hash_multiset_iterator_t it_end;
     int i = 0;
+    int n_expect = 0;
 
     hash_multiset_init(pt_dest);
     for(i = 0; i < 10; ++i)
@@ -4199,9 +4249,10 @@ void test_hash_multiset_erase_range__begin(void** state)
 
     it_begin = hash_multiset_begin(pt_dest);
     it_end = iterator_next(it_begin);
+    n_expect = *(int*)iterator_get_pointer(iterator_next(it_begin));
     hash_multiset_erase_range(pt_dest, it_begin, it_end);
     assert_true(hash_multiset_size(pt_dest) == 9);
-    assert_true(*(int*)iterator_get_pointer(hash_multiset_begin(pt_dest)) == 1);
+    assert_true(*(int*)iterator_get_pointer(hash_multiset_begin(pt_dest)) == n_expect);
 
     hash_multiset_destroy(pt_dest);
 }
@@ -4212,6 +4263,8 @@ void test_hash_multiset_erase_range__middle(void** state)
     hash_multiset_iterator_t it_begin;
     hash_multiset_iterator_t it_end;
     int i = 0;
+    int n_first = 0;
+    int n_second = 0;
 
     hash_multiset_init(pt_dest);
     for(i = 0; i < 10; ++i)
@@ -4221,11 +4274,13 @@ void test_hash_multiset_erase_range__middle(void** state)
 
     it_begin = iterator_next(hash_multiset_begin(pt_dest));
     it_end = iterator_next(it_begin);
+    n_first = *(int*)iterator_get_pointer(iterator_prev(it_begin));
+    n_second = *(int*)iterator_get_pointer(it_end);
     hash_multiset_erase_range(pt_dest, it_begin, it_end);
     assert_true(hash_multiset_size(pt_dest) == 9);
     it_begin = hash_multiset_begin(pt_dest);
-    assert_true(*(int*)iterator_get_pointer(it_begin) == 0);
-    assert_true(*(int*)iterator_get_pointer(iterator_next(it_begin)) == 2);
+    assert_true(*(int*)iterator_get_pointer(it_begin) == n_first);
+    assert_true(*(int*)iterator_get_pointer(iterator_next(it_begin)) == n_second);
 
     hash_multiset_destroy(pt_dest);
 }
@@ -4236,6 +4291,7 @@ void test_hash_multiset_erase_range__end(void** state)
     hash_multiset_iterator_t it_begin;
     hash_multiset_iterator_t it_end;
     int i = 0;
+    int n_expect = 0;
 
     hash_multiset_init(pt_dest);
     for(i = 0; i < 10; ++i)
@@ -4245,10 +4301,11 @@ void test_hash_multiset_erase_range__end(void** state)
 
     it_end = hash_multiset_end(pt_dest);
     it_begin = iterator_prev(it_end);
+    n_expect = *(int*)iterator_get_pointer(iterator_prev(it_begin));
     hash_multiset_erase_range(pt_dest, it_begin, it_end);
     assert_true(hash_multiset_size(pt_dest) == 9);
     it_end = hash_multiset_end(pt_dest);
-    assert_true(*(int*)iterator_get_pointer(iterator_prev(it_end)) == 8);
+    assert_true(*(int*)iterator_get_pointer(iterator_prev(it_end)) == n_expect);
 
     hash_multiset_destroy(pt_dest);
 }
@@ -4319,3 +4376,379 @@ void test_hash_multiset_resize__less(void** state)
     hash_multiset_destroy(pt_hash_multiset);
 }
 
+/*
+ * test hash_multiset_load_factor
+ */
+UT_CASE_DEFINATION(hash_multiset_load_factor)
+void test_hash_multiset_load_factor__null_hash_multiset(void** state)
+{
+    expect_assert_failure(hash_multiset_load_factor(NULL));
+}
+
+void test_hash_multiset_load_factor__successfully(void** state)
+{
+    hash_multiset_t* pt_hash_multiset = create_hash_multiset(int);
+    int i = 0;
+
+    hash_multiset_init(pt_hash_multiset);
+    for (i = 0; i < 32; ++i) {
+        hash_multiset_insert(pt_hash_multiset, i);
+    }
+    assert_true(hash_multiset_load_factor(pt_hash_multiset) == (float)32 / (float)53);
+
+    hash_multiset_destroy(pt_hash_multiset);
+}
+
+/*
+ * test hash_multiset_max_load_factor
+ */
+UT_CASE_DEFINATION(hash_multiset_max_load_factor)
+void test_hash_multiset_max_load_factor__null_hash_multiset(void** state)
+{
+    expect_assert_failure(hash_multiset_max_load_factor(NULL));
+}
+
+void test_hash_multiset_max_load_factor__default(void** state)
+{
+    hash_multiset_t* pt_hash_multiset = create_hash_multiset(int);
+
+    hash_multiset_init(pt_hash_multiset);
+    assert_true(hash_multiset_max_load_factor(pt_hash_multiset) == 1.0f);
+
+    hash_multiset_destroy(pt_hash_multiset);
+}
+
+/*
+ * test hash_multiset_set_max_load_factor
+ */
+UT_CASE_DEFINATION(hash_multiset_set_max_load_factor)
+void test_hash_multiset_set_max_load_factor__null_hash_multiset(void** state)
+{
+    expect_assert_failure(hash_multiset_set_max_load_factor(NULL, 1.0f));
+}
+
+void test_hash_multiset_set_max_load_factor__invalid(void** state)
+{
+    hash_multiset_t* pt_hash_multiset = create_hash_multiset(int);
+
+    hash_multiset_init(pt_hash_multiset);
+    expect_assert_failure(hash_multiset_set_max_load_factor(pt_hash_multiset, 0.0f));
+
+    hash_multiset_destroy(pt_hash_multiset);
+}
+
+void test_hash_multiset_set_max_load_factor__less(void** state)
+{
+    hash_multiset_t* pt_hash_multiset = create_hash_multiset(int);
+    int i = 0;
+
+    hash_multiset_init(pt_hash_multiset);
+    for (i = 0; i < 50; ++i) {
+        hash_multiset_insert(pt_hash_multiset, i);
+    }
+    hash_multiset_set_max_load_factor(pt_hash_multiset, 0.5f);
+    assert_true(hash_multiset_max_load_factor(pt_hash_multiset) == 0.5f);
+    assert_true(hash_multiset_bucket_count(pt_hash_multiset) == 193);
+    assert_true(hash_multiset_size(pt_hash_multiset) == 50);
+
+    hash_multiset_destroy(pt_hash_multiset);
+}
+
+void test_hash_multiset_set_max_load_factor__init_copy(void** state)
+{
+    hash_multiset_t* pt_hash_multiset = create_hash_multiset(int);
+    hash_multiset_t* pt_dest = create_hash_multiset(int);
+
+    hash_multiset_init(pt_hash_multiset);
+    hash_multiset_set_max_load_factor(pt_hash_multiset, 0.5f);
+    hash_multiset_init_copy(pt_dest, pt_hash_multiset);
+    assert_true(hash_multiset_max_load_factor(pt_dest) == 0.5f);
+
+    hash_multiset_destroy(pt_hash_multiset);
+    hash_multiset_destroy(pt_dest);
+}
+
+/*
+ * test hash_multiset_reserve
+ */
+UT_CASE_DEFINATION(hash_multiset_reserve)
+void test_hash_multiset_reserve__null_hash_multiset(void** state)
+{
+    expect_assert_failure(hash_multiset_reserve(NULL, 100));
+}
+
+void test_hash_multiset_reserve__reserve(void** state)
+{
+    hash_multiset_t* pt_hash_multiset = create_hash_multiset(int);
+    int i = 0;
+
+    hash_multiset_init(pt_hash_multiset);
+    hash_multiset_reserve(pt_hash_multiset, 1000);
+    assert_true(hash_multiset_bucket_count(pt_hash_multiset) == 1543);
+    for (i = 0; i < 1000; ++i) {
+        hash_multiset_insert(pt_hash_multiset, i);
+    }
+    assert_true(hash_multiset_bucket_count(pt_hash_multiset) == 1543);
+    assert_true(hash_multiset_size(pt_hash_multiset) == 1000);
+
+    hash_multiset_destroy(pt_hash_multiset);
+}
+
+/*
+ * test hash_multiset_shrink_to_fit
+ */
+UT_CASE_DEFINATION(hash_multiset_shrink_to_fit)
+void test_hash_multiset_shrink_to_fit__null_hash_multiset(void** state)
+{
+    expect_assert_failure(hash_multiset_shrink_to_fit(NULL));
+}
+
+void test_hash_multiset_shrink_to_fit__shrink(void** state)
+{
+    hash_multiset_t* pt_hash_multiset = create_hash_multiset(int);
+    int i = 0;
+
+    hash_multiset_init(pt_hash_multiset);
+    for (i = 0; i < 1000; ++i) {
+        hash_multiset_insert(pt_hash_multiset, i);
+    }
+    for (i = 100; i < 1000; ++i) {
+        hash_multiset_erase(pt_hash_multiset, i);
+    }
+    hash_multiset_shrink_to_fit(pt_hash_multiset);
+    assert_true(hash_multiset_bucket_count(pt_hash_multiset) == 193);
+    assert_true(hash_multiset_size(pt_hash_multiset) == 100);
+    for (i = 0; i < 100; ++i) {
+        assert_true(hash_multiset_count(pt_hash_multiset, i) == 1);
+    }
+
+    hash_multiset_destroy(pt_hash_multiset);
+}
+
+/*
+ * test hash_multiset_find_ptr
+ */
+UT_CASE_DEFINATION(hash_multiset_find_ptr)
+void test_hash_multiset_find_ptr__null_hash_multiset(void** state)
+{
+    int elem = 9;
+
+    expect_assert_failure(hash_multiset_find_ptr(NULL, &elem));
+}
+
+void test_hash_multiset_find_ptr__null_value(void** state)
+{
+    hash_multiset_t* pt_hash_multiset = create_hash_multiset(int);
+
+    hash_multiset_init(pt_hash_multiset);
+    expect_assert_failure(hash_multiset_find_ptr(pt_hash_multiset, NULL));
+
+    hash_multiset_destroy(pt_hash_multiset);
+}
+
+void test_hash_multiset_find_ptr__c_builtin(void** state)
+{
+    hash_multiset_t* pt_hash_multiset = create_hash_multiset(int);
+    hash_multiset_iterator_t it_iter;
+    int elem;
+    int i;
+
+    hash_multiset_init(pt_hash_multiset);
+    for (i = 0; i < 10; ++i) {
+        hash_multiset_insert(pt_hash_multiset, i);
+    }
+
+    elem = 2;
+    it_iter = hash_multiset_find_ptr(pt_hash_multiset, &elem);
+    assert_true(*(int*)iterator_get_pointer(it_iter) == 2);
+    elem = 42;
+    it_iter = hash_multiset_find_ptr(pt_hash_multiset, &elem);
+    assert_true(iterator_equal(it_iter, hash_multiset_end(pt_hash_multiset)));
+
+    hash_multiset_destroy(pt_hash_multiset);
+}
+
+void test_hash_multiset_find_ptr__cstr(void** state)
+{
+    hash_multiset_t* pt_hash_multiset = create_hash_multiset(char*);
+    hash_multiset_iterator_t it_iter;
+
+    hash_multiset_init(pt_hash_multiset);
+    hash_multiset_insert(pt_hash_multiset, "aaa");
+    hash_multiset_insert(pt_hash_multiset, "ggg");
+    hash_multiset_insert(pt_hash_multiset, "linux");
+
+    it_iter = hash_multiset_find_ptr(pt_hash_multiset, "ggg");
+    assert_true(strcmp((char*)iterator_get_pointer(it_iter), "ggg") == 0);
+    it_iter = hash_multiset_find_ptr(pt_hash_multiset, "unix");
+    assert_true(iterator_equal(it_iter, hash_multiset_end(pt_hash_multiset)));
+
+    hash_multiset_destroy(pt_hash_multiset);
+}
+
+void test_hash_multiset_find_ptr__libcstl_builtin(void** state)
+{
+    hash_multiset_t* pt_hash_multiset = create_hash_multiset(vector_t<int>);
+    vector_t* pvec_vector = create_vector(int);
+    hash_multiset_iterator_t it_iter;
+
+    hash_multiset_init(pt_hash_multiset);
+    vector_init_n(pvec_vector, 3);
+    hash_multiset_insert(pt_hash_multiset, pvec_vector);
+
+    it_iter = hash_multiset_find_ptr(pt_hash_multiset, pvec_vector);
+    assert_true(vector_equal((vector_t*)iterator_get_pointer(it_iter), pvec_vector));
+    vector_push_back(pvec_vector, 1);
+    it_iter = hash_multiset_find_ptr(pt_hash_multiset, pvec_vector);
+    assert_true(iterator_equal(it_iter, hash_multiset_end(pt_hash_multiset)));
+
+    hash_multiset_destroy(pt_hash_multiset);
+    vector_destroy(pvec_vector);
+}
+
+/*
+ * test hash_multiset_insert_ptr
+ */
+UT_CASE_DEFINATION(hash_multiset_insert_ptr)
+void test_hash_multiset_insert_ptr__null_hash_multiset(void** state)
+{
+    int elem = 9;
+
+    expect_assert_failure(hash_multiset_insert_ptr(NULL, &elem));
+}
+
+void test_hash_multiset_insert_ptr__null_value(void** state)
+{
+    hash_multiset_t* pt_hash_multiset = create_hash_multiset(int);
+
+    hash_multiset_init(pt_hash_multiset);
+    expect_assert_failure(hash_multiset_insert_ptr(pt_hash_multiset, NULL));
+
+    hash_multiset_destroy(pt_hash_multiset);
+}
+
+void test_hash_multiset_insert_ptr__c_builtin(void** state)
+{
+    hash_multiset_t* pt_hash_multiset = create_hash_multiset(int);
+    hash_multiset_iterator_t it_iter;
+    int elem = 7;
+
+    hash_multiset_init(pt_hash_multiset);
+    it_iter = hash_multiset_insert_ptr(pt_hash_multiset, &elem);
+    assert_true(*(int*)iterator_get_pointer(it_iter) == 7);
+    assert_true(hash_multiset_size(pt_hash_multiset) == 1);
+    it_iter = hash_multiset_insert_ptr(pt_hash_multiset, &elem);
+    assert_true(!iterator_equal(it_iter, hash_multiset_end(pt_hash_multiset)));
+    assert_true(hash_multiset_size(pt_hash_multiset) == 2);
+
+    hash_multiset_destroy(pt_hash_multiset);
+}
+
+void test_hash_multiset_insert_ptr__cstr(void** state)
+{
+    hash_multiset_t* pt_hash_multiset = create_hash_multiset(char*);
+    hash_multiset_iterator_t it_iter;
+
+    hash_multiset_init(pt_hash_multiset);
+    it_iter = hash_multiset_insert_ptr(pt_hash_multiset, "libcstl");
+    assert_true(strcmp((char*)iterator_get_pointer(it_iter), "libcstl") == 0);
+    assert_true(hash_multiset_count(pt_hash_multiset, "libcstl") == 1);
+
+    hash_multiset_destroy(pt_hash_multiset);
+}
+
+void test_hash_multiset_insert_ptr__libcstl_builtin(void** state)
+{
+    hash_multiset_t* pt_hash_multiset = create_hash_multiset(list_t<int>);
+    list_t* plist_list = create_list(int);
+    hash_multiset_iterator_t it_iter;
+
+    hash_multiset_init(pt_hash_multiset);
+    list_init_n(plist_list, 5);
+    it_iter = hash_multiset_insert_ptr(pt_hash_multiset, plist_list);
+    assert_true(list_equal((list_t*)iterator_get_pointer(it_iter), plist_list));
+    assert_true((list_t*)iterator_get_pointer(it_iter) != plist_list);
+
+    hash_multiset_destroy(pt_hash_multiset);
+    list_destroy(plist_list);
+}
+
+/*
+ * test hash_multiset_count_ptr
+ */
+UT_CASE_DEFINATION(hash_multiset_count_ptr)
+void test_hash_multiset_count_ptr__null_hash_multiset(void** state)
+{
+    int elem = 9;
+
+    expect_assert_failure(hash_multiset_count_ptr(NULL, &elem));
+}
+
+void test_hash_multiset_count_ptr__c_builtin(void** state)
+{
+    hash_multiset_t* pt_hash_multiset = create_hash_multiset(int);
+    int elem = 3;
+
+    hash_multiset_init(pt_hash_multiset);
+    hash_multiset_insert(pt_hash_multiset, 3);
+    hash_multiset_insert(pt_hash_multiset, 3);
+    hash_multiset_insert(pt_hash_multiset, 5);
+    assert_true(hash_multiset_count_ptr(pt_hash_multiset, &elem) == 2);
+    elem = 4;
+    assert_true(hash_multiset_count_ptr(pt_hash_multiset, &elem) == 0);
+
+    hash_multiset_destroy(pt_hash_multiset);
+}
+
+void test_hash_multiset_count_ptr__cstr(void** state)
+{
+    hash_multiset_t* pt_hash_multiset = create_hash_multiset(char*);
+
+    hash_multiset_init(pt_hash_multiset);
+    hash_multiset_insert(pt_hash_multiset, "abc");
+    assert_true(hash_multiset_count_ptr(pt_hash_multiset, "abc") == 1);
+    assert_true(hash_multiset_count_ptr(pt_hash_multiset, "abcd") == 0);
+
+    hash_multiset_destroy(pt_hash_multiset);
+}
+
+/*
+ * test hash_multiset_erase_ptr
+ */
+UT_CASE_DEFINATION(hash_multiset_erase_ptr)
+void test_hash_multiset_erase_ptr__null_hash_multiset(void** state)
+{
+    int elem = 9;
+
+    expect_assert_failure(hash_multiset_erase_ptr(NULL, &elem));
+}
+
+void test_hash_multiset_erase_ptr__c_builtin(void** state)
+{
+    hash_multiset_t* pt_hash_multiset = create_hash_multiset(int);
+    int elem = 3;
+
+    hash_multiset_init(pt_hash_multiset);
+    hash_multiset_insert(pt_hash_multiset, 3);
+    hash_multiset_insert(pt_hash_multiset, 3);
+    hash_multiset_insert(pt_hash_multiset, 5);
+    assert_true(hash_multiset_erase_ptr(pt_hash_multiset, &elem) == 2);
+    assert_true(hash_multiset_size(pt_hash_multiset) == 1);
+    assert_true(hash_multiset_erase_ptr(pt_hash_multiset, &elem) == 0);
+
+    hash_multiset_destroy(pt_hash_multiset);
+}
+
+void test_hash_multiset_erase_ptr__cstr(void** state)
+{
+    hash_multiset_t* pt_hash_multiset = create_hash_multiset(char*);
+
+    hash_multiset_init(pt_hash_multiset);
+    hash_multiset_insert(pt_hash_multiset, "abc");
+    hash_multiset_insert(pt_hash_multiset, "def");
+    assert_true(hash_multiset_erase_ptr(pt_hash_multiset, "abc") == 1);
+    assert_true(hash_multiset_size(pt_hash_multiset) == 1);
+
+    hash_multiset_destroy(pt_hash_multiset);
+}
+
@@ -140,6 +140,14 @@ void test_hash_multiset_max_size__null_hash_multiset(void** state);
 void test_hash_multiset_max_size__non_inited(void** state);
 void test_hash_multiset_max_size__empty(void** state);
 void test_hash_multiset_max_size__non_empty(void** state);
+/*
+ * test hash_multiset_memory_usage
+ */
+UT_CASE_DECLARATION(hash_multiset_memory_usage)
+void test_hash_multiset_memory_usage__null_hash_multiset(void** state);
+void test_hash_multiset_memory_usage__non_inited(void** state);
+void test_hash_multiset_memory_usage__empty(void** state);
+void test_hash_multiset_memory_usage__non_empty(void** state);
 /*
  * test hash_multiset_bucket_count
  */
@@ -384,6 +392,70 @@ void test_hash_multiset_resize__non_inited(void** state);
 void test_hash_multiset_resize__greater(void** state);
 void test_hash_multiset_resize__less(void** state);
 
+/*
+ * test hash_multiset_load_factor
+ */
+UT_CASE_DECLARATION(hash_multiset_load_factor)
+void test_hash_multiset_load_factor__null_hash_multiset(void** state);
+void test_hash_multiset_load_factor__successfully(void** state);
+/*
+ * test hash_multiset_max_load_factor
+ */
+UT_CASE_DECLARATION(hash_multiset_max_load_factor)
+void test_hash_multiset_max_load_factor__null_hash_multiset(void** state);
+void test_hash_multiset_max_load_factor__default(void** state);
+/*
+ * test hash_multiset_set_max_load_factor
+ */
+UT_CASE_DECLARATION(hash_multiset_set_max_load_factor)
+void test_hash_multiset_set_max_load_factor__null_hash_multiset(void** state);
+void test_hash_multiset_set_max_load_factor__invalid(void** state);
+void test_hash_multiset_set_max_load_factor__less(void** state);
+void test_hash_multiset_set_max_load_factor__init_copy(void** state);
+/*
+ * test hash_multiset_reserve
+ */
+UT_CASE_DECLARATION(hash_multiset_reserve)
+void test_hash_multiset_reserve__null_hash_multiset(void** state);
+void test_hash_multiset_reserve__reserve(void** state);
+/*
+ * test hash_multiset_shrink_to_fit
+ */
+UT_CASE_DECLARATION(hash_multiset_shrink_to_fit)
+void test_hash_multiset_shrink_to_fit__null_hash_multiset(void** state);
+void test_hash_multiset_shrink_to_fit__shrink(void** state);
+/*
+ * test hash_multiset_find_ptr
+ */
+UT_CASE_DECLARATION(hash_multiset_find_ptr)
+void test_hash_multiset_find_ptr__null_hash_multiset(void** state);
+void test_hash_multiset_find_ptr__null_value(void** state);
+void test_hash_multiset_find_ptr__c_builtin(void** state);
+void test_hash_multiset_find_ptr__cstr(void** state);
+void test_hash_multiset_find_ptr__libcstl_builtin(void** state);
+/*
+ * test hash_multiset_insert_ptr
+ */
+UT_CASE_DECLARATION(hash_multiset_insert_ptr)
+void test_hash_multiset_insert_ptr__null_hash_multiset(void** state);
+void test_hash_multiset_insert_ptr__null_value(void** state);
+void test_hash_multiset_insert_ptr__c_builtin(void** state);
+void test_hash_multiset_insert_ptr__cstr(void** state);
+void test_hash_multiset_insert_ptr__libcstl_builtin(void** state);
+/*
+ * test hash_multiset_count_ptr
+ */
+UT_CASE_DECLARATION(hash_multiset_count_ptr)
+void test_hash_multiset_count_ptr__null_hash_multiset(void** state);
+void test_hash_multiset_count_ptr__c_builtin(void** state);
+void test_hash_multiset_count_ptr__cstr(void** state);
+/*
+ * test hash_multiset_erase_ptr
+ */
+UT_CASE_DECLARATION(hash_multiset_erase_ptr)
+void test_hash_multiset_erase_ptr__null_hash_multiset(void** state);
+void test_hash_multiset_erase_ptr__c_builtin(void** state);
+void test_hash_multiset_erase_ptr__cstr(void** state);
 #define UT_CSTL_HASH_MULTISET_CASE\
     UT_SUIT_BEGIN(cstl_hash_multiset, test_hash_multiset_init__null_hash_multiset),\
     UT_CASE(test_hash_multiset_init__non_created),\
@@ -475,6 +547,10 @@ void test_hash_multiset_resize__less(void** state);
     UT_CASE(test_hash_multiset_max_size__non_inited),\
     UT_CASE(test_hash_multiset_max_size__empty),\
     UT_CASE(test_hash_multiset_max_size__non_empty),\
+    UT_CASE_BEGIN(hash_multiset_memory_usage, test_hash_multiset_memory_usage__null_hash_multiset),\
+    UT_CASE(test_hash_multiset_memory_usage__non_inited),\
+    UT_CASE(test_hash_multiset_memory_usage__empty),\
+    UT_CASE(test_hash_multiset_memory_usage__non_empty),\
     UT_CASE_BEGIN(hash_multiset_bucket_count, test_hash_multiset_bucket_count__null_hash_multiset),\
     UT_CASE(test_hash_multiset_bucket_count__non_inited),\
     UT_CASE(test_hash_multiset_bucket_count__empty),\
@@ -645,7 +721,35 @@ void test_hash_multiset_resize__less(void** state);
     UT_CASE_BEGIN(hash_multiset_resize, test_hash_multiset_resize__null_hash_multiset),\
     UT_CASE(test_hash_multiset_resize__non_inited),\
     UT_CASE(test_hash_multiset_resize__greater),\
-    UT_CASE(test_hash_multiset_resize__less)
+    UT_CASE(test_hash_multiset_resize__less),\
+    UT_CASE_BEGIN(hash_multiset_load_factor, test_hash_multiset_load_factor__null_hash_multiset),\
+    UT_CASE(test_hash_multiset_load_factor__successfully),\
+    UT_CASE_BEGIN(hash_multiset_max_load_factor, test_hash_multiset_max_load_factor__null_hash_multiset),\
+    UT_CASE(test_hash_multiset_max_load_factor__default),\
+    UT_CASE_BEGIN(hash_multiset_set_max_load_factor, test_hash_multiset_set_max_load_factor__null_hash_multiset),\
+    UT_CASE(test_hash_multiset_set_max_load_factor__invalid),\
+    UT_CASE(test_hash_multiset_set_max_load_factor__less),\
+    UT_CASE(test_hash_multiset_set_max_load_factor__init_copy),\
+    UT_CASE_BEGIN(hash_multiset_reserve, test_hash_multiset_reserve__null_hash_multiset),\
+    UT_CASE(test_hash_multiset_reserve__reserve),\
+    UT_CASE_BEGIN(hash_multiset_shrink_to_fit, test_hash_multiset_shrink_to_fit__null_hash_multiset),\
+    UT_CASE(test_hash_multiset_shrink_to_fit__shrink),\
+    UT_CASE_BEGIN(hash_multiset_find_ptr, test_hash_multiset_find_ptr__null_hash_multiset),\
+    UT_CASE(test_hash_multiset_find_ptr__null_value),\
+    UT_CASE(test_hash_multiset_find_ptr__c_builtin),\
+    UT_CASE(test_hash_multiset_find_ptr__cstr),\
+    UT_CASE(test_hash_multiset_find_ptr__libcstl_builtin),\
+    UT_CASE_BEGIN(hash_multiset_insert_ptr, test_hash_multiset_insert_ptr__null_hash_multiset),\
+    UT_CASE(test_hash_multiset_insert_ptr__null_value),\
+    UT_CASE(test_hash_multiset_insert_ptr__c_builtin),\
+    UT_CASE(test_hash_multiset_insert_ptr__cstr),\
+    UT_CASE(test_hash_multiset_insert_ptr__libcstl_builtin),\
+    UT_CASE_BEGIN(hash_multiset_count_ptr, test_hash_multiset_count_ptr__null_hash_multiset),\
+    UT_CASE(test_hash_multiset_count_ptr__c_builtin),\
+    UT_CASE(test_hash_multiset_count_ptr__cstr),\
+    UT_CASE_BEGIN(hash_multiset_erase_ptr, test_hash_multiset_erase_ptr__null_hash_multiset),\
+    UT_CASE(test_hash_multiset_erase_ptr__c_builtin),\
+    UT_CASE(test_hash_multiset_erase_ptr__cstr)
 
 #endif /* _UT_CSTL_HASH_MULTISET_H_ */
 
@@ -72,6 +72,58 @@ void test__create_hash_multiset__unregister(void** state)
     assert_true(pt_hash_multiset == NULL);
 }
 
+/*
+ * test _create_hash_multiset_with_allocator
+ */
+UT_CASE_DEFINATION(_create_hash_multiset_with_allocator)
+static void* _create_hash_multiset_with_allocator__allocate(void* pv_context, size_t t_size)
+{
+    ((size_t*)pv_context)[0]++;
+    return malloc(t_size);
+}
+
+static void _create_hash_multiset_with_allocator__deallocate(void* pv_context, void* pv_mem, size_t t_size)
+{
+    ((size_t*)pv_context)[1]++;
+    free(pv_mem);
+}
+
+void test__create_hash_multiset_with_allocator__null_allocator(void** state)
+{
+    expect_assert_failure(_create_hash_multiset_with_allocator(NULL, "int"));
+}
+
+void test__create_hash_multiset_with_allocator__unregisted_type(void** state)
+{
+    size_t at_count[2] = {0, 0};
+    allocator_t t_allocator = {_create_hash_multiset_with_allocator__allocate, _create_hash_multiset_with_allocator__deallocate, NULL};
+
+    t_allocator._pv_context = at_count;
+    assert_true(_create_hash_multiset_with_allocator(&t_allocator, "unregisted_type_t") == NULL);
+    assert_true(at_count[0] == 0 && at_count[1] == 0);
+}
+
+void test__create_hash_multiset_with_allocator__allocate_by_allocator(void** state)
+{
+    size_t at_count[2] = {0, 0};
+    allocator_t t_allocator = {_create_hash_multiset_with_allocator__allocate, _create_hash_multiset_with_allocator__deallocate, NULL};
+    hash_multiset_t* phmset = NULL;
+    int i = 0;
+
+    t_allocator._pv_context = at_count;
+    phmset = _create_hash_multiset_with_allocator(&t_allocator, "int");
+    assert_true(phmset != NULL);
+    hash_multiset_init(phmset);
+    for (i = 0; i < 100; ++i) {
+        hash_multiset_insert(phmset, i);
+    }
+    assert_true(hash_multiset_size(phmset) == 100);
+    assert_true(at_count[0] > 0);
+
+    hash_multiset_destroy(phmset);
+    assert_true(at_count[0] == at_count[1]);
+}
+
 /*
  * test _create_hash_multiset_auxiliary
  */
@@ -722,7 +774,7 @@ void test__hash_multiset_equal_range__hash_multiset_equal_range_varg__c_builtin_
     elem = 2;
     r_range = _hash_multiset_equal_range(pt_hash_multiset, elem);
     assert_true(*(int*)iterator_get_pointer(r_range.it_begin) == 2);
-    assert_true(*(int*)iterator_get_pointer(r_range.it_end) == 3);
+    assert_true(iterator_equal(r_range.it_end, iterator_next(r_range.it_begin)));
 
     hash_multiset_destroy(pt_hash_multiset);
 }
@@ -762,7 +814,7 @@ void test__hash_multiset_equal_range__hash_multiset_equal_range_varg__cstr_upper
 
     r_range = _hash_multiset_equal_range(pt_hash_multiset, "ggg");
     assert_true(strcmp((char*)iterator_get_pointer(r_range.it_begin), "ggg") == 0);
-    assert_true(iterator_equal(r_range.it_end, hash_multiset_end(pt_hash_multiset)));
+    assert_true(iterator_equal(r_range.it_end, iterator_next(r_range.it_begin)));
 
     hash_multiset_destroy(pt_hash_multiset);
 }
@@ -865,7 +917,7 @@ void test__hash_multiset_equal_range__hash_multiset_equal_range_varg__user_defin
     elem.n_elem = 8;
     r_range = _hash_multiset_equal_range(pt_hash_multiset, &elem);
     assert_true(((_test__hash_multiset_equal_range__hash_multiset_equal_range_varg__user_define_t*)iterator_get_pointer(r_range.it_begin))->n_elem == 8);
-    assert_true(((_test__hash_multiset_equal_range__hash_multiset_equal_range_varg__user_define_t*)iterator_get_pointer(r_range.it_end))->n_elem == 9);
+    assert_true(iterator_equal(r_range.it_end, iterator_next(r_range.it_begin)));
 
     hash_multiset_destroy(pt_hash_multiset);
 }
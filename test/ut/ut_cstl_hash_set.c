@@ -11,6 +11,7 @@
 #include "cstl/clist.h"
 #include "cstl_vector_aux.h"
 #include "cstl_hashtable_aux.h"
+#include "cstl_flat_hashtable_aux.h"
 #include "cstl_hash_set_aux.h"
 #include "cstl/cslist.h"
 #include "cstl/cdeque.h"
@@ -46,7 +47,11 @@ void test_hash_set_init__null_compare(void** state)
     hash_set_t* pt_hash_set = create_hash_set(int);
 
     hash_set_init(pt_hash_set);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_hash_set->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_hash_set->_t_hashtable));
+#endif
 
     hash_set_destroy(pt_hash_set);
 }
@@ -76,7 +81,11 @@ void test_hash_set_init_ex__0_bucket(void** state)
     hash_set_t* pt_hash_set = create_hash_set(int);
 
     hash_set_init_ex(pt_hash_set, 0, NULL, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_hash_set->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_hash_set->_t_hashtable));
+#endif
 
     hash_set_destroy(pt_hash_set);
 }
@@ -86,7 +95,11 @@ void test_hash_set_init_ex__non_0_bucket(void** state)
     hash_set_t* pt_hash_set = create_hash_set(int);
 
     hash_set_init_ex(pt_hash_set, 100, NULL, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_hash_set->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_hash_set->_t_hashtable));
+#endif
 
     hash_set_destroy(pt_hash_set);
 }
@@ -96,7 +109,11 @@ void test_hash_set_init_ex__null_hash(void** state)
     hash_set_t* pt_hash_set = create_hash_set(int);
 
     hash_set_init_ex(pt_hash_set, 0, NULL, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_hash_set->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_hash_set->_t_hashtable));
+#endif
 
     hash_set_destroy(pt_hash_set);
 }
@@ -110,7 +127,11 @@ void test_hash_set_init_ex__non_null_hash(void** state)
     hash_set_t* pt_hash_set = create_hash_set(int);
 
     hash_set_init_ex(pt_hash_set, 0, _test_hash_set_init_ex__non_null_hash, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_hash_set->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_hash_set->_t_hashtable));
+#endif
 
     hash_set_destroy(pt_hash_set);
 }
@@ -120,7 +141,11 @@ void test_hash_set_init_ex__null_compare(void** state)
     hash_set_t* pt_hash_set = create_hash_set(int);
 
     hash_set_init_ex(pt_hash_set, 0, NULL, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_hash_set->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_hash_set->_t_hashtable));
+#endif
 
     hash_set_destroy(pt_hash_set);
 }
@@ -134,7 +159,11 @@ void test_hash_set_init_ex__non_null_compare(void** state)
     hash_set_t* pt_hash_set = create_hash_set(int);
 
     hash_set_init_ex(pt_hash_set, 0, NULL, _test_hash_set_init_ex__non_null_compare);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_hash_set->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_hash_set->_t_hashtable));
+#endif
     assert_true(pt_hash_set->_t_hashtable._bfun_compare == _test_hash_set_init_ex__non_null_compare);
 
     hash_set_destroy(pt_hash_set);
@@ -210,7 +239,11 @@ void test_hash_set_init_copy__empty(void** state)
 
     hash_set_init_ex(pt_src, 0, NULL, NULL);
     hash_set_init_copy(pt_dest, pt_src);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(hash_set_empty(pt_dest));
 
     hash_set_destroy(pt_dest);
@@ -226,7 +259,11 @@ void test_hash_set_init_copy__non_empty(void** state)
     hash_set_init_ex(pt_src, 0, NULL, NULL);
     hash_set_insert(pt_src, elem);
     hash_set_init_copy(pt_dest, pt_src);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(hash_set_size(pt_dest) == 1);
 
     hash_set_destroy(pt_dest);
@@ -245,9 +282,17 @@ void test_hash_set_init_copy__non_0_bucket(void** state)
         hash_set_insert(pt_src, i);
     }
     hash_set_init_copy(pt_dest, pt_src);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(hash_set_size(pt_dest) == 10);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_set_bucket_count(pt_dest) == 128);
+#else
     assert_true(hash_set_bucket_count(pt_dest) == 193);
+#endif
 
     hash_set_destroy(pt_dest);
     hash_set_destroy(pt_src);
@@ -269,7 +314,11 @@ void test_hash_set_init_copy__non_null_hash(void** state)
         hash_set_insert(pt_src, i);
     }
     hash_set_init_copy(pt_dest, pt_src);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(hash_set_size(pt_dest) == 10);
     assert_true(hash_set_hash(pt_dest) == _test_hash_set_init_copy__non_null_hash);
 
@@ -293,7 +342,11 @@ void test_hash_set_init_copy__non_null_compare(void** state)
         hash_set_insert(pt_src, i);
     }
     hash_set_init_copy(pt_dest, pt_src);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(hash_set_size(pt_dest) == 10);
     assert_true(hash_set_key_comp(pt_dest) == _test_hash_set_init_copy__non_null_compare);
 
@@ -408,7 +461,11 @@ void test_hash_set_init_copy_range__empty(void** state)
     it_begin = hash_set_begin(pt_src);
     it_end = hash_set_end(pt_src);
     hash_set_init_copy_range(pt_dest, it_begin, it_end);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(hash_set_empty(pt_dest));
 
     hash_set_destroy(pt_dest);
@@ -428,7 +485,11 @@ void test_hash_set_init_copy_range__non_empty(void** state)
     it_begin = hash_set_begin(pt_src);
     it_end = hash_set_end(pt_src);
     hash_set_init_copy_range(pt_dest, it_begin, it_end);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(hash_set_size(pt_dest) == 1);
     assert_true(hash_set_equal(pt_dest, pt_src));
 
@@ -443,7 +504,11 @@ void test_hash_set_init_copy_range__non_empty_dup(void** state)
 
     vector_init_elem(pvec, 10, 100);
     hash_set_init_copy_range(phset, vector_begin(pvec), vector_end(pvec));
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&phset->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&phset->_t_hashtable));
+#endif
     assert_true(hash_set_size(phset) == 1);
 
     hash_set_destroy(phset);
@@ -463,9 +528,17 @@ void test_hash_set_init_copy_range__non_0_bucket(void** state)
     it_begin = hash_set_begin(pt_src);
     it_end = hash_set_end(pt_src);
     hash_set_init_copy_range(pt_dest, it_begin, it_end);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(hash_set_size(pt_dest) == 1);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_set_bucket_count(pt_dest) == 64);
+#else
     assert_true(hash_set_bucket_count(pt_dest) == 53);
+#endif
 
     hash_set_destroy(pt_dest);
     hash_set_destroy(pt_src);
@@ -488,7 +561,11 @@ void test_hash_set_init_copy_range__non_null_hash(void** state)
     it_begin = hash_set_begin(pt_src);
     it_end = hash_set_end(pt_src);
     hash_set_init_copy_range(pt_dest, it_begin, it_end);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(hash_set_size(pt_dest) == 1);
     assert_true(hash_set_hash(pt_dest) == _hashtable_default_hash);
 
@@ -513,7 +590,11 @@ void test_hash_set_init_copy_range__non_null_compare(void** state)
     it_begin = hash_set_begin(pt_src);
     it_end = hash_set_end(pt_src);
     hash_set_init_copy_range(pt_dest, it_begin, it_end);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(hash_set_size(pt_dest) == 1);
     assert_true(hash_set_key_comp(pt_dest) != _test_hash_set_init_copy_range__non_null_compare);
 
@@ -583,7 +664,11 @@ void test_hash_set_init_copy_array__empty(void** state)
     hash_set_t* pt_dest = create_hash_set(int);
 
     hash_set_init_copy_array(pt_dest, an_array, 0);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(hash_set_empty(pt_dest));
 
     hash_set_destroy(pt_dest);
@@ -599,7 +684,11 @@ void test_hash_set_init_copy_array__non_empty(void** state)
         an_array[i] = i;
     }
     hash_set_init_copy_array(pt_dest, an_array, 10);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(hash_set_size(pt_dest) == 10);
 
     hash_set_destroy(pt_dest);
@@ -611,7 +700,11 @@ void test_hash_set_init_copy_array__non_empty_dup(void** state)
     hash_set_t* phset = create_hash_set(int);
 
     hash_set_init_copy_array(phset, an_array, 10);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&phset->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&phset->_t_hashtable));
+#endif
     assert_true(hash_set_size(phset) == 1);
 
     hash_set_destroy(phset);
@@ -724,7 +817,11 @@ void test_hash_set_init_copy_range_ex__empty(void** state)
     it_begin = hash_set_begin(pt_src);
     it_end = hash_set_end(pt_src);
     hash_set_init_copy_range_ex(pt_dest, it_begin, it_end, 0, NULL, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(hash_set_empty(pt_dest));
 
     hash_set_destroy(pt_dest);
@@ -744,7 +841,11 @@ void test_hash_set_init_copy_range_ex__non_empty(void** state)
     it_begin = hash_set_begin(pt_src);
     it_end = hash_set_end(pt_src);
     hash_set_init_copy_range_ex(pt_dest, it_begin, it_end, 0, NULL, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(hash_set_size(pt_dest) == 1);
     assert_true(hash_set_equal(pt_dest, pt_src));
 
@@ -765,9 +866,17 @@ void test_hash_set_init_copy_range_ex__non_0_bucket(void** state)
     it_begin = hash_set_begin(pt_src);
     it_end = hash_set_end(pt_src);
     hash_set_init_copy_range_ex(pt_dest, it_begin, it_end, 100, NULL, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(hash_set_size(pt_dest) == 1);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_set_bucket_count(pt_dest) == 128);
+#else
     assert_true(hash_set_bucket_count(pt_dest) == 193);
+#endif
 
     hash_set_destroy(pt_dest);
     hash_set_destroy(pt_src);
@@ -790,7 +899,11 @@ void test_hash_set_init_copy_range_ex__hash(void** state)
     it_begin = hash_set_begin(pt_src);
     it_end = hash_set_end(pt_src);
     hash_set_init_copy_range_ex(pt_dest, it_begin, it_end, 0, _test_hash_set_init_copy_range_ex__non_null_hash, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(hash_set_size(pt_dest) == 1);
     assert_true(hash_set_hash(pt_dest) == _test_hash_set_init_copy_range_ex__non_null_hash);
 
@@ -815,7 +928,11 @@ void test_hash_set_init_copy_range_ex__compare(void** state)
     it_begin = hash_set_begin(pt_src);
     it_end = hash_set_end(pt_src);
     hash_set_init_copy_range_ex(pt_dest, it_begin, it_end, 0, NULL, _test__hash_set_init_compare_range_ex__compare);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(hash_set_size(pt_dest) == 1);
     assert_true(hash_set_key_comp(pt_dest) == _test__hash_set_init_compare_range_ex__compare);
 
@@ -885,7 +1002,11 @@ void test_hash_set_init_copy_array_ex__empty(void** state)
     hash_set_t* pt_dest = create_hash_set(int);
 
     hash_set_init_copy_array_ex(pt_dest, an_array, 0, 0, NULL, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(hash_set_empty(pt_dest));
 
     hash_set_destroy(pt_dest);
@@ -901,7 +1022,11 @@ void test_hash_set_init_copy_array_ex__non_empty(void** state)
         an_array[i] = i;
     }
     hash_set_init_copy_array_ex(pt_dest, an_array, 10, 0, NULL, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(hash_set_size(pt_dest) == 10);
 
     hash_set_destroy(pt_dest);
@@ -913,9 +1038,17 @@ void test_hash_set_init_copy_array_ex__non_0_bucket(void** state)
     hash_set_t* pt_dest = create_hash_set(int);
 
     hash_set_init_copy_array_ex(pt_dest, an_array, 10, 100, NULL, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(hash_set_size(pt_dest) == 1);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_set_bucket_count(pt_dest) == 128);
+#else
     assert_true(hash_set_bucket_count(pt_dest) == 193);
+#endif
 
     hash_set_destroy(pt_dest);
 }
@@ -930,7 +1063,11 @@ void test_hash_set_init_copy_array_ex__hash(void** state)
     hash_set_t* pt_dest = create_hash_set(int);
 
     hash_set_init_copy_array_ex(pt_dest, an_array, 10, 0, _test_hash_set_init_copy_array_ex__non_null_hash, NULL);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(hash_set_size(pt_dest) == 1);
     assert_true(hash_set_hash(pt_dest) == _test_hash_set_init_copy_array_ex__non_null_hash);
 
@@ -947,7 +1084,11 @@ void test_hash_set_init_copy_array_ex__compare(void** state)
     hash_set_t* pt_dest = create_hash_set(int);
 
     hash_set_init_copy_array_ex(pt_dest, an_array, 10, 0, NULL, _test__hash_set_init_compare_array_ex__compare);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(_flat_hashtable_is_inited(&pt_dest->_t_hashtable));
+#else
     assert_true(_hashtable_is_inited(&pt_dest->_t_hashtable));
+#endif
     assert_true(hash_set_size(pt_dest) == 1);
     assert_true(hash_set_key_comp(pt_dest) == _test__hash_set_init_compare_array_ex__compare);
 
@@ -1314,6 +1455,53 @@ void test_hash_set_max_size__non_empty(void** state)
     hash_set_destroy(pt_hash_set);
 }
 
+/*
+ * test hash_set_memory_usage
+ */
+UT_CASE_DEFINATION(hash_set_memory_usage)
+void test_hash_set_memory_usage__null_hash_set(void** state)
+{
+    expect_assert_failure(hash_set_memory_usage(NULL));
+}
+
+void test_hash_set_memory_usage__non_inited(void** state)
+{
+    hash_set_t* pt_hash_set = create_hash_set(int);
+    hash_set_init_ex(pt_hash_set, 0, NULL, NULL);
+
+    pt_hash_set->_t_hashtable._t_typeinfo._t_style = 3333;
+    expect_assert_failure(hash_set_memory_usage(pt_hash_set));
+    pt_hash_set->_t_hashtable._t_typeinfo._t_style = _TYPE_C_BUILTIN;
+
+    hash_set_destroy(pt_hash_set);
+}
+
+void test_hash_set_memory_usage__empty(void** state)
+{
+    hash_set_t* pt_hash_set = create_hash_set(int);
+    hash_set_init_ex(pt_hash_set, 0, NULL, NULL);
+
+    assert_true(hash_set_memory_usage(pt_hash_set) >= sizeof(hash_set_t));
+
+    hash_set_destroy(pt_hash_set);
+}
+
+void test_hash_set_memory_usage__non_empty(void** state)
+{
+    hash_set_t* pt_hash_set = create_hash_set(int);
+    size_t t_usage = 0;
+    int i = 0;
+
+    hash_set_init(pt_hash_set);
+    t_usage = hash_set_memory_usage(pt_hash_set);
+    for (i = 0; i < 1000; ++i) {
+        hash_set_insert(pt_hash_set, i);
+    }
+    assert_true(hash_set_memory_usage(pt_hash_set) >= t_usage + 1000 * sizeof(int));
+
+    hash_set_destroy(pt_hash_set);
+}
+
 /*
  * test hash_set_bucket_count
  */
@@ -1340,7 +1528,11 @@ void test_hash_set_bucket_count__empty(void** state)
     hash_set_t* pt_hash_set = create_hash_set(int);
     hash_set_init_ex(pt_hash_set, 0, NULL, NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_set_bucket_count(pt_hash_set) == 64);
+#else
     assert_true(hash_set_bucket_count(pt_hash_set) == 53);
+#endif
 
     hash_set_destroy(pt_hash_set);
 }
@@ -1353,7 +1545,11 @@ void test_hash_set_bucket_count__non_empty(void** state)
     hash_set_init_ex(pt_hash_set, 100, NULL, NULL);
     hash_set_insert(pt_hash_set, elem);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_set_bucket_count(pt_hash_set) == 128);
+#else
     assert_true(hash_set_bucket_count(pt_hash_set) == 193);
+#endif
 
     hash_set_destroy(pt_hash_set);
 }
@@ -1786,7 +1982,11 @@ void test_hash_set_equal__not_same_bucketcount(void** state)
     hash_set_init_ex(pt_first, 0, NULL, NULL);
     hash_set_init_ex(pt_second, 100, NULL, NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_set_equal(pt_first, pt_second));
+#else
     assert_false(hash_set_equal(pt_first, pt_second));
+#endif
 
     hash_set_destroy(pt_first);
     hash_set_destroy(pt_second);
@@ -2061,7 +2261,11 @@ void test_hash_set_not_equal__not_same_bucketcount(void** state)
         hash_set_insert(pt_second, i);
     }
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_false(hash_set_not_equal(pt_first, pt_second));
+#else
     assert_true(hash_set_not_equal(pt_first, pt_second));
+#endif
 
     hash_set_destroy(pt_first);
     hash_set_destroy(pt_second);
@@ -2343,7 +2547,11 @@ void test_hash_set_less__not_same_bucketcount(void** state)
         hash_set_insert(pt_second, i);
     }
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_false(hash_set_less(pt_first, pt_second));
+#else
     expect_assert_failure(hash_set_less(pt_first, pt_second));
+#endif
 
     hash_set_destroy(pt_first);
     hash_set_destroy(pt_second);
@@ -2625,7 +2833,11 @@ void test_hash_set_less_equal__not_same_bucketcount(void** state)
         hash_set_insert(pt_second, i);
     }
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_set_less_equal(pt_first, pt_second));
+#else
     expect_assert_failure(hash_set_less_equal(pt_first, pt_second));
+#endif
 
     hash_set_destroy(pt_first);
     hash_set_destroy(pt_second);
@@ -2907,7 +3119,11 @@ void test_hash_set_greater__not_same_bucketcount(void** state)
         hash_set_insert(pt_second, i);
     }
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_false(hash_set_greater(pt_first, pt_second));
+#else
     expect_assert_failure(hash_set_greater(pt_first, pt_second));
+#endif
 
     hash_set_destroy(pt_first);
     hash_set_destroy(pt_second);
@@ -3189,7 +3405,11 @@ void test_hash_set_greater_equal__not_same_bucketcount(void** state)
         hash_set_insert(pt_second, i);
     }
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_set_greater_equal(pt_first, pt_second));
+#else
     expect_assert_failure(hash_set_greater_equal(pt_first, pt_second));
+#endif
 
     hash_set_destroy(pt_first);
     hash_set_destroy(pt_second);
@@ -3344,7 +3564,13 @@ void test_hash_set_swap__not_same_bucketcount(void** state)
     hash_set_init(pt_first);
     hash_set_init_ex(pt_second, 928, NULL, NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    hash_set_swap(pt_first, pt_second);
+    assert_true(hash_set_bucket_count(pt_first) == 1024);
+    assert_true(hash_set_bucket_count(pt_second) == 64);
+#else
     expect_assert_failure(hash_set_swap(pt_first, pt_second));
+#endif
 
     hash_set_destroy(pt_first);
     hash_set_destroy(pt_second);
@@ -4017,6 +4243,7 @@ void test_hash_set_erase_pos__begin(void** state)
     hash_set_t* pt_hash_set = create_hash_set(int);
     hash_set_iterator_t it_pos;
     int i = 0;
+    int n_expect = 0;
 
     hash_set_init(pt_hash_set);
     for(i = 0; i < 10; ++i)
@@ -4024,11 +4251,11 @@ void test_hash_set_erase_pos__begin(void** state)
         hash_set_insert(pt_hash_set, i);
     }
     it_pos = hash_set_begin(pt_hash_set);
-    assert_true(*(int*)iterator_get_pointer(it_pos) == 0);
+    n_expect = *(int*)iterator_get_pointer(iterator_next(it_pos));
     hash_set_erase_pos(pt_hash_set, it_pos);
     assert_true(hash_set_size(pt_hash_set) == 9);
     it_pos = hash_set_begin(pt_hash_set);
-    assert_true(*(int*)iterator_get_pointer(it_pos) == 1);
+    assert_true(*(int*)iterator_get_pointer(it_pos) == n_expect);
 
     hash_set_destroy(pt_hash_set);
 }
@@ -4060,6 +4287,7 @@ void test_hash_set_erase_pos__last(void** state)
     hash_set_t* pt_hash_set = create_hash_set(int);
     hash_set_iterator_t it_pos;
     int i = 0;
+    int n_expect = 0;
 
     hash_set_init(pt_hash_set);
     for(i = 0; i < 10; ++i)
@@ -4067,11 +4295,11 @@ void test_hash_set_erase_pos__last(void** state)
         hash_set_insert(pt_hash_set, i);
     }
     it_pos = iterator_prev(hash_set_end(pt_hash_set));
-    assert_true(*(int*)iterator_get_pointer(it_pos) == 9);
+    n_expect = *(int*)iterator_get_pointer(iterator_prev(it_pos));
     hash_set_erase_pos(pt_hash_set, it_pos);
     assert_true(hash_set_size(pt_hash_set) == 9);
     it_pos = iterator_prev(hash_set_end(pt_hash_set));
-    assert_true(*(int*)iterator_get_pointer(it_pos) == 8);
+    assert_true(*(int*)iterator_get_pointer(it_pos) == n_expect);
 
     hash_set_destroy(pt_hash_set);
 }
@@ -4194,6 +4422,7 @@ void test_hash_set_erase_range__begin(void** state)
     hash_set_iterator_t it_begin;
     hash_set_iterator_t it_end;
     int i = 0;
+    int n_expect = 0;
 
     hash_set_init(pt_dest);
     for(i = 0; i < 10; ++i)
@@ -4203,9 +4432,10 @@ void test_hash_set_erase_range__begin(void** state)
 
     it_begin = hash_set_begin(pt_dest);
     it_end = iterator_next(it_begin);
+    n_expect = *(int*)iterator_get_pointer(iterator_next(it_begin));
     hash_set_erase_range(pt_dest, it_begin, it_end);
     assert_true(hash_set_size(pt_dest) == 9);
-    assert_true(*(int*)iterator_get_pointer(hash_set_begin(pt_dest)) == 1);
+    assert_true(*(int*)iterator_get_pointer(hash_set_begin(pt_dest)) == n_expect);
 
     hash_set_destroy(pt_dest);
 }
@@ -4216,6 +4446,8 @@ void test_hash_set_erase_range__middle(void** state)
     hash_set_iterator_t it_begin;
     hash_set_iterator_t it_end;
     int i = 0;
+    int n_first = 0;
+    int n_second = 0;
 
     hash_set_init(pt_dest);
     for(i = 0; i < 10; ++i)
@@ -4225,11 +4457,13 @@ void test_hash_set_erase_range__middle(void** state)
 
     it_begin = iterator_next(hash_set_begin(pt_dest));
     it_end = iterator_next(it_begin);
+    n_first = *(int*)iterator_get_pointer(iterator_prev(it_begin));
+    n_second = *(int*)iterator_get_pointer(it_end);
     hash_set_erase_range(pt_dest, it_begin, it_end);
     assert_true(hash_set_size(pt_dest) == 9);
     it_begin = hash_set_begin(pt_dest);
-    assert_true(*(int*)iterator_get_pointer(it_begin) == 0);
-    assert_true(*(int*)iterator_get_pointer(iterator_next(it_begin)) == 2);
+    assert_true(*(int*)iterator_get_pointer(it_begin) == n_first);
+    assert_true(*(int*)iterator_get_pointer(iterator_next(it_begin)) == n_second);
 
     hash_set_destroy(pt_dest);
 }
@@ -4240,6 +4474,7 @@ void test_hash_set_erase_range__end(void** state)
     hash_set_iterator_t it_begin;
     hash_set_iterator_t it_end;
     int i = 0;
+    int n_expect = 0;
 
     hash_set_init(pt_dest);
     for(i = 0; i < 10; ++i)
@@ -4249,10 +4484,11 @@ void test_hash_set_erase_range__end(void** state)
 
     it_end = hash_set_end(pt_dest);
     it_begin = iterator_prev(it_end);
+    n_expect = *(int*)iterator_get_pointer(iterator_prev(it_begin));
     hash_set_erase_range(pt_dest, it_begin, it_end);
     assert_true(hash_set_size(pt_dest) == 9);
     it_end = hash_set_end(pt_dest);
-    assert_true(*(int*)iterator_get_pointer(iterator_prev(it_end)) == 8);
+    assert_true(*(int*)iterator_get_pointer(iterator_prev(it_end)) == n_expect);
 
     hash_set_destroy(pt_dest);
 }
@@ -4304,9 +4540,17 @@ void test_hash_set_resize__greater(void** state)
     hash_set_t* pt_hash_set = create_hash_set(int);
     hash_set_init(pt_hash_set);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_set_bucket_count(pt_hash_set) == 64);
+#else
     assert_true(hash_set_bucket_count(pt_hash_set) == 53);
+#endif
     hash_set_resize(pt_hash_set, 100);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_set_bucket_count(pt_hash_set) == 128);
+#else
     assert_true(hash_set_bucket_count(pt_hash_set) == 193);
+#endif
 
     hash_set_destroy(pt_hash_set);
 }
@@ -4316,9 +4560,521 @@ void test_hash_set_resize__less(void** state)
     hash_set_t* pt_hash_set = create_hash_set(int);
     hash_set_init_ex(pt_hash_set, 100, NULL, NULL);
 
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_set_bucket_count(pt_hash_set) == 128);
+#else
     assert_true(hash_set_bucket_count(pt_hash_set) == 193);
+#endif
     hash_set_resize(pt_hash_set, 0);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_set_bucket_count(pt_hash_set) == 128);
+#else
+    assert_true(hash_set_bucket_count(pt_hash_set) == 193);
+#endif
+
+    hash_set_destroy(pt_hash_set);
+}
+
+/*
+ * test hash_set_load_factor
+ */
+UT_CASE_DEFINATION(hash_set_load_factor)
+void test_hash_set_load_factor__null_hash_set(void** state)
+{
+    expect_assert_failure(hash_set_load_factor(NULL));
+}
+
+void test_hash_set_load_factor__successfully(void** state)
+{
+    hash_set_t* pt_hash_set = create_hash_set(int);
+    int i = 0;
+
+    hash_set_init(pt_hash_set);
+    for (i = 0; i < 32; ++i) {
+        hash_set_insert(pt_hash_set, i);
+    }
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_set_load_factor(pt_hash_set) == 0.5f);
+#else
+    assert_true(hash_set_load_factor(pt_hash_set) == (float)32 / (float)53);
+#endif
+
+    hash_set_destroy(pt_hash_set);
+}
+
+/*
+ * test hash_set_max_load_factor
+ */
+UT_CASE_DEFINATION(hash_set_max_load_factor)
+void test_hash_set_max_load_factor__null_hash_set(void** state)
+{
+    expect_assert_failure(hash_set_max_load_factor(NULL));
+}
+
+void test_hash_set_max_load_factor__default(void** state)
+{
+    hash_set_t* pt_hash_set = create_hash_set(int);
+
+    hash_set_init(pt_hash_set);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_set_max_load_factor(pt_hash_set) == 0.875f);
+#else
+    assert_true(hash_set_max_load_factor(pt_hash_set) == 1.0f);
+#endif
+
+    hash_set_destroy(pt_hash_set);
+}
+
+/*
+ * test hash_set_set_max_load_factor
+ */
+UT_CASE_DEFINATION(hash_set_set_max_load_factor)
+void test_hash_set_set_max_load_factor__null_hash_set(void** state)
+{
+    expect_assert_failure(hash_set_set_max_load_factor(NULL, 1.0f));
+}
+
+void test_hash_set_set_max_load_factor__invalid(void** state)
+{
+    hash_set_t* pt_hash_set = create_hash_set(int);
+
+    hash_set_init(pt_hash_set);
+    expect_assert_failure(hash_set_set_max_load_factor(pt_hash_set, 0.0f));
+
+    hash_set_destroy(pt_hash_set);
+}
+
+void test_hash_set_set_max_load_factor__less(void** state)
+{
+    hash_set_t* pt_hash_set = create_hash_set(int);
+    int i = 0;
+
+    hash_set_init(pt_hash_set);
+    for (i = 0; i < 50; ++i) {
+        hash_set_insert(pt_hash_set, i);
+    }
+    hash_set_set_max_load_factor(pt_hash_set, 0.5f);
+    assert_true(hash_set_max_load_factor(pt_hash_set) == 0.5f);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_set_bucket_count(pt_hash_set) == 128);
+#else
+    assert_true(hash_set_bucket_count(pt_hash_set) == 193);
+#endif
+    assert_true(hash_set_size(pt_hash_set) == 50);
+
+    hash_set_destroy(pt_hash_set);
+}
+
+void test_hash_set_set_max_load_factor__init_copy(void** state)
+{
+    hash_set_t* pt_hash_set = create_hash_set(int);
+    hash_set_t* pt_dest = create_hash_set(int);
+
+    hash_set_init(pt_hash_set);
+    hash_set_set_max_load_factor(pt_hash_set, 0.5f);
+    hash_set_init_copy(pt_dest, pt_hash_set);
+    assert_true(hash_set_max_load_factor(pt_dest) == 0.5f);
+
+    hash_set_destroy(pt_hash_set);
+    hash_set_destroy(pt_dest);
+}
+
+/*
+ * test hash_set_reserve
+ */
+UT_CASE_DEFINATION(hash_set_reserve)
+void test_hash_set_reserve__null_hash_set(void** state)
+{
+    expect_assert_failure(hash_set_reserve(NULL, 100));
+}
+
+void test_hash_set_reserve__reserve(void** state)
+{
+    hash_set_t* pt_hash_set = create_hash_set(int);
+    int i = 0;
+
+    hash_set_init(pt_hash_set);
+    hash_set_reserve(pt_hash_set, 1000);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_set_bucket_count(pt_hash_set) == 2048);
+#else
+    assert_true(hash_set_bucket_count(pt_hash_set) == 1543);
+#endif
+    for (i = 0; i < 1000; ++i) {
+        hash_set_insert(pt_hash_set, i);
+    }
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_set_bucket_count(pt_hash_set) == 2048);
+#else
+    assert_true(hash_set_bucket_count(pt_hash_set) == 1543);
+#endif
+    assert_true(hash_set_size(pt_hash_set) == 1000);
+
+    hash_set_destroy(pt_hash_set);
+}
+
+/*
+ * test hash_set_shrink_to_fit
+ */
+UT_CASE_DEFINATION(hash_set_shrink_to_fit)
+void test_hash_set_shrink_to_fit__null_hash_set(void** state)
+{
+    expect_assert_failure(hash_set_shrink_to_fit(NULL));
+}
+
+void test_hash_set_shrink_to_fit__shrink(void** state)
+{
+    hash_set_t* pt_hash_set = create_hash_set(int);
+    int i = 0;
+
+    hash_set_init(pt_hash_set);
+    for (i = 0; i < 1000; ++i) {
+        hash_set_insert(pt_hash_set, i);
+    }
+    for (i = 100; i < 1000; ++i) {
+        hash_set_erase(pt_hash_set, i);
+    }
+    hash_set_shrink_to_fit(pt_hash_set);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(hash_set_bucket_count(pt_hash_set) == 128);
+#else
     assert_true(hash_set_bucket_count(pt_hash_set) == 193);
+#endif
+    assert_true(hash_set_size(pt_hash_set) == 100);
+    for (i = 0; i < 100; ++i) {
+        assert_true(hash_set_count(pt_hash_set, i) == 1);
+    }
+
+    hash_set_destroy(pt_hash_set);
+}
+
+/*
+ * test hash_set_find_ptr
+ */
+UT_CASE_DEFINATION(hash_set_find_ptr)
+void test_hash_set_find_ptr__null_hash_set(void** state)
+{
+    int elem = 9;
+
+    expect_assert_failure(hash_set_find_ptr(NULL, &elem));
+}
+
+void test_hash_set_find_ptr__null_value(void** state)
+{
+    hash_set_t* pt_hash_set = create_hash_set(int);
+
+    hash_set_init(pt_hash_set);
+    expect_assert_failure(hash_set_find_ptr(pt_hash_set, NULL));
+
+    hash_set_destroy(pt_hash_set);
+}
+
+void test_hash_set_find_ptr__c_builtin(void** state)
+{
+    hash_set_t* pt_hash_set = create_hash_set(int);
+    hash_set_iterator_t it_iter;
+    int elem;
+    int i;
+
+    hash_set_init(pt_hash_set);
+    for (i = 0; i < 10; ++i) {
+        hash_set_insert(pt_hash_set, i);
+    }
+
+    elem = 2;
+    it_iter = hash_set_find_ptr(pt_hash_set, &elem);
+    assert_true(*(int*)iterator_get_pointer(it_iter) == 2);
+    elem = 42;
+    it_iter = hash_set_find_ptr(pt_hash_set, &elem);
+    assert_true(iterator_equal(it_iter, hash_set_end(pt_hash_set)));
+
+    hash_set_destroy(pt_hash_set);
+}
+
+void test_hash_set_find_ptr__cstr(void** state)
+{
+    hash_set_t* pt_hash_set = create_hash_set(char*);
+    hash_set_iterator_t it_iter;
+
+    hash_set_init(pt_hash_set);
+    hash_set_insert(pt_hash_set, "aaa");
+    hash_set_insert(pt_hash_set, "ggg");
+    hash_set_insert(pt_hash_set, "linux");
+
+    it_iter = hash_set_find_ptr(pt_hash_set, "ggg");
+    assert_true(strcmp((char*)iterator_get_pointer(it_iter), "ggg") == 0);
+    it_iter = hash_set_find_ptr(pt_hash_set, "unix");
+    assert_true(iterator_equal(it_iter, hash_set_end(pt_hash_set)));
+
+    hash_set_destroy(pt_hash_set);
+}
+
+void test_hash_set_find_ptr__libcstl_builtin(void** state)
+{
+    hash_set_t* pt_hash_set = create_hash_set(vector_t<int>);
+    vector_t* pvec_vector = create_vector(int);
+    hash_set_iterator_t it_iter;
+
+    hash_set_init(pt_hash_set);
+    vector_init_n(pvec_vector, 3);
+    hash_set_insert(pt_hash_set, pvec_vector);
+
+    it_iter = hash_set_find_ptr(pt_hash_set, pvec_vector);
+    assert_true(vector_equal((vector_t*)iterator_get_pointer(it_iter), pvec_vector));
+    vector_push_back(pvec_vector, 1);
+    it_iter = hash_set_find_ptr(pt_hash_set, pvec_vector);
+    assert_true(iterator_equal(it_iter, hash_set_end(pt_hash_set)));
+
+    hash_set_destroy(pt_hash_set);
+    vector_destroy(pvec_vector);
+}
+
+/*
+ * test hash_set_insert_ptr
+ */
+UT_CASE_DEFINATION(hash_set_insert_ptr)
+void test_hash_set_insert_ptr__null_hash_set(void** state)
+{
+    int elem = 9;
+
+    expect_assert_failure(hash_set_insert_ptr(NULL, &elem));
+}
+
+void test_hash_set_insert_ptr__null_value(void** state)
+{
+    hash_set_t* pt_hash_set = create_hash_set(int);
+
+    hash_set_init(pt_hash_set);
+    expect_assert_failure(hash_set_insert_ptr(pt_hash_set, NULL));
+
+    hash_set_destroy(pt_hash_set);
+}
+
+void test_hash_set_insert_ptr__c_builtin(void** state)
+{
+    hash_set_t* pt_hash_set = create_hash_set(int);
+    hash_set_iterator_t it_iter;
+    int elem = 7;
+
+    hash_set_init(pt_hash_set);
+    it_iter = hash_set_insert_ptr(pt_hash_set, &elem);
+    assert_true(*(int*)iterator_get_pointer(it_iter) == 7);
+    assert_true(hash_set_size(pt_hash_set) == 1);
+    it_iter = hash_set_insert_ptr(pt_hash_set, &elem);
+    assert_true(iterator_equal(it_iter, hash_set_end(pt_hash_set)));
+    assert_true(hash_set_size(pt_hash_set) == 1);
+
+    hash_set_destroy(pt_hash_set);
+}
+
+void test_hash_set_insert_ptr__cstr(void** state)
+{
+    hash_set_t* pt_hash_set = create_hash_set(char*);
+    hash_set_iterator_t it_iter;
+
+    hash_set_init(pt_hash_set);
+    it_iter = hash_set_insert_ptr(pt_hash_set, "libcstl");
+    assert_true(strcmp((char*)iterator_get_pointer(it_iter), "libcstl") == 0);
+    assert_true(hash_set_count(pt_hash_set, "libcstl") == 1);
+
+    hash_set_destroy(pt_hash_set);
+}
+
+void test_hash_set_insert_ptr__libcstl_builtin(void** state)
+{
+    hash_set_t* pt_hash_set = create_hash_set(list_t<int>);
+    list_t* plist_list = create_list(int);
+    hash_set_iterator_t it_iter;
+
+    hash_set_init(pt_hash_set);
+    list_init_n(plist_list, 5);
+    it_iter = hash_set_insert_ptr(pt_hash_set, plist_list);
+    assert_true(list_equal((list_t*)iterator_get_pointer(it_iter), plist_list));
+    assert_true((list_t*)iterator_get_pointer(it_iter) != plist_list);
+
+    hash_set_destroy(pt_hash_set);
+    list_destroy(plist_list);
+}
+
+/*
+ * test hash_set_count_ptr
+ */
+UT_CASE_DEFINATION(hash_set_count_ptr)
+void test_hash_set_count_ptr__null_hash_set(void** state)
+{
+    int elem = 9;
+
+    expect_assert_failure(hash_set_count_ptr(NULL, &elem));
+}
+
+void test_hash_set_count_ptr__c_builtin(void** state)
+{
+    hash_set_t* pt_hash_set = create_hash_set(int);
+    int elem = 3;
+
+    hash_set_init(pt_hash_set);
+    hash_set_insert(pt_hash_set, 3);
+    hash_set_insert(pt_hash_set, 3);
+    hash_set_insert(pt_hash_set, 5);
+    assert_true(hash_set_count_ptr(pt_hash_set, &elem) == 1);
+    elem = 4;
+    assert_true(hash_set_count_ptr(pt_hash_set, &elem) == 0);
+
+    hash_set_destroy(pt_hash_set);
+}
+
+void test_hash_set_count_ptr__cstr(void** state)
+{
+    hash_set_t* pt_hash_set = create_hash_set(char*);
+
+    hash_set_init(pt_hash_set);
+    hash_set_insert(pt_hash_set, "abc");
+    assert_true(hash_set_count_ptr(pt_hash_set, "abc") == 1);
+    assert_true(hash_set_count_ptr(pt_hash_set, "abcd") == 0);
+
+    hash_set_destroy(pt_hash_set);
+}
+
+/*
+ * test hash_set_find_batch
+ */
+UT_CASE_DEFINATION(hash_set_find_batch)
+void test_hash_set_find_batch__null_hash_set(void** state)
+{
+    int an_elem[1] = {9};
+    hash_set_iterator_t at_iter[1];
+
+    expect_assert_failure(hash_set_find_batch(NULL, an_elem, 1, at_iter));
+}
+
+void test_hash_set_find_batch__null_values(void** state)
+{
+    hash_set_t* pt_hash_set = create_hash_set(int);
+    hash_set_iterator_t at_iter[1];
+
+    hash_set_init(pt_hash_set);
+    expect_assert_failure(hash_set_find_batch(pt_hash_set, NULL, 1, at_iter));
+
+    hash_set_destroy(pt_hash_set);
+}
+
+void test_hash_set_find_batch__null_result(void** state)
+{
+    hash_set_t* pt_hash_set = create_hash_set(int);
+    int an_elem[1] = {9};
+
+    hash_set_init(pt_hash_set);
+    expect_assert_failure(hash_set_find_batch(pt_hash_set, an_elem, 1, NULL));
+
+    hash_set_destroy(pt_hash_set);
+}
+
+void test_hash_set_find_batch__c_builtin(void** state)
+{
+    hash_set_t* pt_hash_set = create_hash_set(int);
+    int an_elem[100];
+    hash_set_iterator_t at_iter[100];
+    int i;
+
+    hash_set_init(pt_hash_set);
+    for (i = 0; i < 100; i += 2) {
+        hash_set_insert(pt_hash_set, i);
+    }
+    for (i = 0; i < 100; ++i) {
+        an_elem[i] = 99 - i;
+    }
+
+    hash_set_find_batch(pt_hash_set, an_elem, 100, at_iter);
+    for (i = 0; i < 100; ++i) {
+        if (an_elem[i] % 2 == 0) {
+            assert_true(*(int*)iterator_get_pointer(at_iter[i]) == an_elem[i]);
+            assert_true(iterator_equal(at_iter[i], hash_set_find(pt_hash_set, an_elem[i])));
+        } else {
+            assert_true(iterator_equal(at_iter[i], hash_set_end(pt_hash_set)));
+        }
+    }
+
+    hash_set_destroy(pt_hash_set);
+}
+
+void test_hash_set_find_batch__cstr(void** state)
+{
+    hash_set_t* pt_hash_set = create_hash_set(char*);
+    const char* as_elem[3] = {"def", "xyz", "abc"};
+    hash_set_iterator_t at_iter[3];
+
+    hash_set_init(pt_hash_set);
+    hash_set_insert(pt_hash_set, "abc");
+    hash_set_insert(pt_hash_set, "def");
+
+    hash_set_find_batch(pt_hash_set, as_elem, 3, at_iter);
+    assert_true(strcmp((char*)iterator_get_pointer(at_iter[0]), "def") == 0);
+    assert_true(iterator_equal(at_iter[1], hash_set_end(pt_hash_set)));
+    assert_true(strcmp((char*)iterator_get_pointer(at_iter[2]), "abc") == 0);
+
+    hash_set_destroy(pt_hash_set);
+}
+
+void test_hash_set_find_batch__libcstl_builtin(void** state)
+{
+    hash_set_t* pt_hash_set = create_hash_set(vector_t<int>);
+    vector_t* pvec_first = create_vector(int);
+    vector_t* pvec_second = create_vector(int);
+    vector_t* apvec_elem[2];
+    hash_set_iterator_t at_iter[2];
+
+    hash_set_init(pt_hash_set);
+    vector_init_n(pvec_first, 3);
+    vector_init_n(pvec_second, 4);
+    hash_set_insert(pt_hash_set, pvec_first);
+    apvec_elem[0] = pvec_second;
+    apvec_elem[1] = pvec_first;
+
+    hash_set_find_batch(pt_hash_set, apvec_elem, 2, at_iter);
+    assert_true(iterator_equal(at_iter[0], hash_set_end(pt_hash_set)));
+    assert_true(vector_equal((vector_t*)iterator_get_pointer(at_iter[1]), pvec_first));
+
+    hash_set_destroy(pt_hash_set);
+    vector_destroy(pvec_first);
+    vector_destroy(pvec_second);
+}
+
+/*
+ * test hash_set_erase_ptr
+ */
+UT_CASE_DEFINATION(hash_set_erase_ptr)
+void test_hash_set_erase_ptr__null_hash_set(void** state)
+{
+    int elem = 9;
+
+    expect_assert_failure(hash_set_erase_ptr(NULL, &elem));
+}
+
+void test_hash_set_erase_ptr__c_builtin(void** state)
+{
+    hash_set_t* pt_hash_set = create_hash_set(int);
+    int elem = 3;
+
+    hash_set_init(pt_hash_set);
+    hash_set_insert(pt_hash_set, 3);
+    hash_set_insert(pt_hash_set, 3);
+    hash_set_insert(pt_hash_set, 5);
+    assert_true(hash_set_erase_ptr(pt_hash_set, &elem) == 1);
+    assert_true(hash_set_size(pt_hash_set) == 1);
+    assert_true(hash_set_erase_ptr(pt_hash_set, &elem) == 0);
+
+    hash_set_destroy(pt_hash_set);
+}
+
+void test_hash_set_erase_ptr__cstr(void** state)
+{
+    hash_set_t* pt_hash_set = create_hash_set(char*);
+
+    hash_set_init(pt_hash_set);
+    hash_set_insert(pt_hash_set, "abc");
+    hash_set_insert(pt_hash_set, "def");
+    assert_true(hash_set_erase_ptr(pt_hash_set, "abc") == 1);
+    assert_true(hash_set_size(pt_hash_set) == 1);
 
     hash_set_destroy(pt_hash_set);
 }
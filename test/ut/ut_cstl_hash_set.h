@@ -140,6 +140,14 @@ void test_hash_set_max_size__null_hash_set(void** state);
 void test_hash_set_max_size__non_inited(void** state);
 void test_hash_set_max_size__empty(void** state);
 void test_hash_set_max_size__non_empty(void** state);
+/*
+ * test hash_set_memory_usage
+ */
+UT_CASE_DECLARATION(hash_set_memory_usage)
+void test_hash_set_memory_usage__null_hash_set(void** state);
+void test_hash_set_memory_usage__non_inited(void** state);
+void test_hash_set_memory_usage__empty(void** state);
+void test_hash_set_memory_usage__non_empty(void** state);
 /*
  * test hash_set_bucket_count
  */
@@ -384,6 +392,80 @@ void test_hash_set_resize__non_inited(void** state);
 void test_hash_set_resize__greater(void** state);
 void test_hash_set_resize__less(void** state);
 
+/*
+ * test hash_set_load_factor
+ */
+UT_CASE_DECLARATION(hash_set_load_factor)
+void test_hash_set_load_factor__null_hash_set(void** state);
+void test_hash_set_load_factor__successfully(void** state);
+/*
+ * test hash_set_max_load_factor
+ */
+UT_CASE_DECLARATION(hash_set_max_load_factor)
+void test_hash_set_max_load_factor__null_hash_set(void** state);
+void test_hash_set_max_load_factor__default(void** state);
+/*
+ * test hash_set_set_max_load_factor
+ */
+UT_CASE_DECLARATION(hash_set_set_max_load_factor)
+void test_hash_set_set_max_load_factor__null_hash_set(void** state);
+void test_hash_set_set_max_load_factor__invalid(void** state);
+void test_hash_set_set_max_load_factor__less(void** state);
+void test_hash_set_set_max_load_factor__init_copy(void** state);
+/*
+ * test hash_set_reserve
+ */
+UT_CASE_DECLARATION(hash_set_reserve)
+void test_hash_set_reserve__null_hash_set(void** state);
+void test_hash_set_reserve__reserve(void** state);
+/*
+ * test hash_set_shrink_to_fit
+ */
+UT_CASE_DECLARATION(hash_set_shrink_to_fit)
+void test_hash_set_shrink_to_fit__null_hash_set(void** state);
+void test_hash_set_shrink_to_fit__shrink(void** state);
+/*
+ * test hash_set_find_ptr
+ */
+UT_CASE_DECLARATION(hash_set_find_ptr)
+void test_hash_set_find_ptr__null_hash_set(void** state);
+void test_hash_set_find_ptr__null_value(void** state);
+void test_hash_set_find_ptr__c_builtin(void** state);
+void test_hash_set_find_ptr__cstr(void** state);
+void test_hash_set_find_ptr__libcstl_builtin(void** state);
+/*
+ * test hash_set_insert_ptr
+ */
+UT_CASE_DECLARATION(hash_set_insert_ptr)
+void test_hash_set_insert_ptr__null_hash_set(void** state);
+void test_hash_set_insert_ptr__null_value(void** state);
+void test_hash_set_insert_ptr__c_builtin(void** state);
+void test_hash_set_insert_ptr__cstr(void** state);
+void test_hash_set_insert_ptr__libcstl_builtin(void** state);
+/*
+ * test hash_set_count_ptr
+ */
+UT_CASE_DECLARATION(hash_set_count_ptr)
+void test_hash_set_count_ptr__null_hash_set(void** state);
+void test_hash_set_count_ptr__c_builtin(void** state);
+void test_hash_set_count_ptr__cstr(void** state);
+/*
+ * test hash_set_find_batch
+ */
+UT_CASE_DECLARATION(hash_set_find_batch)
+void test_hash_set_find_batch__null_hash_set(void** state);
+void test_hash_set_find_batch__null_values(void** state);
+void test_hash_set_find_batch__null_result(void** state);
+void test_hash_set_find_batch__c_builtin(void** state);
+void test_hash_set_find_batch__cstr(void** state);
+void test_hash_set_find_batch__libcstl_builtin(void** state);
+/*
+ * test hash_set_erase_ptr
+ */
+UT_CASE_DECLARATION(hash_set_erase_ptr)
+void test_hash_set_erase_ptr__null_hash_set(void** state);
+void test_hash_set_erase_ptr__c_builtin(void** state);
+void test_hash_set_erase_ptr__cstr(void** state);
 #define UT_CSTL_HASH_SET_CASE\
     UT_SUIT_BEGIN(cstl_hash_set, test_hash_set_init__null_hash_set),\
     UT_CASE(test_hash_set_init__non_created),\
@@ -475,6 +557,10 @@ void test_hash_set_resize__less(void** state);
     UT_CASE(test_hash_set_max_size__non_inited),\
     UT_CASE(test_hash_set_max_size__empty),\
     UT_CASE(test_hash_set_max_size__non_empty),\
+    UT_CASE_BEGIN(hash_set_memory_usage, test_hash_set_memory_usage__null_hash_set),\
+    UT_CASE(test_hash_set_memory_usage__non_inited),\
+    UT_CASE(test_hash_set_memory_usage__empty),\
+    UT_CASE(test_hash_set_memory_usage__non_empty),\
     UT_CASE_BEGIN(hash_set_bucket_count, test_hash_set_bucket_count__null_hash_set),\
     UT_CASE(test_hash_set_bucket_count__non_inited),\
     UT_CASE(test_hash_set_bucket_count__empty),\
@@ -645,7 +731,41 @@ void test_hash_set_resize__less(void** state);
     UT_CASE_BEGIN(hash_set_resize, test_hash_set_resize__null_hash_set),\
     UT_CASE(test_hash_set_resize__non_inited),\
     UT_CASE(test_hash_set_resize__greater),\
-    UT_CASE(test_hash_set_resize__less)
+    UT_CASE(test_hash_set_resize__less),\
+    UT_CASE_BEGIN(hash_set_load_factor, test_hash_set_load_factor__null_hash_set),\
+    UT_CASE(test_hash_set_load_factor__successfully),\
+    UT_CASE_BEGIN(hash_set_max_load_factor, test_hash_set_max_load_factor__null_hash_set),\
+    UT_CASE(test_hash_set_max_load_factor__default),\
+    UT_CASE_BEGIN(hash_set_set_max_load_factor, test_hash_set_set_max_load_factor__null_hash_set),\
+    UT_CASE(test_hash_set_set_max_load_factor__invalid),\
+    UT_CASE(test_hash_set_set_max_load_factor__less),\
+    UT_CASE(test_hash_set_set_max_load_factor__init_copy),\
+    UT_CASE_BEGIN(hash_set_reserve, test_hash_set_reserve__null_hash_set),\
+    UT_CASE(test_hash_set_reserve__reserve),\
+    UT_CASE_BEGIN(hash_set_shrink_to_fit, test_hash_set_shrink_to_fit__null_hash_set),\
+    UT_CASE(test_hash_set_shrink_to_fit__shrink),\
+    UT_CASE_BEGIN(hash_set_find_ptr, test_hash_set_find_ptr__null_hash_set),\
+    UT_CASE(test_hash_set_find_ptr__null_value),\
+    UT_CASE(test_hash_set_find_ptr__c_builtin),\
+    UT_CASE(test_hash_set_find_ptr__cstr),\
+    UT_CASE(test_hash_set_find_ptr__libcstl_builtin),\
+    UT_CASE_BEGIN(hash_set_insert_ptr, test_hash_set_insert_ptr__null_hash_set),\
+    UT_CASE(test_hash_set_insert_ptr__null_value),\
+    UT_CASE(test_hash_set_insert_ptr__c_builtin),\
+    UT_CASE(test_hash_set_insert_ptr__cstr),\
+    UT_CASE(test_hash_set_insert_ptr__libcstl_builtin),\
+    UT_CASE_BEGIN(hash_set_count_ptr, test_hash_set_count_ptr__null_hash_set),\
+    UT_CASE(test_hash_set_count_ptr__c_builtin),\
+    UT_CASE(test_hash_set_count_ptr__cstr),\
+    UT_CASE_BEGIN(hash_set_find_batch, test_hash_set_find_batch__null_hash_set),\
+    UT_CASE(test_hash_set_find_batch__null_values),\
+    UT_CASE(test_hash_set_find_batch__null_result),\
+    UT_CASE(test_hash_set_find_batch__c_builtin),\
+    UT_CASE(test_hash_set_find_batch__cstr),\
+    UT_CASE(test_hash_set_find_batch__libcstl_builtin),\
+    UT_CASE_BEGIN(hash_set_erase_ptr, test_hash_set_erase_ptr__null_hash_set),\
+    UT_CASE(test_hash_set_erase_ptr__c_builtin),\
+    UT_CASE(test_hash_set_erase_ptr__cstr)
 
 #endif /* _UT_CSTL_HASH_SET_H_ */
 
@@ -621,15 +621,17 @@ void test__hash_set_iterator_next__begin(void** state)
     hash_set_t* pt_hash_set = create_hash_set(int);
     hash_set_iterator_t it_iter;
     int elem = 10;
+    int n_first = 0;
     hash_set_init(pt_hash_set);
 
     hash_set_insert(pt_hash_set, elem);
     elem = 3;
     hash_set_insert(pt_hash_set, elem);
     it_iter = hash_set_begin(pt_hash_set);
-    assert_true(*(int*)_hash_set_iterator_get_pointer(it_iter) == 3);
+    n_first = *(int*)_hash_set_iterator_get_pointer(it_iter);
+    assert_true(n_first == 3 || n_first == 10);
     it_iter = _hash_set_iterator_next(it_iter);
-    assert_true(*(int*)_hash_set_iterator_get_pointer(it_iter) == 10);
+    assert_true(*(int*)_hash_set_iterator_get_pointer(it_iter) == 3 + 10 - n_first);
 
     hash_set_destroy(pt_hash_set);
 }
@@ -744,15 +746,17 @@ void test__hash_set_iterator_prev__last(void** state)
     hash_set_t* pt_hash_set = create_hash_set(int);
     hash_set_iterator_t it_iter;
     int elem = 10;
+    int n_first = 0;
     hash_set_init(pt_hash_set);
 
     hash_set_insert(pt_hash_set, elem);
     elem = 3;
     hash_set_insert(pt_hash_set, elem);
     it_iter = _hash_set_iterator_prev(hash_set_end(pt_hash_set));
-    assert_true(*(int*)_hash_set_iterator_get_pointer(it_iter) == 10);
+    n_first = *(int*)_hash_set_iterator_get_pointer(it_iter);
+    assert_true(n_first == 10 || n_first == 3);
     it_iter = _hash_set_iterator_prev(it_iter);
-    assert_true(*(int*)_hash_set_iterator_get_pointer(it_iter) == 3);
+    assert_true(*(int*)_hash_set_iterator_get_pointer(it_iter) == 10 + 3 - n_first);
 
     hash_set_destroy(pt_hash_set);
 }
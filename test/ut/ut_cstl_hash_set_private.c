@@ -72,6 +72,58 @@ void test__create_hash_set__unregister(void** state)
     assert_true(pt_hash_set == NULL);
 }
 
+/*
+ * test _create_hash_set_with_allocator
+ */
+UT_CASE_DEFINATION(_create_hash_set_with_allocator)
+static void* _create_hash_set_with_allocator__allocate(void* pv_context, size_t t_size)
+{
+    ((size_t*)pv_context)[0]++;
+    return malloc(t_size);
+}
+
+static void _create_hash_set_with_allocator__deallocate(void* pv_context, void* pv_mem, size_t t_size)
+{
+    ((size_t*)pv_context)[1]++;
+    free(pv_mem);
+}
+
+void test__create_hash_set_with_allocator__null_allocator(void** state)
+{
+    expect_assert_failure(_create_hash_set_with_allocator(NULL, "int"));
+}
+
+void test__create_hash_set_with_allocator__unregisted_type(void** state)
+{
+    size_t at_count[2] = {0, 0};
+    allocator_t t_allocator = {_create_hash_set_with_allocator__allocate, _create_hash_set_with_allocator__deallocate, NULL};
+
+    t_allocator._pv_context = at_count;
+    assert_true(_create_hash_set_with_allocator(&t_allocator, "unregisted_type_t") == NULL);
+    assert_true(at_count[0] == 0 && at_count[1] == 0);
+}
+
+void test__create_hash_set_with_allocator__allocate_by_allocator(void** state)
+{
+    size_t at_count[2] = {0, 0};
+    allocator_t t_allocator = {_create_hash_set_with_allocator__allocate, _create_hash_set_with_allocator__deallocate, NULL};
+    hash_set_t* phset = NULL;
+    int i = 0;
+
+    t_allocator._pv_context = at_count;
+    phset = _create_hash_set_with_allocator(&t_allocator, "int");
+    assert_true(phset != NULL);
+    hash_set_init(phset);
+    for (i = 0; i < 100; ++i) {
+        hash_set_insert(phset, i);
+    }
+    assert_true(hash_set_size(phset) == 100);
+    assert_true(at_count[0] > 0);
+
+    hash_set_destroy(phset);
+    assert_true(at_count[0] == at_count[1]);
+}
+
 /*
  * test _create_hash_set_auxiliary
  */
@@ -360,6 +412,38 @@ typedef struct _tag_test__hash_set_find__hash_set_find_varg__user_define
 {
     int n_elem;
 }_test__hash_set_find__hash_set_find_varg__user_define_t;
+void test__hash_set_find__hash_set_find_varg__libcstl_builtin_default_hash_find(void** state)
+{
+    hash_set_t* pt_hash_set = _create_hash_set("list_t<int>");
+    hash_set_iterator_t it_iter;
+    list_t* plist = create_list(int);
+    int i = 0;
+
+    hash_set_init(pt_hash_set);
+    list_init(plist);
+
+    for(i = 0; i < 10; i++)
+    {
+        list_clear(plist);
+        list_push_back(plist, i);
+        list_push_back(plist, i * 10);
+        hash_set_insert(pt_hash_set, plist);
+    }
+
+    list_clear(plist);
+    list_push_back(plist, 6);
+    list_push_back(plist, 60);
+    it_iter = _hash_set_find(pt_hash_set, plist);
+    assert_true(*(int*)list_back((list_t*)iterator_get_pointer(it_iter)) == 60);
+
+    list_push_back(plist, 600);
+    it_iter = _hash_set_find(pt_hash_set, plist);
+    assert_true(iterator_equal(it_iter, hash_set_end(pt_hash_set)));
+
+    hash_set_destroy(pt_hash_set);
+    list_destroy(plist);
+}
+
 void test__hash_set_find__hash_set_find_varg__user_define_find(void** state)
 {
     hash_set_t* pt_hash_set = NULL;
@@ -722,7 +806,7 @@ void test__hash_set_equal_range__hash_set_equal_range_varg__c_builtin_equal(void
     elem = 2;
     r_range = _hash_set_equal_range(pt_hash_set, elem);
     assert_true(*(int*)iterator_get_pointer(r_range.it_begin) == 2);
-    assert_true(*(int*)iterator_get_pointer(r_range.it_end) == 3);
+    assert_true(iterator_equal(r_range.it_end, iterator_next(r_range.it_begin)));
 
     hash_set_destroy(pt_hash_set);
 }
@@ -762,7 +846,7 @@ void test__hash_set_equal_range__hash_set_equal_range_varg__cstr_upper_equal(voi
 
     r_range = _hash_set_equal_range(pt_hash_set, "ggg");
     assert_true(strcmp((char*)iterator_get_pointer(r_range.it_begin), "ggg") == 0);
-    assert_true(iterator_equal(r_range.it_end, hash_set_end(pt_hash_set)));
+    assert_true(iterator_equal(r_range.it_end, iterator_next(r_range.it_begin)));
 
     hash_set_destroy(pt_hash_set);
 }
@@ -807,7 +891,11 @@ void test__hash_set_equal_range__hash_set_equal_range_varg__libcstl_builtin_equa
     list_push_back(plist, 6);
     r_range = _hash_set_equal_range(pt_hash_set, plist);
     assert_true(*(int*)list_front((list_t*)iterator_get_pointer(r_range.it_begin)) == 6);
+#ifdef CSTL_HASH_FLAT_TABLE
+    assert_true(iterator_equal(r_range.it_end, iterator_next(r_range.it_begin)));
+#else
     assert_true(*(int*)list_front((list_t*)iterator_get_pointer(r_range.it_end)) == 7);
+#endif
 
     hash_set_destroy(pt_hash_set);
     list_destroy(plist);
@@ -865,7 +953,7 @@ void test__hash_set_equal_range__hash_set_equal_range_varg__user_define_equal(vo
     elem.n_elem = 8;
     r_range = _hash_set_equal_range(pt_hash_set, &elem);
     assert_true(((_test__hash_set_equal_range__hash_set_equal_range_varg__user_define_t*)iterator_get_pointer(r_range.it_begin))->n_elem == 8);
-    assert_true(((_test__hash_set_equal_range__hash_set_equal_range_varg__user_define_t*)iterator_get_pointer(r_range.it_end))->n_elem == 9);
+    assert_true(iterator_equal(r_range.it_end, iterator_next(r_range.it_begin)));
 
     hash_set_destroy(pt_hash_set);
 }
@@ -12,6 +12,13 @@ void test__create_hash_set__cstr(void** state);
 void test__create_hash_set__libcstl_builtin(void** state);
 void test__create_hash_set__user_define(void** state);
 void test__create_hash_set__unregister(void** state);
+/*
+ * test _create_hash_set_with_allocator
+ */
+UT_CASE_DECLARATION(_create_hash_set_with_allocator)
+void test__create_hash_set_with_allocator__null_allocator(void** state);
+void test__create_hash_set_with_allocator__unregisted_type(void** state);
+void test__create_hash_set_with_allocator__allocate_by_allocator(void** state);
 /*
  * test _create_hash_set_auxiliary
  */
@@ -44,6 +51,7 @@ void test__hash_set_find__hash_set_find_varg__cstr_find(void** state);
 void test__hash_set_find__hash_set_find_varg__cstr_not_find(void** state);
 void test__hash_set_find__hash_set_find_varg__libcstl_builtin_find(void** state);
 void test__hash_set_find__hash_set_find_varg__libcstl_builtin_not_find(void** state);
+void test__hash_set_find__hash_set_find_varg__libcstl_builtin_default_hash_find(void** state);
 void test__hash_set_find__hash_set_find_varg__user_define_find(void** state);
 void test__hash_set_find__hash_set_find_varg__user_define_not_find(void** state);
 /*
@@ -129,6 +137,9 @@ void test__hash_set_init_elem_auxiliary__successfully_user_defined(void** state)
     UT_CASE(test__create_hash_set__libcstl_builtin),\
     UT_CASE(test__create_hash_set__user_define),\
     UT_CASE(test__create_hash_set__unregister),\
+    UT_CASE_BEGIN(_create_hash_set_with_allocator, test__create_hash_set_with_allocator__null_allocator),\
+    UT_CASE(test__create_hash_set_with_allocator__unregisted_type),\
+    UT_CASE(test__create_hash_set_with_allocator__allocate_by_allocator),\
     UT_CASE_BEGIN(_create_hash_set_auxiliary, test__create_hash_set_auxiliary__null_hash_set),\
     UT_CASE(test__create_hash_set_auxiliary__null_typename),\
     UT_CASE(test__create_hash_set_auxiliary__unregistered),\
@@ -148,6 +159,7 @@ void test__hash_set_init_elem_auxiliary__successfully_user_defined(void** state)
     UT_CASE(test__hash_set_find__hash_set_find_varg__cstr_not_find),\
     UT_CASE(test__hash_set_find__hash_set_find_varg__libcstl_builtin_find),\
     UT_CASE(test__hash_set_find__hash_set_find_varg__libcstl_builtin_not_find),\
+    UT_CASE(test__hash_set_find__hash_set_find_varg__libcstl_builtin_default_hash_find),\
     UT_CASE(test__hash_set_find__hash_set_find_varg__user_define_find),\
     UT_CASE(test__hash_set_find__hash_set_find_varg__user_define_not_find),\
     UT_CASE_BEGIN(_hash_set_count__hash_set_count_varg, test__hash_set_count__hash_set_count_varg__null_hash_set),\
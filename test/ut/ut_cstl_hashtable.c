@@ -1358,6 +1358,47 @@ void test__hashtable_max_size__non_empty(void** state)
     _hashtable_destroy(pt_hashtable);
 }
 
+/*
+ * test _hashtable_memory_usage
+ */
+UT_CASE_DEFINATION(_hashtable_memory_usage)
+void test__hashtable_memory_usage__null_hashtable(void** state)
+{
+    expect_assert_failure(_hashtable_memory_usage(NULL));
+}
+
+void test__hashtable_memory_usage__non_inited(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+
+    expect_assert_failure(_hashtable_memory_usage(pt_hashtable));
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_memory_usage__empty(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+
+    assert_true(_hashtable_memory_usage(pt_hashtable) > 0);
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_memory_usage__non_empty(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    int elem = 9;
+
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+    _hashtable_insert_unique(pt_hashtable, &elem);
+
+    assert_true(_hashtable_memory_usage(pt_hashtable) >= sizeof(int));
+
+    _hashtable_destroy(pt_hashtable);
+}
+
 /*
  * test _hashtable_bucket_count
  */
@@ -1456,6 +1497,34 @@ void test__hashtable_begin__non_empty(void** state)
     _hashtable_destroy(pt_hashtable);
 }
 
+void test__hashtable_begin__sparse(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    _hashtable_iterator_t it_iter;
+    int n_count = 0;
+    int i;
+
+    _hashtable_init(pt_hashtable, 3000, NULL, NULL);
+    for (i = 0; i < 100; ++i) {
+        _hashtable_insert_unique(pt_hashtable, &i);
+    }
+    for (i = 0; i < 95; ++i) {
+        _hashtable_erase(pt_hashtable, &i);
+    }
+
+    /* the first non-empty bucket is recorded, so begin does not scan the empty buckets */
+    it_iter = _hashtable_begin(pt_hashtable);
+    assert_true(_HASHTABLE_ITERATOR_BUCKETPOS(it_iter) ==
+        (_byte_t*)vector_at(&pt_hashtable->_vec_bucket, pt_hashtable->_t_firstbucket));
+    assert_true(*(int*)_hashtable_iterator_get_pointer(it_iter) >= 95);
+    for (; !_hashtable_iterator_equal(it_iter, _hashtable_end(pt_hashtable)); it_iter = _hashtable_iterator_next(it_iter)) {
+        n_count++;
+    }
+    assert_true(n_count == 5);
+
+    _hashtable_destroy(pt_hashtable);
+}
+
 /*
  * test _hashtable_end
  */
@@ -1822,6 +1891,151 @@ void test__hashtable_find__user_define_not_find(void** state)
     _hashtable_destroy(pt_hashtable);
 }
 
+/*
+ * test _hashtable_find_batch
+ */
+UT_CASE_DEFINATION(_hashtable_find_batch)
+void test__hashtable_find_batch__null_hashtable(void** state)
+{
+    const void* acpv_value[1];
+    _hashtable_iterator_t at_iter[1];
+    int elem = 9;
+
+    acpv_value[0] = &elem;
+    expect_assert_failure(_hashtable_find_batch(NULL, acpv_value, 1, at_iter));
+}
+
+void test__hashtable_find_batch__null_values(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    _hashtable_iterator_t at_iter[1];
+
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+    expect_assert_failure(_hashtable_find_batch(pt_hashtable, NULL, 1, at_iter));
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_find_batch__null_result(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    const void* acpv_value[1];
+    int elem = 9;
+
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+    acpv_value[0] = &elem;
+    expect_assert_failure(_hashtable_find_batch(pt_hashtable, acpv_value, 1, NULL));
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_find_batch__non_inited(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    const void* acpv_value[1];
+    _hashtable_iterator_t at_iter[1];
+    int elem = 9;
+
+    acpv_value[0] = &elem;
+    expect_assert_failure(_hashtable_find_batch(pt_hashtable, acpv_value, 1, at_iter));
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_find_batch__empty_batch(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    const void* acpv_value[1];
+    _hashtable_iterator_t at_iter[1];
+    int elem = 9;
+
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+    _hashtable_insert_unique(pt_hashtable, &elem);
+    acpv_value[0] = &elem;
+    at_iter[0] = _hashtable_end(pt_hashtable);
+    _hashtable_find_batch(pt_hashtable, acpv_value, 0, at_iter);
+    assert_true(_hashtable_iterator_equal(at_iter[0], _hashtable_end(pt_hashtable)));
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_find_batch__c_builtin(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    const void* acpv_value[40];
+    _hashtable_iterator_t at_iter[40];
+    int an_elem[40];
+    int i;
+
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+    for (i = 0; i < 40; i += 2) {
+        _hashtable_insert_unique(pt_hashtable, &i);
+    }
+    for (i = 0; i < 40; ++i) {
+        an_elem[i] = i;
+        acpv_value[i] = &an_elem[i];
+    }
+    _hashtable_find_batch(pt_hashtable, acpv_value, 40, at_iter);
+    for (i = 0; i < 40; ++i) {
+        if (i % 2 == 0) {
+            assert_true(*(int*)_hashtable_iterator_get_pointer(at_iter[i]) == i);
+        } else {
+            assert_true(_hashtable_iterator_equal(at_iter[i], _hashtable_end(pt_hashtable)));
+        }
+    }
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_find_batch__cstr(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("char*");
+    string_t* pstr_abc = create_string();
+    string_t* pstr_xyz = create_string();
+    const void* acpv_value[2];
+    _hashtable_iterator_t at_iter[2];
+
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+    string_init_cstr(pstr_abc, "abc");
+    string_init_cstr(pstr_xyz, "xyz");
+    _hashtable_insert_unique(pt_hashtable, pstr_abc);
+    acpv_value[0] = pstr_xyz;
+    acpv_value[1] = pstr_abc;
+    _hashtable_find_batch(pt_hashtable, acpv_value, 2, at_iter);
+    assert_true(_hashtable_iterator_equal(at_iter[0], _hashtable_end(pt_hashtable)));
+    assert_true(strcmp((char*)_hashtable_iterator_get_pointer(at_iter[1]), "abc") == 0);
+
+    _hashtable_destroy(pt_hashtable);
+    string_destroy(pstr_abc);
+    string_destroy(pstr_xyz);
+}
+
+void test__hashtable_find_batch__incremental_rehash(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    const void* acpv_value[1601];
+    _hashtable_iterator_t at_iter[1601];
+    int an_elem[1601];
+    int i;
+
+    _hashtable_init(pt_hashtable, 1543, NULL, NULL);
+    for (i = 0; i < 1600; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    assert_true(pt_hashtable->_ppt_oldbucket != NULL);
+    for (i = 0; i < 1601; ++i) {
+        an_elem[i] = i;
+        acpv_value[i] = &an_elem[i];
+    }
+    _hashtable_find_batch(pt_hashtable, acpv_value, 1601, at_iter);
+    for (i = 0; i < 1601; ++i) {
+        assert_true(_hashtable_iterator_equal(at_iter[i], _hashtable_find(pt_hashtable, &an_elem[i])));
+    }
+    assert_true(_hashtable_iterator_equal(at_iter[1600], _hashtable_end(pt_hashtable)));
+
+    _hashtable_destroy(pt_hashtable);
+}
+
 /*
  * test _hashtable_clear
  */
@@ -1869,6 +2083,26 @@ void test__hashtable_clear__non_empty(void** state)
     _hashtable_destroy(pt_hashtable);
 }
 
+void test__hashtable_clear__sparse(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    int i;
+
+    _hashtable_init(pt_hashtable, 100000, NULL, NULL);
+    for (i = 0; i < 10; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    _hashtable_clear(pt_hashtable);
+    assert_true(_hashtable_empty(pt_hashtable));
+    assert_true(pt_hashtable->_t_firstbucket == _hashtable_bucket_count(pt_hashtable));
+    assert_true(_hashtable_iterator_equal(_hashtable_begin(pt_hashtable), _hashtable_end(pt_hashtable)));
+    for (i = 0; i < (int)_HASHTABLE_BUCKETMAP_WORDS(_hashtable_bucket_count(pt_hashtable)); ++i) {
+        assert_true(pt_hashtable->_pt_bucketmap[i] == 0);
+    }
+
+    _hashtable_destroy(pt_hashtable);
+}
+
 /*
  * test _hashtable_count
  */
@@ -2421,7 +2655,7 @@ void test__hashtable_equal_range__user_define_equal(void** state)
     elem.n_elem = 8;
     r_range = _hashtable_equal_range(pt_hashtable, &elem);
     assert_true(((_test__hashtable_equal_range__user_define_t*)_hashtable_iterator_get_pointer(r_range.it_begin))->n_elem == 8);
-    assert_true(((_test__hashtable_equal_range__user_define_t*)_hashtable_iterator_get_pointer(r_range.it_end))->n_elem == 9);
+    assert_true(_hashtable_iterator_equal(r_range.it_end, _hashtable_iterator_next(r_range.it_begin)));
 
     _hashtable_destroy(pt_hashtable);
 }
@@ -5286,6 +5520,7 @@ void test__hashtable_erase_pos__begin(void** state)
     _hashtable_t* pt_hashtable = _create_hashtable("int");
     _hashtable_iterator_t it_pos;
     int i = 0;
+    int n_expect = 0;
 
     _hashtable_init(pt_hashtable, 0, NULL, NULL);
     for(i = 0; i < 10; ++i)
@@ -5293,11 +5528,11 @@ void test__hashtable_erase_pos__begin(void** state)
         _hashtable_insert_unique(pt_hashtable, &i);
     }
     it_pos = _hashtable_begin(pt_hashtable);
-    assert_true(*(int*)_hashtable_iterator_get_pointer(it_pos) == 0);
+    n_expect = *(int*)_hashtable_iterator_get_pointer(_hashtable_iterator_next(it_pos));
     _hashtable_erase_pos(pt_hashtable, it_pos);
     assert_true(_hashtable_size(pt_hashtable) == 9);
     it_pos = _hashtable_begin(pt_hashtable);
-    assert_true(*(int*)_hashtable_iterator_get_pointer(it_pos) == 1);
+    assert_true(*(int*)_hashtable_iterator_get_pointer(it_pos) == n_expect);
 
     _hashtable_destroy(pt_hashtable);
 }
@@ -5329,6 +5564,7 @@ void test__hashtable_erase_pos__last(void** state)
     _hashtable_t* pt_hashtable = _create_hashtable("int");
     _hashtable_iterator_t it_pos;
     int i = 0;
+    int n_expect = 0;
 
     _hashtable_init(pt_hashtable, 0, NULL, NULL);
     for(i = 0; i < 10; ++i)
@@ -5336,11 +5572,11 @@ void test__hashtable_erase_pos__last(void** state)
         _hashtable_insert_unique(pt_hashtable, &i);
     }
     it_pos = _hashtable_iterator_prev(_hashtable_end(pt_hashtable));
-    assert_true(*(int*)_hashtable_iterator_get_pointer(it_pos) == 9);
+    n_expect = *(int*)_hashtable_iterator_get_pointer(_hashtable_iterator_prev(it_pos));
     _hashtable_erase_pos(pt_hashtable, it_pos);
     assert_true(_hashtable_size(pt_hashtable) == 9);
     it_pos = _hashtable_iterator_prev(_hashtable_end(pt_hashtable));
-    assert_true(*(int*)_hashtable_iterator_get_pointer(it_pos) == 8);
+    assert_true(*(int*)_hashtable_iterator_get_pointer(it_pos) == n_expect);
 
     _hashtable_destroy(pt_hashtable);
 }
@@ -5463,6 +5699,7 @@ void test__hashtable_erase_range__begin(void** state)
     _hashtable_iterator_t it_begin;
     _hashtable_iterator_t it_end;
     int i = 0;
+    int n_expect = 0;
 
     _hashtable_init(pt_dest, 0, NULL, NULL);
     for(i = 0; i < 10; ++i)
@@ -5472,9 +5709,10 @@ void test__hashtable_erase_range__begin(void** state)
 
     it_begin = _hashtable_begin(pt_dest);
     it_end = _hashtable_iterator_next(it_begin);
+    n_expect = *(int*)_hashtable_iterator_get_pointer(_hashtable_iterator_next(it_begin));
     _hashtable_erase_range(pt_dest, it_begin, it_end);
     assert_true(_hashtable_size(pt_dest) == 9);
-    assert_true(*(int*)_hashtable_iterator_get_pointer(_hashtable_begin(pt_dest)) == 1);
+    assert_true(*(int*)_hashtable_iterator_get_pointer(_hashtable_begin(pt_dest)) == n_expect);
 
     _hashtable_destroy(pt_dest);
 }
@@ -5485,6 +5723,8 @@ void test__hashtable_erase_range__middle(void** state)
     _hashtable_iterator_t it_begin;
     _hashtable_iterator_t it_end;
     int i = 0;
+    int n_first = 0;
+    int n_second = 0;
 
     _hashtable_init(pt_dest, 0, NULL, NULL);
     for(i = 0; i < 10; ++i)
@@ -5494,11 +5734,13 @@ void test__hashtable_erase_range__middle(void** state)
 
     it_begin = _hashtable_iterator_next(_hashtable_begin(pt_dest));
     it_end = _hashtable_iterator_next(it_begin);
+    n_first = *(int*)_hashtable_iterator_get_pointer(_hashtable_iterator_prev(it_begin));
+    n_second = *(int*)_hashtable_iterator_get_pointer(it_end);
     _hashtable_erase_range(pt_dest, it_begin, it_end);
     assert_true(_hashtable_size(pt_dest) == 9);
     it_begin = _hashtable_begin(pt_dest);
-    assert_true(*(int*)_hashtable_iterator_get_pointer(it_begin) == 0);
-    assert_true(*(int*)_hashtable_iterator_get_pointer(_hashtable_iterator_next(it_begin)) == 2);
+    assert_true(*(int*)_hashtable_iterator_get_pointer(it_begin) == n_first);
+    assert_true(*(int*)_hashtable_iterator_get_pointer(_hashtable_iterator_next(it_begin)) == n_second);
 
     _hashtable_destroy(pt_dest);
 }
@@ -5509,6 +5751,7 @@ void test__hashtable_erase_range__end(void** state)
     _hashtable_iterator_t it_begin;
     _hashtable_iterator_t it_end;
     int i = 0;
+    int n_expect = 0;
 
     _hashtable_init(pt_dest, 0, NULL, NULL);
     for(i = 0; i < 10; ++i)
@@ -5518,10 +5761,11 @@ void test__hashtable_erase_range__end(void** state)
 
     it_end = _hashtable_end(pt_dest);
     it_begin = _hashtable_iterator_prev(it_end);
+    n_expect = *(int*)_hashtable_iterator_get_pointer(_hashtable_iterator_prev(it_begin));
     _hashtable_erase_range(pt_dest, it_begin, it_end);
     assert_true(_hashtable_size(pt_dest) == 9);
     it_end = _hashtable_end(pt_dest);
-    assert_true(*(int*)_hashtable_iterator_get_pointer(_hashtable_iterator_prev(it_end)) == 8);
+    assert_true(*(int*)_hashtable_iterator_get_pointer(_hashtable_iterator_prev(it_end)) == n_expect);
 
     _hashtable_destroy(pt_dest);
 }
@@ -5873,6 +6117,32 @@ void test__hashtable_erase__user_define_n(void** state)
     _hashtable_destroy(pt_hashtable);
 }
 
+void test__hashtable_erase__shrink(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    int i;
+
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+    for (i = 0; i < 1000; ++i) {
+        _hashtable_insert_unique(pt_hashtable, &i);
+    }
+    assert_true(_hashtable_bucket_count(pt_hashtable) == 1543);
+    for (i = 0; i < 990; ++i) {
+        assert_true(_hashtable_erase(pt_hashtable, &i) == 1);
+    }
+#ifdef CSTL_HASHTABLE_AUTO_SHRINK
+    assert_true(_hashtable_bucket_count(pt_hashtable) == 53);
+#else
+    assert_true(_hashtable_bucket_count(pt_hashtable) == 1543);
+#endif
+    assert_true(_hashtable_size(pt_hashtable) == 10);
+    for (i = 990; i < 1000; ++i) {
+        assert_true(_hashtable_count(pt_hashtable, &i) == 1);
+    }
+
+    _hashtable_destroy(pt_hashtable);
+}
+
 /*
  * test _hashtable_resize
  */
@@ -5951,3 +6221,683 @@ void test__hashtable_resize__greater_bucketcount(void** state)
     _hashtable_destroy(pt_hashtable);
 }
 
+/*
+ * test _hashtable_load_factor
+ */
+UT_CASE_DEFINATION(_hashtable_load_factor)
+void test__hashtable_load_factor__null_hashtable(void** state)
+{
+    expect_assert_failure(_hashtable_load_factor(NULL));
+}
+
+void test__hashtable_load_factor__non_inited(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+
+    expect_assert_failure(_hashtable_load_factor(pt_hashtable));
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_load_factor__empty(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+    assert_true(_hashtable_load_factor(pt_hashtable) == 0.0f);
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_load_factor__non_empty(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    int i;
+
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+    for (i = 0; i < 53; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    assert_true(_hashtable_bucket_count(pt_hashtable) == 53);
+    assert_true(_hashtable_load_factor(pt_hashtable) == 1.0f);
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+/*
+ * test _hashtable_max_load_factor
+ */
+UT_CASE_DEFINATION(_hashtable_max_load_factor)
+void test__hashtable_max_load_factor__null_hashtable(void** state)
+{
+    expect_assert_failure(_hashtable_max_load_factor(NULL));
+}
+
+void test__hashtable_max_load_factor__non_inited(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+
+    expect_assert_failure(_hashtable_max_load_factor(pt_hashtable));
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_max_load_factor__default(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+    assert_true(_hashtable_max_load_factor(pt_hashtable) == 1.0f);
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_max_load_factor__init_copy(void** state)
+{
+    _hashtable_t* pt_dest = _create_hashtable("int");
+    _hashtable_t* pt_src = _create_hashtable("int");
+
+    _hashtable_init(pt_src, 0, NULL, NULL);
+    _hashtable_set_max_load_factor(pt_src, 0.5f);
+    _hashtable_init_copy(pt_dest, pt_src);
+    assert_true(_hashtable_max_load_factor(pt_dest) == 0.5f);
+
+    _hashtable_destroy(pt_dest);
+    _hashtable_destroy(pt_src);
+}
+
+/*
+ * test _hashtable_set_max_load_factor
+ */
+UT_CASE_DEFINATION(_hashtable_set_max_load_factor)
+void test__hashtable_set_max_load_factor__null_hashtable(void** state)
+{
+    expect_assert_failure(_hashtable_set_max_load_factor(NULL, 1.0f));
+}
+
+void test__hashtable_set_max_load_factor__non_inited(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+
+    expect_assert_failure(_hashtable_set_max_load_factor(pt_hashtable, 1.0f));
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_set_max_load_factor__invalid(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+    expect_assert_failure(_hashtable_set_max_load_factor(pt_hashtable, 0.0f));
+    expect_assert_failure(_hashtable_set_max_load_factor(pt_hashtable, -1.0f));
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_set_max_load_factor__less(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    int i;
+
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+    for (i = 0; i < 50; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    assert_true(_hashtable_bucket_count(pt_hashtable) == 53);
+    _hashtable_set_max_load_factor(pt_hashtable, 0.5f);
+    assert_true(_hashtable_max_load_factor(pt_hashtable) == 0.5f);
+    assert_true(_hashtable_bucket_count(pt_hashtable) == 193);
+    assert_true(_hashtable_size(pt_hashtable) == 50);
+    for (i = 0; i < 50; ++i) {
+        assert_true(*(int*)_hashtable_iterator_get_pointer(_hashtable_find(pt_hashtable, &i)) == i);
+    }
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_set_max_load_factor__greater(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    int i;
+
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+    _hashtable_set_max_load_factor(pt_hashtable, 2.0f);
+    for (i = 0; i < 106; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    assert_true(_hashtable_bucket_count(pt_hashtable) == 53);
+    assert_true(_hashtable_load_factor(pt_hashtable) == 2.0f);
+    _hashtable_insert_equal(pt_hashtable, &i);
+    assert_true(_hashtable_bucket_count(pt_hashtable) == 97);
+    assert_true(_hashtable_size(pt_hashtable) == 107);
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_set_max_load_factor__incremental_rehash(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    int i;
+
+    _hashtable_init(pt_hashtable, 1543, NULL, NULL);
+    _hashtable_set_max_load_factor(pt_hashtable, 0.5f);
+    for (i = 0; i < 771; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    assert_true(_hashtable_bucket_count(pt_hashtable) == 1543);
+    assert_true(pt_hashtable->_ppt_oldbucket == NULL);
+    _hashtable_insert_equal(pt_hashtable, &i);
+    assert_true(_hashtable_bucket_count(pt_hashtable) == 3079);
+    assert_true(pt_hashtable->_ppt_oldbucket != NULL);
+    for (i = 0; i < 772; ++i) {
+        assert_true(*(int*)_hashtable_iterator_get_pointer(_hashtable_find(pt_hashtable, &i)) == i);
+    }
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+/*
+ * test _hashtable_reserve
+ */
+UT_CASE_DEFINATION(_hashtable_reserve)
+void test__hashtable_reserve__null_hashtable(void** state)
+{
+    expect_assert_failure(_hashtable_reserve(NULL, 100));
+}
+
+void test__hashtable_reserve__non_inited(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+
+    expect_assert_failure(_hashtable_reserve(pt_hashtable, 100));
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_reserve__less(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+    _hashtable_reserve(pt_hashtable, 10);
+    assert_true(_hashtable_bucket_count(pt_hashtable) == 53);
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_reserve__greater(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    int i;
+
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+    _hashtable_reserve(pt_hashtable, 1000);
+    assert_true(_hashtable_bucket_count(pt_hashtable) == 1543);
+    for (i = 0; i < 1000; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    assert_true(_hashtable_bucket_count(pt_hashtable) == 1543);
+    assert_true(_hashtable_size(pt_hashtable) == 1000);
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_reserve__max_load_factor(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+    _hashtable_set_max_load_factor(pt_hashtable, 0.5f);
+    _hashtable_reserve(pt_hashtable, 100);
+    assert_true(_hashtable_bucket_count(pt_hashtable) == 389);
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+/*
+ * test _hashtable_shrink_to_fit
+ */
+UT_CASE_DEFINATION(_hashtable_shrink_to_fit)
+void test__hashtable_shrink_to_fit__null_hashtable(void** state)
+{
+    expect_assert_failure(_hashtable_shrink_to_fit(NULL));
+}
+
+void test__hashtable_shrink_to_fit__non_inited(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+
+    expect_assert_failure(_hashtable_shrink_to_fit(pt_hashtable));
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_shrink_to_fit__empty(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    size_t t_usage = 0;
+
+    _hashtable_init(pt_hashtable, 1000, NULL, NULL);
+    assert_true(_hashtable_bucket_count(pt_hashtable) == 1543);
+    t_usage = _hashtable_memory_usage(pt_hashtable);
+    _hashtable_shrink_to_fit(pt_hashtable);
+    assert_true(_hashtable_bucket_count(pt_hashtable) == 53);
+    assert_true(vector_capacity(&pt_hashtable->_vec_bucket) == 53);
+    assert_true(_hashtable_memory_usage(pt_hashtable) < t_usage);
+    assert_true(_hashtable_empty(pt_hashtable));
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_shrink_to_fit__not_change(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    int i;
+
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+    for (i = 0; i < 50; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    _hashtable_shrink_to_fit(pt_hashtable);
+    assert_true(_hashtable_bucket_count(pt_hashtable) == 53);
+    assert_true(_hashtable_size(pt_hashtable) == 50);
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_shrink_to_fit__shrink(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    int i;
+
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+    for (i = 0; i < 1000; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    for (i = 100; i < 1000; ++i) {
+        _hashtable_erase(pt_hashtable, &i);
+    }
+    assert_true(_hashtable_size(pt_hashtable) == 100);
+    _hashtable_shrink_to_fit(pt_hashtable);
+    assert_true(_hashtable_bucket_count(pt_hashtable) == 193);
+    assert_true(vector_capacity(&pt_hashtable->_vec_bucket) == 193);
+    for (i = 0; i < 100; ++i) {
+        assert_true(*(int*)_hashtable_iterator_get_pointer(_hashtable_find(pt_hashtable, &i)) == i);
+    }
+    assert_true(_hashtable_iterator_distance(_hashtable_begin(pt_hashtable), _hashtable_end(pt_hashtable)) == 100);
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_shrink_to_fit__incremental_rehash(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    int i;
+
+    _hashtable_init(pt_hashtable, 1543, NULL, NULL);
+    for (i = 0; i < 1544; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    assert_true(pt_hashtable->_ppt_oldbucket != NULL);
+    _hashtable_shrink_to_fit(pt_hashtable);
+    assert_true(pt_hashtable->_ppt_oldbucket == NULL);
+    assert_true(_hashtable_bucket_count(pt_hashtable) == 3079);
+    assert_true(_hashtable_size(pt_hashtable) == 1544);
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+/*
+ * test _hashtable_incremental_rehash
+ */
+UT_CASE_DEFINATION(_hashtable_incremental_rehash)
+void test__hashtable_incremental_rehash__small(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    int i;
+
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+    for (i = 0; i < 1000; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    assert_true(_hashtable_bucket_count(pt_hashtable) == 1543);
+    assert_true(pt_hashtable->_ppt_oldbucket == NULL);
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_incremental_rehash__start(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    _hashtable_iterator_t it_iter;
+    int i;
+
+    _hashtable_init(pt_hashtable, 1543, NULL, NULL);
+    for (i = 0; i < 1600; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    assert_true(_hashtable_bucket_count(pt_hashtable) == 3079);
+    assert_true(_hashtable_size(pt_hashtable) == 1600);
+    assert_true(pt_hashtable->_ppt_oldbucket != NULL);
+    assert_true(pt_hashtable->_t_oldbucketcount == 1543);
+    assert_true(pt_hashtable->_t_rehashpos > 0 && pt_hashtable->_t_rehashpos < 1543);
+    for (i = 0; i < 1600; ++i) {
+        it_iter = _hashtable_find(pt_hashtable, &i);
+        assert_false(_hashtable_iterator_equal(it_iter, _hashtable_end(pt_hashtable)));
+        assert_true(*(int*)_hashtable_iterator_get_pointer(it_iter) == i);
+    }
+    i = 1600;
+    assert_true(_hashtable_iterator_equal(_hashtable_find(pt_hashtable, &i), _hashtable_end(pt_hashtable)));
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_incremental_rehash__finish(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    int i;
+
+    _hashtable_init(pt_hashtable, 1543, NULL, NULL);
+    for (i = 0; i < 3000; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    assert_true(_hashtable_bucket_count(pt_hashtable) == 3079);
+    assert_true(_hashtable_size(pt_hashtable) == 3000);
+    assert_true(pt_hashtable->_ppt_oldbucket == NULL);
+    assert_true(pt_hashtable->_t_oldbucketcount == 0);
+    assert_true(pt_hashtable->_t_rehashpos == 0);
+    for (i = 0; i < 3000; ++i) {
+        assert_true(_hashtable_count(pt_hashtable, &i) == 1);
+    }
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_incremental_rehash__iterator(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    _hashtable_iterator_t it_iter;
+    int i;
+    int n_sum = 0;
+    int n_count = 0;
+
+    _hashtable_init(pt_hashtable, 1543, NULL, NULL);
+    for (i = 0; i < 1600; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    assert_true(pt_hashtable->_ppt_oldbucket != NULL);
+    assert_true(_hashtable_iterator_distance(_hashtable_begin(pt_hashtable), _hashtable_end(pt_hashtable)) == 1600);
+    for (it_iter = _hashtable_begin(pt_hashtable);
+         !_hashtable_iterator_equal(it_iter, _hashtable_end(pt_hashtable));
+         it_iter = _hashtable_iterator_next(it_iter)) {
+        n_sum += *(int*)_hashtable_iterator_get_pointer(it_iter);
+    }
+    assert_true(n_sum == 1599 * 1600 / 2);
+    for (it_iter = _hashtable_end(pt_hashtable);
+         !_hashtable_iterator_equal(it_iter, _hashtable_begin(pt_hashtable));
+         it_iter = _hashtable_iterator_prev(it_iter)) {
+        n_count++;
+    }
+    assert_true(n_count == 1600);
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_incremental_rehash__equal_range(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    range_t r_range;
+    int i;
+
+    _hashtable_init(pt_hashtable, 1543, NULL, NULL);
+    for (i = 0; i < 800; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    assert_true(pt_hashtable->_ppt_oldbucket != NULL);
+    for (i = 0; i < 800; ++i) {
+        r_range = _hashtable_equal_range(pt_hashtable, &i);
+        assert_true(_hashtable_iterator_distance(r_range.it_begin, r_range.it_end) == 2);
+        assert_true(*(int*)_hashtable_iterator_get_pointer(r_range.it_begin) == i);
+        assert_true(*(int*)_hashtable_iterator_get_pointer(_hashtable_iterator_next(r_range.it_begin)) == i);
+    }
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_incremental_rehash__erase(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    int i;
+
+    _hashtable_init(pt_hashtable, 1543, NULL, NULL);
+    for (i = 0; i < 1600; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    assert_true(pt_hashtable->_ppt_oldbucket != NULL);
+    for (i = 0; i < 1600; i += 2) {
+        assert_true(_hashtable_erase(pt_hashtable, &i) == 1);
+    }
+    assert_true(_hashtable_size(pt_hashtable) == 800);
+    assert_true(_hashtable_iterator_distance(_hashtable_begin(pt_hashtable), _hashtable_end(pt_hashtable)) == 800);
+    for (i = 0; i < 1600; ++i) {
+        assert_true(_hashtable_count(pt_hashtable, &i) == (size_t)(i % 2));
+    }
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_incremental_rehash__resize(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    int i;
+
+    _hashtable_init(pt_hashtable, 1543, NULL, NULL);
+    for (i = 0; i < 1600; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    assert_true(pt_hashtable->_ppt_oldbucket != NULL);
+    _hashtable_resize(pt_hashtable, 0);
+    assert_true(pt_hashtable->_ppt_oldbucket == NULL);
+    assert_true(_hashtable_bucket_count(pt_hashtable) == 3079);
+    assert_true(_hashtable_size(pt_hashtable) == 1600);
+    for (i = 0; i < 1600; ++i) {
+        assert_true(_hashtable_count(pt_hashtable, &i) == 1);
+    }
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_incremental_rehash__equal(void** state)
+{
+    _hashtable_t* pt_first = _create_hashtable("int");
+    _hashtable_t* pt_second = _create_hashtable("int");
+    int i;
+
+    _hashtable_init(pt_first, 1543, NULL, NULL);
+    for (i = 0; i < 1600; ++i) {
+        _hashtable_insert_equal(pt_first, &i);
+    }
+    assert_true(pt_first->_ppt_oldbucket != NULL);
+    _hashtable_init_copy(pt_second, pt_first);
+    assert_true(pt_second->_ppt_oldbucket == NULL);
+    assert_true(_hashtable_equal(pt_first, pt_second));
+    i = 0;
+    _hashtable_erase(pt_second, &i);
+    i = 1600;
+    _hashtable_insert_equal(pt_second, &i);
+    assert_false(_hashtable_equal(pt_first, pt_second));
+
+    _hashtable_destroy(pt_first);
+    _hashtable_destroy(pt_second);
+}
+
+void test__hashtable_incremental_rehash__clear(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    int i;
+
+    _hashtable_init(pt_hashtable, 1543, NULL, NULL);
+    for (i = 0; i < 1600; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    assert_true(pt_hashtable->_ppt_oldbucket != NULL);
+    _hashtable_clear(pt_hashtable);
+    assert_true(pt_hashtable->_ppt_oldbucket == NULL);
+    assert_true(_hashtable_empty(pt_hashtable));
+    assert_true(_hashtable_iterator_equal(_hashtable_begin(pt_hashtable), _hashtable_end(pt_hashtable)));
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_incremental_rehash__bucketmap(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    _hashnode_t** ppt_bucket = NULL;
+    size_t        t_index = 0;
+    bool_t        b_set = false;
+    int i;
+
+    _hashtable_init(pt_hashtable, 1543, NULL, NULL);
+    for (i = 0; i < 1600; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    /* the erasure moves old buckets too, so only a few elements are erased before the rehash is finished */
+    for (i = 0; i < 1600; i += 16) {
+        _hashtable_erase(pt_hashtable, &i);
+    }
+    assert_true(pt_hashtable->_ppt_oldbucket != NULL);
+
+    /* the bit of occupancy bitmap is set if and only if the bucket is not empty */
+    for (t_index = 0; t_index < pt_hashtable->_t_oldbucketcount; ++t_index) {
+        b_set = (pt_hashtable->_pt_oldbucketmap[t_index / _HASHTABLE_BUCKETMAP_BITS] &
+                 ((size_t)1 << (t_index % _HASHTABLE_BUCKETMAP_BITS))) != 0;
+        assert_true(b_set == (pt_hashtable->_ppt_oldbucket[t_index] != NULL));
+    }
+    for (t_index = 0; t_index < _hashtable_bucket_count(pt_hashtable); ++t_index) {
+        ppt_bucket = (_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, t_index);
+        b_set = (pt_hashtable->_pt_bucketmap[t_index / _HASHTABLE_BUCKETMAP_BITS] &
+                 ((size_t)1 << (t_index % _HASHTABLE_BUCKETMAP_BITS))) != 0;
+        assert_true(b_set == (*ppt_bucket != NULL));
+        if (t_index < pt_hashtable->_t_firstbucket) {
+            assert_true(*ppt_bucket == NULL);
+        }
+    }
+    assert_true(*(_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, pt_hashtable->_t_firstbucket) != NULL);
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_incremental_rehash__take_over_storage(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    _byte_t*      pby_storage = NULL;
+    int i;
+
+    _hashtable_init(pt_hashtable, 1543, NULL, NULL);
+    for (i = 0; i < 1543; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    assert_true(pt_hashtable->_ppt_oldbucket == NULL);
+    pby_storage = (_byte_t*)vector_at(&pt_hashtable->_vec_bucket, 0);
+    _hashtable_insert_equal(pt_hashtable, &i);
+    assert_true(pt_hashtable->_ppt_oldbucket != NULL);
+    assert_true((_byte_t*)pt_hashtable->_ppt_oldbucket == pby_storage);
+    assert_true(pt_hashtable->_t_oldbucketcount == 1543);
+    assert_true(pt_hashtable->_t_oldbucketcapacity >= 1543);
+    assert_true((_byte_t*)vector_at(&pt_hashtable->_vec_bucket, 0) != pby_storage);
+    for (i = 0; i < 1544; ++i) {
+        assert_true(_hashtable_count(pt_hashtable, &i) == 1);
+    }
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_incremental_rehash__find_not_step(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    const void*   acpv_value[1];
+    _hashtable_iterator_t at_iter[1];
+    size_t        t_rehashpos = 0;
+    int i;
+
+    _hashtable_init(pt_hashtable, 1543, NULL, NULL);
+    for (i = 0; i < 1544; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    assert_true(pt_hashtable->_ppt_oldbucket != NULL);
+    t_rehashpos = pt_hashtable->_t_rehashpos;
+    for (i = 0; i < 1544; ++i) {
+        assert_true(*(int*)_hashtable_iterator_get_pointer(_hashtable_find(pt_hashtable, &i)) == i);
+        assert_true(_hashtable_count(pt_hashtable, &i) == 1);
+        acpv_value[0] = &i;
+        _hashtable_find_batch(pt_hashtable, acpv_value, 1, at_iter);
+        assert_true(*(int*)_hashtable_iterator_get_pointer(at_iter[0]) == i);
+    }
+    assert_true(pt_hashtable->_ppt_oldbucket != NULL);
+    assert_true(pt_hashtable->_t_rehashpos == t_rehashpos);
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_incremental_rehash__iterate_and_find(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    _hashtable_iterator_t it_iter;
+    _hashtable_iterator_t it_first;
+    size_t        t_count = 0;
+    int i;
+
+    _hashtable_init(pt_hashtable, 1543, NULL, NULL);
+    for (i = 0; i < 1544; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    assert_true(pt_hashtable->_ppt_oldbucket != NULL);
+
+    /* the lookups in the loop keep the iterators valid */
+    it_first = _hashtable_begin(pt_hashtable);
+    for (it_iter = _hashtable_begin(pt_hashtable);
+         !_hashtable_iterator_equal(it_iter, _hashtable_end(pt_hashtable));
+         it_iter = _hashtable_iterator_next(it_iter)) {
+        i = *(int*)_hashtable_iterator_get_pointer(it_iter);
+        assert_true(_hashtable_iterator_equal(_hashtable_find(pt_hashtable, &i), it_iter));
+        ++t_count;
+    }
+    assert_true(t_count == 1544);
+    assert_true(pt_hashtable->_ppt_oldbucket != NULL);
+
+    i = *(int*)_hashtable_iterator_get_pointer(it_first);
+    _hashtable_erase_pos(pt_hashtable, it_first);
+    assert_true(_hashtable_size(pt_hashtable) == 1543);
+    assert_true(_hashtable_count(pt_hashtable, &i) == 0);
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_incremental_rehash__erase_step(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    size_t        t_rehashpos = 0;
+    int i;
+
+    _hashtable_init(pt_hashtable, 1543, NULL, NULL);
+    for (i = 0; i < 1544; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    assert_true(pt_hashtable->_ppt_oldbucket != NULL);
+    t_rehashpos = pt_hashtable->_t_rehashpos;
+    i = 5000;
+    assert_true(_hashtable_erase(pt_hashtable, &i) == 0);
+    assert_true(pt_hashtable->_t_rehashpos == t_rehashpos + _HASHTABLE_INCREMENTAL_REHASH_STEP);
+
+    for (i = 0; i < 1544 && pt_hashtable->_ppt_oldbucket != NULL; ++i) {
+        assert_true(_hashtable_erase(pt_hashtable, &i) == 1);
+    }
+    assert_true(pt_hashtable->_ppt_oldbucket == NULL);
+    assert_true(_hashtable_size(pt_hashtable) == (size_t)(1544 - i));
+    assert_true(_hashtable_iterator_distance(_hashtable_begin(pt_hashtable), _hashtable_end(pt_hashtable)) == 1544 - i);
+
+    _hashtable_destroy(pt_hashtable);
+}
+
@@ -144,6 +144,14 @@ void test__hashtable_max_size__null_hashtable(void** state);
 void test__hashtable_max_size__non_inited(void** state);
 void test__hashtable_max_size__empty(void** state);
 void test__hashtable_max_size__non_empty(void** state);
+/*
+ * test _hashtable_memory_usage
+ */
+UT_CASE_DECLARATION(_hashtable_memory_usage)
+void test__hashtable_memory_usage__null_hashtable(void** state);
+void test__hashtable_memory_usage__non_inited(void** state);
+void test__hashtable_memory_usage__empty(void** state);
+void test__hashtable_memory_usage__non_empty(void** state);
 /*
  * test _hashtable_bucket_count
  */
@@ -161,6 +169,7 @@ void test__hashtable_begin__null_hashtable(void** state);
 void test__hashtable_begin__non_inited(void** state);
 void test__hashtable_begin__empty(void** state);
 void test__hashtable_begin__non_empty(void** state);
+void test__hashtable_begin__sparse(void** state);
 /*
  * test _hashtable_end
  */
@@ -200,6 +209,18 @@ void test__hashtable_find__libcstl_builtin_find(void** state);
 void test__hashtable_find__libcstl_builtin_not_find(void** state);
 void test__hashtable_find__user_define_find(void** state);
 void test__hashtable_find__user_define_not_find(void** state);
+/*
+ * test _hashtable_find_batch
+ */
+UT_CASE_DECLARATION(_hashtable_find_batch)
+void test__hashtable_find_batch__null_hashtable(void** state);
+void test__hashtable_find_batch__null_values(void** state);
+void test__hashtable_find_batch__null_result(void** state);
+void test__hashtable_find_batch__non_inited(void** state);
+void test__hashtable_find_batch__empty_batch(void** state);
+void test__hashtable_find_batch__c_builtin(void** state);
+void test__hashtable_find_batch__cstr(void** state);
+void test__hashtable_find_batch__incremental_rehash(void** state);
 /*
  * test _hashtable_clear
  */
@@ -208,6 +229,7 @@ void test__hashtable_clear__null_hashtable(void** state);
 void test__hashtable_clear__non_inited(void** state);
 void test__hashtable_clear__empty(void** state);
 void test__hashtable_clear__non_empty(void** state);
+void test__hashtable_clear__sparse(void** state);
 /*
  * test _hashtable_count
  */
@@ -489,6 +511,7 @@ void test__hashtable_erase__libcstl_builtin_n(void** state);
 void test__hashtable_erase__user_define_0(void** state);
 void test__hashtable_erase__user_define_1(void** state);
 void test__hashtable_erase__user_define_n(void** state);
+void test__hashtable_erase__shrink(void** state);
 /*
  * test _hashtable_resize
  */
@@ -498,6 +521,69 @@ void test__hashtable_resize__non_inited(void** state);
 void test__hashtable_resize__less_bucketcount(void** state);
 void test__hashtable_resize__equal_bucketcount(void** state);
 void test__hashtable_resize__greater_bucketcount(void** state);
+/*
+ * test _hashtable_load_factor
+ */
+UT_CASE_DECLARATION(_hashtable_load_factor)
+void test__hashtable_load_factor__null_hashtable(void** state);
+void test__hashtable_load_factor__non_inited(void** state);
+void test__hashtable_load_factor__empty(void** state);
+void test__hashtable_load_factor__non_empty(void** state);
+/*
+ * test _hashtable_max_load_factor
+ */
+UT_CASE_DECLARATION(_hashtable_max_load_factor)
+void test__hashtable_max_load_factor__null_hashtable(void** state);
+void test__hashtable_max_load_factor__non_inited(void** state);
+void test__hashtable_max_load_factor__default(void** state);
+void test__hashtable_max_load_factor__init_copy(void** state);
+/*
+ * test _hashtable_set_max_load_factor
+ */
+UT_CASE_DECLARATION(_hashtable_set_max_load_factor)
+void test__hashtable_set_max_load_factor__null_hashtable(void** state);
+void test__hashtable_set_max_load_factor__non_inited(void** state);
+void test__hashtable_set_max_load_factor__invalid(void** state);
+void test__hashtable_set_max_load_factor__less(void** state);
+void test__hashtable_set_max_load_factor__greater(void** state);
+void test__hashtable_set_max_load_factor__incremental_rehash(void** state);
+/*
+ * test _hashtable_reserve
+ */
+UT_CASE_DECLARATION(_hashtable_reserve)
+void test__hashtable_reserve__null_hashtable(void** state);
+void test__hashtable_reserve__non_inited(void** state);
+void test__hashtable_reserve__less(void** state);
+void test__hashtable_reserve__greater(void** state);
+void test__hashtable_reserve__max_load_factor(void** state);
+/*
+ * test _hashtable_shrink_to_fit
+ */
+UT_CASE_DECLARATION(_hashtable_shrink_to_fit)
+void test__hashtable_shrink_to_fit__null_hashtable(void** state);
+void test__hashtable_shrink_to_fit__non_inited(void** state);
+void test__hashtable_shrink_to_fit__empty(void** state);
+void test__hashtable_shrink_to_fit__not_change(void** state);
+void test__hashtable_shrink_to_fit__shrink(void** state);
+void test__hashtable_shrink_to_fit__incremental_rehash(void** state);
+/*
+ * test _hashtable_incremental_rehash
+ */
+UT_CASE_DECLARATION(_hashtable_incremental_rehash)
+void test__hashtable_incremental_rehash__small(void** state);
+void test__hashtable_incremental_rehash__start(void** state);
+void test__hashtable_incremental_rehash__finish(void** state);
+void test__hashtable_incremental_rehash__iterator(void** state);
+void test__hashtable_incremental_rehash__equal_range(void** state);
+void test__hashtable_incremental_rehash__erase(void** state);
+void test__hashtable_incremental_rehash__resize(void** state);
+void test__hashtable_incremental_rehash__equal(void** state);
+void test__hashtable_incremental_rehash__clear(void** state);
+void test__hashtable_incremental_rehash__bucketmap(void** state);
+void test__hashtable_incremental_rehash__take_over_storage(void** state);
+void test__hashtable_incremental_rehash__find_not_step(void** state);
+void test__hashtable_incremental_rehash__iterate_and_find(void** state);
+void test__hashtable_incremental_rehash__erase_step(void** state);
 
 #define UT_CSTL_HASHTABLE_CASE\
     UT_SUIT_BEGIN(cstl_hashtable, test__create_hashtable__null_typename),\
@@ -594,6 +680,10 @@ void test__hashtable_resize__greater_bucketcount(void** state);
     UT_CASE(test__hashtable_max_size__non_inited),\
     UT_CASE(test__hashtable_max_size__empty),\
     UT_CASE(test__hashtable_max_size__non_empty),\
+    UT_CASE_BEGIN(_hashtable_memory_usage, test__hashtable_memory_usage__null_hashtable),\
+    UT_CASE(test__hashtable_memory_usage__non_inited),\
+    UT_CASE(test__hashtable_memory_usage__empty),\
+    UT_CASE(test__hashtable_memory_usage__non_empty),\
     UT_CASE_BEGIN(_hashtable_bucket_count, test__hashtable_bucket_count__null_hashtable),\
     UT_CASE(test__hashtable_bucket_count__non_inited),\
     UT_CASE(test__hashtable_bucket_count__53),\
@@ -603,6 +693,7 @@ void test__hashtable_resize__greater_bucketcount(void** state);
     UT_CASE(test__hashtable_begin__non_inited),\
     UT_CASE(test__hashtable_begin__empty),\
     UT_CASE(test__hashtable_begin__non_empty),\
+    UT_CASE(test__hashtable_begin__sparse),\
     UT_CASE_BEGIN(_hashtable_end, test__hashtable_end__null_hashtable),\
     UT_CASE(test__hashtable_end__non_inited),\
     UT_CASE(test__hashtable_end__empty),\
@@ -626,10 +717,19 @@ void test__hashtable_resize__greater_bucketcount(void** state);
     UT_CASE(test__hashtable_find__libcstl_builtin_not_find),\
     UT_CASE(test__hashtable_find__user_define_find),\
     UT_CASE(test__hashtable_find__user_define_not_find),\
+    UT_CASE_BEGIN(_hashtable_find_batch, test__hashtable_find_batch__null_hashtable),\
+    UT_CASE(test__hashtable_find_batch__null_values),\
+    UT_CASE(test__hashtable_find_batch__null_result),\
+    UT_CASE(test__hashtable_find_batch__non_inited),\
+    UT_CASE(test__hashtable_find_batch__empty_batch),\
+    UT_CASE(test__hashtable_find_batch__c_builtin),\
+    UT_CASE(test__hashtable_find_batch__cstr),\
+    UT_CASE(test__hashtable_find_batch__incremental_rehash),\
     UT_CASE_BEGIN(_hashtable_clear, test__hashtable_clear__null_hashtable),\
     UT_CASE(test__hashtable_clear__non_inited),\
     UT_CASE(test__hashtable_clear__empty),\
     UT_CASE(test__hashtable_clear__non_empty),\
+    UT_CASE(test__hashtable_clear__sparse),\
     UT_CASE_BEGIN(_hashtable_count, test__hashtable_count__null_hashtable),\
     UT_CASE(test__hashtable_count__null_value),\
     UT_CASE(test__hashtable_count__non_inited),\
@@ -839,11 +939,51 @@ void test__hashtable_resize__greater_bucketcount(void** state);
     UT_CASE(test__hashtable_erase__user_define_0),\
     UT_CASE(test__hashtable_erase__user_define_1),\
     UT_CASE(test__hashtable_erase__user_define_n),\
+    UT_CASE(test__hashtable_erase__shrink),\
     UT_CASE_BEGIN(_hashtable_resize, test__hashtable_resize__null_hashtable),\
     UT_CASE(test__hashtable_resize__non_inited),\
     UT_CASE(test__hashtable_resize__less_bucketcount),\
     UT_CASE(test__hashtable_resize__equal_bucketcount),\
-    UT_CASE(test__hashtable_resize__greater_bucketcount)
+    UT_CASE(test__hashtable_resize__greater_bucketcount),\
+    UT_CASE_BEGIN(_hashtable_load_factor, test__hashtable_load_factor__null_hashtable),\
+    UT_CASE(test__hashtable_load_factor__non_inited),\
+    UT_CASE(test__hashtable_load_factor__empty),\
+    UT_CASE(test__hashtable_load_factor__non_empty),\
+    UT_CASE_BEGIN(_hashtable_max_load_factor, test__hashtable_max_load_factor__null_hashtable),\
+    UT_CASE(test__hashtable_max_load_factor__non_inited),\
+    UT_CASE(test__hashtable_max_load_factor__default),\
+    UT_CASE(test__hashtable_max_load_factor__init_copy),\
+    UT_CASE_BEGIN(_hashtable_set_max_load_factor, test__hashtable_set_max_load_factor__null_hashtable),\
+    UT_CASE(test__hashtable_set_max_load_factor__non_inited),\
+    UT_CASE(test__hashtable_set_max_load_factor__invalid),\
+    UT_CASE(test__hashtable_set_max_load_factor__less),\
+    UT_CASE(test__hashtable_set_max_load_factor__greater),\
+    UT_CASE(test__hashtable_set_max_load_factor__incremental_rehash),\
+    UT_CASE_BEGIN(_hashtable_reserve, test__hashtable_reserve__null_hashtable),\
+    UT_CASE(test__hashtable_reserve__non_inited),\
+    UT_CASE(test__hashtable_reserve__less),\
+    UT_CASE(test__hashtable_reserve__greater),\
+    UT_CASE(test__hashtable_reserve__max_load_factor),\
+    UT_CASE_BEGIN(_hashtable_shrink_to_fit, test__hashtable_shrink_to_fit__null_hashtable),\
+    UT_CASE(test__hashtable_shrink_to_fit__non_inited),\
+    UT_CASE(test__hashtable_shrink_to_fit__empty),\
+    UT_CASE(test__hashtable_shrink_to_fit__not_change),\
+    UT_CASE(test__hashtable_shrink_to_fit__shrink),\
+    UT_CASE(test__hashtable_shrink_to_fit__incremental_rehash),\
+    UT_CASE_BEGIN(_hashtable_incremental_rehash, test__hashtable_incremental_rehash__small),\
+    UT_CASE(test__hashtable_incremental_rehash__start),\
+    UT_CASE(test__hashtable_incremental_rehash__finish),\
+    UT_CASE(test__hashtable_incremental_rehash__iterator),\
+    UT_CASE(test__hashtable_incremental_rehash__equal_range),\
+    UT_CASE(test__hashtable_incremental_rehash__erase),\
+    UT_CASE(test__hashtable_incremental_rehash__resize),\
+    UT_CASE(test__hashtable_incremental_rehash__equal),\
+    UT_CASE(test__hashtable_incremental_rehash__clear),\
+    UT_CASE(test__hashtable_incremental_rehash__bucketmap),\
+    UT_CASE(test__hashtable_incremental_rehash__take_over_storage),\
+    UT_CASE(test__hashtable_incremental_rehash__find_not_step),\
+    UT_CASE(test__hashtable_incremental_rehash__iterate_and_find),\
+    UT_CASE(test__hashtable_incremental_rehash__erase_step)
 
 #endif /* _UT_CSTL_HASHTABLE_H_ */
 
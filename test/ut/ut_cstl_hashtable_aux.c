@@ -17,6 +17,8 @@
 #include "cstl/cslist.h"
 #include "cstl/cdeque.h"
 #include "cstl/cset.h"
+#include "cstl/cutility.h"
+#include "cstl_pair_aux.h"
 
 #include "ut_def.h"
 #include "ut_cstl_hashtable_aux.h"
@@ -60,6 +62,9 @@ void test__hashtable_is_created__invalid_rbroot_bucket(void** state)
 {
     _hashtable_t htable;
 
+    _type_register(sizeof(_hashnode_pointer_t), _HASHTABLE_NODE_NAME, NULL, NULL, NULL, NULL);
+    _create_vector_auxiliary(&htable._vec_bucket, _HASHTABLE_NODE_NAME);
+    htable._vec_bucket._pby_start = (_byte_t*)0x733;
     htable._t_nodecount = 0;
     htable._ufun_hash = NULL;
     htable._bfun_compare = NULL;
@@ -909,15 +914,67 @@ void test__hashtable_default_hash__0(void** state)
     int a = 0;
     size_t ret = sizeof(a);
     _hashtable_default_hash(&a, &ret);
-    assert_true(ret == 0);
+    assert_true(ret == _hashtable_hash_bytes(&a, sizeof(a)));
 }
 
 void test__hashtable_default_hash__not_0(void** state)
 {
     int a = 0x01020304;
-    size_t ret = sizeof(a);
-    _hashtable_default_hash(&a, &ret);
-    assert_true(ret == 0x0a);
+    int b = 0x04030201;
+    size_t ret_a = sizeof(a);
+    size_t ret_b = sizeof(b);
+    _hashtable_default_hash(&a, &ret_a);
+    _hashtable_default_hash(&b, &ret_b);
+    assert_true(ret_a == _hashtable_hash_bytes(&a, sizeof(a)));
+    assert_true(ret_a != ret_b);
+}
+
+/*
+ * test _hashtable_hash_bytes
+ */
+UT_CASE_DEFINATION(_hashtable_hash_bytes)
+void test__hashtable_hash_bytes__null_data(void** state)
+{
+    expect_assert_failure(_hashtable_hash_bytes(NULL, 4));
+}
+
+void test__hashtable_hash_bytes__empty(void** state)
+{
+    assert_true(_hashtable_hash_bytes(NULL, 0) == _hashtable_hash_bytes("abc", 0));
+}
+
+void test__hashtable_hash_bytes__same(void** state)
+{
+    const char* s_key = "the quick brown fox jumps over the lazy dog";
+    char s_copy[64];
+    strcpy(s_copy, s_key);
+    assert_true(_hashtable_hash_bytes(s_key, strlen(s_key)) == _hashtable_hash_bytes(s_copy, strlen(s_copy)));
+}
+
+void test__hashtable_hash_bytes__permutation(void** state)
+{
+    assert_true(_hashtable_hash_bytes("abc", 3) != _hashtable_hash_bytes("cba", 3));
+    assert_true(_hashtable_hash_bytes("abcdefghijkl", 12) != _hashtable_hash_bytes("abcdefghijlk", 12));
+    assert_true(_hashtable_hash_bytes("abcd", 4) != _hashtable_hash_bytes("abcd", 3));
+}
+
+void test__hashtable_hash_bytes__spread(void** state)
+{
+    size_t an_bucket[53] = {0};
+    size_t i = 0;
+    size_t t_max = 0;
+
+    /* sequential integer keys should be spread over buckets evenly */
+    for (i = 0; i < 5300; ++i) {
+        int n_key = (int)i;
+        an_bucket[_hashtable_hash_bytes(&n_key, sizeof(n_key)) % 53]++;
+    }
+    for (i = 0; i < 53; ++i) {
+        if (an_bucket[i] > t_max) {
+            t_max = an_bucket[i];
+        }
+    }
+    assert_true(t_max < 200);
 }
 
 /*
@@ -1082,7 +1139,7 @@ void test__hashtable_hash_auxiliary__c_builtin(void** state)
 
     _hashtable_init(pt_hashtable, 0, NULL, NULL);
     _hashtable_hash_auxiliary(pt_hashtable, &a, &ret);
-    assert_true(ret == 0x0a);
+    assert_true(ret == _hashtable_hash_bytes(&a, sizeof(int)));
 
     _hashtable_destroy(pt_hashtable);
 }
@@ -1203,3 +1260,501 @@ void test__hashtable_elem_compare_auxiliary__cstr(void** state)
     string_destroy(pstr_second);
 }
 
+/*
+ * test _hashtable_elem_three_way_compare_auxiliary
+ */
+UT_CASE_DEFINATION(_hashtable_elem_three_way_compare_auxiliary)
+void test__hashtable_elem_three_way_compare_auxiliary__null_hashtable(void** state)
+{
+    int n_first = 0;
+    int n_second = 0;
+    expect_assert_failure(_hashtable_elem_three_way_compare_auxiliary(NULL, &n_first, &n_second));
+}
+
+void test__hashtable_elem_three_way_compare_auxiliary__int(void** state)
+{
+    int n_first = 5;
+    int n_second = 9;
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+
+    assert_true(_hashtable_elem_three_way_compare_auxiliary(pt_hashtable, &n_first, &n_second) < 0);
+    assert_true(_hashtable_elem_three_way_compare_auxiliary(pt_hashtable, &n_second, &n_first) > 0);
+    assert_true(_hashtable_elem_three_way_compare_auxiliary(pt_hashtable, &n_first, &n_first) == 0);
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+static void _test__hashtable_elem_three_way_compare_auxiliary__greater(
+    const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    *(bool_t*)pv_output = *(int*)cpv_first > *(int*)cpv_second ? true : false;
+}
+void test__hashtable_elem_three_way_compare_auxiliary__user_compare(void** state)
+{
+    int n_first = 5;
+    int n_second = 9;
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    _hashtable_init(pt_hashtable, 0, NULL, _test__hashtable_elem_three_way_compare_auxiliary__greater);
+
+    assert_true(_hashtable_elem_three_way_compare_auxiliary(pt_hashtable, &n_first, &n_second) > 0);
+    assert_true(_hashtable_elem_three_way_compare_auxiliary(pt_hashtable, &n_second, &n_first) < 0);
+    assert_true(_hashtable_elem_three_way_compare_auxiliary(pt_hashtable, &n_first, &n_first) == 0);
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+/*
+ * test _hashtable_node_hashcode_auxiliary
+ */
+UT_CASE_DEFINATION(_hashtable_node_hashcode_auxiliary)
+void test__hashtable_node_hashcode_auxiliary__null_hashtable(void** state)
+{
+    _hashnode_t node;
+    expect_assert_failure(_hashtable_node_hashcode_auxiliary(NULL, &node));
+}
+
+void test__hashtable_node_hashcode_auxiliary__null_node(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+
+    expect_assert_failure(_hashtable_node_hashcode_auxiliary(pt_hashtable, NULL));
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_node_hashcode_auxiliary__c_builtin(void** state)
+{
+    int elem = 100;
+    size_t t_hashcode = sizeof(int);
+    _hashtable_iterator_t it_iter;
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+
+    it_iter = _hashtable_insert_equal(pt_hashtable, &elem);
+    _hashtable_hash_auxiliary(pt_hashtable, &elem, &t_hashcode);
+    assert_true(_hashtable_node_hashcode_auxiliary(
+        pt_hashtable, (_hashnode_t*)_HASHTABLE_ITERATOR_COREPOS(it_iter)) == t_hashcode);
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+/*
+ * test _hashtable_node_equal_auxiliary
+ */
+UT_CASE_DEFINATION(_hashtable_node_equal_auxiliary)
+void test__hashtable_node_equal_auxiliary__null_hashtable(void** state)
+{
+    int elem = 0;
+    _hashnode_t node;
+    expect_assert_failure(_hashtable_node_equal_auxiliary(NULL, &node, &elem, 0));
+}
+
+void test__hashtable_node_equal_auxiliary__null_node(void** state)
+{
+    int elem = 0;
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+
+    expect_assert_failure(_hashtable_node_equal_auxiliary(pt_hashtable, NULL, &elem, 0));
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_node_equal_auxiliary__null_value(void** state)
+{
+    _hashnode_t node;
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+
+    expect_assert_failure(_hashtable_node_equal_auxiliary(pt_hashtable, &node, NULL, 0));
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_node_equal_auxiliary__equal(void** state)
+{
+    int elem = 100;
+    size_t t_hashcode = sizeof(int);
+    _hashtable_iterator_t it_iter;
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+
+    it_iter = _hashtable_insert_equal(pt_hashtable, &elem);
+    _hashtable_hash_auxiliary(pt_hashtable, &elem, &t_hashcode);
+    assert_true(_hashtable_node_equal_auxiliary(
+        pt_hashtable, (_hashnode_t*)_HASHTABLE_ITERATOR_COREPOS(it_iter), &elem, t_hashcode));
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_node_equal_auxiliary__not_equal(void** state)
+{
+    int elem = 100;
+    size_t t_hashcode = sizeof(int);
+    _hashtable_iterator_t it_iter;
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+
+    it_iter = _hashtable_insert_equal(pt_hashtable, &elem);
+    elem = 200;
+    _hashtable_hash_auxiliary(pt_hashtable, &elem, &t_hashcode);
+    assert_false(_hashtable_node_equal_auxiliary(
+        pt_hashtable, (_hashnode_t*)_HASHTABLE_ITERATOR_COREPOS(it_iter), &elem, t_hashcode));
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+static size_t _gt_test__hashtable_node_equal_auxiliary__compare_count = 0;
+static void _test__hashtable_node_equal_auxiliary__hash(const void* cpv_input, void* pv_output)
+{
+    *(size_t*)pv_output = *(int*)cpv_input;
+}
+static void _test__hashtable_node_equal_auxiliary__compare(
+    const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    _gt_test__hashtable_node_equal_auxiliary__compare_count++;
+    *(bool_t*)pv_output = *(int*)cpv_first < *(int*)cpv_second ? true : false;
+}
+void test__hashtable_node_equal_auxiliary__same_bucket(void** state)
+{
+    int elem = 0;
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    _hashtable_init(pt_hashtable, 53,
+        _test__hashtable_node_equal_auxiliary__hash, _test__hashtable_node_equal_auxiliary__compare);
+
+    /* all elements are saved in the first bucket */
+    for (elem = 0; elem < 53 * 10; elem += 53) {
+        _hashtable_insert_equal(pt_hashtable, &elem);
+    }
+    _gt_test__hashtable_node_equal_auxiliary__compare_count = 0;
+    elem = 53 * 9;
+    assert_false(_hashtable_iterator_equal(_hashtable_find(pt_hashtable, &elem), _hashtable_end(pt_hashtable)));
+#ifdef CSTL_HASHTABLE_HASH_CODE_CACHE
+    /* only the node with same hash code is compared */
+    assert_true(_gt_test__hashtable_node_equal_auxiliary__compare_count == 2);
+#else
+    assert_true(_gt_test__hashtable_node_equal_auxiliary__compare_count > 2);
+#endif
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+/*
+ * test _hashtable_init_node_auxiliary
+ */
+UT_CASE_DEFINATION(_hashtable_init_node_auxiliary)
+void test__hashtable_init_node_auxiliary__null_hashtable(void** state)
+{
+    _hashnode_t node;
+    expect_assert_failure(_hashtable_init_node_auxiliary(NULL, &node));
+}
+
+void test__hashtable_init_node_auxiliary__null_node(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+
+    expect_assert_failure(_hashtable_init_node_auxiliary(pt_hashtable, NULL));
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_init_node_auxiliary__c_builtin(void** state)
+{
+    _hashnode_t* p = NULL;
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+    p = malloc(pt_hashtable->_t_nodesize);
+
+    assert_true(pt_hashtable->_t_nodesize == _HASHTABLE_NODE_SIZE(_GET_HASHTABLE_TYPE_SIZE(pt_hashtable)));
+    *(int*)p->_pby_data = 100;
+    _hashtable_init_node_auxiliary(pt_hashtable, p);
+    assert_true(*(int*)p->_pby_data == 0);
+
+    free(p);
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_init_node_auxiliary__pair(void** state)
+{
+    _hashnode_t* p = NULL;
+    pair_t* ppair = NULL;
+    _hashtable_t* pt_hashtable = _create_hashtable("pair_t<int, vector_t<int>>");
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+    p = malloc(pt_hashtable->_t_nodesize);
+
+    assert_true(pt_hashtable->_t_nodesize ==
+        _HASHTABLE_NODE_SIZE(_GET_HASHTABLE_TYPE_SIZE(pt_hashtable)) + _pair_get_inline_size(&pt_hashtable->_t_typeinfo));
+    _hashtable_init_node_auxiliary(pt_hashtable, p);
+    ppair = (pair_t*)p->_pby_data;
+    assert_true(_pair_is_inited(ppair));
+    assert_true(ppair->_pv_first == (void*)_PAIR_INLINE_STORAGE(ppair));
+    assert_true((_byte_t*)ppair->_pv_second + sizeof(vector_t) <= (_byte_t*)p + pt_hashtable->_t_nodesize);
+    assert_true(*(int*)pair_first(ppair) == 0);
+    assert_true(vector_empty((vector_t*)pair_second(ppair)));
+
+    _pair_destroy_auxiliary(ppair);
+    free(p);
+    _hashtable_destroy(pt_hashtable);
+}
+
+/*
+ * test _hashtable_update_bucket_auxiliary
+ */
+UT_CASE_DEFINATION(_hashtable_update_bucket_auxiliary)
+void test__hashtable_update_bucket_auxiliary__null_hashtable(void** state)
+{
+    _hashnode_t* pt_node = NULL;
+    expect_assert_failure(_hashtable_update_bucket_auxiliary(NULL, &pt_node));
+}
+
+void test__hashtable_update_bucket_auxiliary__null_bucket(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+
+    expect_assert_failure(_hashtable_update_bucket_auxiliary(pt_hashtable, NULL));
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_update_bucket_auxiliary__non_empty(void** state)
+{
+    _hashnode_t   t_node;
+    _hashnode_t** ppt_bucket = NULL;
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+
+    assert_true(pt_hashtable->_t_firstbucket == _hashtable_bucket_count(pt_hashtable));
+    ppt_bucket = (_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, 40);
+    *ppt_bucket = &t_node;
+    _hashtable_update_bucket_auxiliary(pt_hashtable, ppt_bucket);
+    assert_true(pt_hashtable->_t_firstbucket == 40);
+    assert_true(_hashtable_next_bucket_auxiliary(pt_hashtable, NULL) == ppt_bucket);
+
+    ppt_bucket = (_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, 2);
+    *ppt_bucket = &t_node;
+    _hashtable_update_bucket_auxiliary(pt_hashtable, ppt_bucket);
+    assert_true(pt_hashtable->_t_firstbucket == 2);
+    assert_true(_hashtable_next_bucket_auxiliary(pt_hashtable, ppt_bucket) == vector_at(&pt_hashtable->_vec_bucket, 40));
+
+    *ppt_bucket = NULL;
+    _hashtable_update_bucket_auxiliary(pt_hashtable, ppt_bucket);
+    ppt_bucket = (_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, 40);
+    *ppt_bucket = NULL;
+    _hashtable_update_bucket_auxiliary(pt_hashtable, ppt_bucket);
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_update_bucket_auxiliary__empty(void** state)
+{
+    _hashnode_t   t_node;
+    _hashnode_t** ppt_first = NULL;
+    _hashnode_t** ppt_second = NULL;
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+
+    ppt_first = (_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, 3);
+    ppt_second = (_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, 50);
+    *ppt_first = &t_node;
+    *ppt_second = &t_node;
+    _hashtable_update_bucket_auxiliary(pt_hashtable, ppt_first);
+    _hashtable_update_bucket_auxiliary(pt_hashtable, ppt_second);
+
+    *ppt_second = NULL;
+    _hashtable_update_bucket_auxiliary(pt_hashtable, ppt_second);
+    assert_true(pt_hashtable->_t_firstbucket == 3);
+    assert_true(_hashtable_next_bucket_auxiliary(pt_hashtable, ppt_first) ==
+        (_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, 0) + _hashtable_bucket_count(pt_hashtable));
+
+    *ppt_first = NULL;
+    _hashtable_update_bucket_auxiliary(pt_hashtable, ppt_first);
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_update_bucket_auxiliary__empty_first(void** state)
+{
+    _hashnode_t   t_node;
+    _hashnode_t** ppt_first = NULL;
+    _hashnode_t** ppt_second = NULL;
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    _hashtable_init(pt_hashtable, 1000, NULL, NULL);
+
+    ppt_first = (_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, 1);
+    ppt_second = (_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, 700);
+    *ppt_first = &t_node;
+    *ppt_second = &t_node;
+    _hashtable_update_bucket_auxiliary(pt_hashtable, ppt_first);
+    _hashtable_update_bucket_auxiliary(pt_hashtable, ppt_second);
+    assert_true(pt_hashtable->_t_firstbucket == 1);
+
+    *ppt_first = NULL;
+    _hashtable_update_bucket_auxiliary(pt_hashtable, ppt_first);
+    assert_true(pt_hashtable->_t_firstbucket == 700);
+    assert_true(_hashtable_prev_bucket_auxiliary(pt_hashtable, ppt_second) == NULL);
+
+    *ppt_second = NULL;
+    _hashtable_update_bucket_auxiliary(pt_hashtable, ppt_second);
+    assert_true(pt_hashtable->_t_firstbucket == _hashtable_bucket_count(pt_hashtable));
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_update_bucket_auxiliary__old_bucket(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    _hashnode_t** ppt_bucket = NULL;
+    _hashnode_t*  pt_node = NULL;
+    size_t        t_index = 0;
+    int i;
+
+    _hashtable_init(pt_hashtable, 1543, NULL, NULL);
+    for (i = 0; i < 1600; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    assert_true(pt_hashtable->_ppt_oldbucket != NULL);
+
+    /* take the nodes of last non-empty old bucket out, then put them back */
+    ppt_bucket = _hashtable_prev_bucket_auxiliary(pt_hashtable, (_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, 0));
+    assert_true(ppt_bucket != NULL && *ppt_bucket != NULL);
+    t_index = (size_t)(ppt_bucket - pt_hashtable->_ppt_oldbucket);
+    assert_true(t_index < pt_hashtable->_t_oldbucketcount);
+    pt_node = *ppt_bucket;
+    *ppt_bucket = NULL;
+    _hashtable_update_bucket_auxiliary(pt_hashtable, ppt_bucket);
+    assert_true((pt_hashtable->_pt_oldbucketmap[t_index / _HASHTABLE_BUCKETMAP_BITS] &
+        ((size_t)1 << (t_index % _HASHTABLE_BUCKETMAP_BITS))) == 0);
+    assert_true(_hashtable_prev_bucket_auxiliary(pt_hashtable, ppt_bucket + 1) != ppt_bucket);
+
+    *ppt_bucket = pt_node;
+    _hashtable_update_bucket_auxiliary(pt_hashtable, ppt_bucket);
+    assert_true((pt_hashtable->_pt_oldbucketmap[t_index / _HASHTABLE_BUCKETMAP_BITS] &
+        ((size_t)1 << (t_index % _HASHTABLE_BUCKETMAP_BITS))) != 0);
+    assert_true(_hashtable_prev_bucket_auxiliary(pt_hashtable, ppt_bucket + 1) == ppt_bucket);
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+/*
+ * test _hashtable_reset_bucket_auxiliary
+ */
+UT_CASE_DEFINATION(_hashtable_reset_bucket_auxiliary)
+void test__hashtable_reset_bucket_auxiliary__null_hashtable(void** state)
+{
+    expect_assert_failure(_hashtable_reset_bucket_auxiliary(NULL, 53));
+}
+
+void test__hashtable_reset_bucket_auxiliary__incremental_rehash(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    int i;
+
+    _hashtable_init(pt_hashtable, 1543, NULL, NULL);
+    for (i = 0; i < 1600; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    expect_assert_failure(_hashtable_reset_bucket_auxiliary(pt_hashtable, 53));
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_reset_bucket_auxiliary__inited(void** state)
+{
+    _hashnode_t   t_node;
+    _hashnode_t** ppt_bucket = NULL;
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+
+    ppt_bucket = (_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, 10);
+    *ppt_bucket = &t_node;
+    _hashtable_update_bucket_auxiliary(pt_hashtable, ppt_bucket);
+    _hashtable_reset_bucket_auxiliary(pt_hashtable, 193);
+    assert_true(_hashtable_bucket_count(pt_hashtable) == 193);
+    assert_true(*(_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, 10) == NULL);
+    assert_true(pt_hashtable->_t_firstbucket == 193);
+    assert_true(_hashtable_iterator_equal(_hashtable_begin(pt_hashtable), _hashtable_end(pt_hashtable)));
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+/*
+ * test _hashtable_rebuild_auxiliary
+ */
+UT_CASE_DEFINATION(_hashtable_rebuild_auxiliary)
+void test__hashtable_rebuild_auxiliary__null_hashtable(void** state)
+{
+    expect_assert_failure(_hashtable_rebuild_auxiliary(NULL, 53));
+}
+
+void test__hashtable_rebuild_auxiliary__non_inited(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+
+    expect_assert_failure(_hashtable_rebuild_auxiliary(pt_hashtable, 53));
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_rebuild_auxiliary__expand(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    int i;
+
+    _hashtable_init(pt_hashtable, 0, NULL, NULL);
+    for (i = 0; i < 20; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    _hashtable_rebuild_auxiliary(pt_hashtable, 769);
+    assert_true(_hashtable_bucket_count(pt_hashtable) == 769);
+    assert_true(_hashtable_size(pt_hashtable) == 20);
+    assert_true(_hashtable_iterator_distance(_hashtable_begin(pt_hashtable), _hashtable_end(pt_hashtable)) == 20);
+    for (i = 0; i < 20; ++i) {
+        assert_true(_hashtable_count(pt_hashtable, &i) == 1);
+    }
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_rebuild_auxiliary__shrink(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    int i;
+
+    _hashtable_init(pt_hashtable, 100000, NULL, NULL);
+    for (i = 0; i < 20; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    _hashtable_rebuild_auxiliary(pt_hashtable, 53);
+    assert_true(_hashtable_bucket_count(pt_hashtable) == 53);
+    assert_true(_hashtable_size(pt_hashtable) == 40);
+    assert_true(_hashtable_iterator_distance(_hashtable_begin(pt_hashtable), _hashtable_end(pt_hashtable)) == 40);
+    for (i = 0; i < 20; ++i) {
+        assert_true(_hashtable_count(pt_hashtable, &i) == 2);
+    }
+
+    _hashtable_destroy(pt_hashtable);
+}
+
+void test__hashtable_rebuild_auxiliary__incremental_rehash(void** state)
+{
+    _hashtable_t* pt_hashtable = _create_hashtable("int");
+    int i;
+
+    _hashtable_init(pt_hashtable, 1543, NULL, NULL);
+    for (i = 0; i < 1600; ++i) {
+        _hashtable_insert_equal(pt_hashtable, &i);
+    }
+    assert_true(pt_hashtable->_ppt_oldbucket != NULL);
+    _hashtable_rebuild_auxiliary(pt_hashtable, 1543);
+    assert_true(pt_hashtable->_ppt_oldbucket == NULL);
+    assert_true(pt_hashtable->_pt_oldbucketmap == NULL);
+    assert_true(_hashtable_bucket_count(pt_hashtable) == 1543);
+    assert_true(_hashtable_iterator_distance(_hashtable_begin(pt_hashtable), _hashtable_end(pt_hashtable)) == 1600);
+    for (i = 0; i < 1600; ++i) {
+        assert_true(_hashtable_count(pt_hashtable, &i) == 1);
+    }
+
+    _hashtable_destroy(pt_hashtable);
+}
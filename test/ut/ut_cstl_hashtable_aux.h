@@ -115,6 +115,15 @@ void test__hashtable_default_hash__null_input(void** state);
 void test__hashtable_default_hash__null_output(void** state);
 void test__hashtable_default_hash__0(void** state);
 void test__hashtable_default_hash__not_0(void** state);
+/*
+ * test _hashtable_hash_bytes
+ */
+UT_CASE_DECLARATION(_hashtable_hash_bytes)
+void test__hashtable_hash_bytes__null_data(void** state);
+void test__hashtable_hash_bytes__empty(void** state);
+void test__hashtable_hash_bytes__same(void** state);
+void test__hashtable_hash_bytes__permutation(void** state);
+void test__hashtable_hash_bytes__spread(void** state);
 /*
  * test _hashtable_init_elem_auxiliary
  */
@@ -147,6 +156,68 @@ void test__hashtable_elem_compare_auxiliary__null_output(void** state);
 void test__hashtable_elem_compare_auxiliary__non_inited(void** state);
 void test__hashtable_elem_compare_auxiliary__int(void** state);
 void test__hashtable_elem_compare_auxiliary__cstr(void** state);
+/*
+ * test _hashtable_elem_three_way_compare_auxiliary
+ */
+UT_CASE_DECLARATION(_hashtable_elem_three_way_compare_auxiliary)
+void test__hashtable_elem_three_way_compare_auxiliary__null_hashtable(void** state);
+void test__hashtable_elem_three_way_compare_auxiliary__int(void** state);
+void test__hashtable_elem_three_way_compare_auxiliary__user_compare(void** state);
+/*
+ * test _hashtable_node_hashcode_auxiliary
+ */
+UT_CASE_DECLARATION(_hashtable_node_hashcode_auxiliary)
+void test__hashtable_node_hashcode_auxiliary__null_hashtable(void** state);
+void test__hashtable_node_hashcode_auxiliary__null_node(void** state);
+void test__hashtable_node_hashcode_auxiliary__c_builtin(void** state);
+/*
+ * test _hashtable_node_equal_auxiliary
+ */
+UT_CASE_DECLARATION(_hashtable_node_equal_auxiliary)
+void test__hashtable_node_equal_auxiliary__null_hashtable(void** state);
+void test__hashtable_node_equal_auxiliary__null_node(void** state);
+void test__hashtable_node_equal_auxiliary__null_value(void** state);
+void test__hashtable_node_equal_auxiliary__equal(void** state);
+void test__hashtable_node_equal_auxiliary__not_equal(void** state);
+void test__hashtable_node_equal_auxiliary__same_bucket(void** state);
+
+/*
+ * test _hashtable_init_node_auxiliary
+ */
+UT_CASE_DECLARATION(_hashtable_init_node_auxiliary)
+void test__hashtable_init_node_auxiliary__null_hashtable(void** state);
+void test__hashtable_init_node_auxiliary__null_node(void** state);
+void test__hashtable_init_node_auxiliary__c_builtin(void** state);
+void test__hashtable_init_node_auxiliary__pair(void** state);
+
+/*
+ * test _hashtable_update_bucket_auxiliary
+ */
+UT_CASE_DECLARATION(_hashtable_update_bucket_auxiliary)
+void test__hashtable_update_bucket_auxiliary__null_hashtable(void** state);
+void test__hashtable_update_bucket_auxiliary__null_bucket(void** state);
+void test__hashtable_update_bucket_auxiliary__non_empty(void** state);
+void test__hashtable_update_bucket_auxiliary__empty(void** state);
+void test__hashtable_update_bucket_auxiliary__empty_first(void** state);
+void test__hashtable_update_bucket_auxiliary__old_bucket(void** state);
+
+/*
+ * test _hashtable_reset_bucket_auxiliary
+ */
+UT_CASE_DECLARATION(_hashtable_reset_bucket_auxiliary)
+void test__hashtable_reset_bucket_auxiliary__null_hashtable(void** state);
+void test__hashtable_reset_bucket_auxiliary__incremental_rehash(void** state);
+void test__hashtable_reset_bucket_auxiliary__inited(void** state);
+
+/*
+ * test _hashtable_rebuild_auxiliary
+ */
+UT_CASE_DECLARATION(_hashtable_rebuild_auxiliary)
+void test__hashtable_rebuild_auxiliary__null_hashtable(void** state);
+void test__hashtable_rebuild_auxiliary__non_inited(void** state);
+void test__hashtable_rebuild_auxiliary__expand(void** state);
+void test__hashtable_rebuild_auxiliary__shrink(void** state);
+void test__hashtable_rebuild_auxiliary__incremental_rehash(void** state);
 
 #define UT_CSTL_HASHTABLE_AUX_CASE\
     UT_SUIT_BEGIN(cstl_hashtable_aux, test__hashtable_is_created__null_hashtable),\
@@ -222,6 +293,11 @@ void test__hashtable_elem_compare_auxiliary__cstr(void** state);
     UT_CASE(test__hashtable_default_hash__null_output),\
     UT_CASE(test__hashtable_default_hash__0),\
     UT_CASE(test__hashtable_default_hash__not_0),\
+    UT_CASE_BEGIN(_hashtable_hash_bytes, test__hashtable_hash_bytes__null_data),\
+    UT_CASE(test__hashtable_hash_bytes__empty),\
+    UT_CASE(test__hashtable_hash_bytes__same),\
+    UT_CASE(test__hashtable_hash_bytes__permutation),\
+    UT_CASE(test__hashtable_hash_bytes__spread),\
     UT_CASE_BEGIN(_hashtable_init_elem_auxiliary, test__hashtable_init_elem_auxiliary__null_hashtable),\
     UT_CASE(test__hashtable_init_elem_auxiliary__null_node),\
     UT_CASE(test__hashtable_init_elem_auxiliary__non_inited),\
@@ -241,7 +317,37 @@ void test__hashtable_elem_compare_auxiliary__cstr(void** state);
     UT_CASE(test__hashtable_elem_compare_auxiliary__null_output),\
     UT_CASE(test__hashtable_elem_compare_auxiliary__non_inited),\
     UT_CASE(test__hashtable_elem_compare_auxiliary__int),\
-    UT_CASE(test__hashtable_elem_compare_auxiliary__cstr)
+    UT_CASE(test__hashtable_elem_compare_auxiliary__cstr),\
+    UT_CASE_BEGIN(_hashtable_elem_three_way_compare_auxiliary, test__hashtable_elem_three_way_compare_auxiliary__null_hashtable),\
+    UT_CASE(test__hashtable_elem_three_way_compare_auxiliary__int),\
+    UT_CASE(test__hashtable_elem_three_way_compare_auxiliary__user_compare),\
+    UT_CASE_BEGIN(_hashtable_node_hashcode_auxiliary, test__hashtable_node_hashcode_auxiliary__null_hashtable),\
+    UT_CASE(test__hashtable_node_hashcode_auxiliary__null_node),\
+    UT_CASE(test__hashtable_node_hashcode_auxiliary__c_builtin),\
+    UT_CASE_BEGIN(_hashtable_node_equal_auxiliary, test__hashtable_node_equal_auxiliary__null_hashtable),\
+    UT_CASE(test__hashtable_node_equal_auxiliary__null_node),\
+    UT_CASE(test__hashtable_node_equal_auxiliary__null_value),\
+    UT_CASE(test__hashtable_node_equal_auxiliary__equal),\
+    UT_CASE(test__hashtable_node_equal_auxiliary__not_equal),\
+    UT_CASE(test__hashtable_node_equal_auxiliary__same_bucket),\
+    UT_CASE_BEGIN(_hashtable_init_node_auxiliary, test__hashtable_init_node_auxiliary__null_hashtable),\
+    UT_CASE(test__hashtable_init_node_auxiliary__null_node),\
+    UT_CASE(test__hashtable_init_node_auxiliary__c_builtin),\
+    UT_CASE(test__hashtable_init_node_auxiliary__pair),\
+    UT_CASE_BEGIN(_hashtable_update_bucket_auxiliary, test__hashtable_update_bucket_auxiliary__null_hashtable),\
+    UT_CASE(test__hashtable_update_bucket_auxiliary__null_bucket),\
+    UT_CASE(test__hashtable_update_bucket_auxiliary__non_empty),\
+    UT_CASE(test__hashtable_update_bucket_auxiliary__empty),\
+    UT_CASE(test__hashtable_update_bucket_auxiliary__empty_first),\
+    UT_CASE(test__hashtable_update_bucket_auxiliary__old_bucket),\
+    UT_CASE_BEGIN(_hashtable_reset_bucket_auxiliary, test__hashtable_reset_bucket_auxiliary__null_hashtable),\
+    UT_CASE(test__hashtable_reset_bucket_auxiliary__incremental_rehash),\
+    UT_CASE(test__hashtable_reset_bucket_auxiliary__inited),\
+    UT_CASE_BEGIN(_hashtable_rebuild_auxiliary, test__hashtable_rebuild_auxiliary__null_hashtable),\
+    UT_CASE(test__hashtable_rebuild_auxiliary__non_inited),\
+    UT_CASE(test__hashtable_rebuild_auxiliary__expand),\
+    UT_CASE(test__hashtable_rebuild_auxiliary__shrink),\
+    UT_CASE(test__hashtable_rebuild_auxiliary__incremental_rehash)
 
 #endif /* _UT_CSTL_HASHTABLE_AUX_H_ */
 
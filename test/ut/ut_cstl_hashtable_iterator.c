@@ -469,15 +469,17 @@ void test__hashtable_iterator_next__begin(void** state)
     _hashtable_t* pt_hashtable = _create_hashtable("int");
     _hashtable_iterator_t it_iter;
     int elem = 10;
+    int n_first = 0;
     _hashtable_init(pt_hashtable, 0, NULL, NULL);
 
     _hashtable_insert_unique(pt_hashtable, &elem);
     elem = 3;
     _hashtable_insert_unique(pt_hashtable, &elem);
     it_iter = _hashtable_begin(pt_hashtable);
-    assert_true(*(int*)_hashtable_iterator_get_pointer(it_iter) == 3);
+    n_first = *(int*)_hashtable_iterator_get_pointer(it_iter);
+    assert_true(n_first == 3 || n_first == 10);
     it_iter = _hashtable_iterator_next(it_iter);
-    assert_true(*(int*)_hashtable_iterator_get_pointer(it_iter) == 10);
+    assert_true(*(int*)_hashtable_iterator_get_pointer(it_iter) == 3 + 10 - n_first);
 
     _hashtable_destroy(pt_hashtable);
 }
@@ -564,15 +566,17 @@ void test__hashtable_iterator_prev__last(void** state)
     _hashtable_t* pt_hashtable = _create_hashtable("int");
     _hashtable_iterator_t it_iter;
     int elem = 10;
+    int n_first = 0;
     _hashtable_init(pt_hashtable, 0, NULL, NULL);
 
     _hashtable_insert_unique(pt_hashtable, &elem);
     elem = 3;
     _hashtable_insert_unique(pt_hashtable, &elem);
     it_iter = _hashtable_iterator_prev(_hashtable_end(pt_hashtable));
-    assert_true(*(int*)_hashtable_iterator_get_pointer(it_iter) == 10);
+    n_first = *(int*)_hashtable_iterator_get_pointer(it_iter);
+    assert_true(n_first == 10 || n_first == 3);
     it_iter = _hashtable_iterator_prev(it_iter);
-    assert_true(*(int*)_hashtable_iterator_get_pointer(it_iter) == 3);
+    assert_true(*(int*)_hashtable_iterator_get_pointer(it_iter) == 10 + 3 - n_first);
 
     _hashtable_destroy(pt_hashtable);
 }
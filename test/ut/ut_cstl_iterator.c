@@ -764,14 +764,16 @@ void test_iterator_next__hash_set(void** state)
 {
     hash_set_t* phset = create_hash_set(int);
     iterator_t it_iter;
+    int n_first = 0;
 
     hash_set_init(phset);
     hash_set_insert(phset, 1);
     hash_set_insert(phset, 2);
     it_iter = hash_set_begin(phset);
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 1);
+    n_first = *(int*)iterator_get_pointer(it_iter);
+    assert_true(n_first == 1 || n_first == 2);
     it_iter = iterator_next(it_iter);
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 2);
+    assert_true(*(int*)iterator_get_pointer(it_iter) == 3 - n_first);
     hash_set_destroy(phset);
 }
 
@@ -788,14 +790,16 @@ void test_iterator_next__hash_multiset(void** state)
 {
     hash_multiset_t* phmset = create_hash_multiset(int);
     iterator_t it_iter;
+    int n_first = 0;
 
     hash_multiset_init(phmset);
     hash_multiset_insert(phmset, 1);
     hash_multiset_insert(phmset, 2);
     it_iter = hash_multiset_begin(phmset);
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 1);
+    n_first = *(int*)iterator_get_pointer(it_iter);
+    assert_true(n_first == 1 || n_first == 2);
     it_iter = iterator_next(it_iter);
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 2);
+    assert_true(*(int*)iterator_get_pointer(it_iter) == 3 - n_first);
     hash_multiset_destroy(phmset);
 }
 
@@ -813,6 +817,7 @@ void test_iterator_next__hash_map(void** state)
     hash_map_t* phmap = create_hash_map(int, int);
     pair_t* ppair = create_pair(int, int);
     iterator_t it_iter;
+    int n_first = 0;
 
     hash_map_init(phmap);
     pair_init(ppair);
@@ -821,9 +826,10 @@ void test_iterator_next__hash_map(void** state)
     pair_make(ppair, 1, 1);
     hash_map_insert(phmap, ppair);
     it_iter = hash_map_begin(phmap);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 0);
+    n_first = *(int*)pair_first((pair_t*)iterator_get_pointer(it_iter));
+    assert_true(n_first == 0 || n_first == 1);
     it_iter = iterator_next(it_iter);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 1);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 1 - n_first);
     pair_destroy(ppair);
     hash_map_destroy(phmap);
 }
@@ -842,6 +848,7 @@ void test_iterator_next__hash_multimap(void** state)
     hash_multimap_t* phmap = create_hash_multimap(int, int);
     pair_t* ppair = create_pair(int, int);
     iterator_t it_iter;
+    int n_first = 0;
 
     hash_multimap_init(phmap);
     pair_init(ppair);
@@ -850,9 +857,10 @@ void test_iterator_next__hash_multimap(void** state)
     pair_make(ppair, 1, 1);
     hash_multimap_insert(phmap, ppair);
     it_iter = hash_multimap_begin(phmap);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 0);
+    n_first = *(int*)pair_first((pair_t*)iterator_get_pointer(it_iter));
+    assert_true(n_first == 0 || n_first == 1);
     it_iter = iterator_next(it_iter);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 1);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 1 - n_first);
     pair_destroy(ppair);
     hash_multimap_destroy(phmap);
 }
@@ -1107,14 +1115,16 @@ void test_iterator_prev__hash_set(void** state)
 {
     hash_set_t* phset = create_hash_set(int);
     iterator_t it_iter;
+    int n_last = 0;
 
     hash_set_init(phset);
     hash_set_insert(phset, 1);
     hash_set_insert(phset, 2);
     it_iter = iterator_next(hash_set_begin(phset));
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 2);
+    n_last = *(int*)iterator_get_pointer(it_iter);
+    assert_true(n_last == 1 || n_last == 2);
     it_iter = iterator_prev(it_iter);
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 1);
+    assert_true(*(int*)iterator_get_pointer(it_iter) == 3 - n_last);
     hash_set_destroy(phset);
 }
 
@@ -1131,14 +1141,16 @@ void test_iterator_prev__hash_multiset(void** state)
 {
     hash_multiset_t* phmset = create_hash_multiset(int);
     iterator_t it_iter;
+    int n_last = 0;
 
     hash_multiset_init(phmset);
     hash_multiset_insert(phmset, 1);
     hash_multiset_insert(phmset, 2);
     it_iter = iterator_next(hash_multiset_begin(phmset));
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 2);
+    n_last = *(int*)iterator_get_pointer(it_iter);
+    assert_true(n_last == 1 || n_last == 2);
     it_iter = iterator_prev(it_iter);
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 1);
+    assert_true(*(int*)iterator_get_pointer(it_iter) == 3 - n_last);
     hash_multiset_destroy(phmset);
 }
 
@@ -1156,6 +1168,7 @@ void test_iterator_prev__hash_map(void** state)
     hash_map_t* phmap = create_hash_map(int, int);
     pair_t* ppair = create_pair(int, int);
     iterator_t it_iter;
+    int n_first = 0;
 
     hash_map_init(phmap);
     pair_init(ppair);
@@ -1164,9 +1177,10 @@ void test_iterator_prev__hash_map(void** state)
     pair_make(ppair, 1, 1);
     hash_map_insert(phmap, ppair);
     it_iter = iterator_next(hash_map_begin(phmap));
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 1);
+    n_first = *(int*)pair_first((pair_t*)iterator_get_pointer(it_iter));
+    assert_true(n_first == 0 || n_first == 1);
     it_iter = iterator_prev(it_iter);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 0);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 1 - n_first);
     pair_destroy(ppair);
     hash_map_destroy(phmap);
 }
@@ -1185,6 +1199,7 @@ void test_iterator_prev__hash_multimap(void** state)
     hash_multimap_t* phmap = create_hash_multimap(int, int);
     pair_t* ppair = create_pair(int, int);
     iterator_t it_iter;
+    int n_first = 0;
 
     hash_multimap_init(phmap);
     pair_init(ppair);
@@ -1193,9 +1208,10 @@ void test_iterator_prev__hash_multimap(void** state)
     pair_make(ppair, 1, 1);
     hash_multimap_insert(phmap, ppair);
     it_iter = iterator_next(hash_multimap_begin(phmap));
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 1);
+    n_first = *(int*)pair_first((pair_t*)iterator_get_pointer(it_iter));
+    assert_true(n_first == 0 || n_first == 1);
     it_iter = iterator_prev(it_iter);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 0);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 1 - n_first);
     pair_destroy(ppair);
     hash_multimap_destroy(phmap);
 }
@@ -1530,7 +1546,7 @@ void test_iterator_next_n__hash_set(void** state)
     hash_set_insert(phset, 1);
     hash_set_insert(phset, 2);
     it_iter = hash_set_begin(phset);
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 1);
+    assert_true(*(int*)iterator_get_pointer(it_iter) == 1 || *(int*)iterator_get_pointer(it_iter) == 2);
     expect_assert_failure(iterator_next_n(it_iter, 1));
     hash_set_destroy(phset);
 }
@@ -1544,7 +1560,7 @@ void test_iterator_next_n__hash_multiset(void** state)
     hash_multiset_insert(phmset, 1);
     hash_multiset_insert(phmset, 2);
     it_iter = hash_multiset_begin(phmset);
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 1);
+    assert_true(*(int*)iterator_get_pointer(it_iter) == 1 || *(int*)iterator_get_pointer(it_iter) == 2);
     expect_assert_failure(iterator_next_n(it_iter, 1));
     hash_multiset_destroy(phmset);
 }
@@ -1562,7 +1578,7 @@ void test_iterator_next_n__hash_map(void** state)
     pair_make(ppair, 1, 1);
     hash_map_insert(phmap, ppair);
     it_iter = hash_map_begin(phmap);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 0);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 0 || *(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 1);
     expect_assert_failure(iterator_next_n(it_iter, 1));
     pair_destroy(ppair);
     hash_map_destroy(phmap);
@@ -1581,7 +1597,7 @@ void test_iterator_next_n__hash_multimap(void** state)
     pair_make(ppair, 1, 1);
     hash_multimap_insert(phmap, ppair);
     it_iter = hash_multimap_begin(phmap);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 0);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 0 || *(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 1);
     expect_assert_failure(iterator_next_n(it_iter, 1));
     pair_destroy(ppair);
     hash_multimap_destroy(phmap);
@@ -1949,7 +1965,7 @@ void test_iterator_prev_n__hash_set(void** state)
     hash_set_insert(phset, 1);
     hash_set_insert(phset, 2);
     it_iter = hash_set_begin(phset);
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 1);
+    assert_true(*(int*)iterator_get_pointer(it_iter) == 1 || *(int*)iterator_get_pointer(it_iter) == 2);
     expect_assert_failure(iterator_prev_n(it_iter, -1));
     hash_set_destroy(phset);
 }
@@ -1963,7 +1979,7 @@ void test_iterator_prev_n__hash_multiset(void** state)
     hash_multiset_insert(phmset, 1);
     hash_multiset_insert(phmset, 2);
     it_iter = hash_multiset_begin(phmset);
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 1);
+    assert_true(*(int*)iterator_get_pointer(it_iter) == 1 || *(int*)iterator_get_pointer(it_iter) == 2);
     expect_assert_failure(iterator_prev_n(it_iter, -1));
     hash_multiset_destroy(phmset);
 }
@@ -1981,7 +1997,7 @@ void test_iterator_prev_n__hash_map(void** state)
     pair_make(ppair, 1, 1);
     hash_map_insert(phmap, ppair);
     it_iter = hash_map_begin(phmap);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 0);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 0 || *(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 1);
     expect_assert_failure(iterator_prev_n(it_iter, -1));
     pair_destroy(ppair);
     hash_map_destroy(phmap);
@@ -2000,7 +2016,7 @@ void test_iterator_prev_n__hash_multimap(void** state)
     pair_make(ppair, 1, 1);
     hash_multimap_insert(phmap, ppair);
     it_iter = hash_multimap_begin(phmap);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 0);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 0 || *(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 1);
     expect_assert_failure(iterator_prev_n(it_iter, -1));
     pair_destroy(ppair);
     hash_multimap_destroy(phmap);
@@ -6044,14 +6060,15 @@ void test_iterator_advance__hash_set_0(void** state)
 {
     hash_set_t* phset = create_hash_set(int);
     iterator_t it_iter;
+    int n_first = 0;
 
     hash_set_init(phset);
     hash_set_insert(phset, 1);
     hash_set_insert(phset, 2);
     it_iter = hash_set_begin(phset);
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 1);
+    n_first = *(int*)iterator_get_pointer(it_iter);
     it_iter = iterator_advance(it_iter, 0);
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 1);
+    assert_true(*(int*)iterator_get_pointer(it_iter) == n_first);
     hash_set_destroy(phset);
 }
 
@@ -6059,6 +6076,7 @@ void test_iterator_advance__hash_set_n(void** state)
 {
     hash_set_t* phset = create_hash_set(int);
     iterator_t it_iter;
+    iterator_t it_expect;
     int i = 0;
 
     hash_set_init(phset);
@@ -6067,9 +6085,14 @@ void test_iterator_advance__hash_set_n(void** state)
         hash_set_insert(phset, i);
     }
     it_iter = hash_set_begin(phset);
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 0);
+    it_expect = it_iter;
+    for(i = 0; i < 5; ++i)
+    {
+        it_expect = iterator_next(it_expect);
+    }
     it_iter = iterator_advance(it_iter, 5);
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 5);
+    assert_true(iterator_equal(it_iter, it_expect));
+    assert_true(*(int*)iterator_get_pointer(it_iter) == *(int*)iterator_get_pointer(it_expect));
     hash_set_destroy(phset);
 }
 
@@ -6077,6 +6100,7 @@ void test_iterator_advance__hash_set_n_(void** state)
 {
     hash_set_t* phset = create_hash_set(int);
     iterator_t it_iter;
+    iterator_t it_expect;
     int i = 0;
 
     hash_set_init(phset);
@@ -6085,9 +6109,14 @@ void test_iterator_advance__hash_set_n_(void** state)
         hash_set_insert(phset, i);
     }
     it_iter = iterator_prev(hash_set_end(phset));
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 9);
+    it_expect = it_iter;
+    for(i = 0; i < 5; ++i)
+    {
+        it_expect = iterator_prev(it_expect);
+    }
     it_iter = iterator_advance(it_iter, -5);
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 4);
+    assert_true(iterator_equal(it_iter, it_expect));
+    assert_true(*(int*)iterator_get_pointer(it_iter) == *(int*)iterator_get_pointer(it_expect));
     hash_set_destroy(phset);
 }
 
@@ -6103,7 +6132,7 @@ void test_iterator_advance__hash_set_end_n(void** state)
         hash_set_insert(phset, i);
     }
     it_iter = hash_set_begin(phset);
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 0);
+    assert_true(*(int*)iterator_get_pointer(it_iter) >= 0 && *(int*)iterator_get_pointer(it_iter) < 10);
     expect_assert_failure(iterator_advance(it_iter, 35));
     hash_set_destroy(phset);
 }
@@ -6120,7 +6149,7 @@ void test_iterator_advance__hash_set_prev_n(void** state)
         hash_set_insert(phset, i);
     }
     it_iter = iterator_prev(hash_set_end(phset));
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 9);
+    assert_true(*(int*)iterator_get_pointer(it_iter) >= 0 && *(int*)iterator_get_pointer(it_iter) < 10);
     expect_assert_failure(iterator_advance(it_iter, -35));
     hash_set_destroy(phset);
 }
@@ -6129,14 +6158,15 @@ void test_iterator_advance__hash_multiset_0(void** state)
 {
     hash_multiset_t* phmset = create_hash_multiset(int);
     iterator_t it_iter;
+    int n_first = 0;
 
     hash_multiset_init(phmset);
     hash_multiset_insert(phmset, 1);
     hash_multiset_insert(phmset, 2);
     it_iter = hash_multiset_begin(phmset);
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 1);
+    n_first = *(int*)iterator_get_pointer(it_iter);
     it_iter = iterator_advance(it_iter, 0);
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 1);
+    assert_true(*(int*)iterator_get_pointer(it_iter) == n_first);
     hash_multiset_destroy(phmset);
 }
 
@@ -6144,6 +6174,7 @@ void test_iterator_advance__hash_multiset_n(void** state)
 {
     hash_multiset_t* phmset = create_hash_multiset(int);
     iterator_t it_iter;
+    iterator_t it_expect;
     int i = 0;
 
     hash_multiset_init(phmset);
@@ -6152,9 +6183,14 @@ void test_iterator_advance__hash_multiset_n(void** state)
         hash_multiset_insert(phmset, i);
     }
     it_iter = hash_multiset_begin(phmset);
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 0);
+    it_expect = it_iter;
+    for(i = 0; i < 5; ++i)
+    {
+        it_expect = iterator_next(it_expect);
+    }
     it_iter = iterator_advance(it_iter, 5);
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 5);
+    assert_true(iterator_equal(it_iter, it_expect));
+    assert_true(*(int*)iterator_get_pointer(it_iter) == *(int*)iterator_get_pointer(it_expect));
     hash_multiset_destroy(phmset);
 }
 
@@ -6162,6 +6198,7 @@ void test_iterator_advance__hash_multiset_n_(void** state)
 {
     hash_multiset_t* phmset = create_hash_multiset(int);
     iterator_t it_iter;
+    iterator_t it_expect;
     int i = 0;
 
     hash_multiset_init(phmset);
@@ -6170,9 +6207,14 @@ void test_iterator_advance__hash_multiset_n_(void** state)
         hash_multiset_insert(phmset, i);
     }
     it_iter = iterator_prev(hash_multiset_end(phmset));
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 9);
+    it_expect = it_iter;
+    for(i = 0; i < 5; ++i)
+    {
+        it_expect = iterator_prev(it_expect);
+    }
     it_iter = iterator_advance(it_iter, -5);
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 4);
+    assert_true(iterator_equal(it_iter, it_expect));
+    assert_true(*(int*)iterator_get_pointer(it_iter) == *(int*)iterator_get_pointer(it_expect));
     hash_multiset_destroy(phmset);
 }
 
@@ -6188,7 +6230,7 @@ void test_iterator_advance__hash_multiset_end_n(void** state)
         hash_multiset_insert(phmset, i);
     }
     it_iter = hash_multiset_begin(phmset);
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 0);
+    assert_true(*(int*)iterator_get_pointer(it_iter) >= 0 && *(int*)iterator_get_pointer(it_iter) < 10);
     expect_assert_failure(iterator_advance(it_iter, 53));
     hash_multiset_destroy(phmset);
 }
@@ -6205,7 +6247,7 @@ void test_iterator_advance__hash_multiset_prev_n(void** state)
         hash_multiset_insert(phmset, i);
     }
     it_iter = iterator_prev(hash_multiset_end(phmset));
-    assert_true(*(int*)iterator_get_pointer(it_iter) == 9);
+    assert_true(*(int*)iterator_get_pointer(it_iter) >= 0 && *(int*)iterator_get_pointer(it_iter) < 10);
     expect_assert_failure(iterator_advance(it_iter, -53));
     hash_multiset_destroy(phmset);
 }
@@ -6215,6 +6257,7 @@ void test_iterator_advance__hash_map_0(void** state)
     hash_map_t* phmap = create_hash_map(int, int);
     pair_t* ppair = create_pair(int, int);
     iterator_t it_iter;
+    int n_first = 0;
 
     hash_map_init(phmap);
     pair_init(ppair);
@@ -6223,9 +6266,9 @@ void test_iterator_advance__hash_map_0(void** state)
     pair_make(ppair, 1, 1);
     hash_map_insert(phmap, ppair);
     it_iter = hash_map_begin(phmap);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 0);
+    n_first = *(int*)pair_first((pair_t*)iterator_get_pointer(it_iter));
     it_iter = iterator_advance(it_iter, 0);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 0);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == n_first);
     pair_destroy(ppair);
     hash_map_destroy(phmap);
 }
@@ -6235,6 +6278,7 @@ void test_iterator_advance__hash_map_n(void** state)
     hash_map_t* phmap = create_hash_map(int, int);
     pair_t* ppair = create_pair(int, int);
     iterator_t it_iter;
+    iterator_t it_expect;
     int i = 0;
 
     hash_map_init(phmap);
@@ -6245,9 +6289,14 @@ void test_iterator_advance__hash_map_n(void** state)
         hash_map_insert(phmap, ppair);
     }
     it_iter = hash_map_begin(phmap);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 0);
+    it_expect = it_iter;
+    for(i = 0; i < 5; ++i)
+    {
+        it_expect = iterator_next(it_expect);
+    }
     it_iter = iterator_advance(it_iter, 5);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 5);
+    assert_true(iterator_equal(it_iter, it_expect));
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == *(int*)pair_first((pair_t*)iterator_get_pointer(it_expect)));
     pair_destroy(ppair);
     hash_map_destroy(phmap);
 }
@@ -6257,6 +6306,7 @@ void test_iterator_advance__hash_map_n_(void** state)
     hash_map_t* phmap = create_hash_map(int, int);
     pair_t* ppair = create_pair(int, int);
     iterator_t it_iter;
+    iterator_t it_expect;
     int i = 0;
 
     hash_map_init(phmap);
@@ -6267,9 +6317,14 @@ void test_iterator_advance__hash_map_n_(void** state)
         hash_map_insert(phmap, ppair);
     }
     it_iter = iterator_prev(hash_map_end(phmap));
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 9);
+    it_expect = it_iter;
+    for(i = 0; i < 5; ++i)
+    {
+        it_expect = iterator_prev(it_expect);
+    }
     it_iter = iterator_advance(it_iter, -5);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 4);
+    assert_true(iterator_equal(it_iter, it_expect));
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == *(int*)pair_first((pair_t*)iterator_get_pointer(it_expect)));
     pair_destroy(ppair);
     hash_map_destroy(phmap);
 }
@@ -6289,7 +6344,7 @@ void test_iterator_advance__hash_map_end_n(void** state)
         hash_map_insert(phmap, ppair);
     }
     it_iter = hash_map_begin(phmap);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 0);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) >= 0 && *(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) < 10);
     expect_assert_failure(iterator_advance(it_iter, 53));
     pair_destroy(ppair);
     hash_map_destroy(phmap);
@@ -6310,7 +6365,7 @@ void test_iterator_advance__hash_map_prev_n(void** state)
         hash_map_insert(phmap, ppair);
     }
     it_iter = iterator_prev(hash_map_end(phmap));
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 9);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) >= 0 && *(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) < 10);
     expect_assert_failure(iterator_advance(it_iter, -53));
     pair_destroy(ppair);
     hash_map_destroy(phmap);
@@ -6321,6 +6376,7 @@ void test_iterator_advance__hash_multimap_0(void** state)
     hash_multimap_t* phmap = create_hash_multimap(int, int);
     pair_t* ppair = create_pair(int, int);
     iterator_t it_iter;
+    int n_first = 0;
 
     hash_multimap_init(phmap);
     pair_init(ppair);
@@ -6329,9 +6385,9 @@ void test_iterator_advance__hash_multimap_0(void** state)
     pair_make(ppair, 1, 1);
     hash_multimap_insert(phmap, ppair);
     it_iter = hash_multimap_begin(phmap);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 0);
+    n_first = *(int*)pair_first((pair_t*)iterator_get_pointer(it_iter));
     it_iter = iterator_advance(it_iter, 0);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 0);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == n_first);
     pair_destroy(ppair);
     hash_multimap_destroy(phmap);
 }
@@ -6341,6 +6397,7 @@ void test_iterator_advance__hash_multimap_n(void** state)
     hash_multimap_t* phmap = create_hash_multimap(int, int);
     pair_t* ppair = create_pair(int, int);
     iterator_t it_iter;
+    iterator_t it_expect;
     int i = 0;
 
     hash_multimap_init(phmap);
@@ -6351,9 +6408,14 @@ void test_iterator_advance__hash_multimap_n(void** state)
         hash_multimap_insert(phmap, ppair);
     }
     it_iter = hash_multimap_begin(phmap);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 0);
+    it_expect = it_iter;
+    for(i = 0; i < 5; ++i)
+    {
+        it_expect = iterator_next(it_expect);
+    }
     it_iter = iterator_advance(it_iter, 5);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 5);
+    assert_true(iterator_equal(it_iter, it_expect));
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == *(int*)pair_first((pair_t*)iterator_get_pointer(it_expect)));
     pair_destroy(ppair);
     hash_multimap_destroy(phmap);
 }
@@ -6363,6 +6425,7 @@ void test_iterator_advance__hash_multimap_n_(void** state)
     hash_multimap_t* phmap = create_hash_multimap(int, int);
     pair_t* ppair = create_pair(int, int);
     iterator_t it_iter;
+    iterator_t it_expect;
     int i = 0;
 
     hash_multimap_init(phmap);
@@ -6373,9 +6436,14 @@ void test_iterator_advance__hash_multimap_n_(void** state)
         hash_multimap_insert(phmap, ppair);
     }
     it_iter = iterator_prev(hash_multimap_end(phmap));
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 9);
+    it_expect = it_iter;
+    for(i = 0; i < 5; ++i)
+    {
+        it_expect = iterator_prev(it_expect);
+    }
     it_iter = iterator_advance(it_iter, -5);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 4);
+    assert_true(iterator_equal(it_iter, it_expect));
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == *(int*)pair_first((pair_t*)iterator_get_pointer(it_expect)));
     pair_destroy(ppair);
     hash_multimap_destroy(phmap);
 }
@@ -6395,7 +6463,7 @@ void test_iterator_advance__hash_multimap_end_n(void** state)
         hash_multimap_insert(phmap, ppair);
     }
     it_iter = hash_multimap_begin(phmap);
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 0);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) >= 0 && *(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) < 10);
     expect_assert_failure(iterator_advance(it_iter, 35));
     pair_destroy(ppair);
     hash_multimap_destroy(phmap);
@@ -6416,7 +6484,7 @@ void test_iterator_advance__hash_multimap_prev_n(void** state)
         hash_multimap_insert(phmap, ppair);
     }
     it_iter = iterator_prev(hash_multimap_end(phmap));
-    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 9);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) >= 0 && *(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) < 10);
     expect_assert_failure(iterator_advance(it_iter, -25));
     pair_destroy(ppair);
     hash_multimap_destroy(phmap);
@@ -16,6 +16,7 @@
 #include "cstl/cstring.h"
 #include "cstl/cfunctional.h"
 #include "cstl_list_aux.h"
+#include "cstl_types_aux.h"
 
 #include "ut_def.h"
 #include "ut_cstl_iterator_private.h"
@@ -1443,6 +1444,54 @@ void test__iterator_get_typebasename__user_define(void** state)
     vector_destroy(pvec);
 }
 
+/*
+ * test _iterator_get_typeid
+ */
+UT_CASE_DEFINATION(_iterator_get_typeid)
+void test__iterator_get_typeid__invalid(void** state)
+{
+    iterator_t it_iter;
+    it_iter._t_containertype = _VECTOR_CONTAINER;
+    it_iter._t_iteratortype = 899;
+    expect_assert_failure(_iterator_get_typeid(it_iter));
+}
+
+void test__iterator_get_typeid__c_builtin(void** state)
+{
+    vector_t* pvec = create_vector(char*);
+    vector_iterator_t it_iter;
+
+    vector_init(pvec);
+    it_iter = vector_begin(pvec);
+    assert_true(_iterator_get_typeid(it_iter) == _TYPE_ID_C_STRING);
+    vector_destroy(pvec);
+}
+
+void test__iterator_get_typeid__libcstl_builtin(void** state)
+{
+    vector_t* pvec = create_vector(list_t<int>);
+    vector_iterator_t it_iter;
+
+    vector_init(pvec);
+    it_iter = vector_begin(pvec);
+    assert_true(_iterator_get_typeid(it_iter) == _TYPE_ID_LIST);
+    vector_destroy(pvec);
+}
+
+void test__iterator_get_typeid__user_define(void** state)
+{
+    vector_t* pvec = NULL;
+    vector_iterator_t it_iter;
+
+    type_duplicate(abc_t, struct _tagabc);
+    pvec = create_vector(struct _tagabc);
+    vector_init(pvec);
+    it_iter = vector_begin(pvec);
+    assert_true(_iterator_get_typeid(it_iter) >= _TYPE_ID_USER_DEFINE);
+    assert_true(_iterator_get_typeid(it_iter) == _type_is_registered("abc_t")->_t_typeid);
+    vector_destroy(pvec);
+}
+
 /*
  * test _iterator_get_typename
  */
@@ -154,6 +154,14 @@ void test__iterator_get_typebasename__invalid(void** state);
 void test__iterator_get_typebasename__c_builtin(void** state);
 void test__iterator_get_typebasename__libcstl_builtin(void** state);
 void test__iterator_get_typebasename__user_define(void** state);
+/*
+ * test _iterator_get_typeid
+ */
+UT_CASE_DECLARATION(_iterator_get_typeid)
+void test__iterator_get_typeid__invalid(void** state);
+void test__iterator_get_typeid__c_builtin(void** state);
+void test__iterator_get_typeid__libcstl_builtin(void** state);
+void test__iterator_get_typeid__user_define(void** state);
 /*
  * test _iterator_get_typename
  */
@@ -355,6 +363,10 @@ void test__iterator_allocate_init_elem__iterator_deallocate_destroy_elem__string
     UT_CASE(test__iterator_get_typebasename__c_builtin),\
     UT_CASE(test__iterator_get_typebasename__libcstl_builtin),\
     UT_CASE(test__iterator_get_typebasename__user_define),\
+    UT_CASE_BEGIN(_iterator_get_typeid, test__iterator_get_typeid__invalid),\
+    UT_CASE(test__iterator_get_typeid__c_builtin),\
+    UT_CASE(test__iterator_get_typeid__libcstl_builtin),\
+    UT_CASE(test__iterator_get_typeid__user_define),\
     UT_CASE_BEGIN(_iterator_get_typename, test__iterator_get_typename__invalid),\
     UT_CASE(test__iterator_get_typename__c_builtin),\
     UT_CASE(test__iterator_get_typename__libcstl_builtin),\
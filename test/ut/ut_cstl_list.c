@@ -878,6 +878,50 @@ void test_list_max_size__non_empty(void** state)
     list_destroy(plist);
 }
 
+/*
+ * test list_memory_usage
+ */
+UT_CASE_DEFINATION(list_memory_usage)
+void test_list_memory_usage__null_list_container(void** state)
+{
+    expect_assert_failure(list_memory_usage(NULL));
+}
+
+void test_list_memory_usage__non_inited_list_container(void** state)
+{
+    list_t* plist = create_list(int);
+
+    expect_assert_failure(list_memory_usage(plist));
+
+    list_destroy(plist);
+}
+
+void test_list_memory_usage__empty(void** state)
+{
+    list_t* plist = create_list(int);
+
+    list_init(plist);
+    assert_true(list_memory_usage(plist) >= sizeof(list_t));
+
+    list_destroy(plist);
+}
+
+void test_list_memory_usage__non_empty(void** state)
+{
+    list_t* plist = create_list(int);
+    size_t t_usage = 0;
+    int i = 0;
+
+    list_init(plist);
+    t_usage = list_memory_usage(plist);
+    for (i = 0; i < 100; ++i) {
+        list_push_back(plist, i);
+    }
+    assert_true(list_memory_usage(plist) >= t_usage + 100 * sizeof(int));
+
+    list_destroy(plist);
+}
+
 /*
  * test list_equal
  */
@@ -4983,7 +5027,7 @@ void test_list_splice__not_same_type(void** state)
 
 void test_list_splice__invalid_target_position(void** state)
 {
-    list_iterator_t it_iter;
+    list_iterator_t it_iter = _create_list_iterator();
     list_t* plist_list = create_list(int);
     list_t* plist_src = create_list(int);
 
@@ -5219,7 +5263,7 @@ void test_list_splice_pos__not_same(void** state)
 
 void test_list_splice_pos__invalid_tearget_position(void** state)
 {
-    list_iterator_t it_iter;
+    list_iterator_t it_iter = _create_list_iterator();
     list_t* plist_list = create_list(int);
     list_t* plist_src = create_list(int);
 
@@ -5233,7 +5277,7 @@ void test_list_splice_pos__invalid_tearget_position(void** state)
 
 void test_list_splice_pos__invalid_source_position(void** state)
 {
-    list_iterator_t it_iter;
+    list_iterator_t it_iter = _create_list_iterator();
     list_t* plist_list = create_list(int);
     list_t* plist_src = create_list(int);
 
@@ -5471,7 +5515,7 @@ void test_list_splice_range__not_same(void** state)
 
 void test_list_splice_range__invalid_tearget_position(void** state)
 {
-    list_iterator_t it_iter;
+    list_iterator_t it_iter = _create_list_iterator();
     list_t* plist_list = create_list(int);
     list_t* plist_src = create_list(int);
 
@@ -8175,3 +8219,115 @@ void test_list_reverse__not_same(void** state)
     list_destroy(plist);
 }
 
+/*
+ * test list_push_back_ptr
+ */
+UT_CASE_DEFINATION(list_push_back_ptr)
+void test_list_push_back_ptr__null_list(void** state)
+{
+    int elem = 9;
+
+    expect_assert_failure(list_push_back_ptr(NULL, &elem));
+}
+
+void test_list_push_back_ptr__c_builtin(void** state)
+{
+    list_t* pt_list = create_list(int);
+    int elem;
+    int i;
+
+    list_init(pt_list);
+    for (i = 0; i < 100; ++i) {
+        elem = i;
+        list_push_back_ptr(pt_list, &elem);
+        assert_true(*(int*)list_back(pt_list) == i);
+    }
+    assert_true(list_size(pt_list) == 100);
+
+    list_destroy(pt_list);
+}
+
+void test_list_push_back_ptr__cstr(void** state)
+{
+    list_t* pt_list = create_list(char*);
+
+    list_init(pt_list);
+    list_push_back_ptr(pt_list, "abc");
+    list_push_back_ptr(pt_list, "defg");
+    assert_true(strcmp((char*)list_back(pt_list), "defg") == 0);
+    assert_true(list_size(pt_list) == 2);
+
+    list_destroy(pt_list);
+}
+
+void test_list_push_back_ptr__libcstl_builtin(void** state)
+{
+    list_t* pt_list = create_list(list_t<int>);
+    list_t* plist_list = create_list(int);
+
+    list_init(pt_list);
+    list_init_n(plist_list, 5);
+    list_push_back_ptr(pt_list, plist_list);
+    assert_true(list_equal((list_t*)list_back(pt_list), plist_list));
+    assert_true((list_t*)list_back(pt_list) != plist_list);
+
+    list_destroy(pt_list);
+    list_destroy(plist_list);
+}
+
+/*
+ * test list_push_front_ptr
+ */
+UT_CASE_DEFINATION(list_push_front_ptr)
+void test_list_push_front_ptr__null_list(void** state)
+{
+    int elem = 9;
+
+    expect_assert_failure(list_push_front_ptr(NULL, &elem));
+}
+
+void test_list_push_front_ptr__c_builtin(void** state)
+{
+    list_t* pt_list = create_list(int);
+    int elem;
+    int i;
+
+    list_init(pt_list);
+    for (i = 0; i < 100; ++i) {
+        elem = i;
+        list_push_front_ptr(pt_list, &elem);
+        assert_true(*(int*)list_front(pt_list) == i);
+    }
+    assert_true(list_size(pt_list) == 100);
+
+    list_destroy(pt_list);
+}
+
+void test_list_push_front_ptr__cstr(void** state)
+{
+    list_t* pt_list = create_list(char*);
+
+    list_init(pt_list);
+    list_push_front_ptr(pt_list, "abc");
+    list_push_front_ptr(pt_list, "defg");
+    assert_true(strcmp((char*)list_front(pt_list), "defg") == 0);
+    assert_true(list_size(pt_list) == 2);
+
+    list_destroy(pt_list);
+}
+
+void test_list_push_front_ptr__libcstl_builtin(void** state)
+{
+    list_t* pt_list = create_list(list_t<int>);
+    list_t* plist_list = create_list(int);
+
+    list_init(pt_list);
+    list_init_n(plist_list, 5);
+    list_push_front_ptr(pt_list, plist_list);
+    assert_true(list_equal((list_t*)list_front(pt_list), plist_list));
+    assert_true((list_t*)list_front(pt_list) != plist_list);
+
+    list_destroy(pt_list);
+    list_destroy(plist_list);
+}
+
@@ -95,6 +95,14 @@ void test_list_max_size__null_list_container(void** state);
 void test_list_max_size__non_inited_list_container(void** state);
 void test_list_max_size__empty(void** state);
 void test_list_max_size__non_empty(void** state);
+/*
+ * test list_memory_usage
+ */
+UT_CASE_DECLARATION(list_memory_usage)
+void test_list_memory_usage__null_list_container(void** state);
+void test_list_memory_usage__non_inited_list_container(void** state);
+void test_list_memory_usage__empty(void** state);
+void test_list_memory_usage__non_empty(void** state);
 /*
  * test list_equal
  */
@@ -604,6 +612,22 @@ void test_list_reverse__empty(void** state);
 void test_list_reverse__same(void** state);
 void test_list_reverse__not_same(void** state);
 
+/*
+ * test list_push_back_ptr
+ */
+UT_CASE_DECLARATION(list_push_back_ptr)
+void test_list_push_back_ptr__null_list(void** state);
+void test_list_push_back_ptr__c_builtin(void** state);
+void test_list_push_back_ptr__cstr(void** state);
+void test_list_push_back_ptr__libcstl_builtin(void** state);
+/*
+ * test list_push_front_ptr
+ */
+UT_CASE_DECLARATION(list_push_front_ptr)
+void test_list_push_front_ptr__null_list(void** state);
+void test_list_push_front_ptr__c_builtin(void** state);
+void test_list_push_front_ptr__cstr(void** state);
+void test_list_push_front_ptr__libcstl_builtin(void** state);
 #define UT_CSTL_LIST_CASE\
     UT_SUIT_BEGIN(cstl_list, test_list_init__null_list_container),\
     UT_CASE(test_list_init__non_created_list_container),\
@@ -661,6 +685,10 @@ void test_list_reverse__not_same(void** state);
     UT_CASE(test_list_max_size__non_inited_list_container),\
     UT_CASE(test_list_max_size__empty),\
     UT_CASE(test_list_max_size__non_empty),\
+    UT_CASE_BEGIN(list_memory_usage, test_list_memory_usage__null_list_container),\
+    UT_CASE(test_list_memory_usage__non_inited_list_container),\
+    UT_CASE(test_list_memory_usage__empty),\
+    UT_CASE(test_list_memory_usage__non_empty),\
     UT_CASE_BEGIN(list_equal, test_list_equal__null_first),\
     UT_CASE(test_list_equal__null_second),\
     UT_CASE(test_list_equal__non_inited_first),\
@@ -1036,7 +1064,15 @@ void test_list_reverse__not_same(void** state);
     UT_CASE(test_list_reverse__non_inited_list_container),\
     UT_CASE(test_list_reverse__empty),\
     UT_CASE(test_list_reverse__same),\
-    UT_CASE(test_list_reverse__not_same)
+    UT_CASE(test_list_reverse__not_same),\
+    UT_CASE_BEGIN(list_push_back_ptr, test_list_push_back_ptr__null_list),\
+    UT_CASE(test_list_push_back_ptr__c_builtin),\
+    UT_CASE(test_list_push_back_ptr__cstr),\
+    UT_CASE(test_list_push_back_ptr__libcstl_builtin),\
+    UT_CASE_BEGIN(list_push_front_ptr, test_list_push_front_ptr__null_list),\
+    UT_CASE(test_list_push_front_ptr__c_builtin),\
+    UT_CASE(test_list_push_front_ptr__cstr),\
+    UT_CASE(test_list_push_front_ptr__libcstl_builtin)
 
 #endif /* _UT_CSTL_LIST_H_ */
 
@@ -77,6 +77,122 @@ void test__create_list__user_defined_type_dup(void** state)
     list_destroy(plist);
 }
 
+/*
+ * test _create_list_with_allocator
+ */
+UT_CASE_DEFINATION(_create_list_with_allocator)
+static void* _create_list_with_allocator__allocate(void* pv_context, size_t t_size)
+{
+    ((size_t*)pv_context)[0]++;
+    return malloc(t_size);
+}
+
+static void _create_list_with_allocator__deallocate(void* pv_context, void* pv_mem, size_t t_size)
+{
+    ((size_t*)pv_context)[1]++;
+    free(pv_mem);
+}
+
+void test__create_list_with_allocator__null_allocator(void** state)
+{
+    expect_assert_failure(_create_list_with_allocator(NULL, "int"));
+}
+
+void test__create_list_with_allocator__unregisted_type(void** state)
+{
+    size_t at_count[2] = {0, 0};
+    allocator_t t_allocator = {_create_list_with_allocator__allocate, _create_list_with_allocator__deallocate, NULL};
+
+    t_allocator._pv_context = at_count;
+    assert_true(_create_list_with_allocator(&t_allocator, "unregisted_type_t") == NULL);
+    assert_true(at_count[0] == 0 && at_count[1] == 0);
+}
+
+void test__create_list_with_allocator__allocate_by_allocator(void** state)
+{
+    size_t at_count[2] = {0, 0};
+    allocator_t t_allocator = {_create_list_with_allocator__allocate, _create_list_with_allocator__deallocate, NULL};
+    list_t* plist = NULL;
+    int i = 0;
+
+    t_allocator._pv_context = at_count;
+    plist = _create_list_with_allocator(&t_allocator, "int");
+    assert_true(plist != NULL);
+    list_init(plist);
+    for (i = 0; i < 100; ++i) {
+        list_push_back(plist, i);
+    }
+    assert_true(list_size(plist) == 100);
+    assert_true(at_count[0] > 0);
+
+    list_destroy(plist);
+    assert_true(at_count[0] == at_count[1]);
+}
+
+/*
+ * test _create_list_with_region
+ */
+UT_CASE_DEFINATION(_create_list_with_region)
+void test__create_list_with_region__null_typename(void** state)
+{
+    expect_assert_failure(_create_list_with_region(NULL));
+}
+
+void test__create_list_with_region__unregisted_type(void** state)
+{
+    assert_true(_create_list_with_region("unregisted_type_t") == NULL);
+}
+
+void test__create_list_with_region__successfully(void** state)
+{
+    list_t* plist = _create_list_with_region("int");
+    assert_true(plist != NULL);
+    assert_true(_alloc_is_region(&plist->_t_allocator));
+    list_destroy(plist);
+}
+
+void test__create_list_with_region__clear_and_destroy(void** state)
+{
+    list_t* plist = _create_list_with_region("int");
+    int i = 0;
+    int j = 0;
+
+    list_init(plist);
+    for (j = 0; j < 3; ++j) {
+        for (i = 0; i < 1000; ++i) {
+            list_push_back(plist, i);
+        }
+        assert_true(list_size(plist) == 1000);
+        list_clear(plist);
+        assert_true(list_empty(plist));
+        assert_true(list_size(plist) == 0);
+    }
+    for (i = 0; i < 100; ++i) {
+        list_push_back(plist, i);
+    }
+    assert_true(list_size(plist) == 100);
+    list_destroy(plist);
+}
+
+void test__create_list_with_region__non_trivial_type(void** state)
+{
+    list_t* plist = _create_list_with_region("char*");
+    int i = 0;
+
+    list_init(plist);
+    for (i = 0; i < 100; ++i) {
+        list_push_back(plist, "libcstl");
+    }
+    assert_true(list_size(plist) == 100);
+    list_clear(plist);
+    assert_true(list_empty(plist));
+    for (i = 0; i < 100; ++i) {
+        list_push_back(plist, "libcstl");
+    }
+    assert_true(list_size(plist) == 100);
+    list_destroy(plist);
+}
+
 /*
  * test _create_list_auxiliary
  */
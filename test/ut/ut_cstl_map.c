@@ -13,6 +13,7 @@
 #include "cstl_rb_tree_aux.h"
 #include "cstl_avl_tree_aux.h"
 #include "cstl_map_aux.h"
+#include "cstl_pair_aux.h"
 
 #include "ut_def.h"
 #include "ut_cstl_map.h"
@@ -1773,6 +1774,102 @@ void test_map_max_size__non_empty(void** state)
     pair_destroy(pt_pair);
 }
 
+/*
+ * test map_memory_usage
+ */
+UT_CASE_DEFINATION(map_memory_usage)
+void test_map_memory_usage__null_map(void** state)
+{
+    expect_assert_failure(map_memory_usage(NULL));
+}
+
+void test_map_memory_usage__non_inited(void** state)
+{
+    map_t* pt_map = create_map(int, int);
+    map_init_ex(pt_map, NULL);
+
+#ifdef CSTL_MAP_AVL_TREE
+    pt_map->_t_tree._t_avlroot._un_height = 9;
+    expect_assert_failure(map_memory_usage(pt_map));
+    pt_map->_t_tree._t_avlroot._un_height = 0;
+#else
+    pt_map->_t_tree._t_rbroot._t_color = _COLOR_BLACK;
+    expect_assert_failure(map_memory_usage(pt_map));
+    pt_map->_t_tree._t_rbroot._t_color = _COLOR_RED;
+#endif
+
+    map_destroy(pt_map);
+}
+
+void test_map_memory_usage__non_inited_pair(void** state)
+{
+    map_t* pt_map = create_map(int, int);
+    void* pv_tmp = NULL;
+    map_init_ex(pt_map, NULL);
+
+    pv_tmp = pt_map->_pair_temp._pv_first;
+    pt_map->_pair_temp._pv_first = NULL;
+    expect_assert_failure(map_memory_usage(pt_map));
+    pt_map->_pair_temp._pv_first = pv_tmp;
+
+    map_destroy(pt_map);
+}
+
+void test_map_memory_usage__empty(void** state)
+{
+    map_t* pt_map = create_map(int, int);
+    map_init_ex(pt_map, NULL);
+
+    assert_true(map_memory_usage(pt_map) >= sizeof(map_t));
+
+    map_destroy(pt_map);
+}
+
+void test_map_memory_usage__non_empty(void** state)
+{
+    map_t* pt_map = create_map(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    size_t t_usage = 0;
+    int i = 0;
+
+    map_init(pt_map);
+    pair_init(pt_pair);
+    t_usage = map_memory_usage(pt_map);
+    for (i = 0; i < 100; ++i) {
+        pair_make(pt_pair, i, i);
+        map_insert(pt_map, pt_pair);
+    }
+    assert_true(map_memory_usage(pt_map) >= t_usage + 100 * 2 * sizeof(int));
+
+    map_destroy(pt_map);
+    pair_destroy(pt_pair);
+}
+
+void test_map_memory_usage__inline_pair(void** state)
+{
+    map_t* pt_map = create_map(int, double);
+    pair_t* pt_pair = create_pair(int, double);
+    size_t t_usage = 0;
+    int i = 0;
+
+    map_init(pt_map);
+    pair_init(pt_pair);
+    for (i = 0; i < 100; ++i) {
+        pair_make(pt_pair, i, 1.5);
+        map_insert(pt_map, pt_pair);
+    }
+#ifdef CSTL_MAP_AVL_TREE
+    t_usage = _avl_tree_memory_usage(&pt_map->_t_tree);
+#else
+    t_usage = _rb_tree_memory_usage(&pt_map->_t_tree);
+#endif
+    /* the key and value in nodes are counted by tree, only the temporary pair is added */
+    assert_true(map_memory_usage(pt_map) == sizeof(map_t) + t_usage + _PAIR_STORAGE_SIZE(sizeof(int), sizeof(double)));
+
+    map_destroy(pt_map);
+    pair_destroy(pt_pair);
+}
+
 /*
  * test map_begin
  */
@@ -5901,3 +5998,291 @@ void test_map_erase_range__all(void** state)
     pair_destroy(pt_pair);
 }
 
+/*
+ * test map_find_ptr
+ */
+UT_CASE_DEFINATION(map_find_ptr)
+void test_map_find_ptr__null_map(void** state)
+{
+    int key = 9;
+
+    expect_assert_failure(map_find_ptr(NULL, &key));
+}
+
+void test_map_find_ptr__null_key(void** state)
+{
+    map_t* pt_map = create_map(int, int);
+
+    map_init(pt_map);
+    expect_assert_failure(map_find_ptr(pt_map, NULL));
+
+    map_destroy(pt_map);
+}
+
+void test_map_find_ptr__c_builtin(void** state)
+{
+    map_t* pt_map = create_map(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    map_iterator_t it_iter;
+    int key;
+    int i;
+
+    map_init(pt_map);
+    pair_init(pt_pair);
+    for (i = 0; i < 10; ++i) {
+        pair_make(pt_pair, i, i * 10);
+        map_insert(pt_map, pt_pair);
+    }
+
+    key = 4;
+    it_iter = map_find_ptr(pt_map, &key);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 4);
+    assert_true(*(int*)pair_second((pair_t*)iterator_get_pointer(it_iter)) == 40);
+    key = 42;
+    it_iter = map_find_ptr(pt_map, &key);
+    assert_true(iterator_equal(it_iter, map_end(pt_map)));
+
+    map_destroy(pt_map);
+    pair_destroy(pt_pair);
+}
+
+void test_map_find_ptr__cstr(void** state)
+{
+    map_t* pt_map = create_map(char*, int);
+    pair_t* pt_pair = create_pair(char*, int);
+    map_iterator_t it_iter;
+
+    map_init(pt_map);
+    pair_init(pt_pair);
+    pair_make(pt_pair, "abc", 1);
+    map_insert(pt_map, pt_pair);
+    pair_make(pt_pair, "def", 2);
+    map_insert(pt_map, pt_pair);
+
+    it_iter = map_find_ptr(pt_map, "def");
+    assert_true(*(int*)pair_second((pair_t*)iterator_get_pointer(it_iter)) == 2);
+    it_iter = map_find_ptr(pt_map, "xyz");
+    assert_true(iterator_equal(it_iter, map_end(pt_map)));
+
+    map_destroy(pt_map);
+    pair_destroy(pt_pair);
+}
+
+/*
+ * test map_count_ptr
+ */
+UT_CASE_DEFINATION(map_count_ptr)
+void test_map_count_ptr__null_map(void** state)
+{
+    int key = 9;
+
+    expect_assert_failure(map_count_ptr(NULL, &key));
+}
+
+void test_map_count_ptr__c_builtin(void** state)
+{
+    map_t* pt_map = create_map(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    int key;
+    int i;
+
+    map_init(pt_map);
+    pair_init(pt_pair);
+    for (i = 0; i < 10; ++i) {
+        pair_make(pt_pair, i, i * 10);
+        map_insert(pt_map, pt_pair);
+    }
+    pair_make(pt_pair, 3, 0);
+    map_insert(pt_map, pt_pair);
+
+    key = 3;
+    assert_true(map_count_ptr(pt_map, &key) == 1);
+    key = 42;
+    assert_true(map_count_ptr(pt_map, &key) == 0);
+
+    map_destroy(pt_map);
+    pair_destroy(pt_pair);
+}
+
+/*
+ * test map_find_batch
+ */
+UT_CASE_DEFINATION(map_find_batch)
+void test_map_find_batch__null_map(void** state)
+{
+    int an_key[1] = {9};
+    map_iterator_t at_iter[1];
+
+    expect_assert_failure(map_find_batch(NULL, an_key, 1, at_iter));
+}
+
+void test_map_find_batch__null_keys(void** state)
+{
+    map_t* pt_map = create_map(int, int);
+    map_iterator_t at_iter[1];
+
+    map_init(pt_map);
+    expect_assert_failure(map_find_batch(pt_map, NULL, 1, at_iter));
+
+    map_destroy(pt_map);
+}
+
+void test_map_find_batch__null_result(void** state)
+{
+    map_t* pt_map = create_map(int, int);
+    int an_key[1] = {9};
+
+    map_init(pt_map);
+    expect_assert_failure(map_find_batch(pt_map, an_key, 1, NULL));
+
+    map_destroy(pt_map);
+}
+
+void test_map_find_batch__c_builtin(void** state)
+{
+    map_t* pt_map = create_map(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    int an_key[100];
+    map_iterator_t at_iter[100];
+    int i;
+
+    map_init(pt_map);
+    pair_init(pt_pair);
+    for (i = 0; i < 100; i += 2) {
+        pair_make(pt_pair, i, i * 10);
+        map_insert(pt_map, pt_pair);
+    }
+    for (i = 0; i < 100; ++i) {
+        an_key[i] = 99 - i;
+    }
+
+    map_find_batch(pt_map, an_key, 100, at_iter);
+    for (i = 0; i < 100; ++i) {
+        if (an_key[i] % 2 == 0) {
+            assert_true(*(int*)pair_second((pair_t*)iterator_get_pointer(at_iter[i])) == an_key[i] * 10);
+            assert_true(iterator_equal(at_iter[i], map_find(pt_map, an_key[i])));
+        } else {
+            assert_true(iterator_equal(at_iter[i], map_end(pt_map)));
+        }
+    }
+
+    map_destroy(pt_map);
+    pair_destroy(pt_pair);
+}
+
+void test_map_find_batch__cstr(void** state)
+{
+    map_t* pt_map = create_map(char*, int);
+    pair_t* pt_pair = create_pair(char*, int);
+    const char* as_key[3] = {"def", "xyz", "abc"};
+    map_iterator_t at_iter[3];
+
+    map_init(pt_map);
+    pair_init(pt_pair);
+    pair_make(pt_pair, "abc", 1);
+    map_insert(pt_map, pt_pair);
+    pair_make(pt_pair, "def", 2);
+    map_insert(pt_map, pt_pair);
+
+    map_find_batch(pt_map, as_key, 3, at_iter);
+    assert_true(*(int*)pair_second((pair_t*)iterator_get_pointer(at_iter[0])) == 2);
+    assert_true(iterator_equal(at_iter[1], map_end(pt_map)));
+    assert_true(*(int*)pair_second((pair_t*)iterator_get_pointer(at_iter[2])) == 1);
+
+    map_destroy(pt_map);
+    pair_destroy(pt_pair);
+}
+
+/*
+ * test map_erase_ptr
+ */
+UT_CASE_DEFINATION(map_erase_ptr)
+void test_map_erase_ptr__null_map(void** state)
+{
+    int key = 9;
+
+    expect_assert_failure(map_erase_ptr(NULL, &key));
+}
+
+void test_map_erase_ptr__c_builtin(void** state)
+{
+    map_t* pt_map = create_map(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    int key;
+    int i;
+
+    map_init(pt_map);
+    pair_init(pt_pair);
+    for (i = 0; i < 10; ++i) {
+        pair_make(pt_pair, i, i * 10);
+        map_insert(pt_map, pt_pair);
+    }
+
+    key = 3;
+    assert_true(map_erase_ptr(pt_map, &key) == 1);
+    assert_true(map_size(pt_map) == 9);
+    assert_true(map_erase_ptr(pt_map, &key) == 0);
+
+    map_destroy(pt_map);
+    pair_destroy(pt_pair);
+}
+
+/*
+ * test map_at_ptr
+ */
+UT_CASE_DEFINATION(map_at_ptr)
+void test_map_at_ptr__null_map(void** state)
+{
+    int key = 9;
+
+    expect_assert_failure(map_at_ptr(NULL, &key));
+}
+
+void test_map_at_ptr__null_key(void** state)
+{
+    map_t* pt_map = create_map(int, int);
+
+    map_init(pt_map);
+    expect_assert_failure(map_at_ptr(pt_map, NULL));
+
+    map_destroy(pt_map);
+}
+
+void test_map_at_ptr__c_builtin(void** state)
+{
+    map_t* pt_map = create_map(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    int key;
+    int i;
+
+    map_init(pt_map);
+    pair_init(pt_pair);
+    for (i = 0; i < 10; ++i) {
+        pair_make(pt_pair, i, i * 10);
+        map_insert(pt_map, pt_pair);
+    }
+
+    key = 5;
+    assert_true(*(int*)map_at_ptr(pt_map, &key) == 50);
+    key = 100;
+    *(int*)map_at_ptr(pt_map, &key) = 1000;
+    assert_true(map_size(pt_map) == 11);
+    assert_true(*(int*)map_at(pt_map, 100) == 1000);
+
+    map_destroy(pt_map);
+    pair_destroy(pt_pair);
+}
+
+void test_map_at_ptr__cstr(void** state)
+{
+    map_t* pt_map = create_map(char*, int);
+
+    map_init(pt_map);
+    *(int*)map_at_ptr(pt_map, "key") = 3;
+    assert_true(*(int*)map_at(pt_map, "key") == 3);
+    assert_true(*(int*)map_at_ptr(pt_map, "key") == 3);
+    assert_true(map_size(pt_map) == 1);
+
+    map_destroy(pt_map);
+}
+
@@ -149,6 +149,16 @@ void test_map_max_size__non_inited(void** state);
 void test_map_max_size__non_inited_pair(void** state);
 void test_map_max_size__empty(void** state);
 void test_map_max_size__non_empty(void** state);
+/*
+ * test map_memory_usage
+ */
+UT_CASE_DECLARATION(map_memory_usage)
+void test_map_memory_usage__null_map(void** state);
+void test_map_memory_usage__non_inited(void** state);
+void test_map_memory_usage__non_inited_pair(void** state);
+void test_map_memory_usage__empty(void** state);
+void test_map_memory_usage__non_empty(void** state);
+void test_map_memory_usage__inline_pair(void** state);
 /*
  * test map_begin
  */
@@ -423,6 +433,43 @@ void test_map_erase_range__middle(void** state);
 void test_map_erase_range__end(void** state);
 void test_map_erase_range__all(void** state);
 
+/*
+ * test map_find_ptr
+ */
+UT_CASE_DECLARATION(map_find_ptr)
+void test_map_find_ptr__null_map(void** state);
+void test_map_find_ptr__null_key(void** state);
+void test_map_find_ptr__c_builtin(void** state);
+void test_map_find_ptr__cstr(void** state);
+/*
+ * test map_count_ptr
+ */
+UT_CASE_DECLARATION(map_count_ptr)
+void test_map_count_ptr__null_map(void** state);
+void test_map_count_ptr__c_builtin(void** state);
+/*
+ * test map_find_batch
+ */
+UT_CASE_DECLARATION(map_find_batch)
+void test_map_find_batch__null_map(void** state);
+void test_map_find_batch__null_keys(void** state);
+void test_map_find_batch__null_result(void** state);
+void test_map_find_batch__c_builtin(void** state);
+void test_map_find_batch__cstr(void** state);
+/*
+ * test map_erase_ptr
+ */
+UT_CASE_DECLARATION(map_erase_ptr)
+void test_map_erase_ptr__null_map(void** state);
+void test_map_erase_ptr__c_builtin(void** state);
+/*
+ * test map_at_ptr
+ */
+UT_CASE_DECLARATION(map_at_ptr)
+void test_map_at_ptr__null_map(void** state);
+void test_map_at_ptr__null_key(void** state);
+void test_map_at_ptr__c_builtin(void** state);
+void test_map_at_ptr__cstr(void** state);
 #define UT_CSTL_MAP_CASE\
     UT_SUIT_BEGIN(cstl_map, test_map_init__null_map),\
     UT_CASE(test_map_init__non_created),\
@@ -519,6 +566,12 @@ void test_map_erase_range__all(void** state);
     UT_CASE(test_map_max_size__non_inited_pair),\
     UT_CASE(test_map_max_size__empty),\
     UT_CASE(test_map_max_size__non_empty),\
+    UT_CASE_BEGIN(map_memory_usage, test_map_memory_usage__null_map),\
+    UT_CASE(test_map_memory_usage__non_inited),\
+    UT_CASE(test_map_memory_usage__non_inited_pair),\
+    UT_CASE(test_map_memory_usage__empty),\
+    UT_CASE(test_map_memory_usage__non_empty),\
+    UT_CASE(test_map_memory_usage__inline_pair),\
     UT_CASE_BEGIN(map_begin, test_map_begin__null_map),\
     UT_CASE(test_map_begin__non_inited),\
     UT_CASE(test_map_begin__non_inited_pair),\
@@ -717,7 +770,24 @@ void test_map_erase_range__all(void** state);
     UT_CASE(test_map_erase_range__begin),\
     UT_CASE(test_map_erase_range__middle),\
     UT_CASE(test_map_erase_range__end),\
-    UT_CASE(test_map_erase_range__all)
+    UT_CASE(test_map_erase_range__all),\
+    UT_CASE_BEGIN(map_find_ptr, test_map_find_ptr__null_map),\
+    UT_CASE(test_map_find_ptr__null_key),\
+    UT_CASE(test_map_find_ptr__c_builtin),\
+    UT_CASE(test_map_find_ptr__cstr),\
+    UT_CASE_BEGIN(map_count_ptr, test_map_count_ptr__null_map),\
+    UT_CASE(test_map_count_ptr__c_builtin),\
+    UT_CASE_BEGIN(map_find_batch, test_map_find_batch__null_map),\
+    UT_CASE(test_map_find_batch__null_keys),\
+    UT_CASE(test_map_find_batch__null_result),\
+    UT_CASE(test_map_find_batch__c_builtin),\
+    UT_CASE(test_map_find_batch__cstr),\
+    UT_CASE_BEGIN(map_erase_ptr, test_map_erase_ptr__null_map),\
+    UT_CASE(test_map_erase_ptr__c_builtin),\
+    UT_CASE_BEGIN(map_at_ptr, test_map_at_ptr__null_map),\
+    UT_CASE(test_map_at_ptr__null_key),\
+    UT_CASE(test_map_at_ptr__c_builtin),\
+    UT_CASE(test_map_at_ptr__cstr)
 
 #endif /* _UT_CSTL_MAP_H_ */
 
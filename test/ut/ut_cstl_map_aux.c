@@ -9,6 +9,9 @@
 #include "cstl/cstring.h"
 #include "cstl/cvector.h"
 #include "cstl_map_aux.h"
+#include "cstl_multimap_aux.h"
+#include "cstl_hash_map_aux.h"
+#include "cstl_hash_multimap_aux.h"
 
 #include "ut_def.h"
 #include "ut_cstl_map_aux.h"
@@ -411,3 +414,98 @@ void test__map_value_compare__user_mapkeycompare_result_false(void** state)
     pair_destroy(ppair_second);
 }
 
+/*
+ * test _map_key_three_way_compare
+ */
+UT_CASE_DEFINATION(_map_key_three_way_compare)
+void test__map_key_three_way_compare__null_compare(void** state)
+{
+    pair_t* ppair = create_pair(int, int);
+    int n_result = 0;
+
+    pair_init(ppair);
+    expect_assert_failure(_map_key_three_way_compare(NULL, ppair, ppair, &n_result));
+
+    pair_destroy(ppair);
+}
+
+void test__map_key_three_way_compare__null_result(void** state)
+{
+    pair_t* ppair = create_pair(int, int);
+
+    pair_init(ppair);
+    expect_assert_failure(_map_key_three_way_compare(_map_value_compare, ppair, ppair, NULL));
+
+    pair_destroy(ppair);
+}
+
+void test__map_key_three_way_compare__not_map_compare(void** state)
+{
+    pair_t* ppair_first = create_pair(int, int);
+    pair_t* ppair_second = create_pair(int, int);
+    int n_result = 0;
+
+    pair_init_elem(ppair_first, 3, 30);
+    pair_init_elem(ppair_second, 5, 3);
+    assert_false(_map_key_three_way_compare(
+        ppair_first->_t_typeinfofirst._pt_type->_t_typeless, ppair_first, ppair_second, &n_result));
+
+    pair_destroy(ppair_first);
+    pair_destroy(ppair_second);
+}
+
+void test__map_key_three_way_compare__user_mapkeycompare(void** state)
+{
+    pair_t* ppair_first = create_pair(int, int);
+    pair_t* ppair_second = create_pair(int, int);
+    int n_result = 0;
+
+    pair_init_elem(ppair_first, 3, 30);
+    ppair_first->_bfun_mapkeycompare = _test__map_value_compare;
+    pair_init_elem(ppair_second, 5, 3);
+    ppair_second->_bfun_mapkeycompare = _test__map_value_compare;
+    assert_false(_map_key_three_way_compare(_map_value_compare, ppair_first, ppair_second, &n_result));
+
+    pair_destroy(ppair_first);
+    pair_destroy(ppair_second);
+}
+
+void test__map_key_three_way_compare__map_compare(void** state)
+{
+    pair_t* ppair_first = create_pair(int, int);
+    pair_t* ppair_second = create_pair(int, int);
+    int n_result = 0;
+
+    /* the values are not compared */
+    pair_init_elem(ppair_first, 3, 30);
+    pair_init_elem(ppair_second, 5, 3);
+    assert_true(_map_key_three_way_compare(_map_value_compare, ppair_first, ppair_second, &n_result));
+    assert_true(n_result < 0);
+    assert_true(_map_key_three_way_compare(_map_value_compare, ppair_second, ppair_first, &n_result));
+    assert_true(n_result > 0);
+    pair_make(ppair_second, 3, 3);
+    assert_true(_map_key_three_way_compare(_map_value_compare, ppair_first, ppair_second, &n_result));
+    assert_true(n_result == 0);
+
+    pair_destroy(ppair_first);
+    pair_destroy(ppair_second);
+}
+
+void test__map_key_three_way_compare__cstr(void** state)
+{
+    pair_t* ppair_first = create_pair(char*, int);
+    pair_t* ppair_second = create_pair(char*, int);
+    int n_result = 0;
+
+    pair_init_elem(ppair_first, "abc", 30);
+    pair_init_elem(ppair_second, "abd", 3);
+    assert_true(_map_key_three_way_compare(_multimap_value_compare, ppair_first, ppair_second, &n_result));
+    assert_true(n_result < 0);
+    assert_true(_map_key_three_way_compare(_hash_map_value_compare, ppair_second, ppair_first, &n_result));
+    assert_true(n_result > 0);
+    assert_true(_map_key_three_way_compare(_hash_multimap_value_compare, ppair_first, ppair_first, &n_result));
+    assert_true(n_result == 0);
+
+    pair_destroy(ppair_first);
+    pair_destroy(ppair_second);
+}
@@ -44,6 +44,16 @@ void test__map_value_compare__no_mapkeycompare_result_true(void** state);
 void test__map_value_compare__no_mapkeycompare_result_false(void** state);
 void test__map_value_compare__user_mapkeycompare_result_true(void** state);
 void test__map_value_compare__user_mapkeycompare_result_false(void** state);
+/*
+ * test _map_key_three_way_compare
+ */
+UT_CASE_DECLARATION(_map_key_three_way_compare)
+void test__map_key_three_way_compare__null_compare(void** state);
+void test__map_key_three_way_compare__null_result(void** state);
+void test__map_key_three_way_compare__not_map_compare(void** state);
+void test__map_key_three_way_compare__user_mapkeycompare(void** state);
+void test__map_key_three_way_compare__map_compare(void** state);
+void test__map_key_three_way_compare__cstr(void** state);
 
 #define UT_CSTL_MAP_AUX_CASE\
     UT_SUIT_BEGIN(cstl_map_aux, test__map_same_pair_type_ex__first_null),\
@@ -75,7 +85,13 @@ void test__map_value_compare__user_mapkeycompare_result_false(void** state);
     UT_CASE(test__map_value_compare__no_mapkeycompare_result_true),\
     UT_CASE(test__map_value_compare__no_mapkeycompare_result_false),\
     UT_CASE(test__map_value_compare__user_mapkeycompare_result_true),\
-    UT_CASE(test__map_value_compare__user_mapkeycompare_result_false)
+    UT_CASE(test__map_value_compare__user_mapkeycompare_result_false),\
+    UT_CASE_BEGIN(_map_key_three_way_compare, test__map_key_three_way_compare__null_compare),\
+    UT_CASE(test__map_key_three_way_compare__null_result),\
+    UT_CASE(test__map_key_three_way_compare__not_map_compare),\
+    UT_CASE(test__map_key_three_way_compare__user_mapkeycompare),\
+    UT_CASE(test__map_key_three_way_compare__map_compare),\
+    UT_CASE(test__map_key_three_way_compare__cstr)
 
 #endif /* _UT_CSTL_MAP_AUX_H_ */
 
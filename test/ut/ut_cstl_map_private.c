@@ -73,6 +73,126 @@ void test__create_map__unregister(void** state)
     assert_true(pt_map == NULL);
 }
 
+/*
+ * test _create_map_with_allocator
+ */
+UT_CASE_DEFINATION(_create_map_with_allocator)
+static void* _create_map_with_allocator__allocate(void* pv_context, size_t t_size)
+{
+    ((size_t*)pv_context)[0]++;
+    return malloc(t_size);
+}
+
+static void _create_map_with_allocator__deallocate(void* pv_context, void* pv_mem, size_t t_size)
+{
+    ((size_t*)pv_context)[1]++;
+    free(pv_mem);
+}
+
+void test__create_map_with_allocator__null_allocator(void** state)
+{
+    expect_assert_failure(_create_map_with_allocator(NULL, "int, int"));
+}
+
+void test__create_map_with_allocator__unregisted_type(void** state)
+{
+    size_t at_count[2] = {0, 0};
+    allocator_t t_allocator = {_create_map_with_allocator__allocate, _create_map_with_allocator__deallocate, NULL};
+
+    t_allocator._pv_context = at_count;
+    assert_true(_create_map_with_allocator(&t_allocator, "unregisted_type_t") == NULL);
+    assert_true(at_count[0] == 0 && at_count[1] == 0);
+}
+
+void test__create_map_with_allocator__allocate_by_allocator(void** state)
+{
+    size_t at_count[2] = {0, 0};
+    allocator_t t_allocator = {_create_map_with_allocator__allocate, _create_map_with_allocator__deallocate, NULL};
+    map_t* pmap = NULL;
+    int i = 0;
+
+    t_allocator._pv_context = at_count;
+    pmap = _create_map_with_allocator(&t_allocator, "int, int");
+    assert_true(pmap != NULL);
+    map_init(pmap);
+    for (i = 0; i < 100; ++i) {
+        *(int*)map_at(pmap, i) = i;
+    }
+    assert_true(map_size(pmap) == 100);
+    assert_true(at_count[0] > 0);
+
+    map_destroy(pmap);
+    assert_true(at_count[0] == at_count[1]);
+}
+
+/*
+ * test _create_map_with_region
+ */
+UT_CASE_DEFINATION(_create_map_with_region)
+void test__create_map_with_region__null_typename(void** state)
+{
+    expect_assert_failure(_create_map_with_region(NULL));
+}
+
+void test__create_map_with_region__unregisted_type(void** state)
+{
+    assert_true(_create_map_with_region("unregisted_type_t") == NULL);
+}
+
+void test__create_map_with_region__successfully(void** state)
+{
+    map_t* pmap = _create_map_with_region("int, int");
+    assert_true(pmap != NULL);
+    assert_true(_alloc_is_region(&pmap->_t_tree._t_allocator));
+    map_destroy(pmap);
+}
+
+void test__create_map_with_region__clear_and_destroy(void** state)
+{
+    map_t* pmap = _create_map_with_region("int, int");
+    int i = 0;
+    int j = 0;
+
+    map_init(pmap);
+    for (j = 0; j < 3; ++j) {
+        for (i = 0; i < 1000; ++i) {
+            *(int*)map_at(pmap, i) = i;
+        }
+        assert_true(map_size(pmap) == 1000);
+        map_clear(pmap);
+        assert_true(map_empty(pmap));
+        assert_true(map_size(pmap) == 0);
+    }
+    for (i = 0; i < 100; ++i) {
+        *(int*)map_at(pmap, i) = i;
+    }
+    assert_true(map_size(pmap) == 100);
+    map_destroy(pmap);
+}
+
+void test__create_map_with_region__clear_and_destroy_non_trivial(void** state)
+{
+    map_t* pmap = _create_map_with_region("int, vector_t<int>");
+    int i = 0;
+    int j = 0;
+
+    map_init(pmap);
+    for (j = 0; j < 3; ++j) {
+        for (i = 0; i < 1000; ++i) {
+            vector_push_back((vector_t*)map_at(pmap, i), i);
+        }
+        assert_true(map_size(pmap) == 1000);
+        assert_true(vector_size((vector_t*)map_at(pmap, 999)) == 1);
+        map_clear(pmap);
+        assert_true(map_empty(pmap));
+    }
+    for (i = 0; i < 100; ++i) {
+        vector_push_back((vector_t*)map_at(pmap, i), i);
+    }
+    assert_true(map_size(pmap) == 100);
+    map_destroy(pmap);
+}
+
 /*
  * test _create_map_auxiliary
  */
@@ -528,6 +648,32 @@ void test__map_find__map_find_varg__user_define_not_find(void** state)
     pair_destroy(pt_pair);
 }
 
+void test__map_find__map_find_varg__not_modify_pair_temp(void** state)
+{
+    map_t* pt_map = _create_map("int, int");
+    pair_t* pt_pair = create_pair(int, int);
+    map_iterator_t it_iter;
+    int elem;
+    int i;
+
+    pair_init(pt_pair);
+    map_init(pt_map);
+    for(i = 0; i < 10; ++i)
+    {
+        pair_make(pt_pair, i, i+8);
+        map_insert(pt_map, pt_pair);
+    }
+
+    *(int*)pt_map->_pair_temp._pv_first = -1;
+    elem = 2;
+    it_iter = _map_find(pt_map, elem);
+    assert_true(*(int*)pair_second((pair_t*)iterator_get_pointer(it_iter)) == 10);
+    assert_true(*(int*)pt_map->_pair_temp._pv_first == -1);
+
+    map_destroy(pt_map);
+    pair_destroy(pt_pair);
+}
+
 /*
  * test _map_count and _map_count_varg
  */
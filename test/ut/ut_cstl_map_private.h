@@ -12,6 +12,22 @@ void test__create_map__cstr(void** state);
 void test__create_map__libcstl_builtin(void** state);
 void test__create_map__user_define(void** state);
 void test__create_map__unregister(void** state);
+/*
+ * test _create_map_with_allocator
+ */
+UT_CASE_DECLARATION(_create_map_with_allocator)
+void test__create_map_with_allocator__null_allocator(void** state);
+void test__create_map_with_allocator__unregisted_type(void** state);
+void test__create_map_with_allocator__allocate_by_allocator(void** state);
+/*
+ * test _create_map_with_region
+ */
+UT_CASE_DECLARATION(_create_map_with_region)
+void test__create_map_with_region__null_typename(void** state);
+void test__create_map_with_region__unregisted_type(void** state);
+void test__create_map_with_region__successfully(void** state);
+void test__create_map_with_region__clear_and_destroy(void** state);
+void test__create_map_with_region__clear_and_destroy_non_trivial(void** state);
 /*
  * test _create_map_auxiliary
  */
@@ -47,6 +63,7 @@ void test__map_find__map_find_varg__libcstl_builtin_find(void** state);
 void test__map_find__map_find_varg__libcstl_builtin_not_find(void** state);
 void test__map_find__map_find_varg__user_define_find(void** state);
 void test__map_find__map_find_varg__user_define_not_find(void** state);
+void test__map_find__map_find_varg__not_modify_pair_temp(void** state);
 /*
  * test _map_count and _map_count_varg
  */
@@ -165,6 +182,14 @@ void test__map_init_elem_auxiliary__successfully_user_defined(void** state);
     UT_CASE(test__create_map__libcstl_builtin),\
     UT_CASE(test__create_map__user_define),\
     UT_CASE(test__create_map__unregister),\
+    UT_CASE_BEGIN(_create_map_with_allocator, test__create_map_with_allocator__null_allocator),\
+    UT_CASE(test__create_map_with_allocator__unregisted_type),\
+    UT_CASE(test__create_map_with_allocator__allocate_by_allocator),\
+    UT_CASE_BEGIN(_create_map_with_region, test__create_map_with_region__null_typename),\
+    UT_CASE(test__create_map_with_region__unregisted_type),\
+    UT_CASE(test__create_map_with_region__successfully),\
+    UT_CASE(test__create_map_with_region__clear_and_destroy),\
+    UT_CASE(test__create_map_with_region__clear_and_destroy_non_trivial),\
     UT_CASE_BEGIN(_create_map_auxiliary, test__create_map_auxiliary__null_map),\
     UT_CASE(test__create_map_auxiliary__null_typename),\
     UT_CASE(test__create_map_auxiliary__unregistered),\
@@ -188,6 +213,7 @@ void test__map_init_elem_auxiliary__successfully_user_defined(void** state);
     UT_CASE(test__map_find__map_find_varg__libcstl_builtin_not_find),\
     UT_CASE(test__map_find__map_find_varg__user_define_find),\
     UT_CASE(test__map_find__map_find_varg__user_define_not_find),\
+    UT_CASE(test__map_find__map_find_varg__not_modify_pair_temp),\
     UT_CASE_BEGIN(_map_count__map_count_varg, test__map_count__map_count_varg__null_map),\
     UT_CASE(test__map_count__map_count_varg__non_inited),\
     UT_CASE(test__map_count__map_count_varg__non_inited_pair),\
@@ -1703,6 +1703,77 @@ void test_multimap_max_size__non_empty(void** state)
     pair_destroy(pt_pair);
 }
 
+/*
+ * test multimap_memory_usage
+ */
+UT_CASE_DEFINATION(multimap_memory_usage)
+void test_multimap_memory_usage__null_multimap(void** state)
+{
+    expect_assert_failure(multimap_memory_usage(NULL));
+}
+
+void test_multimap_memory_usage__non_inited(void** state)
+{
+    multimap_t* pt_multimap = create_multimap(int, int);
+    multimap_init_ex(pt_multimap, NULL);
+
+#ifdef CSTL_MULTIMAP_AVL_TREE
+    pt_multimap->_t_tree._t_avlroot._un_height = 9;
+    expect_assert_failure(multimap_memory_usage(pt_multimap));
+    pt_multimap->_t_tree._t_avlroot._un_height = 0;
+#else
+    pt_multimap->_t_tree._t_rbroot._t_color = _COLOR_BLACK;
+    expect_assert_failure(multimap_memory_usage(pt_multimap));
+    pt_multimap->_t_tree._t_rbroot._t_color = _COLOR_RED;
+#endif
+
+    multimap_destroy(pt_multimap);
+}
+
+void test_multimap_memory_usage__non_inited_pair(void** state)
+{
+    multimap_t* pt_multimap = create_multimap(int, int);
+    void* pv_tmp = NULL;
+    multimap_init_ex(pt_multimap, NULL);
+
+    pv_tmp = pt_multimap->_pair_temp._pv_first;
+    pt_multimap->_pair_temp._pv_first = NULL;
+    expect_assert_failure(multimap_memory_usage(pt_multimap));
+    pt_multimap->_pair_temp._pv_first = pv_tmp;
+
+    multimap_destroy(pt_multimap);
+}
+
+void test_multimap_memory_usage__empty(void** state)
+{
+    multimap_t* pt_multimap = create_multimap(int, int);
+    multimap_init_ex(pt_multimap, NULL);
+
+    assert_true(multimap_memory_usage(pt_multimap) >= sizeof(multimap_t));
+
+    multimap_destroy(pt_multimap);
+}
+
+void test_multimap_memory_usage__non_empty(void** state)
+{
+    multimap_t* pt_multimap = create_multimap(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    size_t t_usage = 0;
+    int i = 0;
+
+    multimap_init(pt_multimap);
+    pair_init(pt_pair);
+    t_usage = multimap_memory_usage(pt_multimap);
+    for (i = 0; i < 100; ++i) {
+        pair_make(pt_pair, i, i);
+        multimap_insert(pt_multimap, pt_pair);
+    }
+    assert_true(multimap_memory_usage(pt_multimap) >= t_usage + 100 * 2 * sizeof(int));
+
+    multimap_destroy(pt_multimap);
+    pair_destroy(pt_pair);
+}
+
 /*
  * test multimap_begin
  */
@@ -5832,3 +5903,143 @@ void test_multimap_erase_range__all(void** state)
     pair_destroy(pt_pair);
 }
 
+/*
+ * test multimap_find_ptr
+ */
+UT_CASE_DEFINATION(multimap_find_ptr)
+void test_multimap_find_ptr__null_multimap(void** state)
+{
+    int key = 9;
+
+    expect_assert_failure(multimap_find_ptr(NULL, &key));
+}
+
+void test_multimap_find_ptr__null_key(void** state)
+{
+    multimap_t* pt_multimap = create_multimap(int, int);
+
+    multimap_init(pt_multimap);
+    expect_assert_failure(multimap_find_ptr(pt_multimap, NULL));
+
+    multimap_destroy(pt_multimap);
+}
+
+void test_multimap_find_ptr__c_builtin(void** state)
+{
+    multimap_t* pt_multimap = create_multimap(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    multimap_iterator_t it_iter;
+    int key;
+    int i;
+
+    multimap_init(pt_multimap);
+    pair_init(pt_pair);
+    for (i = 0; i < 10; ++i) {
+        pair_make(pt_pair, i, i * 10);
+        multimap_insert(pt_multimap, pt_pair);
+    }
+
+    key = 4;
+    it_iter = multimap_find_ptr(pt_multimap, &key);
+    assert_true(*(int*)pair_first((pair_t*)iterator_get_pointer(it_iter)) == 4);
+    assert_true(*(int*)pair_second((pair_t*)iterator_get_pointer(it_iter)) == 40);
+    key = 42;
+    it_iter = multimap_find_ptr(pt_multimap, &key);
+    assert_true(iterator_equal(it_iter, multimap_end(pt_multimap)));
+
+    multimap_destroy(pt_multimap);
+    pair_destroy(pt_pair);
+}
+
+void test_multimap_find_ptr__cstr(void** state)
+{
+    multimap_t* pt_multimap = create_multimap(char*, int);
+    pair_t* pt_pair = create_pair(char*, int);
+    multimap_iterator_t it_iter;
+
+    multimap_init(pt_multimap);
+    pair_init(pt_pair);
+    pair_make(pt_pair, "abc", 1);
+    multimap_insert(pt_multimap, pt_pair);
+    pair_make(pt_pair, "def", 2);
+    multimap_insert(pt_multimap, pt_pair);
+
+    it_iter = multimap_find_ptr(pt_multimap, "def");
+    assert_true(*(int*)pair_second((pair_t*)iterator_get_pointer(it_iter)) == 2);
+    it_iter = multimap_find_ptr(pt_multimap, "xyz");
+    assert_true(iterator_equal(it_iter, multimap_end(pt_multimap)));
+
+    multimap_destroy(pt_multimap);
+    pair_destroy(pt_pair);
+}
+
+/*
+ * test multimap_count_ptr
+ */
+UT_CASE_DEFINATION(multimap_count_ptr)
+void test_multimap_count_ptr__null_multimap(void** state)
+{
+    int key = 9;
+
+    expect_assert_failure(multimap_count_ptr(NULL, &key));
+}
+
+void test_multimap_count_ptr__c_builtin(void** state)
+{
+    multimap_t* pt_multimap = create_multimap(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    int key;
+    int i;
+
+    multimap_init(pt_multimap);
+    pair_init(pt_pair);
+    for (i = 0; i < 10; ++i) {
+        pair_make(pt_pair, i, i * 10);
+        multimap_insert(pt_multimap, pt_pair);
+    }
+    pair_make(pt_pair, 3, 0);
+    multimap_insert(pt_multimap, pt_pair);
+
+    key = 3;
+    assert_true(multimap_count_ptr(pt_multimap, &key) == 2);
+    key = 42;
+    assert_true(multimap_count_ptr(pt_multimap, &key) == 0);
+
+    multimap_destroy(pt_multimap);
+    pair_destroy(pt_pair);
+}
+
+/*
+ * test multimap_erase_ptr
+ */
+UT_CASE_DEFINATION(multimap_erase_ptr)
+void test_multimap_erase_ptr__null_multimap(void** state)
+{
+    int key = 9;
+
+    expect_assert_failure(multimap_erase_ptr(NULL, &key));
+}
+
+void test_multimap_erase_ptr__c_builtin(void** state)
+{
+    multimap_t* pt_multimap = create_multimap(int, int);
+    pair_t* pt_pair = create_pair(int, int);
+    int key;
+    int i;
+
+    multimap_init(pt_multimap);
+    pair_init(pt_pair);
+    for (i = 0; i < 10; ++i) {
+        pair_make(pt_pair, i, i * 10);
+        multimap_insert(pt_multimap, pt_pair);
+    }
+
+    key = 3;
+    assert_true(multimap_erase_ptr(pt_multimap, &key) == 1);
+    assert_true(multimap_size(pt_multimap) == 9);
+    assert_true(multimap_erase_ptr(pt_multimap, &key) == 0);
+
+    multimap_destroy(pt_multimap);
+    pair_destroy(pt_pair);
+}
+
@@ -147,6 +147,15 @@ void test_multimap_max_size__non_inited(void** state);
 void test_multimap_max_size__non_inited_pair(void** state);
 void test_multimap_max_size__empty(void** state);
 void test_multimap_max_size__non_empty(void** state);
+/*
+ * test multimap_memory_usage
+ */
+UT_CASE_DECLARATION(multimap_memory_usage)
+void test_multimap_memory_usage__null_multimap(void** state);
+void test_multimap_memory_usage__non_inited(void** state);
+void test_multimap_memory_usage__non_inited_pair(void** state);
+void test_multimap_memory_usage__empty(void** state);
+void test_multimap_memory_usage__non_empty(void** state);
 /*
  * test multimap_begin
  */
@@ -421,6 +430,26 @@ void test_multimap_erase_range__middle(void** state);
 void test_multimap_erase_range__end(void** state);
 void test_multimap_erase_range__all(void** state);
 
+/*
+ * test multimap_find_ptr
+ */
+UT_CASE_DECLARATION(multimap_find_ptr)
+void test_multimap_find_ptr__null_multimap(void** state);
+void test_multimap_find_ptr__null_key(void** state);
+void test_multimap_find_ptr__c_builtin(void** state);
+void test_multimap_find_ptr__cstr(void** state);
+/*
+ * test multimap_count_ptr
+ */
+UT_CASE_DECLARATION(multimap_count_ptr)
+void test_multimap_count_ptr__null_multimap(void** state);
+void test_multimap_count_ptr__c_builtin(void** state);
+/*
+ * test multimap_erase_ptr
+ */
+UT_CASE_DECLARATION(multimap_erase_ptr)
+void test_multimap_erase_ptr__null_multimap(void** state);
+void test_multimap_erase_ptr__c_builtin(void** state);
 #define UT_CSTL_MULTIMAP_CASE\
     UT_SUIT_BEGIN(cstl_multimap, test_multimap_init__null_multimap),\
     UT_CASE(test_multimap_init__non_created),\
@@ -515,6 +544,11 @@ void test_multimap_erase_range__all(void** state);
     UT_CASE(test_multimap_max_size__non_inited_pair),\
     UT_CASE(test_multimap_max_size__empty),\
     UT_CASE(test_multimap_max_size__non_empty),\
+    UT_CASE_BEGIN(multimap_memory_usage, test_multimap_memory_usage__null_multimap),\
+    UT_CASE(test_multimap_memory_usage__non_inited),\
+    UT_CASE(test_multimap_memory_usage__non_inited_pair),\
+    UT_CASE(test_multimap_memory_usage__empty),\
+    UT_CASE(test_multimap_memory_usage__non_empty),\
     UT_CASE_BEGIN(multimap_begin, test_multimap_begin__null_multimap),\
     UT_CASE(test_multimap_begin__non_inited),\
     UT_CASE(test_multimap_begin__non_inited_pair),\
@@ -713,7 +747,15 @@ void test_multimap_erase_range__all(void** state);
     UT_CASE(test_multimap_erase_range__begin),\
     UT_CASE(test_multimap_erase_range__middle),\
     UT_CASE(test_multimap_erase_range__end),\
-    UT_CASE(test_multimap_erase_range__all)
+    UT_CASE(test_multimap_erase_range__all),\
+    UT_CASE_BEGIN(multimap_find_ptr, test_multimap_find_ptr__null_multimap),\
+    UT_CASE(test_multimap_find_ptr__null_key),\
+    UT_CASE(test_multimap_find_ptr__c_builtin),\
+    UT_CASE(test_multimap_find_ptr__cstr),\
+    UT_CASE_BEGIN(multimap_count_ptr, test_multimap_count_ptr__null_multimap),\
+    UT_CASE(test_multimap_count_ptr__c_builtin),\
+    UT_CASE_BEGIN(multimap_erase_ptr, test_multimap_erase_ptr__null_multimap),\
+    UT_CASE(test_multimap_erase_ptr__c_builtin)
 
 #endif /* _UT_CSTL_MULTIMAP_H_ */
 
@@ -73,6 +73,112 @@ void test__create_multimap__unregister(void** state)
     assert_true(pt_multimap == NULL);
 }
 
+/*
+ * test _create_multimap_with_allocator
+ */
+UT_CASE_DEFINATION(_create_multimap_with_allocator)
+static void* _create_multimap_with_allocator__allocate(void* pv_context, size_t t_size)
+{
+    ((size_t*)pv_context)[0]++;
+    return malloc(t_size);
+}
+
+static void _create_multimap_with_allocator__deallocate(void* pv_context, void* pv_mem, size_t t_size)
+{
+    ((size_t*)pv_context)[1]++;
+    free(pv_mem);
+}
+
+void test__create_multimap_with_allocator__null_allocator(void** state)
+{
+    expect_assert_failure(_create_multimap_with_allocator(NULL, "int, int"));
+}
+
+void test__create_multimap_with_allocator__unregisted_type(void** state)
+{
+    size_t at_count[2] = {0, 0};
+    allocator_t t_allocator = {_create_multimap_with_allocator__allocate, _create_multimap_with_allocator__deallocate, NULL};
+
+    t_allocator._pv_context = at_count;
+    assert_true(_create_multimap_with_allocator(&t_allocator, "unregisted_type_t") == NULL);
+    assert_true(at_count[0] == 0 && at_count[1] == 0);
+}
+
+void test__create_multimap_with_allocator__allocate_by_allocator(void** state)
+{
+    size_t at_count[2] = {0, 0};
+    allocator_t t_allocator = {_create_multimap_with_allocator__allocate, _create_multimap_with_allocator__deallocate, NULL};
+    multimap_t* pmmap = NULL;
+    pair_t* ppair = create_pair(int, int);
+    int i = 0;
+
+    t_allocator._pv_context = at_count;
+    pmmap = _create_multimap_with_allocator(&t_allocator, "int, int");
+    assert_true(pmmap != NULL);
+    multimap_init(pmmap);
+    pair_init(ppair);
+    for (i = 0; i < 100; ++i) {
+        pair_make(ppair, i, i);
+        multimap_insert(pmmap, ppair);
+    }
+    assert_true(multimap_size(pmmap) == 100);
+    assert_true(at_count[0] > 0);
+
+    multimap_destroy(pmmap);
+    pair_destroy(ppair);
+    assert_true(at_count[0] == at_count[1]);
+}
+
+/*
+ * test _create_multimap_with_region
+ */
+UT_CASE_DEFINATION(_create_multimap_with_region)
+void test__create_multimap_with_region__null_typename(void** state)
+{
+    expect_assert_failure(_create_multimap_with_region(NULL));
+}
+
+void test__create_multimap_with_region__unregisted_type(void** state)
+{
+    assert_true(_create_multimap_with_region("unregisted_type_t") == NULL);
+}
+
+void test__create_multimap_with_region__successfully(void** state)
+{
+    multimap_t* pmmap = _create_multimap_with_region("int, int");
+    assert_true(pmmap != NULL);
+    assert_true(_alloc_is_region(&pmmap->_t_tree._t_allocator));
+    multimap_destroy(pmmap);
+}
+
+void test__create_multimap_with_region__clear_and_destroy(void** state)
+{
+    multimap_t* pmmap = _create_multimap_with_region("int, int");
+    pair_t* ppair = create_pair(int, int);
+    int i = 0;
+    int j = 0;
+
+    multimap_init(pmmap);
+    pair_init(ppair);
+    for (j = 0; j < 3; ++j) {
+        for (i = 0; i < 1000; ++i) {
+            pair_make(ppair, i, i);
+            multimap_insert(pmmap, ppair);
+        }
+        assert_true(multimap_size(pmmap) == 1000);
+        multimap_clear(pmmap);
+        assert_true(multimap_empty(pmmap));
+        assert_true(multimap_size(pmmap) == 0);
+    }
+    for (i = 0; i < 100; ++i) {
+        pair_make(ppair, i, i);
+            multimap_insert(pmmap, ppair);
+    }
+    assert_true(multimap_size(pmmap) == 100);
+    multimap_destroy(pmmap);
+    pair_destroy(ppair);
+}
+
 /*
  * test _create_multimap_auxiliary
  */
@@ -12,6 +12,21 @@ void test__create_multimap__cstr(void** state);
 void test__create_multimap__libcstl_builtin(void** state);
 void test__create_multimap__user_define(void** state);
 void test__create_multimap__unregister(void** state);
+/*
+ * test _create_multimap_with_allocator
+ */
+UT_CASE_DECLARATION(_create_multimap_with_allocator)
+void test__create_multimap_with_allocator__null_allocator(void** state);
+void test__create_multimap_with_allocator__unregisted_type(void** state);
+void test__create_multimap_with_allocator__allocate_by_allocator(void** state);
+/*
+ * test _create_multimap_with_region
+ */
+UT_CASE_DECLARATION(_create_multimap_with_region)
+void test__create_multimap_with_region__null_typename(void** state);
+void test__create_multimap_with_region__unregisted_type(void** state);
+void test__create_multimap_with_region__successfully(void** state);
+void test__create_multimap_with_region__clear_and_destroy(void** state);
 /*
  * test _create_multimap_auxiliary
  */
@@ -150,6 +165,13 @@ void test__multimap_init_elem_auxiliary__successfully_user_defined(void** state)
     UT_CASE(test__create_multimap__libcstl_builtin),\
     UT_CASE(test__create_multimap__user_define),\
     UT_CASE(test__create_multimap__unregister),\
+    UT_CASE_BEGIN(_create_multimap_with_allocator, test__create_multimap_with_allocator__null_allocator),\
+    UT_CASE(test__create_multimap_with_allocator__unregisted_type),\
+    UT_CASE(test__create_multimap_with_allocator__allocate_by_allocator),\
+    UT_CASE_BEGIN(_create_multimap_with_region, test__create_multimap_with_region__null_typename),\
+    UT_CASE(test__create_multimap_with_region__unregisted_type),\
+    UT_CASE(test__create_multimap_with_region__successfully),\
+    UT_CASE(test__create_multimap_with_region__clear_and_destroy),\
     UT_CASE_BEGIN(_create_multimap_auxiliary, test__create_multimap_auxiliary__null_multimap),\
     UT_CASE(test__create_multimap_auxiliary__null_typename),\
     UT_CASE(test__create_multimap_auxiliary__unregistered),\
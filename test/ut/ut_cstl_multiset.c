@@ -1282,6 +1282,59 @@ void test_multiset_max_size__non_empty(void** state)
     multiset_destroy(pt_multiset);
 }
 
+/*
+ * test multiset_memory_usage
+ */
+UT_CASE_DEFINATION(multiset_memory_usage)
+void test_multiset_memory_usage__null_multiset(void** state)
+{
+    expect_assert_failure(multiset_memory_usage(NULL));
+}
+
+void test_multiset_memory_usage__non_inited(void** state)
+{
+    multiset_t* pt_multiset = create_multiset(int);
+    multiset_init_ex(pt_multiset, NULL);
+
+#ifdef CSTL_MULTISET_AVL_TREE
+    pt_multiset->_t_tree._t_avlroot._un_height = 9;
+    expect_assert_failure(multiset_memory_usage(pt_multiset));
+    pt_multiset->_t_tree._t_avlroot._un_height = 0;
+#else
+    pt_multiset->_t_tree._t_rbroot._t_color = _COLOR_BLACK;
+    expect_assert_failure(multiset_memory_usage(pt_multiset));
+    pt_multiset->_t_tree._t_rbroot._t_color = _COLOR_RED;
+#endif
+
+    multiset_destroy(pt_multiset);
+}
+
+void test_multiset_memory_usage__empty(void** state)
+{
+    multiset_t* pt_multiset = create_multiset(int);
+    multiset_init_ex(pt_multiset, NULL);
+
+    assert_true(multiset_memory_usage(pt_multiset) >= sizeof(multiset_t));
+
+    multiset_destroy(pt_multiset);
+}
+
+void test_multiset_memory_usage__non_empty(void** state)
+{
+    multiset_t* pt_multiset = create_multiset(int);
+    size_t t_usage = 0;
+    int i = 0;
+
+    multiset_init(pt_multiset);
+    t_usage = multiset_memory_usage(pt_multiset);
+    for (i = 0; i < 100; ++i) {
+        multiset_insert(pt_multiset, i);
+    }
+    assert_true(multiset_memory_usage(pt_multiset) >= t_usage + 100 * sizeof(int));
+
+    multiset_destroy(pt_multiset);
+}
+
 /*
  * test multiset_begin
  */
@@ -3896,3 +3949,230 @@ void test_multiset_erase_range__all(void** state)
     multiset_destroy(pt_dest);
 }
 
+/*
+ * test multiset_find_ptr
+ */
+UT_CASE_DEFINATION(multiset_find_ptr)
+void test_multiset_find_ptr__null_multiset(void** state)
+{
+    int elem = 9;
+
+    expect_assert_failure(multiset_find_ptr(NULL, &elem));
+}
+
+void test_multiset_find_ptr__null_value(void** state)
+{
+    multiset_t* pt_multiset = create_multiset(int);
+
+    multiset_init(pt_multiset);
+    expect_assert_failure(multiset_find_ptr(pt_multiset, NULL));
+
+    multiset_destroy(pt_multiset);
+}
+
+void test_multiset_find_ptr__c_builtin(void** state)
+{
+    multiset_t* pt_multiset = create_multiset(int);
+    multiset_iterator_t it_iter;
+    int elem;
+    int i;
+
+    multiset_init(pt_multiset);
+    for (i = 0; i < 10; ++i) {
+        multiset_insert(pt_multiset, i);
+    }
+
+    elem = 2;
+    it_iter = multiset_find_ptr(pt_multiset, &elem);
+    assert_true(*(int*)iterator_get_pointer(it_iter) == 2);
+    elem = 42;
+    it_iter = multiset_find_ptr(pt_multiset, &elem);
+    assert_true(iterator_equal(it_iter, multiset_end(pt_multiset)));
+
+    multiset_destroy(pt_multiset);
+}
+
+void test_multiset_find_ptr__cstr(void** state)
+{
+    multiset_t* pt_multiset = create_multiset(char*);
+    multiset_iterator_t it_iter;
+
+    multiset_init(pt_multiset);
+    multiset_insert(pt_multiset, "aaa");
+    multiset_insert(pt_multiset, "ggg");
+    multiset_insert(pt_multiset, "linux");
+
+    it_iter = multiset_find_ptr(pt_multiset, "ggg");
+    assert_true(strcmp((char*)iterator_get_pointer(it_iter), "ggg") == 0);
+    it_iter = multiset_find_ptr(pt_multiset, "unix");
+    assert_true(iterator_equal(it_iter, multiset_end(pt_multiset)));
+
+    multiset_destroy(pt_multiset);
+}
+
+void test_multiset_find_ptr__libcstl_builtin(void** state)
+{
+    multiset_t* pt_multiset = create_multiset(vector_t<int>);
+    vector_t* pvec_vector = create_vector(int);
+    multiset_iterator_t it_iter;
+
+    multiset_init(pt_multiset);
+    vector_init_n(pvec_vector, 3);
+    multiset_insert(pt_multiset, pvec_vector);
+
+    it_iter = multiset_find_ptr(pt_multiset, pvec_vector);
+    assert_true(vector_equal((vector_t*)iterator_get_pointer(it_iter), pvec_vector));
+    vector_push_back(pvec_vector, 1);
+    it_iter = multiset_find_ptr(pt_multiset, pvec_vector);
+    assert_true(iterator_equal(it_iter, multiset_end(pt_multiset)));
+
+    multiset_destroy(pt_multiset);
+    vector_destroy(pvec_vector);
+}
+
+/*
+ * test multiset_insert_ptr
+ */
+UT_CASE_DEFINATION(multiset_insert_ptr)
+void test_multiset_insert_ptr__null_multiset(void** state)
+{
+    int elem = 9;
+
+    expect_assert_failure(multiset_insert_ptr(NULL, &elem));
+}
+
+void test_multiset_insert_ptr__null_value(void** state)
+{
+    multiset_t* pt_multiset = create_multiset(int);
+
+    multiset_init(pt_multiset);
+    expect_assert_failure(multiset_insert_ptr(pt_multiset, NULL));
+
+    multiset_destroy(pt_multiset);
+}
+
+void test_multiset_insert_ptr__c_builtin(void** state)
+{
+    multiset_t* pt_multiset = create_multiset(int);
+    multiset_iterator_t it_iter;
+    int elem = 7;
+
+    multiset_init(pt_multiset);
+    it_iter = multiset_insert_ptr(pt_multiset, &elem);
+    assert_true(*(int*)iterator_get_pointer(it_iter) == 7);
+    assert_true(multiset_size(pt_multiset) == 1);
+    it_iter = multiset_insert_ptr(pt_multiset, &elem);
+    assert_true(!iterator_equal(it_iter, multiset_end(pt_multiset)));
+    assert_true(multiset_size(pt_multiset) == 2);
+
+    multiset_destroy(pt_multiset);
+}
+
+void test_multiset_insert_ptr__cstr(void** state)
+{
+    multiset_t* pt_multiset = create_multiset(char*);
+    multiset_iterator_t it_iter;
+
+    multiset_init(pt_multiset);
+    it_iter = multiset_insert_ptr(pt_multiset, "libcstl");
+    assert_true(strcmp((char*)iterator_get_pointer(it_iter), "libcstl") == 0);
+    assert_true(multiset_count(pt_multiset, "libcstl") == 1);
+
+    multiset_destroy(pt_multiset);
+}
+
+void test_multiset_insert_ptr__libcstl_builtin(void** state)
+{
+    multiset_t* pt_multiset = create_multiset(list_t<int>);
+    list_t* plist_list = create_list(int);
+    multiset_iterator_t it_iter;
+
+    multiset_init(pt_multiset);
+    list_init_n(plist_list, 5);
+    it_iter = multiset_insert_ptr(pt_multiset, plist_list);
+    assert_true(list_equal((list_t*)iterator_get_pointer(it_iter), plist_list));
+    assert_true((list_t*)iterator_get_pointer(it_iter) != plist_list);
+
+    multiset_destroy(pt_multiset);
+    list_destroy(plist_list);
+}
+
+/*
+ * test multiset_count_ptr
+ */
+UT_CASE_DEFINATION(multiset_count_ptr)
+void test_multiset_count_ptr__null_multiset(void** state)
+{
+    int elem = 9;
+
+    expect_assert_failure(multiset_count_ptr(NULL, &elem));
+}
+
+void test_multiset_count_ptr__c_builtin(void** state)
+{
+    multiset_t* pt_multiset = create_multiset(int);
+    int elem = 3;
+
+    multiset_init(pt_multiset);
+    multiset_insert(pt_multiset, 3);
+    multiset_insert(pt_multiset, 3);
+    multiset_insert(pt_multiset, 5);
+    assert_true(multiset_count_ptr(pt_multiset, &elem) == 2);
+    elem = 4;
+    assert_true(multiset_count_ptr(pt_multiset, &elem) == 0);
+
+    multiset_destroy(pt_multiset);
+}
+
+void test_multiset_count_ptr__cstr(void** state)
+{
+    multiset_t* pt_multiset = create_multiset(char*);
+
+    multiset_init(pt_multiset);
+    multiset_insert(pt_multiset, "abc");
+    assert_true(multiset_count_ptr(pt_multiset, "abc") == 1);
+    assert_true(multiset_count_ptr(pt_multiset, "abcd") == 0);
+
+    multiset_destroy(pt_multiset);
+}
+
+/*
+ * test multiset_erase_ptr
+ */
+UT_CASE_DEFINATION(multiset_erase_ptr)
+void test_multiset_erase_ptr__null_multiset(void** state)
+{
+    int elem = 9;
+
+    expect_assert_failure(multiset_erase_ptr(NULL, &elem));
+}
+
+void test_multiset_erase_ptr__c_builtin(void** state)
+{
+    multiset_t* pt_multiset = create_multiset(int);
+    int elem = 3;
+
+    multiset_init(pt_multiset);
+    multiset_insert(pt_multiset, 3);
+    multiset_insert(pt_multiset, 3);
+    multiset_insert(pt_multiset, 5);
+    assert_true(multiset_erase_ptr(pt_multiset, &elem) == 2);
+    assert_true(multiset_size(pt_multiset) == 1);
+    assert_true(multiset_erase_ptr(pt_multiset, &elem) == 0);
+
+    multiset_destroy(pt_multiset);
+}
+
+void test_multiset_erase_ptr__cstr(void** state)
+{
+    multiset_t* pt_multiset = create_multiset(char*);
+
+    multiset_init(pt_multiset);
+    multiset_insert(pt_multiset, "abc");
+    multiset_insert(pt_multiset, "def");
+    assert_true(multiset_erase_ptr(pt_multiset, "abc") == 1);
+    assert_true(multiset_size(pt_multiset) == 1);
+
+    multiset_destroy(pt_multiset);
+}
+
@@ -127,6 +127,14 @@ void test_multiset_max_size__null_multiset(void** state);
 void test_multiset_max_size__non_inited(void** state);
 void test_multiset_max_size__empty(void** state);
 void test_multiset_max_size__non_empty(void** state);
+/*
+ * test multiset_memory_usage
+ */
+UT_CASE_DECLARATION(multiset_memory_usage)
+void test_multiset_memory_usage__null_multiset(void** state);
+void test_multiset_memory_usage__non_inited(void** state);
+void test_multiset_memory_usage__empty(void** state);
+void test_multiset_memory_usage__non_empty(void** state);
 /*
  * test multiset_begin
  */
@@ -329,6 +337,38 @@ void test_multiset_erase_range__middle(void** state);
 void test_multiset_erase_range__end(void** state);
 void test_multiset_erase_range__all(void** state);
 
+/*
+ * test multiset_find_ptr
+ */
+UT_CASE_DECLARATION(multiset_find_ptr)
+void test_multiset_find_ptr__null_multiset(void** state);
+void test_multiset_find_ptr__null_value(void** state);
+void test_multiset_find_ptr__c_builtin(void** state);
+void test_multiset_find_ptr__cstr(void** state);
+void test_multiset_find_ptr__libcstl_builtin(void** state);
+/*
+ * test multiset_insert_ptr
+ */
+UT_CASE_DECLARATION(multiset_insert_ptr)
+void test_multiset_insert_ptr__null_multiset(void** state);
+void test_multiset_insert_ptr__null_value(void** state);
+void test_multiset_insert_ptr__c_builtin(void** state);
+void test_multiset_insert_ptr__cstr(void** state);
+void test_multiset_insert_ptr__libcstl_builtin(void** state);
+/*
+ * test multiset_count_ptr
+ */
+UT_CASE_DECLARATION(multiset_count_ptr)
+void test_multiset_count_ptr__null_multiset(void** state);
+void test_multiset_count_ptr__c_builtin(void** state);
+void test_multiset_count_ptr__cstr(void** state);
+/*
+ * test multiset_erase_ptr
+ */
+UT_CASE_DECLARATION(multiset_erase_ptr)
+void test_multiset_erase_ptr__null_multiset(void** state);
+void test_multiset_erase_ptr__c_builtin(void** state);
+void test_multiset_erase_ptr__cstr(void** state);
 #define UT_CSTL_MULTISET_CASE\
     UT_SUIT_BEGIN(cstl_multiset, test_multiset_init__null_multiset),\
     UT_CASE(test_multiset_init__non_created),\
@@ -407,6 +447,10 @@ void test_multiset_erase_range__all(void** state);
     UT_CASE(test_multiset_max_size__non_inited),\
     UT_CASE(test_multiset_max_size__empty),\
     UT_CASE(test_multiset_max_size__non_empty),\
+    UT_CASE_BEGIN(multiset_memory_usage, test_multiset_memory_usage__null_multiset),\
+    UT_CASE(test_multiset_memory_usage__non_inited),\
+    UT_CASE(test_multiset_memory_usage__empty),\
+    UT_CASE(test_multiset_memory_usage__non_empty),\
     UT_CASE_BEGIN(multiset_begin, test_multiset_begin__null_multiset),\
     UT_CASE(test_multiset_begin__non_inited),\
     UT_CASE(test_multiset_begin__empty),\
@@ -547,7 +591,23 @@ void test_multiset_erase_range__all(void** state);
     UT_CASE(test_multiset_erase_range__begin),\
     UT_CASE(test_multiset_erase_range__middle),\
     UT_CASE(test_multiset_erase_range__end),\
-    UT_CASE(test_multiset_erase_range__all)
+    UT_CASE(test_multiset_erase_range__all),\
+    UT_CASE_BEGIN(multiset_find_ptr, test_multiset_find_ptr__null_multiset),\
+    UT_CASE(test_multiset_find_ptr__null_value),\
+    UT_CASE(test_multiset_find_ptr__c_builtin),\
+    UT_CASE(test_multiset_find_ptr__cstr),\
+    UT_CASE(test_multiset_find_ptr__libcstl_builtin),\
+    UT_CASE_BEGIN(multiset_insert_ptr, test_multiset_insert_ptr__null_multiset),\
+    UT_CASE(test_multiset_insert_ptr__null_value),\
+    UT_CASE(test_multiset_insert_ptr__c_builtin),\
+    UT_CASE(test_multiset_insert_ptr__cstr),\
+    UT_CASE(test_multiset_insert_ptr__libcstl_builtin),\
+    UT_CASE_BEGIN(multiset_count_ptr, test_multiset_count_ptr__null_multiset),\
+    UT_CASE(test_multiset_count_ptr__c_builtin),\
+    UT_CASE(test_multiset_count_ptr__cstr),\
+    UT_CASE_BEGIN(multiset_erase_ptr, test_multiset_erase_ptr__null_multiset),\
+    UT_CASE(test_multiset_erase_ptr__c_builtin),\
+    UT_CASE(test_multiset_erase_ptr__cstr)
 
 #endif /* _UT_CSTL_MULTISET_H_ */
 
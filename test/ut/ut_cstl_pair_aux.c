@@ -5,6 +5,7 @@
 
 #include "cstl/cstl_def.h"
 #include "cstl/citerator.h"
+#include "cstl/clist.h"
 #include "cstl/cmap.h"
 #include "cstl/cstring.h"
 #include "cstl/cvector.h"
@@ -114,3 +115,222 @@ void test__pair_same_type__same_type(void** state)
     pair_destroy(ppair_second);
 }
 
+/*
+ * test _pair_key_init_varg
+ */
+UT_CASE_DEFINATION(_pair_key_init_varg)
+static void _wrapper_pair_key_init_varg(_pairkey_t* pt_key, const pair_t* cppair_pair, ...)
+{
+    va_list val_elemlist;
+    va_start(val_elemlist, cppair_pair);
+    _pair_key_init_varg(pt_key, cppair_pair, val_elemlist);
+    va_end(val_elemlist);
+}
+
+void test__pair_key_init_varg__null_key(void** state)
+{
+    pair_t* ppair = create_pair(int, int);
+    pair_init(ppair);
+
+    expect_assert_failure(_wrapper_pair_key_init_varg(NULL, ppair, 10));
+
+    pair_destroy(ppair);
+}
+
+void test__pair_key_init_varg__null_pair(void** state)
+{
+    _pairkey_t t_key;
+
+    expect_assert_failure(_wrapper_pair_key_init_varg(&t_key, NULL, 10));
+}
+
+void test__pair_key_init_varg__non_inited_pair(void** state)
+{
+    _pairkey_t t_key;
+    pair_t* ppair = create_pair(int, int);
+
+    expect_assert_failure(_wrapper_pair_key_init_varg(&t_key, ppair, 10));
+
+    pair_destroy(ppair);
+}
+
+void test__pair_key_init_varg__c_builtin(void** state)
+{
+    _pairkey_t t_key;
+    pair_t* ppair = create_pair(int, int);
+    pair_init_elem(ppair, 1, 2);
+
+    _wrapper_pair_key_init_varg(&t_key, ppair, 10);
+    assert_true(_pair_same_type(&t_key._pair_key, ppair));
+    assert_true(*(int*)t_key._pair_key._pv_first == 10);
+    assert_true(t_key._pair_key._pv_second == ppair->_pv_second);
+    assert_false(t_key._pair_key._b_inline);
+    assert_true(*(int*)pair_first(ppair) == 1);
+
+    _pair_key_destroy(&t_key);
+    pair_destroy(ppair);
+}
+
+void test__pair_key_init_varg__cstr(void** state)
+{
+    _pairkey_t t_key;
+    pair_t* ppair = create_pair(char*, int);
+    pair_init_elem(ppair, "abc", 2);
+
+    _wrapper_pair_key_init_varg(&t_key, ppair, "xyz");
+    assert_true(t_key._pair_key._pv_first == &t_key._t_cstr);
+    assert_true(strcmp((char*)pair_first(&t_key._pair_key), "xyz") == 0);
+    assert_true(strcmp((char*)pair_first(ppair), "abc") == 0);
+
+    _pair_key_destroy(&t_key);
+    pair_destroy(ppair);
+}
+
+void test__pair_key_init_varg__cstr_null(void** state)
+{
+    _pairkey_t t_key;
+    pair_t* ppair = create_pair(char*, int);
+    pair_init(ppair);
+
+    expect_assert_failure(_wrapper_pair_key_init_varg(&t_key, ppair, NULL));
+
+    pair_destroy(ppair);
+}
+
+void test__pair_key_init_varg__libcstl_builtin(void** state)
+{
+    _pairkey_t t_key;
+    pair_t* ppair = create_pair(list_t<int>, int);
+    list_t* plist = create_list(int);
+    pair_init(ppair);
+    list_init(plist);
+
+    _wrapper_pair_key_init_varg(&t_key, ppair, plist);
+    assert_true(t_key._pair_key._pv_first == plist);
+
+    _pair_key_destroy(&t_key);
+    list_destroy(plist);
+    pair_destroy(ppair);
+}
+
+/*
+ * test _pair_key_init_ptr
+ */
+UT_CASE_DEFINATION(_pair_key_init_ptr)
+void test__pair_key_init_ptr__null_key(void** state)
+{
+    int n_key = 10;
+    pair_t* ppair = create_pair(int, int);
+    pair_init(ppair);
+
+    expect_assert_failure(_pair_key_init_ptr(NULL, ppair, &n_key));
+
+    pair_destroy(ppair);
+}
+
+void test__pair_key_init_ptr__null_pair(void** state)
+{
+    int n_key = 10;
+    _pairkey_t t_key;
+
+    expect_assert_failure(_pair_key_init_ptr(&t_key, NULL, &n_key));
+}
+
+void test__pair_key_init_ptr__null_value(void** state)
+{
+    _pairkey_t t_key;
+    pair_t* ppair = create_pair(int, int);
+    pair_init(ppair);
+
+    expect_assert_failure(_pair_key_init_ptr(&t_key, ppair, NULL));
+
+    pair_destroy(ppair);
+}
+
+void test__pair_key_init_ptr__c_builtin(void** state)
+{
+    int n_key = 10;
+    _pairkey_t t_key;
+    pair_t* ppair = create_pair(int, int);
+    pair_init_elem(ppair, 1, 2);
+
+    _pair_key_init_ptr(&t_key, ppair, &n_key);
+    assert_true(_pair_same_type(&t_key._pair_key, ppair));
+    assert_true(t_key._pair_key._pv_first == &n_key);
+    assert_true(*(int*)pair_first(ppair) == 1);
+
+    _pair_key_destroy(&t_key);
+    pair_destroy(ppair);
+}
+
+void test__pair_key_init_ptr__cstr(void** state)
+{
+    _pairkey_t t_key;
+    pair_t* ppair = create_pair(char*, int);
+    pair_init_elem(ppair, "abc", 2);
+
+    _pair_key_init_ptr(&t_key, ppair, "xyz");
+    assert_true(t_key._pair_key._pv_first == &t_key._t_cstr);
+    assert_true(strcmp((char*)pair_first(&t_key._pair_key), "xyz") == 0);
+    assert_true(strcmp((char*)pair_first(ppair), "abc") == 0);
+
+    _pair_key_destroy(&t_key);
+    pair_destroy(ppair);
+}
+
+void test__pair_key_init_ptr__libcstl_builtin(void** state)
+{
+    _pairkey_t t_key;
+    pair_t* ppair = create_pair(list_t<int>, int);
+    list_t* plist = create_list(int);
+    pair_init(ppair);
+    list_init(plist);
+
+    _pair_key_init_ptr(&t_key, ppair, plist);
+    assert_true(t_key._pair_key._pv_first == plist);
+
+    _pair_key_destroy(&t_key);
+    list_destroy(plist);
+    pair_destroy(ppair);
+}
+
+/*
+ * test _pair_key_destroy
+ */
+UT_CASE_DEFINATION(_pair_key_destroy)
+void test__pair_key_destroy__null_key(void** state)
+{
+    expect_assert_failure(_pair_key_destroy(NULL));
+}
+
+void test__pair_key_destroy__c_builtin(void** state)
+{
+    _pairkey_t t_key;
+    pair_t* ppair = create_pair(int, int);
+    pair_init_elem(ppair, 1, 2);
+
+    _wrapper_pair_key_init_varg(&t_key, ppair, 10);
+    _pair_key_destroy(&t_key);
+    assert_true(t_key._pair_key._pv_first == NULL);
+    assert_true(t_key._pair_key._pv_second == NULL);
+    assert_true(*(int*)pair_first(ppair) == 1);
+    assert_true(*(int*)pair_second(ppair) == 2);
+
+    pair_destroy(ppair);
+}
+
+void test__pair_key_destroy__cstr(void** state)
+{
+    _pairkey_t t_key;
+    pair_t* ppair = create_pair(char*, int);
+    pair_init_elem(ppair, "abc", 2);
+
+    _pair_key_init_ptr(&t_key, ppair, "xyz");
+    _pair_key_destroy(&t_key);
+    assert_true(t_key._pair_key._pv_first == NULL);
+    assert_true(t_key._pair_key._pv_second == NULL);
+    assert_true(strcmp((char*)pair_first(ppair), "abc") == 0);
+
+    pair_destroy(ppair);
+}
+
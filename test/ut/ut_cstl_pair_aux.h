@@ -16,6 +16,35 @@ void test__pair_same_type__not_same_first_type(void** state);
 void test__pair_same_type__not_same_second_type(void** state);
 void test__pair_same_type__same_type(void** state);
 
+/*
+ * test _pair_key_init_varg
+ */
+UT_CASE_DECLARATION(_pair_key_init_varg)
+void test__pair_key_init_varg__null_key(void** state);
+void test__pair_key_init_varg__null_pair(void** state);
+void test__pair_key_init_varg__non_inited_pair(void** state);
+void test__pair_key_init_varg__c_builtin(void** state);
+void test__pair_key_init_varg__cstr(void** state);
+void test__pair_key_init_varg__cstr_null(void** state);
+void test__pair_key_init_varg__libcstl_builtin(void** state);
+/*
+ * test _pair_key_init_ptr
+ */
+UT_CASE_DECLARATION(_pair_key_init_ptr)
+void test__pair_key_init_ptr__null_key(void** state);
+void test__pair_key_init_ptr__null_pair(void** state);
+void test__pair_key_init_ptr__null_value(void** state);
+void test__pair_key_init_ptr__c_builtin(void** state);
+void test__pair_key_init_ptr__cstr(void** state);
+void test__pair_key_init_ptr__libcstl_builtin(void** state);
+/*
+ * test _pair_key_destroy
+ */
+UT_CASE_DECLARATION(_pair_key_destroy)
+void test__pair_key_destroy__null_key(void** state);
+void test__pair_key_destroy__c_builtin(void** state);
+void test__pair_key_destroy__cstr(void** state);
+
 #define UT_CSTL_PAIR_AUX_CASE\
     UT_SUIT_BEGIN(cstl_pair_aux, test__pair_same_type__first_null),\
     UT_CASE(test__pair_same_type__second_null),\
@@ -24,7 +53,23 @@ void test__pair_same_type__same_type(void** state);
     UT_CASE(test__pair_same_type__second_noninited),\
     UT_CASE(test__pair_same_type__not_same_first_type),\
     UT_CASE(test__pair_same_type__not_same_second_type),\
-    UT_CASE(test__pair_same_type__same_type)
+    UT_CASE(test__pair_same_type__same_type),\
+    UT_CASE_BEGIN(_pair_key_init_varg, test__pair_key_init_varg__null_key),\
+    UT_CASE(test__pair_key_init_varg__null_pair),\
+    UT_CASE(test__pair_key_init_varg__non_inited_pair),\
+    UT_CASE(test__pair_key_init_varg__c_builtin),\
+    UT_CASE(test__pair_key_init_varg__cstr),\
+    UT_CASE(test__pair_key_init_varg__cstr_null),\
+    UT_CASE(test__pair_key_init_varg__libcstl_builtin),\
+    UT_CASE_BEGIN(_pair_key_init_ptr, test__pair_key_init_ptr__null_key),\
+    UT_CASE(test__pair_key_init_ptr__null_pair),\
+    UT_CASE(test__pair_key_init_ptr__null_value),\
+    UT_CASE(test__pair_key_init_ptr__c_builtin),\
+    UT_CASE(test__pair_key_init_ptr__cstr),\
+    UT_CASE(test__pair_key_init_ptr__libcstl_builtin),\
+    UT_CASE_BEGIN(_pair_key_destroy, test__pair_key_destroy__null_key),\
+    UT_CASE(test__pair_key_destroy__c_builtin),\
+    UT_CASE(test__pair_key_destroy__cstr)
 
 #endif /* _UT_CSTL_PAIR_AUX_H_ */
 
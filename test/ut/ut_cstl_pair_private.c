@@ -10,6 +10,9 @@
 #include "cstl/cvector.h"
 #include "cstl/cstl_pair_private.h"
 #include "cstl/cstl_pair.h"
+#include "cstl/clist.h"
+
+#include "cstl_pair_aux.h"
 
 #include "ut_def.h"
 #include "ut_cstl_pair_private.h"
@@ -629,3 +632,182 @@ void test__pair_make_second__user_define(void** state)
     pair_destroy(ppair);
 }
 
+/*
+ * test _pair_get_inline_size
+ */
+UT_CASE_DEFINATION(_pair_get_inline_size)
+void test__pair_get_inline_size__null_typeinfo(void** state)
+{
+    expect_assert_failure(_pair_get_inline_size(NULL));
+}
+
+void test__pair_get_inline_size__not_pair(void** state)
+{
+    _typeinfo_t t_typeinfo;
+
+    _type_get_type(&t_typeinfo, "vector_t<int>");
+    assert_true(_pair_get_inline_size(&t_typeinfo) == 0);
+}
+
+void test__pair_get_inline_size__c_builtin(void** state)
+{
+    _typeinfo_t t_typeinfo;
+
+    _type_get_type(&t_typeinfo, "pair_t<int, double>");
+    assert_true(_pair_get_inline_size(&t_typeinfo) == _PAIR_INLINE_SIZE(sizeof(int), sizeof(double)));
+}
+
+void test__pair_get_inline_size__cstr(void** state)
+{
+    _typeinfo_t t_typeinfo;
+
+    _type_get_type(&t_typeinfo, "pair_t<char*, int>");
+    assert_true(_pair_get_inline_size(&t_typeinfo) == _PAIR_INLINE_SIZE(sizeof(string_t), sizeof(int)));
+}
+
+void test__pair_get_inline_size__libcstl_builtin(void** state)
+{
+    _typeinfo_t t_typeinfo;
+
+    _type_get_type(&t_typeinfo, "pair_t<vector_t<int>, list_t<double>>");
+    assert_true(_pair_get_inline_size(&t_typeinfo) == _PAIR_INLINE_SIZE(sizeof(vector_t), sizeof(list_t)));
+}
+
+/*
+ * test _pair_is_inline_trivially_destructible
+ */
+UT_CASE_DEFINATION(_pair_is_inline_trivially_destructible)
+void test__pair_is_inline_trivially_destructible__null_typeinfo(void** state)
+{
+    expect_assert_failure(_pair_is_inline_trivially_destructible(NULL));
+}
+
+void test__pair_is_inline_trivially_destructible__not_pair(void** state)
+{
+    _typeinfo_t t_typeinfo;
+
+    _type_get_type(&t_typeinfo, "int");
+    assert_false(_pair_is_inline_trivially_destructible(&t_typeinfo));
+}
+
+void test__pair_is_inline_trivially_destructible__c_builtin(void** state)
+{
+    _typeinfo_t t_typeinfo;
+
+    _type_get_type(&t_typeinfo, "pair_t<int, double>");
+    assert_true(_pair_is_inline_trivially_destructible(&t_typeinfo));
+}
+
+void test__pair_is_inline_trivially_destructible__cstr(void** state)
+{
+    _typeinfo_t t_typeinfo;
+
+    _type_get_type(&t_typeinfo, "pair_t<int, char*>");
+    assert_false(_pair_is_inline_trivially_destructible(&t_typeinfo));
+}
+
+void test__pair_is_inline_trivially_destructible__libcstl_builtin(void** state)
+{
+    _typeinfo_t t_typeinfo;
+
+    _type_get_type(&t_typeinfo, "pair_t<vector_t<int>, int>");
+    assert_false(_pair_is_inline_trivially_destructible(&t_typeinfo));
+}
+
+/*
+ * test _pair_init_inline
+ */
+UT_CASE_DEFINATION(_pair_init_inline)
+void test__pair_init_inline__null_pair(void** state)
+{
+    expect_assert_failure(_pair_init_inline(NULL, "int, int"));
+}
+
+void test__pair_init_inline__null_typename(void** state)
+{
+    pair_t* ppair = malloc(sizeof(pair_t) + _PAIR_INLINE_SIZE(sizeof(int), sizeof(int)));
+
+    expect_assert_failure(_pair_init_inline(ppair, NULL));
+    free(ppair);
+}
+
+void test__pair_init_inline__c_builtin(void** state)
+{
+    pair_t* ppair = malloc(sizeof(pair_t) + _PAIR_INLINE_SIZE(sizeof(int), sizeof(double)));
+
+    _pair_init_inline(ppair, "int, double");
+    assert_true(_pair_is_inited(ppair));
+    assert_true(ppair->_b_inline);
+    assert_true(ppair->_pv_first == (void*)_PAIR_INLINE_STORAGE(ppair));
+    assert_true((_byte_t*)ppair->_pv_second == (_byte_t*)ppair->_pv_first + _PAIR_SECOND_OFFSET(sizeof(int)));
+    assert_true(*(int*)pair_first(ppair) == 0);
+    assert_true(*(double*)pair_second(ppair) == 0.0);
+
+    pair_make(ppair, 3, 4.5);
+    assert_true(*(int*)pair_first(ppair) == 3);
+    assert_true(*(double*)pair_second(ppair) == 4.5);
+
+    _pair_destroy_auxiliary(ppair);
+    assert_true(ppair->_pv_first == NULL);
+    assert_true(ppair->_pv_second == NULL);
+    assert_false(ppair->_b_inline);
+    free(ppair);
+}
+
+void test__pair_init_inline__cstr(void** state)
+{
+    pair_t* ppair = malloc(sizeof(pair_t) + _PAIR_INLINE_SIZE(sizeof(string_t), sizeof(int)));
+
+    _pair_init_inline(ppair, "char*, int");
+    assert_true(_pair_is_inited(ppair));
+    assert_true(ppair->_pv_first == (void*)_PAIR_INLINE_STORAGE(ppair));
+    assert_true(strcmp((char*)pair_first(ppair), "") == 0);
+
+    pair_make(ppair, "abc", 8);
+    assert_true(strcmp((char*)pair_first(ppair), "abc") == 0);
+    assert_true(*(int*)pair_second(ppair) == 8);
+
+    _pair_destroy_auxiliary(ppair);
+    free(ppair);
+}
+
+void test__pair_init_inline__libcstl_builtin(void** state)
+{
+    pair_t* ppair = malloc(sizeof(pair_t) + _PAIR_INLINE_SIZE(sizeof(vector_t), sizeof(list_t)));
+
+    _pair_init_inline(ppair, "vector_t<int>, list_t<double>");
+    assert_true(_pair_is_inited(ppair));
+    assert_true(ppair->_pv_first == (void*)_PAIR_INLINE_STORAGE(ppair));
+    assert_true(vector_empty((vector_t*)pair_first(ppair)));
+    assert_true(list_empty((list_t*)pair_second(ppair)));
+
+    vector_push_back((vector_t*)pair_first(ppair), 10);
+    list_push_back((list_t*)pair_second(ppair), 2.5);
+    assert_true(vector_size((vector_t*)pair_first(ppair)) == 1);
+    assert_true(list_size((list_t*)pair_second(ppair)) == 1);
+
+    _pair_destroy_auxiliary(ppair);
+    free(ppair);
+}
+
+void test__pair_init_inline__unaligned_pair(void** state)
+{
+    /* the pair in node follows the node header, it may be not aligned */
+    _byte_t* pby_node = malloc(sizeof(int) + sizeof(pair_t) + _PAIR_INLINE_SIZE(sizeof(int), sizeof(double)));
+    pair_t*  ppair = (pair_t*)(pby_node + sizeof(int));
+
+    _pair_init_inline(ppair, "int, double");
+    assert_true(_pair_is_inited(ppair));
+    assert_true((_byte_t*)ppair->_pv_first >= (_byte_t*)ppair + sizeof(pair_t));
+    assert_true((size_t)ppair->_pv_first % _PAIR_ALIGNMENT == 0);
+    assert_true((size_t)ppair->_pv_second % _PAIR_ALIGNMENT == 0);
+    assert_true((_byte_t*)ppair->_pv_second + sizeof(double) <=
+                pby_node + sizeof(int) + sizeof(pair_t) + _PAIR_INLINE_SIZE(sizeof(int), sizeof(double)));
+
+    pair_make(ppair, 3, 4.5);
+    assert_true(*(int*)pair_first(ppair) == 3);
+    assert_true(*(double*)pair_second(ppair) == 4.5);
+
+    _pair_destroy_auxiliary(ppair);
+    free(pby_node);
+}
@@ -80,6 +80,35 @@ void test__pair_make_second__str(void** state);
 void test__pair_make_second__libcstl_builtin(void** state);
 void test__pair_make_second__user_define(void** state);
 
+/*
+ * test _pair_get_inline_size
+ */
+UT_CASE_DECLARATION(_pair_get_inline_size)
+void test__pair_get_inline_size__null_typeinfo(void** state);
+void test__pair_get_inline_size__not_pair(void** state);
+void test__pair_get_inline_size__c_builtin(void** state);
+void test__pair_get_inline_size__cstr(void** state);
+void test__pair_get_inline_size__libcstl_builtin(void** state);
+/*
+ * test _pair_is_inline_trivially_destructible
+ */
+UT_CASE_DECLARATION(_pair_is_inline_trivially_destructible)
+void test__pair_is_inline_trivially_destructible__null_typeinfo(void** state);
+void test__pair_is_inline_trivially_destructible__not_pair(void** state);
+void test__pair_is_inline_trivially_destructible__c_builtin(void** state);
+void test__pair_is_inline_trivially_destructible__cstr(void** state);
+void test__pair_is_inline_trivially_destructible__libcstl_builtin(void** state);
+/*
+ * test _pair_init_inline
+ */
+UT_CASE_DECLARATION(_pair_init_inline)
+void test__pair_init_inline__null_pair(void** state);
+void test__pair_init_inline__null_typename(void** state);
+void test__pair_init_inline__c_builtin(void** state);
+void test__pair_init_inline__cstr(void** state);
+void test__pair_init_inline__libcstl_builtin(void** state);
+void test__pair_init_inline__unaligned_pair(void** state);
+
 #define UT_CSTL_PAIR_PRIVATE_CASE\
     UT_SUIT_BEGIN(cstl_pair_private, test__pair_is_created__null_pair),\
     UT_CASE(test__pair_is_created__invalid_first),\
@@ -129,7 +158,23 @@ void test__pair_make_second__user_define(void** state);
     UT_CASE(test__pair_make_second__c_builtin),\
     UT_CASE(test__pair_make_second__str),\
     UT_CASE(test__pair_make_second__libcstl_builtin),\
-    UT_CASE(test__pair_make_second__user_define)
+    UT_CASE(test__pair_make_second__user_define),\
+    UT_CASE_BEGIN(_pair_get_inline_size, test__pair_get_inline_size__null_typeinfo),\
+    UT_CASE(test__pair_get_inline_size__not_pair),\
+    UT_CASE(test__pair_get_inline_size__c_builtin),\
+    UT_CASE(test__pair_get_inline_size__cstr),\
+    UT_CASE(test__pair_get_inline_size__libcstl_builtin),\
+    UT_CASE_BEGIN(_pair_is_inline_trivially_destructible, test__pair_is_inline_trivially_destructible__null_typeinfo),\
+    UT_CASE(test__pair_is_inline_trivially_destructible__not_pair),\
+    UT_CASE(test__pair_is_inline_trivially_destructible__c_builtin),\
+    UT_CASE(test__pair_is_inline_trivially_destructible__cstr),\
+    UT_CASE(test__pair_is_inline_trivially_destructible__libcstl_builtin),\
+    UT_CASE_BEGIN(_pair_init_inline, test__pair_init_inline__null_pair),\
+    UT_CASE(test__pair_init_inline__null_typename),\
+    UT_CASE(test__pair_init_inline__c_builtin),\
+    UT_CASE(test__pair_init_inline__cstr),\
+    UT_CASE(test__pair_init_inline__libcstl_builtin),\
+    UT_CASE(test__pair_init_inline__unaligned_pair)
 
 #endif /* _UT_CSTL_PAIR_PRIVATE_H_ */
 
@@ -708,3 +708,45 @@ void test_priority_queue_init_copy_array_ex__not_empty_bfun_NULL(void** state)
     priority_queue_destroy(ppque);
 }
 
+/*
+ * test priority_queue_push_ptr
+ */
+UT_CASE_DEFINATION(priority_queue_push_ptr)
+void test_priority_queue_push_ptr__null_priority_queue(void** state)
+{
+    int elem = 9;
+
+    expect_assert_failure(priority_queue_push_ptr(NULL, &elem));
+}
+
+void test_priority_queue_push_ptr__c_builtin(void** state)
+{
+    priority_queue_t* ppque = create_priority_queue(int);
+    int an_elem[] = {4, 9, 1, 7, 3};
+    int i;
+
+    priority_queue_init(ppque);
+    for (i = 0; i < 5; ++i) {
+        priority_queue_push_ptr(ppque, &an_elem[i]);
+    }
+    assert_true(priority_queue_size(ppque) == 5);
+    assert_true(*(int*)priority_queue_top(ppque) == 9);
+    priority_queue_pop(ppque);
+    assert_true(*(int*)priority_queue_top(ppque) == 7);
+
+    priority_queue_destroy(ppque);
+}
+
+void test_priority_queue_push_ptr__cstr(void** state)
+{
+    priority_queue_t* ppque = create_priority_queue(char*);
+
+    priority_queue_init(ppque);
+    priority_queue_push_ptr(ppque, "abc");
+    priority_queue_push_ptr(ppque, "xyz");
+    priority_queue_push_ptr(ppque, "klm");
+    assert_true(strcmp((char*)priority_queue_top(ppque), "xyz") == 0);
+
+    priority_queue_destroy(ppque);
+}
+
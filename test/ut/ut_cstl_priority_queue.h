@@ -117,6 +117,13 @@ void test_priority_queue_init_copy_array_ex__not_empty(void** state);
 void test_priority_queue_init_copy_array_ex__empty_bfun_NULL(void** state);
 void test_priority_queue_init_copy_array_ex__not_empty_bfun_NULL(void** state);
 
+/*
+ * test priority_queue_push_ptr
+ */
+UT_CASE_DECLARATION(priority_queue_push_ptr)
+void test_priority_queue_push_ptr__null_priority_queue(void** state);
+void test_priority_queue_push_ptr__c_builtin(void** state);
+void test_priority_queue_push_ptr__cstr(void** state);
 #define UT_CSTL_PRIORITY_QUEUE_CASE\
     UT_SUIT_BEGIN(cstl_priority_queue, test_priority_queue_init__null),\
     UT_CASE(test_priority_queue_init__successfully),\
@@ -178,7 +185,10 @@ void test_priority_queue_init_copy_array_ex__not_empty_bfun_NULL(void** state);
     UT_CASE(test_priority_queue_init_copy_array_ex__empty),\
     UT_CASE(test_priority_queue_init_copy_array_ex__not_empty),\
     UT_CASE(test_priority_queue_init_copy_array_ex__empty_bfun_NULL),\
-    UT_CASE(test_priority_queue_init_copy_array_ex__not_empty_bfun_NULL)
+    UT_CASE(test_priority_queue_init_copy_array_ex__not_empty_bfun_NULL),\
+    UT_CASE_BEGIN(priority_queue_push_ptr, test_priority_queue_push_ptr__null_priority_queue),\
+    UT_CASE(test_priority_queue_push_ptr__c_builtin),\
+    UT_CASE(test_priority_queue_push_ptr__cstr)
 
 #endif /* _UT_CSTL_PRIORITY_QUEUE_H_ */
 
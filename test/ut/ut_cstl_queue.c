@@ -1771,3 +1771,59 @@ void test_queue_back__successfully(void** state)
     queue_destroy(pque);
 }
 
+/*
+ * test queue_push_ptr
+ */
+UT_CASE_DEFINATION(queue_push_ptr)
+void test_queue_push_ptr__null_queue(void** state)
+{
+    int elem = 9;
+
+    expect_assert_failure(queue_push_ptr(NULL, &elem));
+}
+
+void test_queue_push_ptr__c_builtin(void** state)
+{
+    queue_t* pt_queue = create_queue(int);
+    int elem;
+    int i;
+
+    queue_init(pt_queue);
+    for (i = 0; i < 100; ++i) {
+        elem = i;
+        queue_push_ptr(pt_queue, &elem);
+        assert_true(*(int*)queue_back(pt_queue) == i);
+    }
+    assert_true(queue_size(pt_queue) == 100);
+
+    queue_destroy(pt_queue);
+}
+
+void test_queue_push_ptr__cstr(void** state)
+{
+    queue_t* pt_queue = create_queue(char*);
+
+    queue_init(pt_queue);
+    queue_push_ptr(pt_queue, "abc");
+    queue_push_ptr(pt_queue, "defg");
+    assert_true(strcmp((char*)queue_back(pt_queue), "defg") == 0);
+    assert_true(queue_size(pt_queue) == 2);
+
+    queue_destroy(pt_queue);
+}
+
+void test_queue_push_ptr__libcstl_builtin(void** state)
+{
+    queue_t* pt_queue = create_queue(list_t<int>);
+    list_t* plist_list = create_list(int);
+
+    queue_init(pt_queue);
+    list_init_n(plist_list, 5);
+    queue_push_ptr(pt_queue, plist_list);
+    assert_true(list_equal((list_t*)queue_back(pt_queue), plist_list));
+    assert_true((list_t*)queue_back(pt_queue) != plist_list);
+
+    queue_destroy(pt_queue);
+    list_destroy(plist_list);
+}
+
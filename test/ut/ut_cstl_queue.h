@@ -186,6 +186,14 @@ void test_queue_back__non_inited_queue_adaptor(void** state);
 void test_queue_back__empty(void** state);
 void test_queue_back__successfully(void** state);
 
+/*
+ * test queue_push_ptr
+ */
+UT_CASE_DECLARATION(queue_push_ptr)
+void test_queue_push_ptr__null_queue(void** state);
+void test_queue_push_ptr__c_builtin(void** state);
+void test_queue_push_ptr__cstr(void** state);
+void test_queue_push_ptr__libcstl_builtin(void** state);
 #define UT_CSTL_QUEUE_CASE\
     UT_SUIT_BEGIN(cstl_queue, test_queue_init__null_queue_adaptor),\
     UT_CASE(test_queue_init__non_created_queue_adaptor),\
@@ -308,7 +316,11 @@ void test_queue_back__successfully(void** state);
     UT_CASE_BEGIN(queue_back, test_queue_back__null_queue_adaptor),\
     UT_CASE(test_queue_back__non_inited_queue_adaptor),\
     UT_CASE(test_queue_back__empty),\
-    UT_CASE(test_queue_back__successfully)
+    UT_CASE(test_queue_back__successfully),\
+    UT_CASE_BEGIN(queue_push_ptr, test_queue_push_ptr__null_queue),\
+    UT_CASE(test_queue_push_ptr__c_builtin),\
+    UT_CASE(test_queue_push_ptr__cstr),\
+    UT_CASE(test_queue_push_ptr__libcstl_builtin)
 
 #endif /* _UT_CSTL_QUEUE_H_ */
 
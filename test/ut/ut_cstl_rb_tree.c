@@ -1597,6 +1597,50 @@ void test__rb_tree_max_size__non_empty(void** state)
     _rb_tree_destroy(pt_rb_tree);
 }
 
+/*
+ * test _rb_tree_memory_usage
+ */
+UT_CASE_DEFINATION(_rb_tree_memory_usage)
+void test__rb_tree_memory_usage__null_rb_tree(void** state)
+{
+    expect_assert_failure(_rb_tree_memory_usage(NULL));
+}
+
+void test__rb_tree_memory_usage__non_inited(void** state)
+{
+    _rb_tree_t* pt_rb_tree = _create_rb_tree("int");
+    _rb_tree_init(pt_rb_tree, NULL);
+
+    pt_rb_tree->_t_rbroot._t_color = _COLOR_BLACK;
+    expect_assert_failure(_rb_tree_memory_usage(pt_rb_tree));
+    pt_rb_tree->_t_rbroot._t_color = _COLOR_RED;
+
+    _rb_tree_destroy(pt_rb_tree);
+}
+
+void test__rb_tree_memory_usage__empty(void** state)
+{
+    _rb_tree_t* pt_rb_tree = _create_rb_tree("int");
+    _rb_tree_init(pt_rb_tree, NULL);
+
+    assert_true(_rb_tree_memory_usage(pt_rb_tree) == 0);
+
+    _rb_tree_destroy(pt_rb_tree);
+}
+
+void test__rb_tree_memory_usage__non_empty(void** state)
+{
+    _rb_tree_t* pt_rb_tree = _create_rb_tree("int");
+    int elem = 9;
+
+    _rb_tree_init(pt_rb_tree, NULL);
+    _rb_tree_insert_unique(pt_rb_tree, &elem);
+
+    assert_true(_rb_tree_memory_usage(pt_rb_tree) >= sizeof(int));
+
+    _rb_tree_destroy(pt_rb_tree);
+}
+
 /*
  * test _rb_tree_begin
  */
@@ -1964,6 +2008,152 @@ void test__rb_tree_find__user_define_not_find(void** state)
     _rb_tree_destroy(pt_rb_tree);
 }
 
+/*
+ * test _rb_tree_find_batch
+ */
+UT_CASE_DEFINATION(_rb_tree_find_batch)
+void test__rb_tree_find_batch__null_rb_tree(void** state)
+{
+    const void* acpv_value[1];
+    _rb_tree_iterator_t at_iter[1];
+    int elem = 9;
+
+    acpv_value[0] = &elem;
+    expect_assert_failure(_rb_tree_find_batch(NULL, acpv_value, 1, at_iter));
+}
+
+void test__rb_tree_find_batch__null_values(void** state)
+{
+    _rb_tree_t* pt_rb_tree = _create_rb_tree("int");
+    _rb_tree_iterator_t at_iter[1];
+
+    _rb_tree_init(pt_rb_tree, NULL);
+    expect_assert_failure(_rb_tree_find_batch(pt_rb_tree, NULL, 1, at_iter));
+
+    _rb_tree_destroy(pt_rb_tree);
+}
+
+void test__rb_tree_find_batch__null_result(void** state)
+{
+    _rb_tree_t* pt_rb_tree = _create_rb_tree("int");
+    const void* acpv_value[1];
+    int elem = 9;
+
+    _rb_tree_init(pt_rb_tree, NULL);
+    acpv_value[0] = &elem;
+    expect_assert_failure(_rb_tree_find_batch(pt_rb_tree, acpv_value, 1, NULL));
+
+    _rb_tree_destroy(pt_rb_tree);
+}
+
+void test__rb_tree_find_batch__non_inited(void** state)
+{
+    _rb_tree_t* pt_rb_tree = _create_rb_tree("int");
+    const void* acpv_value[1];
+    _rb_tree_iterator_t at_iter[1];
+    int elem = 9;
+
+    _rb_tree_init(pt_rb_tree, NULL);
+    acpv_value[0] = &elem;
+    pt_rb_tree->_t_rbroot._t_color = _COLOR_BLACK;
+    expect_assert_failure(_rb_tree_find_batch(pt_rb_tree, acpv_value, 1, at_iter));
+    pt_rb_tree->_t_rbroot._t_color = _COLOR_RED;
+
+    _rb_tree_destroy(pt_rb_tree);
+}
+
+void test__rb_tree_find_batch__empty(void** state)
+{
+    _rb_tree_t* pt_rb_tree = _create_rb_tree("int");
+    const void* acpv_value[2];
+    _rb_tree_iterator_t at_iter[2];
+    int an_elem[2] = {1, 2};
+
+    _rb_tree_init(pt_rb_tree, NULL);
+    acpv_value[0] = &an_elem[0];
+    acpv_value[1] = &an_elem[1];
+    _rb_tree_find_batch(pt_rb_tree, acpv_value, 2, at_iter);
+    assert_true(_rb_tree_iterator_equal(at_iter[0], _rb_tree_end(pt_rb_tree)));
+    assert_true(_rb_tree_iterator_equal(at_iter[1], _rb_tree_end(pt_rb_tree)));
+
+    _rb_tree_destroy(pt_rb_tree);
+}
+
+void test__rb_tree_find_batch__c_builtin(void** state)
+{
+    _rb_tree_t* pt_rb_tree = _create_rb_tree("int");
+    const void* acpv_value[40];
+    _rb_tree_iterator_t at_iter[40];
+    int an_elem[40];
+    int i;
+
+    _rb_tree_init(pt_rb_tree, NULL);
+    for (i = 0; i < 40; i += 2) {
+        _rb_tree_insert_unique(pt_rb_tree, &i);
+    }
+    for (i = 0; i < 40; ++i) {
+        an_elem[i] = 39 - i;
+        acpv_value[i] = &an_elem[i];
+    }
+    _rb_tree_find_batch(pt_rb_tree, acpv_value, 40, at_iter);
+    for (i = 0; i < 40; ++i) {
+        if (an_elem[i] % 2 == 0) {
+            assert_true(*(int*)_rb_tree_iterator_get_pointer(at_iter[i]) == an_elem[i]);
+        } else {
+            assert_true(_rb_tree_iterator_equal(at_iter[i], _rb_tree_end(pt_rb_tree)));
+        }
+    }
+
+    _rb_tree_destroy(pt_rb_tree);
+}
+
+void test__rb_tree_find_batch__cstr(void** state)
+{
+    _rb_tree_t* pt_rb_tree = _create_rb_tree("char*");
+    string_t* pstr_abc = create_string();
+    string_t* pstr_xyz = create_string();
+    const void* acpv_value[2];
+    _rb_tree_iterator_t at_iter[2];
+
+    _rb_tree_init(pt_rb_tree, NULL);
+    string_init_cstr(pstr_abc, "abc");
+    string_init_cstr(pstr_xyz, "xyz");
+    _rb_tree_insert_unique(pt_rb_tree, pstr_abc);
+    acpv_value[0] = pstr_xyz;
+    acpv_value[1] = pstr_abc;
+    _rb_tree_find_batch(pt_rb_tree, acpv_value, 2, at_iter);
+    assert_true(_rb_tree_iterator_equal(at_iter[0], _rb_tree_end(pt_rb_tree)));
+    assert_true(strcmp((char*)_rb_tree_iterator_get_pointer(at_iter[1]), "abc") == 0);
+
+    _rb_tree_destroy(pt_rb_tree);
+    string_destroy(pstr_abc);
+    string_destroy(pstr_xyz);
+}
+
+void test__rb_tree_find_batch__large(void** state)
+{
+    _rb_tree_t* pt_rb_tree = _create_rb_tree("int");
+    const void* acpv_value[1000];
+    _rb_tree_iterator_t at_iter[1000];
+    int an_elem[1000];
+    int i;
+
+    _rb_tree_init(pt_rb_tree, NULL);
+    for (i = 0; i < 1000; i += 3) {
+        _rb_tree_insert_unique(pt_rb_tree, &i);
+    }
+    for (i = 0; i < 1000; ++i) {
+        an_elem[i] = (i * 7) % 1000;
+        acpv_value[i] = &an_elem[i];
+    }
+    _rb_tree_find_batch(pt_rb_tree, acpv_value, 1000, at_iter);
+    for (i = 0; i < 1000; ++i) {
+        assert_true(_rb_tree_iterator_equal(at_iter[i], _rb_tree_find(pt_rb_tree, &an_elem[i])));
+    }
+
+    _rb_tree_destroy(pt_rb_tree);
+}
+
 /*
  * test _rb_tree_clear
  */
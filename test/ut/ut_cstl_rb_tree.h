@@ -176,6 +176,14 @@ void test__rb_tree_max_size__null_rb_tree(void** state);
 void test__rb_tree_max_size__non_inited(void** state);
 void test__rb_tree_max_size__empty(void** state);
 void test__rb_tree_max_size__non_empty(void** state);
+/*
+ * test _rb_tree_memory_usage
+ */
+UT_CASE_DECLARATION(_rb_tree_memory_usage)
+void test__rb_tree_memory_usage__null_rb_tree(void** state);
+void test__rb_tree_memory_usage__non_inited(void** state);
+void test__rb_tree_memory_usage__empty(void** state);
+void test__rb_tree_memory_usage__non_empty(void** state);
 /*
  * test _rb_tree_begin
  */
@@ -215,6 +223,18 @@ void test__rb_tree_find__libcstl_builtin_find(void** state);
 void test__rb_tree_find__libcstl_builtin_not_find(void** state);
 void test__rb_tree_find__user_define_find(void** state);
 void test__rb_tree_find__user_define_not_find(void** state);
+/*
+ * test _rb_tree_find_batch
+ */
+UT_CASE_DECLARATION(_rb_tree_find_batch)
+void test__rb_tree_find_batch__null_rb_tree(void** state);
+void test__rb_tree_find_batch__null_values(void** state);
+void test__rb_tree_find_batch__null_result(void** state);
+void test__rb_tree_find_batch__non_inited(void** state);
+void test__rb_tree_find_batch__empty(void** state);
+void test__rb_tree_find_batch__c_builtin(void** state);
+void test__rb_tree_find_batch__cstr(void** state);
+void test__rb_tree_find_batch__large(void** state);
 /*
  * test _rb_tree_clear
  */
@@ -648,6 +668,10 @@ void test__rb_tree_erase__user_define_n(void** state);
     UT_CASE(test__rb_tree_max_size__non_inited),\
     UT_CASE(test__rb_tree_max_size__empty),\
     UT_CASE(test__rb_tree_max_size__non_empty),\
+    UT_CASE_BEGIN(_rb_tree_memory_usage, test__rb_tree_memory_usage__null_rb_tree),\
+    UT_CASE(test__rb_tree_memory_usage__non_inited),\
+    UT_CASE(test__rb_tree_memory_usage__empty),\
+    UT_CASE(test__rb_tree_memory_usage__non_empty),\
     UT_CASE_BEGIN(_rb_tree_begin, test__rb_tree_begin__null_rb_tree),\
     UT_CASE(test__rb_tree_begin__non_inited),\
     UT_CASE(test__rb_tree_begin__empty),\
@@ -671,6 +695,14 @@ void test__rb_tree_erase__user_define_n(void** state);
     UT_CASE(test__rb_tree_find__libcstl_builtin_not_find),\
     UT_CASE(test__rb_tree_find__user_define_find),\
     UT_CASE(test__rb_tree_find__user_define_not_find),\
+    UT_CASE_BEGIN(_rb_tree_find_batch, test__rb_tree_find_batch__null_rb_tree),\
+    UT_CASE(test__rb_tree_find_batch__null_values),\
+    UT_CASE(test__rb_tree_find_batch__null_result),\
+    UT_CASE(test__rb_tree_find_batch__non_inited),\
+    UT_CASE(test__rb_tree_find_batch__empty),\
+    UT_CASE(test__rb_tree_find_batch__c_builtin),\
+    UT_CASE(test__rb_tree_find_batch__cstr),\
+    UT_CASE(test__rb_tree_find_batch__large),\
     UT_CASE_BEGIN(_rb_tree_clear, test__rb_tree_clear__null_rb_tree),\
     UT_CASE(test__rb_tree_clear__non_inited),\
     UT_CASE(test__rb_tree_clear__empty),\
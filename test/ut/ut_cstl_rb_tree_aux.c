@@ -15,6 +15,8 @@
 #include "cstl/cvector.h"
 #include "cstl/clist.h"
 #include "cstl/cslist.h"
+#include "cstl/cutility.h"
+#include "cstl_pair_aux.h"
 
 #include "ut_def.h"
 #include "ut_cstl_rb_tree_aux.h"
@@ -5937,3 +5939,127 @@ void test__rb_tree_elem_compare_auxiliary__cstr(void** state)
     string_destroy(pstr_second);
 }
 
+/*
+ * test _rb_tree_elem_three_way_compare_auxiliary
+ */
+UT_CASE_DEFINATION(_rb_tree_elem_three_way_compare_auxiliary)
+void test__rb_tree_elem_three_way_compare_auxiliary__null_rb_tree(void** state)
+{
+    int n_first = 0;
+    int n_second = 0;
+    expect_assert_failure(_rb_tree_elem_three_way_compare_auxiliary(NULL, &n_first, &n_second));
+}
+
+void test__rb_tree_elem_three_way_compare_auxiliary__null_first(void** state)
+{
+    int n_second = 0;
+    _rb_tree_t* pt_rb_tree = _create_rb_tree("int");
+    _rb_tree_init(pt_rb_tree, NULL);
+
+    expect_assert_failure(_rb_tree_elem_three_way_compare_auxiliary(pt_rb_tree, NULL, &n_second));
+
+    _rb_tree_destroy(pt_rb_tree);
+}
+
+void test__rb_tree_elem_three_way_compare_auxiliary__null_second(void** state)
+{
+    int n_first = 0;
+    _rb_tree_t* pt_rb_tree = _create_rb_tree("int");
+    _rb_tree_init(pt_rb_tree, NULL);
+
+    expect_assert_failure(_rb_tree_elem_three_way_compare_auxiliary(pt_rb_tree, &n_first, NULL));
+
+    _rb_tree_destroy(pt_rb_tree);
+}
+
+void test__rb_tree_elem_three_way_compare_auxiliary__int(void** state)
+{
+    int n_first = 5;
+    int n_second = 9;
+    _rb_tree_t* pt_rb_tree = _create_rb_tree("int");
+    _rb_tree_init(pt_rb_tree, NULL);
+
+    assert_true(_rb_tree_elem_three_way_compare_auxiliary(pt_rb_tree, &n_first, &n_second) < 0);
+    assert_true(_rb_tree_elem_three_way_compare_auxiliary(pt_rb_tree, &n_second, &n_first) > 0);
+    assert_true(_rb_tree_elem_three_way_compare_auxiliary(pt_rb_tree, &n_first, &n_first) == 0);
+
+    _rb_tree_destroy(pt_rb_tree);
+}
+
+static void _test__rb_tree_elem_three_way_compare_auxiliary__greater(
+    const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    *(bool_t*)pv_output = *(int*)cpv_first > *(int*)cpv_second ? true : false;
+}
+void test__rb_tree_elem_three_way_compare_auxiliary__user_compare(void** state)
+{
+    int n_first = 5;
+    int n_second = 9;
+    _rb_tree_t* pt_rb_tree = _create_rb_tree("int");
+    _rb_tree_init(pt_rb_tree, _test__rb_tree_elem_three_way_compare_auxiliary__greater);
+
+    assert_true(_rb_tree_elem_three_way_compare_auxiliary(pt_rb_tree, &n_first, &n_second) > 0);
+    assert_true(_rb_tree_elem_three_way_compare_auxiliary(pt_rb_tree, &n_second, &n_first) < 0);
+    assert_true(_rb_tree_elem_three_way_compare_auxiliary(pt_rb_tree, &n_first, &n_first) == 0);
+
+    _rb_tree_destroy(pt_rb_tree);
+}
+
+/*
+ * test _rb_tree_init_node_auxiliary
+ */
+UT_CASE_DEFINATION(_rb_tree_init_node_auxiliary)
+void test__rb_tree_init_node_auxiliary__null_rb_tree(void** state)
+{
+    _rbnode_t node;
+    expect_assert_failure(_rb_tree_init_node_auxiliary(NULL, &node));
+}
+
+void test__rb_tree_init_node_auxiliary__null_node(void** state)
+{
+    _rb_tree_t* pt_rb_tree = _create_rb_tree("int");
+    _rb_tree_init(pt_rb_tree, NULL);
+
+    expect_assert_failure(_rb_tree_init_node_auxiliary(pt_rb_tree, NULL));
+
+    _rb_tree_destroy(pt_rb_tree);
+}
+
+void test__rb_tree_init_node_auxiliary__c_builtin(void** state)
+{
+    _rbnode_t* p = NULL;
+    _rb_tree_t* pt_rb_tree = _create_rb_tree("int");
+    _rb_tree_init(pt_rb_tree, NULL);
+    p = malloc(pt_rb_tree->_t_nodesize);
+
+    assert_true(pt_rb_tree->_t_nodesize == _RB_TREE_NODE_SIZE(_GET_RB_TREE_TYPE_SIZE(pt_rb_tree)));
+    *(int*)p->_pby_data = 100;
+    _rb_tree_init_node_auxiliary(pt_rb_tree, p);
+    assert_true(*(int*)p->_pby_data == 0);
+
+    free(p);
+    _rb_tree_destroy(pt_rb_tree);
+}
+
+void test__rb_tree_init_node_auxiliary__pair(void** state)
+{
+    _rbnode_t* p = NULL;
+    pair_t* ppair = NULL;
+    _rb_tree_t* pt_rb_tree = _create_rb_tree("pair_t<int, vector_t<int>>");
+    _rb_tree_init(pt_rb_tree, NULL);
+    p = malloc(pt_rb_tree->_t_nodesize);
+
+    assert_true(pt_rb_tree->_t_nodesize ==
+        _RB_TREE_NODE_SIZE(_GET_RB_TREE_TYPE_SIZE(pt_rb_tree)) + _pair_get_inline_size(&pt_rb_tree->_t_typeinfo));
+    _rb_tree_init_node_auxiliary(pt_rb_tree, p);
+    ppair = (pair_t*)p->_pby_data;
+    assert_true(_pair_is_inited(ppair));
+    assert_true(ppair->_pv_first == (void*)_PAIR_INLINE_STORAGE(ppair));
+    assert_true((_byte_t*)ppair->_pv_second + sizeof(vector_t) <= (_byte_t*)p + pt_rb_tree->_t_nodesize);
+    assert_true(*(int*)pair_first(ppair) == 0);
+    assert_true(vector_empty((vector_t*)pair_second(ppair)));
+
+    _pair_destroy_auxiliary(ppair);
+    free(p);
+    _rb_tree_destroy(pt_rb_tree);
+}
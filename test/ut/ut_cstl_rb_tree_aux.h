@@ -251,6 +251,24 @@ void test__rb_tree_elem_compare_auxiliary__null_output(void** state);
 void test__rb_tree_elem_compare_auxiliary__non_inited(void** state);
 void test__rb_tree_elem_compare_auxiliary__int(void** state);
 void test__rb_tree_elem_compare_auxiliary__cstr(void** state);
+/*
+ * test _rb_tree_elem_three_way_compare_auxiliary
+ */
+UT_CASE_DECLARATION(_rb_tree_elem_three_way_compare_auxiliary)
+void test__rb_tree_elem_three_way_compare_auxiliary__null_rb_tree(void** state);
+void test__rb_tree_elem_three_way_compare_auxiliary__null_first(void** state);
+void test__rb_tree_elem_three_way_compare_auxiliary__null_second(void** state);
+void test__rb_tree_elem_three_way_compare_auxiliary__int(void** state);
+void test__rb_tree_elem_three_way_compare_auxiliary__user_compare(void** state);
+
+/*
+ * test _rb_tree_init_node_auxiliary
+ */
+UT_CASE_DECLARATION(_rb_tree_init_node_auxiliary)
+void test__rb_tree_init_node_auxiliary__null_rb_tree(void** state);
+void test__rb_tree_init_node_auxiliary__null_node(void** state);
+void test__rb_tree_init_node_auxiliary__c_builtin(void** state);
+void test__rb_tree_init_node_auxiliary__pair(void** state);
 
 #define UT_CSTL_RB_TREE_AUX_CASE\
     UT_SUIT_BEGIN(cstl_rb_tree_aux, test__rb_tree_is_created__null_rb_tree),\
@@ -417,7 +435,16 @@ void test__rb_tree_elem_compare_auxiliary__cstr(void** state);
     UT_CASE(test__rb_tree_elem_compare_auxiliary__null_output),\
     UT_CASE(test__rb_tree_elem_compare_auxiliary__non_inited),\
     UT_CASE(test__rb_tree_elem_compare_auxiliary__int),\
-    UT_CASE(test__rb_tree_elem_compare_auxiliary__cstr)
+    UT_CASE(test__rb_tree_elem_compare_auxiliary__cstr),\
+    UT_CASE_BEGIN(_rb_tree_elem_three_way_compare_auxiliary, test__rb_tree_elem_three_way_compare_auxiliary__null_rb_tree),\
+    UT_CASE(test__rb_tree_elem_three_way_compare_auxiliary__null_first),\
+    UT_CASE(test__rb_tree_elem_three_way_compare_auxiliary__null_second),\
+    UT_CASE(test__rb_tree_elem_three_way_compare_auxiliary__int),\
+    UT_CASE(test__rb_tree_elem_three_way_compare_auxiliary__user_compare),\
+    UT_CASE_BEGIN(_rb_tree_init_node_auxiliary, test__rb_tree_init_node_auxiliary__null_rb_tree),\
+    UT_CASE(test__rb_tree_init_node_auxiliary__null_node),\
+    UT_CASE(test__rb_tree_init_node_auxiliary__c_builtin),\
+    UT_CASE(test__rb_tree_init_node_auxiliary__pair)
 
 #endif /* _UT_CSTL_RB_TREE_AUX_H_ */
 
@@ -1272,6 +1272,59 @@ void test_set_max_size__non_empty(void** state)
     set_destroy(pt_set);
 }
 
+/*
+ * test set_memory_usage
+ */
+UT_CASE_DEFINATION(set_memory_usage)
+void test_set_memory_usage__null_set(void** state)
+{
+    expect_assert_failure(set_memory_usage(NULL));
+}
+
+void test_set_memory_usage__non_inited(void** state)
+{
+    set_t* pt_set = create_set(int);
+    set_init_ex(pt_set, NULL);
+
+#ifdef CSTL_SET_AVL_TREE
+    pt_set->_t_tree._t_avlroot._un_height = 9;
+    expect_assert_failure(set_memory_usage(pt_set));
+    pt_set->_t_tree._t_avlroot._un_height = 0;
+#else
+    pt_set->_t_tree._t_rbroot._t_color = _COLOR_BLACK;
+    expect_assert_failure(set_memory_usage(pt_set));
+    pt_set->_t_tree._t_rbroot._t_color = _COLOR_RED;
+#endif
+
+    set_destroy(pt_set);
+}
+
+void test_set_memory_usage__empty(void** state)
+{
+    set_t* pt_set = create_set(int);
+    set_init_ex(pt_set, NULL);
+
+    assert_true(set_memory_usage(pt_set) >= sizeof(set_t));
+
+    set_destroy(pt_set);
+}
+
+void test_set_memory_usage__non_empty(void** state)
+{
+    set_t* pt_set = create_set(int);
+    size_t t_usage = 0;
+    int i = 0;
+
+    set_init(pt_set);
+    t_usage = set_memory_usage(pt_set);
+    for (i = 0; i < 100; ++i) {
+        set_insert(pt_set, i);
+    }
+    assert_true(set_memory_usage(pt_set) >= t_usage + 100 * sizeof(int));
+
+    set_destroy(pt_set);
+}
+
 /*
  * test set_begin
  */
@@ -3885,3 +3938,334 @@ void test_set_erase_range__all(void** state)
     set_destroy(pt_dest);
 }
 
+/*
+ * test set_find_ptr
+ */
+UT_CASE_DEFINATION(set_find_ptr)
+void test_set_find_ptr__null_set(void** state)
+{
+    int elem = 9;
+
+    expect_assert_failure(set_find_ptr(NULL, &elem));
+}
+
+void test_set_find_ptr__null_value(void** state)
+{
+    set_t* pt_set = create_set(int);
+
+    set_init(pt_set);
+    expect_assert_failure(set_find_ptr(pt_set, NULL));
+
+    set_destroy(pt_set);
+}
+
+void test_set_find_ptr__c_builtin(void** state)
+{
+    set_t* pt_set = create_set(int);
+    set_iterator_t it_iter;
+    int elem;
+    int i;
+
+    set_init(pt_set);
+    for (i = 0; i < 10; ++i) {
+        set_insert(pt_set, i);
+    }
+
+    elem = 2;
+    it_iter = set_find_ptr(pt_set, &elem);
+    assert_true(*(int*)iterator_get_pointer(it_iter) == 2);
+    elem = 42;
+    it_iter = set_find_ptr(pt_set, &elem);
+    assert_true(iterator_equal(it_iter, set_end(pt_set)));
+
+    set_destroy(pt_set);
+}
+
+void test_set_find_ptr__cstr(void** state)
+{
+    set_t* pt_set = create_set(char*);
+    set_iterator_t it_iter;
+
+    set_init(pt_set);
+    set_insert(pt_set, "aaa");
+    set_insert(pt_set, "ggg");
+    set_insert(pt_set, "linux");
+
+    it_iter = set_find_ptr(pt_set, "ggg");
+    assert_true(strcmp((char*)iterator_get_pointer(it_iter), "ggg") == 0);
+    it_iter = set_find_ptr(pt_set, "unix");
+    assert_true(iterator_equal(it_iter, set_end(pt_set)));
+
+    set_destroy(pt_set);
+}
+
+void test_set_find_ptr__libcstl_builtin(void** state)
+{
+    set_t* pt_set = create_set(vector_t<int>);
+    vector_t* pvec_vector = create_vector(int);
+    set_iterator_t it_iter;
+
+    set_init(pt_set);
+    vector_init_n(pvec_vector, 3);
+    set_insert(pt_set, pvec_vector);
+
+    it_iter = set_find_ptr(pt_set, pvec_vector);
+    assert_true(vector_equal((vector_t*)iterator_get_pointer(it_iter), pvec_vector));
+    vector_push_back(pvec_vector, 1);
+    it_iter = set_find_ptr(pt_set, pvec_vector);
+    assert_true(iterator_equal(it_iter, set_end(pt_set)));
+
+    set_destroy(pt_set);
+    vector_destroy(pvec_vector);
+}
+
+/*
+ * test set_insert_ptr
+ */
+UT_CASE_DEFINATION(set_insert_ptr)
+void test_set_insert_ptr__null_set(void** state)
+{
+    int elem = 9;
+
+    expect_assert_failure(set_insert_ptr(NULL, &elem));
+}
+
+void test_set_insert_ptr__null_value(void** state)
+{
+    set_t* pt_set = create_set(int);
+
+    set_init(pt_set);
+    expect_assert_failure(set_insert_ptr(pt_set, NULL));
+
+    set_destroy(pt_set);
+}
+
+void test_set_insert_ptr__c_builtin(void** state)
+{
+    set_t* pt_set = create_set(int);
+    set_iterator_t it_iter;
+    int elem = 7;
+
+    set_init(pt_set);
+    it_iter = set_insert_ptr(pt_set, &elem);
+    assert_true(*(int*)iterator_get_pointer(it_iter) == 7);
+    assert_true(set_size(pt_set) == 1);
+    it_iter = set_insert_ptr(pt_set, &elem);
+    assert_true(iterator_equal(it_iter, set_end(pt_set)));
+    assert_true(set_size(pt_set) == 1);
+
+    set_destroy(pt_set);
+}
+
+void test_set_insert_ptr__cstr(void** state)
+{
+    set_t* pt_set = create_set(char*);
+    set_iterator_t it_iter;
+
+    set_init(pt_set);
+    it_iter = set_insert_ptr(pt_set, "libcstl");
+    assert_true(strcmp((char*)iterator_get_pointer(it_iter), "libcstl") == 0);
+    assert_true(set_count(pt_set, "libcstl") == 1);
+
+    set_destroy(pt_set);
+}
+
+void test_set_insert_ptr__libcstl_builtin(void** state)
+{
+    set_t* pt_set = create_set(list_t<int>);
+    list_t* plist_list = create_list(int);
+    set_iterator_t it_iter;
+
+    set_init(pt_set);
+    list_init_n(plist_list, 5);
+    it_iter = set_insert_ptr(pt_set, plist_list);
+    assert_true(list_equal((list_t*)iterator_get_pointer(it_iter), plist_list));
+    assert_true((list_t*)iterator_get_pointer(it_iter) != plist_list);
+
+    set_destroy(pt_set);
+    list_destroy(plist_list);
+}
+
+/*
+ * test set_count_ptr
+ */
+UT_CASE_DEFINATION(set_count_ptr)
+void test_set_count_ptr__null_set(void** state)
+{
+    int elem = 9;
+
+    expect_assert_failure(set_count_ptr(NULL, &elem));
+}
+
+void test_set_count_ptr__c_builtin(void** state)
+{
+    set_t* pt_set = create_set(int);
+    int elem = 3;
+
+    set_init(pt_set);
+    set_insert(pt_set, 3);
+    set_insert(pt_set, 3);
+    set_insert(pt_set, 5);
+    assert_true(set_count_ptr(pt_set, &elem) == 1);
+    elem = 4;
+    assert_true(set_count_ptr(pt_set, &elem) == 0);
+
+    set_destroy(pt_set);
+}
+
+void test_set_count_ptr__cstr(void** state)
+{
+    set_t* pt_set = create_set(char*);
+
+    set_init(pt_set);
+    set_insert(pt_set, "abc");
+    assert_true(set_count_ptr(pt_set, "abc") == 1);
+    assert_true(set_count_ptr(pt_set, "abcd") == 0);
+
+    set_destroy(pt_set);
+}
+
+/*
+ * test set_find_batch
+ */
+UT_CASE_DEFINATION(set_find_batch)
+void test_set_find_batch__null_set(void** state)
+{
+    int an_elem[1] = {9};
+    set_iterator_t at_iter[1];
+
+    expect_assert_failure(set_find_batch(NULL, an_elem, 1, at_iter));
+}
+
+void test_set_find_batch__null_values(void** state)
+{
+    set_t* pt_set = create_set(int);
+    set_iterator_t at_iter[1];
+
+    set_init(pt_set);
+    expect_assert_failure(set_find_batch(pt_set, NULL, 1, at_iter));
+
+    set_destroy(pt_set);
+}
+
+void test_set_find_batch__null_result(void** state)
+{
+    set_t* pt_set = create_set(int);
+    int an_elem[1] = {9};
+
+    set_init(pt_set);
+    expect_assert_failure(set_find_batch(pt_set, an_elem, 1, NULL));
+
+    set_destroy(pt_set);
+}
+
+void test_set_find_batch__c_builtin(void** state)
+{
+    set_t* pt_set = create_set(int);
+    int an_elem[100];
+    set_iterator_t at_iter[100];
+    int i;
+
+    set_init(pt_set);
+    for (i = 0; i < 100; i += 2) {
+        set_insert(pt_set, i);
+    }
+    for (i = 0; i < 100; ++i) {
+        an_elem[i] = 99 - i;
+    }
+
+    set_find_batch(pt_set, an_elem, 100, at_iter);
+    for (i = 0; i < 100; ++i) {
+        if (an_elem[i] % 2 == 0) {
+            assert_true(*(int*)iterator_get_pointer(at_iter[i]) == an_elem[i]);
+            assert_true(iterator_equal(at_iter[i], set_find(pt_set, an_elem[i])));
+        } else {
+            assert_true(iterator_equal(at_iter[i], set_end(pt_set)));
+        }
+    }
+
+    set_destroy(pt_set);
+}
+
+void test_set_find_batch__cstr(void** state)
+{
+    set_t* pt_set = create_set(char*);
+    const char* as_elem[3] = {"def", "xyz", "abc"};
+    set_iterator_t at_iter[3];
+
+    set_init(pt_set);
+    set_insert(pt_set, "abc");
+    set_insert(pt_set, "def");
+
+    set_find_batch(pt_set, as_elem, 3, at_iter);
+    assert_true(strcmp((char*)iterator_get_pointer(at_iter[0]), "def") == 0);
+    assert_true(iterator_equal(at_iter[1], set_end(pt_set)));
+    assert_true(strcmp((char*)iterator_get_pointer(at_iter[2]), "abc") == 0);
+
+    set_destroy(pt_set);
+}
+
+void test_set_find_batch__libcstl_builtin(void** state)
+{
+    set_t* pt_set = create_set(vector_t<int>);
+    vector_t* pvec_first = create_vector(int);
+    vector_t* pvec_second = create_vector(int);
+    vector_t* apvec_elem[2];
+    set_iterator_t at_iter[2];
+
+    set_init(pt_set);
+    vector_init_n(pvec_first, 3);
+    vector_init_n(pvec_second, 4);
+    set_insert(pt_set, pvec_first);
+    apvec_elem[0] = pvec_second;
+    apvec_elem[1] = pvec_first;
+
+    set_find_batch(pt_set, apvec_elem, 2, at_iter);
+    assert_true(iterator_equal(at_iter[0], set_end(pt_set)));
+    assert_true(vector_equal((vector_t*)iterator_get_pointer(at_iter[1]), pvec_first));
+
+    set_destroy(pt_set);
+    vector_destroy(pvec_first);
+    vector_destroy(pvec_second);
+}
+
+/*
+ * test set_erase_ptr
+ */
+UT_CASE_DEFINATION(set_erase_ptr)
+void test_set_erase_ptr__null_set(void** state)
+{
+    int elem = 9;
+
+    expect_assert_failure(set_erase_ptr(NULL, &elem));
+}
+
+void test_set_erase_ptr__c_builtin(void** state)
+{
+    set_t* pt_set = create_set(int);
+    int elem = 3;
+
+    set_init(pt_set);
+    set_insert(pt_set, 3);
+    set_insert(pt_set, 3);
+    set_insert(pt_set, 5);
+    assert_true(set_erase_ptr(pt_set, &elem) == 1);
+    assert_true(set_size(pt_set) == 1);
+    assert_true(set_erase_ptr(pt_set, &elem) == 0);
+
+    set_destroy(pt_set);
+}
+
+void test_set_erase_ptr__cstr(void** state)
+{
+    set_t* pt_set = create_set(char*);
+
+    set_init(pt_set);
+    set_insert(pt_set, "abc");
+    set_insert(pt_set, "def");
+    assert_true(set_erase_ptr(pt_set, "abc") == 1);
+    assert_true(set_size(pt_set) == 1);
+
+    set_destroy(pt_set);
+}
+
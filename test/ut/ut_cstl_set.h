@@ -127,6 +127,14 @@ void test_set_max_size__null_set(void** state);
 void test_set_max_size__non_inited(void** state);
 void test_set_max_size__empty(void** state);
 void test_set_max_size__non_empty(void** state);
+/*
+ * test set_memory_usage
+ */
+UT_CASE_DECLARATION(set_memory_usage)
+void test_set_memory_usage__null_set(void** state);
+void test_set_memory_usage__non_inited(void** state);
+void test_set_memory_usage__empty(void** state);
+void test_set_memory_usage__non_empty(void** state);
 /*
  * test set_begin
  */
@@ -329,6 +337,48 @@ void test_set_erase_range__middle(void** state);
 void test_set_erase_range__end(void** state);
 void test_set_erase_range__all(void** state);
 
+/*
+ * test set_find_ptr
+ */
+UT_CASE_DECLARATION(set_find_ptr)
+void test_set_find_ptr__null_set(void** state);
+void test_set_find_ptr__null_value(void** state);
+void test_set_find_ptr__c_builtin(void** state);
+void test_set_find_ptr__cstr(void** state);
+void test_set_find_ptr__libcstl_builtin(void** state);
+/*
+ * test set_insert_ptr
+ */
+UT_CASE_DECLARATION(set_insert_ptr)
+void test_set_insert_ptr__null_set(void** state);
+void test_set_insert_ptr__null_value(void** state);
+void test_set_insert_ptr__c_builtin(void** state);
+void test_set_insert_ptr__cstr(void** state);
+void test_set_insert_ptr__libcstl_builtin(void** state);
+/*
+ * test set_count_ptr
+ */
+UT_CASE_DECLARATION(set_count_ptr)
+void test_set_count_ptr__null_set(void** state);
+void test_set_count_ptr__c_builtin(void** state);
+void test_set_count_ptr__cstr(void** state);
+/*
+ * test set_find_batch
+ */
+UT_CASE_DECLARATION(set_find_batch)
+void test_set_find_batch__null_set(void** state);
+void test_set_find_batch__null_values(void** state);
+void test_set_find_batch__null_result(void** state);
+void test_set_find_batch__c_builtin(void** state);
+void test_set_find_batch__cstr(void** state);
+void test_set_find_batch__libcstl_builtin(void** state);
+/*
+ * test set_erase_ptr
+ */
+UT_CASE_DECLARATION(set_erase_ptr)
+void test_set_erase_ptr__null_set(void** state);
+void test_set_erase_ptr__c_builtin(void** state);
+void test_set_erase_ptr__cstr(void** state);
 #define UT_CSTL_SET_CASE\
     UT_SUIT_BEGIN(cstl_set, test_set_init__null_set),\
     UT_CASE(test_set_init__non_created),\
@@ -407,6 +457,10 @@ void test_set_erase_range__all(void** state);
     UT_CASE(test_set_max_size__non_inited),\
     UT_CASE(test_set_max_size__empty),\
     UT_CASE(test_set_max_size__non_empty),\
+    UT_CASE_BEGIN(set_memory_usage, test_set_memory_usage__null_set),\
+    UT_CASE(test_set_memory_usage__non_inited),\
+    UT_CASE(test_set_memory_usage__empty),\
+    UT_CASE(test_set_memory_usage__non_empty),\
     UT_CASE_BEGIN(set_begin, test_set_begin__null_set),\
     UT_CASE(test_set_begin__non_inited),\
     UT_CASE(test_set_begin__empty),\
@@ -547,7 +601,29 @@ void test_set_erase_range__all(void** state);
     UT_CASE(test_set_erase_range__begin),\
     UT_CASE(test_set_erase_range__middle),\
     UT_CASE(test_set_erase_range__end),\
-    UT_CASE(test_set_erase_range__all)
+    UT_CASE(test_set_erase_range__all),\
+    UT_CASE_BEGIN(set_find_ptr, test_set_find_ptr__null_set),\
+    UT_CASE(test_set_find_ptr__null_value),\
+    UT_CASE(test_set_find_ptr__c_builtin),\
+    UT_CASE(test_set_find_ptr__cstr),\
+    UT_CASE(test_set_find_ptr__libcstl_builtin),\
+    UT_CASE_BEGIN(set_insert_ptr, test_set_insert_ptr__null_set),\
+    UT_CASE(test_set_insert_ptr__null_value),\
+    UT_CASE(test_set_insert_ptr__c_builtin),\
+    UT_CASE(test_set_insert_ptr__cstr),\
+    UT_CASE(test_set_insert_ptr__libcstl_builtin),\
+    UT_CASE_BEGIN(set_count_ptr, test_set_count_ptr__null_set),\
+    UT_CASE(test_set_count_ptr__c_builtin),\
+    UT_CASE(test_set_count_ptr__cstr),\
+    UT_CASE_BEGIN(set_find_batch, test_set_find_batch__null_set),\
+    UT_CASE(test_set_find_batch__null_values),\
+    UT_CASE(test_set_find_batch__null_result),\
+    UT_CASE(test_set_find_batch__c_builtin),\
+    UT_CASE(test_set_find_batch__cstr),\
+    UT_CASE(test_set_find_batch__libcstl_builtin),\
+    UT_CASE_BEGIN(set_erase_ptr, test_set_erase_ptr__null_set),\
+    UT_CASE(test_set_erase_ptr__c_builtin),\
+    UT_CASE(test_set_erase_ptr__cstr)
 
 #endif /* _UT_CSTL_SET_H_ */
 
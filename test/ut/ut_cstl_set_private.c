@@ -72,6 +72,122 @@ void test__create_set__unregister(void** state)
     assert_true(pt_set == NULL);
 }
 
+/*
+ * test _create_set_with_allocator
+ */
+UT_CASE_DEFINATION(_create_set_with_allocator)
+static void* _create_set_with_allocator__allocate(void* pv_context, size_t t_size)
+{
+    ((size_t*)pv_context)[0]++;
+    return malloc(t_size);
+}
+
+static void _create_set_with_allocator__deallocate(void* pv_context, void* pv_mem, size_t t_size)
+{
+    ((size_t*)pv_context)[1]++;
+    free(pv_mem);
+}
+
+void test__create_set_with_allocator__null_allocator(void** state)
+{
+    expect_assert_failure(_create_set_with_allocator(NULL, "int"));
+}
+
+void test__create_set_with_allocator__unregisted_type(void** state)
+{
+    size_t at_count[2] = {0, 0};
+    allocator_t t_allocator = {_create_set_with_allocator__allocate, _create_set_with_allocator__deallocate, NULL};
+
+    t_allocator._pv_context = at_count;
+    assert_true(_create_set_with_allocator(&t_allocator, "unregisted_type_t") == NULL);
+    assert_true(at_count[0] == 0 && at_count[1] == 0);
+}
+
+void test__create_set_with_allocator__allocate_by_allocator(void** state)
+{
+    size_t at_count[2] = {0, 0};
+    allocator_t t_allocator = {_create_set_with_allocator__allocate, _create_set_with_allocator__deallocate, NULL};
+    set_t* pset = NULL;
+    int i = 0;
+
+    t_allocator._pv_context = at_count;
+    pset = _create_set_with_allocator(&t_allocator, "int");
+    assert_true(pset != NULL);
+    set_init(pset);
+    for (i = 0; i < 100; ++i) {
+        set_insert(pset, i);
+    }
+    assert_true(set_size(pset) == 100);
+    assert_true(at_count[0] > 0);
+
+    set_destroy(pset);
+    assert_true(at_count[0] == at_count[1]);
+}
+
+/*
+ * test _create_set_with_region
+ */
+UT_CASE_DEFINATION(_create_set_with_region)
+void test__create_set_with_region__null_typename(void** state)
+{
+    expect_assert_failure(_create_set_with_region(NULL));
+}
+
+void test__create_set_with_region__unregisted_type(void** state)
+{
+    assert_true(_create_set_with_region("unregisted_type_t") == NULL);
+}
+
+void test__create_set_with_region__successfully(void** state)
+{
+    set_t* pset = _create_set_with_region("int");
+    assert_true(pset != NULL);
+    assert_true(_alloc_is_region(&pset->_t_tree._t_allocator));
+    set_destroy(pset);
+}
+
+void test__create_set_with_region__clear_and_destroy(void** state)
+{
+    set_t* pset = _create_set_with_region("int");
+    int i = 0;
+    int j = 0;
+
+    set_init(pset);
+    for (j = 0; j < 3; ++j) {
+        for (i = 0; i < 1000; ++i) {
+            set_insert(pset, i);
+        }
+        assert_true(set_size(pset) == 1000);
+        set_clear(pset);
+        assert_true(set_empty(pset));
+        assert_true(set_size(pset) == 0);
+    }
+    for (i = 0; i < 100; ++i) {
+        set_insert(pset, i);
+    }
+    assert_true(set_size(pset) == 100);
+    set_destroy(pset);
+}
+
+void test__create_set_with_region__non_trivial_type(void** state)
+{
+    set_t* pset = _create_set_with_region("char*");
+    int i = 0;
+
+    set_init(pset);
+    for (i = 0; i < 100; ++i) {
+        set_insert(pset, "libcstl");
+    }
+    assert_true(set_size(pset) == 1);
+    set_clear(pset);
+    assert_true(set_empty(pset));
+    for (i = 0; i < 100; ++i) {
+        set_insert(pset, "libcstl");
+    }
+    assert_true(set_size(pset) == 1);
+    set_destroy(pset);
+}
+
 /*
  * test _create_set_auxiliary
  */
@@ -12,6 +12,22 @@ void test__create_set__cstr(void** state);
 void test__create_set__libcstl_builtin(void** state);
 void test__create_set__user_define(void** state);
 void test__create_set__unregister(void** state);
+/*
+ * test _create_set_with_allocator
+ */
+UT_CASE_DECLARATION(_create_set_with_allocator)
+void test__create_set_with_allocator__null_allocator(void** state);
+void test__create_set_with_allocator__unregisted_type(void** state);
+void test__create_set_with_allocator__allocate_by_allocator(void** state);
+/*
+ * test _create_set_with_region
+ */
+UT_CASE_DECLARATION(_create_set_with_region)
+void test__create_set_with_region__null_typename(void** state);
+void test__create_set_with_region__unregisted_type(void** state);
+void test__create_set_with_region__successfully(void** state);
+void test__create_set_with_region__clear_and_destroy(void** state);
+void test__create_set_with_region__non_trivial_type(void** state);
 /*
  * test _create_set_auxiliary
  */
@@ -171,6 +187,14 @@ void test__set_init_elem_auxiliary__successfully_user_defined(void** state);
     UT_CASE(test__create_set__libcstl_builtin),\
     UT_CASE(test__create_set__user_define),\
     UT_CASE(test__create_set__unregister),\
+    UT_CASE_BEGIN(_create_set_with_allocator, test__create_set_with_allocator__null_allocator),\
+    UT_CASE(test__create_set_with_allocator__unregisted_type),\
+    UT_CASE(test__create_set_with_allocator__allocate_by_allocator),\
+    UT_CASE_BEGIN(_create_set_with_region, test__create_set_with_region__null_typename),\
+    UT_CASE(test__create_set_with_region__unregisted_type),\
+    UT_CASE(test__create_set_with_region__successfully),\
+    UT_CASE(test__create_set_with_region__clear_and_destroy),\
+    UT_CASE(test__create_set_with_region__non_trivial_type),\
     UT_CASE_BEGIN(_create_set_auxiliary, test__create_set_auxiliary__null_set),\
     UT_CASE(test__create_set_auxiliary__null_typename),\
     UT_CASE(test__create_set_auxiliary__unregistered),\
@@ -864,6 +864,52 @@ void test_slist_max_size__non_empty(void** state)
     slist_destroy(pslist);
 }
 
+/*
+ * test slist_memory_usage
+ */
+UT_CASE_DEFINATION(slist_memory_usage)
+void test_slist_memory_usage__null_slist_container(void** state)
+{
+    expect_assert_failure(slist_memory_usage(NULL));
+}
+
+void test_slist_memory_usage__non_inited_slist_container(void** state)
+{
+    slist_t* pslist = create_slist(int);
+
+    pslist->_t_typeinfo._t_style = 3232;
+    expect_assert_failure(slist_memory_usage(pslist));
+
+    pslist->_t_typeinfo._t_style = _TYPE_C_BUILTIN;
+    slist_destroy(pslist);
+}
+
+void test_slist_memory_usage__empty(void** state)
+{
+    slist_t* pslist = create_slist(int);
+
+    slist_init(pslist);
+    assert_true(slist_memory_usage(pslist) >= sizeof(slist_t));
+
+    slist_destroy(pslist);
+}
+
+void test_slist_memory_usage__non_empty(void** state)
+{
+    slist_t* pslist = create_slist(int);
+    size_t t_usage = 0;
+    int i = 0;
+
+    slist_init(pslist);
+    t_usage = slist_memory_usage(pslist);
+    for (i = 0; i < 100; ++i) {
+        slist_push_front(pslist, i);
+    }
+    assert_true(slist_memory_usage(pslist) >= t_usage + 100 * sizeof(int));
+
+    slist_destroy(pslist);
+}
+
 /*
  * test slist_equal
  */
@@ -9989,3 +10035,59 @@ void test_slist_reverse__not_same(void** state)
     slist_destroy(pslist);
 }
 
+/*
+ * test slist_push_front_ptr
+ */
+UT_CASE_DEFINATION(slist_push_front_ptr)
+void test_slist_push_front_ptr__null_slist(void** state)
+{
+    int elem = 9;
+
+    expect_assert_failure(slist_push_front_ptr(NULL, &elem));
+}
+
+void test_slist_push_front_ptr__c_builtin(void** state)
+{
+    slist_t* pt_slist = create_slist(int);
+    int elem;
+    int i;
+
+    slist_init(pt_slist);
+    for (i = 0; i < 100; ++i) {
+        elem = i;
+        slist_push_front_ptr(pt_slist, &elem);
+        assert_true(*(int*)slist_front(pt_slist) == i);
+    }
+    assert_true(slist_size(pt_slist) == 100);
+
+    slist_destroy(pt_slist);
+}
+
+void test_slist_push_front_ptr__cstr(void** state)
+{
+    slist_t* pt_slist = create_slist(char*);
+
+    slist_init(pt_slist);
+    slist_push_front_ptr(pt_slist, "abc");
+    slist_push_front_ptr(pt_slist, "defg");
+    assert_true(strcmp((char*)slist_front(pt_slist), "defg") == 0);
+    assert_true(slist_size(pt_slist) == 2);
+
+    slist_destroy(pt_slist);
+}
+
+void test_slist_push_front_ptr__libcstl_builtin(void** state)
+{
+    slist_t* pt_slist = create_slist(vector_t<int>);
+    vector_t* pvec_vector = create_vector(int);
+
+    slist_init(pt_slist);
+    vector_init_n(pvec_vector, 5);
+    slist_push_front_ptr(pt_slist, pvec_vector);
+    assert_true(vector_equal((vector_t*)slist_front(pt_slist), pvec_vector));
+    assert_true((vector_t*)slist_front(pt_slist) != pvec_vector);
+
+    slist_destroy(pt_slist);
+    vector_destroy(pvec_vector);
+}
+
@@ -94,6 +94,14 @@ void test_slist_max_size__null_slist_container(void** state);
 void test_slist_max_size__non_inited_slist_container(void** state);
 void test_slist_max_size__empty(void** state);
 void test_slist_max_size__non_empty(void** state);
+/*
+ * test slist_memory_usage
+ */
+UT_CASE_DECLARATION(slist_memory_usage)
+void test_slist_memory_usage__null_slist_container(void** state);
+void test_slist_memory_usage__non_inited_slist_container(void** state);
+void test_slist_memory_usage__empty(void** state);
+void test_slist_memory_usage__non_empty(void** state);
 /*
  * test slist_equal
  */
@@ -699,6 +707,14 @@ void test_slist_reverse__empty(void** state);
 void test_slist_reverse__same(void** state);
 void test_slist_reverse__not_same(void** state);
 
+/*
+ * test slist_push_front_ptr
+ */
+UT_CASE_DECLARATION(slist_push_front_ptr)
+void test_slist_push_front_ptr__null_slist(void** state);
+void test_slist_push_front_ptr__c_builtin(void** state);
+void test_slist_push_front_ptr__cstr(void** state);
+void test_slist_push_front_ptr__libcstl_builtin(void** state);
 #define UT_CSTL_SLIST_CASE\
     UT_SUIT_BEGIN(cstl_slist, test_slist_init__null_slist_container),\
     UT_CASE(test_slist_init__non_created_slist_container),\
@@ -755,6 +771,10 @@ void test_slist_reverse__not_same(void** state);
     UT_CASE(test_slist_max_size__non_inited_slist_container),\
     UT_CASE(test_slist_max_size__empty),\
     UT_CASE(test_slist_max_size__non_empty),\
+    UT_CASE_BEGIN(slist_memory_usage, test_slist_memory_usage__null_slist_container),\
+    UT_CASE(test_slist_memory_usage__non_inited_slist_container),\
+    UT_CASE(test_slist_memory_usage__empty),\
+    UT_CASE(test_slist_memory_usage__non_empty),\
     UT_CASE_BEGIN(slist_equal, test_slist_equal__null_first),\
     UT_CASE(test_slist_equal__null_second),\
     UT_CASE(test_slist_equal__non_inited_first),\
@@ -1206,7 +1226,11 @@ void test_slist_reverse__not_same(void** state);
     UT_CASE(test_slist_reverse__non_inited_slist_container),\
     UT_CASE(test_slist_reverse__empty),\
     UT_CASE(test_slist_reverse__same),\
-    UT_CASE(test_slist_reverse__not_same)
+    UT_CASE(test_slist_reverse__not_same),\
+    UT_CASE_BEGIN(slist_push_front_ptr, test_slist_push_front_ptr__null_slist),\
+    UT_CASE(test_slist_push_front_ptr__c_builtin),\
+    UT_CASE(test_slist_push_front_ptr__cstr),\
+    UT_CASE(test_slist_push_front_ptr__libcstl_builtin)
 
 #endif /* _UT_CSTL_SLIST_H_ */
 
@@ -81,6 +81,122 @@ void test__create_slist__user_defined_type_dup(void** state)
     slist_destroy(pslist);
 }
 
+/*
+ * test _create_slist_with_allocator
+ */
+UT_CASE_DEFINATION(_create_slist_with_allocator)
+static void* _create_slist_with_allocator__allocate(void* pv_context, size_t t_size)
+{
+    ((size_t*)pv_context)[0]++;
+    return malloc(t_size);
+}
+
+static void _create_slist_with_allocator__deallocate(void* pv_context, void* pv_mem, size_t t_size)
+{
+    ((size_t*)pv_context)[1]++;
+    free(pv_mem);
+}
+
+void test__create_slist_with_allocator__null_allocator(void** state)
+{
+    expect_assert_failure(_create_slist_with_allocator(NULL, "int"));
+}
+
+void test__create_slist_with_allocator__unregisted_type(void** state)
+{
+    size_t at_count[2] = {0, 0};
+    allocator_t t_allocator = {_create_slist_with_allocator__allocate, _create_slist_with_allocator__deallocate, NULL};
+
+    t_allocator._pv_context = at_count;
+    assert_true(_create_slist_with_allocator(&t_allocator, "unregisted_type_t") == NULL);
+    assert_true(at_count[0] == 0 && at_count[1] == 0);
+}
+
+void test__create_slist_with_allocator__allocate_by_allocator(void** state)
+{
+    size_t at_count[2] = {0, 0};
+    allocator_t t_allocator = {_create_slist_with_allocator__allocate, _create_slist_with_allocator__deallocate, NULL};
+    slist_t* pslist = NULL;
+    int i = 0;
+
+    t_allocator._pv_context = at_count;
+    pslist = _create_slist_with_allocator(&t_allocator, "int");
+    assert_true(pslist != NULL);
+    slist_init(pslist);
+    for (i = 0; i < 100; ++i) {
+        slist_push_front(pslist, i);
+    }
+    assert_true(slist_size(pslist) == 100);
+    assert_true(at_count[0] > 0);
+
+    slist_destroy(pslist);
+    assert_true(at_count[0] == at_count[1]);
+}
+
+/*
+ * test _create_slist_with_region
+ */
+UT_CASE_DEFINATION(_create_slist_with_region)
+void test__create_slist_with_region__null_typename(void** state)
+{
+    expect_assert_failure(_create_slist_with_region(NULL));
+}
+
+void test__create_slist_with_region__unregisted_type(void** state)
+{
+    assert_true(_create_slist_with_region("unregisted_type_t") == NULL);
+}
+
+void test__create_slist_with_region__successfully(void** state)
+{
+    slist_t* pslist = _create_slist_with_region("int");
+    assert_true(pslist != NULL);
+    assert_true(_alloc_is_region(&pslist->_t_allocator));
+    slist_destroy(pslist);
+}
+
+void test__create_slist_with_region__clear_and_destroy(void** state)
+{
+    slist_t* pslist = _create_slist_with_region("int");
+    int i = 0;
+    int j = 0;
+
+    slist_init(pslist);
+    for (j = 0; j < 3; ++j) {
+        for (i = 0; i < 1000; ++i) {
+            slist_push_front(pslist, i);
+        }
+        assert_true(slist_size(pslist) == 1000);
+        slist_clear(pslist);
+        assert_true(slist_empty(pslist));
+        assert_true(slist_size(pslist) == 0);
+    }
+    for (i = 0; i < 100; ++i) {
+        slist_push_front(pslist, i);
+    }
+    assert_true(slist_size(pslist) == 100);
+    slist_destroy(pslist);
+}
+
+void test__create_slist_with_region__non_trivial_type(void** state)
+{
+    slist_t* pslist = _create_slist_with_region("char*");
+    int i = 0;
+
+    slist_init(pslist);
+    for (i = 0; i < 100; ++i) {
+        slist_push_front(pslist, "libcstl");
+    }
+    assert_true(slist_size(pslist) == 100);
+    slist_clear(pslist);
+    assert_true(slist_empty(pslist));
+    for (i = 0; i < 100; ++i) {
+        slist_push_front(pslist, "libcstl");
+    }
+    assert_true(slist_size(pslist) == 100);
+    slist_destroy(pslist);
+}
+
 /*
  * test _create_slist_auxiliary
  */
@@ -13,6 +13,22 @@ void test__create_slist__c_builtin_type(void** state);
 void test__create_slist__libcstl_builtin_type(void** state);
 void test__create_slist__user_defined_type(void** state);
 void test__create_slist__user_defined_type_dup(void** state);
+/*
+ * test _create_slist_with_allocator
+ */
+UT_CASE_DECLARATION(_create_slist_with_allocator)
+void test__create_slist_with_allocator__null_allocator(void** state);
+void test__create_slist_with_allocator__unregisted_type(void** state);
+void test__create_slist_with_allocator__allocate_by_allocator(void** state);
+/*
+ * test _create_slist_with_region
+ */
+UT_CASE_DECLARATION(_create_slist_with_region)
+void test__create_slist_with_region__null_typename(void** state);
+void test__create_slist_with_region__unregisted_type(void** state);
+void test__create_slist_with_region__successfully(void** state);
+void test__create_slist_with_region__clear_and_destroy(void** state);
+void test__create_slist_with_region__non_trivial_type(void** state);
 /*
  * test _create_slist_auxiliary
  */
@@ -160,6 +176,14 @@ void test__slist_insert_after_n__slist_insert_after_n_varg__n_insert_end_multipl
     UT_CASE(test__create_slist__libcstl_builtin_type),\
     UT_CASE(test__create_slist__user_defined_type),\
     UT_CASE(test__create_slist__user_defined_type_dup),\
+    UT_CASE_BEGIN(_create_slist_with_allocator, test__create_slist_with_allocator__null_allocator),\
+    UT_CASE(test__create_slist_with_allocator__unregisted_type),\
+    UT_CASE(test__create_slist_with_allocator__allocate_by_allocator),\
+    UT_CASE_BEGIN(_create_slist_with_region, test__create_slist_with_region__null_typename),\
+    UT_CASE(test__create_slist_with_region__unregisted_type),\
+    UT_CASE(test__create_slist_with_region__successfully),\
+    UT_CASE(test__create_slist_with_region__clear_and_destroy),\
+    UT_CASE(test__create_slist_with_region__non_trivial_type),\
     UT_CASE_BEGIN(_create_slist_auxiliary, test__create_slist_auxiliary__null_slist_container),\
     UT_CASE(test__create_slist_auxiliary__null_typename),\
     UT_CASE(test__create_slist_auxiliary__unregisted_type),\
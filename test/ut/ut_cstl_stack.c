@@ -1728,3 +1728,59 @@ void test_stack_top__successfully(void** state)
     stack_destroy(psk);
 }
 
+/*
+ * test stack_push_ptr
+ */
+UT_CASE_DEFINATION(stack_push_ptr)
+void test_stack_push_ptr__null_stack(void** state)
+{
+    int elem = 9;
+
+    expect_assert_failure(stack_push_ptr(NULL, &elem));
+}
+
+void test_stack_push_ptr__c_builtin(void** state)
+{
+    stack_t* pt_stack = create_stack(int);
+    int elem;
+    int i;
+
+    stack_init(pt_stack);
+    for (i = 0; i < 100; ++i) {
+        elem = i;
+        stack_push_ptr(pt_stack, &elem);
+        assert_true(*(int*)stack_top(pt_stack) == i);
+    }
+    assert_true(stack_size(pt_stack) == 100);
+
+    stack_destroy(pt_stack);
+}
+
+void test_stack_push_ptr__cstr(void** state)
+{
+    stack_t* pt_stack = create_stack(char*);
+
+    stack_init(pt_stack);
+    stack_push_ptr(pt_stack, "abc");
+    stack_push_ptr(pt_stack, "defg");
+    assert_true(strcmp((char*)stack_top(pt_stack), "defg") == 0);
+    assert_true(stack_size(pt_stack) == 2);
+
+    stack_destroy(pt_stack);
+}
+
+void test_stack_push_ptr__libcstl_builtin(void** state)
+{
+    stack_t* pt_stack = create_stack(list_t<int>);
+    list_t* plist_list = create_list(int);
+
+    stack_init(pt_stack);
+    list_init_n(plist_list, 5);
+    stack_push_ptr(pt_stack, plist_list);
+    assert_true(list_equal((list_t*)stack_top(pt_stack), plist_list));
+    assert_true((list_t*)stack_top(pt_stack) != plist_list);
+
+    stack_destroy(pt_stack);
+    list_destroy(plist_list);
+}
+
@@ -178,6 +178,14 @@ void test_stack_top__non_inited_stack_adaptor(void** state);
 void test_stack_top__empty(void** state);
 void test_stack_top__successfully(void** state);
 
+/*
+ * test stack_push_ptr
+ */
+UT_CASE_DECLARATION(stack_push_ptr)
+void test_stack_push_ptr__null_stack(void** state);
+void test_stack_push_ptr__c_builtin(void** state);
+void test_stack_push_ptr__cstr(void** state);
+void test_stack_push_ptr__libcstl_builtin(void** state);
 #define UT_CSTL_STACK_CASE\
     UT_SUIT_BEGIN(cstl_stack, test_stack_init__null_stack_adaptor),\
     UT_CASE(test_stack_init__non_created_stack_adaptor),\
@@ -296,7 +304,11 @@ void test_stack_top__successfully(void** state);
     UT_CASE_BEGIN(stack_top, test_stack_top__null_stack_adaptor),\
     UT_CASE(test_stack_top__non_inited_stack_adaptor),\
     UT_CASE(test_stack_top__empty),\
-    UT_CASE(test_stack_top__successfully)
+    UT_CASE(test_stack_top__successfully),\
+    UT_CASE_BEGIN(stack_push_ptr, test_stack_push_ptr__null_stack),\
+    UT_CASE(test_stack_push_ptr__c_builtin),\
+    UT_CASE(test_stack_push_ptr__cstr),\
+    UT_CASE(test_stack_push_ptr__libcstl_builtin)
 
 #endif /* _UT_CSTL_STACK_H_ */
 
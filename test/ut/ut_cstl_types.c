@@ -18,6 +18,7 @@
 #include "cstl/chash_map.h"
 #include "cstl_types_builtin.h"
 #include "cstl_types_aux.h"
+#include "cstl_hashtable_aux.h"
 
 #include "ut_def.h"
 #include "ut_cstl_types.h"
@@ -174,20 +175,12 @@ void test__type_destroy_default__ok(void** state)
 UT_CASE_DEFINATION(_type_get_varg_value)
 static void _test__get_type(_typeinfo_t* pt_info, const char* s_typename)
 {
-    _typenode_t* pt_node = NULL;
     assert_true(pt_info != NULL);
     assert_true(s_typename != NULL);
 
-    strncpy(pt_info->_s_typename, s_typename, _TYPE_NAME_SIZE);
-    pt_node = _gt_typeregister._apt_bucket[_type_hash(pt_info->_s_typename)];
-    while (pt_node != NULL) {
-        if (strncmp(pt_node->_s_typename, pt_info->_s_typename, _TYPE_NAME_SIZE) == 0) {
-            pt_info->_pt_type = pt_node->_pt_type;
-            return;
-        }
-        pt_node = pt_node->_pt_next;
-    }
-    assert_true(false);
+    pt_info->_s_typename = s_typename;
+    pt_info->_pt_type = _type_is_registered(pt_info->_s_typename);
+    assert_true(pt_info->_pt_type != NULL);
 }
 
 static void _test__type_get_varg_value__stub(void* pv_output, _typeinfo_t* pt_info, ...)
@@ -643,6 +636,445 @@ void test__type_is_same_ex__same(void** state)
     assert_true(_type_is_same_ex(&t_first, &t_second) == true);
 }
 
+/*
+ * test _type_is_trivially_initializable
+ */
+UT_CASE_DEFINATION(_type_is_trivially_initializable)
+static void _type_is_trivially_initializable__init(const void* cpv_input, void* pv_output)
+{
+    _type_init_default(cpv_input, pv_output);
+}
+
+void test__type_is_trivially_initializable__null_typeinfo(void** state)
+{
+    expect_assert_failure(_type_is_trivially_initializable(NULL));
+}
+
+void test__type_is_trivially_initializable__c_builtin(void** state)
+{
+    _typeinfo_t t_info;
+    _type_get_type(&t_info, "int");
+    assert_true(_type_is_trivially_initializable(&t_info));
+    _type_get_type(&t_info, "double");
+    assert_true(_type_is_trivially_initializable(&t_info));
+    _type_get_type(&t_info, "void*");
+    assert_true(_type_is_trivially_initializable(&t_info));
+}
+
+void test__type_is_trivially_initializable__c_string(void** state)
+{
+    _typeinfo_t t_info;
+    _type_get_type(&t_info, "char*");
+    assert_false(_type_is_trivially_initializable(&t_info));
+}
+
+void test__type_is_trivially_initializable__cstl_builtin(void** state)
+{
+    _typeinfo_t t_info;
+    _type_get_type(&t_info, "list_t<int>");
+    assert_false(_type_is_trivially_initializable(&t_info));
+}
+
+void test__type_is_trivially_initializable__user_define_default(void** state)
+{
+    typedef struct _tag_type_is_trivially_initializable_default {int n_elem;}_type_is_trivially_initializable_default_t;
+    _typeinfo_t t_info;
+    type_register(_type_is_trivially_initializable_default_t, NULL, NULL, NULL, NULL);
+    _type_get_type(&t_info, "_type_is_trivially_initializable_default_t");
+    assert_true(_type_is_trivially_initializable(&t_info));
+}
+
+void test__type_is_trivially_initializable__user_define(void** state)
+{
+    typedef struct _tag_type_is_trivially_initializable_user {int n_elem;}_type_is_trivially_initializable_user_t;
+    _typeinfo_t t_info;
+    type_register(_type_is_trivially_initializable_user_t, _type_is_trivially_initializable__init, NULL, NULL, NULL);
+    _type_get_type(&t_info, "_type_is_trivially_initializable_user_t");
+    assert_false(_type_is_trivially_initializable(&t_info));
+    assert_true(_type_is_trivially_copyable(&t_info));
+    assert_true(_type_is_trivially_destructible(&t_info));
+}
+
+/*
+ * test _type_is_trivially_copyable
+ */
+UT_CASE_DEFINATION(_type_is_trivially_copyable)
+static void _type_is_trivially_copyable__copy(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    _type_copy_default(cpv_first, cpv_second, pv_output);
+}
+
+void test__type_is_trivially_copyable__null_typeinfo(void** state)
+{
+    expect_assert_failure(_type_is_trivially_copyable(NULL));
+}
+
+void test__type_is_trivially_copyable__c_builtin(void** state)
+{
+    _typeinfo_t t_info;
+    _type_get_type(&t_info, "unsigned char");
+    assert_true(_type_is_trivially_copyable(&t_info));
+    _type_get_type(&t_info, "long double");
+    assert_true(_type_is_trivially_copyable(&t_info));
+    _type_get_type(&t_info, "bool_t");
+    assert_true(_type_is_trivially_copyable(&t_info));
+}
+
+void test__type_is_trivially_copyable__c_string(void** state)
+{
+    _typeinfo_t t_info;
+    _type_get_type(&t_info, "char*");
+    assert_false(_type_is_trivially_copyable(&t_info));
+}
+
+void test__type_is_trivially_copyable__cstl_builtin(void** state)
+{
+    _typeinfo_t t_info;
+    _type_get_type(&t_info, "string_t");
+    assert_false(_type_is_trivially_copyable(&t_info));
+    _type_get_type(&t_info, "map_t<int, long>");
+    assert_false(_type_is_trivially_copyable(&t_info));
+}
+
+void test__type_is_trivially_copyable__user_define_default(void** state)
+{
+    typedef struct _tag_type_is_trivially_copyable_default {int n_elem;}_type_is_trivially_copyable_default_t;
+    _typeinfo_t t_info;
+    type_register(_type_is_trivially_copyable_default_t, NULL, NULL, NULL, NULL);
+    _type_get_type(&t_info, "_type_is_trivially_copyable_default_t");
+    assert_true(_type_is_trivially_copyable(&t_info));
+}
+
+void test__type_is_trivially_copyable__user_define(void** state)
+{
+    typedef struct _tag_type_is_trivially_copyable_user {int n_elem;}_type_is_trivially_copyable_user_t;
+    _typeinfo_t t_info;
+    type_register(_type_is_trivially_copyable_user_t, NULL, _type_is_trivially_copyable__copy, NULL, NULL);
+    _type_get_type(&t_info, "_type_is_trivially_copyable_user_t");
+    assert_false(_type_is_trivially_copyable(&t_info));
+    assert_true(_type_is_trivially_initializable(&t_info));
+    assert_true(_type_is_trivially_destructible(&t_info));
+}
+
+/*
+ * test _type_is_trivially_destructible
+ */
+UT_CASE_DEFINATION(_type_is_trivially_destructible)
+static void _type_is_trivially_destructible__destroy(const void* cpv_input, void* pv_output)
+{
+    _type_destroy_default(cpv_input, pv_output);
+}
+
+void test__type_is_trivially_destructible__null_typeinfo(void** state)
+{
+    expect_assert_failure(_type_is_trivially_destructible(NULL));
+}
+
+void test__type_is_trivially_destructible__c_builtin(void** state)
+{
+    _typeinfo_t t_info;
+    _type_get_type(&t_info, "int");
+    assert_true(_type_is_trivially_destructible(&t_info));
+    _type_get_type(&t_info, "long double");
+    assert_true(_type_is_trivially_destructible(&t_info));
+    _type_get_type(&t_info, "void*");
+    assert_true(_type_is_trivially_destructible(&t_info));
+}
+
+void test__type_is_trivially_destructible__c_string(void** state)
+{
+    _typeinfo_t t_info;
+    _type_get_type(&t_info, "char*");
+    assert_false(_type_is_trivially_destructible(&t_info));
+}
+
+void test__type_is_trivially_destructible__cstl_builtin(void** state)
+{
+    _typeinfo_t t_info;
+    _type_get_type(&t_info, "vector_t<int>");
+    assert_false(_type_is_trivially_destructible(&t_info));
+    _type_get_type(&t_info, "pair_t<int, int>");
+    assert_false(_type_is_trivially_destructible(&t_info));
+}
+
+void test__type_is_trivially_destructible__user_define_default(void** state)
+{
+    typedef struct _tag_type_is_trivially_destructible_default {int n_elem;}_type_is_trivially_destructible_default_t;
+    _typeinfo_t t_info;
+    type_register(_type_is_trivially_destructible_default_t, NULL, NULL, NULL, NULL);
+    _type_get_type(&t_info, "_type_is_trivially_destructible_default_t");
+    assert_true(_type_is_trivially_destructible(&t_info));
+}
+
+void test__type_is_trivially_destructible__user_define(void** state)
+{
+    typedef struct _tag_type_is_trivially_destructible_user {int n_elem;}_type_is_trivially_destructible_user_t;
+    _typeinfo_t t_info;
+    type_register(_type_is_trivially_destructible_user_t, NULL, NULL, NULL, _type_is_trivially_destructible__destroy);
+    _type_get_type(&t_info, "_type_is_trivially_destructible_user_t");
+    assert_false(_type_is_trivially_destructible(&t_info));
+}
+
+/*
+ * test _type_is_trivially_relocatable
+ */
+UT_CASE_DEFINATION(_type_is_trivially_relocatable)
+static void _type_is_trivially_relocatable__copy(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    _type_copy_default(cpv_first, cpv_second, pv_output);
+}
+
+void test__type_is_trivially_relocatable__null_typeinfo(void** state)
+{
+    expect_assert_failure(_type_is_trivially_relocatable(NULL));
+}
+
+void test__type_is_trivially_relocatable__c_builtin(void** state)
+{
+    _typeinfo_t t_info;
+    _type_get_type(&t_info, "int");
+    assert_true(_type_is_trivially_relocatable(&t_info));
+    _type_get_type(&t_info, "long double");
+    assert_true(_type_is_trivially_relocatable(&t_info));
+}
+
+void test__type_is_trivially_relocatable__c_string(void** state)
+{
+    _typeinfo_t t_info;
+    _type_get_type(&t_info, "char*");
+    assert_true(_type_is_trivially_relocatable(&t_info));
+}
+
+void test__type_is_trivially_relocatable__cstl_builtin(void** state)
+{
+    _typeinfo_t t_info;
+    _type_get_type(&t_info, "vector_t<int>");
+    assert_true(_type_is_trivially_relocatable(&t_info));
+    _type_get_type(&t_info, "string_t");
+    assert_true(_type_is_trivially_relocatable(&t_info));
+    _type_get_type(&t_info, "hash_map_t<int, long>");
+    assert_true(_type_is_trivially_relocatable(&t_info));
+    _type_get_type(&t_info, "deque_t<int>");
+    assert_false(_type_is_trivially_relocatable(&t_info));
+    _type_get_type(&t_info, "set_t<int>");
+    assert_false(_type_is_trivially_relocatable(&t_info));
+    _type_get_type(&t_info, "map_t<int, long>");
+    assert_false(_type_is_trivially_relocatable(&t_info));
+}
+
+void test__type_is_trivially_relocatable__user_define_default(void** state)
+{
+    typedef struct _tag_type_is_trivially_relocatable_default {int n_elem;}_type_is_trivially_relocatable_default_t;
+    _typeinfo_t t_info;
+    type_register(_type_is_trivially_relocatable_default_t, NULL, NULL, NULL, NULL);
+    _type_get_type(&t_info, "_type_is_trivially_relocatable_default_t");
+    assert_true(_type_is_trivially_relocatable(&t_info));
+}
+
+void test__type_is_trivially_relocatable__user_define(void** state)
+{
+    typedef struct _tag_type_is_trivially_relocatable_user {int n_elem;}_type_is_trivially_relocatable_user_t;
+    _typeinfo_t t_info;
+    type_register(_type_is_trivially_relocatable_user_t, NULL, _type_is_trivially_relocatable__copy, NULL, NULL);
+    _type_get_type(&t_info, "_type_is_trivially_relocatable_user_t");
+    assert_false(_type_is_trivially_relocatable(&t_info));
+    assert_false(_type_is_relocatable(&t_info));
+}
+
+/*
+ * test _type_is_relocatable
+ */
+UT_CASE_DEFINATION(_type_is_relocatable)
+void test__type_is_relocatable__null_typeinfo(void** state)
+{
+    expect_assert_failure(_type_is_relocatable(NULL));
+}
+
+void test__type_is_relocatable__c_builtin(void** state)
+{
+    _typeinfo_t t_info;
+    _type_get_type(&t_info, "unsigned long");
+    assert_true(_type_is_relocatable(&t_info));
+    _type_get_type(&t_info, "char*");
+    assert_true(_type_is_relocatable(&t_info));
+}
+
+void test__type_is_relocatable__cstl_builtin(void** state)
+{
+    _typeinfo_t t_info;
+    _type_get_type(&t_info, "deque_t<int>");
+    assert_true(_type_is_relocatable(&t_info));
+    _type_get_type(&t_info, "multimap_t<int, string_t>");
+    assert_true(_type_is_relocatable(&t_info));
+    _type_get_type(&t_info, "stack_t<int>");
+    assert_true(_type_is_relocatable(&t_info));
+}
+
+/*
+ * test _type_relocate
+ */
+UT_CASE_DEFINATION(_type_relocate)
+void test__type_relocate__null_typeinfo(void** state)
+{
+    int an_source[] = {1, 2, 3};
+    int an_target[3];
+    expect_assert_failure(_type_relocate(NULL, an_target, an_source, 3));
+}
+
+void test__type_relocate__null_target(void** state)
+{
+    _typeinfo_t t_info;
+    int an_source[] = {1, 2, 3};
+    _type_get_type(&t_info, "int");
+    expect_assert_failure(_type_relocate(&t_info, NULL, an_source, 3));
+}
+
+void test__type_relocate__null_source(void** state)
+{
+    _typeinfo_t t_info;
+    int an_target[3];
+    _type_get_type(&t_info, "int");
+    expect_assert_failure(_type_relocate(&t_info, an_target, NULL, 3));
+}
+
+void test__type_relocate__not_relocatable(void** state)
+{
+    typedef struct _tag_type_relocate_user {int n_elem;}_type_relocate_user_t;
+    _typeinfo_t t_info;
+    _type_relocate_user_t t_source = {1};
+    _type_relocate_user_t t_target = {0};
+    type_register(_type_relocate_user_t, NULL, _type_is_trivially_relocatable__copy, NULL, NULL);
+    _type_get_type(&t_info, "_type_relocate_user_t");
+    expect_assert_failure(_type_relocate(&t_info, &t_target, &t_source, 1));
+}
+
+void test__type_relocate__c_builtin(void** state)
+{
+    _typeinfo_t t_info;
+    int an_source[] = {1, 2, 3};
+    int an_target[3] = {0};
+    _type_get_type(&t_info, "int");
+    _type_relocate(&t_info, an_target, an_source, 3);
+    assert_true(an_target[0] == 1 && an_target[1] == 2 && an_target[2] == 3);
+}
+
+void test__type_relocate__string(void** state)
+{
+    _typeinfo_t t_info;
+    string_t* pstr_source = create_string();
+    string_t* pstr_target = (string_t*)malloc(sizeof(string_t));
+    string_init_cstr(pstr_source, "abcdefg");
+    _type_get_type(&t_info, "string_t");
+    _type_relocate(&t_info, pstr_target, pstr_source, 1);
+    free(pstr_source);
+    assert_true(strcmp(string_c_str(pstr_target), "abcdefg") == 0);
+    string_destroy(pstr_target);
+}
+
+void test__type_relocate__deque(void** state)
+{
+    _typeinfo_t t_info;
+    deque_t* pdeq_source = create_deque(int);
+    deque_t* pdeq_target = (deque_t*)malloc(sizeof(deque_t));
+    deque_init_n(pdeq_source, 10);
+    _type_get_type(&t_info, "deque_t<int>");
+    _type_relocate(&t_info, pdeq_target, pdeq_source, 1);
+    free(pdeq_source);
+    assert_true(deque_size(pdeq_target) == 10);
+    deque_push_back(pdeq_target, 4);
+    assert_true(*(int*)deque_back(pdeq_target) == 4);
+    deque_destroy(pdeq_target);
+}
+
+void test__type_relocate__set(void** state)
+{
+    _typeinfo_t t_info;
+    set_t* pset_source = create_set(int);
+    set_t* pset_target = (set_t*)malloc(sizeof(set_t));
+    set_t* pset_empty = create_set(int);
+    set_t* pset_emptytarget = (set_t*)malloc(sizeof(set_t));
+    set_init(pset_source);
+    set_init(pset_empty);
+    set_insert(pset_source, 3);
+    set_insert(pset_source, 1);
+    set_insert(pset_source, 2);
+    _type_get_type(&t_info, "set_t<int>");
+    _type_relocate(&t_info, pset_target, pset_source, 1);
+    _type_relocate(&t_info, pset_emptytarget, pset_empty, 1);
+    free(pset_source);
+    free(pset_empty);
+    assert_true(set_size(pset_target) == 3);
+    assert_true(*(int*)iterator_get_pointer(set_begin(pset_target)) == 1);
+    set_insert(pset_target, 0);
+    assert_true(*(int*)iterator_get_pointer(set_begin(pset_target)) == 0);
+    assert_true(set_empty(pset_emptytarget));
+    set_insert(pset_emptytarget, 5);
+    assert_true(*(int*)iterator_get_pointer(set_begin(pset_emptytarget)) == 5);
+    set_destroy(pset_target);
+    set_destroy(pset_emptytarget);
+}
+
+void test__type_relocate__map(void** state)
+{
+    _typeinfo_t t_info;
+    map_t* pmap_source = create_map(int, int);
+    map_t* pmap_target = (map_t*)malloc(sizeof(map_t));
+    map_init(pmap_source);
+    *(int*)map_at(pmap_source, 1) = 10;
+    *(int*)map_at(pmap_source, 2) = 20;
+    _type_get_type(&t_info, "map_t<int, int>");
+    _type_relocate(&t_info, pmap_target, pmap_source, 1);
+    free(pmap_source);
+    assert_true(map_size(pmap_target) == 2);
+    assert_true(*(int*)map_at(pmap_target, 2) == 20);
+    *(int*)map_at(pmap_target, 3) = 30;
+    assert_true(map_size(pmap_target) == 3);
+    map_destroy(pmap_target);
+}
+
+/*
+ * test _type_swap
+ */
+UT_CASE_DEFINATION(_type_swap)
+void test__type_swap__null_typeinfo(void** state)
+{
+    int n_first = 1;
+    int n_second = 2;
+    expect_assert_failure(_type_swap(NULL, &n_first, &n_second));
+}
+
+void test__type_swap__c_builtin(void** state)
+{
+    _typeinfo_t t_info;
+    int n_first = 1;
+    int n_second = 2;
+    _type_get_type(&t_info, "int");
+    _type_swap(&t_info, &n_first, &n_second);
+    assert_true(n_first == 2 && n_second == 1);
+    _type_swap(&t_info, &n_first, &n_first);
+    assert_true(n_first == 2);
+}
+
+void test__type_swap__set(void** state)
+{
+    _typeinfo_t t_info;
+    set_t* pset_first = create_set(int);
+    set_t* pset_second = create_set(int);
+    set_init(pset_first);
+    set_init(pset_second);
+    set_insert(pset_first, 1);
+    _type_get_type(&t_info, "set_t<int>");
+    _type_swap(&t_info, pset_first, pset_second);
+    assert_true(set_empty(pset_first));
+    assert_true(set_size(pset_second) == 1);
+    set_insert(pset_first, 2);
+    set_insert(pset_second, 3);
+    assert_true(set_size(pset_first) == 1);
+    assert_true(set_size(pset_second) == 2);
+    set_destroy(pset_first);
+    set_destroy(pset_second);
+}
+
 /*
  * test _type_get_type
  */
@@ -961,6 +1393,8 @@ void test__type_duplicate__duplicate_first(void** state)
     assert_true(_type_duplicate(sizeof(_test__type_duplicate1_t), "_test__type_duplicate1_t",
                 sizeof(struct _test__type_duplicate1), "struct _test__type_duplicate1") == true);
     assert_true(_type_is_registered("struct _test__type_duplicate1") != NULL);
+    assert_true(_type_is_registered("struct _test__type_duplicate1")->_t_typeid ==
+                _type_is_registered("_test__type_duplicate1_t")->_t_typeid);
 }
 
 void test__type_duplicate__duplicate_second(void** state)
@@ -1011,11 +1445,13 @@ void test__type_register__register_default(void** state)
     assert_true(pt_type != NULL);
     assert_true(pt_type->_t_typesize == sizeof(_test__type_register1_t));
     assert_true(strncmp(pt_type->_s_typename, "_test__type_register1_t", _TYPE_NAME_SIZE) == 0);
+    assert_true(pt_type->_t_typeid >= _TYPE_ID_USER_DEFINE);
     assert_true(pt_type->_t_style == _TYPE_USER_DEFINE);
     assert_true(pt_type->_t_typeinit == _type_init_default);
     assert_true(pt_type->_t_typeless == _type_less_default);
     assert_true(pt_type->_t_typecopy == _type_copy_default);
     assert_true(pt_type->_t_typedestroy == _type_destroy_default);
+    assert_true(pt_type->_t_typehash == _type_hash_default);
 }
 
 void test__type_register__register(void** state)
@@ -1027,6 +1463,8 @@ void test__type_register__register(void** state)
     assert_true(pt_type != NULL);
     assert_true(pt_type->_t_typesize == sizeof(_test__type_register2_t));
     assert_true(strncmp(pt_type->_s_typename, "_test__type_register2_t", _TYPE_NAME_SIZE) == 0);
+    assert_true(pt_type->_t_typeid >= _TYPE_ID_USER_DEFINE);
+    assert_true(pt_type->_t_typeid != _type_is_registered("_test__type_register1_t")->_t_typeid);
     assert_true(pt_type->_t_style == _TYPE_USER_DEFINE);
     assert_true(pt_type->_t_typeinit == _test__type_register2_init);
     assert_true(pt_type->_t_typeless == _test__type_register2_less);
@@ -1034,6 +1472,218 @@ void test__type_register__register(void** state)
     assert_true(pt_type->_t_typedestroy == _test__type_register2_destroy);
 }
 
+/*
+ * test _type_register_ex
+ */
+UT_CASE_DEFINATION(_type_register_ex)
+typedef struct _test__type_register_ex1 {
+    int n_elem;
+}_test__type_register_ex1_t;
+typedef struct _test__type_register_ex2 {
+    int n_elem;
+    int n_cache;
+}_test__type_register_ex2_t;
+static void _test__type_register_ex2_hash(const void* cpv_input, void* pv_output)
+{
+    *(size_t*)pv_output = (size_t)((_test__type_register_ex2_t*)cpv_input)->n_elem;
+}
+typedef struct _test__type_register_ex3 {
+    int n_elem;
+}_test__type_register_ex3_t;
+static void _test__type_register_ex3_less(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    *(bool_t*)pv_output = ((_test__type_register_ex3_t*)cpv_first)->n_elem < ((_test__type_register_ex3_t*)cpv_second)->n_elem;
+}
+static void _test__type_register_ex3_compare(const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    *(int*)pv_output = ((_test__type_register_ex3_t*)cpv_first)->n_elem - ((_test__type_register_ex3_t*)cpv_second)->n_elem;
+}
+
+void test__type_register_ex__null_typename(void** state)
+{
+    expect_assert_failure(_type_register_ex(sizeof(int), NULL, NULL, NULL, NULL, NULL, NULL, NULL));
+}
+
+void test__type_register_ex__registered(void** state)
+{
+    assert_true(_type_register_ex(sizeof(_test__type_register1_t), "_test__type_register1_t",
+                NULL, NULL, NULL, NULL, _test__type_register_ex2_hash, NULL) == false);
+    assert_true(_type_is_registered("_test__type_register1_t")->_t_typehash == _type_hash_default);
+}
+
+void test__type_register_ex__register_default(void** state)
+{
+    _type_t* pt_type = NULL;
+    assert_true(_type_register_ex(sizeof(_test__type_register_ex1_t), "_test__type_register_ex1_t",
+                NULL, NULL, NULL, NULL, NULL, NULL) == true);
+    pt_type = _type_is_registered("_test__type_register_ex1_t");
+    assert_true(pt_type != NULL);
+    assert_true(pt_type->_t_typesize == sizeof(_test__type_register_ex1_t));
+    assert_true(pt_type->_t_style == _TYPE_USER_DEFINE);
+    assert_true(pt_type->_t_typeinit == _type_init_default);
+    assert_true(pt_type->_t_typeless == _type_less_default);
+    assert_true(pt_type->_t_typecopy == _type_copy_default);
+    assert_true(pt_type->_t_typedestroy == _type_destroy_default);
+    assert_true(pt_type->_t_typehash == _type_hash_default);
+    assert_true(pt_type->_t_typecompare == NULL);
+}
+
+void test__type_register_ex__register(void** state)
+{
+    _type_t* pt_type = NULL;
+    assert_true(_type_register_ex(sizeof(_test__type_register_ex2_t), "_test__type_register_ex2_t",
+                NULL, NULL, NULL, NULL, _test__type_register_ex2_hash, NULL) == true);
+    pt_type = _type_is_registered("_test__type_register_ex2_t");
+    assert_true(pt_type != NULL);
+    assert_true(pt_type->_t_typesize == sizeof(_test__type_register_ex2_t));
+    assert_true(pt_type->_t_style == _TYPE_USER_DEFINE);
+    assert_true(pt_type->_t_typeinit == _type_init_default);
+    assert_true(pt_type->_t_typedestroy == _type_destroy_default);
+    assert_true(pt_type->_t_typehash == _test__type_register_ex2_hash);
+    assert_true(pt_type->_t_typecompare == NULL);
+}
+
+void test__type_register_ex__register_compare(void** state)
+{
+    _type_t* pt_type = NULL;
+    assert_true(_type_register_ex(sizeof(_test__type_register_ex3_t), "_test__type_register_ex3_t",
+                NULL, NULL, _test__type_register_ex3_less, NULL, NULL, _test__type_register_ex3_compare) == true);
+    pt_type = _type_is_registered("_test__type_register_ex3_t");
+    assert_true(pt_type != NULL);
+    assert_true(pt_type->_t_typeless == _test__type_register_ex3_less);
+    assert_true(pt_type->_t_typehash == _type_hash_default);
+    assert_true(pt_type->_t_typecompare == _test__type_register_ex3_compare);
+}
+
+/*
+ * test _type_hash_value
+ */
+UT_CASE_DEFINATION(_type_hash_value)
+void test__type_hash_value__null_typeinfo(void** state)
+{
+    int n_elem = 0;
+    expect_assert_failure(_type_hash_value(NULL, &n_elem));
+}
+
+void test__type_hash_value__null_value(void** state)
+{
+    _typeinfo_t t_info;
+    _test__get_type(&t_info, "int");
+    expect_assert_failure(_type_hash_value(&t_info, NULL));
+}
+
+void test__type_hash_value__c_builtin(void** state)
+{
+    _typeinfo_t t_info;
+    int n_elem = 100;
+    _test__get_type(&t_info, "int");
+    assert_true(_type_hash_value(&t_info, &n_elem) == _hashtable_hash_bytes(&n_elem, sizeof(int)));
+}
+
+void test__type_hash_value__cstl_builtin(void** state)
+{
+    _typeinfo_t t_info;
+    string_t* pstr_first = create_string();
+    string_t* pstr_second = create_string();
+    string_init_cstr(pstr_first, "abcdefg");
+    string_init_cstr(pstr_second, "abcdefg");
+
+    _test__get_type(&t_info, "string_t");
+    assert_true(_type_hash_value(&t_info, pstr_first) == _type_hash_value(&t_info, pstr_second));
+    assert_true(_type_hash_value(&t_info, pstr_first) == _hashtable_hash_bytes("abcdefg", 7));
+
+    string_destroy(pstr_first);
+    string_destroy(pstr_second);
+}
+
+void test__type_hash_value__user_define_default(void** state)
+{
+    _typeinfo_t t_info;
+    _test__type_register_ex1_t t_elem;
+    t_elem.n_elem = 3;
+    _test__get_type(&t_info, "_test__type_register_ex1_t");
+    assert_true(_type_hash_value(&t_info, &t_elem) == _hashtable_hash_bytes(&t_elem, sizeof(t_elem)));
+}
+
+void test__type_hash_value__user_define(void** state)
+{
+    _typeinfo_t t_info;
+    _test__type_register_ex2_t t_first;
+    _test__type_register_ex2_t t_second;
+    t_first.n_elem = 3;
+    t_first.n_cache = 10;
+    t_second.n_elem = 3;
+    t_second.n_cache = 20;
+    _test__get_type(&t_info, "_test__type_register_ex2_t");
+    assert_true(_type_hash_value(&t_info, &t_first) == 3);
+    assert_true(_type_hash_value(&t_info, &t_first) == _type_hash_value(&t_info, &t_second));
+}
+
+/*
+ * test _type_unregister
+ */
+UT_CASE_DEFINATION(_type_unregister)
+typedef struct _test__type_unregister {
+    int n_a;
+    int n_b;
+}_test__type_unregister_t;
+
+void test__type_unregister__null_typename(void** state)
+{
+    expect_assert_failure(_type_unregister(sizeof(int), NULL));
+}
+
+void test__type_unregister__c_builtin(void** state)
+{
+    assert_false(_type_unregister(sizeof(int), "int"));
+    assert_true(_type_is_registered("int") != NULL);
+}
+
+void test__type_unregister__cstl_builtin(void** state)
+{
+    assert_false(_type_unregister(sizeof(vector_t), "vector_t"));
+    assert_true(_type_is_registered("vector_t") != NULL);
+}
+
+void test__type_unregister__not_registered(void** state)
+{
+    assert_false(_type_unregister(sizeof(_test__type_unregister_t), "_test__type_unregister_t"));
+}
+
+void test__type_unregister__size_not_equal(void** state)
+{
+    type_register(_test__type_unregister_t, NULL, NULL, NULL, NULL);
+    assert_false(_type_unregister(sizeof(int), "_test__type_unregister_t"));
+    assert_true(_type_is_registered("_test__type_unregister_t") != NULL);
+}
+
+void test__type_unregister__unregister(void** state)
+{
+    vector_t* pvec = NULL;
+
+    type_duplicate(_test__type_unregister_t, struct _test__type_unregister);
+    pvec = create_vector(_test__type_unregister_t);
+    assert_true(pvec != NULL);
+    vector_destroy(pvec);
+
+    assert_true(type_unregister(struct _test__type_unregister));
+    assert_true(_type_is_registered("_test__type_unregister_t") == NULL);
+    assert_true(_type_is_registered("struct _test__type_unregister") == NULL);
+    assert_true(create_vector(_test__type_unregister_t) == NULL);
+    assert_false(type_unregister(_test__type_unregister_t));
+}
+
+void test__type_unregister__register_again(void** state)
+{
+    vector_t* pvec = NULL;
+
+    assert_true(type_register(_test__type_unregister_t, NULL, NULL, NULL, NULL));
+    pvec = create_vector(_test__type_unregister_t);
+    assert_true(pvec != NULL);
+    assert_true(pvec->_t_typeinfo._pt_type == _type_is_registered("_test__type_unregister_t"));
+    vector_destroy(pvec);
+}
+
 /*
  * test all_types
  */
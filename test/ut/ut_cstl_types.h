@@ -106,6 +106,73 @@ void test__type_is_same_ex__same_typeinfo(void** state);
 void test__type_is_same_ex__not_same_type(void** state);
 void test__type_is_same_ex__not_same_style(void** state);
 void test__type_is_same_ex__same(void** state);
+/*
+ * test _type_is_trivially_initializable
+ */
+UT_CASE_DECLARATION(_type_is_trivially_initializable)
+void test__type_is_trivially_initializable__null_typeinfo(void** state);
+void test__type_is_trivially_initializable__c_builtin(void** state);
+void test__type_is_trivially_initializable__c_string(void** state);
+void test__type_is_trivially_initializable__cstl_builtin(void** state);
+void test__type_is_trivially_initializable__user_define_default(void** state);
+void test__type_is_trivially_initializable__user_define(void** state);
+/*
+ * test _type_is_trivially_copyable
+ */
+UT_CASE_DECLARATION(_type_is_trivially_copyable)
+void test__type_is_trivially_copyable__null_typeinfo(void** state);
+void test__type_is_trivially_copyable__c_builtin(void** state);
+void test__type_is_trivially_copyable__c_string(void** state);
+void test__type_is_trivially_copyable__cstl_builtin(void** state);
+void test__type_is_trivially_copyable__user_define_default(void** state);
+void test__type_is_trivially_copyable__user_define(void** state);
+/*
+ * test _type_is_trivially_destructible
+ */
+UT_CASE_DECLARATION(_type_is_trivially_destructible)
+void test__type_is_trivially_destructible__null_typeinfo(void** state);
+void test__type_is_trivially_destructible__c_builtin(void** state);
+void test__type_is_trivially_destructible__c_string(void** state);
+void test__type_is_trivially_destructible__cstl_builtin(void** state);
+void test__type_is_trivially_destructible__user_define_default(void** state);
+void test__type_is_trivially_destructible__user_define(void** state);
+/*
+ * test _type_is_trivially_relocatable
+ */
+UT_CASE_DECLARATION(_type_is_trivially_relocatable)
+void test__type_is_trivially_relocatable__null_typeinfo(void** state);
+void test__type_is_trivially_relocatable__c_builtin(void** state);
+void test__type_is_trivially_relocatable__c_string(void** state);
+void test__type_is_trivially_relocatable__cstl_builtin(void** state);
+void test__type_is_trivially_relocatable__user_define_default(void** state);
+void test__type_is_trivially_relocatable__user_define(void** state);
+/*
+ * test _type_is_relocatable
+ */
+UT_CASE_DECLARATION(_type_is_relocatable)
+void test__type_is_relocatable__null_typeinfo(void** state);
+void test__type_is_relocatable__c_builtin(void** state);
+void test__type_is_relocatable__cstl_builtin(void** state);
+/*
+ * test _type_relocate
+ */
+UT_CASE_DECLARATION(_type_relocate)
+void test__type_relocate__null_typeinfo(void** state);
+void test__type_relocate__null_target(void** state);
+void test__type_relocate__null_source(void** state);
+void test__type_relocate__not_relocatable(void** state);
+void test__type_relocate__c_builtin(void** state);
+void test__type_relocate__string(void** state);
+void test__type_relocate__deque(void** state);
+void test__type_relocate__set(void** state);
+void test__type_relocate__map(void** state);
+/*
+ * test _type_swap
+ */
+UT_CASE_DECLARATION(_type_swap)
+void test__type_swap__null_typeinfo(void** state);
+void test__type_swap__c_builtin(void** state);
+void test__type_swap__set(void** state);
 /*
  * test _type_get_type
  */
@@ -156,6 +223,36 @@ void test__type_register__null_typename(void** state);
 void test__type_register__registered(void** state);
 void test__type_register__register_default(void** state);
 void test__type_register__register(void** state);
+/*
+ * test _type_register_ex
+ */
+UT_CASE_DECLARATION(_type_register_ex)
+void test__type_register_ex__null_typename(void** state);
+void test__type_register_ex__registered(void** state);
+void test__type_register_ex__register_default(void** state);
+void test__type_register_ex__register(void** state);
+void test__type_register_ex__register_compare(void** state);
+/*
+ * test _type_hash_value
+ */
+UT_CASE_DECLARATION(_type_hash_value)
+void test__type_hash_value__null_typeinfo(void** state);
+void test__type_hash_value__null_value(void** state);
+void test__type_hash_value__c_builtin(void** state);
+void test__type_hash_value__cstl_builtin(void** state);
+void test__type_hash_value__user_define_default(void** state);
+void test__type_hash_value__user_define(void** state);
+/*
+ * test _type_unregister
+ */
+UT_CASE_DECLARATION(_type_unregister)
+void test__type_unregister__null_typename(void** state);
+void test__type_unregister__c_builtin(void** state);
+void test__type_unregister__cstl_builtin(void** state);
+void test__type_unregister__not_registered(void** state);
+void test__type_unregister__size_not_equal(void** state);
+void test__type_unregister__unregister(void** state);
+void test__type_unregister__register_again(void** state);
 /*
  * test all types
  */
@@ -462,6 +559,45 @@ void test__ulong_long_usage__duplicate(void** state);
     UT_CASE(test__type_is_same_ex__not_same_type),\
     UT_CASE(test__type_is_same_ex__not_same_style),\
     UT_CASE(test__type_is_same_ex__same),\
+    UT_CASE_BEGIN(_type_is_trivially_initializable, test__type_is_trivially_initializable__null_typeinfo),\
+    UT_CASE(test__type_is_trivially_initializable__c_builtin),\
+    UT_CASE(test__type_is_trivially_initializable__c_string),\
+    UT_CASE(test__type_is_trivially_initializable__cstl_builtin),\
+    UT_CASE(test__type_is_trivially_initializable__user_define_default),\
+    UT_CASE(test__type_is_trivially_initializable__user_define),\
+    UT_CASE_BEGIN(_type_is_trivially_copyable, test__type_is_trivially_copyable__null_typeinfo),\
+    UT_CASE(test__type_is_trivially_copyable__c_builtin),\
+    UT_CASE(test__type_is_trivially_copyable__c_string),\
+    UT_CASE(test__type_is_trivially_copyable__cstl_builtin),\
+    UT_CASE(test__type_is_trivially_copyable__user_define_default),\
+    UT_CASE(test__type_is_trivially_copyable__user_define),\
+    UT_CASE_BEGIN(_type_is_trivially_destructible, test__type_is_trivially_destructible__null_typeinfo),\
+    UT_CASE(test__type_is_trivially_destructible__c_builtin),\
+    UT_CASE(test__type_is_trivially_destructible__c_string),\
+    UT_CASE(test__type_is_trivially_destructible__cstl_builtin),\
+    UT_CASE(test__type_is_trivially_destructible__user_define_default),\
+    UT_CASE(test__type_is_trivially_destructible__user_define),\
+    UT_CASE_BEGIN(_type_is_trivially_relocatable, test__type_is_trivially_relocatable__null_typeinfo),\
+    UT_CASE(test__type_is_trivially_relocatable__c_builtin),\
+    UT_CASE(test__type_is_trivially_relocatable__c_string),\
+    UT_CASE(test__type_is_trivially_relocatable__cstl_builtin),\
+    UT_CASE(test__type_is_trivially_relocatable__user_define_default),\
+    UT_CASE(test__type_is_trivially_relocatable__user_define),\
+    UT_CASE_BEGIN(_type_is_relocatable, test__type_is_relocatable__null_typeinfo),\
+    UT_CASE(test__type_is_relocatable__c_builtin),\
+    UT_CASE(test__type_is_relocatable__cstl_builtin),\
+    UT_CASE_BEGIN(_type_relocate, test__type_relocate__null_typeinfo),\
+    UT_CASE(test__type_relocate__null_target),\
+    UT_CASE(test__type_relocate__null_source),\
+    UT_CASE(test__type_relocate__not_relocatable),\
+    UT_CASE(test__type_relocate__c_builtin),\
+    UT_CASE(test__type_relocate__string),\
+    UT_CASE(test__type_relocate__deque),\
+    UT_CASE(test__type_relocate__set),\
+    UT_CASE(test__type_relocate__map),\
+    UT_CASE_BEGIN(_type_swap, test__type_swap__null_typeinfo),\
+    UT_CASE(test__type_swap__c_builtin),\
+    UT_CASE(test__type_swap__set),\
     UT_CASE_BEGIN(_type_get_type, test__type_get_type__null_typeinfo),\
     UT_CASE(test__type_get_type__null_typename),\
     UT_CASE(test__type_get_type__invalid),\
@@ -496,6 +632,24 @@ void test__ulong_long_usage__duplicate(void** state);
     UT_CASE(test__type_register__registered),\
     UT_CASE(test__type_register__register_default),\
     UT_CASE(test__type_register__register),\
+    UT_CASE_BEGIN(_type_register_ex, test__type_register_ex__null_typename),\
+    UT_CASE(test__type_register_ex__registered),\
+    UT_CASE(test__type_register_ex__register_default),\
+    UT_CASE(test__type_register_ex__register),\
+    UT_CASE(test__type_register_ex__register_compare),\
+    UT_CASE_BEGIN(_type_hash_value, test__type_hash_value__null_typeinfo),\
+    UT_CASE(test__type_hash_value__null_value),\
+    UT_CASE(test__type_hash_value__c_builtin),\
+    UT_CASE(test__type_hash_value__cstl_builtin),\
+    UT_CASE(test__type_hash_value__user_define_default),\
+    UT_CASE(test__type_hash_value__user_define),\
+    UT_CASE_BEGIN(_type_unregister, test__type_unregister__null_typename),\
+    UT_CASE(test__type_unregister__c_builtin),\
+    UT_CASE(test__type_unregister__cstl_builtin),\
+    UT_CASE(test__type_unregister__not_registered),\
+    UT_CASE(test__type_unregister__size_not_equal),\
+    UT_CASE(test__type_unregister__unregister),\
+    UT_CASE(test__type_unregister__register_again),\
     UT_CASE_BEGIN(pointer_usage, test__pointer_usage__create),\
     UT_CASE(test__pointer_usage__init_n),\
     UT_CASE(test__pointer_usage__init_elem),\
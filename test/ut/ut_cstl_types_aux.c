@@ -7,6 +7,7 @@
 #include "cstl/cstl_alloc.h"
 #include "cstl/cstl_types.h"
 #include "cstl/cstring.h"
+#include "cstl/cvector.h"
 #include "cstl/clist.h"
 #include "cstl/cslist.h"
 #include "cstl/cdeque.h"
@@ -44,160 +45,195 @@ void test__type_hash__lessthan_bucketcount(void** state)
 }
 
 #define TEST__TYPE_REGISTER_BEGIN()\
-    _typenode_t* pt_node = NULL;\
-    _type_t*     pt_type = NULL;\
-    size_t       t_pos = 0
-#define TEST__TYPE_REGISTER_TYPE(type, type_text, type_suffix, type_style)\
+    _type_t*     pt_type = NULL
+#define TEST__TYPE_REGISTER_TYPE(type, type_text, type_suffix, type_style, type_id)\
     do{\
-        t_pos = _type_hash(type_text);\
-        pt_node = _gt_typeregister._apt_bucket[t_pos];\
-        while (pt_node != NULL) {\
-            if (strncmp(pt_node->_s_typename, type_text, _TYPE_NAME_SIZE) == 0) {\
-                break;\
-            }\
-            pt_node = pt_node->_pt_next;\
-        }\
-        assert_true(pt_node != NULL);\
-        pt_type = pt_node->_pt_type;\
+        pt_type = _type_find_builtin(type_text);\
         assert_true(pt_type != NULL);\
+        assert_true(_type_is_registered(type_text) == pt_type);\
         assert_true(pt_type->_t_typesize == sizeof(type));\
         assert_true(strncmp(pt_type->_s_typename, type_text, _TYPE_NAME_SIZE) == 0);\
+        assert_true(pt_type->_t_typeid == type_id);\
         assert_true(pt_type->_t_style != _TYPE_INVALID);\
         assert_true(pt_type->_t_style == type_style);\
         assert_true(pt_type->_t_typeinit == _type_init_##type_suffix);\
         assert_true(pt_type->_t_typeless == _type_less_##type_suffix);\
         assert_true(pt_type->_t_typecopy == _type_copy_##type_suffix);\
         assert_true(pt_type->_t_typedestroy == _type_destroy_##type_suffix);\
+        assert_true(pt_type->_t_typehash == _type_hash_##type_suffix);\
     }while(false)
 #define TEST__TYPE_REGISTER_TYPE_NODE(type, type_text)\
     do{\
-        t_pos = _type_hash(type_text);\
-        pt_node = _gt_typeregister._apt_bucket[t_pos];\
-        while (pt_node != NULL) {\
-            if (strncmp(pt_node->_s_typename, type_text, _TYPE_NAME_SIZE) == 0) {\
-                break;\
-            }\
-            pt_node->_pt_next;\
-        }\
-        assert_true(pt_node != NULL);\
-        assert_true(pt_node->_pt_type == pt_type);\
+        assert_true(_type_find_builtin(type_text) == pt_type);\
+        assert_true(_type_is_registered(type_text) == pt_type);\
     }while(false)
+#define TEST__TYPE_REGISTER_TYPE_COMPARE(type_suffix)\
+    assert_true(pt_type->_t_typecompare == _type_compare_##type_suffix)
+#define TEST__TYPE_REGISTER_TYPE_MOVE(type_suffix)\
+    assert_true(pt_type->_t_typemove == _type_move_##type_suffix)
 #define TEST__TYPE_REGISTER_END()
 
 /*
- * test _type_register_c_builtin
+ * test _type_find_builtin
  */
-UT_CASE_DEFINATION(_type_register_c_builtin)
-void test__type_register_c_builtin__all(void** state)
+UT_CASE_DEFINATION(_type_find_builtin)
+void test__type_find_builtin__null_typename(void** state)
 {
-    TEST__TYPE_REGISTER_BEGIN();
-    /*
-    _typenode_t* pt_node = NULL;
-    _type_t*     pt_type = NULL;
-    size_t       t_pos = 0;
-    */
+    expect_assert_failure(_type_find_builtin(NULL));
+}
 
-    _type_register_c_builtin();
+void test__type_find_builtin__not_builtin(void** state)
+{
+    assert_true(_type_find_builtin("") == NULL);
+    assert_true(_type_find_builtin("abcdefghijklmnopqrstuvwxyz") == NULL);
+    assert_true(_type_find_builtin("vector_t<int>") == NULL);
+}
+
+void test__type_find_builtin__user_define(void** state)
+{
+    typedef struct _tag_test_type_find_builtin {
+        int a;
+    } _test_type_find_builtin_t;
+    type_register(_test_type_find_builtin_t, NULL, NULL, NULL, NULL);
+    assert_true(_type_is_registered("_test_type_find_builtin_t") != NULL);
+    assert_true(_type_find_builtin("_test_type_find_builtin_t") == NULL);
+    type_unregister(_test_type_find_builtin_t);
+}
+
+void test__type_find_builtin__c_builtin(void** state)
+{
+    TEST__TYPE_REGISTER_BEGIN();
 
     /* char */
-    TEST__TYPE_REGISTER_TYPE(char, _CHAR_TYPE, char, _TYPE_C_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(char, _CHAR_TYPE, char, _TYPE_C_BUILTIN, _TYPE_ID_CHAR);
+    TEST__TYPE_REGISTER_TYPE_COMPARE(char);
     TEST__TYPE_REGISTER_TYPE_NODE(char, _CHAR_TYPE);
     /* unsigned char */
-    TEST__TYPE_REGISTER_TYPE(unsigned char, _UNSIGNED_CHAR_TYPE, uchar, _TYPE_C_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(unsigned char, _UNSIGNED_CHAR_TYPE, uchar, _TYPE_C_BUILTIN, _TYPE_ID_UNSIGNED_CHAR);
+    TEST__TYPE_REGISTER_TYPE_COMPARE(uchar);
     /* short */
-    TEST__TYPE_REGISTER_TYPE(short, _SHORT_TYPE, short, _TYPE_C_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(short, _SHORT_TYPE, short, _TYPE_C_BUILTIN, _TYPE_ID_SHORT);
+    TEST__TYPE_REGISTER_TYPE_COMPARE(short);
     TEST__TYPE_REGISTER_TYPE_NODE(short int, _SHORT_INT_TYPE);
     TEST__TYPE_REGISTER_TYPE_NODE(signed short, _SIGNED_SHORT_TYPE);
     TEST__TYPE_REGISTER_TYPE_NODE(signed short int, _SIGNED_SHORT_INT_TYPE);
     /* unsigned short */
-    TEST__TYPE_REGISTER_TYPE(unsigned short, _UNSIGNED_SHORT_TYPE, ushort, _TYPE_C_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(unsigned short, _UNSIGNED_SHORT_TYPE, ushort, _TYPE_C_BUILTIN, _TYPE_ID_UNSIGNED_SHORT);
+    TEST__TYPE_REGISTER_TYPE_COMPARE(ushort);
     TEST__TYPE_REGISTER_TYPE_NODE(unsigned short int, _UNSIGNED_SHORT_INT_TYPE);
     /* int */
-    TEST__TYPE_REGISTER_TYPE(int, _INT_TYPE, int, _TYPE_C_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(int, _INT_TYPE, int, _TYPE_C_BUILTIN, _TYPE_ID_INT);
+    TEST__TYPE_REGISTER_TYPE_COMPARE(int);
     TEST__TYPE_REGISTER_TYPE_NODE(signed, _SIGNED_TYPE);
     TEST__TYPE_REGISTER_TYPE_NODE(signed int, _SIGNED_INT_TYPE);
     /* unsigned int */
-    TEST__TYPE_REGISTER_TYPE(unsigned int, _UNSIGNED_INT_TYPE, uint, _TYPE_C_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(unsigned int, _UNSIGNED_INT_TYPE, uint, _TYPE_C_BUILTIN, _TYPE_ID_UNSIGNED_INT);
+    TEST__TYPE_REGISTER_TYPE_COMPARE(uint);
     TEST__TYPE_REGISTER_TYPE_NODE(signed, _UNSIGNED_TYPE);
     /* long */
-    TEST__TYPE_REGISTER_TYPE(long, _LONG_TYPE, long, _TYPE_C_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(long, _LONG_TYPE, long, _TYPE_C_BUILTIN, _TYPE_ID_LONG);
+    TEST__TYPE_REGISTER_TYPE_COMPARE(long);
     TEST__TYPE_REGISTER_TYPE_NODE(long int, _LONG_INT_TYPE);
     TEST__TYPE_REGISTER_TYPE_NODE(signed long, _SIGNED_LONG_TYPE);
     TEST__TYPE_REGISTER_TYPE_NODE(signed long int, _SIGNED_LONG_INT_TYPE);
     /* unsigned long */
-    TEST__TYPE_REGISTER_TYPE(unsigned long, _UNSIGNED_LONG_TYPE, ulong, _TYPE_C_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(unsigned long, _UNSIGNED_LONG_TYPE, ulong, _TYPE_C_BUILTIN, _TYPE_ID_UNSIGNED_LONG);
+    TEST__TYPE_REGISTER_TYPE_COMPARE(ulong);
     TEST__TYPE_REGISTER_TYPE_NODE(unsigned long int, _UNSIGNED_LONG_INT_TYPE);
     /* float */
-    TEST__TYPE_REGISTER_TYPE(float, _FLOAT_TYPE, float, _TYPE_C_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(float, _FLOAT_TYPE, float, _TYPE_C_BUILTIN, _TYPE_ID_FLOAT);
+    TEST__TYPE_REGISTER_TYPE_COMPARE(float);
     /* double */
-    TEST__TYPE_REGISTER_TYPE(double, _DOUBLE_TYPE, double, _TYPE_C_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(double, _DOUBLE_TYPE, double, _TYPE_C_BUILTIN, _TYPE_ID_DOUBLE);
+    TEST__TYPE_REGISTER_TYPE_COMPARE(double);
     /* long double */
-    TEST__TYPE_REGISTER_TYPE(long double, _LONG_DOUBLE_TYPE, long_double, _TYPE_C_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(long double, _LONG_DOUBLE_TYPE, long_double, _TYPE_C_BUILTIN, _TYPE_ID_LONG_DOUBLE);
+    TEST__TYPE_REGISTER_TYPE_COMPARE(long_double);
     /* bool_t */
-    TEST__TYPE_REGISTER_TYPE(bool_t, _CSTL_BOOL_TYPE, cstl_bool, _TYPE_C_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(bool_t, _CSTL_BOOL_TYPE, cstl_bool, _TYPE_C_BUILTIN, _TYPE_ID_CSTL_BOOL);
+    TEST__TYPE_REGISTER_TYPE_COMPARE(cstl_bool);
     /* char* */
-    TEST__TYPE_REGISTER_TYPE(string_t, _C_STRING_TYPE, cstr, _TYPE_C_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(string_t, _C_STRING_TYPE, cstr, _TYPE_C_BUILTIN, _TYPE_ID_C_STRING);
+    TEST__TYPE_REGISTER_TYPE_COMPARE(cstr);
     /* void* */
-    TEST__TYPE_REGISTER_TYPE(void*, _POINTER_TYPE, pointer, _TYPE_C_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(void*, _POINTER_TYPE, pointer, _TYPE_C_BUILTIN, _TYPE_ID_POINTER);
+    TEST__TYPE_REGISTER_TYPE_COMPARE(pointer);
 #ifndef _MSC_VER
     /* _Bool */
-    TEST__TYPE_REGISTER_TYPE(_Bool, _BOOL_TYPE, bool, _TYPE_C_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(_Bool, _BOOL_TYPE, bool, _TYPE_C_BUILTIN, _TYPE_ID_BOOL);
+    TEST__TYPE_REGISTER_TYPE_COMPARE(bool);
 #endif
 
     TEST__TYPE_REGISTER_END();
 }
 
-/*
- * test _type_register_cstl_builtin
- */
-UT_CASE_DEFINATION(_type_register_cstl_builtin)
-void test__type_register_cstl_builtin__all(void** state)
+void test__type_find_builtin__cstl_builtin(void** state)
 {
     TEST__TYPE_REGISTER_BEGIN();
 
-    _type_register_cstl_builtin();
-
     /* vector_t */
-    TEST__TYPE_REGISTER_TYPE(vector_t, _VECTOR_TYPE, vector, _TYPE_CSTL_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(vector_t, _VECTOR_TYPE, vector, _TYPE_CSTL_BUILTIN, _TYPE_ID_VECTOR);
+    TEST__TYPE_REGISTER_TYPE_MOVE(vector);
+    assert_true(pt_type->_t_typecompare == NULL);
     /* list_t */
-    TEST__TYPE_REGISTER_TYPE(list_t, _LIST_TYPE, list, _TYPE_CSTL_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(list_t, _LIST_TYPE, list, _TYPE_CSTL_BUILTIN, _TYPE_ID_LIST);
+    TEST__TYPE_REGISTER_TYPE_MOVE(list);
     /* slist_t */
-    TEST__TYPE_REGISTER_TYPE(slist_t, _SLIST_TYPE, slist, _TYPE_CSTL_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(slist_t, _SLIST_TYPE, slist, _TYPE_CSTL_BUILTIN, _TYPE_ID_SLIST);
+    TEST__TYPE_REGISTER_TYPE_MOVE(slist);
     /* deque_t */
-    TEST__TYPE_REGISTER_TYPE(deque_t, _DEQUE_TYPE, deque, _TYPE_CSTL_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(deque_t, _DEQUE_TYPE, deque, _TYPE_CSTL_BUILTIN, _TYPE_ID_DEQUE);
+    TEST__TYPE_REGISTER_TYPE_MOVE(deque);
     /* stack_t */
-    TEST__TYPE_REGISTER_TYPE(stack_t, _STACK_TYPE, stack, _TYPE_CSTL_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(stack_t, _STACK_TYPE, stack, _TYPE_CSTL_BUILTIN, _TYPE_ID_STACK);
+    TEST__TYPE_REGISTER_TYPE_MOVE(stack);
     /* queue_t */
-    TEST__TYPE_REGISTER_TYPE(queue_t, _QUEUE_TYPE, queue, _TYPE_CSTL_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(queue_t, _QUEUE_TYPE, queue, _TYPE_CSTL_BUILTIN, _TYPE_ID_QUEUE);
+    TEST__TYPE_REGISTER_TYPE_MOVE(queue);
     /* priority_queue_t */
-    TEST__TYPE_REGISTER_TYPE(priority_queue_t, _PRIORITY_QUEUE_TYPE, priority_queue, _TYPE_CSTL_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(priority_queue_t, _PRIORITY_QUEUE_TYPE, priority_queue, _TYPE_CSTL_BUILTIN, _TYPE_ID_PRIORITY_QUEUE);
+    TEST__TYPE_REGISTER_TYPE_MOVE(priority_queue);
     /* set_t */
-    TEST__TYPE_REGISTER_TYPE(set_t, _SET_TYPE, set, _TYPE_CSTL_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(set_t, _SET_TYPE, set, _TYPE_CSTL_BUILTIN, _TYPE_ID_SET);
+    TEST__TYPE_REGISTER_TYPE_MOVE(set);
     /* map_t */
-    TEST__TYPE_REGISTER_TYPE(map_t, _MAP_TYPE, map, _TYPE_CSTL_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(map_t, _MAP_TYPE, map, _TYPE_CSTL_BUILTIN, _TYPE_ID_MAP);
+    TEST__TYPE_REGISTER_TYPE_MOVE(map);
     /* multiset_t */
-    TEST__TYPE_REGISTER_TYPE(multiset_t, _MULTISET_TYPE, multiset, _TYPE_CSTL_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(multiset_t, _MULTISET_TYPE, multiset, _TYPE_CSTL_BUILTIN, _TYPE_ID_MULTISET);
+    TEST__TYPE_REGISTER_TYPE_MOVE(multiset);
     /* multimap_t */
-    TEST__TYPE_REGISTER_TYPE(multimap_t, _MULTIMAP_TYPE, multimap, _TYPE_CSTL_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(multimap_t, _MULTIMAP_TYPE, multimap, _TYPE_CSTL_BUILTIN, _TYPE_ID_MULTIMAP);
+    TEST__TYPE_REGISTER_TYPE_MOVE(multimap);
     /* hash_set_t */
-    TEST__TYPE_REGISTER_TYPE(hash_set_t, _HASH_SET_TYPE, hash_set, _TYPE_CSTL_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(hash_set_t, _HASH_SET_TYPE, hash_set, _TYPE_CSTL_BUILTIN, _TYPE_ID_HASH_SET);
+    TEST__TYPE_REGISTER_TYPE_MOVE(hash_set);
     /* hash_map_t */
-    TEST__TYPE_REGISTER_TYPE(hash_map_t, _HASH_MAP_TYPE, hash_map, _TYPE_CSTL_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(hash_map_t, _HASH_MAP_TYPE, hash_map, _TYPE_CSTL_BUILTIN, _TYPE_ID_HASH_MAP);
+    TEST__TYPE_REGISTER_TYPE_MOVE(hash_map);
     /* hash_multiset_t */
-    TEST__TYPE_REGISTER_TYPE(hash_multiset_t, _HASH_MULTISET_TYPE, hash_multiset, _TYPE_CSTL_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(hash_multiset_t, _HASH_MULTISET_TYPE, hash_multiset, _TYPE_CSTL_BUILTIN, _TYPE_ID_HASH_MULTISET);
+    TEST__TYPE_REGISTER_TYPE_MOVE(hash_multiset);
     /* hash_multimap_t */
-    TEST__TYPE_REGISTER_TYPE(hash_multimap_t, _HASH_MULTIMAP_TYPE, hash_multimap, _TYPE_CSTL_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(hash_multimap_t, _HASH_MULTIMAP_TYPE, hash_multimap, _TYPE_CSTL_BUILTIN, _TYPE_ID_HASH_MULTIMAP);
+    TEST__TYPE_REGISTER_TYPE_MOVE(hash_multimap);
     /* pair_t */
-    TEST__TYPE_REGISTER_TYPE(pair_t, _PAIR_TYPE, pair, _TYPE_CSTL_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(pair_t, _PAIR_TYPE, pair, _TYPE_CSTL_BUILTIN, _TYPE_ID_PAIR);
+    TEST__TYPE_REGISTER_TYPE_MOVE(pair);
     /* string_t */
-    TEST__TYPE_REGISTER_TYPE(string_t, _STRING_TYPE, string, _TYPE_CSTL_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(string_t, _STRING_TYPE, string, _TYPE_CSTL_BUILTIN, _TYPE_ID_STRING);
+    TEST__TYPE_REGISTER_TYPE_MOVE(string);
+    TEST__TYPE_REGISTER_TYPE_COMPARE(string);
     /* range_t */
-    TEST__TYPE_REGISTER_TYPE(range_t, _RANGE_TYPE, range, _TYPE_CSTL_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(range_t, _RANGE_TYPE, range, _TYPE_CSTL_BUILTIN, _TYPE_ID_RANGE);
+    TEST__TYPE_REGISTER_TYPE_MOVE(range);
     /* basic_string_t */
-    TEST__TYPE_REGISTER_TYPE(basic_string_t, _BASIC_STRING_TYPE, basic_string, _TYPE_CSTL_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(basic_string_t, _BASIC_STRING_TYPE, basic_string, _TYPE_CSTL_BUILTIN, _TYPE_ID_BASIC_STRING);
+    TEST__TYPE_REGISTER_TYPE_MOVE(basic_string);
 
     /* iterator_t */
-    TEST__TYPE_REGISTER_TYPE(iterator_t, _ITERATOR_TYPE, iterator, _TYPE_CSTL_BUILTIN);
+    TEST__TYPE_REGISTER_TYPE(iterator_t, _ITERATOR_TYPE, iterator, _TYPE_CSTL_BUILTIN, _TYPE_ID_ITERATOR);
+    TEST__TYPE_REGISTER_TYPE_MOVE(iterator);
     TEST__TYPE_REGISTER_TYPE_NODE(vector_iterator_t, _VECTOR_ITERATOR_TYPE);
     TEST__TYPE_REGISTER_TYPE_NODE(list_iterator_t, _LIST_ITERATOR_TYPE);
     TEST__TYPE_REGISTER_TYPE_NODE(slist_iterator_t, _SLIST_ITERATOR_TYPE);
@@ -231,8 +267,9 @@ void test__type_init__all(void** state)
     } _test_type_init_t;
     type_register(_test_type_init_t, NULL, NULL, NULL, NULL);
     assert_true(_gt_typeregister._t_isinit == true);
-    test__type_register_c_builtin__all(state);
-    test__type_register_cstl_builtin__all(state);
+    assert_true(_gt_typeregister._t_nexttypeid > _TYPE_ID_USER_DEFINE);
+    test__type_find_builtin__c_builtin(state);
+    test__type_find_builtin__cstl_builtin(state);
 }
 
 /*
@@ -414,3 +451,244 @@ void test__type_cache_update__round(void** state)
     assert_true(_gt_typecache_index == 44);
 }
 
+/*
+ * test _type_info_cache_find
+ */
+UT_CASE_DEFINATION(_type_info_cache_find)
+void test__type_info_cache_find__typename_null(void** state)
+{
+    _typeinfo_t t_typeinfo;
+    expect_assert_failure(_type_info_cache_find(NULL, &t_typeinfo));
+}
+
+void test__type_info_cache_find__typeinfo_null(void** state)
+{
+    expect_assert_failure(_type_info_cache_find("int", NULL));
+}
+
+void test__type_info_cache_find__not_find(void** state)
+{
+    _typeinfo_t t_typeinfo;
+
+    _type_cache_invalidate();
+    assert_false(_type_info_cache_find("vector_t<int>", &t_typeinfo));
+}
+
+void test__type_info_cache_find__find(void** state)
+{
+    _typeinfo_t t_typeinfo;
+
+    _type_cache_invalidate();
+    _type_get_type(&t_typeinfo, "vector_t< int >");
+    memset(&t_typeinfo, 0x00, sizeof(_typeinfo_t));
+    assert_true(_type_info_cache_find("vector_t< int >", &t_typeinfo));
+    assert_true(strncmp(t_typeinfo._s_typename, "vector_t<int>", _TYPE_NAME_SIZE) == 0);
+    assert_true(t_typeinfo._t_style == _TYPE_CSTL_BUILTIN);
+    assert_true(t_typeinfo._pt_type == _type_is_registered("vector_t"));
+    assert_false(_type_info_cache_find("vector_t<int>", &t_typeinfo));
+}
+
+void test__type_info_cache_find__invalid_not_cached(void** state)
+{
+    _typeinfo_t t_typeinfo;
+
+    _type_cache_invalidate();
+    _type_get_type(&t_typeinfo, "vector_t<_test__type_info_cache_t>");
+    assert_true(t_typeinfo._t_style == _TYPE_INVALID);
+    assert_false(_type_info_cache_find("vector_t<_test__type_info_cache_t>", &t_typeinfo));
+}
+
+void test__type_info_cache_find__invalidated(void** state)
+{
+    _typeinfo_t t_typeinfo;
+
+    _type_get_type(&t_typeinfo, "list_t<long>");
+    assert_true(_type_info_cache_find("list_t<long>", &t_typeinfo));
+    _type_cache_invalidate();
+    assert_false(_type_info_cache_find("list_t<long>", &t_typeinfo));
+}
+
+/*
+ * test _type_info_cache_update
+ */
+UT_CASE_DEFINATION(_type_info_cache_update)
+void test__type_info_cache_update__typename_null(void** state)
+{
+    _typeinfo_t t_typeinfo;
+
+    _type_get_type(&t_typeinfo, "int");
+    expect_assert_failure(_type_info_cache_update(NULL, &t_typeinfo, _gt_typeinfocache_generation));
+}
+
+void test__type_info_cache_update__typeinfo_null(void** state)
+{
+    expect_assert_failure(_type_info_cache_update("int", NULL, _gt_typeinfocache_generation));
+}
+
+void test__type_info_cache_update__invalid_typeinfo(void** state)
+{
+    _typeinfo_t t_typeinfo;
+
+    t_typeinfo._t_style = _TYPE_INVALID;
+    t_typeinfo._pt_type = NULL;
+    expect_assert_failure(_type_info_cache_update("int", &t_typeinfo, _gt_typeinfocache_generation));
+}
+
+void test__type_info_cache_update__update(void** state)
+{
+    _typeinfo_t t_typeinfo;
+    _typeinfo_t t_cached;
+
+    _type_cache_invalidate();
+    _type_get_type(&t_typeinfo, "unsigned long");
+    _type_info_cache_update("unsigned   long", &t_typeinfo, _gt_typeinfocache_generation);
+    assert_true(_type_info_cache_find("unsigned   long", &t_cached));
+    assert_true(memcmp(&t_cached, &t_typeinfo, sizeof(_typeinfo_t)) == 0);
+}
+
+void test__type_info_cache_update__stale_generation(void** state)
+{
+    _typeinfo_t t_typeinfo;
+    _typeinfo_t t_cached;
+    size_t      t_generation = 0;
+
+    _type_cache_invalidate();
+    t_generation = _gt_typeinfocache_generation;
+    _type_get_type(&t_typeinfo, "unsigned long");
+    _type_cache_invalidate();
+    _type_info_cache_update("unsigned   long", &t_typeinfo, t_generation);
+    assert_false(_type_info_cache_find("unsigned   long", &t_cached));
+}
+
+/*
+ * test _type_cache_invalidate
+ */
+UT_CASE_DEFINATION(_type_cache_invalidate)
+void test__type_cache_invalidate__register(void** state)
+{
+    typedef struct _tag_test_type_cache_invalidate {
+        int a;
+    } _test_type_cache_invalidate_t;
+    _typeinfo_t t_typeinfo;
+    char        s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
+
+    _type_get_type(&t_typeinfo, "set_t<double>");
+    assert_true(_type_info_cache_find("set_t<double>", &t_typeinfo));
+    assert_true(_type_cache_find("set_t<double>", s_formalname) == _TYPE_CSTL_BUILTIN);
+    type_register(_test_type_cache_invalidate_t, NULL, NULL, NULL, NULL);
+    assert_false(_type_info_cache_find("set_t<double>", &t_typeinfo));
+    assert_true(_type_cache_find("set_t<double>", s_formalname) == _TYPE_INVALID);
+    assert_true(_gt_typecache_index == 0);
+}
+
+
+/*
+ * test _type_intern_name
+ */
+UT_CASE_DEFINATION(_type_intern_name)
+void test__type_intern_name__null(void** state)
+{
+    expect_assert_failure(_type_intern_name(NULL));
+}
+
+void test__type_intern_name__same(void** state)
+{
+    char        s_typename[_TYPE_NAME_SIZE + 1] = {'\0'};
+    const char* s_interned = NULL;
+
+    strncpy(s_typename, "map_t<int,vector_t<char*>>", _TYPE_NAME_SIZE);
+    s_interned = _type_intern_name(s_typename);
+    assert_true(s_interned != s_typename);
+    assert_true(strncmp(s_interned, s_typename, _TYPE_NAME_SIZE) == 0);
+    assert_true(_type_intern_name("map_t<int,vector_t<char*>>") == s_interned);
+}
+
+void test__type_intern_name__different(void** state)
+{
+    const char* s_first = _type_intern_name("list_t<short>");
+    const char* s_second = _type_intern_name("list_t<long>");
+
+    assert_true(s_first != s_second);
+    assert_true(strncmp(s_first, "list_t<short>", _TYPE_NAME_SIZE) == 0);
+    assert_true(strncmp(s_second, "list_t<long>", _TYPE_NAME_SIZE) == 0);
+}
+
+void test__type_intern_name__shared_by_containers(void** state)
+{
+    vector_t* pvec_first = create_vector(int);
+    vector_t* pvec_second = create_vector(int);
+
+    assert_true(pvec_first->_t_typeinfo._s_typename == pvec_second->_t_typeinfo._s_typename);
+    assert_true(strncmp(pvec_first->_t_typeinfo._s_typename, "int", _TYPE_NAME_SIZE) == 0);
+    _type_cache_invalidate();
+    vector_destroy(pvec_second);
+    pvec_second = create_vector(int);
+    assert_true(pvec_first->_t_typeinfo._s_typename == pvec_second->_t_typeinfo._s_typename);
+
+    vector_destroy(pvec_first);
+    vector_destroy(pvec_second);
+}
+
+/*
+ * test _type_lock
+ */
+UT_CASE_DEFINATION(_type_lock)
+void test__type_lock__try_lock(void** state)
+{
+    assert_true(_type_try_lock());
+    assert_false(_type_try_lock());
+    _type_unlock();
+    _type_lock();
+    assert_false(_type_try_lock());
+    _type_unlock();
+    assert_true(_type_try_lock());
+    _type_unlock();
+}
+
+void test__type_lock__unlock_not_locked(void** state)
+{
+    expect_assert_failure(_type_unlock());
+}
+
+void test__type_lock__cache_update_locked(void** state)
+{
+    _typeinfo_t t_typeinfo;
+    char        s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
+
+    _type_cache_invalidate();
+    _type_get_type(&t_typeinfo, "int");
+    _type_lock();
+    _type_cache_update("slist_t<int>", "slist_t<int>", _TYPE_CSTL_BUILTIN);
+    _type_info_cache_update("int", &t_typeinfo, _gt_typeinfocache_generation);
+    _type_unlock();
+    assert_true(_type_cache_find("slist_t<int>", s_formalname) == _TYPE_INVALID);
+    assert_true(_gt_typecache_index == 1);
+}
+
+void test__type_lock__cache_find_writing(void** state)
+{
+    _typeinfo_t t_typeinfo;
+    char        s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
+
+    _type_cache_invalidate();
+    _type_get_type(&t_typeinfo, "double");
+    assert_true(_type_cache_find("double", s_formalname) == _TYPE_C_BUILTIN);
+    assert_true(_type_info_cache_find("double", &t_typeinfo));
+    _gt_typecache_sequence++;
+    assert_true(_type_cache_find("double", s_formalname) == _TYPE_INVALID);
+    assert_false(_type_info_cache_find("double", &t_typeinfo));
+    _gt_typecache_sequence++;
+    assert_true(_type_cache_find("double", s_formalname) == _TYPE_C_BUILTIN);
+    assert_true(_type_info_cache_find("double", &t_typeinfo));
+}
+
+void test__type_lock__init_once(void** state)
+{
+    _type_t* pt_type = _type_is_registered("int");
+    size_t   t_nexttypeid = _gt_typeregister._t_nexttypeid;
+
+    assert_true(pt_type != NULL);
+    _type_init();
+    assert_true(_type_is_registered("int") == pt_type);
+    assert_true(_gt_typeregister._t_nexttypeid == t_nexttypeid);
+}
@@ -10,15 +10,14 @@ void test__type_hash__null_typename(void** state);
 void test__type_hash__null_empty(void** state);
 void test__type_hash__lessthan_bucketcount(void** state);
 /*
- * test _type_register_c_builtin
+ * test _type_find_builtin
  */
-UT_CASE_DECLARATION(_type_register_c_builtin)
-void test__type_register_c_builtin__all(void** state);
-/*
- * test _type_register_cstl_builtin
- */
-UT_CASE_DECLARATION(_type_register_cstl_builtin)
-void test__type_register_cstl_builtin__all(void** state);
+UT_CASE_DECLARATION(_type_find_builtin)
+void test__type_find_builtin__null_typename(void** state);
+void test__type_find_builtin__not_builtin(void** state);
+void test__type_find_builtin__user_define(void** state);
+void test__type_find_builtin__c_builtin(void** state);
+void test__type_find_builtin__cstl_builtin(void** state);
 /*
  * test _type_init
  */
@@ -52,12 +51,57 @@ void test__type_cache_update__empty(void** state);
 void test__type_cache_update__not_empty(void** state);
 void test__type_cache_update__round(void** state);
 
+/*
+ * test _type_info_cache_find
+ */
+UT_CASE_DECLARATION(_type_info_cache_find)
+void test__type_info_cache_find__typename_null(void** state);
+void test__type_info_cache_find__typeinfo_null(void** state);
+void test__type_info_cache_find__not_find(void** state);
+void test__type_info_cache_find__find(void** state);
+void test__type_info_cache_find__invalid_not_cached(void** state);
+void test__type_info_cache_find__invalidated(void** state);
+/*
+ * test _type_info_cache_update
+ */
+UT_CASE_DECLARATION(_type_info_cache_update)
+void test__type_info_cache_update__typename_null(void** state);
+void test__type_info_cache_update__typeinfo_null(void** state);
+void test__type_info_cache_update__invalid_typeinfo(void** state);
+void test__type_info_cache_update__update(void** state);
+void test__type_info_cache_update__stale_generation(void** state);
+/*
+ * test _type_cache_invalidate
+ */
+UT_CASE_DECLARATION(_type_cache_invalidate)
+void test__type_cache_invalidate__register(void** state);
+/*
+ * test _type_intern_name
+ */
+UT_CASE_DECLARATION(_type_intern_name)
+void test__type_intern_name__null(void** state);
+void test__type_intern_name__same(void** state);
+void test__type_intern_name__different(void** state);
+void test__type_intern_name__shared_by_containers(void** state);
+/*
+ * test _type_lock
+ */
+UT_CASE_DECLARATION(_type_lock)
+void test__type_lock__try_lock(void** state);
+void test__type_lock__unlock_not_locked(void** state);
+void test__type_lock__cache_update_locked(void** state);
+void test__type_lock__cache_find_writing(void** state);
+void test__type_lock__init_once(void** state);
+
 #define UT_CSTL_TYPES_AUX_CASE\
     UT_SUIT_BEGIN(cstl_types_aux, test__type_hash__null_typename),\
     UT_CASE(test__type_hash__null_empty),\
     UT_CASE(test__type_hash__lessthan_bucketcount),\
-    UT_CASE_BEGIN(_type_register_c_builtin, test__type_register_c_builtin__all),\
-    UT_CASE_BEGIN(_type_register_cstl_builtin, test__type_register_cstl_builtin__all),\
+    UT_CASE_BEGIN(_type_find_builtin, test__type_find_builtin__null_typename),\
+    UT_CASE(test__type_find_builtin__not_builtin),\
+    UT_CASE(test__type_find_builtin__user_define),\
+    UT_CASE(test__type_find_builtin__c_builtin),\
+    UT_CASE(test__type_find_builtin__cstl_builtin),\
     UT_CASE_BEGIN(_type_init, test__type_init__all),\
     UT_CASE_BEGIN(_type_is_registered, test__type_is_registered__null_typename),\
     UT_CASE(test__type_is_registered__long_typename),\
@@ -73,7 +117,28 @@ void test__type_cache_update__round(void** state);
     UT_CASE(test__type_cache_update__invalid_style),\
     UT_CASE(test__type_cache_update__empty),\
     UT_CASE(test__type_cache_update__not_empty),\
-    UT_CASE(test__type_cache_update__round)
+    UT_CASE(test__type_cache_update__round),\
+    UT_CASE_BEGIN(_type_info_cache_find, test__type_info_cache_find__typename_null),\
+    UT_CASE(test__type_info_cache_find__typeinfo_null),\
+    UT_CASE(test__type_info_cache_find__not_find),\
+    UT_CASE(test__type_info_cache_find__find),\
+    UT_CASE(test__type_info_cache_find__invalid_not_cached),\
+    UT_CASE(test__type_info_cache_find__invalidated),\
+    UT_CASE_BEGIN(_type_info_cache_update, test__type_info_cache_update__typename_null),\
+    UT_CASE(test__type_info_cache_update__typeinfo_null),\
+    UT_CASE(test__type_info_cache_update__invalid_typeinfo),\
+    UT_CASE(test__type_info_cache_update__update),\
+    UT_CASE(test__type_info_cache_update__stale_generation),\
+    UT_CASE_BEGIN(_type_cache_invalidate, test__type_cache_invalidate__register),\
+    UT_CASE_BEGIN(_type_intern_name, test__type_intern_name__null),\
+    UT_CASE(test__type_intern_name__same),\
+    UT_CASE(test__type_intern_name__different),\
+    UT_CASE(test__type_intern_name__shared_by_containers),\
+    UT_CASE_BEGIN(_type_lock, test__type_lock__try_lock),\
+    UT_CASE(test__type_lock__unlock_not_locked),\
+    UT_CASE(test__type_lock__cache_update_locked),\
+    UT_CASE(test__type_lock__cache_find_writing),\
+    UT_CASE(test__type_lock__init_once)
 
 #endif /* _UT_CSTL_TYPES_AUX_H_ */
 
@@ -22,6 +22,7 @@
 #include "cstl_slist_aux.h"
 #include "cstl_deque_aux.h"
 #include "cstl_basic_string_aux.h"
+#include "cstl_hashtable_aux.h"
 
 #include "ut_def.h"
 #include "ut_cstl_types_builtin.h"
@@ -758,6 +759,117 @@ void test__type_destroy_int__ok(void** state)
     assert_true(b_output);
 }
 
+/*
+ * test _type_hash_int
+ */
+UT_CASE_DEFINATION(_type_hash_int)
+void test__type_hash_int__null_input(void** state)
+{
+    size_t t_output = sizeof(int);
+    expect_assert_failure(_type_hash_int(NULL, &t_output));
+}
+
+void test__type_hash_int__null_output(void** state)
+{
+    int n_input = 10;
+    expect_assert_failure(_type_hash_int(&n_input, NULL));
+}
+
+void test__type_hash_int__ok(void** state)
+{
+    int n_first = 10;
+    int n_second = 10;
+    size_t t_first = sizeof(int);
+    size_t t_second = sizeof(int);
+    _type_hash_int(&n_first, &t_first);
+    _type_hash_int(&n_second, &t_second);
+    assert_true(t_first == t_second);
+    assert_true(t_first == _hashtable_hash_bytes(&n_first, sizeof(int)));
+}
+
+/*
+ * test _type_compare_int
+ */
+UT_CASE_DEFINATION(_type_compare_int)
+void test__type_compare_int__null_first(void** state)
+{
+    int n_second = 10;
+    int n_output = 0;
+    expect_assert_failure(_type_compare_int(NULL, &n_second, &n_output));
+}
+
+void test__type_compare_int__null_second(void** state)
+{
+    int n_first = 10;
+    int n_output = 0;
+    expect_assert_failure(_type_compare_int(&n_first, NULL, &n_output));
+}
+
+void test__type_compare_int__null_output(void** state)
+{
+    int n_first = 10;
+    int n_second = 10;
+    expect_assert_failure(_type_compare_int(&n_first, &n_second, NULL));
+}
+
+void test__type_compare_int__less(void** state)
+{
+    int n_first = -10;
+    int n_second = 10;
+    int n_output = 0;
+    _type_compare_int(&n_first, &n_second, &n_output);
+    assert_true(n_output < 0);
+}
+
+void test__type_compare_int__equal(void** state)
+{
+    int n_first = 10;
+    int n_second = 10;
+    int n_output = 1;
+    _type_compare_int(&n_first, &n_second, &n_output);
+    assert_true(n_output == 0);
+}
+
+void test__type_compare_int__greater(void** state)
+{
+    int n_first = 10;
+    int n_second = -10;
+    int n_output = 0;
+    _type_compare_int(&n_first, &n_second, &n_output);
+    assert_true(n_output > 0);
+}
+
+/*
+ * test _type_compare_double
+ */
+UT_CASE_DEFINATION(_type_compare_double)
+void test__type_compare_double__less(void** state)
+{
+    double d_first = 1.0;
+    double d_second = 2.0;
+    int n_output = 0;
+    _type_compare_double(&d_first, &d_second, &n_output);
+    assert_true(n_output < 0);
+}
+
+void test__type_compare_double__equal(void** state)
+{
+    double d_first = 1.0;
+    double d_second = 1.0;
+    int n_output = 1;
+    _type_compare_double(&d_first, &d_second, &n_output);
+    assert_true(n_output == 0);
+}
+
+void test__type_compare_double__greater(void** state)
+{
+    double d_first = 2.0;
+    double d_second = 1.0;
+    int n_output = 0;
+    _type_compare_double(&d_first, &d_second, &n_output);
+    assert_true(n_output > 0);
+}
+
 /*
  * test _type_init_uint
  */
@@ -1336,6 +1448,41 @@ void test__type_destroy_float__ok(void** state)
     assert_true(b_output);
 }
 
+/*
+ * test _type_hash_float
+ */
+UT_CASE_DEFINATION(_type_hash_float)
+void test__type_hash_float__null_input(void** state)
+{
+    size_t t_output = sizeof(float);
+    expect_assert_failure(_type_hash_float(NULL, &t_output));
+}
+
+void test__type_hash_float__null_output(void** state)
+{
+    float f_input = 1.5f;
+    expect_assert_failure(_type_hash_float(&f_input, NULL));
+}
+
+void test__type_hash_float__ok(void** state)
+{
+    float f_input = 1.5f;
+    size_t t_output = sizeof(float);
+    _type_hash_float(&f_input, &t_output);
+    assert_true(t_output == _hashtable_hash_bytes(&f_input, sizeof(float)));
+}
+
+void test__type_hash_float__zero(void** state)
+{
+    float f_positive = 0.0f;
+    float f_negative = -0.0f;
+    size_t t_positive = sizeof(float);
+    size_t t_negative = sizeof(float);
+    _type_hash_float(&f_positive, &t_positive);
+    _type_hash_float(&f_negative, &t_negative);
+    assert_true(t_positive == t_negative);
+}
+
 /*
  * test _type_init_double
  */
@@ -2040,6 +2187,99 @@ void test__type_destroy_cstr__ok(void** state)
     free(pstr_input);
 }
 
+/*
+ * test _type_hash_cstr
+ */
+UT_CASE_DEFINATION(_type_hash_cstr)
+void test__type_hash_cstr__null_input(void** state)
+{
+    size_t t_output = 0;
+    expect_assert_failure(_type_hash_cstr(NULL, &t_output));
+}
+
+void test__type_hash_cstr__null_output(void** state)
+{
+    string_t* pstr_input = create_string();
+    if (pstr_input == NULL) {
+        assert_true(false);
+        return;
+    }
+    string_init(pstr_input);
+    expect_assert_failure(_type_hash_cstr(pstr_input, NULL));
+    string_destroy(pstr_input);
+}
+
+void test__type_hash_cstr__ok(void** state)
+{
+    string_t* pstr_first = create_string();
+    string_t* pstr_second = create_string();
+    size_t t_first = 0;
+    size_t t_second = 0;
+    if (pstr_first == NULL || pstr_second == NULL) {
+        assert_true(false);
+        return;
+    }
+    string_init_cstr(pstr_first, "abc");
+    string_init_cstr(pstr_second, "abc");
+    _type_hash_cstr(pstr_first, &t_first);
+    _type_hash_cstr(pstr_second, &t_second);
+    assert_true(t_first == t_second);
+    assert_true(t_first == _hashtable_hash_bytes("abc", 3));
+    string_destroy(pstr_first);
+    string_destroy(pstr_second);
+}
+
+/*
+ * test _type_compare_cstr
+ */
+UT_CASE_DEFINATION(_type_compare_cstr)
+void test__type_compare_cstr__null_first(void** state)
+{
+    string_t* pstr_second = create_string();
+    int n_output = 0;
+    if (pstr_second == NULL) {
+        assert_true(false);
+        return;
+    }
+    string_init(pstr_second);
+    expect_assert_failure(_type_compare_cstr(NULL, pstr_second, &n_output));
+    string_destroy(pstr_second);
+}
+
+void test__type_compare_cstr__null_output(void** state)
+{
+    string_t* pstr_first = create_string();
+    if (pstr_first == NULL) {
+        assert_true(false);
+        return;
+    }
+    string_init(pstr_first);
+    expect_assert_failure(_type_compare_cstr(pstr_first, pstr_first, NULL));
+    string_destroy(pstr_first);
+}
+
+void test__type_compare_cstr__ok(void** state)
+{
+    string_t* pstr_first = create_string();
+    string_t* pstr_second = create_string();
+    int n_output = 0;
+    if (pstr_first == NULL || pstr_second == NULL) {
+        assert_true(false);
+        return;
+    }
+    string_init_cstr(pstr_first, "abc");
+    string_init_cstr(pstr_second, "abd");
+    _type_compare_cstr(pstr_first, pstr_second, &n_output);
+    assert_true(n_output < 0);
+    _type_compare_cstr(pstr_second, pstr_first, &n_output);
+    assert_true(n_output > 0);
+    string_assign(pstr_second, pstr_first);
+    _type_compare_cstr(pstr_first, pstr_second, &n_output);
+    assert_true(n_output == 0);
+    string_destroy(pstr_first);
+    string_destroy(pstr_second);
+}
+
 /*
  * test _type_init_vector
  */
@@ -2310,6 +2550,67 @@ void test__type_destroy_vector__ok(void** state)
     free(pvec_input);
 }
 
+/*
+ * test _type_hash_vector
+ */
+UT_CASE_DEFINATION(_type_hash_vector)
+void test__type_hash_vector__null_input(void** state)
+{
+    size_t t_output = sizeof(vector_t);
+    expect_assert_failure(_type_hash_vector(NULL, &t_output));
+}
+
+void test__type_hash_vector__null_output(void** state)
+{
+    vector_t* pvec_input = create_vector(int);
+    if (pvec_input == NULL) {
+        assert_true(false);
+        return;
+    }
+    vector_init(pvec_input);
+    expect_assert_failure(_type_hash_vector(pvec_input, NULL));
+    vector_destroy(pvec_input);
+}
+
+void test__type_hash_vector__equal(void** state)
+{
+    vector_t* pvec_first = create_vector(int);
+    vector_t* pvec_second = create_vector(int);
+    size_t t_first = sizeof(vector_t);
+    size_t t_second = sizeof(vector_t);
+    if (pvec_first == NULL || pvec_second == NULL) {
+        assert_true(false);
+        return;
+    }
+    vector_init_elem(pvec_first, 10, 100);
+    vector_init_elem(pvec_second, 10, 100);
+    _type_hash_vector(pvec_first, &t_first);
+    _type_hash_vector(pvec_second, &t_second);
+    assert_true(t_first == t_second);
+    vector_destroy(pvec_first);
+    vector_destroy(pvec_second);
+}
+
+void test__type_hash_vector__not_equal(void** state)
+{
+    vector_t* pvec_first = create_vector(int);
+    vector_t* pvec_second = create_vector(int);
+    size_t t_first = sizeof(vector_t);
+    size_t t_second = sizeof(vector_t);
+    if (pvec_first == NULL || pvec_second == NULL) {
+        assert_true(false);
+        return;
+    }
+    vector_init_elem(pvec_first, 10, 100);
+    vector_init_elem(pvec_second, 10, 100);
+    vector_push_back(pvec_second, 100);
+    _type_hash_vector(pvec_first, &t_first);
+    _type_hash_vector(pvec_second, &t_second);
+    assert_true(t_first != t_second);
+    vector_destroy(pvec_first);
+    vector_destroy(pvec_second);
+}
+
 /*
  * test _type_init_list
  */
@@ -5576,6 +5877,52 @@ void test__type_destroy_hash_set__ok(void** state)
     free(phset_input);
 }
 
+/*
+ * test _type_hash_hash_set
+ */
+UT_CASE_DEFINATION(_type_hash_hash_set)
+void test__type_hash_hash_set__null_input(void** state)
+{
+    size_t t_output = sizeof(hash_set_t);
+    expect_assert_failure(_type_hash_hash_set(NULL, &t_output));
+}
+
+void test__type_hash_hash_set__null_output(void** state)
+{
+    hash_set_t* phset_input = create_hash_set(int);
+    if (phset_input == NULL) {
+        assert_true(false);
+        return;
+    }
+    hash_set_init(phset_input);
+    expect_assert_failure(_type_hash_hash_set(phset_input, NULL));
+    hash_set_destroy(phset_input);
+}
+
+void test__type_hash_hash_set__equal(void** state)
+{
+    hash_set_t* phset_first = create_hash_set(int);
+    hash_set_t* phset_second = create_hash_set(int);
+    size_t t_first = sizeof(hash_set_t);
+    size_t t_second = sizeof(hash_set_t);
+    int i = 0;
+    if (phset_first == NULL || phset_second == NULL) {
+        assert_true(false);
+        return;
+    }
+    hash_set_init(phset_first);
+    hash_set_init_ex(phset_second, 100, NULL, NULL);
+    for (i = 0; i < 10; ++i) {
+        hash_set_insert(phset_first, i);
+        hash_set_insert(phset_second, 9 - i);
+    }
+    _type_hash_hash_set(phset_first, &t_first);
+    _type_hash_hash_set(phset_second, &t_second);
+    assert_true(t_first == t_second);
+    hash_set_destroy(phset_first);
+    hash_set_destroy(phset_second);
+}
+
 /*
  * test _type_init_hash_multiset
  */
@@ -6838,6 +7185,72 @@ void test__type_destroy_pair__ok(void** state)
     free(ppair_input);
 }
 
+/*
+ * test _type_hash_pair
+ */
+UT_CASE_DEFINATION(_type_hash_pair)
+void test__type_hash_pair__null_input(void** state)
+{
+    size_t t_output = sizeof(pair_t);
+    expect_assert_failure(_type_hash_pair(NULL, &t_output));
+}
+
+void test__type_hash_pair__null_output(void** state)
+{
+    pair_t* ppair_input = create_pair(int, int);
+    if (ppair_input == NULL) {
+        assert_true(false);
+        return;
+    }
+    pair_init(ppair_input);
+    expect_assert_failure(_type_hash_pair(ppair_input, NULL));
+    pair_destroy(ppair_input);
+}
+
+void test__type_hash_pair__equal(void** state)
+{
+    pair_t* ppair_first = create_pair(string_t, int);
+    pair_t* ppair_second = create_pair(string_t, int);
+    string_t* pstr_key = create_string();
+    size_t t_first = sizeof(pair_t);
+    size_t t_second = sizeof(pair_t);
+    if (ppair_first == NULL || ppair_second == NULL || pstr_key == NULL) {
+        assert_true(false);
+        return;
+    }
+    string_init_cstr(pstr_key, "abc");
+    pair_init_elem(ppair_first, pstr_key, 10);
+    pair_init_elem(ppair_second, pstr_key, 10);
+    _type_hash_pair(ppair_first, &t_first);
+    _type_hash_pair(ppair_second, &t_second);
+    assert_true(t_first == t_second);
+    pair_destroy(ppair_first);
+    pair_destroy(ppair_second);
+    string_destroy(pstr_key);
+}
+
+void test__type_hash_pair__not_equal(void** state)
+{
+    pair_t* ppair_first = create_pair(string_t, int);
+    pair_t* ppair_second = create_pair(string_t, int);
+    string_t* pstr_key = create_string();
+    size_t t_first = sizeof(pair_t);
+    size_t t_second = sizeof(pair_t);
+    if (ppair_first == NULL || ppair_second == NULL || pstr_key == NULL) {
+        assert_true(false);
+        return;
+    }
+    string_init_cstr(pstr_key, "abc");
+    pair_init_elem(ppair_first, pstr_key, 10);
+    pair_init_elem(ppair_second, pstr_key, 11);
+    _type_hash_pair(ppair_first, &t_first);
+    _type_hash_pair(ppair_second, &t_second);
+    assert_true(t_first != t_second);
+    pair_destroy(ppair_first);
+    pair_destroy(ppair_second);
+    string_destroy(pstr_key);
+}
+
 /*
  * test _type_init_string
  */
@@ -163,6 +163,30 @@ UT_CASE_DECLARATION(_type_destroy_int)
 void test__type_destroy_int__null_input(void** state);
 void test__type_destroy_int__null_output(void** state);
 void test__type_destroy_int__ok(void** state);
+/*
+ * test _type_hash_int
+ */
+UT_CASE_DECLARATION(_type_hash_int)
+void test__type_hash_int__null_input(void** state);
+void test__type_hash_int__null_output(void** state);
+void test__type_hash_int__ok(void** state);
+/*
+ * test _type_compare_int
+ */
+UT_CASE_DECLARATION(_type_compare_int)
+void test__type_compare_int__null_first(void** state);
+void test__type_compare_int__null_second(void** state);
+void test__type_compare_int__null_output(void** state);
+void test__type_compare_int__less(void** state);
+void test__type_compare_int__equal(void** state);
+void test__type_compare_int__greater(void** state);
+/*
+ * test _type_compare_double
+ */
+UT_CASE_DECLARATION(_type_compare_double)
+void test__type_compare_double__less(void** state);
+void test__type_compare_double__equal(void** state);
+void test__type_compare_double__greater(void** state);
 /*
  * test _type_init_uint
  */
@@ -291,6 +315,14 @@ UT_CASE_DECLARATION(_type_destroy_float)
 void test__type_destroy_float__null_input(void** state);
 void test__type_destroy_float__null_output(void** state);
 void test__type_destroy_float__ok(void** state);
+/*
+ * test _type_hash_float
+ */
+UT_CASE_DECLARATION(_type_hash_float)
+void test__type_hash_float__null_input(void** state);
+void test__type_hash_float__null_output(void** state);
+void test__type_hash_float__ok(void** state);
+void test__type_hash_float__zero(void** state);
 /*
  * test _type_init_double
  */
@@ -451,6 +483,20 @@ UT_CASE_DECLARATION(_type_destroy_cstr)
 void test__type_destroy_cstr__null_input(void** state);
 void test__type_destroy_cstr__null_output(void** state);
 void test__type_destroy_cstr__ok(void** state);
+/*
+ * test _type_hash_cstr
+ */
+UT_CASE_DECLARATION(_type_hash_cstr)
+void test__type_hash_cstr__null_input(void** state);
+void test__type_hash_cstr__null_output(void** state);
+void test__type_hash_cstr__ok(void** state);
+/*
+ * test _type_compare_cstr
+ */
+UT_CASE_DECLARATION(_type_compare_cstr)
+void test__type_compare_cstr__null_first(void** state);
+void test__type_compare_cstr__null_output(void** state);
+void test__type_compare_cstr__ok(void** state);
 /*
  * test _type_init_vector
  */
@@ -483,6 +529,14 @@ UT_CASE_DECLARATION(_type_destroy_vector)
 void test__type_destroy_vector__null_input(void** state);
 void test__type_destroy_vector__null_output(void** state);
 void test__type_destroy_vector__ok(void** state);
+/*
+ * test _type_hash_vector
+ */
+UT_CASE_DECLARATION(_type_hash_vector)
+void test__type_hash_vector__null_input(void** state);
+void test__type_hash_vector__null_output(void** state);
+void test__type_hash_vector__equal(void** state);
+void test__type_hash_vector__not_equal(void** state);
 /*
  * test _type_init_list
  */
@@ -835,6 +889,13 @@ UT_CASE_DECLARATION(_type_destroy_hash_set)
 void test__type_destroy_hash_set__null_input(void** state);
 void test__type_destroy_hash_set__null_output(void** state);
 void test__type_destroy_hash_set__ok(void** state);
+/*
+ * test _type_hash_hash_set
+ */
+UT_CASE_DECLARATION(_type_hash_hash_set)
+void test__type_hash_hash_set__null_input(void** state);
+void test__type_hash_hash_set__null_output(void** state);
+void test__type_hash_hash_set__equal(void** state);
 /*
  * test _type_init_hash_multiset
  */
@@ -963,6 +1024,14 @@ UT_CASE_DECLARATION(_type_destroy_pair)
 void test__type_destroy_pair__null_input(void** state);
 void test__type_destroy_pair__null_output(void** state);
 void test__type_destroy_pair__ok(void** state);
+/*
+ * test _type_hash_pair
+ */
+UT_CASE_DECLARATION(_type_hash_pair)
+void test__type_hash_pair__null_input(void** state);
+void test__type_hash_pair__null_output(void** state);
+void test__type_hash_pair__equal(void** state);
+void test__type_hash_pair__not_equal(void** state);
 /*
  * test _type_init_string
  */
@@ -1272,6 +1341,18 @@ void test__type_destroy_ulong_long__ok(void** state);
     UT_CASE_BEGIN(_type_destroy_int, test__type_destroy_int__null_input),\
     UT_CASE(test__type_destroy_int__null_output),\
     UT_CASE(test__type_destroy_int__ok),\
+    UT_CASE_BEGIN(_type_hash_int, test__type_hash_int__null_input),\
+    UT_CASE(test__type_hash_int__null_output),\
+    UT_CASE(test__type_hash_int__ok),\
+    UT_CASE_BEGIN(_type_compare_int, test__type_compare_int__null_first),\
+    UT_CASE(test__type_compare_int__null_second),\
+    UT_CASE(test__type_compare_int__null_output),\
+    UT_CASE(test__type_compare_int__less),\
+    UT_CASE(test__type_compare_int__equal),\
+    UT_CASE(test__type_compare_int__greater),\
+    UT_CASE_BEGIN(_type_compare_double, test__type_compare_double__less),\
+    UT_CASE(test__type_compare_double__equal),\
+    UT_CASE(test__type_compare_double__greater),\
     UT_CASE_BEGIN(_type_init_uint, test__type_init_uint__null_input),\
     UT_CASE(test__type_init_uint__null_output),\
     UT_CASE(test__type_init_uint__ok),\
@@ -1336,6 +1417,10 @@ void test__type_destroy_ulong_long__ok(void** state);
     UT_CASE_BEGIN(_type_destroy_float, test__type_destroy_float__null_input),\
     UT_CASE(test__type_destroy_float__null_output),\
     UT_CASE(test__type_destroy_float__ok),\
+    UT_CASE_BEGIN(_type_hash_float, test__type_hash_float__null_input),\
+    UT_CASE(test__type_hash_float__null_output),\
+    UT_CASE(test__type_hash_float__ok),\
+    UT_CASE(test__type_hash_float__zero),\
     UT_CASE_BEGIN(_type_init_double, test__type_init_double__null_input),\
     UT_CASE(test__type_init_double__null_output),\
     UT_CASE(test__type_init_double__ok),\
@@ -1400,6 +1485,12 @@ void test__type_destroy_ulong_long__ok(void** state);
     UT_CASE_BEGIN(_type_destroy_cstr, test__type_destroy_cstr__null_input),\
     UT_CASE(test__type_destroy_cstr__null_output),\
     UT_CASE(test__type_destroy_cstr__ok),\
+    UT_CASE_BEGIN(_type_hash_cstr, test__type_hash_cstr__null_input),\
+    UT_CASE(test__type_hash_cstr__null_output),\
+    UT_CASE(test__type_hash_cstr__ok),\
+    UT_CASE_BEGIN(_type_compare_cstr, test__type_compare_cstr__null_first),\
+    UT_CASE(test__type_compare_cstr__null_output),\
+    UT_CASE(test__type_compare_cstr__ok),\
     UT_CASE_BEGIN(_type_init_vector, test__type_init_vector__null_input),\
     UT_CASE(test__type_init_vector__null_output),\
     UT_CASE(test__type_init_vector__ok),\
@@ -1416,6 +1507,10 @@ void test__type_destroy_ulong_long__ok(void** state);
     UT_CASE_BEGIN(_type_destroy_vector, test__type_destroy_vector__null_input),\
     UT_CASE(test__type_destroy_vector__null_output),\
     UT_CASE(test__type_destroy_vector__ok),\
+    UT_CASE_BEGIN(_type_hash_vector, test__type_hash_vector__null_input),\
+    UT_CASE(test__type_hash_vector__null_output),\
+    UT_CASE(test__type_hash_vector__equal),\
+    UT_CASE(test__type_hash_vector__not_equal),\
     UT_CASE_BEGIN(_type_init_list, test__type_init_list__null_input),\
     UT_CASE(test__type_init_list__null_output),\
     UT_CASE(test__type_init_list__ok),\
@@ -1592,6 +1687,9 @@ void test__type_destroy_ulong_long__ok(void** state);
     UT_CASE_BEGIN(_type_destroy_hash_set, test__type_destroy_hash_set__null_input),\
     UT_CASE(test__type_destroy_hash_set__null_output),\
     UT_CASE(test__type_destroy_hash_set__ok),\
+    UT_CASE_BEGIN(_type_hash_hash_set, test__type_hash_hash_set__null_input),\
+    UT_CASE(test__type_hash_hash_set__null_output),\
+    UT_CASE(test__type_hash_hash_set__equal),\
     UT_CASE_BEGIN(_type_init_hash_multiset, test__type_init_hash_multiset__null_input),\
     UT_CASE(test__type_init_hash_multiset__null_output),\
     UT_CASE(test__type_init_hash_multiset__ok),\
@@ -1656,6 +1754,10 @@ void test__type_destroy_ulong_long__ok(void** state);
     UT_CASE_BEGIN(_type_destroy_pair, test__type_destroy_pair__null_input),\
     UT_CASE(test__type_destroy_pair__null_output),\
     UT_CASE(test__type_destroy_pair__ok),\
+    UT_CASE_BEGIN(_type_hash_pair, test__type_hash_pair__null_input),\
+    UT_CASE(test__type_hash_pair__null_output),\
+    UT_CASE(test__type_hash_pair__equal),\
+    UT_CASE(test__type_hash_pair__not_equal),\
     UT_CASE_BEGIN(_type_init_string, test__type_init_string__null_input),\
     UT_CASE(test__type_init_string__null_output),\
     UT_CASE(test__type_init_string__ok),\
@@ -16,21 +16,23 @@ typedef struct abc {
     int n_abc;
 }type_abc_t;
 
+static _typeanalysis_t _sgt_typeanalysis;
+
 static void test_parse_setup(const char* typename)
 {
-    _gt_typeanalysis._t_token = _TOKEN_INVALID;
-    _gt_typeanalysis._t_index = 0;
-    memset(_gt_typeanalysis._s_tokentext, '\0', _TYPE_NAME_SIZE + 1);
-    memset(_gt_typeanalysis._s_typename, '\0', _TYPE_NAME_SIZE + 1);
-    strncpy(_gt_typeanalysis._s_typename, typename, _TYPE_NAME_SIZE);
+    _sgt_typeanalysis._t_token = _TOKEN_INVALID;
+    _sgt_typeanalysis._t_index = 0;
+    memset(_sgt_typeanalysis._s_tokentext, '\0', _TYPE_NAME_SIZE + 1);
+    memset(_sgt_typeanalysis._s_typename, '\0', _TYPE_NAME_SIZE + 1);
+    strncpy(_sgt_typeanalysis._s_typename, typename, _TYPE_NAME_SIZE);
 }
 
 static void test_parse_setup_ex(const char* typename, _typetoken_t token, size_t index, const char* s_tokentext)
 {
     test_parse_setup(typename);
-    _gt_typeanalysis._t_token = token;
-    _gt_typeanalysis._t_index = index;
-    strncpy(_gt_typeanalysis._s_tokentext, s_tokentext, _TYPE_NAME_SIZE);
+    _sgt_typeanalysis._t_token = token;
+    _sgt_typeanalysis._t_index = index;
+    strncpy(_sgt_typeanalysis._s_tokentext, s_tokentext, _TYPE_NAME_SIZE);
 }
 
 /*
@@ -41,551 +43,556 @@ void test__type_get_token__sign_left_bracket(void** state)
 {
     type_register(type_abc_t, NULL, NULL, NULL, NULL);
     test_parse_setup("<");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_SIGN_LEFT_BRACKET);
-    assert_true(_gt_typeanalysis._t_index == 1);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "<", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_SIGN_LEFT_BRACKET);
+    assert_true(_sgt_typeanalysis._t_index == 1);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "<", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__sign_right_bracket(void** state)
 {
     test_parse_setup(">");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_SIGN_RIGHT_BRACKET);
-    assert_true(_gt_typeanalysis._t_index == 1);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, ">", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_SIGN_RIGHT_BRACKET);
+    assert_true(_sgt_typeanalysis._t_index == 1);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, ">", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__sign_comma(void** state)
 {
     test_parse_setup(",");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_SIGN_COMMA);
-    assert_true(_gt_typeanalysis._t_index == 1);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, ",", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_SIGN_COMMA);
+    assert_true(_sgt_typeanalysis._t_index == 1);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, ",", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__sign_pointer(void** state)
 {
     test_parse_setup("*");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_SIGN_POINTER);
-    assert_true(_gt_typeanalysis._t_index == 1);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "*", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_SIGN_POINTER);
+    assert_true(_sgt_typeanalysis._t_index == 1);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "*", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__sign_space_and_eoi(void** state)
 {
     test_parse_setup(" \t\v\f\r\n");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_END_OF_INPUT);
-    assert_true(_gt_typeanalysis._t_index == 6);
-    assert_true(strlen(_gt_typeanalysis._s_tokentext) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_END_OF_INPUT);
+    assert_true(_sgt_typeanalysis._t_index == 6);
+    assert_true(strlen(_sgt_typeanalysis._s_tokentext) == 0);
 }
 
 void test__type_get_token__sign_invalid(void** state)
 {
     test_parse_setup("@#$");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_INVALID);
-    assert_true(_gt_typeanalysis._t_index == 0);
-    assert_true(strlen(_gt_typeanalysis._s_tokentext) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_INVALID);
+    assert_true(_sgt_typeanalysis._t_index == 0);
+    assert_true(strlen(_sgt_typeanalysis._s_tokentext) == 0);
 }
 
 void test__type_get_token__identifier(void** state)
 {
     test_parse_setup("abc");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_IDENTIFIER);
-    assert_true(_gt_typeanalysis._t_index == 3);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "abc", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_IDENTIFIER);
+    assert_true(_sgt_typeanalysis._t_index == 3);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "abc", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__identifier_with_underline(void** state)
 {
     test_parse_setup("_abc_xyz_");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_IDENTIFIER);
-    assert_true(_gt_typeanalysis._t_index == 9);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "_abc_xyz_", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_IDENTIFIER);
+    assert_true(_sgt_typeanalysis._t_index == 9);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "_abc_xyz_", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_void(void** state)
 {
     test_parse_setup("void");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_VOID);
-    assert_true(_gt_typeanalysis._t_index == 4);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "void", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_VOID);
+    assert_true(_sgt_typeanalysis._t_index == 4);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "void", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_char(void** state)
 {
     test_parse_setup("char");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_CHAR);
-    assert_true(_gt_typeanalysis._t_index == 4);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "char", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_CHAR);
+    assert_true(_sgt_typeanalysis._t_index == 4);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "char", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_short(void** state)
 {
     test_parse_setup("short");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_SHORT);
-    assert_true(_gt_typeanalysis._t_index == 5);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "short", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_SHORT);
+    assert_true(_sgt_typeanalysis._t_index == 5);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "short", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_int(void** state)
 {
     test_parse_setup("int");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_INT);
-    assert_true(_gt_typeanalysis._t_index == 3);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "int", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_INT);
+    assert_true(_sgt_typeanalysis._t_index == 3);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "int", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_long(void** state)
 {
     test_parse_setup("long");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_LONG);
-    assert_true(_gt_typeanalysis._t_index == 4);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "long", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_LONG);
+    assert_true(_sgt_typeanalysis._t_index == 4);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "long", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_double(void** state)
 {
     test_parse_setup("double");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_DOUBLE);
-    assert_true(_gt_typeanalysis._t_index == 6);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "double", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_DOUBLE);
+    assert_true(_sgt_typeanalysis._t_index == 6);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "double", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_float(void** state)
 {
     test_parse_setup("float");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_FLOAT);
-    assert_true(_gt_typeanalysis._t_index == 5);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "float", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_FLOAT);
+    assert_true(_sgt_typeanalysis._t_index == 5);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "float", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_signed(void** state)
 {
     test_parse_setup("signed");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_SIGNED);
-    assert_true(_gt_typeanalysis._t_index == 6);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "signed", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_SIGNED);
+    assert_true(_sgt_typeanalysis._t_index == 6);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "signed", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_unsigned(void** state)
 {
     test_parse_setup("unsigned");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_UNSIGNED);
-    assert_true(_gt_typeanalysis._t_index == 8);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "unsigned", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_UNSIGNED);
+    assert_true(_sgt_typeanalysis._t_index == 8);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "unsigned", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_cstl_bool(void** state)
 {
     test_parse_setup("bool_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_CSTL_BOOL);
-    assert_true(_gt_typeanalysis._t_index == 6);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "bool_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_CSTL_BOOL);
+    assert_true(_sgt_typeanalysis._t_index == 6);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "bool_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_struct(void** state)
 {
     test_parse_setup("struct");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_STRUCT);
-    assert_true(_gt_typeanalysis._t_index == 6);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "struct", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_STRUCT);
+    assert_true(_sgt_typeanalysis._t_index == 6);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "struct", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_enum(void** state)
 {
     test_parse_setup("enum");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_ENUM);
-    assert_true(_gt_typeanalysis._t_index == 4);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "enum", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_ENUM);
+    assert_true(_sgt_typeanalysis._t_index == 4);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "enum", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_union(void** state)
 {
     test_parse_setup("union");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_UNION);
-    assert_true(_gt_typeanalysis._t_index == 5);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "union", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_UNION);
+    assert_true(_sgt_typeanalysis._t_index == 5);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "union", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_vector(void** state)
 {
     test_parse_setup("vector_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_VECTOR);
-    assert_true(_gt_typeanalysis._t_index == 8);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "vector_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_VECTOR);
+    assert_true(_sgt_typeanalysis._t_index == 8);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "vector_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_list(void** state)
 {
     test_parse_setup("list_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_LIST);
-    assert_true(_gt_typeanalysis._t_index == 6);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "list_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_LIST);
+    assert_true(_sgt_typeanalysis._t_index == 6);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "list_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_slist(void** state)
 {
     test_parse_setup("slist_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_SLIST);
-    assert_true(_gt_typeanalysis._t_index == 7);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "slist_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_SLIST);
+    assert_true(_sgt_typeanalysis._t_index == 7);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "slist_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_deque(void** state)
 {
     test_parse_setup("deque_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_DEQUE);
-    assert_true(_gt_typeanalysis._t_index == 7);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "deque_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_DEQUE);
+    assert_true(_sgt_typeanalysis._t_index == 7);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "deque_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_stack(void** state)
 {
     test_parse_setup("stack_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_STACK);
-    assert_true(_gt_typeanalysis._t_index == 7);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "stack_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_STACK);
+    assert_true(_sgt_typeanalysis._t_index == 7);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "stack_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_queue(void** state)
 {
     test_parse_setup("queue_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_QUEUE);
-    assert_true(_gt_typeanalysis._t_index == 7);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "queue_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_QUEUE);
+    assert_true(_sgt_typeanalysis._t_index == 7);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "queue_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_priority_queue(void** state)
 {
     test_parse_setup("priority_queue_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_PRIORITY_QUEUE);
-    assert_true(_gt_typeanalysis._t_index == 16);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "priority_queue_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_PRIORITY_QUEUE);
+    assert_true(_sgt_typeanalysis._t_index == 16);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "priority_queue_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_set(void** state)
 {
     test_parse_setup("set_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_SET);
-    assert_true(_gt_typeanalysis._t_index == 5);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "set_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_SET);
+    assert_true(_sgt_typeanalysis._t_index == 5);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "set_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_map(void** state)
 {
     test_parse_setup("map_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_MAP);
-    assert_true(_gt_typeanalysis._t_index == 5);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "map_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_MAP);
+    assert_true(_sgt_typeanalysis._t_index == 5);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "map_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_multiset(void** state)
 {
     test_parse_setup("multiset_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_MULTISET);
-    assert_true(_gt_typeanalysis._t_index == 10);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "multiset_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_MULTISET);
+    assert_true(_sgt_typeanalysis._t_index == 10);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "multiset_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_multimap(void** state)
 {
     test_parse_setup("multimap_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_MULTIMAP);
-    assert_true(_gt_typeanalysis._t_index == 10);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "multimap_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_MULTIMAP);
+    assert_true(_sgt_typeanalysis._t_index == 10);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "multimap_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_hash_set(void** state)
 {
     test_parse_setup("hash_set_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_HASH_SET);
-    assert_true(_gt_typeanalysis._t_index == 10);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "hash_set_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_HASH_SET);
+    assert_true(_sgt_typeanalysis._t_index == 10);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "hash_set_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_hash_map(void** state)
 {
     test_parse_setup("hash_map_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_HASH_MAP);
-    assert_true(_gt_typeanalysis._t_index == 10);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "hash_map_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_HASH_MAP);
+    assert_true(_sgt_typeanalysis._t_index == 10);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "hash_map_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_hash_multiset(void** state)
 {
     test_parse_setup("hash_multiset_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_HASH_MULTISET);
-    assert_true(_gt_typeanalysis._t_index == 15);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "hash_multiset_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_HASH_MULTISET);
+    assert_true(_sgt_typeanalysis._t_index == 15);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "hash_multiset_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_hash_multimap(void** state)
 {
     test_parse_setup("hash_multimap_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_HASH_MULTIMAP);
-    assert_true(_gt_typeanalysis._t_index == 15);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "hash_multimap_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_HASH_MULTIMAP);
+    assert_true(_sgt_typeanalysis._t_index == 15);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "hash_multimap_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_pair(void** state)
 {
     test_parse_setup("pair_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_PAIR);
-    assert_true(_gt_typeanalysis._t_index == 6);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "pair_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_PAIR);
+    assert_true(_sgt_typeanalysis._t_index == 6);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "pair_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_string(void** state)
 {
     test_parse_setup("string_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_STRING);
-    assert_true(_gt_typeanalysis._t_index == 8);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "string_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_STRING);
+    assert_true(_sgt_typeanalysis._t_index == 8);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "string_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_iterator(void** state)
 {
     test_parse_setup("iterator_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_ITERATOR);
-    assert_true(_gt_typeanalysis._t_index == 10);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "iterator_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_ITERATOR);
+    assert_true(_sgt_typeanalysis._t_index == 10);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "iterator_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_vector_iterator(void** state)
 {
     test_parse_setup("vector_iterator_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_VECTOR_ITERATOR);
-    assert_true(_gt_typeanalysis._t_index == 17);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "vector_iterator_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_VECTOR_ITERATOR);
+    assert_true(_sgt_typeanalysis._t_index == 17);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "vector_iterator_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_list_iterator(void** state)
 {
     test_parse_setup("list_iterator_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_LIST_ITERATOR);
-    assert_true(_gt_typeanalysis._t_index == 15);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "list_iterator_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_LIST_ITERATOR);
+    assert_true(_sgt_typeanalysis._t_index == 15);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "list_iterator_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_slist_iterator(void** state)
 {
     test_parse_setup("slist_iterator_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_SLIST_ITERATOR);
-    assert_true(_gt_typeanalysis._t_index == 16);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "slist_iterator_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_SLIST_ITERATOR);
+    assert_true(_sgt_typeanalysis._t_index == 16);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "slist_iterator_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_deque_iterator(void** state)
 {
     test_parse_setup("deque_iterator_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_DEQUE_ITERATOR);
-    assert_true(_gt_typeanalysis._t_index == 16);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "deque_iterator_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_DEQUE_ITERATOR);
+    assert_true(_sgt_typeanalysis._t_index == 16);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "deque_iterator_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_set_iterator(void** state)
 {
     test_parse_setup("set_iterator_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_SET_ITERATOR);
-    assert_true(_gt_typeanalysis._t_index == 14);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "set_iterator_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_SET_ITERATOR);
+    assert_true(_sgt_typeanalysis._t_index == 14);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "set_iterator_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_map_iterator(void** state)
 {
     test_parse_setup("map_iterator_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_MAP_ITERATOR);
-    assert_true(_gt_typeanalysis._t_index == 14);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "map_iterator_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_MAP_ITERATOR);
+    assert_true(_sgt_typeanalysis._t_index == 14);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "map_iterator_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_multiset_iterator(void** state)
 {
     test_parse_setup("multiset_iterator_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_MULTISET_ITERATOR);
-    assert_true(_gt_typeanalysis._t_index == 19);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "multiset_iterator_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_MULTISET_ITERATOR);
+    assert_true(_sgt_typeanalysis._t_index == 19);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "multiset_iterator_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_multimap_iterator(void** state)
 {
     test_parse_setup("multimap_iterator_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_MULTIMAP_ITERATOR);
-    assert_true(_gt_typeanalysis._t_index == 19);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "multimap_iterator_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_MULTIMAP_ITERATOR);
+    assert_true(_sgt_typeanalysis._t_index == 19);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "multimap_iterator_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_hash_set_iterator(void** state)
 {
     test_parse_setup("hash_set_iterator_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_HASH_SET_ITERATOR);
-    assert_true(_gt_typeanalysis._t_index == 19);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "hash_set_iterator_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_HASH_SET_ITERATOR);
+    assert_true(_sgt_typeanalysis._t_index == 19);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "hash_set_iterator_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_hash_map_iterator(void** state)
 {
     test_parse_setup("hash_map_iterator_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_HASH_MAP_ITERATOR);
-    assert_true(_gt_typeanalysis._t_index == 19);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "hash_map_iterator_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_HASH_MAP_ITERATOR);
+    assert_true(_sgt_typeanalysis._t_index == 19);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "hash_map_iterator_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_hash_multiset_iterator(void** state)
 {
     test_parse_setup("hash_multiset_iterator_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_HASH_MULTISET_ITERATOR);
-    assert_true(_gt_typeanalysis._t_index == 24);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "hash_multiset_iterator_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_HASH_MULTISET_ITERATOR);
+    assert_true(_sgt_typeanalysis._t_index == 24);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "hash_multiset_iterator_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_hash_multimap_iterator(void** state)
 {
     test_parse_setup("hash_multimap_iterator_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_HASH_MULTIMAP_ITERATOR);
-    assert_true(_gt_typeanalysis._t_index == 24);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "hash_multimap_iterator_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_HASH_MULTIMAP_ITERATOR);
+    assert_true(_sgt_typeanalysis._t_index == 24);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "hash_multimap_iterator_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_string_iterator(void** state)
 {
     test_parse_setup("string_iterator_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_STRING_ITERATOR);
-    assert_true(_gt_typeanalysis._t_index == 17);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "string_iterator_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_STRING_ITERATOR);
+    assert_true(_sgt_typeanalysis._t_index == 17);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "string_iterator_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_input_iterator(void** state)
 {
     test_parse_setup("input_iterator_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_INPUT_ITERATOR);
-    assert_true(_gt_typeanalysis._t_index == 16);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "input_iterator_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_INPUT_ITERATOR);
+    assert_true(_sgt_typeanalysis._t_index == 16);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "input_iterator_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_output_iterator(void** state)
 {
     test_parse_setup("output_iterator_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_OUTPUT_ITERATOR);
-    assert_true(_gt_typeanalysis._t_index == 17);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "output_iterator_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_OUTPUT_ITERATOR);
+    assert_true(_sgt_typeanalysis._t_index == 17);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "output_iterator_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_forward_iterator(void** state)
 {
     test_parse_setup("forward_iterator_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_FORWARD_ITERATOR);
-    assert_true(_gt_typeanalysis._t_index == 18);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "forward_iterator_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_FORWARD_ITERATOR);
+    assert_true(_sgt_typeanalysis._t_index == 18);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "forward_iterator_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_bidirectional_iterator(void** state)
 {
     test_parse_setup("bidirectional_iterator_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_BIDIRECTIONAL_ITERATOR);
-    assert_true(_gt_typeanalysis._t_index == 24);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "bidirectional_iterator_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_BIDIRECTIONAL_ITERATOR);
+    assert_true(_sgt_typeanalysis._t_index == 24);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "bidirectional_iterator_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_random_access_iterator(void** state)
 {
     test_parse_setup("random_access_iterator_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_RANDOM_ACCESS_ITERATOR);
-    assert_true(_gt_typeanalysis._t_index == 24);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "random_access_iterator_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_RANDOM_ACCESS_ITERATOR);
+    assert_true(_sgt_typeanalysis._t_index == 24);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "random_access_iterator_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_range(void** state)
 {
     test_parse_setup("range_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_RANGE);
-    assert_true(_gt_typeanalysis._t_index == 7);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "range_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_RANGE);
+    assert_true(_sgt_typeanalysis._t_index == 7);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "range_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_basic_string(void** state)
 {
     test_parse_setup("basic_string_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_BASIC_STRING);
-    assert_true(_gt_typeanalysis._t_index == 14);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "basic_string_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_BASIC_STRING);
+    assert_true(_sgt_typeanalysis._t_index == 14);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "basic_string_t", _TYPE_NAME_SIZE) == 0);
 }
 
 void test__type_get_token__key_basic_string_iterator(void** state)
 {
     test_parse_setup("basic_string_iterator_t");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_BASIC_STRING_ITERATOR);
-    assert_true(_gt_typeanalysis._t_index == 23);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "basic_string_iterator_t", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_BASIC_STRING_ITERATOR);
+    assert_true(_sgt_typeanalysis._t_index == 23);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "basic_string_iterator_t", _TYPE_NAME_SIZE) == 0);
+}
+
+void test__type_get_token__null_analysis(void** state)
+{
+    expect_assert_failure(_type_get_token(NULL));
 }
 
 #ifndef _MSC_VER
 void test__type_get_token__key_bool(void** state)
 {
     test_parse_setup("_Bool");
-    _type_get_token();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_KEY_BOOL);
-    assert_true(_gt_typeanalysis._t_index == 5);
-    assert_true(strncmp(_gt_typeanalysis._s_tokentext, "_Bool", _TYPE_NAME_SIZE) == 0);
+    _type_get_token(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_KEY_BOOL);
+    assert_true(_sgt_typeanalysis._t_index == 5);
+    assert_true(strncmp(_sgt_typeanalysis._s_tokentext, "_Bool", _TYPE_NAME_SIZE) == 0);
 }
 #endif
 
@@ -593,70 +600,75 @@ void test__type_get_token__key_bool(void** state)
  * test _type_token_rollback
  */
 UT_CASE_DEFINATION(_type_token_rollback)
+void test__type_token_rollback__null_analysis(void** state)
+{
+    expect_assert_failure(_type_token_rollback(NULL));
+}
+
 void test__type_token_rollback__invalid_token(void** state)
 {
     test_parse_setup("abc");
-    expect_assert_failure(_type_token_rollback());
+    expect_assert_failure(_type_token_rollback(&_sgt_typeanalysis));
 }
 
 void test__type_token_rollback__invalid_index(void** state)
 {
     test_parse_setup("abc");
-    _gt_typeanalysis._t_token = _TOKEN_SIGN_COMMA;
-    expect_assert_failure(_type_token_rollback());
+    _sgt_typeanalysis._t_token = _TOKEN_SIGN_COMMA;
+    expect_assert_failure(_type_token_rollback(&_sgt_typeanalysis));
 }
 
 void test__type_token_rollback__invalid_tokentext(void** state)
 {
     test_parse_setup(",abc");
-    _gt_typeanalysis._t_token = _TOKEN_SIGN_COMMA;
-    _gt_typeanalysis._t_index++;
-    strncpy(_gt_typeanalysis._s_tokentext, "abc", _TYPE_NAME_SIZE);
-    expect_assert_failure(_type_token_rollback());
+    _sgt_typeanalysis._t_token = _TOKEN_SIGN_COMMA;
+    _sgt_typeanalysis._t_index++;
+    strncpy(_sgt_typeanalysis._s_tokentext, "abc", _TYPE_NAME_SIZE);
+    expect_assert_failure(_type_token_rollback(&_sgt_typeanalysis));
 }
 
 void test__type_token_rollback__eoi(void** state)
 {
     test_parse_setup("pair_t<int, int>");
-    _gt_typeanalysis._t_token = _TOKEN_SIGN_COMMA;
-    _gt_typeanalysis._t_index = 11;
-    strncpy(_gt_typeanalysis._s_tokentext, ",", _TYPE_NAME_SIZE);
-    _type_token_rollback();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_ROLLBACK);
-    assert_true(_gt_typeanalysis._t_index = 10);
+    _sgt_typeanalysis._t_token = _TOKEN_SIGN_COMMA;
+    _sgt_typeanalysis._t_index = 11;
+    strncpy(_sgt_typeanalysis._s_tokentext, ",", _TYPE_NAME_SIZE);
+    _type_token_rollback(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_ROLLBACK);
+    assert_true(_sgt_typeanalysis._t_index = 10);
 }
 
 void test__type_token_rollback__comma(void** state)
 {
     test_parse_setup("pair_t<int,");
-    _gt_typeanalysis._t_token = _TOKEN_SIGN_COMMA;
-    _gt_typeanalysis._t_index = 11;
-    strncpy(_gt_typeanalysis._s_tokentext, ",", _TYPE_NAME_SIZE);
-    _type_token_rollback();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_ROLLBACK);
-    assert_true(_gt_typeanalysis._t_index = 10);
+    _sgt_typeanalysis._t_token = _TOKEN_SIGN_COMMA;
+    _sgt_typeanalysis._t_index = 11;
+    strncpy(_sgt_typeanalysis._s_tokentext, ",", _TYPE_NAME_SIZE);
+    _type_token_rollback(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_ROLLBACK);
+    assert_true(_sgt_typeanalysis._t_index = 10);
 }
 
 void test__type_token_rollback__right_bracket(void** state)
 {
     test_parse_setup("list_t<int>");
-    _gt_typeanalysis._t_token = _TOKEN_SIGN_RIGHT_BRACKET;
-    _gt_typeanalysis._t_index = 11;
-    strncpy(_gt_typeanalysis._s_tokentext, ">", _TYPE_NAME_SIZE);
-    _type_token_rollback();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_ROLLBACK);
-    assert_true(_gt_typeanalysis._t_index = 10);
+    _sgt_typeanalysis._t_token = _TOKEN_SIGN_RIGHT_BRACKET;
+    _sgt_typeanalysis._t_index = 11;
+    strncpy(_sgt_typeanalysis._s_tokentext, ">", _TYPE_NAME_SIZE);
+    _type_token_rollback(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_ROLLBACK);
+    assert_true(_sgt_typeanalysis._t_index = 10);
 }
 
 void test__type_token_rollback__not_rollback(void** state)
 {
     test_parse_setup("list_t<int> ");
-    _gt_typeanalysis._t_token = _TOKEN_SIGN_RIGHT_BRACKET;
-    _gt_typeanalysis._t_index = 11;
-    strncpy(_gt_typeanalysis._s_tokentext, ">", _TYPE_NAME_SIZE);
-    _type_token_rollback();
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_ROLLBACK);
-    assert_true(_gt_typeanalysis._t_index = 11);
+    _sgt_typeanalysis._t_token = _TOKEN_SIGN_RIGHT_BRACKET;
+    _sgt_typeanalysis._t_index = 11;
+    strncpy(_sgt_typeanalysis._s_tokentext, ">", _TYPE_NAME_SIZE);
+    _type_token_rollback(&_sgt_typeanalysis);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_ROLLBACK);
+    assert_true(_sgt_typeanalysis._t_index = 11);
 }
 
 /*
@@ -665,7 +677,7 @@ void test__type_token_rollback__not_rollback(void** state)
 UT_CASE_DEFINATION(_type_parse_iterator)
 void test__type_parse_iterator__null(void** state)
 {
-    expect_assert_failure(_type_parse_iterator(NULL));
+    expect_assert_failure(_type_parse_iterator(&_sgt_typeanalysis, NULL));
 }
 
 void test__type_parse_iterator__iterator(void** state)
@@ -674,7 +686,7 @@ void test__type_parse_iterator__iterator(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_ITERATOR, strlen(str), str);
 
-    assert_true(_type_parse_iterator(s_formalname));
+    assert_true(_type_parse_iterator(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -684,7 +696,7 @@ void test__type_parse_iterator__vector_iterator(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_VECTOR_ITERATOR, strlen(str), str);
 
-    assert_true(_type_parse_iterator(s_formalname));
+    assert_true(_type_parse_iterator(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -694,7 +706,7 @@ void test__type_parse_iterator__list_iterator(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_LIST_ITERATOR, strlen(str), str);
 
-    assert_true(_type_parse_iterator(s_formalname));
+    assert_true(_type_parse_iterator(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -704,7 +716,7 @@ void test__type_parse_iterator__slist_iterator(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_SLIST_ITERATOR, strlen(str), str);
 
-    assert_true(_type_parse_iterator(s_formalname));
+    assert_true(_type_parse_iterator(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -714,7 +726,7 @@ void test__type_parse_iterator__deque_iterator(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_DEQUE_ITERATOR, strlen(str), str);
 
-    assert_true(_type_parse_iterator(s_formalname));
+    assert_true(_type_parse_iterator(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -724,7 +736,7 @@ void test__type_parse_iterator__set_iterator(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_SET_ITERATOR, strlen(str), str);
 
-    assert_true(_type_parse_iterator(s_formalname));
+    assert_true(_type_parse_iterator(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -734,7 +746,7 @@ void test__type_parse_iterator__map_iterator(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_MAP_ITERATOR, strlen(str), str);
 
-    assert_true(_type_parse_iterator(s_formalname));
+    assert_true(_type_parse_iterator(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -744,7 +756,7 @@ void test__type_parse_iterator__multiset_iterator(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_MULTISET_ITERATOR, strlen(str), str);
 
-    assert_true(_type_parse_iterator(s_formalname));
+    assert_true(_type_parse_iterator(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -754,7 +766,7 @@ void test__type_parse_iterator__multimap_iterator(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_MULTIMAP_ITERATOR, strlen(str), str);
 
-    assert_true(_type_parse_iterator(s_formalname));
+    assert_true(_type_parse_iterator(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -764,7 +776,7 @@ void test__type_parse_iterator__hash_set_iterator(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_HASH_SET_ITERATOR, strlen(str), str);
 
-    assert_true(_type_parse_iterator(s_formalname));
+    assert_true(_type_parse_iterator(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -774,7 +786,7 @@ void test__type_parse_iterator__hash_map_iterator(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_HASH_MAP_ITERATOR, strlen(str), str);
 
-    assert_true(_type_parse_iterator(s_formalname));
+    assert_true(_type_parse_iterator(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -784,7 +796,7 @@ void test__type_parse_iterator__hash_multiset_iterator(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_HASH_MULTISET_ITERATOR, strlen(str), str);
 
-    assert_true(_type_parse_iterator(s_formalname));
+    assert_true(_type_parse_iterator(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -794,7 +806,7 @@ void test__type_parse_iterator__hash_multimap_iterator(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_HASH_MULTIMAP_ITERATOR, strlen(str), str);
 
-    assert_true(_type_parse_iterator(s_formalname));
+    assert_true(_type_parse_iterator(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -804,7 +816,7 @@ void test__type_parse_iterator__string_iterator(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_STRING_ITERATOR, strlen(str), str);
 
-    assert_true(_type_parse_iterator(s_formalname));
+    assert_true(_type_parse_iterator(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -814,7 +826,7 @@ void test__type_parse_iterator__input_iterator(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_INPUT_ITERATOR, strlen(str), str);
 
-    assert_true(_type_parse_iterator(s_formalname));
+    assert_true(_type_parse_iterator(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -824,7 +836,7 @@ void test__type_parse_iterator__output_iterator(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_OUTPUT_ITERATOR, strlen(str), str);
 
-    assert_true(_type_parse_iterator(s_formalname));
+    assert_true(_type_parse_iterator(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -834,7 +846,7 @@ void test__type_parse_iterator__forward_iterator(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_FORWARD_ITERATOR, strlen(str), str);
 
-    assert_true(_type_parse_iterator(s_formalname));
+    assert_true(_type_parse_iterator(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -844,7 +856,7 @@ void test__type_parse_iterator__bidirectional_iterator(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_BIDIRECTIONAL_ITERATOR, strlen(str), str);
 
-    assert_true(_type_parse_iterator(s_formalname));
+    assert_true(_type_parse_iterator(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -854,7 +866,7 @@ void test__type_parse_iterator__random_access_iterator(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_RANDOM_ACCESS_ITERATOR, strlen(str), str);
 
-    assert_true(_type_parse_iterator(s_formalname));
+    assert_true(_type_parse_iterator(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -864,7 +876,7 @@ void test__type_parse_iterator__invalid_iterator(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_ITERATOR, strlen(str), str);
 
-    expect_assert_failure(_type_parse_iterator(s_formalname));
+    expect_assert_failure(_type_parse_iterator(&_sgt_typeanalysis, s_formalname));
 }
 
 void test__type_parse_iterator__invalid_token(void** state)
@@ -873,7 +885,7 @@ void test__type_parse_iterator__invalid_token(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_INVALID, strlen(str), str);
 
-    assert_false(_type_parse_iterator(s_formalname));
+    assert_false(_type_parse_iterator(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -883,7 +895,7 @@ void test__type_parse_iterator__basic_string_iterator(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_BASIC_STRING_ITERATOR, strlen(str), str);
 
-    assert_true(_type_parse_iterator(s_formalname));
+    assert_true(_type_parse_iterator(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -893,7 +905,7 @@ void test__type_parse_iterator__basic_string_iterator(void** state)
 UT_CASE_DEFINATION(_type_parse_relation_name)
 void test__type_parse_relation_name__null(void** state)
 {
-    expect_assert_failure(_type_parse_relation_name(NULL));
+    expect_assert_failure(_type_parse_relation_name(&_sgt_typeanalysis, NULL));
 }
 
 void test__type_parse_relation_name__map(void** state)
@@ -902,7 +914,7 @@ void test__type_parse_relation_name__map(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_MAP, strlen(str), str);
 
-    assert_true(_type_parse_relation_name(s_formalname));
+    assert_true(_type_parse_relation_name(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -912,7 +924,7 @@ void test__type_parse_relation_name__multimap(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_MULTIMAP, strlen(str), str);
 
-    assert_true(_type_parse_relation_name(s_formalname));
+    assert_true(_type_parse_relation_name(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -922,7 +934,7 @@ void test__type_parse_relation_name__hash_map(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_HASH_MAP, strlen(str), str);
 
-    assert_true(_type_parse_relation_name(s_formalname));
+    assert_true(_type_parse_relation_name(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -932,7 +944,7 @@ void test__type_parse_relation_name__hash_multimap(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_HASH_MULTIMAP, strlen(str), str);
 
-    assert_true(_type_parse_relation_name(s_formalname));
+    assert_true(_type_parse_relation_name(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -942,7 +954,7 @@ void test__type_parse_relation_name__pair(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_PAIR, strlen(str), str);
 
-    assert_true(_type_parse_relation_name(s_formalname));
+    assert_true(_type_parse_relation_name(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -952,7 +964,7 @@ void test__type_parse_relation_name__invalid_tokentext(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_PAIR, strlen(str), str);
 
-    expect_assert_failure(_type_parse_relation_name(s_formalname));
+    expect_assert_failure(_type_parse_relation_name(&_sgt_typeanalysis, s_formalname));
 }
 
 void test__type_parse_relation_name__invalid_token(void** state)
@@ -961,7 +973,7 @@ void test__type_parse_relation_name__invalid_token(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_INVALID, strlen(str), str);
 
-    assert_false(_type_parse_relation_name(s_formalname));
+    assert_false(_type_parse_relation_name(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -971,7 +983,7 @@ void test__type_parse_relation_name__invalid_token(void** state)
 UT_CASE_DEFINATION(_type_parse_sequence_name)
 void test__type_parse_sequence_name__null(void** state)
 {
-    expect_assert_failure(_type_parse_sequence_name(NULL));
+    expect_assert_failure(_type_parse_sequence_name(&_sgt_typeanalysis, NULL));
 }
 
 void test__type_parse_sequence_name__vector(void** state)
@@ -980,7 +992,7 @@ void test__type_parse_sequence_name__vector(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_VECTOR, strlen(str), str);
 
-    assert_true(_type_parse_sequence_name(s_formalname));
+    assert_true(_type_parse_sequence_name(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -990,7 +1002,7 @@ void test__type_parse_sequence_name__list(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_LIST, strlen(str), str);
 
-    assert_true(_type_parse_sequence_name(s_formalname));
+    assert_true(_type_parse_sequence_name(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1000,7 +1012,7 @@ void test__type_parse_sequence_name__slist(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_SLIST, strlen(str), str);
 
-    assert_true(_type_parse_sequence_name(s_formalname));
+    assert_true(_type_parse_sequence_name(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1010,7 +1022,7 @@ void test__type_parse_sequence_name__deque(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_DEQUE, strlen(str), str);
 
-    assert_true(_type_parse_sequence_name(s_formalname));
+    assert_true(_type_parse_sequence_name(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1020,7 +1032,7 @@ void test__type_parse_sequence_name__queue(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_QUEUE, strlen(str), str);
 
-    assert_true(_type_parse_sequence_name(s_formalname));
+    assert_true(_type_parse_sequence_name(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1030,7 +1042,7 @@ void test__type_parse_sequence_name__stack(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_STACK, strlen(str), str);
 
-    assert_true(_type_parse_sequence_name(s_formalname));
+    assert_true(_type_parse_sequence_name(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1040,7 +1052,7 @@ void test__type_parse_sequence_name__priority_queue(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_PRIORITY_QUEUE, strlen(str), str);
 
-    assert_true(_type_parse_sequence_name(s_formalname));
+    assert_true(_type_parse_sequence_name(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1050,7 +1062,7 @@ void test__type_parse_sequence_name__set(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_SET, strlen(str), str);
 
-    assert_true(_type_parse_sequence_name(s_formalname));
+    assert_true(_type_parse_sequence_name(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1060,7 +1072,7 @@ void test__type_parse_sequence_name__multiset(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_MULTISET, strlen(str), str);
 
-    assert_true(_type_parse_sequence_name(s_formalname));
+    assert_true(_type_parse_sequence_name(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1070,7 +1082,7 @@ void test__type_parse_sequence_name__hash_set(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_HASH_SET, strlen(str), str);
 
-    assert_true(_type_parse_sequence_name(s_formalname));
+    assert_true(_type_parse_sequence_name(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1080,7 +1092,7 @@ void test__type_parse_sequence_name__hash_multiset(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_HASH_MULTISET, strlen(str), str);
 
-    assert_true(_type_parse_sequence_name(s_formalname));
+    assert_true(_type_parse_sequence_name(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1090,7 +1102,7 @@ void test__type_parse_sequence_name__invalid_tokentext(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_HASH_MULTISET, strlen(str), str);
 
-    expect_assert_failure(_type_parse_sequence_name(s_formalname));
+    expect_assert_failure(_type_parse_sequence_name(&_sgt_typeanalysis, s_formalname));
 }
 
 void test__type_parse_sequence_name__invalid_token(void** state)
@@ -1099,7 +1111,7 @@ void test__type_parse_sequence_name__invalid_token(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_INVALID, strlen(str), str);
 
-    assert_false(_type_parse_sequence_name(s_formalname));
+    assert_false(_type_parse_sequence_name(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1109,7 +1121,7 @@ void test__type_parse_sequence_name__basic_string(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_BASIC_STRING, strlen(str), str);
 
-    assert_true(_type_parse_sequence_name(s_formalname));
+    assert_true(_type_parse_sequence_name(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "basic_string_t", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1119,7 +1131,7 @@ void test__type_parse_sequence_name__basic_string(void** state)
 UT_CASE_DEFINATION(_type_parse_user_define_type)
 void test__type_parse_user_define_type__null(void** state)
 {
-    expect_assert_failure(_type_parse_user_define_type(NULL));
+    expect_assert_failure(_type_parse_user_define_type(&_sgt_typeanalysis, NULL));
 }
 
 void test__type_parse_user_define_type__struct(void** state)
@@ -1128,7 +1140,7 @@ void test__type_parse_user_define_type__struct(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_STRUCT, strlen(str), str);
 
-    assert_true(_type_parse_user_define_type(s_formalname));
+    assert_true(_type_parse_user_define_type(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1138,7 +1150,7 @@ void test__type_parse_user_define_type__enum(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_ENUM, strlen(str), str);
 
-    assert_true(_type_parse_user_define_type(s_formalname));
+    assert_true(_type_parse_user_define_type(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1148,7 +1160,7 @@ void test__type_parse_user_define_type__union(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_UNION, strlen(str), str);
 
-    assert_true(_type_parse_user_define_type(s_formalname));
+    assert_true(_type_parse_user_define_type(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, str, _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1158,7 +1170,7 @@ void test__type_parse_user_define_type__invalid_tokentext(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_UNION, strlen(str), str);
 
-    expect_assert_failure(_type_parse_user_define_type(s_formalname));
+    expect_assert_failure(_type_parse_user_define_type(&_sgt_typeanalysis, s_formalname));
 }
 
 void test__type_parse_user_define_type__invalid_token(void** state)
@@ -1167,7 +1179,7 @@ void test__type_parse_user_define_type__invalid_token(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_INVALID, strlen(str), str);
 
-    assert_false(_type_parse_user_define_type(s_formalname));
+    assert_false(_type_parse_user_define_type(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1177,7 +1189,7 @@ void test__type_parse_user_define_type__invalid_token(void** state)
 UT_CASE_DEFINATION(_type_parse_user_define)
 void test__type_parse_user_define__null(void** state)
 {
-    expect_assert_failure(_type_parse_user_define(NULL));
+    expect_assert_failure(_type_parse_user_define(&_sgt_typeanalysis, NULL));
 }
 
 void test__type_parse_user_define__struct_invalid_tokentype(void** state)
@@ -1186,7 +1198,7 @@ void test__type_parse_user_define__struct_invalid_tokentype(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_ENUM, strlen("struct"), "struct");
 
-    expect_assert_failure(_type_parse_user_define(s_formalname));
+    expect_assert_failure(_type_parse_user_define(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1196,7 +1208,7 @@ void test__type_parse_user_define__struct_invalid_identifier(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_STRUCT, strlen("struct"), "struct");
 
-    assert_false(_type_parse_user_define(s_formalname));
+    assert_false(_type_parse_user_define(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "struct ", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1206,7 +1218,7 @@ void test__type_parse_user_define__struct(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_STRUCT, strlen("struct"), "struct");
 
-    assert_true(_type_parse_user_define(s_formalname));
+    assert_true(_type_parse_user_define(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "struct type_abc_t", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1216,7 +1228,7 @@ void test__type_parse_user_define__identifier(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_IDENTIFIER, strlen(str), str);
 
-    assert_true(_type_parse_user_define(s_formalname));
+    assert_true(_type_parse_user_define(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "type_abc_t", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1226,7 +1238,7 @@ void test__type_parse_user_define__invalid_token(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_INT, strlen(str), str);
 
-    assert_false(_type_parse_user_define(s_formalname));
+    assert_false(_type_parse_user_define(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
 }
 /*
@@ -1235,7 +1247,7 @@ void test__type_parse_user_define__invalid_token(void** state)
 UT_CASE_DEFINATION(_type_parse_pointer_builtin)
 void test__type_parse_pointer_builtin__null(void** state)
 {
-    expect_assert_failure(_type_parse_pointer_builtin(NULL));
+    expect_assert_failure(_type_parse_pointer_builtin(&_sgt_typeanalysis, NULL));
 }
 
 void test__type_parse_pointer_builtin__pointer(void** state)
@@ -1244,7 +1256,7 @@ void test__type_parse_pointer_builtin__pointer(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_VOID, strlen("void"), "void");
 
-    assert_true(_type_parse_pointer_builtin(s_formalname));
+    assert_true(_type_parse_pointer_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "void*", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1254,7 +1266,7 @@ void test__type_parse_pointer_builtin__invalid_token(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_INT, strlen(str), str);
 
-    assert_false(_type_parse_pointer_builtin(s_formalname));
+    assert_false(_type_parse_pointer_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1264,7 +1276,7 @@ void test__type_parse_pointer_builtin__invalid_token(void** state)
 UT_CASE_DEFINATION(_type_parse_pointer_suffix)
 void test__type_parse_pointer_suffix__null(void** state)
 {
-    expect_assert_failure(_type_parse_pointer_suffix(NULL));
+    expect_assert_failure(_type_parse_pointer_suffix(&_sgt_typeanalysis, NULL));
 }
 
 void test__type_parse_pointer_suffix__pointer(void** state)
@@ -1273,7 +1285,7 @@ void test__type_parse_pointer_suffix__pointer(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_SIGN_POINTER, strlen(str), str);
 
-    assert_true(_type_parse_pointer_suffix(s_formalname));
+    assert_true(_type_parse_pointer_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "*", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1283,10 +1295,10 @@ void test__type_parse_pointer_suffix__eof(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_END_OF_INPUT, strlen(str), "");
 
-    assert_true(_type_parse_pointer_suffix(s_formalname));
+    assert_true(_type_parse_pointer_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
-    assert_true(_gt_typeanalysis._t_index == 1);
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_ROLLBACK);
+    assert_true(_sgt_typeanalysis._t_index == 1);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_ROLLBACK);
 }
 
 void test__type_parse_pointer_suffix__comma(void** state)
@@ -1295,10 +1307,10 @@ void test__type_parse_pointer_suffix__comma(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_SIGN_COMMA, strlen(str), str);
 
-    assert_true(_type_parse_pointer_suffix(s_formalname));
+    assert_true(_type_parse_pointer_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
-    assert_true(_gt_typeanalysis._t_index == 0);
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_ROLLBACK);
+    assert_true(_sgt_typeanalysis._t_index == 0);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_ROLLBACK);
 }
 
 void test__type_parse_pointer_suffix__right_bracket(void** state)
@@ -1307,10 +1319,10 @@ void test__type_parse_pointer_suffix__right_bracket(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_SIGN_RIGHT_BRACKET, strlen(str), str);
 
-    assert_true(_type_parse_pointer_suffix(s_formalname));
+    assert_true(_type_parse_pointer_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
-    assert_true(_gt_typeanalysis._t_index == 0);
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_ROLLBACK);
+    assert_true(_sgt_typeanalysis._t_index == 0);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_ROLLBACK);
 }
 
 void test__type_parse_pointer_suffix__invalid_token(void** state)
@@ -1319,7 +1331,7 @@ void test__type_parse_pointer_suffix__invalid_token(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_INT, strlen(str), str);
 
-    assert_false(_type_parse_pointer_suffix(s_formalname));
+    assert_false(_type_parse_pointer_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1329,7 +1341,7 @@ void test__type_parse_pointer_suffix__invalid_token(void** state)
 UT_CASE_DEFINATION(_type_parse_common_suffix)
 void test__type_parse_common_suffix__null(void** state)
 {
-    expect_assert_failure(_type_parse_common_suffix(NULL));
+    expect_assert_failure(_type_parse_common_suffix(&_sgt_typeanalysis, NULL));
 }
 
 void test__type_parse_common_suffix__int(void** state)
@@ -1338,7 +1350,7 @@ void test__type_parse_common_suffix__int(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_INT, strlen(str), str);
 
-    assert_true(_type_parse_common_suffix(s_formalname));
+    assert_true(_type_parse_common_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, " int", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1348,10 +1360,10 @@ void test__type_parse_common_suffix__eof(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_END_OF_INPUT, strlen(str), "");
 
-    assert_true(_type_parse_common_suffix(s_formalname));
+    assert_true(_type_parse_common_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
-    assert_true(_gt_typeanalysis._t_index == 1);
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_ROLLBACK);
+    assert_true(_sgt_typeanalysis._t_index == 1);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_ROLLBACK);
 }
 
 void test__type_parse_common_suffix__comma(void** state)
@@ -1360,10 +1372,10 @@ void test__type_parse_common_suffix__comma(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_SIGN_COMMA, strlen(str), str);
 
-    assert_true(_type_parse_common_suffix(s_formalname));
+    assert_true(_type_parse_common_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
-    assert_true(_gt_typeanalysis._t_index == 0);
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_ROLLBACK);
+    assert_true(_sgt_typeanalysis._t_index == 0);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_ROLLBACK);
 }
 
 void test__type_parse_common_suffix__right_bracket(void** state)
@@ -1372,10 +1384,10 @@ void test__type_parse_common_suffix__right_bracket(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_SIGN_RIGHT_BRACKET, strlen(str), str);
 
-    assert_true(_type_parse_common_suffix(s_formalname));
+    assert_true(_type_parse_common_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
-    assert_true(_gt_typeanalysis._t_index == 0);
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_ROLLBACK);
+    assert_true(_sgt_typeanalysis._t_index == 0);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_ROLLBACK);
 }
 
 void test__type_parse_common_suffix__invalid_token(void** state)
@@ -1384,7 +1396,7 @@ void test__type_parse_common_suffix__invalid_token(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_IDENTIFIER, strlen(str), str);
 
-    assert_false(_type_parse_common_suffix(s_formalname));
+    assert_false(_type_parse_common_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1394,7 +1406,7 @@ void test__type_parse_common_suffix__invalid_token(void** state)
 UT_CASE_DEFINATION(_type_parse_complex_suffix)
 void test__type_parse_complex_suffix__null(void** state)
 {
-    expect_assert_failure(_type_parse_complex_suffix(NULL));
+    expect_assert_failure(_type_parse_complex_suffix(&_sgt_typeanalysis, NULL));
 }
 
 void test__type_parse_complex_suffix__char(void** state)
@@ -1403,7 +1415,7 @@ void test__type_parse_complex_suffix__char(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_CHAR, strlen(str), str);
 
-    assert_true(_type_parse_complex_suffix(s_formalname));
+    assert_true(_type_parse_complex_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, " char", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1413,7 +1425,7 @@ void test__type_parse_complex_suffix__short(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_SHORT, strlen(str), str);
 
-    assert_true(_type_parse_complex_suffix(s_formalname));
+    assert_true(_type_parse_complex_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, " short", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1423,7 +1435,7 @@ void test__type_parse_complex_suffix__short_int(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_SHORT, strlen("short"), "short");
 
-    assert_true(_type_parse_complex_suffix(s_formalname));
+    assert_true(_type_parse_complex_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, " short int", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1433,7 +1445,7 @@ void test__type_parse_complex_suffix__int(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_INT, strlen(str), str);
 
-    assert_true(_type_parse_complex_suffix(s_formalname));
+    assert_true(_type_parse_complex_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, " int", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1443,7 +1455,7 @@ void test__type_parse_complex_suffix__long(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_LONG, strlen(str), str);
 
-    assert_true(_type_parse_complex_suffix(s_formalname));
+    assert_true(_type_parse_complex_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, " long", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1453,7 +1465,7 @@ void test__type_parse_complex_suffix__long_int(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_LONG, strlen("long"), "long");
 
-    assert_true(_type_parse_complex_suffix(s_formalname));
+    assert_true(_type_parse_complex_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, " long int", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1463,10 +1475,10 @@ void test__type_parse_complex_suffix__eof(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_END_OF_INPUT, strlen(str), "");
 
-    assert_true(_type_parse_complex_suffix(s_formalname));
+    assert_true(_type_parse_complex_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
-    assert_true(_gt_typeanalysis._t_index == 1);
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_ROLLBACK);
+    assert_true(_sgt_typeanalysis._t_index == 1);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_ROLLBACK);
 }
 
 void test__type_parse_complex_suffix__comma(void** state)
@@ -1475,10 +1487,10 @@ void test__type_parse_complex_suffix__comma(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_SIGN_COMMA, strlen(str), str);
 
-    assert_true(_type_parse_complex_suffix(s_formalname));
+    assert_true(_type_parse_complex_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
-    assert_true(_gt_typeanalysis._t_index == 0);
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_ROLLBACK);
+    assert_true(_sgt_typeanalysis._t_index == 0);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_ROLLBACK);
 }
 
 void test__type_parse_complex_suffix__right_bracket(void** state)
@@ -1487,10 +1499,10 @@ void test__type_parse_complex_suffix__right_bracket(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_SIGN_RIGHT_BRACKET, strlen(str), str);
 
-    assert_true(_type_parse_complex_suffix(s_formalname));
+    assert_true(_type_parse_complex_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
-    assert_true(_gt_typeanalysis._t_index == 0);
-    assert_true(_gt_typeanalysis._t_token == _TOKEN_ROLLBACK);
+    assert_true(_sgt_typeanalysis._t_index == 0);
+    assert_true(_sgt_typeanalysis._t_token == _TOKEN_ROLLBACK);
 }
 
 void test__type_parse_complex_suffix__invalid_token(void** state)
@@ -1499,7 +1511,7 @@ void test__type_parse_complex_suffix__invalid_token(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_STRUCT, strlen(str), str);
 
-    assert_false(_type_parse_complex_suffix(s_formalname));
+    assert_false(_type_parse_complex_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1510,7 +1522,7 @@ void test__type_parse_complex_suffix__long_long(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_LONG, strlen("long"), "long");
 
-    assert_true(_type_parse_complex_suffix(s_formalname));
+    assert_true(_type_parse_complex_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, " long long", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1520,7 +1532,7 @@ void test__type_parse_complex_suffix__long_long_int(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_LONG, strlen("long"), "long");
 
-    assert_true(_type_parse_complex_suffix(s_formalname));
+    assert_true(_type_parse_complex_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, " long long int", _TYPE_NAME_SIZE) == 0);
 }
 #endif
@@ -1531,7 +1543,7 @@ void test__type_parse_complex_suffix__long_long_int(void** state)
 UT_CASE_DEFINATION(_type_parse_signed_builtin)
 void test__type_parse_signed_builtin__null(void** state)
 {
-    expect_assert_failure(_type_parse_signed_builtin(NULL));
+    expect_assert_failure(_type_parse_signed_builtin(&_sgt_typeanalysis, NULL));
 }
 
 void test__type_parse_signed_builtin__valid(void** state)
@@ -1540,7 +1552,7 @@ void test__type_parse_signed_builtin__valid(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_SIGNED, strlen("signed"), "signed");
 
-    assert_true(_type_parse_signed_builtin(s_formalname));
+    assert_true(_type_parse_signed_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "signed char", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1550,7 +1562,7 @@ void test__type_parse_signed_builtin__invalid(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_UNSIGNED, strlen("unsigned"), "unsigned");
 
-    assert_false(_type_parse_signed_builtin(s_formalname));
+    assert_false(_type_parse_signed_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1560,7 +1572,7 @@ void test__type_parse_signed_builtin__invalid(void** state)
 UT_CASE_DEFINATION(_type_parse_unsigned_builtin)
 void test__type_parse_unsigned_builtin__null(void** state)
 {
-    expect_assert_failure(_type_parse_unsigned_builtin(NULL));
+    expect_assert_failure(_type_parse_unsigned_builtin(&_sgt_typeanalysis, NULL));
 }
 
 void test__type_parse_unsigned_builtin__valid(void** state)
@@ -1569,7 +1581,7 @@ void test__type_parse_unsigned_builtin__valid(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_UNSIGNED, strlen("unsigned"), "unsigned");
 
-    assert_true(_type_parse_unsigned_builtin(s_formalname));
+    assert_true(_type_parse_unsigned_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "unsigned char", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1579,7 +1591,7 @@ void test__type_parse_unsigned_builtin__invalid(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_SIGNED, strlen("signed"), "signed");
 
-    assert_false(_type_parse_unsigned_builtin(s_formalname));
+    assert_false(_type_parse_unsigned_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1589,7 +1601,7 @@ void test__type_parse_unsigned_builtin__invalid(void** state)
 UT_CASE_DEFINATION(_type_parse_simple_long_suffix)
 void test__type_parse_simple_long_suffix__null(void** state)
 {
-    expect_assert_failure(_type_parse_simple_long_suffix(NULL));
+    expect_assert_failure(_type_parse_simple_long_suffix(&_sgt_typeanalysis, NULL));
 }
 
 void test__type_parse_simple_long_suffix__double(void** state)
@@ -1598,7 +1610,7 @@ void test__type_parse_simple_long_suffix__double(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_DOUBLE, strlen(str), str);
 
-    assert_true(_type_parse_simple_long_suffix(s_formalname));
+    assert_true(_type_parse_simple_long_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, " double", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1608,7 +1620,7 @@ void test__type_parse_simple_long_suffix__common_suffix(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_INT, strlen(str), str);
 
-    assert_true(_type_parse_simple_long_suffix(s_formalname));
+    assert_true(_type_parse_simple_long_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, " int", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1618,8 +1630,8 @@ void test__type_parse_simple_long_suffix__common_suffix_comma(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_SIGN_COMMA, strlen(str), str);
 
-    assert_true(_type_parse_simple_long_suffix(s_formalname));
-    assert_true(_gt_typeanalysis._t_index == 0);
+    assert_true(_type_parse_simple_long_suffix(&_sgt_typeanalysis, s_formalname));
+    assert_true(_sgt_typeanalysis._t_index == 0);
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1629,7 +1641,7 @@ void test__type_parse_simple_long_suffix__invalid_token(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_STRUCT, strlen(str), str);
 
-    assert_false(_type_parse_simple_long_suffix(s_formalname));
+    assert_false(_type_parse_simple_long_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1640,7 +1652,7 @@ void test__type_parse_simple_long_suffix__complex_long_suffix(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_LONG, strlen("long"), "long");
 
-    assert_true(_type_parse_simple_long_suffix(s_formalname));
+    assert_true(_type_parse_simple_long_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, " long int", _TYPE_NAME_SIZE) == 0);
 }
 #endif
@@ -1651,7 +1663,7 @@ void test__type_parse_simple_long_suffix__complex_long_suffix(void** state)
 UT_CASE_DEFINATION(_type_parse_simple_builtin)
 void test__type_parse_simple_builtin__null(void** state)
 {
-    expect_assert_failure(_type_parse_simple_builtin(NULL));
+    expect_assert_failure(_type_parse_simple_builtin(&_sgt_typeanalysis, NULL));
 }
 
 void test__type_parse_simple_builtin__char(void** state)
@@ -1660,7 +1672,7 @@ void test__type_parse_simple_builtin__char(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_CHAR, strlen(str), str);
 
-    assert_true(_type_parse_simple_builtin(s_formalname));
+    assert_true(_type_parse_simple_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "char", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1670,7 +1682,7 @@ void test__type_parse_simple_builtin__short(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_SHORT, strlen(str), str);
 
-    assert_true(_type_parse_simple_builtin(s_formalname));
+    assert_true(_type_parse_simple_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "short", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1680,7 +1692,7 @@ void test__type_parse_simple_builtin__short_int(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_SHORT, strlen("short"), "short");
 
-    assert_true(_type_parse_simple_builtin(s_formalname));
+    assert_true(_type_parse_simple_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "short int", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1690,7 +1702,7 @@ void test__type_parse_simple_builtin__int(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_INT, strlen(str), str);
 
-    assert_true(_type_parse_simple_builtin(s_formalname));
+    assert_true(_type_parse_simple_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "int", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1700,7 +1712,7 @@ void test__type_parse_simple_builtin__long(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_LONG, strlen(str), str);
 
-    assert_true(_type_parse_simple_builtin(s_formalname));
+    assert_true(_type_parse_simple_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "long", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1710,7 +1722,7 @@ void test__type_parse_simple_builtin__long_int(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_LONG, strlen("long"), "long");
 
-    assert_true(_type_parse_simple_builtin(s_formalname));
+    assert_true(_type_parse_simple_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "long int", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1720,7 +1732,7 @@ void test__type_parse_simple_builtin__long_double(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_LONG, strlen("long"), "long");
 
-    assert_true(_type_parse_simple_builtin(s_formalname));
+    assert_true(_type_parse_simple_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "long double", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1730,7 +1742,7 @@ void test__type_parse_simple_builtin__float(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_FLOAT, strlen(str), str);
 
-    assert_true(_type_parse_simple_builtin(s_formalname));
+    assert_true(_type_parse_simple_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "float", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1740,7 +1752,7 @@ void test__type_parse_simple_builtin__double(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_DOUBLE, strlen(str), str);
 
-    assert_true(_type_parse_simple_builtin(s_formalname));
+    assert_true(_type_parse_simple_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "double", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1750,7 +1762,7 @@ void test__type_parse_simple_builtin__char_pointer(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_CHAR, strlen("char"), "char");
 
-    assert_true(_type_parse_simple_builtin(s_formalname));
+    assert_true(_type_parse_simple_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "char*", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1760,7 +1772,7 @@ void test__type_parse_simple_builtin__cstl_bool(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_CSTL_BOOL, strlen(str), str);
 
-    assert_true(_type_parse_simple_builtin(s_formalname));
+    assert_true(_type_parse_simple_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "bool_t", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1770,7 +1782,7 @@ void test__type_parse_simple_builtin__invalid_token(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_STRUCT, strlen(str), str);
 
-    assert_false(_type_parse_simple_builtin(s_formalname));
+    assert_false(_type_parse_simple_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1781,7 +1793,7 @@ void test__type_parse_simple_builtin__bool(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_BOOL, strlen(str), str);
 
-    assert_true(_type_parse_simple_builtin(s_formalname));
+    assert_true(_type_parse_simple_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "_Bool", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1791,7 +1803,7 @@ void test__type_parse_simple_builtin__long_long_int(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_LONG, strlen("long"), "long");
 
-    assert_true(_type_parse_simple_builtin(s_formalname));
+    assert_true(_type_parse_simple_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "long long int", _TYPE_NAME_SIZE) == 0);
 }
 #endif
@@ -1802,7 +1814,7 @@ void test__type_parse_simple_builtin__long_long_int(void** state)
 UT_CASE_DEFINATION(_type_parse_c_builtin)
 void test__type_parse_c_builtin__null(void** state)
 {
-    expect_assert_failure(_type_parse_c_builtin(NULL));
+    expect_assert_failure(_type_parse_c_builtin(&_sgt_typeanalysis, NULL));
 }
 
 void test__type_parse_c_builtin__simple_builtin(void** state)
@@ -1811,7 +1823,7 @@ void test__type_parse_c_builtin__simple_builtin(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_CSTL_BOOL, strlen(str), str);
 
-    assert_true(_type_parse_c_builtin(s_formalname));
+    assert_true(_type_parse_c_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "bool_t", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1821,7 +1833,7 @@ void test__type_parse_c_builtin__signed(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_SIGNED, strlen("signed"), "signed");
 
-    assert_true(_type_parse_c_builtin(s_formalname));
+    assert_true(_type_parse_c_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "signed int", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1831,7 +1843,7 @@ void test__type_parse_c_builtin__unsigned(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_UNSIGNED, strlen("unsigned"), "unsigned");
 
-    assert_true(_type_parse_c_builtin(s_formalname));
+    assert_true(_type_parse_c_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "unsigned int", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1841,7 +1853,7 @@ void test__type_parse_c_builtin__pointer(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_VOID, strlen("void"), "void");
 
-    assert_true(_type_parse_c_builtin(s_formalname));
+    assert_true(_type_parse_c_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "void*", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1851,7 +1863,7 @@ void test__type_parse_c_builtin__invalid_token(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_INVALID, strlen("unsigned"), "unsigned");
 
-    assert_false(_type_parse_c_builtin(s_formalname));
+    assert_false(_type_parse_c_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1861,7 +1873,7 @@ void test__type_parse_c_builtin__invalid_token(void** state)
 UT_CASE_DEFINATION(_type_parse_relation)
 void test__type_parse_relation__null(void** state)
 {
-    expect_assert_failure(_type_parse_relation(NULL));
+    expect_assert_failure(_type_parse_relation(&_sgt_typeanalysis, NULL));
 }
 
 void test__type_parse_relation__invalid_left_bracket(void** state)
@@ -1870,7 +1882,7 @@ void test__type_parse_relation__invalid_left_bracket(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_MAP, strlen("map_t"), "map_t");
 
-    assert_false(_type_parse_relation(s_formalname));
+    assert_false(_type_parse_relation(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "map_t", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1880,7 +1892,7 @@ void test__type_parse_relation__invalid_first_descriptor(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_MAP, strlen("map_t"), "map_t");
 
-    assert_false(_type_parse_relation(s_formalname));
+    assert_false(_type_parse_relation(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "map_t<", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1890,7 +1902,7 @@ void test__type_parse_relation__invalid_comma(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_MAP, strlen("map_t"), "map_t");
 
-    assert_false(_type_parse_relation(s_formalname));
+    assert_false(_type_parse_relation(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "map_t<type_abc_t", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1900,7 +1912,7 @@ void test__type_parse_relation__invalid_second_descriptor(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_MAP, strlen("map_t"), "map_t");
 
-    assert_false(_type_parse_relation(s_formalname));
+    assert_false(_type_parse_relation(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "map_t<type_abc_t,", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1910,7 +1922,7 @@ void test__type_parse_relation__invalid_right_bracket(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_MAP, strlen("map_t"), "map_t");
 
-    assert_false(_type_parse_relation(s_formalname));
+    assert_false(_type_parse_relation(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "map_t<type_abc_t,type_abc_t", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1920,7 +1932,7 @@ void test__type_parse_relation__valid(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_MAP, strlen("map_t"), "map_t");
 
-    assert_true(_type_parse_relation(s_formalname));
+    assert_true(_type_parse_relation(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "map_t<type_abc_t,type_abc_t>", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1930,7 +1942,7 @@ void test__type_parse_relation__invalid_token(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_INVALID, strlen("map_t"), "map_t");
 
-    assert_false(_type_parse_relation(s_formalname));
+    assert_false(_type_parse_relation(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1940,7 +1952,7 @@ void test__type_parse_relation__invalid_token(void** state)
 UT_CASE_DEFINATION(_type_parse_sequence)
 void test__type_parse_sequence__null(void** state)
 {
-    expect_assert_failure(_type_parse_sequence(NULL));
+    expect_assert_failure(_type_parse_sequence(&_sgt_typeanalysis, NULL));
 }
 
 void test__type_parse_sequence__invalid_left_bracket(void** state)
@@ -1949,7 +1961,7 @@ void test__type_parse_sequence__invalid_left_bracket(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_VECTOR, strlen("vector_t"), "vector_t");
 
-    assert_false(_type_parse_sequence(s_formalname));
+    assert_false(_type_parse_sequence(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "vector_t", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1959,7 +1971,7 @@ void test__type_parse_sequence__invalid_descriptor(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_VECTOR, strlen("vector_t"), "vector_t");
 
-    assert_false(_type_parse_sequence(s_formalname));
+    assert_false(_type_parse_sequence(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "vector_t<", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1969,7 +1981,7 @@ void test__type_parse_sequence__invalid_right_bracket(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_VECTOR, strlen("vector_t"), "vector_t");
 
-    assert_false(_type_parse_sequence(s_formalname));
+    assert_false(_type_parse_sequence(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "vector_t<type_abc_t", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1979,7 +1991,7 @@ void test__type_parse_sequence__valid(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_VECTOR, strlen("vector_t"), "vector_t");
 
-    assert_true(_type_parse_sequence(s_formalname));
+    assert_true(_type_parse_sequence(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "vector_t<type_abc_t>", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1989,7 +2001,7 @@ void test__type_parse_sequence__invalid_token(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_INVALID, strlen("vector_t"), "vector_t");
 
-    assert_false(_type_parse_sequence(s_formalname));
+    assert_false(_type_parse_sequence(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -1999,7 +2011,7 @@ void test__type_parse_sequence__basic_string(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_BASIC_STRING, strlen("basic_string_t"), "basic_string_t");
 
-    assert_true(_type_parse_sequence(s_formalname));
+    assert_true(_type_parse_sequence(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "basic_string_t<unsigned long long>", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -2009,7 +2021,7 @@ void test__type_parse_sequence__basic_string(void** state)
 UT_CASE_DEFINATION(_type_parse_cstl_builtin)
 void test__type_parse_cstl_builtin__null(void** state)
 {
-    expect_assert_failure(_type_parse_cstl_builtin(NULL));
+    expect_assert_failure(_type_parse_cstl_builtin(&_sgt_typeanalysis, NULL));
 }
 
 void test__type_parse_cstl_builtin__sequence(void** state)
@@ -2018,7 +2030,7 @@ void test__type_parse_cstl_builtin__sequence(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_VECTOR, strlen("vector_t"), "vector_t");
 
-    assert_true(_type_parse_cstl_builtin(s_formalname));
+    assert_true(_type_parse_cstl_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "vector_t<type_abc_t>", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -2028,7 +2040,7 @@ void test__type_parse_cstl_builtin__relation(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_HASH_MAP, strlen("hash_map_t"), "hash_map_t");
 
-    assert_true(_type_parse_cstl_builtin(s_formalname));
+    assert_true(_type_parse_cstl_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "hash_map_t<type_abc_t,int>", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -2038,7 +2050,7 @@ void test__type_parse_cstl_builtin__iterator(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_SET_ITERATOR, strlen("set_iterator_t"), "set_iterator_t");
 
-    assert_true(_type_parse_cstl_builtin(s_formalname));
+    assert_true(_type_parse_cstl_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "set_iterator_t", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -2048,7 +2060,7 @@ void test__type_parse_cstl_builtin__invalid_token(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_INVALID, strlen("vector_t"), "vector_t");
 
-    assert_false(_type_parse_sequence(s_formalname));
+    assert_false(_type_parse_sequence(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -2058,7 +2070,7 @@ void test__type_parse_cstl_builtin__string(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_STRING, strlen("string_t"), "string_t");
 
-    assert_true(_type_parse_cstl_builtin(s_formalname));
+    assert_true(_type_parse_cstl_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "string_t", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -2068,7 +2080,7 @@ void test__type_parse_cstl_builtin__range(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_RANGE, strlen("range_t"), "range_t");
 
-    assert_true(_type_parse_cstl_builtin(s_formalname));
+    assert_true(_type_parse_cstl_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "range_t", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -2078,7 +2090,7 @@ void test__type_parse_cstl_builtin__basic_string(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_BASIC_STRING, strlen("basic_string_t"), "basic_string_t");
 
-    assert_true(_type_parse_cstl_builtin(s_formalname));
+    assert_true(_type_parse_cstl_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "basic_string_t<map_t<long,long long int>>", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -2088,7 +2100,7 @@ void test__type_parse_cstl_builtin__basic_string_iterator(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_BASIC_STRING_ITERATOR, strlen("basic_string_iterator_t"), "basic_string_iterator_t");
 
-    assert_true(_type_parse_cstl_builtin(s_formalname));
+    assert_true(_type_parse_cstl_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "basic_string_iterator_t", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -2098,7 +2110,7 @@ void test__type_parse_cstl_builtin__basic_string_iterator(void** state)
 UT_CASE_DEFINATION(_type_parse_type_descript)
 void test__type_parse_type_descript__null(void** state)
 {
-    expect_assert_failure(_type_parse_type_descript(NULL));
+    expect_assert_failure(_type_parse_type_descript(&_sgt_typeanalysis, NULL));
 }
 
 void test__type_parse_type_descript__c_builtin(void** state)
@@ -2107,7 +2119,7 @@ void test__type_parse_type_descript__c_builtin(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_INT, strlen("int"), "int");
 
-    assert_true(_type_parse_type_descript(s_formalname));
+    assert_true(_type_parse_type_descript(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "int", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -2117,7 +2129,7 @@ void test__type_parse_type_descript__user_define_invalid(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_IDENTIFIER, strlen("xtype_abc_t"), "xtype_abc_t");
 
-    assert_false(_type_parse_type_descript(s_formalname));
+    assert_false(_type_parse_type_descript(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "xtype_abc_t", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -2128,7 +2140,7 @@ void test__type_parse_type_descript__user_define(void** state)
 
     test_parse_setup_ex(str, _TOKEN_IDENTIFIER, strlen("type_abc_t"), "type_abc_t");
 
-    assert_true(_type_parse_type_descript(s_formalname));
+    assert_true(_type_parse_type_descript(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "type_abc_t", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -2138,7 +2150,7 @@ void test__type_parse_type_descript__cstl_builtin(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_VECTOR, strlen("vector_t"), "vector_t");
 
-    assert_true(_type_parse_type_descript(s_formalname));
+    assert_true(_type_parse_type_descript(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "vector_t<type_abc_t>", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -2148,7 +2160,7 @@ void test__type_parse_type_descript__invalid_token(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_INVALID, strlen("vector_t"), "vector_t");
 
-    assert_false(_type_parse_type_descript(s_formalname));
+    assert_false(_type_parse_type_descript(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -2158,7 +2170,7 @@ void test__type_parse_type_descript__basic_string_iterator(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_BASIC_STRING_ITERATOR, strlen("basic_string_iterator_t"), "basic_string_iterator_t");
 
-    assert_true(_type_parse_type_descript(s_formalname));
+    assert_true(_type_parse_type_descript(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "basic_string_iterator_t", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -2292,7 +2304,7 @@ void test__type_get_style__basic_string_iterator(void** state)
 UT_CASE_DEFINATION(_type_parse_complex_long_suffix)
 void test__type_parse_complex_long_suffix__null(void** state)
 {
-    expect_assert_failure(_type_parse_complex_long_suffix(NULL));
+    expect_assert_failure(_type_parse_complex_long_suffix(&_sgt_typeanalysis, NULL));
 }
 
 void test__type_parse_complex_long_suffix__long(void** state)
@@ -2301,7 +2313,7 @@ void test__type_parse_complex_long_suffix__long(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_LONG, strlen(str), str);
 
-    assert_true(_type_parse_complex_long_suffix(s_formalname));
+    assert_true(_type_parse_complex_long_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, " long", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -2311,7 +2323,7 @@ void test__type_parse_complex_long_suffix__common_suffix(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_INT, strlen(str), str);
 
-    assert_true(_type_parse_complex_long_suffix(s_formalname));
+    assert_true(_type_parse_complex_long_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, " int", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -2321,8 +2333,8 @@ void test__type_parse_complex_long_suffix__common_suffix_comma(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_SIGN_COMMA, strlen(str), str);
 
-    assert_true(_type_parse_complex_long_suffix(s_formalname));
-    assert_true(_gt_typeanalysis._t_index == 0);
+    assert_true(_type_parse_complex_long_suffix(&_sgt_typeanalysis, s_formalname));
+    assert_true(_sgt_typeanalysis._t_index == 0);
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -2332,7 +2344,7 @@ void test__type_parse_complex_long_suffix__invalid_token(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_STRUCT, strlen(str), str);
 
-    assert_false(_type_parse_complex_long_suffix(s_formalname));
+    assert_false(_type_parse_complex_long_suffix(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -2342,7 +2354,7 @@ void test__type_parse_signed_builtin__signed_long_long_int(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_SIGNED, strlen("signed"), "signed");
 
-    assert_true(_type_parse_signed_builtin(s_formalname));
+    assert_true(_type_parse_signed_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "signed long long int", _TYPE_NAME_SIZE) == 0);
 }
 
@@ -2352,7 +2364,7 @@ void test__type_parse_unsigned_builtin__unsigned_long_long_int(void** state)
     char s_formalname[_TYPE_NAME_SIZE + 1] = {'\0'};
     test_parse_setup_ex(str, _TOKEN_KEY_UNSIGNED, strlen("unsigned"), "unsigned");
 
-    assert_true(_type_parse_unsigned_builtin(s_formalname));
+    assert_true(_type_parse_unsigned_builtin(&_sgt_typeanalysis, s_formalname));
     assert_true(strncmp(s_formalname, "unsigned long long int", _TYPE_NAME_SIZE) == 0);
 }
 #endif
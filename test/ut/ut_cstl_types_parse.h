@@ -67,6 +67,7 @@ void test__type_get_token__key_random_access_iterator(void** state);
 void test__type_get_token__key_range(void** state);
 void test__type_get_token__key_basic_string(void** state);
 void test__type_get_token__key_basic_string_iterator(void** state);
+void test__type_get_token__null_analysis(void** state);
 #ifndef _MSC_VER
 void test__type_get_token__key_bool(void** state);
 #endif
@@ -74,6 +75,7 @@ void test__type_get_token__key_bool(void** state);
  * test _type_token_rollback
  */
 UT_CASE_DECLARATION(_type_token_rollback)
+void test__type_token_rollback__null_analysis(void** state);
 void test__type_token_rollback__invalid_token(void** state);
 void test__type_token_rollback__invalid_index(void** state);
 void test__type_token_rollback__invalid_tokentext(void** state);
@@ -406,6 +408,7 @@ void test__type_get_style__basic_string_iterator(void** state);
     UT_CASE(test__type_get_token__key_range),\
     UT_CASE(test__type_get_token__key_basic_string),\
     UT_CASE(test__type_get_token__key_basic_string_iterator),\
+    UT_CASE(test__type_get_token__null_analysis),\
     UT_CASE_BEGIN(_type_parse_pointer_suffix, test__type_parse_pointer_suffix__null),\
     UT_CASE(test__type_parse_pointer_suffix__pointer),\
     UT_CASE(test__type_parse_pointer_suffix__eof),\
@@ -415,7 +418,8 @@ void test__type_get_style__basic_string_iterator(void** state);
     UT_CASE_BEGIN(_type_parse_pointer_builtin, test__type_parse_pointer_builtin__null),\
     UT_CASE(test__type_parse_pointer_builtin__pointer),\
     UT_CASE(test__type_parse_pointer_builtin__invalid_token),\
-    UT_CASE_BEGIN(_type_token_rollback, test__type_token_rollback__invalid_token),\
+    UT_CASE_BEGIN(_type_token_rollback, test__type_token_rollback__null_analysis),\
+    UT_CASE(test__type_token_rollback__invalid_token),\
     UT_CASE(test__type_token_rollback__invalid_index),\
     UT_CASE(test__type_token_rollback__invalid_tokentext),\
     UT_CASE(test__type_token_rollback__eoi),\
@@ -9,6 +9,7 @@
 #include "cstl/cvector.h"
 #include "cstl_vector_aux.h"
 #include "cstl/clist.h"
+#include "cstl/cset.h"
 
 #include "ut_def.h"
 #include "ut_cstl_vector.h"
@@ -998,6 +999,52 @@ void test_vector_max_size__successfully(void** state)
     vector_destroy(pvec);
 }
 
+/*
+ * test vector_memory_usage
+ */
+UT_CASE_DEFINATION(vector_memory_usage)
+void test_vector_memory_usage__null_vector_container(void** state)
+{
+    expect_assert_failure(vector_memory_usage(NULL));
+}
+
+void test_vector_memory_usage__non_inited(void** state)
+{
+    vector_t* pvec = create_vector(int);
+
+    pvec->_pby_finish = (_byte_t*)0x783;
+    expect_assert_failure(vector_memory_usage(pvec));
+
+    pvec->_pby_finish = NULL;
+    vector_destroy(pvec);
+}
+
+void test_vector_memory_usage__successfully(void** state)
+{
+    vector_t* pvec = create_vector(int);
+
+    vector_init(pvec);
+    assert_true(vector_memory_usage(pvec) >= sizeof(vector_t));
+
+    vector_destroy(pvec);
+}
+
+void test_vector_memory_usage__non_empty(void** state)
+{
+    vector_t* pvec = create_vector(int);
+    size_t t_usage = 0;
+    int i = 0;
+
+    vector_init(pvec);
+    t_usage = vector_memory_usage(pvec);
+    for (i = 0; i < 100; ++i) {
+        vector_push_back(pvec, i);
+    }
+    assert_true(vector_memory_usage(pvec) >= t_usage + 100 * sizeof(int));
+
+    vector_destroy(pvec);
+}
+
 /*
  * test vector_capacity
  */
@@ -1104,6 +1151,129 @@ void test_vector_reserve__expand(void** state)
     vector_destroy(pvec);
 }
 
+void test_vector_reserve__expand_relocate(void** state)
+{
+    vector_t* pvec = create_vector(set_t<int>);
+    set_t* pset = create_set(int);
+    size_t i = 0;
+
+    vector_init(pvec);
+    set_init(pset);
+    for (i = 0; i < 10; ++i) {
+        set_insert(pset, i);
+        vector_push_back(pvec, pset);
+    }
+    vector_reserve(pvec, 850);
+    assert_true(vector_capacity(pvec) == 850);
+    for (i = 0; i < 10; ++i) {
+        set_t* pset_elem = (set_t*)vector_at(pvec, i);
+        assert_true(set_size(pset_elem) == i + 1);
+        set_insert(pset_elem, 100);
+        assert_true(set_size(pset_elem) == i + 2);
+        assert_true(*(int*)iterator_get_pointer(iterator_prev(set_end(pset_elem))) == 100);
+    }
+
+    vector_destroy(pvec);
+    set_destroy(pset);
+}
+
+/*
+ * test vector_shrink_to_fit
+ */
+UT_CASE_DEFINATION(vector_shrink_to_fit)
+void test_vector_shrink_to_fit__null_vector_container(void** state)
+{
+    expect_assert_failure(vector_shrink_to_fit(NULL));
+}
+
+void test_vector_shrink_to_fit__non_inited(void** state)
+{
+    vector_t* pvec = create_vector(int);
+
+    pvec->_pby_finish = (_byte_t*)0x34;
+    expect_assert_failure(vector_shrink_to_fit(pvec));
+
+    pvec->_pby_finish = NULL;
+    vector_destroy(pvec);
+}
+
+void test_vector_shrink_to_fit__empty(void** state)
+{
+    vector_t* pvec = create_vector(int);
+
+    vector_init_n(pvec, 100);
+    vector_clear(pvec);
+    assert_true(vector_capacity(pvec) == 150);
+    vector_shrink_to_fit(pvec);
+    assert_true(vector_capacity(pvec) == 0);
+    assert_true(vector_empty(pvec));
+    vector_push_back(pvec, 9);
+    assert_true(vector_size(pvec) == 1 && *(int*)vector_front(pvec) == 9);
+
+    vector_destroy(pvec);
+}
+
+void test_vector_shrink_to_fit__not_change(void** state)
+{
+    vector_t* pvec = create_vector(int);
+
+    vector_init(pvec);
+    vector_reserve(pvec, 10);
+    vector_resize(pvec, 10);
+    assert_true(vector_capacity(pvec) == 10);
+    vector_shrink_to_fit(pvec);
+    assert_true(vector_capacity(pvec) == 10);
+
+    vector_destroy(pvec);
+}
+
+void test_vector_shrink_to_fit__shrink(void** state)
+{
+    vector_t* pvec = create_vector(int);
+    size_t i = 0;
+
+    vector_init(pvec);
+    for (i = 0; i < 100; ++i) {
+        vector_push_back(pvec, i);
+    }
+    vector_resize(pvec, 10);
+    assert_true(vector_capacity(pvec) > 10);
+    vector_shrink_to_fit(pvec);
+    assert_true(vector_capacity(pvec) == 10);
+    for (i = 0; i < 10; ++i) {
+        assert_true(*(int*)vector_at(pvec, i) == (int)i);
+    }
+
+    vector_destroy(pvec);
+}
+
+void test_vector_shrink_to_fit__shrink_relocate(void** state)
+{
+    vector_t* pvec = create_vector(set_t<int>);
+    set_t* pset = create_set(int);
+    size_t i = 0;
+
+    vector_init(pvec);
+    set_init(pset);
+    vector_reserve(pvec, 850);
+    for (i = 0; i < 10; ++i) {
+        set_insert(pset, i);
+        vector_push_back(pvec, pset);
+    }
+    vector_shrink_to_fit(pvec);
+    assert_true(vector_capacity(pvec) == 10);
+    for (i = 0; i < 10; ++i) {
+        set_t* pset_elem = (set_t*)vector_at(pvec, i);
+        assert_true(set_size(pset_elem) == i + 1);
+        set_insert(pset_elem, 100);
+        assert_true(set_size(pset_elem) == i + 2);
+        assert_true(*(int*)iterator_get_pointer(iterator_prev(set_end(pset_elem))) == 100);
+    }
+
+    vector_destroy(pvec);
+    set_destroy(pset);
+}
+
 /*
  * test vector_equal
  */
@@ -5254,3 +5424,59 @@ void test_vector_resize__successfully_1000_resize_2000(void** state)
     vector_destroy(pvec);
 }
 
+/*
+ * test vector_push_back_ptr
+ */
+UT_CASE_DEFINATION(vector_push_back_ptr)
+void test_vector_push_back_ptr__null_vector(void** state)
+{
+    int elem = 9;
+
+    expect_assert_failure(vector_push_back_ptr(NULL, &elem));
+}
+
+void test_vector_push_back_ptr__c_builtin(void** state)
+{
+    vector_t* pt_vector = create_vector(int);
+    int elem;
+    int i;
+
+    vector_init(pt_vector);
+    for (i = 0; i < 100; ++i) {
+        elem = i;
+        vector_push_back_ptr(pt_vector, &elem);
+        assert_true(*(int*)vector_back(pt_vector) == i);
+    }
+    assert_true(vector_size(pt_vector) == 100);
+
+    vector_destroy(pt_vector);
+}
+
+void test_vector_push_back_ptr__cstr(void** state)
+{
+    vector_t* pt_vector = create_vector(char*);
+
+    vector_init(pt_vector);
+    vector_push_back_ptr(pt_vector, "abc");
+    vector_push_back_ptr(pt_vector, "defg");
+    assert_true(strcmp((char*)vector_back(pt_vector), "defg") == 0);
+    assert_true(vector_size(pt_vector) == 2);
+
+    vector_destroy(pt_vector);
+}
+
+void test_vector_push_back_ptr__libcstl_builtin(void** state)
+{
+    vector_t* pt_vector = create_vector(list_t<int>);
+    list_t* plist_list = create_list(int);
+
+    vector_init(pt_vector);
+    list_init_n(plist_list, 5);
+    vector_push_back_ptr(pt_vector, plist_list);
+    assert_true(list_equal((list_t*)vector_back(pt_vector), plist_list));
+    assert_true((list_t*)vector_back(pt_vector) != plist_list);
+
+    vector_destroy(pt_vector);
+    list_destroy(plist_list);
+}
+
@@ -103,6 +103,14 @@ UT_CASE_DECLARATION(vector_max_size)
 void test_vector_max_size__null_vector_container(void** state);
 void test_vector_max_size__non_inited(void** state);
 void test_vector_max_size__successfully(void** state);
+/*
+ * test vector_memory_usage
+ */
+UT_CASE_DECLARATION(vector_memory_usage)
+void test_vector_memory_usage__null_vector_container(void** state);
+void test_vector_memory_usage__non_inited(void** state);
+void test_vector_memory_usage__successfully(void** state);
+void test_vector_memory_usage__non_empty(void** state);
 /*
  * test vector_capacity
  */
@@ -121,6 +129,17 @@ void test_vector_reserve__non_inited(void** state);
 void test_vector_reserve__shrink(void** state);
 void test_vector_reserve__not_change(void** state);
 void test_vector_reserve__expand(void** state);
+void test_vector_reserve__expand_relocate(void** state);
+/*
+ * test vector_shrink_to_fit
+ */
+UT_CASE_DECLARATION(vector_shrink_to_fit)
+void test_vector_shrink_to_fit__null_vector_container(void** state);
+void test_vector_shrink_to_fit__non_inited(void** state);
+void test_vector_shrink_to_fit__empty(void** state);
+void test_vector_shrink_to_fit__not_change(void** state);
+void test_vector_shrink_to_fit__shrink(void** state);
+void test_vector_shrink_to_fit__shrink_relocate(void** state);
 /*
  * test vector_equal
  */
@@ -447,6 +466,14 @@ void test_vector_resize__successfully_1000_resize_1000(void** state);
 void test_vector_resize__successfully_1000_resize_1200(void** state);
 void test_vector_resize__successfully_1000_resize_2000(void** state);
 
+/*
+ * test vector_push_back_ptr
+ */
+UT_CASE_DECLARATION(vector_push_back_ptr)
+void test_vector_push_back_ptr__null_vector(void** state);
+void test_vector_push_back_ptr__c_builtin(void** state);
+void test_vector_push_back_ptr__cstr(void** state);
+void test_vector_push_back_ptr__libcstl_builtin(void** state);
 #define UT_CSTL_VECTOR_CASE\
     UT_SUIT_BEGIN(cstl_vector, test_vector_init__null_vector_container),\
     UT_CASE(test_vector_init__non_created),\
@@ -512,6 +539,10 @@ void test_vector_resize__successfully_1000_resize_2000(void** state);
     UT_CASE_BEGIN(vector_max_size, test_vector_max_size__null_vector_container),\
     UT_CASE(test_vector_max_size__non_inited),\
     UT_CASE(test_vector_max_size__successfully),\
+    UT_CASE_BEGIN(vector_memory_usage, test_vector_memory_usage__null_vector_container),\
+    UT_CASE(test_vector_memory_usage__non_inited),\
+    UT_CASE(test_vector_memory_usage__successfully),\
+    UT_CASE(test_vector_memory_usage__non_empty),\
     UT_CASE_BEGIN(vector_capacity, test_vector_capacity__null_vector_container),\
     UT_CASE(test_vector_capacity__non_inited),\
     UT_CASE(test_vector_capacity__successfully_empty),\
@@ -522,6 +553,13 @@ void test_vector_resize__successfully_1000_resize_2000(void** state);
     UT_CASE(test_vector_reserve__shrink),\
     UT_CASE(test_vector_reserve__not_change),\
     UT_CASE(test_vector_reserve__expand),\
+    UT_CASE(test_vector_reserve__expand_relocate),\
+    UT_CASE_BEGIN(vector_shrink_to_fit, test_vector_shrink_to_fit__null_vector_container),\
+    UT_CASE(test_vector_shrink_to_fit__non_inited),\
+    UT_CASE(test_vector_shrink_to_fit__empty),\
+    UT_CASE(test_vector_shrink_to_fit__not_change),\
+    UT_CASE(test_vector_shrink_to_fit__shrink),\
+    UT_CASE(test_vector_shrink_to_fit__shrink_relocate),\
     UT_CASE_BEGIN(vector_equal, test_vector_equal__null_first),\
     UT_CASE(test_vector_equal__null_second),\
     UT_CASE(test_vector_equal__non_inited_first),\
@@ -758,7 +796,11 @@ void test_vector_resize__successfully_1000_resize_2000(void** state);
     UT_CASE(test_vector_resize__successfully_1000_resize_10),\
     UT_CASE(test_vector_resize__successfully_1000_resize_1000),\
     UT_CASE(test_vector_resize__successfully_1000_resize_1200),\
-    UT_CASE(test_vector_resize__successfully_1000_resize_2000)
+    UT_CASE(test_vector_resize__successfully_1000_resize_2000),\
+    UT_CASE_BEGIN(vector_push_back_ptr, test_vector_push_back_ptr__null_vector),\
+    UT_CASE(test_vector_push_back_ptr__c_builtin),\
+    UT_CASE(test_vector_push_back_ptr__cstr),\
+    UT_CASE(test_vector_push_back_ptr__libcstl_builtin)
 
 #endif /* _UT_CSTL_VECTOR_H_ */
 
@@ -12,6 +12,13 @@ void test__create_vector__unregisted_type(void** state);
 void test__create_vector__c_builtin_type(void** state);
 void test__create_vector__libcstl_builtin_type(void** state);
 void test__create_vector__registed_type(void** state);
+/*
+ * test _create_vector_with_allocator
+ */
+UT_CASE_DECLARATION(_create_vector_with_allocator)
+void test__create_vector_with_allocator__null_allocator(void** state);
+void test__create_vector_with_allocator__unregisted_type(void** state);
+void test__create_vector_with_allocator__allocate_by_allocator(void** state);
 /*
  * test _create_vector_auxiliary
  */
@@ -120,6 +127,9 @@ void test__vector_init_elem_auxiliary__successfully_container(void** state);
     UT_CASE(test__create_vector__c_builtin_type),\
     UT_CASE(test__create_vector__libcstl_builtin_type),\
     UT_CASE(test__create_vector__registed_type),\
+    UT_CASE_BEGIN(_create_vector_with_allocator, test__create_vector_with_allocator__null_allocator),\
+    UT_CASE(test__create_vector_with_allocator__unregisted_type),\
+    UT_CASE(test__create_vector_with_allocator__allocate_by_allocator),\
     UT_CASE_BEGIN(_create_vector_auxiliary, test__create_vector_auxiliary__null_vector_container),\
     UT_CASE(test__create_vector_auxiliary__null_typename),\
     UT_CASE(test__create_vector_auxiliary__unregisted_type),\
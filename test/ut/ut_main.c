@@ -66,6 +66,7 @@
 #include "ut_cstl_hashtable_private.h"
 #include "ut_cstl_hashtable_iterator.h"
 #include "ut_cstl_hashtable.h"
+#include "ut_cstl_flat_hashtable.h"
 #include "ut_cstl_hash_set_aux.h"
 #include "ut_cstl_hash_set_private.h"
 #include "ut_cstl_hash_set_iterator.h"
@@ -167,6 +168,7 @@ int main(int argc, char* argv[])
         UT_CSTL_HASHTABLE_PRIVATE_CASE,
         UT_CSTL_HASHTABLE_ITERATOR_CASE,
         UT_CSTL_HASHTABLE_CASE,
+        UT_CSTL_FLAT_HASHTABLE_CASE,
         UT_CSTL_HASH_SET_AUX_CASE,
         UT_CSTL_HASH_SET_PRIVATE_CASE,
         UT_CSTL_HASH_SET_ITERATOR_CASE,